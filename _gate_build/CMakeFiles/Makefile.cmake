@@ -0,0 +1,623 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "contrib/libzlib-ng/zconf.h.cmakein"
+  "/root/repo/cmake/add_check.cmake"
+  "/root/repo/cmake/dbms_generate_function.cmake"
+  "/root/repo/cmake/dbms_glob_sources.cmake"
+  "/root/repo/cmake/find_boost.cmake"
+  "/root/repo/cmake/find_ccache.cmake"
+  "/root/repo/cmake/find_contrib_lib.cmake"
+  "/root/repo/cmake/find_icu4c.cmake"
+  "/root/repo/cmake/find_ltdl.cmake"
+  "/root/repo/cmake/find_lz4.cmake"
+  "/root/repo/cmake/find_openssl.cmake"
+  "/root/repo/cmake/find_poco.cmake"
+  "/root/repo/cmake/find_re2.cmake"
+  "/root/repo/cmake/find_readline_edit.cmake"
+  "/root/repo/cmake/find_rt.cmake"
+  "/root/repo/cmake/find_sparsehash.cmake"
+  "/root/repo/cmake/find_zlib.cmake"
+  "/root/repo/cmake/find_zookeeper.cmake"
+  "/root/repo/cmake/find_zstd.cmake"
+  "/root/repo/cmake/lib_name.cmake"
+  "/root/repo/cmake/print_include_directories.cmake"
+  "/root/repo/cmake/test_compiler.cmake"
+  "/root/repo/cmake/test_cpu.cmake"
+  "/root/repo/contrib/CMakeLists.txt"
+  "/root/repo/contrib/googletest/CMakeLists.txt"
+  "/root/repo/contrib/googletest/cmake/internal_utils.cmake"
+  "/root/repo/contrib/libboost/CMakeLists.txt"
+  "/root/repo/contrib/libbtrie/CMakeLists.txt"
+  "/root/repo/contrib/libcctz/CMakeLists.txt"
+  "/root/repo/contrib/libcityhash/CMakeLists.txt"
+  "/root/repo/contrib/libcpuid/CMakeLists.txt"
+  "/root/repo/contrib/libdouble-conversion/CMakeLists.txt"
+  "/root/repo/contrib/libfarmhash/CMakeLists.txt"
+  "/root/repo/contrib/liblz4/CMakeLists.txt"
+  "/root/repo/contrib/libmetrohash/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/Crypto/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/Data/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/Foundation/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/MongoDB/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/Net/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/Net/cmake/test_anl.cmake"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/Util/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/XML/CMakeLists.txt"
+  "/root/repo/contrib/libpoco/cmake/FindAPR.cmake"
+  "/root/repo/contrib/libpoco/cmake/FindApache2.cmake"
+  "/root/repo/contrib/libpoco/cmake/FindODBC.cmake"
+  "/root/repo/contrib/libpoco/cmake/PocoConfig.cmake.in"
+  "/root/repo/contrib/libpoco/cmake/PocoMacros.cmake"
+  "/root/repo/contrib/libpoco/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/contrib/libre2/CMakeLists.txt"
+  "/root/repo/contrib/libtcmalloc/CMakeLists.txt"
+  "/root/repo/contrib/libunwind/CMakeLists.txt"
+  "/root/repo/contrib/libunwind/config/config.h.in"
+  "/root/repo/contrib/libunwind/config/libunwind-common.h.in"
+  "/root/repo/contrib/libunwind/config/libunwind.h.in"
+  "/root/repo/contrib/libunwind/config/tdep/libunwind_i.h.in"
+  "/root/repo/contrib/libzlib-ng/CMakeLists.txt"
+  "/root/repo/contrib/libzlib-ng/zlib.pc.cmakein"
+  "/root/repo/contrib/libzookeeper/CMakeLists.txt"
+  "/root/repo/contrib/libzstd/CMakeLists.txt"
+  "/root/repo/dbms/CMakeLists.txt"
+  "/root/repo/dbms/cmake/find_vectorclass.cmake"
+  "/root/repo/dbms/cmake/version.cmake"
+  "/root/repo/dbms/src/AggregateFunctions/CMakeLists.txt"
+  "/root/repo/dbms/src/Analyzers/CMakeLists.txt"
+  "/root/repo/dbms/src/Analyzers/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/CMakeLists.txt"
+  "/root/repo/dbms/src/Client/CMakeLists.txt"
+  "/root/repo/dbms/src/Client/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Common/CMakeLists.txt"
+  "/root/repo/dbms/src/Common/ZooKeeper/CMakeLists.txt"
+  "/root/repo/dbms/src/Common/ZooKeeper/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Common/benchmarks/CMakeLists.txt"
+  "/root/repo/dbms/src/Common/config.h.in"
+  "/root/repo/dbms/src/Common/config_build.cpp.in"
+  "/root/repo/dbms/src/Common/config_version.h.in"
+  "/root/repo/dbms/src/Common/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Core/CMakeLists.txt"
+  "/root/repo/dbms/src/Core/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/DataStreams/CMakeLists.txt"
+  "/root/repo/dbms/src/DataStreams/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/DataTypes/CMakeLists.txt"
+  "/root/repo/dbms/src/DataTypes/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Dictionaries/CMakeLists.txt"
+  "/root/repo/dbms/src/Functions/CMakeLists.txt"
+  "/root/repo/dbms/src/Functions/registerFunction.cpp.in"
+  "/root/repo/dbms/src/Functions/registerFunction.h.in"
+  "/root/repo/dbms/src/Functions/registerFunctions_area.cpp.in"
+  "/root/repo/dbms/src/Functions/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/IO/CMakeLists.txt"
+  "/root/repo/dbms/src/IO/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Interpreters/CMakeLists.txt"
+  "/root/repo/dbms/src/Interpreters/config_compile.h.in"
+  "/root/repo/dbms/src/Interpreters/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Parsers/CMakeLists.txt"
+  "/root/repo/dbms/src/Parsers/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/Server/CMakeLists.txt"
+  "/root/repo/dbms/src/Storages/CMakeLists.txt"
+  "/root/repo/dbms/src/Storages/System/CMakeLists.txt"
+  "/root/repo/dbms/src/Storages/tests/CMakeLists.txt"
+  "/root/repo/dbms/src/TableFunctions/CMakeLists.txt"
+  "/root/repo/dbms/tests/CMakeLists.txt"
+  "/root/repo/dbms/tests/external_dictionaries/CMakeLists.txt"
+  "/root/repo/dbms/tests/external_dictionaries/dictionary_library/CMakeLists.txt"
+  "/root/repo/libs/CMakeLists.txt"
+  "/root/repo/libs/libcommon/CMakeLists.txt"
+  "/root/repo/libs/libcommon/cmake/find_cctz.cmake"
+  "/root/repo/libs/libcommon/cmake/find_gperftools.cmake"
+  "/root/repo/libs/libcommon/cmake/find_jemalloc.cmake"
+  "/root/repo/libs/libcommon/include/common/config_common.h.in"
+  "/root/repo/libs/libcommon/src/tests/CMakeLists.txt"
+  "/root/repo/libs/libdaemon/CMakeLists.txt"
+  "/root/repo/libs/libdaemon/cmake/find_unwind.cmake"
+  "/root/repo/libs/libglibc-compatibility/CMakeLists.txt"
+  "/root/repo/libs/libglibc-compatibility/tests/CMakeLists.txt"
+  "/root/repo/libs/libmemcpy/CMakeLists.txt"
+  "/root/repo/libs/libmysqlxx/cmake/find_mysqlclient.cmake"
+  "/root/repo/libs/libpocoext/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/root/repo/utils/check-marks/CMakeLists.txt"
+  "/root/repo/utils/compressor/CMakeLists.txt"
+  "/root/repo/utils/config-processor/CMakeLists.txt"
+  "/root/repo/utils/corrector_utf8/CMakeLists.txt"
+  "/root/repo/utils/fill-factor/CMakeLists.txt"
+  "/root/repo/utils/iotest/CMakeLists.txt"
+  "/root/repo/utils/test-data-generator/CMakeLists.txt"
+  "/root/repo/utils/wikistat-loader/CMakeLists.txt"
+  "/root/repo/utils/zookeeper-cli/CMakeLists.txt"
+  "/root/repo/utils/zookeeper-create-entry-to-download-part/CMakeLists.txt"
+  "/root/repo/utils/zookeeper-dump-tree/CMakeLists.txt"
+  "/root/repo/utils/zookeeper-remove-by-list/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FeatureSummary.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libboost/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/cmake_uninstall.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "contrib/libpoco/Poco/PocoConfig.cmake"
+  "contrib/libpoco/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/Foundation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/XML/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/MongoDB/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/Util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/Net/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/Crypto/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libpoco/Data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/liblz4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libzstd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libre2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libdouble-conversion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libzookeeper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libcityhash/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libfarmhash/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libmetrohash/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libbtrie/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libunwind/config/config.h"
+  "contrib/libunwind/config/libunwind.h"
+  "contrib/libunwind/config/libunwind-common.h"
+  "contrib/libunwind/config/tdep/libunwind_i.h"
+  "contrib/libunwind/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libzlib-ng/zlib.pc"
+  "contrib/libzlib-ng/zconf.h"
+  "contrib/libzlib-ng/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libcctz/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libtcmalloc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/libcpuid/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libcommon/include/common/config_common.h"
+  "libs/libcommon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libpocoext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libdaemon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libmemcpy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libglibc-compatibility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libs/libglibc-compatibility/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/compressor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/iotest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/corrector_utf8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/config-processor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/zookeeper-cli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/zookeeper-dump-tree/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/zookeeper-remove-by-list/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/zookeeper-create-entry-to-download-part/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/wikistat-loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/fill-factor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/check-marks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/test-data-generator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Common/config.h"
+  "dbms/src/Common/config_version.h"
+  "dbms/src/Common/config_build.cpp"
+  "dbms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Columns/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Common/ZooKeeper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Common/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Core/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/DataStreams/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/DataTypes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/DataTypes/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Dictionaries/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Storages/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Storages/System/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Parsers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Parsers/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/IO/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/IO/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Functions/registerFunctionPlus.h"
+  "dbms/src/Functions/registerFunctionPlus.cpp"
+  "dbms/src/Functions/registerFunctionMinus.h"
+  "dbms/src/Functions/registerFunctionMinus.cpp"
+  "dbms/src/Functions/registerFunctionMultiply.h"
+  "dbms/src/Functions/registerFunctionMultiply.cpp"
+  "dbms/src/Functions/registerFunctionDivideFloating.h"
+  "dbms/src/Functions/registerFunctionDivideFloating.cpp"
+  "dbms/src/Functions/registerFunctionDivideIntegral.h"
+  "dbms/src/Functions/registerFunctionDivideIntegral.cpp"
+  "dbms/src/Functions/registerFunctionDivideIntegralOrZero.h"
+  "dbms/src/Functions/registerFunctionDivideIntegralOrZero.cpp"
+  "dbms/src/Functions/registerFunctionModulo.h"
+  "dbms/src/Functions/registerFunctionModulo.cpp"
+  "dbms/src/Functions/registerFunctionNegate.h"
+  "dbms/src/Functions/registerFunctionNegate.cpp"
+  "dbms/src/Functions/registerFunctionAbs.h"
+  "dbms/src/Functions/registerFunctionAbs.cpp"
+  "dbms/src/Functions/registerFunctionBitAnd.h"
+  "dbms/src/Functions/registerFunctionBitAnd.cpp"
+  "dbms/src/Functions/registerFunctionBitOr.h"
+  "dbms/src/Functions/registerFunctionBitOr.cpp"
+  "dbms/src/Functions/registerFunctionBitXor.h"
+  "dbms/src/Functions/registerFunctionBitXor.cpp"
+  "dbms/src/Functions/registerFunctionBitNot.h"
+  "dbms/src/Functions/registerFunctionBitNot.cpp"
+  "dbms/src/Functions/registerFunctionBitShiftLeft.h"
+  "dbms/src/Functions/registerFunctionBitShiftLeft.cpp"
+  "dbms/src/Functions/registerFunctionBitShiftRight.h"
+  "dbms/src/Functions/registerFunctionBitShiftRight.cpp"
+  "dbms/src/Functions/registerFunctionBitRotateLeft.h"
+  "dbms/src/Functions/registerFunctionBitRotateLeft.cpp"
+  "dbms/src/Functions/registerFunctionBitRotateRight.h"
+  "dbms/src/Functions/registerFunctionBitRotateRight.cpp"
+  "dbms/src/Functions/registerFunctionLeast.h"
+  "dbms/src/Functions/registerFunctionLeast.cpp"
+  "dbms/src/Functions/registerFunctionGreatest.h"
+  "dbms/src/Functions/registerFunctionGreatest.cpp"
+  "dbms/src/Functions/registerFunctionBitTest.h"
+  "dbms/src/Functions/registerFunctionBitTest.cpp"
+  "dbms/src/Functions/registerFunctionBitTestAny.h"
+  "dbms/src/Functions/registerFunctionBitTestAny.cpp"
+  "dbms/src/Functions/registerFunctionBitTestAll.h"
+  "dbms/src/Functions/registerFunctionBitTestAll.cpp"
+  "dbms/src/Functions/registerFunctionsArithmetic.cpp"
+  "dbms/src/Functions/registerFunctionArray.h"
+  "dbms/src/Functions/registerFunctionArray.cpp"
+  "dbms/src/Functions/registerFunctionArrayElement.h"
+  "dbms/src/Functions/registerFunctionArrayElement.cpp"
+  "dbms/src/Functions/registerFunctionHas.h"
+  "dbms/src/Functions/registerFunctionHas.cpp"
+  "dbms/src/Functions/registerFunctionIndexOf.h"
+  "dbms/src/Functions/registerFunctionIndexOf.cpp"
+  "dbms/src/Functions/registerFunctionCountEqual.h"
+  "dbms/src/Functions/registerFunctionCountEqual.cpp"
+  "dbms/src/Functions/registerFunctionArrayEnumerate.h"
+  "dbms/src/Functions/registerFunctionArrayEnumerate.cpp"
+  "dbms/src/Functions/registerFunctionArrayEnumerateUniq.h"
+  "dbms/src/Functions/registerFunctionArrayEnumerateUniq.cpp"
+  "dbms/src/Functions/registerFunctionArrayUniq.h"
+  "dbms/src/Functions/registerFunctionArrayUniq.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt8.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt8.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt16.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt16.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt32.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt32.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt64.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayUInt64.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt8.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt8.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt16.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt16.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt32.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt32.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt64.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayInt64.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayFloat32.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayFloat32.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayFloat64.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayFloat64.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayDate.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayDate.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayDateTime.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayDateTime.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayString.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayString.cpp"
+  "dbms/src/Functions/registerFunctionEmptyArrayToSingle.h"
+  "dbms/src/Functions/registerFunctionEmptyArrayToSingle.cpp"
+  "dbms/src/Functions/registerFunctionRange.h"
+  "dbms/src/Functions/registerFunctionRange.cpp"
+  "dbms/src/Functions/registerFunctionArrayReduce.h"
+  "dbms/src/Functions/registerFunctionArrayReduce.cpp"
+  "dbms/src/Functions/registerFunctionArrayReverse.h"
+  "dbms/src/Functions/registerFunctionArrayReverse.cpp"
+  "dbms/src/Functions/registerFunctionArrayConcat.h"
+  "dbms/src/Functions/registerFunctionArrayConcat.cpp"
+  "dbms/src/Functions/registerFunctionArraySlice.h"
+  "dbms/src/Functions/registerFunctionArraySlice.cpp"
+  "dbms/src/Functions/registerFunctionArrayPushBack.h"
+  "dbms/src/Functions/registerFunctionArrayPushBack.cpp"
+  "dbms/src/Functions/registerFunctionArrayPushFront.h"
+  "dbms/src/Functions/registerFunctionArrayPushFront.cpp"
+  "dbms/src/Functions/registerFunctionArrayPopBack.h"
+  "dbms/src/Functions/registerFunctionArrayPopBack.cpp"
+  "dbms/src/Functions/registerFunctionArrayPopFront.h"
+  "dbms/src/Functions/registerFunctionArrayPopFront.cpp"
+  "dbms/src/Functions/registerFunctionsArray.cpp"
+  "dbms/src/Functions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Functions/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Interpreters/config_compile.h"
+  "dbms/src/Interpreters/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/AggregateFunctions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Client/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/TableFunctions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Analyzers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/tests/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/tests/external_dictionaries/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dbms/tests/external_dictionaries/dictionary_library/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/DependInfo.cmake"
+  "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/DependInfo.cmake"
+  "contrib/libboost/CMakeFiles/boost_system_internal.dir/DependInfo.cmake"
+  "contrib/libpoco/CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/DependInfo.cmake"
+  "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/DependInfo.cmake"
+  "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/DependInfo.cmake"
+  "contrib/libpoco/Data/CMakeFiles/PocoData.dir/DependInfo.cmake"
+  "contrib/liblz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "contrib/libzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/re2_st.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/transform_filtered_re2.h.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/transform_re2.h.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/transform_set.h.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/transform_stringpiece.h.dir/DependInfo.cmake"
+  "contrib/libre2/CMakeFiles/transform_variadic_function.h.dir/DependInfo.cmake"
+  "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/DependInfo.cmake"
+  "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/DependInfo.cmake"
+  "contrib/libcityhash/CMakeFiles/cityhash.dir/DependInfo.cmake"
+  "contrib/libfarmhash/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "contrib/libmetrohash/CMakeFiles/metrohash.dir/DependInfo.cmake"
+  "contrib/libbtrie/CMakeFiles/btrie.dir/DependInfo.cmake"
+  "contrib/libunwind/CMakeFiles/unwind.dir/DependInfo.cmake"
+  "contrib/libzlib-ng/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  "contrib/libzlib-ng/CMakeFiles/example.dir/DependInfo.cmake"
+  "contrib/libzlib-ng/CMakeFiles/minigzip.dir/DependInfo.cmake"
+  "contrib/libzlib-ng/CMakeFiles/example64.dir/DependInfo.cmake"
+  "contrib/libzlib-ng/CMakeFiles/minigzip64.dir/DependInfo.cmake"
+  "contrib/libcctz/CMakeFiles/cctz.dir/DependInfo.cmake"
+  "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/DependInfo.cmake"
+  "contrib/libcpuid/CMakeFiles/cpuid.dir/DependInfo.cmake"
+  "libs/libcommon/CMakeFiles/common.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/check.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/date_lut_init.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/date_lut2.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/date_lut3.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/date_lut4.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/date_lut_default_timezone.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/multi_version.dir/DependInfo.cmake"
+  "libs/libcommon/src/tests/CMakeFiles/unit_tests_libcommon.dir/DependInfo.cmake"
+  "libs/libpocoext/CMakeFiles/pocoext.dir/DependInfo.cmake"
+  "libs/libdaemon/CMakeFiles/daemon.dir/DependInfo.cmake"
+  "libs/libmemcpy/CMakeFiles/memcpy.dir/DependInfo.cmake"
+  "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/DependInfo.cmake"
+  "libs/libglibc-compatibility/tests/CMakeFiles/longjmp.dir/DependInfo.cmake"
+  "libs/libglibc-compatibility/tests/CMakeFiles/siglongjmp.dir/DependInfo.cmake"
+  "utils/compressor/CMakeFiles/clickhouse-compressor.dir/DependInfo.cmake"
+  "utils/compressor/CMakeFiles/zstd_test.dir/DependInfo.cmake"
+  "utils/iotest/CMakeFiles/iotest.dir/DependInfo.cmake"
+  "utils/iotest/CMakeFiles/iotest_nonblock.dir/DependInfo.cmake"
+  "utils/iotest/CMakeFiles/iotest_aio.dir/DependInfo.cmake"
+  "utils/corrector_utf8/CMakeFiles/corrector_utf8.dir/DependInfo.cmake"
+  "utils/config-processor/CMakeFiles/config-processor.dir/DependInfo.cmake"
+  "utils/zookeeper-cli/CMakeFiles/clickhouse-zookeeper-cli.dir/DependInfo.cmake"
+  "utils/zookeeper-dump-tree/CMakeFiles/zookeeper-dump-tree.dir/DependInfo.cmake"
+  "utils/zookeeper-remove-by-list/CMakeFiles/zookeeper-remove-by-list.dir/DependInfo.cmake"
+  "utils/zookeeper-create-entry-to-download-part/CMakeFiles/zookeeper-create-entry-to-download-part.dir/DependInfo.cmake"
+  "utils/wikistat-loader/CMakeFiles/wikistat-loader.dir/DependInfo.cmake"
+  "utils/fill-factor/CMakeFiles/fill-factor.dir/DependInfo.cmake"
+  "utils/check-marks/CMakeFiles/check-marks.dir/DependInfo.cmake"
+  "utils/test-data-generator/CMakeFiles/test-data-generator.dir/DependInfo.cmake"
+  "utils/test-data-generator/CMakeFiles/markov-model.dir/DependInfo.cmake"
+  "dbms/CMakeFiles/string_utils.dir/DependInfo.cmake"
+  "dbms/CMakeFiles/dbms.dir/DependInfo.cmake"
+  "dbms/CMakeFiles/unit_tests_dbms.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zkutil_test_commands.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zkutil_test_lock.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zkutil_expiration_test.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zkutil_test_async.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zkutil_zookeeper_holder.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zk_many_watches_reconnect.dir/DependInfo.cmake"
+  "dbms/src/Common/ZooKeeper/tests/CMakeFiles/zkutil_test_multi_exception.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/hashes_test.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/sip_hash.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/sip_hash_perf.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/auto_array.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/lru_cache.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/hash_table.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/small_table.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/parallel_aggregation.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/parallel_aggregation2.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/int_hashes_perf.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/simple_cache.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/compact_array.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/radix_sort.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/shell_command_test.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/arena_with_free_lists.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/pod_array.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/thread_creation_latency.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/thread_pool.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/array_cache.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/space_saving.dir/DependInfo.cmake"
+  "dbms/src/Common/tests/CMakeFiles/integer_hash_tables_and_hashes.dir/DependInfo.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/hash_table_emplace.dir/DependInfo.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/columns_filter.dir/DependInfo.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/hashes_throughput.dir/DependInfo.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/number_parsing.dir/DependInfo.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/compressed_read_buffer.dir/DependInfo.cmake"
+  "dbms/src/Common/benchmarks/CMakeFiles/merging_sorted_stream.dir/DependInfo.cmake"
+  "dbms/src/Core/tests/CMakeFiles/exception.dir/DependInfo.cmake"
+  "dbms/src/Core/tests/CMakeFiles/string_pool.dir/DependInfo.cmake"
+  "dbms/src/Core/tests/CMakeFiles/field.dir/DependInfo.cmake"
+  "dbms/src/Core/tests/CMakeFiles/move_field.dir/DependInfo.cmake"
+  "dbms/src/Core/tests/CMakeFiles/rvo_test.dir/DependInfo.cmake"
+  "dbms/src/Core/tests/CMakeFiles/string_ref_hash.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/tab_separated_streams.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/block_row_transforms.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/expression_stream.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/block_tab_separated_streams.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/native_streams.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/filter_stream.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/filter_stream_hitlog.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/sorting_stream.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/aggregating_stream.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/union_stream.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/union_stream2.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/collapsing_sorted_stream.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/fork_streams.dir/DependInfo.cmake"
+  "dbms/src/DataStreams/tests/CMakeFiles/glue_streams.dir/DependInfo.cmake"
+  "dbms/src/DataTypes/tests/CMakeFiles/data_types_number_fixed.dir/DependInfo.cmake"
+  "dbms/src/DataTypes/tests/CMakeFiles/data_type_string.dir/DependInfo.cmake"
+  "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/system_numbers.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/storage_log.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/hit_log.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/seek_speed_test.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/part_checker.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/part_name.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/remove_symlink_directory.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/merge_selector.dir/DependInfo.cmake"
+  "dbms/src/Storages/tests/CMakeFiles/merge_selector2.dir/DependInfo.cmake"
+  "dbms/src/Parsers/tests/CMakeFiles/lexer.dir/DependInfo.cmake"
+  "dbms/src/Parsers/tests/CMakeFiles/select_parser.dir/DependInfo.cmake"
+  "dbms/src/Parsers/tests/CMakeFiles/create_parser.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/read_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/read_buffer_perf.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/read_float_perf.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/write_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/write_buffer_perf.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/valid_utf8_perf.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/valid_utf8.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/compressed_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/var_uint.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/read_escaped_string.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/async_write.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/parse_int_perf.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/parse_int_perf2.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/read_write_int.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/mempbrk.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/cached_compressed_read_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/o_direct_and_dirty_pages.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/hashing_write_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/hashing_read_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/io_operators.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/write_buffer_aio.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/read_buffer_aio.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/zlib_buffers.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/remote_read_write_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/limit_read_buffer.dir/DependInfo.cmake"
+  "dbms/src/IO/tests/CMakeFiles/limit_read_buffer2.dir/DependInfo.cmake"
+  "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/DependInfo.cmake"
+  "dbms/src/Functions/tests/CMakeFiles/number_traits.dir/DependInfo.cmake"
+  "dbms/src/Functions/tests/CMakeFiles/functions_arithmetic.dir/DependInfo.cmake"
+  "dbms/src/Functions/tests/CMakeFiles/logical_functions_performance.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/expression.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/create_query.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/select_query.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/aggregate.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/hash_map.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/hash_map3.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/hash_map_string.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/hash_map_string_2.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/hash_map_string_3.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/hash_map_string_small.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/two_level_hash_map.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/compiler_test.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/logical_expressions_optimizer.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/in_join_subqueries_preprocessor.dir/DependInfo.cmake"
+  "dbms/src/Interpreters/tests/CMakeFiles/users.dir/DependInfo.cmake"
+  "dbms/src/AggregateFunctions/CMakeFiles/clickhouse_aggregate_functions.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-server.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-local.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-extract-from-config.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-client.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-benchmark.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-performance-test.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse-compressor-lib.dir/DependInfo.cmake"
+  "dbms/src/Server/CMakeFiles/clickhouse.dir/DependInfo.cmake"
+  "dbms/src/Client/tests/CMakeFiles/test-connect.dir/DependInfo.cmake"
+  "dbms/src/TableFunctions/CMakeFiles/clickhouse_table_functions.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/collect_aliases.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/collect_tables.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/analyze_columns.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/type_and_constant_inference.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/analyze_result_of_query.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/translate_positional_arguments.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/optimize_group_order_limit_by.dir/DependInfo.cmake"
+  "dbms/src/Analyzers/tests/CMakeFiles/analyze_lambdas.dir/DependInfo.cmake"
+  "dbms/tests/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "dbms/tests/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "dbms/tests/external_dictionaries/dictionary_library/CMakeFiles/dictionary_library.dir/DependInfo.cmake"
+  "dbms/tests/external_dictionaries/dictionary_library/CMakeFiles/dictionary_library_c.dir/DependInfo.cmake"
+  "dbms/tests/external_dictionaries/dictionary_library/CMakeFiles/dictionary_library_empty.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/contrib
+# Build directory: /root/repo/_gate_build/contrib
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("libboost")
+subdirs("libpoco")
+subdirs("liblz4")
+subdirs("libzstd")
+subdirs("libre2")
+subdirs("libdouble-conversion")
+subdirs("libzookeeper")
+subdirs("libcityhash")
+subdirs("libfarmhash")
+subdirs("libmetrohash")
+subdirs("libbtrie")
+subdirs("libunwind")
+subdirs("libzlib-ng")
+subdirs("libcctz")
+subdirs("libtcmalloc")
+subdirs("libcpuid")
@@ -0,0 +1,65 @@
+# Install script for directory: /root/repo/contrib
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_gate_build/contrib/libboost/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libpoco/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/liblz4/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libzstd/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libre2/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libdouble-conversion/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libzookeeper/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libcityhash/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libfarmhash/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libmetrohash/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libbtrie/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libunwind/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libzlib-ng/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libcctz/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libtcmalloc/cmake_install.cmake")
+  include("/root/repo/_gate_build/contrib/libcpuid/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/codecvt_error_category.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/codecvt_error_category.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/codecvt_error_category.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/operations.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/operations.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/operations.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/path.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/path_traits.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path_traits.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path_traits.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/portability.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/portability.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/portability.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/unique_path.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/unique_path.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/unique_path.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/utf8_codecvt_facet.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/utf8_codecvt_facet.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/utf8_codecvt_facet.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/filesystem/src/windows_file_codecvt.cpp" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/windows_file_codecvt.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/windows_file_codecvt.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
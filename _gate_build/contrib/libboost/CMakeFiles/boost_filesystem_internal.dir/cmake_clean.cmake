@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/codecvt_error_category.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/codecvt_error_category.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/operations.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/operations.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path_traits.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/path_traits.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/portability.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/portability.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/unique_path.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/unique_path.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/utf8_codecvt_facet.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/utf8_codecvt_facet.cpp.o.d"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/windows_file_codecvt.cpp.o"
+  "CMakeFiles/boost_filesystem_internal.dir/boost_1_65_0/libs/filesystem/src/windows_file_codecvt.cpp.o.d"
+  "libboost_filesystem_internal.a"
+  "libboost_filesystem_internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boost_filesystem_internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libboost_filesystem_internal.a"
+)
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/cmdline.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/cmdline.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/cmdline.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/config_file.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/config_file.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/config_file.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/convert.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/convert.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/convert.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/options_description.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/options_description.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/options_description.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/parsers.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/parsers.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/parsers.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/positional_options.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/positional_options.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/positional_options.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/split.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/split.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/split.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/utf8_codecvt_facet.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/utf8_codecvt_facet.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/utf8_codecvt_facet.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/value_semantic.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/value_semantic.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/value_semantic.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/variables_map.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/variables_map.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/variables_map.cpp.o.d"
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/program_options/src/winmain.cpp" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/winmain.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/winmain.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/cmdline.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/cmdline.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/config_file.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/config_file.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/convert.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/convert.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/options_description.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/options_description.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/parsers.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/parsers.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/positional_options.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/positional_options.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/split.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/split.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/utf8_codecvt_facet.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/utf8_codecvt_facet.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/value_semantic.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/value_semantic.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/variables_map.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/variables_map.cpp.o.d"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/winmain.cpp.o"
+  "CMakeFiles/boost_program_options_internal.dir/boost_1_65_0/libs/program_options/src/winmain.cpp.o.d"
+  "libboost_program_options_internal.a"
+  "libboost_program_options_internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boost_program_options_internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libboost_program_options_internal.a"
+)
@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libboost/boost_1_65_0/libs/system/src/error_code.cpp" "contrib/libboost/CMakeFiles/boost_system_internal.dir/boost_1_65_0/libs/system/src/error_code.cpp.o" "gcc" "contrib/libboost/CMakeFiles/boost_system_internal.dir/boost_1_65_0/libs/system/src/error_code.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
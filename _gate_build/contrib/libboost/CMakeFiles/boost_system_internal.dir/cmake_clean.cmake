@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/boost_system_internal.dir/boost_1_65_0/libs/system/src/error_code.cpp.o"
+  "CMakeFiles/boost_system_internal.dir/boost_1_65_0/libs/system/src/error_code.cpp.o.d"
+  "libboost_system_internal.a"
+  "libboost_system_internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/boost_system_internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
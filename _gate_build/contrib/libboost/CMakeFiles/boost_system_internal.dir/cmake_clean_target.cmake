@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libboost_system_internal.a"
+)
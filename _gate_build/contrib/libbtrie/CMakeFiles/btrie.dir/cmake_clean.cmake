@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/btrie.dir/src/btrie.c.o"
+  "CMakeFiles/btrie.dir/src/btrie.c.o.d"
+  "libbtrie.a"
+  "libbtrie.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/btrie.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
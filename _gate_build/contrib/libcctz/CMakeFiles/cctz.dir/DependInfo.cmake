@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libcctz/src/time_zone_format.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_format.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_format.cc.o.d"
+  "/root/repo/contrib/libcctz/src/time_zone_if.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_if.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_if.cc.o.d"
+  "/root/repo/contrib/libcctz/src/time_zone_impl.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_impl.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_impl.cc.o.d"
+  "/root/repo/contrib/libcctz/src/time_zone_info.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_info.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_info.cc.o.d"
+  "/root/repo/contrib/libcctz/src/time_zone_libc.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_libc.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_libc.cc.o.d"
+  "/root/repo/contrib/libcctz/src/time_zone_lookup.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_lookup.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_lookup.cc.o.d"
+  "/root/repo/contrib/libcctz/src/time_zone_posix.cc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_posix.cc.o" "gcc" "contrib/libcctz/CMakeFiles/cctz.dir/src/time_zone_posix.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cctz.dir/src/time_zone_format.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_format.cc.o.d"
+  "CMakeFiles/cctz.dir/src/time_zone_if.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_if.cc.o.d"
+  "CMakeFiles/cctz.dir/src/time_zone_impl.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_impl.cc.o.d"
+  "CMakeFiles/cctz.dir/src/time_zone_info.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_info.cc.o.d"
+  "CMakeFiles/cctz.dir/src/time_zone_libc.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_libc.cc.o.d"
+  "CMakeFiles/cctz.dir/src/time_zone_lookup.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_lookup.cc.o.d"
+  "CMakeFiles/cctz.dir/src/time_zone_posix.cc.o"
+  "CMakeFiles/cctz.dir/src/time_zone_posix.cc.o.d"
+  "libcctz.a"
+  "libcctz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cctz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cityhash.dir/src/city.cc.o"
+  "CMakeFiles/cityhash.dir/src/city.cc.o.d"
+  "libcityhash.a"
+  "libcityhash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cityhash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
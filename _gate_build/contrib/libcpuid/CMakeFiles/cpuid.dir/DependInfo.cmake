@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libcpuid/include/cpuid/asm-bits.c" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/asm-bits.c.o" "gcc" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/asm-bits.c.o.d"
+  "/root/repo/contrib/libcpuid/include/cpuid/cpuid_main.c" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/cpuid_main.c.o" "gcc" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/cpuid_main.c.o.d"
+  "/root/repo/contrib/libcpuid/include/cpuid/libcpuid_util.c" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/libcpuid_util.c.o" "gcc" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/libcpuid_util.c.o.d"
+  "/root/repo/contrib/libcpuid/include/cpuid/rdtsc.c" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/rdtsc.c.o" "gcc" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/rdtsc.c.o.d"
+  "/root/repo/contrib/libcpuid/include/cpuid/recog_amd.c" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/recog_amd.c.o" "gcc" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/recog_amd.c.o.d"
+  "/root/repo/contrib/libcpuid/include/cpuid/recog_intel.c" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/recog_intel.c.o" "gcc" "contrib/libcpuid/CMakeFiles/cpuid.dir/include/cpuid/recog_intel.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpuid.dir/include/cpuid/asm-bits.c.o"
+  "CMakeFiles/cpuid.dir/include/cpuid/asm-bits.c.o.d"
+  "CMakeFiles/cpuid.dir/include/cpuid/cpuid_main.c.o"
+  "CMakeFiles/cpuid.dir/include/cpuid/cpuid_main.c.o.d"
+  "CMakeFiles/cpuid.dir/include/cpuid/libcpuid_util.c.o"
+  "CMakeFiles/cpuid.dir/include/cpuid/libcpuid_util.c.o.d"
+  "CMakeFiles/cpuid.dir/include/cpuid/rdtsc.c.o"
+  "CMakeFiles/cpuid.dir/include/cpuid/rdtsc.c.o.d"
+  "CMakeFiles/cpuid.dir/include/cpuid/recog_amd.c.o"
+  "CMakeFiles/cpuid.dir/include/cpuid/recog_amd.c.o.d"
+  "CMakeFiles/cpuid.dir/include/cpuid/recog_intel.c.o"
+  "CMakeFiles/cpuid.dir/include/cpuid/recog_intel.c.o.d"
+  "libcpuid.a"
+  "libcpuid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpuid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libdouble-conversion/double-conversion/bignum-dtoa.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/bignum-dtoa.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/bignum-dtoa.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/bignum.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/bignum.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/bignum.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/cached-powers.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/cached-powers.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/cached-powers.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/diy-fp.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/diy-fp.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/diy-fp.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/double-conversion.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/double-conversion.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/double-conversion.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/fast-dtoa.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/fast-dtoa.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/fast-dtoa.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/fixed-dtoa.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/fixed-dtoa.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/fixed-dtoa.cc.o.d"
+  "/root/repo/contrib/libdouble-conversion/double-conversion/strtod.cc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/strtod.cc.o" "gcc" "contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/double-conversion/strtod.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
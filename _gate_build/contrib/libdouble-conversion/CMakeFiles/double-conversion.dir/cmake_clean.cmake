@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/double-conversion.dir/double-conversion/bignum-dtoa.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/bignum-dtoa.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/bignum.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/bignum.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/cached-powers.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/cached-powers.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/diy-fp.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/diy-fp.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/double-conversion.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/double-conversion.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/fast-dtoa.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/fast-dtoa.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/fixed-dtoa.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/fixed-dtoa.cc.o.d"
+  "CMakeFiles/double-conversion.dir/double-conversion/strtod.cc.o"
+  "CMakeFiles/double-conversion.dir/double-conversion/strtod.cc.o.d"
+  "libdouble-conversion.a"
+  "libdouble-conversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/double-conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
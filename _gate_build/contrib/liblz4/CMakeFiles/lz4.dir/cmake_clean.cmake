@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lz4.dir/src/lz4.c.o"
+  "CMakeFiles/lz4.dir/src/lz4.c.o.d"
+  "CMakeFiles/lz4.dir/src/lz4hc.c.o"
+  "CMakeFiles/lz4.dir/src/lz4hc.c.o.d"
+  "liblz4.a"
+  "liblz4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lz4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libmetrohash/src/metrohash128.cpp" "contrib/libmetrohash/CMakeFiles/metrohash.dir/src/metrohash128.cpp.o" "gcc" "contrib/libmetrohash/CMakeFiles/metrohash.dir/src/metrohash128.cpp.o.d"
+  "/root/repo/contrib/libmetrohash/src/metrohash128crc.cpp" "contrib/libmetrohash/CMakeFiles/metrohash.dir/src/metrohash128crc.cpp.o" "gcc" "contrib/libmetrohash/CMakeFiles/metrohash.dir/src/metrohash128crc.cpp.o.d"
+  "/root/repo/contrib/libmetrohash/src/metrohash64.cpp" "contrib/libmetrohash/CMakeFiles/metrohash.dir/src/metrohash64.cpp.o" "gcc" "contrib/libmetrohash/CMakeFiles/metrohash.dir/src/metrohash64.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/metrohash.dir/src/metrohash128.cpp.o"
+  "CMakeFiles/metrohash.dir/src/metrohash128.cpp.o.d"
+  "CMakeFiles/metrohash.dir/src/metrohash128crc.cpp.o"
+  "CMakeFiles/metrohash.dir/src/metrohash128crc.cpp.o.d"
+  "CMakeFiles/metrohash.dir/src/metrohash64.cpp.o"
+  "CMakeFiles/metrohash.dir/src/metrohash64.cpp.o.d"
+  "libmetrohash.a"
+  "libmetrohash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metrohash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
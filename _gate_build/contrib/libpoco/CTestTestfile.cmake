@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/contrib/libpoco
+# Build directory: /root/repo/_gate_build/contrib/libpoco
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("Foundation")
+subdirs("XML")
+subdirs("MongoDB")
+subdirs("Util")
+subdirs("Net")
+subdirs("NetSSL_OpenSSL")
+subdirs("Crypto")
+subdirs("Data")
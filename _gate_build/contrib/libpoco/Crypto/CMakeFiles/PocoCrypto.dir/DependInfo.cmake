@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/Crypto/src/Cipher.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/Cipher.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/Cipher.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/CipherFactory.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherFactory.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/CipherImpl.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherImpl.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/CipherKey.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherKey.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherKey.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/CipherKeyImpl.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherKeyImpl.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CipherKeyImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/CryptoStream.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CryptoStream.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CryptoStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/CryptoTransform.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CryptoTransform.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/CryptoTransform.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/DigestEngine.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/DigestEngine.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/DigestEngine.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/OpenSSLInitializer.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/OpenSSLInitializer.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/OpenSSLInitializer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/RSACipherImpl.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSACipherImpl.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSACipherImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/RSADigestEngine.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSADigestEngine.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSADigestEngine.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/RSAKey.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSAKey.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSAKey.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/RSAKeyImpl.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSAKeyImpl.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/RSAKeyImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Crypto/src/X509Certificate.cpp" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/X509Certificate.cpp.o" "gcc" "contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/src/X509Certificate.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
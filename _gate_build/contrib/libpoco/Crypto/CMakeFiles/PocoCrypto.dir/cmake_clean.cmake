@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoCrypto.a"
+  "../lib/libPocoCrypto.pdb"
+  "CMakeFiles/PocoCrypto.dir/src/Cipher.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/Cipher.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/CipherFactory.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/CipherFactory.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/CipherImpl.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/CipherImpl.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/CipherKey.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/CipherKey.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/CipherKeyImpl.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/CipherKeyImpl.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/CryptoStream.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/CryptoStream.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/CryptoTransform.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/CryptoTransform.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/DigestEngine.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/DigestEngine.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/OpenSSLInitializer.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/OpenSSLInitializer.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/RSACipherImpl.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/RSACipherImpl.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/RSADigestEngine.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/RSADigestEngine.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/RSAKey.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/RSAKey.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/RSAKeyImpl.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/RSAKeyImpl.cpp.o.d"
+  "CMakeFiles/PocoCrypto.dir/src/X509Certificate.cpp.o"
+  "CMakeFiles/PocoCrypto.dir/src/X509Certificate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PocoCrypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/Data/src/AbstractBinder.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractBinder.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractBinder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/AbstractBinding.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractBinding.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractBinding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/AbstractExtraction.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractExtraction.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractExtraction.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/AbstractExtractor.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractExtractor.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractExtractor.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/AbstractPreparation.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractPreparation.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractPreparation.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/AbstractPreparator.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractPreparator.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/AbstractPreparator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/ArchiveStrategy.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/ArchiveStrategy.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/ArchiveStrategy.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Bulk.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Bulk.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Bulk.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Connector.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Connector.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Connector.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/DataException.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/DataException.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/DataException.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Date.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Date.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Date.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/DynamicLOB.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/DynamicLOB.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/DynamicLOB.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Limit.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Limit.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Limit.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/MetaColumn.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/MetaColumn.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/MetaColumn.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/PooledSessionHolder.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/PooledSessionHolder.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/PooledSessionHolder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/PooledSessionImpl.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/PooledSessionImpl.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/PooledSessionImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Position.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Position.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Position.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Range.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Range.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Range.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/RecordSet.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RecordSet.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RecordSet.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Row.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Row.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Row.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/RowFilter.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RowFilter.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RowFilter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/RowFormatter.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RowFormatter.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RowFormatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/RowIterator.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RowIterator.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/RowIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/SQLChannel.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SQLChannel.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SQLChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Session.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Session.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Session.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/SessionFactory.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionFactory.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/SessionImpl.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionImpl.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/SessionPool.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionPool.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionPool.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/SessionPoolContainer.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionPoolContainer.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SessionPoolContainer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/SimpleRowFormatter.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SimpleRowFormatter.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/SimpleRowFormatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Statement.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Statement.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Statement.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/StatementCreator.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/StatementCreator.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/StatementCreator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/StatementImpl.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/StatementImpl.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/StatementImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Time.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Time.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Time.cpp.o.d"
+  "/root/repo/contrib/libpoco/Data/src/Transaction.cpp" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Transaction.cpp.o" "gcc" "contrib/libpoco/Data/CMakeFiles/PocoData.dir/src/Transaction.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,79 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoData.a"
+  "../lib/libPocoData.pdb"
+  "CMakeFiles/PocoData.dir/src/AbstractBinder.cpp.o"
+  "CMakeFiles/PocoData.dir/src/AbstractBinder.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/AbstractBinding.cpp.o"
+  "CMakeFiles/PocoData.dir/src/AbstractBinding.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/AbstractExtraction.cpp.o"
+  "CMakeFiles/PocoData.dir/src/AbstractExtraction.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/AbstractExtractor.cpp.o"
+  "CMakeFiles/PocoData.dir/src/AbstractExtractor.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/AbstractPreparation.cpp.o"
+  "CMakeFiles/PocoData.dir/src/AbstractPreparation.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/AbstractPreparator.cpp.o"
+  "CMakeFiles/PocoData.dir/src/AbstractPreparator.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/ArchiveStrategy.cpp.o"
+  "CMakeFiles/PocoData.dir/src/ArchiveStrategy.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Bulk.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Bulk.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Connector.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Connector.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/DataException.cpp.o"
+  "CMakeFiles/PocoData.dir/src/DataException.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Date.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Date.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/DynamicLOB.cpp.o"
+  "CMakeFiles/PocoData.dir/src/DynamicLOB.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Limit.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Limit.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/MetaColumn.cpp.o"
+  "CMakeFiles/PocoData.dir/src/MetaColumn.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/PooledSessionHolder.cpp.o"
+  "CMakeFiles/PocoData.dir/src/PooledSessionHolder.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/PooledSessionImpl.cpp.o"
+  "CMakeFiles/PocoData.dir/src/PooledSessionImpl.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Position.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Position.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Range.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Range.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/RecordSet.cpp.o"
+  "CMakeFiles/PocoData.dir/src/RecordSet.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Row.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Row.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/RowFilter.cpp.o"
+  "CMakeFiles/PocoData.dir/src/RowFilter.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/RowFormatter.cpp.o"
+  "CMakeFiles/PocoData.dir/src/RowFormatter.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/RowIterator.cpp.o"
+  "CMakeFiles/PocoData.dir/src/RowIterator.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/SQLChannel.cpp.o"
+  "CMakeFiles/PocoData.dir/src/SQLChannel.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Session.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Session.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/SessionFactory.cpp.o"
+  "CMakeFiles/PocoData.dir/src/SessionFactory.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/SessionImpl.cpp.o"
+  "CMakeFiles/PocoData.dir/src/SessionImpl.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/SessionPool.cpp.o"
+  "CMakeFiles/PocoData.dir/src/SessionPool.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/SessionPoolContainer.cpp.o"
+  "CMakeFiles/PocoData.dir/src/SessionPoolContainer.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/SimpleRowFormatter.cpp.o"
+  "CMakeFiles/PocoData.dir/src/SimpleRowFormatter.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Statement.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Statement.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/StatementCreator.cpp.o"
+  "CMakeFiles/PocoData.dir/src/StatementCreator.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/StatementImpl.cpp.o"
+  "CMakeFiles/PocoData.dir/src/StatementImpl.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Time.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Time.cpp.o.d"
+  "CMakeFiles/PocoData.dir/src/Transaction.cpp.o"
+  "CMakeFiles/PocoData.dir/src/Transaction.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PocoData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,191 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_byte_order.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_byte_order.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_byte_order.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_chartables.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_chartables.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_chartables.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_compile.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_compile.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_compile.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_config.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_config.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_config.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_dfa_exec.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_dfa_exec.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_dfa_exec.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_exec.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_exec.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_exec.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_fullinfo.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_fullinfo.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_fullinfo.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_get.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_get.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_get.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_globals.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_globals.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_globals.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_jit_compile.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_jit_compile.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_jit_compile.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_maketables.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_maketables.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_maketables.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_newline.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_newline.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_newline.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_ord2utf8.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_ord2utf8.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_ord2utf8.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_refcount.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_refcount.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_refcount.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_string_utils.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_string_utils.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_string_utils.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_study.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_study.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_study.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_tables.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_tables.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_tables.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_ucd.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_ucd.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_ucd.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_valid_utf8.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_valid_utf8.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_valid_utf8.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_version.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_version.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_version.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/pcre_xclass.c" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_xclass.c.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/pcre_xclass.c.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ASCIIEncoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ASCIIEncoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ASCIIEncoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/AbstractObserver.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/AbstractObserver.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/AbstractObserver.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ActiveDispatcher.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ActiveDispatcher.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ActiveDispatcher.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ArchiveStrategy.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ArchiveStrategy.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ArchiveStrategy.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Ascii.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Ascii.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Ascii.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/AsyncChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/AsyncChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/AsyncChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/AtomicCounter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/AtomicCounter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/AtomicCounter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Base32Decoder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base32Decoder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base32Decoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Base32Encoder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base32Encoder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base32Encoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Base64Decoder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base64Decoder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base64Decoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Base64Encoder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base64Encoder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Base64Encoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/BinaryReader.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/BinaryReader.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/BinaryReader.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/BinaryWriter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/BinaryWriter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/BinaryWriter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Bugcheck.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Bugcheck.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Bugcheck.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ByteOrder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ByteOrder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ByteOrder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Channel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Channel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Channel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Checksum.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Checksum.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Checksum.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Clock.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Clock.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Clock.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Condition.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Condition.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Condition.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Configurable.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Configurable.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Configurable.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ConsoleChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ConsoleChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ConsoleChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/CountingStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/CountingStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/CountingStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DateTime.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTime.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTime.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DateTimeFormat.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTimeFormat.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTimeFormat.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DateTimeFormatter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTimeFormatter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTimeFormatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DateTimeParser.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTimeParser.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DateTimeParser.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Debugger.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Debugger.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Debugger.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DeflatingStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DeflatingStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DeflatingStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DigestEngine.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DigestEngine.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DigestEngine.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DigestStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DigestStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DigestStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DirectoryIterator.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DirectoryIterator.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DirectoryIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DirectoryIteratorStrategy.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DirectoryIteratorStrategy.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DirectoryIteratorStrategy.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/DirectoryWatcher.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DirectoryWatcher.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/DirectoryWatcher.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Environment.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Environment.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Environment.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Error.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Error.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Error.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ErrorHandler.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ErrorHandler.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ErrorHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Event.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Event.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Event.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/EventArgs.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/EventArgs.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/EventArgs.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Exception.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Exception.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Exception.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/FIFOBufferStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FIFOBufferStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FIFOBufferStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/FPEnvironment.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FPEnvironment.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FPEnvironment.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/File.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/File.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/File.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/FileChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FileChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FileChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/FileStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FileStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FileStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/FileStreamFactory.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FileStreamFactory.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FileStreamFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Format.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Format.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Format.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Formatter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Formatter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Formatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/FormattingChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FormattingChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/FormattingChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Glob.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Glob.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Glob.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Hash.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Hash.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Hash.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/HashStatistic.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/HashStatistic.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/HashStatistic.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/HexBinaryDecoder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/HexBinaryDecoder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/HexBinaryDecoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/HexBinaryEncoder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/HexBinaryEncoder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/HexBinaryEncoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/InflatingStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/InflatingStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/InflatingStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Latin1Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Latin1Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Latin1Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Latin2Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Latin2Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Latin2Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Latin9Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Latin9Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Latin9Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/LineEndingConverter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LineEndingConverter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LineEndingConverter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/LocalDateTime.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LocalDateTime.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LocalDateTime.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/LogFile.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LogFile.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LogFile.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/LogStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LogStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LogStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Logger.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Logger.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Logger.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/LoggingFactory.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LoggingFactory.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LoggingFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/LoggingRegistry.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LoggingRegistry.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/LoggingRegistry.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/MD4Engine.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MD4Engine.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MD4Engine.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/MD5Engine.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MD5Engine.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MD5Engine.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Manifest.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Manifest.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Manifest.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/MemoryPool.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MemoryPool.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MemoryPool.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/MemoryStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MemoryStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/MemoryStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Message.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Message.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Message.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Mutex.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Mutex.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Mutex.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NamedEvent.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NamedEvent.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NamedEvent.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NamedMutex.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NamedMutex.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NamedMutex.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NestedDiagnosticContext.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NestedDiagnosticContext.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NestedDiagnosticContext.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Notification.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Notification.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Notification.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NotificationCenter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NotificationCenter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NotificationCenter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NotificationQueue.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NotificationQueue.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NotificationQueue.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NullChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NullChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NullChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NullStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NullStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NullStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NumberFormatter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NumberFormatter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NumberFormatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NumberParser.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NumberParser.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NumberParser.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/NumericString.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NumericString.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/NumericString.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Path.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Path.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Path.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/PatternFormatter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PatternFormatter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PatternFormatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Pipe.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Pipe.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Pipe.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/PipeImpl.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PipeImpl.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PipeImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/PipeStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PipeStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PipeStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/PriorityNotificationQueue.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PriorityNotificationQueue.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PriorityNotificationQueue.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Process.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Process.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Process.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/PurgeStrategy.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PurgeStrategy.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/PurgeStrategy.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/RWLock.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RWLock.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RWLock.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Random.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Random.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Random.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/RandomStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RandomStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RandomStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/RefCountedObject.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RefCountedObject.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RefCountedObject.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/RegularExpression.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RegularExpression.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RegularExpression.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/RotateStrategy.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RotateStrategy.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/RotateStrategy.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Runnable.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Runnable.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Runnable.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SHA1Engine.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SHA1Engine.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SHA1Engine.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Semaphore.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Semaphore.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Semaphore.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SharedLibrary.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SharedLibrary.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SharedLibrary.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SharedMemory.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SharedMemory.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SharedMemory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SignalHandler.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SignalHandler.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SignalHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SimpleFileChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SimpleFileChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SimpleFileChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SortedDirectoryIterator.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SortedDirectoryIterator.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SortedDirectoryIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SplitterChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SplitterChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SplitterChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Stopwatch.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Stopwatch.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Stopwatch.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/StreamChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/StreamConverter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamConverter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamConverter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/StreamCopier.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamCopier.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamCopier.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/StreamTokenizer.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamTokenizer.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StreamTokenizer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/String.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/String.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/String.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/StringTokenizer.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StringTokenizer.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/StringTokenizer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SynchronizedObject.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SynchronizedObject.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SynchronizedObject.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/SyslogChannel.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SyslogChannel.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/SyslogChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Task.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Task.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Task.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TaskManager.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TaskManager.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TaskManager.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TaskNotification.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TaskNotification.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TaskNotification.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TeeStream.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TeeStream.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TeeStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TemporaryFile.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TemporaryFile.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TemporaryFile.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TextBufferIterator.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextBufferIterator.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextBufferIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TextConverter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextConverter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextConverter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TextEncoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextEncoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextEncoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TextIterator.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextIterator.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TextIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Thread.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Thread.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Thread.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ThreadLocal.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ThreadLocal.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ThreadLocal.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ThreadPool.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ThreadPool.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/ThreadTarget.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ThreadTarget.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/ThreadTarget.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/TimedNotificationQueue.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TimedNotificationQueue.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/TimedNotificationQueue.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Timer.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timer.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Timespan.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timespan.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timespan.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Timestamp.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timestamp.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timestamp.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Timezone.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timezone.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Timezone.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Token.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Token.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Token.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/URI.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/URI.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/URI.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/URIStreamFactory.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/URIStreamFactory.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/URIStreamFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/URIStreamOpener.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/URIStreamOpener.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/URIStreamOpener.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UTF16Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF16Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF16Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UTF32Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF32Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF32Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UTF8Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF8Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF8Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UTF8String.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF8String.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UTF8String.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UUID.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UUID.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UUID.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UUIDGenerator.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UUIDGenerator.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UUIDGenerator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Unicode.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Unicode.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Unicode.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/UnicodeConverter.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UnicodeConverter.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/UnicodeConverter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Var.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Var.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Var.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/VarHolder.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/VarHolder.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/VarHolder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/VarIterator.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/VarIterator.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/VarIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Void.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Void.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Void.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Windows1250Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Windows1250Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Windows1250Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Windows1251Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Windows1251Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Windows1251Encoding.cpp.o.d"
+  "/root/repo/contrib/libpoco/Foundation/src/Windows1252Encoding.cpp" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Windows1252Encoding.cpp.o" "gcc" "contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/src/Windows1252Encoding.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
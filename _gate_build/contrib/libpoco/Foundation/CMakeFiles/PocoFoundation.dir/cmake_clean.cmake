@@ -0,0 +1,353 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoFoundation.a"
+  "../lib/libPocoFoundation.pdb"
+  "CMakeFiles/PocoFoundation.dir/src/ASCIIEncoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ASCIIEncoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/AbstractObserver.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/AbstractObserver.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ActiveDispatcher.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ActiveDispatcher.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ArchiveStrategy.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ArchiveStrategy.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Ascii.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Ascii.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/AsyncChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/AsyncChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/AtomicCounter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/AtomicCounter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Base32Decoder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Base32Decoder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Base32Encoder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Base32Encoder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Base64Decoder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Base64Decoder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Base64Encoder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Base64Encoder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/BinaryReader.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/BinaryReader.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/BinaryWriter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/BinaryWriter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Bugcheck.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Bugcheck.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ByteOrder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ByteOrder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Channel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Channel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Checksum.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Checksum.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Clock.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Clock.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Condition.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Condition.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Configurable.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Configurable.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ConsoleChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ConsoleChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/CountingStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/CountingStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DateTime.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DateTime.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DateTimeFormat.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DateTimeFormat.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DateTimeFormatter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DateTimeFormatter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DateTimeParser.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DateTimeParser.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Debugger.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Debugger.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DeflatingStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DeflatingStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DigestEngine.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DigestEngine.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DigestStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DigestStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DirectoryIterator.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DirectoryIterator.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DirectoryIteratorStrategy.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DirectoryIteratorStrategy.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/DirectoryWatcher.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/DirectoryWatcher.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Environment.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Environment.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Error.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Error.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ErrorHandler.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ErrorHandler.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Event.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Event.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/EventArgs.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/EventArgs.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Exception.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Exception.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/FIFOBufferStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/FIFOBufferStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/FPEnvironment.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/FPEnvironment.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/File.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/File.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/FileChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/FileChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/FileStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/FileStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/FileStreamFactory.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/FileStreamFactory.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Format.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Format.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Formatter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Formatter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/FormattingChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/FormattingChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Glob.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Glob.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Hash.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Hash.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/HashStatistic.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/HashStatistic.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/HexBinaryDecoder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/HexBinaryDecoder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/HexBinaryEncoder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/HexBinaryEncoder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/InflatingStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/InflatingStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Latin1Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Latin1Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Latin2Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Latin2Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Latin9Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Latin9Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/LineEndingConverter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/LineEndingConverter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/LocalDateTime.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/LocalDateTime.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/LogFile.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/LogFile.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/LogStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/LogStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Logger.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Logger.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/LoggingFactory.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/LoggingFactory.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/LoggingRegistry.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/LoggingRegistry.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/MD4Engine.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/MD4Engine.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/MD5Engine.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/MD5Engine.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Manifest.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Manifest.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/MemoryPool.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/MemoryPool.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/MemoryStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/MemoryStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Message.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Message.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Mutex.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Mutex.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NamedEvent.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NamedEvent.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NamedMutex.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NamedMutex.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NestedDiagnosticContext.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NestedDiagnosticContext.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Notification.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Notification.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NotificationCenter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NotificationCenter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NotificationQueue.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NotificationQueue.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NullChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NullChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NullStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NullStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NumberFormatter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NumberFormatter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NumberParser.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NumberParser.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/NumericString.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/NumericString.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Path.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Path.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/PatternFormatter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/PatternFormatter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Pipe.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Pipe.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/PipeImpl.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/PipeImpl.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/PipeStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/PipeStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/PriorityNotificationQueue.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/PriorityNotificationQueue.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Process.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Process.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/PurgeStrategy.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/PurgeStrategy.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/RWLock.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/RWLock.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Random.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Random.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/RandomStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/RandomStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/RefCountedObject.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/RefCountedObject.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/RegularExpression.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/RegularExpression.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/RotateStrategy.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/RotateStrategy.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Runnable.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Runnable.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SHA1Engine.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SHA1Engine.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Semaphore.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Semaphore.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SharedLibrary.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SharedLibrary.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SharedMemory.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SharedMemory.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SignalHandler.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SignalHandler.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SimpleFileChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SimpleFileChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SortedDirectoryIterator.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SortedDirectoryIterator.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SplitterChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SplitterChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Stopwatch.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Stopwatch.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/StreamChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/StreamChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/StreamConverter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/StreamConverter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/StreamCopier.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/StreamCopier.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/StreamTokenizer.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/StreamTokenizer.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/String.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/String.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/StringTokenizer.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/StringTokenizer.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SynchronizedObject.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SynchronizedObject.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/SyslogChannel.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/SyslogChannel.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Task.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Task.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TaskManager.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TaskManager.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TaskNotification.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TaskNotification.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TeeStream.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TeeStream.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TemporaryFile.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TemporaryFile.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TextBufferIterator.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TextBufferIterator.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TextConverter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TextConverter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TextEncoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TextEncoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TextIterator.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TextIterator.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Thread.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Thread.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ThreadLocal.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ThreadLocal.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ThreadPool.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ThreadPool.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/ThreadTarget.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/ThreadTarget.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/TimedNotificationQueue.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/TimedNotificationQueue.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Timer.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Timespan.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Timespan.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Timestamp.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Timestamp.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Timezone.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Timezone.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Token.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Token.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/URI.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/URI.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/URIStreamFactory.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/URIStreamFactory.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/URIStreamOpener.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/URIStreamOpener.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UTF16Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UTF16Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UTF32Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UTF32Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UTF8Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UTF8Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UTF8String.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UTF8String.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UUID.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UUID.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UUIDGenerator.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UUIDGenerator.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Unicode.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Unicode.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/UnicodeConverter.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/UnicodeConverter.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Var.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Var.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/VarHolder.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/VarHolder.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/VarIterator.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/VarIterator.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Void.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Void.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Windows1250Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Windows1250Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Windows1251Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Windows1251Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/Windows1252Encoding.cpp.o"
+  "CMakeFiles/PocoFoundation.dir/src/Windows1252Encoding.cpp.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_byte_order.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_byte_order.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_chartables.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_chartables.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_compile.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_compile.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_config.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_config.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_dfa_exec.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_dfa_exec.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_exec.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_exec.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_fullinfo.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_fullinfo.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_get.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_get.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_globals.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_globals.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_jit_compile.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_jit_compile.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_maketables.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_maketables.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_newline.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_newline.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_ord2utf8.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_ord2utf8.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_refcount.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_refcount.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_string_utils.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_string_utils.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_study.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_study.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_tables.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_tables.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_ucd.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_ucd.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_valid_utf8.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_valid_utf8.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_version.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_version.c.o.d"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_xclass.c.o"
+  "CMakeFiles/PocoFoundation.dir/src/pcre_xclass.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/PocoFoundation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/MongoDB/src/Array.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Array.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Array.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Binary.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Binary.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Binary.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Connection.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Connection.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Connection.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Cursor.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Cursor.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Cursor.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Database.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Database.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Database.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/DeleteRequest.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/DeleteRequest.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/DeleteRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Document.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Document.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Document.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Element.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Element.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Element.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/GetMoreRequest.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/GetMoreRequest.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/GetMoreRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/InsertRequest.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/InsertRequest.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/InsertRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/JavaScriptCode.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/JavaScriptCode.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/JavaScriptCode.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/KillCursorsRequest.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/KillCursorsRequest.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/KillCursorsRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/Message.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Message.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/Message.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/MessageHeader.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/MessageHeader.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/MessageHeader.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/ObjectId.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/ObjectId.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/ObjectId.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/QueryRequest.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/QueryRequest.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/QueryRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/RegularExpression.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/RegularExpression.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/RegularExpression.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/ReplicaSet.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/ReplicaSet.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/ReplicaSet.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/RequestMessage.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/RequestMessage.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/RequestMessage.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/ResponseMessage.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/ResponseMessage.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/ResponseMessage.cpp.o.d"
+  "/root/repo/contrib/libpoco/MongoDB/src/UpdateRequest.cpp" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/UpdateRequest.cpp.o" "gcc" "contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/src/UpdateRequest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
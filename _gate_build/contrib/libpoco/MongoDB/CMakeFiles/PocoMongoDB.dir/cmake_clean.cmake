@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoMongoDB.a"
+  "../lib/libPocoMongoDB.pdb"
+  "CMakeFiles/PocoMongoDB.dir/src/Array.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Array.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Binary.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Binary.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Connection.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Connection.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Cursor.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Cursor.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Database.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Database.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/DeleteRequest.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/DeleteRequest.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Document.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Document.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Element.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Element.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/GetMoreRequest.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/GetMoreRequest.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/InsertRequest.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/InsertRequest.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/JavaScriptCode.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/JavaScriptCode.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/KillCursorsRequest.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/KillCursorsRequest.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/Message.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/Message.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/MessageHeader.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/MessageHeader.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/ObjectId.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/ObjectId.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/QueryRequest.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/QueryRequest.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/RegularExpression.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/RegularExpression.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/ReplicaSet.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/ReplicaSet.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/RequestMessage.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/RequestMessage.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/ResponseMessage.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/ResponseMessage.cpp.o.d"
+  "CMakeFiles/PocoMongoDB.dir/src/UpdateRequest.cpp.o"
+  "CMakeFiles/PocoMongoDB.dir/src/UpdateRequest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PocoMongoDB.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,119 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/Net/src/AbstractHTTPRequestHandler.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/AbstractHTTPRequestHandler.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/AbstractHTTPRequestHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/DNS.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DNS.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DNS.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/DatagramSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DatagramSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DatagramSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/DatagramSocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DatagramSocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DatagramSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/DialogSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DialogSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/DialogSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/FTPClientSession.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/FTPClientSession.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/FTPClientSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/FTPStreamFactory.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/FTPStreamFactory.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/FTPStreamFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/FilePartSource.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/FilePartSource.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/FilePartSource.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTMLForm.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTMLForm.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTMLForm.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPAuthenticationParams.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPAuthenticationParams.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPAuthenticationParams.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPBasicCredentials.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPBasicCredentials.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPBasicCredentials.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPBufferAllocator.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPBufferAllocator.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPBufferAllocator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPChunkedStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPChunkedStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPChunkedStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPClientSession.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPClientSession.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPClientSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPCookie.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPCookie.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPCookie.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPCredentials.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPCredentials.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPCredentials.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPDigestCredentials.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPDigestCredentials.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPDigestCredentials.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPFixedLengthStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPFixedLengthStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPFixedLengthStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPHeaderStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPHeaderStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPHeaderStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPIOStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPIOStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPIOStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPMessage.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPMessage.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPMessage.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPRequest.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPRequest.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPRequestHandler.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPRequestHandler.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPRequestHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPRequestHandlerFactory.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPRequestHandlerFactory.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPRequestHandlerFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPResponse.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPResponse.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPResponse.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServer.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServer.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerConnection.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerConnection.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerConnection.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerConnectionFactory.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerConnectionFactory.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerConnectionFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerParams.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerParams.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerParams.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerRequest.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerRequest.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerRequest.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerRequestImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerRequestImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerRequestImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerResponse.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerResponse.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerResponse.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerResponseImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerResponseImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerResponseImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPServerSession.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerSession.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPServerSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPSession.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPSession.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPSessionFactory.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPSessionFactory.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPSessionFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPSessionInstantiator.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPSessionInstantiator.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPSessionInstantiator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HTTPStreamFactory.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPStreamFactory.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HTTPStreamFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/HostEntry.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HostEntry.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/HostEntry.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPClient.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPClient.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPClient.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPEventArgs.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPEventArgs.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPEventArgs.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPPacket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPPacket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPPacket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPPacketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPPacketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPPacketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPSocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPSocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ICMPv4PacketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPv4PacketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ICMPv4PacketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/IPAddress.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/IPAddress.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/IPAddress.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/IPAddressImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/IPAddressImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/IPAddressImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MailMessage.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MailMessage.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MailMessage.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MailRecipient.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MailRecipient.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MailRecipient.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MailStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MailStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MailStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MediaType.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MediaType.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MediaType.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MessageHeader.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MessageHeader.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MessageHeader.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MulticastSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MulticastSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MulticastSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MultipartReader.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MultipartReader.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MultipartReader.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/MultipartWriter.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MultipartWriter.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/MultipartWriter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NTPClient.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NTPClient.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NTPClient.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NTPEventArgs.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NTPEventArgs.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NTPEventArgs.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NTPPacket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NTPPacket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NTPPacket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NameValueCollection.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NameValueCollection.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NameValueCollection.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/Net.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/Net.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/Net.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NetException.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NetException.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NetException.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NetworkInterface.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NetworkInterface.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NetworkInterface.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/NullPartHandler.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NullPartHandler.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/NullPartHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/OAuth10Credentials.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/OAuth10Credentials.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/OAuth10Credentials.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/OAuth20Credentials.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/OAuth20Credentials.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/OAuth20Credentials.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/POP3ClientSession.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/POP3ClientSession.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/POP3ClientSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/PartHandler.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/PartHandler.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/PartHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/PartSource.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/PartSource.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/PartSource.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/PartStore.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/PartStore.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/PartStore.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/QuotedPrintableDecoder.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/QuotedPrintableDecoder.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/QuotedPrintableDecoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/QuotedPrintableEncoder.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/QuotedPrintableEncoder.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/QuotedPrintableEncoder.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/RawSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RawSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RawSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/RawSocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RawSocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RawSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/RemoteSyslogChannel.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RemoteSyslogChannel.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RemoteSyslogChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/RemoteSyslogListener.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RemoteSyslogListener.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/RemoteSyslogListener.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SMTPChannel.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SMTPChannel.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SMTPChannel.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SMTPClientSession.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SMTPClientSession.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SMTPClientSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ServerSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ServerSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ServerSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/ServerSocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ServerSocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/ServerSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/Socket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/Socket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/Socket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketAddress.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketAddress.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketAddress.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketAddressImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketAddressImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketAddressImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketNotification.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketNotification.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketNotification.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketNotifier.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketNotifier.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketNotifier.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketReactor.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketReactor.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketReactor.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/SocketStream.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketStream.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/SocketStream.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/StreamSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/StreamSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/StreamSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/StreamSocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/StreamSocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/StreamSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/StringPartSource.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/StringPartSource.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/StringPartSource.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/TCPServer.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServer.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/TCPServerConnection.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerConnection.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerConnection.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/TCPServerConnectionFactory.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerConnectionFactory.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerConnectionFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/TCPServerDispatcher.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerDispatcher.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerDispatcher.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/TCPServerParams.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerParams.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/TCPServerParams.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/WebSocket.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/WebSocket.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/WebSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/Net/src/WebSocketImpl.cpp" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/WebSocketImpl.cpp.o" "gcc" "contrib/libpoco/Net/CMakeFiles/PocoNet.dir/src/WebSocketImpl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
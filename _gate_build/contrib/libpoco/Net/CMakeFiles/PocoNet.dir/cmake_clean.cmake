@@ -0,0 +1,207 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoNet.a"
+  "../lib/libPocoNet.pdb"
+  "CMakeFiles/PocoNet.dir/src/AbstractHTTPRequestHandler.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/AbstractHTTPRequestHandler.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/DNS.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/DNS.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/DatagramSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/DatagramSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/DatagramSocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/DatagramSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/DialogSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/DialogSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/FTPClientSession.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/FTPClientSession.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/FTPStreamFactory.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/FTPStreamFactory.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/FilePartSource.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/FilePartSource.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTMLForm.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTMLForm.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPAuthenticationParams.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPAuthenticationParams.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPBasicCredentials.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPBasicCredentials.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPBufferAllocator.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPBufferAllocator.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPChunkedStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPChunkedStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPClientSession.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPClientSession.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPCookie.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPCookie.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPCredentials.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPCredentials.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPDigestCredentials.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPDigestCredentials.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPFixedLengthStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPFixedLengthStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPHeaderStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPHeaderStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPIOStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPIOStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPMessage.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPMessage.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPRequest.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPRequest.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPRequestHandler.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPRequestHandler.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPRequestHandlerFactory.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPRequestHandlerFactory.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPResponse.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPResponse.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServer.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServer.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerConnection.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerConnection.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerConnectionFactory.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerConnectionFactory.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerParams.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerParams.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerRequest.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerRequest.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerRequestImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerRequestImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerResponse.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerResponse.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerResponseImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerResponseImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerSession.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPServerSession.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPSession.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPSession.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPSessionFactory.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPSessionFactory.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPSessionInstantiator.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPSessionInstantiator.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HTTPStreamFactory.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HTTPStreamFactory.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/HostEntry.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/HostEntry.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPClient.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPClient.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPEventArgs.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPEventArgs.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPPacket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPPacket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPPacketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPPacketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPSocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ICMPv4PacketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ICMPv4PacketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/IPAddress.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/IPAddress.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/IPAddressImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/IPAddressImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MailMessage.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MailMessage.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MailRecipient.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MailRecipient.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MailStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MailStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MediaType.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MediaType.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MessageHeader.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MessageHeader.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MulticastSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MulticastSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MultipartReader.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MultipartReader.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/MultipartWriter.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/MultipartWriter.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NTPClient.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NTPClient.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NTPEventArgs.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NTPEventArgs.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NTPPacket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NTPPacket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NameValueCollection.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NameValueCollection.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/Net.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/Net.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NetException.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NetException.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NetworkInterface.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NetworkInterface.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/NullPartHandler.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/NullPartHandler.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/OAuth10Credentials.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/OAuth10Credentials.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/OAuth20Credentials.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/OAuth20Credentials.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/POP3ClientSession.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/POP3ClientSession.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/PartHandler.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/PartHandler.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/PartSource.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/PartSource.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/PartStore.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/PartStore.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/QuotedPrintableDecoder.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/QuotedPrintableDecoder.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/QuotedPrintableEncoder.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/QuotedPrintableEncoder.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/RawSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/RawSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/RawSocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/RawSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/RemoteSyslogChannel.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/RemoteSyslogChannel.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/RemoteSyslogListener.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/RemoteSyslogListener.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SMTPChannel.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SMTPChannel.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SMTPClientSession.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SMTPClientSession.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ServerSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ServerSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/ServerSocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/ServerSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/Socket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/Socket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketAddress.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketAddress.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketAddressImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketAddressImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketNotification.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketNotification.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketNotifier.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketNotifier.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketReactor.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketReactor.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/SocketStream.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/SocketStream.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/StreamSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/StreamSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/StreamSocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/StreamSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/StringPartSource.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/StringPartSource.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/TCPServer.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/TCPServer.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/TCPServerConnection.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/TCPServerConnection.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/TCPServerConnectionFactory.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/TCPServerConnectionFactory.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/TCPServerDispatcher.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/TCPServerDispatcher.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/TCPServerParams.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/TCPServerParams.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/WebSocket.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/WebSocket.cpp.o.d"
+  "CMakeFiles/PocoNet.dir/src/WebSocketImpl.cpp.o"
+  "CMakeFiles/PocoNet.dir/src/WebSocketImpl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PocoNet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/AcceptCertificateHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/AcceptCertificateHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/AcceptCertificateHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/CertificateHandlerFactory.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactory.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/CertificateHandlerFactoryMgr.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactoryMgr.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactoryMgr.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/ConsoleCertificateHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/ConsoleCertificateHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/ConsoleCertificateHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/Context.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/Context.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/Context.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/HTTPSClientSession.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/HTTPSClientSession.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/HTTPSClientSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/HTTPSSessionInstantiator.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/HTTPSSessionInstantiator.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/HTTPSSessionInstantiator.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/HTTPSStreamFactory.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/HTTPSStreamFactory.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/HTTPSStreamFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/InvalidCertificateHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/InvalidCertificateHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/InvalidCertificateHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/KeyConsoleHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/KeyConsoleHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/KeyConsoleHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/KeyFileHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/KeyFileHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/KeyFileHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/PrivateKeyFactory.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactory.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactory.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/PrivateKeyFactoryMgr.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactoryMgr.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactoryMgr.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/PrivateKeyPassphraseHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/PrivateKeyPassphraseHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/PrivateKeyPassphraseHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/RejectCertificateHandler.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/RejectCertificateHandler.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/RejectCertificateHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SSLException.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SSLException.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SSLException.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SSLManager.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SSLManager.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SSLManager.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SecureSMTPClientSession.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureSMTPClientSession.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureSMTPClientSession.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SecureServerSocket.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureServerSocket.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureServerSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SecureServerSocketImpl.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureServerSocketImpl.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureServerSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SecureSocketImpl.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureSocketImpl.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SecureStreamSocket.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocket.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocket.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/SecureStreamSocketImpl.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocketImpl.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocketImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/Session.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/Session.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/Session.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/Utility.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/Utility.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/Utility.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/VerificationErrorArgs.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/VerificationErrorArgs.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/VerificationErrorArgs.cpp.o.d"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/src/X509Certificate.cpp" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/X509Certificate.cpp.o" "gcc" "contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/src/X509Certificate.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoNetSSL.a"
+  "../lib/libPocoNetSSL.pdb"
+  "CMakeFiles/PocoNetSSL.dir/src/AcceptCertificateHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/AcceptCertificateHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactory.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactory.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactoryMgr.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/CertificateHandlerFactoryMgr.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/ConsoleCertificateHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/ConsoleCertificateHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/Context.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/Context.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/HTTPSClientSession.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/HTTPSClientSession.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/HTTPSSessionInstantiator.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/HTTPSSessionInstantiator.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/HTTPSStreamFactory.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/HTTPSStreamFactory.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/InvalidCertificateHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/InvalidCertificateHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/KeyConsoleHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/KeyConsoleHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/KeyFileHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/KeyFileHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactory.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactory.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactoryMgr.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/PrivateKeyFactoryMgr.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/PrivateKeyPassphraseHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/PrivateKeyPassphraseHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/RejectCertificateHandler.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/RejectCertificateHandler.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SSLException.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SSLException.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SSLManager.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SSLManager.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureSMTPClientSession.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureSMTPClientSession.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureServerSocket.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureServerSocket.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureServerSocketImpl.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureServerSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureSocketImpl.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocket.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocket.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocketImpl.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/SecureStreamSocketImpl.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/Session.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/Session.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/Utility.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/Utility.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/VerificationErrorArgs.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/VerificationErrorArgs.cpp.o.d"
+  "CMakeFiles/PocoNetSSL.dir/src/X509Certificate.cpp.o"
+  "CMakeFiles/PocoNetSSL.dir/src/X509Certificate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PocoNetSSL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
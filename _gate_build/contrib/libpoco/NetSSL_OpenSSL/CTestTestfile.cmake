@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/contrib/libpoco/NetSSL_OpenSSL
+# Build directory: /root/repo/_gate_build/contrib/libpoco/NetSSL_OpenSSL
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
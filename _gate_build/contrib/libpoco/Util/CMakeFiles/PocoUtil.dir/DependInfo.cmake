@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/Util/src/AbstractConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/AbstractConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/AbstractConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/Application.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Application.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Application.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/ConfigurationMapper.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/ConfigurationMapper.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/ConfigurationMapper.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/ConfigurationView.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/ConfigurationView.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/ConfigurationView.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/FilesystemConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/FilesystemConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/FilesystemConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/HelpFormatter.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/HelpFormatter.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/HelpFormatter.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/IniFileConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/IniFileConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/IniFileConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/IntValidator.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/IntValidator.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/IntValidator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/JSONConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/JSONConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/JSONConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/LayeredConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/LayeredConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/LayeredConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/LoggingConfigurator.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/LoggingConfigurator.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/LoggingConfigurator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/LoggingSubsystem.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/LoggingSubsystem.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/LoggingSubsystem.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/MapConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/MapConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/MapConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/Option.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Option.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Option.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/OptionCallback.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionCallback.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionCallback.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/OptionException.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionException.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionException.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/OptionProcessor.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionProcessor.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionProcessor.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/OptionSet.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionSet.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/OptionSet.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/PropertyFileConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/PropertyFileConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/PropertyFileConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/RegExpValidator.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/RegExpValidator.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/RegExpValidator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/ServerApplication.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/ServerApplication.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/ServerApplication.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/Subsystem.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Subsystem.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Subsystem.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/SystemConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/SystemConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/SystemConfiguration.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/Timer.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Timer.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Timer.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/TimerTask.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/TimerTask.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/TimerTask.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/Validator.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Validator.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/Validator.cpp.o.d"
+  "/root/repo/contrib/libpoco/Util/src/XMLConfiguration.cpp" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/XMLConfiguration.cpp.o" "gcc" "contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/src/XMLConfiguration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoUtil.a"
+  "../lib/libPocoUtil.pdb"
+  "CMakeFiles/PocoUtil.dir/src/AbstractConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/AbstractConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/Application.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/Application.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/ConfigurationMapper.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/ConfigurationMapper.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/ConfigurationView.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/ConfigurationView.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/FilesystemConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/FilesystemConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/HelpFormatter.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/HelpFormatter.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/IniFileConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/IniFileConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/IntValidator.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/IntValidator.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/JSONConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/JSONConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/LayeredConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/LayeredConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/LoggingConfigurator.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/LoggingConfigurator.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/LoggingSubsystem.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/LoggingSubsystem.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/MapConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/MapConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/Option.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/Option.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/OptionCallback.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/OptionCallback.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/OptionException.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/OptionException.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/OptionProcessor.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/OptionProcessor.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/OptionSet.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/OptionSet.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/PropertyFileConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/PropertyFileConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/RegExpValidator.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/RegExpValidator.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/ServerApplication.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/ServerApplication.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/Subsystem.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/Subsystem.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/SystemConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/SystemConfiguration.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/Timer.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/TimerTask.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/TimerTask.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/Validator.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/Validator.cpp.o.d"
+  "CMakeFiles/PocoUtil.dir/src/XMLConfiguration.cpp.o"
+  "CMakeFiles/PocoUtil.dir/src/XMLConfiguration.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PocoUtil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,92 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libpoco/XML/src/xmlrole.c" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmlrole.c.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmlrole.c.o.d"
+  "/root/repo/contrib/libpoco/XML/src/xmltok.c" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmltok.c.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmltok.c.o.d"
+  "/root/repo/contrib/libpoco/XML/src/xmltok_impl.c" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmltok_impl.c.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmltok_impl.c.o.d"
+  "/root/repo/contrib/libpoco/XML/src/xmltok_ns.c" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmltok_ns.c.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmltok_ns.c.o.d"
+  "/root/repo/contrib/libpoco/XML/src/AbstractContainerNode.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AbstractContainerNode.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AbstractContainerNode.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/AbstractNode.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AbstractNode.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AbstractNode.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Attr.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Attr.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Attr.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/AttrMap.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AttrMap.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AttrMap.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Attributes.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Attributes.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Attributes.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/AttributesImpl.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AttributesImpl.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/AttributesImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/CDATASection.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/CDATASection.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/CDATASection.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/CharacterData.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/CharacterData.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/CharacterData.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/ChildNodesList.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ChildNodesList.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ChildNodesList.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Comment.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Comment.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Comment.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/ContentHandler.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ContentHandler.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ContentHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMBuilder.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMBuilder.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMBuilder.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMException.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMException.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMException.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMImplementation.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMImplementation.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMImplementation.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMObject.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMObject.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMObject.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMParser.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMParser.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMParser.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMSerializer.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMSerializer.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMSerializer.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DOMWriter.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMWriter.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DOMWriter.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DTDHandler.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DTDHandler.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DTDHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DTDMap.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DTDMap.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DTDMap.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DeclHandler.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DeclHandler.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DeclHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DefaultHandler.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DefaultHandler.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DefaultHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Document.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Document.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Document.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DocumentEvent.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DocumentEvent.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DocumentEvent.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DocumentFragment.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DocumentFragment.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DocumentFragment.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/DocumentType.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DocumentType.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/DocumentType.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Element.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Element.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Element.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/ElementsByTagNameList.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ElementsByTagNameList.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ElementsByTagNameList.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Entity.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Entity.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Entity.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EntityReference.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EntityReference.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EntityReference.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EntityResolver.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EntityResolver.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EntityResolver.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EntityResolverImpl.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EntityResolverImpl.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EntityResolverImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/ErrorHandler.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ErrorHandler.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ErrorHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Event.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Event.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Event.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EventDispatcher.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventDispatcher.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventDispatcher.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EventException.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventException.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventException.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EventListener.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventListener.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventListener.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/EventTarget.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventTarget.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/EventTarget.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/InputSource.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/InputSource.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/InputSource.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/LexicalHandler.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/LexicalHandler.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/LexicalHandler.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Locator.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Locator.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Locator.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/LocatorImpl.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/LocatorImpl.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/LocatorImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/MutationEvent.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/MutationEvent.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/MutationEvent.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Name.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Name.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Name.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NamePool.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamePool.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamePool.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NamedNodeMap.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamedNodeMap.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamedNodeMap.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NamespaceStrategy.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamespaceStrategy.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamespaceStrategy.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NamespaceSupport.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamespaceSupport.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NamespaceSupport.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Node.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Node.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Node.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NodeAppender.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeAppender.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeAppender.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NodeFilter.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeFilter.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeFilter.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NodeIterator.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeIterator.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeIterator.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/NodeList.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeList.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/NodeList.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Notation.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Notation.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Notation.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/ParserEngine.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ParserEngine.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ParserEngine.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/ProcessingInstruction.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ProcessingInstruction.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/ProcessingInstruction.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/SAXException.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/SAXException.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/SAXException.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/SAXParser.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/SAXParser.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/SAXParser.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/Text.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Text.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/Text.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/TreeWalker.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/TreeWalker.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/TreeWalker.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/WhitespaceFilter.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/WhitespaceFilter.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/WhitespaceFilter.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/XMLException.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLException.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLException.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/XMLFilter.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLFilter.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLFilter.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/XMLFilterImpl.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLFilterImpl.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLFilterImpl.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/XMLReader.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLReader.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLReader.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/XMLString.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLString.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLString.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/XMLWriter.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLWriter.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/XMLWriter.cpp.o.d"
+  "/root/repo/contrib/libpoco/XML/src/xmlparse.cpp" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmlparse.cpp.o" "gcc" "contrib/libpoco/XML/CMakeFiles/PocoXML.dir/src/xmlparse.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
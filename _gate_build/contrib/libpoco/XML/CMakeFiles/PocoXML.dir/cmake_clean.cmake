@@ -0,0 +1,153 @@
+file(REMOVE_RECURSE
+  "../lib/libPocoXML.a"
+  "../lib/libPocoXML.pdb"
+  "CMakeFiles/PocoXML.dir/src/AbstractContainerNode.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/AbstractContainerNode.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/AbstractNode.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/AbstractNode.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Attr.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Attr.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/AttrMap.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/AttrMap.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Attributes.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Attributes.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/AttributesImpl.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/AttributesImpl.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/CDATASection.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/CDATASection.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/CharacterData.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/CharacterData.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/ChildNodesList.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/ChildNodesList.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Comment.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Comment.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/ContentHandler.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/ContentHandler.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMBuilder.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMBuilder.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMException.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMException.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMImplementation.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMImplementation.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMObject.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMObject.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMParser.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMParser.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMSerializer.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMSerializer.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DOMWriter.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DOMWriter.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DTDHandler.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DTDHandler.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DTDMap.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DTDMap.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DeclHandler.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DeclHandler.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DefaultHandler.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DefaultHandler.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Document.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Document.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DocumentEvent.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DocumentEvent.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DocumentFragment.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DocumentFragment.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/DocumentType.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/DocumentType.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Element.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Element.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/ElementsByTagNameList.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/ElementsByTagNameList.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Entity.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Entity.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EntityReference.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EntityReference.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EntityResolver.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EntityResolver.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EntityResolverImpl.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EntityResolverImpl.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/ErrorHandler.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/ErrorHandler.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Event.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Event.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EventDispatcher.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EventDispatcher.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EventException.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EventException.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EventListener.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EventListener.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/EventTarget.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/EventTarget.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/InputSource.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/InputSource.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/LexicalHandler.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/LexicalHandler.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Locator.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Locator.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/LocatorImpl.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/LocatorImpl.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/MutationEvent.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/MutationEvent.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Name.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Name.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NamePool.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NamePool.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NamedNodeMap.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NamedNodeMap.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NamespaceStrategy.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NamespaceStrategy.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NamespaceSupport.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NamespaceSupport.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Node.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Node.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NodeAppender.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NodeAppender.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NodeFilter.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NodeFilter.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NodeIterator.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NodeIterator.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/NodeList.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/NodeList.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Notation.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Notation.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/ParserEngine.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/ParserEngine.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/ProcessingInstruction.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/ProcessingInstruction.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/SAXException.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/SAXException.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/SAXParser.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/SAXParser.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/Text.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/Text.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/TreeWalker.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/TreeWalker.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/WhitespaceFilter.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/WhitespaceFilter.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/XMLException.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/XMLException.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/XMLFilter.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/XMLFilter.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/XMLFilterImpl.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/XMLFilterImpl.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/XMLReader.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/XMLReader.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/XMLString.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/XMLString.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/XMLWriter.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/XMLWriter.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/xmlparse.cpp.o"
+  "CMakeFiles/PocoXML.dir/src/xmlparse.cpp.o.d"
+  "CMakeFiles/PocoXML.dir/src/xmlrole.c.o"
+  "CMakeFiles/PocoXML.dir/src/xmlrole.c.o.d"
+  "CMakeFiles/PocoXML.dir/src/xmltok.c.o"
+  "CMakeFiles/PocoXML.dir/src/xmltok.c.o.d"
+  "CMakeFiles/PocoXML.dir/src/xmltok_impl.c.o"
+  "CMakeFiles/PocoXML.dir/src/xmltok_impl.c.o.d"
+  "CMakeFiles/PocoXML.dir/src/xmltok_ns.c.o"
+  "CMakeFiles/PocoXML.dir/src/xmltok_ns.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/PocoXML.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
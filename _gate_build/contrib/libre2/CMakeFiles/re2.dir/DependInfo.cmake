@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libre2/re2/bitstate.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/bitstate.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/bitstate.cc.o.d"
+  "/root/repo/contrib/libre2/re2/compile.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/compile.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/compile.cc.o.d"
+  "/root/repo/contrib/libre2/re2/dfa.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/dfa.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/dfa.cc.o.d"
+  "/root/repo/contrib/libre2/re2/filtered_re2.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/filtered_re2.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/filtered_re2.cc.o.d"
+  "/root/repo/contrib/libre2/re2/mimics_pcre.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/mimics_pcre.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/mimics_pcre.cc.o.d"
+  "/root/repo/contrib/libre2/re2/nfa.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/nfa.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/nfa.cc.o.d"
+  "/root/repo/contrib/libre2/re2/onepass.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/onepass.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/onepass.cc.o.d"
+  "/root/repo/contrib/libre2/re2/parse.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/parse.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/parse.cc.o.d"
+  "/root/repo/contrib/libre2/re2/perl_groups.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/perl_groups.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/perl_groups.cc.o.d"
+  "/root/repo/contrib/libre2/re2/prefilter.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/prefilter.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/prefilter.cc.o.d"
+  "/root/repo/contrib/libre2/re2/prefilter_tree.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/prefilter_tree.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/prefilter_tree.cc.o.d"
+  "/root/repo/contrib/libre2/re2/prog.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/prog.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/prog.cc.o.d"
+  "/root/repo/contrib/libre2/re2/re2.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/re2.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/re2.cc.o.d"
+  "/root/repo/contrib/libre2/re2/regexp.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/regexp.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/regexp.cc.o.d"
+  "/root/repo/contrib/libre2/re2/set.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/set.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/set.cc.o.d"
+  "/root/repo/contrib/libre2/re2/simplify.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/simplify.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/simplify.cc.o.d"
+  "/root/repo/contrib/libre2/re2/tostring.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/tostring.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/tostring.cc.o.d"
+  "/root/repo/contrib/libre2/re2/unicode_casefold.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/unicode_casefold.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/unicode_casefold.cc.o.d"
+  "/root/repo/contrib/libre2/re2/unicode_groups.cc" "contrib/libre2/CMakeFiles/re2.dir/re2/unicode_groups.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/re2/unicode_groups.cc.o.d"
+  "/root/repo/contrib/libre2/util/arena.cc" "contrib/libre2/CMakeFiles/re2.dir/util/arena.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/arena.cc.o.d"
+  "/root/repo/contrib/libre2/util/hash.cc" "contrib/libre2/CMakeFiles/re2.dir/util/hash.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/hash.cc.o.d"
+  "/root/repo/contrib/libre2/util/pcre.cc" "contrib/libre2/CMakeFiles/re2.dir/util/pcre.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/pcre.cc.o.d"
+  "/root/repo/contrib/libre2/util/random.cc" "contrib/libre2/CMakeFiles/re2.dir/util/random.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/random.cc.o.d"
+  "/root/repo/contrib/libre2/util/rune.cc" "contrib/libre2/CMakeFiles/re2.dir/util/rune.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/rune.cc.o.d"
+  "/root/repo/contrib/libre2/util/stringpiece.cc" "contrib/libre2/CMakeFiles/re2.dir/util/stringpiece.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/stringpiece.cc.o.d"
+  "/root/repo/contrib/libre2/util/stringprintf.cc" "contrib/libre2/CMakeFiles/re2.dir/util/stringprintf.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/stringprintf.cc.o.d"
+  "/root/repo/contrib/libre2/util/strutil.cc" "contrib/libre2/CMakeFiles/re2.dir/util/strutil.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/strutil.cc.o.d"
+  "/root/repo/contrib/libre2/util/thread.cc" "contrib/libre2/CMakeFiles/re2.dir/util/thread.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/thread.cc.o.d"
+  "/root/repo/contrib/libre2/util/valgrind.cc" "contrib/libre2/CMakeFiles/re2.dir/util/valgrind.cc.o" "gcc" "contrib/libre2/CMakeFiles/re2.dir/util/valgrind.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
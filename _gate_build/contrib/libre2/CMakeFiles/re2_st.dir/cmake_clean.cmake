@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re2_st.dir/re2/bitstate.cc.o"
+  "CMakeFiles/re2_st.dir/re2/bitstate.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/compile.cc.o"
+  "CMakeFiles/re2_st.dir/re2/compile.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/dfa.cc.o"
+  "CMakeFiles/re2_st.dir/re2/dfa.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/filtered_re2.cc.o"
+  "CMakeFiles/re2_st.dir/re2/filtered_re2.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/mimics_pcre.cc.o"
+  "CMakeFiles/re2_st.dir/re2/mimics_pcre.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/nfa.cc.o"
+  "CMakeFiles/re2_st.dir/re2/nfa.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/onepass.cc.o"
+  "CMakeFiles/re2_st.dir/re2/onepass.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/parse.cc.o"
+  "CMakeFiles/re2_st.dir/re2/parse.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/perl_groups.cc.o"
+  "CMakeFiles/re2_st.dir/re2/perl_groups.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/prefilter.cc.o"
+  "CMakeFiles/re2_st.dir/re2/prefilter.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/prefilter_tree.cc.o"
+  "CMakeFiles/re2_st.dir/re2/prefilter_tree.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/prog.cc.o"
+  "CMakeFiles/re2_st.dir/re2/prog.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/re2.cc.o"
+  "CMakeFiles/re2_st.dir/re2/re2.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/regexp.cc.o"
+  "CMakeFiles/re2_st.dir/re2/regexp.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/set.cc.o"
+  "CMakeFiles/re2_st.dir/re2/set.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/simplify.cc.o"
+  "CMakeFiles/re2_st.dir/re2/simplify.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/tostring.cc.o"
+  "CMakeFiles/re2_st.dir/re2/tostring.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/unicode_casefold.cc.o"
+  "CMakeFiles/re2_st.dir/re2/unicode_casefold.cc.o.d"
+  "CMakeFiles/re2_st.dir/re2/unicode_groups.cc.o"
+  "CMakeFiles/re2_st.dir/re2/unicode_groups.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/arena.cc.o"
+  "CMakeFiles/re2_st.dir/util/arena.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/hash.cc.o"
+  "CMakeFiles/re2_st.dir/util/hash.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/pcre.cc.o"
+  "CMakeFiles/re2_st.dir/util/pcre.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/random.cc.o"
+  "CMakeFiles/re2_st.dir/util/random.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/rune.cc.o"
+  "CMakeFiles/re2_st.dir/util/rune.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/stringpiece.cc.o"
+  "CMakeFiles/re2_st.dir/util/stringpiece.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/stringprintf.cc.o"
+  "CMakeFiles/re2_st.dir/util/stringprintf.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/strutil.cc.o"
+  "CMakeFiles/re2_st.dir/util/strutil.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/thread.cc.o"
+  "CMakeFiles/re2_st.dir/util/thread.cc.o.d"
+  "CMakeFiles/re2_st.dir/util/valgrind.cc.o"
+  "CMakeFiles/re2_st.dir/util/valgrind.cc.o.d"
+  "libre2_st.a"
+  "libre2_st.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re2_st.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/transform_filtered_re2.h"
+  "re2_st/filtered_re2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/transform_filtered_re2.h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/transform_set.h"
+  "re2_st/set.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/transform_set.h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
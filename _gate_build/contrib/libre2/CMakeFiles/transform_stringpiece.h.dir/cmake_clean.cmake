@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/transform_stringpiece.h"
+  "re2_st/stringpiece.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/transform_stringpiece.h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
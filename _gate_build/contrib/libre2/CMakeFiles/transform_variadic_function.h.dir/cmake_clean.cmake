@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/transform_variadic_function.h"
+  "re2_st/variadic_function.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/transform_variadic_function.h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
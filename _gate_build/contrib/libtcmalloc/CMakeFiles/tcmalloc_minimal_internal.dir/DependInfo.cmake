@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libtcmalloc/src/base/dynamic_annotations.c" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/dynamic_annotations.c.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/dynamic_annotations.c.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/thread_lister.c" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/thread_lister.c.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/thread_lister.c.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/atomicops-internals-x86.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/atomicops-internals-x86.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/atomicops-internals-x86.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/elf_mem_image.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/elf_mem_image.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/elf_mem_image.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/linuxthreads.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/linuxthreads.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/linuxthreads.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/logging.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/logging.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/logging.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/low_level_alloc.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/low_level_alloc.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/low_level_alloc.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/spinlock.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/spinlock_internal.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock_internal.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock_internal.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/sysinfo.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/sysinfo.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/sysinfo.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/base/vdso_support.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/vdso_support.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/base/vdso_support.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/central_freelist.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/central_freelist.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/central_freelist.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/common.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/common.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/common.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/debugallocation.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/debugallocation.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/debugallocation.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/heap-checker-bcad.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker-bcad.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker-bcad.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/heap-checker.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/heap-profile-table.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-profile-table.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-profile-table.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/internal_logging.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/internal_logging.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/internal_logging.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/malloc_extension.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_extension.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_extension.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/malloc_hook.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_hook.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_hook.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/maybe_threads.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/maybe_threads.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/maybe_threads.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/memfs_malloc.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/memfs_malloc.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/memfs_malloc.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/memory_region_map.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/memory_region_map.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/memory_region_map.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/page_heap.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/page_heap.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/page_heap.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/raw_printer.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/raw_printer.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/raw_printer.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/sampler.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/sampler.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/sampler.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/span.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/span.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/span.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/stack_trace_table.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/stack_trace_table.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/stack_trace_table.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/stacktrace.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/stacktrace.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/stacktrace.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/static_vars.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/static_vars.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/static_vars.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/symbolize.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/symbolize.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/symbolize.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/system-alloc.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/system-alloc.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/system-alloc.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/tcmalloc.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/tcmalloc.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/tcmalloc.cc.o.d"
+  "/root/repo/contrib/libtcmalloc/src/thread_cache.cc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/thread_cache.cc.o" "gcc" "contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/src/thread_cache.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
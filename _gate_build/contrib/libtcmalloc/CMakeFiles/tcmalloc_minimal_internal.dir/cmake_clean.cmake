@@ -0,0 +1,77 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/atomicops-internals-x86.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/atomicops-internals-x86.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/dynamic_annotations.c.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/dynamic_annotations.c.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/elf_mem_image.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/elf_mem_image.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/linuxthreads.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/linuxthreads.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/logging.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/logging.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/low_level_alloc.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/low_level_alloc.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock_internal.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/spinlock_internal.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/sysinfo.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/sysinfo.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/thread_lister.c.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/thread_lister.c.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/vdso_support.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/base/vdso_support.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/central_freelist.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/central_freelist.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/common.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/common.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/debugallocation.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/debugallocation.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker-bcad.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker-bcad.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-checker.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-profile-table.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/heap-profile-table.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/internal_logging.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/internal_logging.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_extension.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_extension.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_hook.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/malloc_hook.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/maybe_threads.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/maybe_threads.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/memfs_malloc.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/memfs_malloc.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/memory_region_map.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/memory_region_map.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/page_heap.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/page_heap.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/raw_printer.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/raw_printer.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/sampler.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/sampler.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/span.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/span.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/stack_trace_table.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/stack_trace_table.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/stacktrace.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/stacktrace.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/static_vars.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/static_vars.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/symbolize.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/symbolize.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/system-alloc.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/system-alloc.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/tcmalloc.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/tcmalloc.cc.o.d"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/thread_cache.cc.o"
+  "CMakeFiles/tcmalloc_minimal_internal.dir/src/thread_cache.cc.o.d"
+  "libtcmalloc_minimal_internal.a"
+  "libtcmalloc_minimal_internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/tcmalloc_minimal_internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libtcmalloc_minimal_internal.a"
+)
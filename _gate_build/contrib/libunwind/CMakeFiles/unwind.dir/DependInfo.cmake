@@ -0,0 +1,98 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/contrib/libunwind/src/x86_64/getcontext.S" "/root/repo/_gate_build/contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/getcontext.S.o"
+  "/root/repo/contrib/libunwind/src/x86_64/setcontext.S" "/root/repo/_gate_build/contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/setcontext.S.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "BOOST_SYSTEM_NO_DEPRECATED"
+  "HAVE_CONFIG_H=1"
+  "_GNU_SOURCE"
+  "_XOPEN_SOURCE"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "contrib/libzlib-ng"
+  "/root/repo/contrib/libzlib-ng"
+  "/root/repo/contrib/libpoco/Crypto/include"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/include"
+  "/root/repo/contrib/libpoco/MongoDB/include"
+  "/root/repo/contrib/libpoco/XML/include"
+  "/root/repo/contrib/libpoco/Data/include"
+  "/root/repo/contrib/libpoco/Net/include"
+  "/root/repo/contrib/libpoco/Util/include"
+  "/root/repo/contrib/libpoco/Foundation/include"
+  "/usr/include"
+  "/root/repo/contrib/libunwind/include"
+  "/root/repo/contrib/libunwind/include/tdep"
+  "contrib/libunwind/config"
+  "contrib/libunwind/config/tdep"
+  "/root/repo/contrib/libunwind/src"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libunwind/src/dwarf/Lexpr.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lexpr.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lexpr.c.o.d"
+  "/root/repo/contrib/libunwind/src/dwarf/Lfde.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lfde.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lfde.c.o.d"
+  "/root/repo/contrib/libunwind/src/dwarf/Lfind_proc_info-lsb.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lfind_proc_info-lsb.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lfind_proc_info-lsb.c.o.d"
+  "/root/repo/contrib/libunwind/src/dwarf/Lparser.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lparser.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lparser.c.o.d"
+  "/root/repo/contrib/libunwind/src/dwarf/Lpe.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lpe.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/Lpe.c.o.d"
+  "/root/repo/contrib/libunwind/src/dwarf/global.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/global.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/dwarf/global.c.o.d"
+  "/root/repo/contrib/libunwind/src/elf64.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/elf64.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/elf64.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Ldestroy_addr_space.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Ldestroy_addr_space.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Ldestroy_addr_space.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Ldyn-extract.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Ldyn-extract.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Ldyn-extract.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lfind_dynamic_proc_info.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lfind_dynamic_proc_info.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lfind_dynamic_proc_info.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lget_accessors.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_accessors.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_accessors.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lget_fpreg.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_fpreg.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_fpreg.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lget_proc_info_by_ip.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_proc_info_by_ip.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_proc_info_by_ip.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lget_proc_name.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_proc_name.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_proc_name.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lget_reg.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_reg.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lget_reg.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lput_dynamic_unwind_info.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lput_dynamic_unwind_info.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lput_dynamic_unwind_info.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lset_caching_policy.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lset_caching_policy.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lset_caching_policy.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lset_fpreg.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lset_fpreg.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lset_fpreg.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/Lset_reg.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lset_reg.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/Lset_reg.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/_ReadSLEB.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/_ReadSLEB.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/_ReadSLEB.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/_ReadULEB.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/_ReadULEB.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/_ReadULEB.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/backtrace.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/backtrace.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/backtrace.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/dyn-cancel.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/dyn-cancel.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/dyn-cancel.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/dyn-info-list.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/dyn-info-list.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/dyn-info-list.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/dyn-register.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/dyn-register.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/dyn-register.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/flush_cache.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/flush_cache.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/flush_cache.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/init.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/init.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/init.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/mempool.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/mempool.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/mempool.c.o.d"
+  "/root/repo/contrib/libunwind/src/mi/strerror.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/strerror.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/mi/strerror.c.o.d"
+  "/root/repo/contrib/libunwind/src/os-linux.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/os-linux.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/os-linux.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lcreate_addr_space.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lcreate_addr_space.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lcreate_addr_space.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lget_proc_info.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lget_proc_info.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lget_proc_info.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lget_save_loc.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lget_save_loc.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lget_save_loc.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lglobal.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lglobal.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lglobal.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Linit.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Linit.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Linit.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Linit_local.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Linit_local.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Linit_local.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Linit_remote.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Linit_remote.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Linit_remote.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Los-linux.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Los-linux.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Los-linux.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lregs.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lregs.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lregs.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lresume.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lresume.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lresume.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lstash_frame.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lstash_frame.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lstash_frame.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Lstep.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lstep.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Lstep.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/Ltrace.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Ltrace.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/Ltrace.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/is_fpreg.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/is_fpreg.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/is_fpreg.c.o.d"
+  "/root/repo/contrib/libunwind/src/x86_64/regname.c" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/regname.c.o" "gcc" "contrib/libunwind/CMakeFiles/unwind.dir/src/x86_64/regname.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,101 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unwind.dir/src/dwarf/Lexpr.c.o"
+  "CMakeFiles/unwind.dir/src/dwarf/Lexpr.c.o.d"
+  "CMakeFiles/unwind.dir/src/dwarf/Lfde.c.o"
+  "CMakeFiles/unwind.dir/src/dwarf/Lfde.c.o.d"
+  "CMakeFiles/unwind.dir/src/dwarf/Lfind_proc_info-lsb.c.o"
+  "CMakeFiles/unwind.dir/src/dwarf/Lfind_proc_info-lsb.c.o.d"
+  "CMakeFiles/unwind.dir/src/dwarf/Lparser.c.o"
+  "CMakeFiles/unwind.dir/src/dwarf/Lparser.c.o.d"
+  "CMakeFiles/unwind.dir/src/dwarf/Lpe.c.o"
+  "CMakeFiles/unwind.dir/src/dwarf/Lpe.c.o.d"
+  "CMakeFiles/unwind.dir/src/dwarf/global.c.o"
+  "CMakeFiles/unwind.dir/src/dwarf/global.c.o.d"
+  "CMakeFiles/unwind.dir/src/elf64.c.o"
+  "CMakeFiles/unwind.dir/src/elf64.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Ldestroy_addr_space.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Ldestroy_addr_space.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Ldyn-extract.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Ldyn-extract.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lfind_dynamic_proc_info.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lfind_dynamic_proc_info.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lget_accessors.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lget_accessors.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lget_fpreg.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lget_fpreg.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lget_proc_info_by_ip.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lget_proc_info_by_ip.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lget_proc_name.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lget_proc_name.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lget_reg.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lget_reg.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lput_dynamic_unwind_info.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lput_dynamic_unwind_info.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lset_caching_policy.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lset_caching_policy.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lset_fpreg.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lset_fpreg.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/Lset_reg.c.o"
+  "CMakeFiles/unwind.dir/src/mi/Lset_reg.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/_ReadSLEB.c.o"
+  "CMakeFiles/unwind.dir/src/mi/_ReadSLEB.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/_ReadULEB.c.o"
+  "CMakeFiles/unwind.dir/src/mi/_ReadULEB.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/backtrace.c.o"
+  "CMakeFiles/unwind.dir/src/mi/backtrace.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/dyn-cancel.c.o"
+  "CMakeFiles/unwind.dir/src/mi/dyn-cancel.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/dyn-info-list.c.o"
+  "CMakeFiles/unwind.dir/src/mi/dyn-info-list.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/dyn-register.c.o"
+  "CMakeFiles/unwind.dir/src/mi/dyn-register.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/flush_cache.c.o"
+  "CMakeFiles/unwind.dir/src/mi/flush_cache.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/init.c.o"
+  "CMakeFiles/unwind.dir/src/mi/init.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/mempool.c.o"
+  "CMakeFiles/unwind.dir/src/mi/mempool.c.o.d"
+  "CMakeFiles/unwind.dir/src/mi/strerror.c.o"
+  "CMakeFiles/unwind.dir/src/mi/strerror.c.o.d"
+  "CMakeFiles/unwind.dir/src/os-linux.c.o"
+  "CMakeFiles/unwind.dir/src/os-linux.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lcreate_addr_space.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lcreate_addr_space.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lget_proc_info.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lget_proc_info.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lget_save_loc.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lget_save_loc.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lglobal.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lglobal.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Linit.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Linit.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Linit_local.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Linit_local.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Linit_remote.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Linit_remote.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Los-linux.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Los-linux.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lregs.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lregs.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lresume.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lresume.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lstash_frame.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lstash_frame.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Lstep.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Lstep.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/Ltrace.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/Ltrace.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/getcontext.S.o"
+  "CMakeFiles/unwind.dir/src/x86_64/is_fpreg.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/is_fpreg.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/regname.c.o"
+  "CMakeFiles/unwind.dir/src/x86_64/regname.c.o.d"
+  "CMakeFiles/unwind.dir/src/x86_64/setcontext.S.o"
+  "libunwind.a"
+  "libunwind.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM C)
+  include(CMakeFiles/unwind.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zlib.dir/adler32.c.o"
+  "CMakeFiles/zlib.dir/adler32.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/fill_window_sse.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/fill_window_sse.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/insert_string_sse.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/insert_string_sse.c.o.d"
+  "CMakeFiles/zlib.dir/arch/x86/x86.c.o"
+  "CMakeFiles/zlib.dir/arch/x86/x86.c.o.d"
+  "CMakeFiles/zlib.dir/compress.c.o"
+  "CMakeFiles/zlib.dir/compress.c.o.d"
+  "CMakeFiles/zlib.dir/crc32.c.o"
+  "CMakeFiles/zlib.dir/crc32.c.o.d"
+  "CMakeFiles/zlib.dir/deflate.c.o"
+  "CMakeFiles/zlib.dir/deflate.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_fast.c.o"
+  "CMakeFiles/zlib.dir/deflate_fast.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_medium.c.o"
+  "CMakeFiles/zlib.dir/deflate_medium.c.o.d"
+  "CMakeFiles/zlib.dir/deflate_slow.c.o"
+  "CMakeFiles/zlib.dir/deflate_slow.c.o.d"
+  "CMakeFiles/zlib.dir/infback.c.o"
+  "CMakeFiles/zlib.dir/infback.c.o.d"
+  "CMakeFiles/zlib.dir/inffast.c.o"
+  "CMakeFiles/zlib.dir/inffast.c.o.d"
+  "CMakeFiles/zlib.dir/inflate.c.o"
+  "CMakeFiles/zlib.dir/inflate.c.o.d"
+  "CMakeFiles/zlib.dir/inftrees.c.o"
+  "CMakeFiles/zlib.dir/inftrees.c.o.d"
+  "CMakeFiles/zlib.dir/match.c.o"
+  "CMakeFiles/zlib.dir/match.c.o.d"
+  "CMakeFiles/zlib.dir/trees.c.o"
+  "CMakeFiles/zlib.dir/trees.c.o.d"
+  "CMakeFiles/zlib.dir/uncompr.c.o"
+  "CMakeFiles/zlib.dir/uncompr.c.o.d"
+  "CMakeFiles/zlib.dir/zutil.c.o"
+  "CMakeFiles/zlib.dir/zutil.c.o.d"
+  "libz.pdb"
+  "libz.so"
+  "libz.so.1"
+  "libz.so.1.2.8.zlib-ng"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libzlib-ng/adler32.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/adler32.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/adler32.c.o.d"
+  "/root/repo/contrib/libzlib-ng/arch/x86/fill_window_sse.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/arch/x86/fill_window_sse.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/arch/x86/fill_window_sse.c.o.d"
+  "/root/repo/contrib/libzlib-ng/arch/x86/insert_string_sse.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/arch/x86/insert_string_sse.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/arch/x86/insert_string_sse.c.o.d"
+  "/root/repo/contrib/libzlib-ng/arch/x86/x86.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/arch/x86/x86.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/arch/x86/x86.c.o.d"
+  "/root/repo/contrib/libzlib-ng/compress.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/compress.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/compress.c.o.d"
+  "/root/repo/contrib/libzlib-ng/crc32.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/crc32.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/crc32.c.o.d"
+  "/root/repo/contrib/libzlib-ng/deflate.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate.c.o.d"
+  "/root/repo/contrib/libzlib-ng/deflate_fast.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate_fast.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate_fast.c.o.d"
+  "/root/repo/contrib/libzlib-ng/deflate_medium.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate_medium.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate_medium.c.o.d"
+  "/root/repo/contrib/libzlib-ng/deflate_slow.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate_slow.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/deflate_slow.c.o.d"
+  "/root/repo/contrib/libzlib-ng/infback.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/infback.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/infback.c.o.d"
+  "/root/repo/contrib/libzlib-ng/inffast.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/inffast.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/inffast.c.o.d"
+  "/root/repo/contrib/libzlib-ng/inflate.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/inflate.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/inflate.c.o.d"
+  "/root/repo/contrib/libzlib-ng/inftrees.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/inftrees.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/inftrees.c.o.d"
+  "/root/repo/contrib/libzlib-ng/match.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/match.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/match.c.o.d"
+  "/root/repo/contrib/libzlib-ng/trees.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/trees.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/trees.c.o.d"
+  "/root/repo/contrib/libzlib-ng/uncompr.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/uncompr.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/uncompr.c.o.d"
+  "/root/repo/contrib/libzlib-ng/zutil.c" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/zutil.c.o" "gcc" "contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
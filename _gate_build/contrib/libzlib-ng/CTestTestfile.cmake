@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/contrib/libzlib-ng
+# Build directory: /root/repo/_gate_build/contrib/libzlib-ng
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(example "example")
+set_tests_properties(example PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/contrib/libzlib-ng/CMakeLists.txt;549;add_test;/root/repo/contrib/libzlib-ng/CMakeLists.txt;0;")
+add_test(example64 "example64")
+set_tests_properties(example64 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/contrib/libzlib-ng/CMakeLists.txt;558;add_test;/root/repo/contrib/libzlib-ng/CMakeLists.txt;0;")
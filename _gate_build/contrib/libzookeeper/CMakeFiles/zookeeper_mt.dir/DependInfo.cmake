@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libzookeeper/src/hashtable/hashtable.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/hashtable/hashtable_itr.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable_itr.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable_itr.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/mt_adaptor.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/mt_adaptor.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/mt_adaptor.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/recordio.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/recordio.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/recordio.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/zk_hashtable.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zk_hashtable.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zk_hashtable.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/zk_log.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zk_log.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zk_log.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/zookeeper.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zookeeper.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zookeeper.c.o.d"
+  "/root/repo/contrib/libzookeeper/src/zookeeper.jute.c" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zookeeper.jute.c.o" "gcc" "contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/src/zookeeper.jute.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable_itr.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/hashtable/hashtable_itr.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/mt_adaptor.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/mt_adaptor.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/recordio.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/recordio.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/zk_hashtable.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/zk_hashtable.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/zk_log.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/zk_log.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/zookeeper.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/zookeeper.c.o.d"
+  "CMakeFiles/zookeeper_mt.dir/src/zookeeper.jute.c.o"
+  "CMakeFiles/zookeeper_mt.dir/src/zookeeper.jute.c.o.d"
+  "libzookeeper_mt.a"
+  "libzookeeper_mt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zookeeper_mt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/contrib/libzstd/include/zstd/common/entropy_common.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/entropy_common.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/entropy_common.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/common/error_private.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/error_private.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/error_private.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/common/fse_decompress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/fse_decompress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/fse_decompress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/common/pool.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/pool.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/pool.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/common/threading.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/threading.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/threading.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/common/xxhash.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/xxhash.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/xxhash.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/common/zstd_common.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/zstd_common.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/common/zstd_common.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/compress/fse_compress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/fse_compress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/fse_compress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/compress/huf_compress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/huf_compress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/huf_compress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/compress/zstd_compress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/zstd_compress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/zstd_compress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/compress/zstdmt_compress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/zstdmt_compress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/compress/zstdmt_compress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/decompress/huf_decompress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/decompress/huf_decompress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/decompress/huf_decompress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/decompress/zstd_decompress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/decompress/zstd_decompress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/decompress/zstd_decompress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/deprecated/zbuff_common.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_common.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_common.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/deprecated/zbuff_compress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_compress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_compress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/deprecated/zbuff_decompress.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_decompress.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_decompress.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/dictBuilder/cover.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/dictBuilder/cover.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/dictBuilder/cover.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/dictBuilder/divsufsort.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/dictBuilder/divsufsort.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/dictBuilder/divsufsort.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/dictBuilder/zdict.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/dictBuilder/zdict.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/dictBuilder/zdict.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v01.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v01.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v01.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v02.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v02.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v02.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v03.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v03.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v03.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v04.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v04.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v04.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v05.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v05.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v05.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v06.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v06.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v06.c.o.d"
+  "/root/repo/contrib/libzstd/include/zstd/legacy/zstd_v07.c" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v07.c.o" "gcc" "contrib/libzstd/CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v07.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
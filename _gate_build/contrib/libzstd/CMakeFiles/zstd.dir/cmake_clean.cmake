@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zstd.dir/include/zstd/common/entropy_common.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/entropy_common.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/common/error_private.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/error_private.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/common/fse_decompress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/fse_decompress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/common/pool.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/pool.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/common/threading.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/threading.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/common/xxhash.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/xxhash.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/common/zstd_common.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/common/zstd_common.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/compress/fse_compress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/compress/fse_compress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/compress/huf_compress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/compress/huf_compress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/compress/zstd_compress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/compress/zstd_compress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/compress/zstdmt_compress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/compress/zstdmt_compress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/decompress/huf_decompress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/decompress/huf_decompress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/decompress/zstd_decompress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/decompress/zstd_decompress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_common.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_common.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_compress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_compress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_decompress.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/deprecated/zbuff_decompress.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/dictBuilder/cover.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/dictBuilder/cover.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/dictBuilder/divsufsort.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/dictBuilder/divsufsort.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/dictBuilder/zdict.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/dictBuilder/zdict.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v01.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v01.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v02.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v02.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v03.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v03.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v04.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v04.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v05.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v05.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v06.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v06.c.o.d"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v07.c.o"
+  "CMakeFiles/zstd.dir/include/zstd/legacy/zstd_v07.c.o.d"
+  "libzstd.a"
+  "libzstd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zstd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,491 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionArray.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionArray.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionArray.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionCount.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionCount.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionCount.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionFactory.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionForEach.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionForEach.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionForEach.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionIf.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionIf.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionIf.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionMerge.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionMerge.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionMerge.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionNull.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionNull.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionNull.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/AggregateFunctionState.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionState.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionState.cpp.o.d"
+  "/root/repo/dbms/src/AggregateFunctions/parseAggregateFunctionParameters.cpp" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/parseAggregateFunctionParameters.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/AggregateFunctions/parseAggregateFunctionParameters.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/AnalyzeColumns.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/AnalyzeColumns.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/AnalyzeColumns.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/AnalyzeLambdas.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/AnalyzeLambdas.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/AnalyzeLambdas.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/AnalyzeResultOfQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/AnalyzeResultOfQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/AnalyzeResultOfQuery.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/CollectAliases.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/CollectAliases.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/CollectAliases.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/CollectTables.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/CollectTables.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/CollectTables.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/ExecuteTableFunctions.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/ExecuteTableFunctions.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/ExecuteTableFunctions.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/OptimizeGroupOrderLimitBy.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/OptimizeGroupOrderLimitBy.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/OptimizeGroupOrderLimitBy.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/TranslatePositionalArguments.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/TranslatePositionalArguments.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/TranslatePositionalArguments.cpp.o.d"
+  "/root/repo/dbms/src/Analyzers/TypeAndConstantInference.cpp" "dbms/CMakeFiles/dbms.dir/src/Analyzers/TypeAndConstantInference.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Analyzers/TypeAndConstantInference.cpp.o.d"
+  "/root/repo/dbms/src/Client/Connection.cpp" "dbms/CMakeFiles/dbms.dir/src/Client/Connection.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Client/Connection.cpp.o.d"
+  "/root/repo/dbms/src/Client/ConnectionPoolWithFailover.cpp" "dbms/CMakeFiles/dbms.dir/src/Client/ConnectionPoolWithFailover.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Client/ConnectionPoolWithFailover.cpp.o.d"
+  "/root/repo/dbms/src/Client/MultiplexedConnections.cpp" "dbms/CMakeFiles/dbms.dir/src/Client/MultiplexedConnections.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Client/MultiplexedConnections.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnAggregateFunction.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnAggregateFunction.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnAggregateFunction.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnArray.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnArray.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnArray.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnConst.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnConst.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnConst.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnExpression.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnExpression.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnExpression.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnFixedString.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnFixedString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnFixedString.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnLazy.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnLazy.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnLazy.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnNullable.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnNullable.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnNullable.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnString.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnString.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnTuple.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnTuple.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnTuple.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnVector.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnVector.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnVector.cpp.o.d"
+  "/root/repo/dbms/src/Columns/ColumnsCommon.cpp" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnsCommon.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Columns/ColumnsCommon.cpp.o.d"
+  "/root/repo/dbms/src/Common/Allocator.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/Allocator.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/Allocator.cpp.o.d"
+  "/root/repo/dbms/src/Common/ArenaChunkPool.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ArenaChunkPool.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ArenaChunkPool.cpp.o.d"
+  "/root/repo/dbms/src/Common/ClickHouseRevision.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ClickHouseRevision.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ClickHouseRevision.cpp.o.d"
+  "/root/repo/dbms/src/Common/Collator.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/Collator.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/Collator.cpp.o.d"
+  "/root/repo/dbms/src/Common/ConfigProcessor.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ConfigProcessor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ConfigProcessor.cpp.o.d"
+  "/root/repo/dbms/src/Common/CurrentMetrics.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/CurrentMetrics.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/CurrentMetrics.cpp.o.d"
+  "/root/repo/dbms/src/Common/Exception.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/Exception.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/Exception.cpp.o.d"
+  "/root/repo/dbms/src/Common/FileChecker.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/FileChecker.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/FileChecker.cpp.o.d"
+  "/root/repo/dbms/src/Common/GlobalWorkPool.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/GlobalWorkPool.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/GlobalWorkPool.cpp.o.d"
+  "/root/repo/dbms/src/Common/HardwareCounters.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/HardwareCounters.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/HardwareCounters.cpp.o.d"
+  "/root/repo/dbms/src/Common/Macros.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/Macros.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/Macros.cpp.o.d"
+  "/root/repo/dbms/src/Common/MemoryTracker.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/MemoryTracker.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/MemoryTracker.cpp.o.d"
+  "/root/repo/dbms/src/Common/NUMAAwareness.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/NUMAAwareness.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/NUMAAwareness.cpp.o.d"
+  "/root/repo/dbms/src/Common/NameInterner.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/NameInterner.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/NameInterner.cpp.o.d"
+  "/root/repo/dbms/src/Common/ProfileEvents.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ProfileEvents.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ProfileEvents.cpp.o.d"
+  "/root/repo/dbms/src/Common/QueryProfiler.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/QueryProfiler.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/QueryProfiler.cpp.o.d"
+  "/root/repo/dbms/src/Common/RWLockFIFO.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/RWLockFIFO.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/RWLockFIFO.cpp.o.d"
+  "/root/repo/dbms/src/Common/SharedLibrary.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/SharedLibrary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/SharedLibrary.cpp.o.d"
+  "/root/repo/dbms/src/Common/ShellCommand.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ShellCommand.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ShellCommand.cpp.o.d"
+  "/root/repo/dbms/src/Common/StackTrace.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/StackTrace.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/StackTrace.cpp.o.d"
+  "/root/repo/dbms/src/Common/VirtualColumnUtils.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/VirtualColumnUtils.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/VirtualColumnUtils.cpp.o.d"
+  "/root/repo/dbms/src/Common/ZooKeeper/Lock.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/Lock.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/Lock.cpp.o.d"
+  "/root/repo/dbms/src/Common/ZooKeeper/RWLock.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/RWLock.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/RWLock.cpp.o.d"
+  "/root/repo/dbms/src/Common/ZooKeeper/SingleBarrier.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/SingleBarrier.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/SingleBarrier.cpp.o.d"
+  "/root/repo/dbms/src/Common/ZooKeeper/ZooKeeper.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeper.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeper.cpp.o.d"
+  "/root/repo/dbms/src/Common/ZooKeeper/ZooKeeperHolder.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperHolder.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperHolder.cpp.o.d"
+  "/root/repo/dbms/src/Common/ZooKeeper/ZooKeeperNodeCache.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperNodeCache.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperNodeCache.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Common/config_build.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/config_build.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/config_build.cpp.o.d"
+  "/root/repo/dbms/src/Common/escapeForFileName.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/escapeForFileName.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/escapeForFileName.cpp.o.d"
+  "/root/repo/dbms/src/Common/formatIPv6.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/formatIPv6.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/formatIPv6.cpp.o.d"
+  "/root/repo/dbms/src/Common/formatReadable.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/formatReadable.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/formatReadable.cpp.o.d"
+  "/root/repo/dbms/src/Common/getFQDNOrHostName.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/getFQDNOrHostName.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/getFQDNOrHostName.cpp.o.d"
+  "/root/repo/dbms/src/Common/getMultipleKeysFromConfig.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/getMultipleKeysFromConfig.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/getMultipleKeysFromConfig.cpp.o.d"
+  "/root/repo/dbms/src/Common/getNumberOfPhysicalCPUCores.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/getNumberOfPhysicalCPUCores.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/getNumberOfPhysicalCPUCores.cpp.o.d"
+  "/root/repo/dbms/src/Common/hex.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/hex.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/hex.cpp.o.d"
+  "/root/repo/dbms/src/Common/iostream_debug_helpers.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/iostream_debug_helpers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/iostream_debug_helpers.cpp.o.d"
+  "/root/repo/dbms/src/Common/isLocalAddress.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/isLocalAddress.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/isLocalAddress.cpp.o.d"
+  "/root/repo/dbms/src/Common/localBackup.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/localBackup.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/localBackup.cpp.o.d"
+  "/root/repo/dbms/src/Common/randomSeed.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/randomSeed.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/randomSeed.cpp.o.d"
+  "/root/repo/dbms/src/Common/setThreadName.cpp" "dbms/CMakeFiles/dbms.dir/src/Common/setThreadName.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Common/setThreadName.cpp.o.d"
+  "/root/repo/dbms/src/Core/Block.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/Block.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/Block.cpp.o.d"
+  "/root/repo/dbms/src/Core/BlockInfo.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/BlockInfo.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/BlockInfo.cpp.o.d"
+  "/root/repo/dbms/src/Core/ColumnWithTypeAndName.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/ColumnWithTypeAndName.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/ColumnWithTypeAndName.cpp.o.d"
+  "/root/repo/dbms/src/Core/ErrorCodes.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/ErrorCodes.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/ErrorCodes.cpp.o.d"
+  "/root/repo/dbms/src/Core/Field.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/Field.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/Field.cpp.o.d"
+  "/root/repo/dbms/src/Core/FieldVisitors.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/FieldVisitors.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/FieldVisitors.cpp.o.d"
+  "/root/repo/dbms/src/Core/NamesAndTypes.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/NamesAndTypes.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/NamesAndTypes.cpp.o.d"
+  "/root/repo/dbms/src/Core/Progress.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/Progress.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/Progress.cpp.o.d"
+  "/root/repo/dbms/src/Core/SortDescription.cpp" "dbms/CMakeFiles/dbms.dir/src/Core/SortDescription.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Core/SortDescription.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/AdaptiveFilterBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AdaptiveFilterBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AdaptiveFilterBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/AddingDefaultBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AddingDefaultBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AddingDefaultBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/AggregatingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AggregatingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AggregatingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/AggregatingInOrderBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AggregatingInOrderBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AggregatingInOrderBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/AggregatingSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AggregatingSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/AggregatingSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ApproximateTopKBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ApproximateTopKBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ApproximateTopKBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/BinaryRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BinaryRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BinaryRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/BinaryRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BinaryRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BinaryRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/BlockIO.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockIO.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockIO.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/BlockInputStreamFromRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockInputStreamFromRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockInputStreamFromRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/BlockOutputStreamFromRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockOutputStreamFromRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockOutputStreamFromRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/BlockStreamProfileInfo.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockStreamProfileInfo.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/BlockStreamProfileInfo.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CSVRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CSVRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CSVRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CSVRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CSVRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CSVRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CastTypeBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CastTypeBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CastTypeBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CollapsingFinalBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CollapsingFinalBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CollapsingFinalBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CollapsingSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CollapsingSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CollapsingSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ColumnGathererStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ColumnGathererStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ColumnGathererStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CountingBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CountingBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CountingBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/CreatingSetsBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CreatingSetsBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/CreatingSetsBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/DistinctBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/DistinctBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/DistinctBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/DistinctOrderedLimitBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/DistinctOrderedLimitBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/DistinctOrderedLimitBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/DistinctSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/DistinctSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/DistinctSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ExpressionBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ExpressionBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ExpressionBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/FilterBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/FilterBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/FilterBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/FilterColumnsBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/FilterColumnsBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/FilterColumnsBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/FormatFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/FormatFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/FormatFactory.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/GraphiteRollupSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/GraphiteRollupSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/GraphiteRollupSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/IBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/IProfilingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IProfilingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IProfilingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/IRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/IRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/IRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/InputStreamFromASTInsertQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/InputStreamFromASTInsertQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/InputStreamFromASTInsertQuery.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/JSONCompactRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONCompactRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONCompactRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/JSONEachRowRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/JSONEachRowRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/JSONRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/JSONRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/LimitBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/LimitBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/LimitBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/LimitByBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/LimitByBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/LimitByBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/MaterializingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/MaterializingBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/MergeSortingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergeSortingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergeSortingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/MergingAggregatedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/MergingAggregatedMemoryEfficientBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedMemoryEfficientBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedMemoryEfficientBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/MergingSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergingSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/MergingSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/NativeBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/NativeBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/NativeBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/NativeBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/NativeBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/NativeBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/NullableAdapterBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/NullableAdapterBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/NullableAdapterBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ODBCDriverBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ODBCDriverBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ODBCDriverBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ParallelAggregatingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelAggregatingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelAggregatingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ParallelFormattingBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelFormattingBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelFormattingBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ParallelParsingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelParsingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelParsingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ParallelizingBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelizingBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ParallelizingBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/PartialSortingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PartialSortingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PartialSortingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/PrettyBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PrettyBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PrettyBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/PrettyCompactBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PrettyCompactBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PrettyCompactBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/PrettySpaceBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PrettySpaceBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/PrettySpaceBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ProhibitColumnsBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ProhibitColumnsBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ProhibitColumnsBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/RemoteBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/RemoteBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ReplacingSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ReplacingSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ReplacingSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/SquashingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/SquashingBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/SquashingTransform.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SquashingTransform.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SquashingTransform.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/SummingSortedBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SummingSortedBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/SummingSortedBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/TSKVRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TSKVRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TSKVRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/TSKVRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TSKVRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TSKVRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/TabSeparatedBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/TabSeparatedRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/TabSeparatedRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/TotalsHavingBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TotalsHavingBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/TotalsHavingBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ValuesRowInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ValuesRowInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ValuesRowInputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/ValuesRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ValuesRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/ValuesRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/VerticalRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/VerticalRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/VerticalRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/XMLRowOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/XMLRowOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/XMLRowOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/copyData.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/copyData.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/copyData.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/glueBlockInputStreams.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/glueBlockInputStreams.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/glueBlockInputStreams.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/isConvertableTypes.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/isConvertableTypes.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/isConvertableTypes.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/narrowBlockInputStreams.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/narrowBlockInputStreams.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/narrowBlockInputStreams.cpp.o.d"
+  "/root/repo/dbms/src/DataStreams/verbosePrintString.cpp" "dbms/CMakeFiles/dbms.dir/src/DataStreams/verbosePrintString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataStreams/verbosePrintString.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeAggregateFunction.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeAggregateFunction.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeAggregateFunction.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeArray.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeArray.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeArray.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeDate.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeDate.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeDate.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeDateTime.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeDateTime.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeDateTime.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeDictionary.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeEnum.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeEnum.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeEnum.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeExpression.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeExpression.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeExpression.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeFactory.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeFixedString.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeFixedString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeFixedString.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeNested.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNested.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNested.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeNull.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNull.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNull.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeNullable.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNullable.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNullable.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeNumberBase.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNumberBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeNumberBase.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeString.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeString.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeTraits.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeTraits.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeTraits.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeTuple.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeTuple.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeTuple.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypeUUID.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeUUID.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypeUUID.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/DataTypesNumber.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypesNumber.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/DataTypesNumber.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/FieldToDataType.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/FieldToDataType.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/FieldToDataType.cpp.o.d"
+  "/root/repo/dbms/src/DataTypes/IDataType.cpp" "dbms/CMakeFiles/dbms.dir/src/DataTypes/IDataType.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/DataTypes/IDataType.cpp.o.d"
+  "/root/repo/dbms/src/Databases/DatabaseDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Databases/DatabaseFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseFactory.cpp.o.d"
+  "/root/repo/dbms/src/Databases/DatabaseMemory.cpp" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseMemory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseMemory.cpp.o.d"
+  "/root/repo/dbms/src/Databases/DatabaseOrdinary.cpp" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseOrdinary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabaseOrdinary.cpp.o.d"
+  "/root/repo/dbms/src/Databases/DatabasesCommon.cpp" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabasesCommon.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Databases/DatabasesCommon.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/CacheDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/CacheDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/CacheDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ClickHouseDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ClickHouseDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ClickHouseDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ComplexKeyCacheDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ComplexKeyCacheDictionary_generate1.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate1.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate1.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ComplexKeyCacheDictionary_generate2.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate2.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate2.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ComplexKeyCacheDictionary_generate3.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate3.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate3.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ComplexKeyHashedDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyHashedDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyHashedDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/DictionaryBlockInputStreamBase.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionaryBlockInputStreamBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionaryBlockInputStreamBase.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/DictionarySnapshot.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionarySnapshot.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionarySnapshot.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/DictionarySourceFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceFactory.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/DictionarySourceHelpers.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceHelpers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceHelpers.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/DictionaryStructure.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionaryStructure.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/DictionaryStructure.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/Embedded/RegionsHierarchies.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchies.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchies.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/Embedded/RegionsHierarchy.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchy.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchy.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/Embedded/RegionsNames.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsNames.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsNames.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/Embedded/TechDataHierarchy.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/TechDataHierarchy.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/Embedded/TechDataHierarchy.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ExecutableDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ExecutableDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ExecutableDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ExternalQueryBuilder.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ExternalQueryBuilder.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ExternalQueryBuilder.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ExternalResultDescription.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ExternalResultDescription.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ExternalResultDescription.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/FileDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/FileDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/FileDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/FlatDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/FlatDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/FlatDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/HTTPDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/HTTPDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/HTTPDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/HashedDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/HashedDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/HashedDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/LibraryDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/LibraryDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/LibraryDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/MongoDBBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MongoDBBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MongoDBBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/MongoDBDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MongoDBDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MongoDBDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/MySQLBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MySQLBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MySQLBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/MySQLDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MySQLDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/MySQLDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ODBCBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ODBCBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ODBCBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/ODBCDictionarySource.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ODBCDictionarySource.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/ODBCDictionarySource.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/RangeHashedDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/RangeHashedDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/RangeHashedDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/TrieDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/TrieDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/TrieDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/readInvalidateQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/readInvalidateQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/readInvalidateQuery.cpp.o.d"
+  "/root/repo/dbms/src/Dictionaries/writeParenthesisedString.cpp" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/writeParenthesisedString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Dictionaries/writeParenthesisedString.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Functions/FunctionFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Functions/FunctionFactory.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionHelpers.cpp" "dbms/CMakeFiles/dbms.dir/src/Functions/FunctionHelpers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Functions/FunctionHelpers.cpp.o.d"
+  "/root/repo/dbms/src/Functions/IFunction.cpp" "dbms/CMakeFiles/dbms.dir/src/Functions/IFunction.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Functions/IFunction.cpp.o.d"
+  "/root/repo/dbms/src/IO/CachedCompressedReadBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/CachedCompressedReadBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/CachedCompressedReadBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/CascadeWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/CascadeWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/CascadeWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/CompressedReadBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedReadBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedReadBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/CompressedReadBufferBase.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedReadBufferBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedReadBufferBase.cpp.o.d"
+  "/root/repo/dbms/src/IO/CompressedReadBufferFromFile.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedReadBufferFromFile.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedReadBufferFromFile.cpp.o.d"
+  "/root/repo/dbms/src/IO/CompressedWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/CompressedWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/HTTPCommon.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/HTTPCommon.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/HTTPCommon.cpp.o.d"
+  "/root/repo/dbms/src/IO/HTTPSessionPool.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/HTTPSessionPool.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/HTTPSessionPool.cpp.o.d"
+  "/root/repo/dbms/src/IO/HashingWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/HashingWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/HashingWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/HexWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/HexWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/HexWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/InterserverWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/InterserverWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/InterserverWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/LimitReadBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/LimitReadBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/LimitReadBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/MMapReadBufferFromFile.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/MMapReadBufferFromFile.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/MMapReadBufferFromFile.cpp.o.d"
+  "/root/repo/dbms/src/IO/MemoryReadWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/MemoryReadWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/MemoryReadWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadBufferAIO.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferAIO.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferAIO.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadBufferFromFile.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromFile.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromFile.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadBufferFromFileBase.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileBase.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadBufferFromFileDescriptor.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileDescriptor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileDescriptor.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadBufferFromPocoSocket.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromPocoSocket.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadBufferFromPocoSocket.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadHelpers.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadHelpers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadHelpers.cpp.o.d"
+  "/root/repo/dbms/src/IO/ReadWriteBufferFromHTTP.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ReadWriteBufferFromHTTP.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ReadWriteBufferFromHTTP.cpp.o.d"
+  "/root/repo/dbms/src/IO/UncompressedCachePrefetcher.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/UncompressedCachePrefetcher.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/UncompressedCachePrefetcher.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferAIO.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferAIO.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferAIO.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferFromFile.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromFile.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromFile.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferFromFileBase.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileBase.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferFromFileDescriptor.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileDescriptor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileDescriptor.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferFromHTTPServerResponse.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromHTTPServerResponse.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromHTTPServerResponse.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferFromPocoSocket.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromPocoSocket.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromPocoSocket.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferFromTemporaryFile.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromTemporaryFile.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferFromTemporaryFile.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteBufferValidUTF8.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferValidUTF8.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteBufferValidUTF8.cpp.o.d"
+  "/root/repo/dbms/src/IO/WriteHelpers.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/WriteHelpers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/WriteHelpers.cpp.o.d"
+  "/root/repo/dbms/src/IO/ZlibDeflatingWriteBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ZlibDeflatingWriteBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ZlibDeflatingWriteBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/ZlibInflatingReadBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/ZlibInflatingReadBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/ZlibInflatingReadBuffer.cpp.o.d"
+  "/root/repo/dbms/src/IO/copyData.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/copyData.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/copyData.cpp.o.d"
+  "/root/repo/dbms/src/IO/createReadBufferFromFileBase.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/createReadBufferFromFileBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/createReadBufferFromFileBase.cpp.o.d"
+  "/root/repo/dbms/src/IO/createWriteBufferFromFileBase.cpp" "dbms/CMakeFiles/dbms.dir/src/IO/createWriteBufferFromFileBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/IO/createWriteBufferFromFileBase.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Aggregator.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Aggregator.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Aggregator.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/AsynchronousMetrics.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/AsynchronousMetrics.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/AsynchronousMetrics.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ClientInfo.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClientInfo.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClientInfo.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Cluster.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Cluster.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Cluster.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ClusterProxy/AlterStreamFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/AlterStreamFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/AlterStreamFactory.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ClusterProxy/DescribeStreamFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/DescribeStreamFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/DescribeStreamFactory.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ClusterProxy/SelectStreamFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/SelectStreamFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/SelectStreamFactory.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ClusterProxy/executeQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/executeQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/executeQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Compiler.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Compiler.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Compiler.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Context.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Context.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Context.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/DDLWorker.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/DDLWorker.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/DDLWorker.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/DNSCache.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/DNSCache.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/DNSCache.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/DictionaryFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/DictionaryFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/DictionaryFactory.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/EmbeddedDictionaries.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/EmbeddedDictionaries.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/EmbeddedDictionaries.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ExpressionActions.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ExpressionActions.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ExpressionActions.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ExpressionAnalyzer.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ExpressionAnalyzer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ExpressionAnalyzer.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ExternalDictionaries.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ExternalDictionaries.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ExternalDictionaries.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InJoinSubqueriesPreprocessor.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InJoinSubqueriesPreprocessor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InJoinSubqueriesPreprocessor.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterAlterQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterAlterQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterAlterQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterCheckQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterCheckQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterCheckQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterCreateQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterCreateQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterCreateQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterDescribeQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterDescribeQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterDescribeQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterDropQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterDropQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterDropQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterExistsQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterExistsQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterExistsQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterExplainQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterExplainQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterExplainQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterFactory.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterInsertQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterInsertQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterInsertQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterKillQueryQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterKillQueryQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterKillQueryQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterOptimizeQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterOptimizeQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterOptimizeQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterRenameQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterRenameQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterRenameQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterSelectQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterSelectQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterSelectQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterSetQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterSetQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterSetQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterShowCreateQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowCreateQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowCreateQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterShowProcesslistQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowProcesslistQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowProcesslistQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterShowTablesQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowTablesQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowTablesQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterSystemQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterSystemQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterSystemQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/InterpreterUseQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterUseQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/InterpreterUseQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Join.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Join.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Join.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/LogicalExpressionsOptimizer.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/LogicalExpressionsOptimizer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/LogicalExpressionsOptimizer.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/MetricsHistory.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/MetricsHistory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/MetricsHistory.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/NullableUtils.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/NullableUtils.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/NullableUtils.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/PartLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/PartLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/PartLog.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/ProcessList.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ProcessList.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/ProcessList.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/QueryLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/QueryLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/QueryLog.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Quota.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Quota.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Quota.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Set.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Set.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Set.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/SetVariants.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/SetVariants.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/SetVariants.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Settings.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Settings.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Settings.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/SystemLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/SystemLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/SystemLog.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/TablesStatus.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/TablesStatus.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/TablesStatus.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/TraceCollector.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/TraceCollector.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/TraceCollector.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/TraceLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/TraceLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/TraceLog.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/Users.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Users.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/Users.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/convertFieldToType.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/convertFieldToType.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/convertFieldToType.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/createBlockSelector.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/createBlockSelector.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/createBlockSelector.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/evaluateConstantExpression.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/evaluateConstantExpression.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/evaluateConstantExpression.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/evaluateMissingDefaults.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/evaluateMissingDefaults.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/evaluateMissingDefaults.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/executeQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/executeQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/executeQuery.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/getClusterName.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/getClusterName.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/getClusterName.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/loadMetadata.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/loadMetadata.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/loadMetadata.cpp.o.d"
+  "/root/repo/dbms/src/Interpreters/sortBlock.cpp" "dbms/CMakeFiles/dbms.dir/src/Interpreters/sortBlock.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Interpreters/sortBlock.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTAlterQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTAlterQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTAlterQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTExpressionList.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTExpressionList.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTExpressionList.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTFunction.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTFunction.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTFunction.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTIdentifier.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTIdentifier.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTIdentifier.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTInsertQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTInsertQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTInsertQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTKillQueryQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTKillQueryQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTKillQueryQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTLiteral.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTLiteral.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTLiteral.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTOrderByElement.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTOrderByElement.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTOrderByElement.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTPartition.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTPartition.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTPartition.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTQualifiedAsterisk.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTQualifiedAsterisk.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTQualifiedAsterisk.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTQueryWithOnCluster.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOnCluster.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOnCluster.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTQueryWithOutput.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOutput.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOutput.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTSampleRatio.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSampleRatio.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSampleRatio.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTSelectQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSelectQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSelectQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTSubquery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSubquery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSubquery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTSystemQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSystemQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTSystemQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTTablesInSelectQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTTablesInSelectQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTTablesInSelectQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ASTWithAlias.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTWithAlias.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ASTWithAlias.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/CommonParsers.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/CommonParsers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/CommonParsers.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ExpressionElementParsers.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ExpressionElementParsers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ExpressionElementParsers.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ExpressionListParsers.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ExpressionListParsers.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ExpressionListParsers.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/IAST.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/IAST.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/IAST.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/IParserBase.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/IParserBase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/IParserBase.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/Lexer.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/Lexer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/Lexer.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserAlterQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserAlterQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserAlterQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserCase.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserCase.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserCase.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserCheckQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserCheckQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserCheckQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserCreateQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserCreateQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserCreateQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserDropQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserDropQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserDropQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserExplainQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserExplainQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserExplainQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserInsertQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserInsertQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserInsertQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserKillQueryQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserKillQueryQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserKillQueryQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserOptimizeQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserOptimizeQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserOptimizeQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserPartition.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserPartition.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserPartition.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserQueryWithOutput.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserQueryWithOutput.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserQueryWithOutput.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserRenameQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserRenameQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserRenameQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserSampleRatio.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSampleRatio.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSampleRatio.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserSelectQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSelectQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSelectQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserSetQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSetQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSetQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserShowTablesQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserShowTablesQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserShowTablesQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserSystemQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSystemQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserSystemQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserTablePropertiesQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserTablePropertiesQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserTablePropertiesQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserTablesInSelectQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserTablesInSelectQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserTablesInSelectQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/ParserUseQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserUseQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/ParserUseQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/TokenIterator.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/TokenIterator.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/TokenIterator.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/formatAST.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/formatAST.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/formatAST.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/parseQuery.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/parseQuery.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/parseQuery.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/queryToString.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/queryToString.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/queryToString.cpp.o.d"
+  "/root/repo/dbms/src/Parsers/substituteQueryParameters.cpp" "dbms/CMakeFiles/dbms.dir/src/Parsers/substituteQueryParameters.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Parsers/substituteQueryParameters.cpp.o.d"
+  "/root/repo/dbms/src/Storages/AlterCommands.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/AlterCommands.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/AlterCommands.cpp.o.d"
+  "/root/repo/dbms/src/Storages/ColumnDefault.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/ColumnDefault.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/ColumnDefault.cpp.o.d"
+  "/root/repo/dbms/src/Storages/ColumnsDescription.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/ColumnsDescription.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/ColumnsDescription.cpp.o.d"
+  "/root/repo/dbms/src/Storages/Distributed/DirectoryMonitor.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/Distributed/DirectoryMonitor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/Distributed/DirectoryMonitor.cpp.o.d"
+  "/root/repo/dbms/src/Storages/Distributed/DistributedBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/Distributed/DistributedBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/Distributed/DistributedBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/IStorage.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/IStorage.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/IStorage.cpp.o.d"
+  "/root/repo/dbms/src/Storages/ITableDeclaration.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/ITableDeclaration.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/ITableDeclaration.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MarkCacheWarmer.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MarkCacheWarmer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MarkCacheWarmer.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ActiveDataPartSet.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ActiveDataPartSet.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ActiveDataPartSet.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/AllMergeSelector.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/AllMergeSelector.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/AllMergeSelector.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/BackgroundProcessingPool.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/BackgroundProcessingPool.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/BackgroundProcessingPool.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/DataPartsExchange.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/DataPartsExchange.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/DataPartsExchange.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/DiskSpaceMonitor.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/DiskSpaceMonitor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/DiskSpaceMonitor.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/LevelMergeSelector.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/LevelMergeSelector.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/LevelMergeSelector.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeList.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeList.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeList.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeScheduler.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeScheduler.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeScheduler.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeBaseBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBaseBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBaseBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeBlockReadUtils.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockReadUtils.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockReadUtils.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeData.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeData.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeData.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeDataMerger.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataMerger.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataMerger.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeDataPart.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataPart.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataPart.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeDataSelectExecutor.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataSelectExecutor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataSelectExecutor.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeDataWriter.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataWriter.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataWriter.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreePartChecker.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartChecker.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartChecker.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreePartInfo.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartInfo.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartInfo.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreePartScrubber.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartScrubber.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartScrubber.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreePartition.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartition.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartition.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreePrimaryIndex.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePrimaryIndex.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePrimaryIndex.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeRangeReader.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeRangeReader.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeRangeReader.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeReadPool.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReadPool.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReadPool.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeReader.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReader.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReader.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeSharder.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeSharder.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeSharder.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeThreadBlockInputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeThreadBlockInputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeThreadBlockInputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergeTreeWhereOptimizer.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeWhereOptimizer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeWhereOptimizer.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/MergedBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergedBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/MergedBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/PKCondition.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/PKCondition.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/PKCondition.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/PartCommitter.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/PartCommitter.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/PartCommitter.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/RemoteDiskSpaceMonitor.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteDiskSpaceMonitor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteDiskSpaceMonitor.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/RemotePartChecker.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/RemotePartChecker.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/RemotePartChecker.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/RemoteQueryExecutor.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteQueryExecutor.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteQueryExecutor.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreeAlterThread.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeAlterThread.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeAlterThread.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreeCleanupThread.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeCleanupThread.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeCleanupThread.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreeLogEntry.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeLogEntry.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeLogEntry.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreePartCheckThread.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreePartCheckThread.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreePartCheckThread.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreeQueue.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeQueue.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeQueue.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReplicatedMergeTreeRestartingThread.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeRestartingThread.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeRestartingThread.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReshardingJob.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingJob.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingJob.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ReshardingWorker.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingWorker.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingWorker.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/ShardedPartitionUploader.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ShardedPartitionUploader.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/ShardedPartitionUploader.cpp.o.d"
+  "/root/repo/dbms/src/Storages/MergeTree/SimpleMergeSelector.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/SimpleMergeSelector.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/MergeTree/SimpleMergeSelector.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageBuffer.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageDictionary.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageDictionary.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageDictionary.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageDistributed.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageDistributed.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageDistributed.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageFactory.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageFile.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageFile.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageFile.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageGenerateRandom.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageGenerateRandom.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageGenerateRandom.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageJoin.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageJoin.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageJoin.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageLog.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageMaterializedView.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMaterializedView.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMaterializedView.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageMemory.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMemory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMemory.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageMerge.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMerge.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMerge.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageMergeTree.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMergeTree.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageMergeTree.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageReplicatedMergeTree.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageReplicatedMergeTree.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageReplicatedMergeTree.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageSet.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageSet.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageSet.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageStripeLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageStripeLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageStripeLog.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageTinyLog.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageTinyLog.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageTinyLog.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageTrivialBuffer.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageTrivialBuffer.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageTrivialBuffer.cpp.o.d"
+  "/root/repo/dbms/src/Storages/StorageView.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageView.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/StorageView.cpp.o.d"
+  "/root/repo/dbms/src/Storages/VirtualColumnFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/Storages/VirtualColumnFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/Storages/VirtualColumnFactory.cpp.o.d"
+  "/root/repo/dbms/src/TableFunctions/TableFunctionFactory.cpp" "dbms/CMakeFiles/dbms.dir/src/TableFunctions/TableFunctionFactory.cpp.o" "gcc" "dbms/CMakeFiles/dbms.dir/src/TableFunctions/TableFunctionFactory.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/libs/libcommon/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libfarmhash/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libmetrohash/CMakeFiles/metrohash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/liblz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/dbms/CMakeFiles/string_utils.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcpuid/CMakeFiles/cpuid.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2_st.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_system_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Data/CMakeFiles/PocoData.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libbtrie/CMakeFiles/btrie.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libpocoext/CMakeFiles/pocoext.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcityhash/CMakeFiles/cityhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcctz/CMakeFiles/cctz.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libmemcpy/CMakeFiles/memcpy.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,897 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionArray.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionArray.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionCount.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionCount.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionForEach.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionForEach.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionIf.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionIf.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionMerge.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionMerge.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionNull.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionNull.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionState.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/AggregateFunctionState.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/parseAggregateFunctionParameters.cpp.o"
+  "CMakeFiles/dbms.dir/src/AggregateFunctions/parseAggregateFunctionParameters.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/AnalyzeColumns.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/AnalyzeColumns.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/AnalyzeLambdas.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/AnalyzeLambdas.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/AnalyzeResultOfQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/AnalyzeResultOfQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/CollectAliases.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/CollectAliases.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/CollectTables.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/CollectTables.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/ExecuteTableFunctions.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/ExecuteTableFunctions.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/OptimizeGroupOrderLimitBy.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/OptimizeGroupOrderLimitBy.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/TranslatePositionalArguments.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/TranslatePositionalArguments.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Analyzers/TypeAndConstantInference.cpp.o"
+  "CMakeFiles/dbms.dir/src/Analyzers/TypeAndConstantInference.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Client/Connection.cpp.o"
+  "CMakeFiles/dbms.dir/src/Client/Connection.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Client/ConnectionPoolWithFailover.cpp.o"
+  "CMakeFiles/dbms.dir/src/Client/ConnectionPoolWithFailover.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Client/MultiplexedConnections.cpp.o"
+  "CMakeFiles/dbms.dir/src/Client/MultiplexedConnections.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnAggregateFunction.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnAggregateFunction.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnArray.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnArray.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnConst.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnConst.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnExpression.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnExpression.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnFixedString.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnFixedString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnLazy.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnLazy.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnNullable.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnNullable.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnString.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnTuple.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnTuple.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnVector.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnVector.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnsCommon.cpp.o"
+  "CMakeFiles/dbms.dir/src/Columns/ColumnsCommon.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/Allocator.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/Allocator.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ArenaChunkPool.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ArenaChunkPool.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ClickHouseRevision.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ClickHouseRevision.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/Collator.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/Collator.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ConfigProcessor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ConfigProcessor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/CurrentMetrics.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/CurrentMetrics.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/Exception.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/Exception.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/FileChecker.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/FileChecker.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/GlobalWorkPool.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/GlobalWorkPool.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/HardwareCounters.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/HardwareCounters.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/Macros.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/Macros.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/MemoryTracker.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/MemoryTracker.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/NUMAAwareness.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/NUMAAwareness.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/NameInterner.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/NameInterner.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ProfileEvents.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ProfileEvents.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/QueryProfiler.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/QueryProfiler.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/RWLockFIFO.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/RWLockFIFO.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/SharedLibrary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/SharedLibrary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ShellCommand.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ShellCommand.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/StackTrace.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/StackTrace.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/VirtualColumnUtils.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/VirtualColumnUtils.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/Lock.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/Lock.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/RWLock.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/RWLock.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/SingleBarrier.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/SingleBarrier.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeper.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeper.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperHolder.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperHolder.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperNodeCache.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/ZooKeeper/ZooKeeperNodeCache.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/config_build.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/config_build.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/escapeForFileName.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/escapeForFileName.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/formatIPv6.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/formatIPv6.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/formatReadable.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/formatReadable.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/getFQDNOrHostName.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/getFQDNOrHostName.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/getMultipleKeysFromConfig.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/getMultipleKeysFromConfig.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/getNumberOfPhysicalCPUCores.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/getNumberOfPhysicalCPUCores.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/hex.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/hex.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/iostream_debug_helpers.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/iostream_debug_helpers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/isLocalAddress.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/isLocalAddress.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/localBackup.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/localBackup.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/randomSeed.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/randomSeed.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Common/setThreadName.cpp.o"
+  "CMakeFiles/dbms.dir/src/Common/setThreadName.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/Block.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/Block.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/BlockInfo.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/BlockInfo.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/ColumnWithTypeAndName.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/ColumnWithTypeAndName.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/ErrorCodes.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/ErrorCodes.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/Field.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/Field.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/FieldVisitors.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/FieldVisitors.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/NamesAndTypes.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/NamesAndTypes.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/Progress.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/Progress.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Core/SortDescription.cpp.o"
+  "CMakeFiles/dbms.dir/src/Core/SortDescription.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/AdaptiveFilterBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/AdaptiveFilterBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/AddingDefaultBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/AddingDefaultBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/AggregatingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/AggregatingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/AggregatingInOrderBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/AggregatingInOrderBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/AggregatingSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/AggregatingSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ApproximateTopKBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ApproximateTopKBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/BinaryRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/BinaryRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/BinaryRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/BinaryRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockIO.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockIO.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockInputStreamFromRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockInputStreamFromRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockOutputStreamFromRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockOutputStreamFromRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockStreamProfileInfo.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/BlockStreamProfileInfo.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CSVRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CSVRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CSVRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CSVRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CastTypeBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CastTypeBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CollapsingFinalBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CollapsingFinalBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CollapsingSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CollapsingSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ColumnGathererStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ColumnGathererStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CountingBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CountingBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/CreatingSetsBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/CreatingSetsBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/DistinctBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/DistinctBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/DistinctOrderedLimitBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/DistinctOrderedLimitBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/DistinctSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/DistinctSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ExpressionBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ExpressionBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/FilterBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/FilterBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/FilterColumnsBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/FilterColumnsBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/FormatFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/FormatFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/GraphiteRollupSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/GraphiteRollupSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/IBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/IBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/IProfilingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/IProfilingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/IRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/IRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/IRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/IRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/InputStreamFromASTInsertQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/InputStreamFromASTInsertQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONCompactRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONCompactRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONEachRowRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/JSONRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/LimitBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/LimitBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/LimitByBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/LimitByBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/MaterializingBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergeSortingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergeSortingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedMemoryEfficientBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergingAggregatedMemoryEfficientBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergingSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/MergingSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/NativeBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/NativeBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/NativeBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/NativeBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/NullableAdapterBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/NullableAdapterBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ODBCDriverBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ODBCDriverBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelAggregatingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelAggregatingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelFormattingBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelFormattingBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelParsingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelParsingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelizingBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ParallelizingBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/PartialSortingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/PartialSortingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/PrettyBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/PrettyBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/PrettyCompactBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/PrettyCompactBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/PrettySpaceBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/PrettySpaceBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ProhibitColumnsBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ProhibitColumnsBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/RemoteBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ReplacingSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ReplacingSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/SquashingBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/SquashingTransform.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/SquashingTransform.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/SummingSortedBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/SummingSortedBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/TSKVRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/TSKVRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/TSKVRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/TSKVRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/TabSeparatedRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/TotalsHavingBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/TotalsHavingBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ValuesRowInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ValuesRowInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/ValuesRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/ValuesRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/VerticalRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/VerticalRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/XMLRowOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/XMLRowOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/copyData.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/copyData.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/glueBlockInputStreams.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/glueBlockInputStreams.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/isConvertableTypes.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/isConvertableTypes.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/narrowBlockInputStreams.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/narrowBlockInputStreams.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataStreams/verbosePrintString.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataStreams/verbosePrintString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeAggregateFunction.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeAggregateFunction.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeArray.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeArray.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeDate.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeDate.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeDateTime.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeDateTime.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeEnum.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeEnum.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeExpression.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeExpression.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeFixedString.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeFixedString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNested.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNested.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNull.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNull.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNullable.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNullable.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNumberBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeNumberBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeString.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeTraits.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeTraits.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeTuple.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeTuple.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeUUID.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypeUUID.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypesNumber.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/DataTypesNumber.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/FieldToDataType.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/FieldToDataType.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/DataTypes/IDataType.cpp.o"
+  "CMakeFiles/dbms.dir/src/DataTypes/IDataType.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseMemory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseMemory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseOrdinary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Databases/DatabaseOrdinary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Databases/DatabasesCommon.cpp.o"
+  "CMakeFiles/dbms.dir/src/Databases/DatabasesCommon.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/CacheDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/CacheDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ClickHouseDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ClickHouseDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate1.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate1.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate2.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate2.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate3.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyCacheDictionary_generate3.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyHashedDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ComplexKeyHashedDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionaryBlockInputStreamBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionaryBlockInputStreamBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionarySnapshot.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionarySnapshot.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceHelpers.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionarySourceHelpers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionaryStructure.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/DictionaryStructure.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchies.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchies.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchy.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsHierarchy.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsNames.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/RegionsNames.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/TechDataHierarchy.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/Embedded/TechDataHierarchy.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ExecutableDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ExecutableDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ExternalQueryBuilder.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ExternalQueryBuilder.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ExternalResultDescription.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ExternalResultDescription.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/FileDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/FileDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/FlatDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/FlatDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/HTTPDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/HTTPDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/HashedDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/HashedDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/LibraryDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/LibraryDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MongoDBBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MongoDBBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MongoDBDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MongoDBDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MySQLBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MySQLBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MySQLDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/MySQLDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ODBCBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ODBCBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ODBCDictionarySource.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/ODBCDictionarySource.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/RangeHashedDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/RangeHashedDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/TrieDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/TrieDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/readInvalidateQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/readInvalidateQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Dictionaries/writeParenthesisedString.cpp.o"
+  "CMakeFiles/dbms.dir/src/Dictionaries/writeParenthesisedString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Functions/FunctionFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Functions/FunctionFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Functions/FunctionHelpers.cpp.o"
+  "CMakeFiles/dbms.dir/src/Functions/FunctionHelpers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Functions/IFunction.cpp.o"
+  "CMakeFiles/dbms.dir/src/Functions/IFunction.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/CachedCompressedReadBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/CachedCompressedReadBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/CascadeWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/CascadeWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/CompressedReadBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/CompressedReadBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/CompressedReadBufferBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/CompressedReadBufferBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/CompressedReadBufferFromFile.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/CompressedReadBufferFromFile.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/CompressedWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/CompressedWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/HTTPCommon.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/HTTPCommon.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/HTTPSessionPool.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/HTTPSessionPool.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/HashingWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/HashingWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/HexWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/HexWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/InterserverWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/InterserverWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/LimitReadBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/LimitReadBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/MMapReadBufferFromFile.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/MMapReadBufferFromFile.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/MemoryReadWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/MemoryReadWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferAIO.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferAIO.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromFile.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromFile.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileDescriptor.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromFileDescriptor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromPocoSocket.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadBufferFromPocoSocket.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadHelpers.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadHelpers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ReadWriteBufferFromHTTP.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ReadWriteBufferFromHTTP.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/UncompressedCachePrefetcher.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/UncompressedCachePrefetcher.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferAIO.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferAIO.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromFile.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromFile.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileDescriptor.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromFileDescriptor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromHTTPServerResponse.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromHTTPServerResponse.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromPocoSocket.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromPocoSocket.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromTemporaryFile.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferFromTemporaryFile.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferValidUTF8.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteBufferValidUTF8.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/WriteHelpers.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/WriteHelpers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ZlibDeflatingWriteBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ZlibDeflatingWriteBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/ZlibInflatingReadBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/ZlibInflatingReadBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/copyData.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/copyData.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/createReadBufferFromFileBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/createReadBufferFromFileBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/IO/createWriteBufferFromFileBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/IO/createWriteBufferFromFileBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Aggregator.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Aggregator.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/AsynchronousMetrics.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/AsynchronousMetrics.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClientInfo.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClientInfo.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Cluster.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Cluster.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/AlterStreamFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/AlterStreamFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/DescribeStreamFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/DescribeStreamFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/SelectStreamFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/SelectStreamFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/executeQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ClusterProxy/executeQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Compiler.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Compiler.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Context.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Context.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/DDLWorker.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/DDLWorker.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/DNSCache.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/DNSCache.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/DictionaryFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/DictionaryFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/EmbeddedDictionaries.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/EmbeddedDictionaries.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ExpressionActions.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ExpressionActions.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ExpressionAnalyzer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ExpressionAnalyzer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ExternalDictionaries.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ExternalDictionaries.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InJoinSubqueriesPreprocessor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InJoinSubqueriesPreprocessor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterAlterQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterAlterQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterCheckQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterCheckQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterCreateQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterCreateQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterDescribeQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterDescribeQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterDropQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterDropQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterExistsQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterExistsQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterExplainQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterExplainQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterInsertQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterInsertQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterKillQueryQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterKillQueryQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterOptimizeQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterOptimizeQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterRenameQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterRenameQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterSelectQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterSelectQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterSetQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterSetQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowCreateQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowCreateQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowProcesslistQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowProcesslistQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowTablesQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterShowTablesQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterSystemQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterSystemQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterUseQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/InterpreterUseQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Join.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Join.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/LogicalExpressionsOptimizer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/LogicalExpressionsOptimizer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/MetricsHistory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/MetricsHistory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/NullableUtils.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/NullableUtils.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/PartLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/PartLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/ProcessList.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/ProcessList.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/QueryLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/QueryLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Quota.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Quota.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Set.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Set.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/SetVariants.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/SetVariants.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Settings.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Settings.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/SystemLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/SystemLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/TablesStatus.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/TablesStatus.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/TraceCollector.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/TraceCollector.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/TraceLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/TraceLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/Users.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/Users.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/convertFieldToType.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/convertFieldToType.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/createBlockSelector.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/createBlockSelector.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/evaluateConstantExpression.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/evaluateConstantExpression.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/evaluateMissingDefaults.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/evaluateMissingDefaults.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/executeQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/executeQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/getClusterName.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/getClusterName.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/loadMetadata.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/loadMetadata.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Interpreters/sortBlock.cpp.o"
+  "CMakeFiles/dbms.dir/src/Interpreters/sortBlock.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTAlterQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTAlterQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTExpressionList.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTExpressionList.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTFunction.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTFunction.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTIdentifier.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTIdentifier.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTInsertQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTInsertQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTKillQueryQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTKillQueryQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTLiteral.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTLiteral.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTOrderByElement.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTOrderByElement.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTPartition.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTPartition.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTQualifiedAsterisk.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTQualifiedAsterisk.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOnCluster.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOnCluster.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOutput.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTQueryWithOutput.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSampleRatio.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSampleRatio.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSelectQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSelectQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSubquery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSubquery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSystemQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTSystemQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTTablesInSelectQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTTablesInSelectQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTWithAlias.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ASTWithAlias.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/CommonParsers.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/CommonParsers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ExpressionElementParsers.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ExpressionElementParsers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ExpressionListParsers.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ExpressionListParsers.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/IAST.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/IAST.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/IParserBase.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/IParserBase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/Lexer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/Lexer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserAlterQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserAlterQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserCase.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserCase.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserCheckQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserCheckQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserCreateQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserCreateQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserDropQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserDropQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserExplainQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserExplainQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserInsertQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserInsertQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserKillQueryQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserKillQueryQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserOptimizeQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserOptimizeQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserPartition.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserPartition.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserQueryWithOutput.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserQueryWithOutput.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserRenameQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserRenameQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSampleRatio.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSampleRatio.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSelectQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSelectQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSetQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSetQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserShowTablesQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserShowTablesQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSystemQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserSystemQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserTablePropertiesQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserTablePropertiesQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserTablesInSelectQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserTablesInSelectQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserUseQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/ParserUseQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/TokenIterator.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/TokenIterator.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/formatAST.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/formatAST.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/parseQuery.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/parseQuery.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/queryToString.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/queryToString.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Parsers/substituteQueryParameters.cpp.o"
+  "CMakeFiles/dbms.dir/src/Parsers/substituteQueryParameters.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/AlterCommands.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/AlterCommands.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/ColumnDefault.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/ColumnDefault.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/ColumnsDescription.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/ColumnsDescription.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/Distributed/DirectoryMonitor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/Distributed/DirectoryMonitor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/Distributed/DistributedBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/Distributed/DistributedBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/IStorage.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/IStorage.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/ITableDeclaration.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/ITableDeclaration.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MarkCacheWarmer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MarkCacheWarmer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ActiveDataPartSet.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ActiveDataPartSet.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/AllMergeSelector.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/AllMergeSelector.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/BackgroundProcessingPool.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/BackgroundProcessingPool.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/DataPartsExchange.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/DataPartsExchange.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/DiskSpaceMonitor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/DiskSpaceMonitor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/LevelMergeSelector.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/LevelMergeSelector.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeList.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeList.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeScheduler.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeScheduler.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBaseBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBaseBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockReadUtils.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeBlockReadUtils.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeData.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeData.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataMerger.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataMerger.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataPart.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataPart.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataSelectExecutor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataSelectExecutor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataWriter.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeDataWriter.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartChecker.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartChecker.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartInfo.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartInfo.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartScrubber.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartScrubber.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartition.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePartition.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePrimaryIndex.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreePrimaryIndex.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeRangeReader.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeRangeReader.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReadPool.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReadPool.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReader.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeReader.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeSharder.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeSharder.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeThreadBlockInputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeThreadBlockInputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeWhereOptimizer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergeTreeWhereOptimizer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergedBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/MergedBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/PKCondition.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/PKCondition.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/PartCommitter.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/PartCommitter.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteDiskSpaceMonitor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteDiskSpaceMonitor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/RemotePartChecker.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/RemotePartChecker.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteQueryExecutor.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/RemoteQueryExecutor.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeAlterThread.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeAlterThread.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeCleanupThread.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeCleanupThread.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeLogEntry.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeLogEntry.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreePartCheckThread.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreePartCheckThread.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeQueue.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeQueue.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeRestartingThread.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReplicatedMergeTreeRestartingThread.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingJob.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingJob.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingWorker.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ReshardingWorker.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ShardedPartitionUploader.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/ShardedPartitionUploader.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/SimpleMergeSelector.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/MergeTree/SimpleMergeSelector.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageDictionary.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageDictionary.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageDistributed.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageDistributed.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageFile.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageFile.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageGenerateRandom.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageGenerateRandom.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageJoin.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageJoin.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMaterializedView.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMaterializedView.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMemory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMemory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMerge.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMerge.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMergeTree.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageMergeTree.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageReplicatedMergeTree.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageReplicatedMergeTree.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageSet.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageSet.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageStripeLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageStripeLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageTinyLog.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageTinyLog.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageTrivialBuffer.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageTrivialBuffer.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/StorageView.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/StorageView.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/Storages/VirtualColumnFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/Storages/VirtualColumnFactory.cpp.o.d"
+  "CMakeFiles/dbms.dir/src/TableFunctions/TableFunctionFactory.cpp.o"
+  "CMakeFiles/dbms.dir/src/TableFunctions/TableFunctionFactory.cpp.o.d"
+  "libdbms.a"
+  "libdbms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dbms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/string_utils.dir/src/Common/StringUtils.cpp.o"
+  "CMakeFiles/string_utils.dir/src/Common/StringUtils.cpp.o.d"
+  "libstring_utils.a"
+  "libstring_utils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libstring_utils.a"
+)
@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dbms/src/Common/tests/gtest_rw_lock_fifo.cpp.cpp" "dbms/CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_rw_lock_fifo.cpp.cpp.o" "gcc" "dbms/CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_rw_lock_fifo.cpp.cpp.o.d"
+  "/root/repo/dbms/src/Common/tests/gtest_unescapeForFileName.cpp" "dbms/CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_unescapeForFileName.cpp.o" "gcc" "dbms/CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_unescapeForFileName.cpp.o.d"
+  "/root/repo/dbms/src/IO/tests/gtest_cascade_and_memory_write_buffer.cpp" "dbms/CMakeFiles/unit_tests_dbms.dir/src/IO/tests/gtest_cascade_and_memory_write_buffer.cpp.o" "gcc" "dbms/CMakeFiles/unit_tests_dbms.dir/src/IO/tests/gtest_cascade_and_memory_write_buffer.cpp.o.d"
+  "/root/repo/dbms/src/Storages/tests/gtest_row_source_bits_test.cpp" "dbms/CMakeFiles/unit_tests_dbms.dir/src/Storages/tests/gtest_row_source_bits_test.cpp.o" "gcc" "dbms/CMakeFiles/unit_tests_dbms.dir/src/Storages/tests/gtest_row_source_bits_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/dbms/tests/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/dbms/CMakeFiles/dbms.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/dbms/tests/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libcommon/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libpocoext/CMakeFiles/pocoext.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcityhash/CMakeFiles/cityhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcctz/CMakeFiles/cctz.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libmemcpy/CMakeFiles/memcpy.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libfarmhash/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libmetrohash/CMakeFiles/metrohash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/liblz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/dbms/CMakeFiles/string_utils.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcpuid/CMakeFiles/cpuid.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2_st.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_system_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Data/CMakeFiles/PocoData.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libbtrie/CMakeFiles/btrie.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
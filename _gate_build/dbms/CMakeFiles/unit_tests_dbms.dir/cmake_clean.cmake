@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_rw_lock_fifo.cpp.cpp.o"
+  "CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_rw_lock_fifo.cpp.cpp.o.d"
+  "CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_unescapeForFileName.cpp.o"
+  "CMakeFiles/unit_tests_dbms.dir/src/Common/tests/gtest_unescapeForFileName.cpp.o.d"
+  "CMakeFiles/unit_tests_dbms.dir/src/IO/tests/gtest_cascade_and_memory_write_buffer.cpp.o"
+  "CMakeFiles/unit_tests_dbms.dir/src/IO/tests/gtest_cascade_and_memory_write_buffer.cpp.o.d"
+  "CMakeFiles/unit_tests_dbms.dir/src/Storages/tests/gtest_row_source_bits_test.cpp.o"
+  "CMakeFiles/unit_tests_dbms.dir/src/Storages/tests/gtest_row_source_bits_test.cpp.o.d"
+  "unit_tests_dbms"
+  "unit_tests_dbms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_dbms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
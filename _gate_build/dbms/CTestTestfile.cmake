@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms
+# Build directory: /root/repo/_gate_build/dbms
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_unit_tests_dbms "/root/repo/_gate_build/dbms/unit_tests_dbms")
+set_tests_properties(test_unit_tests_dbms PROPERTIES  WORKING_DIRECTORY "/root/repo/dbms" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/dbms/CMakeLists.txt;226;add_check;/root/repo/dbms/CMakeLists.txt;0;")
+subdirs("src")
+subdirs("tests")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionAvg.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionAvg.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionBitwise.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionBitwise.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupArray.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupArray.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupArrayInsertAt.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupArrayInsertAt.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupBitmap.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupBitmap.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupUniqArray.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionGroupUniqArray.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionMinMaxAny.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionMinMaxAny.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantile.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantile.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileDeterministic.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileDeterministic.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileExact.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileExact.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileExactWeighted.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileExactWeighted.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileTDigest.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileTDigest.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileTiming.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionQuantileTiming.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionSequenceMatch.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionSequenceMatch.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionStatistics.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionStatistics.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionSum.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionSum.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionSumMap.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionSumMap.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionTopK.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionTopK.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionUniq.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionUniq.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionUniqUpTo.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/AggregateFunctionUniqUpTo.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/UniqCombinedBiasData.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/UniqCombinedBiasData.cpp.o.d"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/registerAggregateFunctions.cpp.o"
+  "CMakeFiles/clickhouse_aggregate_functions.dir/registerAggregateFunctions.cpp.o.d"
+  "libclickhouse_aggregate_functions.a"
+  "libclickhouse_aggregate_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse_aggregate_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
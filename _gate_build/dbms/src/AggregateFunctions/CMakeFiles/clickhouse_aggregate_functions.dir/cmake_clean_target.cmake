@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libclickhouse_aggregate_functions.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/analyze_columns.dir/analyze_columns.cpp.o"
+  "CMakeFiles/analyze_columns.dir/analyze_columns.cpp.o.d"
+  "analyze_columns"
+  "analyze_columns.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/analyze_columns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/analyze_lambdas.dir/analyze_lambdas.cpp.o"
+  "CMakeFiles/analyze_lambdas.dir/analyze_lambdas.cpp.o.d"
+  "analyze_lambdas"
+  "analyze_lambdas.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/analyze_lambdas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
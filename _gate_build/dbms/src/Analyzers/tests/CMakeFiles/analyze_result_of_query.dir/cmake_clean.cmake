@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/analyze_result_of_query.dir/analyze_result_of_query.cpp.o"
+  "CMakeFiles/analyze_result_of_query.dir/analyze_result_of_query.cpp.o.d"
+  "analyze_result_of_query"
+  "analyze_result_of_query.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/analyze_result_of_query.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/collect_aliases.dir/collect_aliases.cpp.o"
+  "CMakeFiles/collect_aliases.dir/collect_aliases.cpp.o.d"
+  "collect_aliases"
+  "collect_aliases.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collect_aliases.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
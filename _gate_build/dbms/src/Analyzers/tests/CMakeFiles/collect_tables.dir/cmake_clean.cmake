@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/collect_tables.dir/collect_tables.cpp.o"
+  "CMakeFiles/collect_tables.dir/collect_tables.cpp.o.d"
+  "collect_tables"
+  "collect_tables.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collect_tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/optimize_group_order_limit_by.dir/optimize_group_order_limit_by.cpp.o"
+  "CMakeFiles/optimize_group_order_limit_by.dir/optimize_group_order_limit_by.cpp.o.d"
+  "optimize_group_order_limit_by"
+  "optimize_group_order_limit_by.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/optimize_group_order_limit_by.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
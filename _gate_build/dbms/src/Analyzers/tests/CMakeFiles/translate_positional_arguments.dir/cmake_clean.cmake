@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/translate_positional_arguments.dir/translate_positional_arguments.cpp.o"
+  "CMakeFiles/translate_positional_arguments.dir/translate_positional_arguments.cpp.o.d"
+  "translate_positional_arguments"
+  "translate_positional_arguments.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/translate_positional_arguments.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/type_and_constant_inference.dir/type_and_constant_inference.cpp.o"
+  "CMakeFiles/type_and_constant_inference.dir/type_and_constant_inference.cpp.o.d"
+  "type_and_constant_inference"
+  "type_and_constant_inference.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/type_and_constant_inference.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
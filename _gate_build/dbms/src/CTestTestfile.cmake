@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/src
+# Build directory: /root/repo/_gate_build/dbms/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("Columns")
+subdirs("Common")
+subdirs("Core")
+subdirs("DataStreams")
+subdirs("DataTypes")
+subdirs("Dictionaries")
+subdirs("Storages")
+subdirs("Parsers")
+subdirs("IO")
+subdirs("Functions")
+subdirs("Interpreters")
+subdirs("AggregateFunctions")
+subdirs("Server")
+subdirs("Client")
+subdirs("TableFunctions")
+subdirs("Analyzers")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-connect.dir/test_connect.cpp.o"
+  "CMakeFiles/test-connect.dir/test_connect.cpp.o.d"
+  "test-connect"
+  "test-connect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-connect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/src/Common
+# Build directory: /root/repo/_gate_build/dbms/src/Common
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ZooKeeper")
+subdirs("tests")
+subdirs("benchmarks")
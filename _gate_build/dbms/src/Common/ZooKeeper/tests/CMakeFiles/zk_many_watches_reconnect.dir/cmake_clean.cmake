@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zk_many_watches_reconnect.dir/zk_many_watches_reconnect.cpp.o"
+  "CMakeFiles/zk_many_watches_reconnect.dir/zk_many_watches_reconnect.cpp.o.d"
+  "zk_many_watches_reconnect"
+  "zk_many_watches_reconnect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zk_many_watches_reconnect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zkutil_expiration_test.dir/zkutil_expiration_test.cpp.o"
+  "CMakeFiles/zkutil_expiration_test.dir/zkutil_expiration_test.cpp.o.d"
+  "zkutil_expiration_test"
+  "zkutil_expiration_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zkutil_expiration_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zkutil_test_async.dir/zkutil_test_async.cpp.o"
+  "CMakeFiles/zkutil_test_async.dir/zkutil_test_async.cpp.o.d"
+  "zkutil_test_async"
+  "zkutil_test_async.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zkutil_test_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zkutil_test_commands.dir/zkutil_test_commands.cpp.o"
+  "CMakeFiles/zkutil_test_commands.dir/zkutil_test_commands.cpp.o.d"
+  "zkutil_test_commands"
+  "zkutil_test_commands.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zkutil_test_commands.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zkutil_test_lock.dir/zkutil_test_lock.cpp.o"
+  "CMakeFiles/zkutil_test_lock.dir/zkutil_test_lock.cpp.o.d"
+  "zkutil_test_lock"
+  "zkutil_test_lock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zkutil_test_lock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zkutil_test_multi_exception.dir/zkutil_test_multi_exception.cpp.o"
+  "CMakeFiles/zkutil_test_multi_exception.dir/zkutil_test_multi_exception.cpp.o.d"
+  "zkutil_test_multi_exception"
+  "zkutil_test_multi_exception.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zkutil_test_multi_exception.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
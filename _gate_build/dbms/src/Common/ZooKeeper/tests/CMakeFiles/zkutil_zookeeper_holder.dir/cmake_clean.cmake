@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zkutil_zookeeper_holder.dir/zkutil_zookeeper_holder.cpp.o"
+  "CMakeFiles/zkutil_zookeeper_holder.dir/zkutil_zookeeper_holder.cpp.o.d"
+  "zkutil_zookeeper_holder"
+  "zkutil_zookeeper_holder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zkutil_zookeeper_holder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
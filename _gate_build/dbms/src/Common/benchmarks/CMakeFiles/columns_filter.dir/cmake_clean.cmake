@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/columns_filter.dir/columns_filter.cpp.o"
+  "CMakeFiles/columns_filter.dir/columns_filter.cpp.o.d"
+  "columns_filter"
+  "columns_filter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/columns_filter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compressed_read_buffer.dir/compressed_read_buffer.cpp.o"
+  "CMakeFiles/compressed_read_buffer.dir/compressed_read_buffer.cpp.o.d"
+  "compressed_read_buffer"
+  "compressed_read_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compressed_read_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
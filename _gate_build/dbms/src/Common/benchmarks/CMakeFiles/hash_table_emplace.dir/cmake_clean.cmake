@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_table_emplace.dir/hash_table_emplace.cpp.o"
+  "CMakeFiles/hash_table_emplace.dir/hash_table_emplace.cpp.o.d"
+  "hash_table_emplace"
+  "hash_table_emplace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_table_emplace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashes_throughput.dir/hashes_throughput.cpp.o"
+  "CMakeFiles/hashes_throughput.dir/hashes_throughput.cpp.o.d"
+  "hashes_throughput"
+  "hashes_throughput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hashes_throughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merging_sorted_stream.dir/merging_sorted_stream.cpp.o"
+  "CMakeFiles/merging_sorted_stream.dir/merging_sorted_stream.cpp.o.d"
+  "merging_sorted_stream"
+  "merging_sorted_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merging_sorted_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
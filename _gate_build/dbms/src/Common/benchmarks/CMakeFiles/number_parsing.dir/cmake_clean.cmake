@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/number_parsing.dir/number_parsing.cpp.o"
+  "CMakeFiles/number_parsing.dir/number_parsing.cpp.o.d"
+  "number_parsing"
+  "number_parsing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/number_parsing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
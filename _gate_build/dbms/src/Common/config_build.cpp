@@ -0,0 +1,26 @@
+// .cpp autogenerated by cmake
+
+#include <Common/config_build.h>
+
+const char * auto_config_build[]
+{
+    "VERSION_FULL", "ClickHouse 1.1.54300",
+    "VERSION_DESCRIBE", "v1.1.54300-testing",
+    "BUILD_DATE", "2026-09-01",
+    "BUILD_TYPE", "RelWithDebInfo",
+    "SYSTEM", "Linux-6.18.44-fc-v23",
+    "SYSTEM_PROCESSOR", "x86_64",
+    "LIBRARY_ARCHITECTURE", "x86_64-linux-gnu",
+    "CMAKE_VERSION", "3.25.1",
+    "C_COMPILER", "/usr/bin/cc",
+    "C_COMPILER_VERSION", "12.2.0",
+    "CXX_COMPILER", "/usr/bin/c++",
+    "CXX_COMPILER_VERSION", "12.2.0",
+    "C_FLAGS", "  -D_GLIBCXX_USE_CXX11_ABI=1 -pipe -msse4.1 -msse4.2 -mpopcnt -fno-omit-frame-pointer -Wall  -no-pie -O2 -g -DNDEBUG -O3",
+    "CXX_FLAGS", "  -D_GLIBCXX_USE_CXX11_ABI=1 -pipe -msse4.1 -msse4.2 -mpopcnt -std=gnu++1z  -fno-omit-frame-pointer -Wall -Wnon-virtual-dtor  -no-pie -O2 -g -DNDEBUG -O3",
+    "LINK_FLAGS", " -static-libgcc -static-libstdc++  -D_GLIBCXX_USE_CXX11_ABI=1",
+    "BUILD_COMPILE_DEFINITIONS", "BOOST_SYSTEM_NO_DEPRECATED",
+    "BUILD_INCLUDE_DIRECTORIES", "/root/repo/_gate_build/contrib/libzlib-ng;/root/repo/contrib/libzlib-ng;/root/repo/contrib/libpoco/Crypto/include;/root/repo/contrib/libpoco/NetSSL_OpenSSL/include;/root/repo/contrib/libpoco/MongoDB/include;/root/repo/contrib/libpoco/XML/include;/root/repo/contrib/libpoco/Data/include;/root/repo/contrib/libpoco/Net/include;/root/repo/contrib/libpoco/Util/include;/root/repo/contrib/libpoco/Foundation/include;/usr/include;/usr/include;/usr/include",
+    "STATIC", "ON",
+    nullptr, nullptr
+};
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arena_with_free_lists.dir/arena_with_free_lists.cpp.o"
+  "CMakeFiles/arena_with_free_lists.dir/arena_with_free_lists.cpp.o.d"
+  "arena_with_free_lists"
+  "arena_with_free_lists.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arena_with_free_lists.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
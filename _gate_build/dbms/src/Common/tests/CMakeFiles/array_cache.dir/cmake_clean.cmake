@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_cache.dir/array_cache.cpp.o"
+  "CMakeFiles/array_cache.dir/array_cache.cpp.o.d"
+  "array_cache"
+  "array_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/auto_array.dir/auto_array.cpp.o"
+  "CMakeFiles/auto_array.dir/auto_array.cpp.o.d"
+  "auto_array"
+  "auto_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/auto_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compact_array.dir/compact_array.cpp.o"
+  "CMakeFiles/compact_array.dir/compact_array.cpp.o.d"
+  "compact_array"
+  "compact_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compact_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
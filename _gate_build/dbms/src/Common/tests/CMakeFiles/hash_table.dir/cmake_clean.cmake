@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_table.dir/hash_table.cpp.o"
+  "CMakeFiles/hash_table.dir/hash_table.cpp.o.d"
+  "hash_table"
+  "hash_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
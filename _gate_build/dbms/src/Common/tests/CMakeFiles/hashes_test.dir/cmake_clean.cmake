@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashes_test.dir/hashes_test.cpp.o"
+  "CMakeFiles/hashes_test.dir/hashes_test.cpp.o.d"
+  "hashes_test"
+  "hashes_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hashes_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
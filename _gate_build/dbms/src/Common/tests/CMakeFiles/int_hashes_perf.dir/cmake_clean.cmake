@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/int_hashes_perf.dir/AvalancheTest.cpp.o"
+  "CMakeFiles/int_hashes_perf.dir/AvalancheTest.cpp.o.d"
+  "CMakeFiles/int_hashes_perf.dir/Random.cpp.o"
+  "CMakeFiles/int_hashes_perf.dir/Random.cpp.o.d"
+  "CMakeFiles/int_hashes_perf.dir/int_hashes_perf.cpp.o"
+  "CMakeFiles/int_hashes_perf.dir/int_hashes_perf.cpp.o.d"
+  "int_hashes_perf"
+  "int_hashes_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/int_hashes_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_hash_tables_and_hashes.dir/integer_hash_tables_and_hashes.cpp.o"
+  "CMakeFiles/integer_hash_tables_and_hashes.dir/integer_hash_tables_and_hashes.cpp.o.d"
+  "integer_hash_tables_and_hashes"
+  "integer_hash_tables_and_hashes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_hash_tables_and_hashes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
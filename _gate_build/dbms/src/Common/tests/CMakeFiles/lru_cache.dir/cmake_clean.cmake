@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lru_cache.dir/lru_cache.cpp.o"
+  "CMakeFiles/lru_cache.dir/lru_cache.cpp.o.d"
+  "lru_cache"
+  "lru_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lru_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
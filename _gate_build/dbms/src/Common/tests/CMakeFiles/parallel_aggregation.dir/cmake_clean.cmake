@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parallel_aggregation.dir/parallel_aggregation.cpp.o"
+  "CMakeFiles/parallel_aggregation.dir/parallel_aggregation.cpp.o.d"
+  "parallel_aggregation"
+  "parallel_aggregation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_aggregation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parallel_aggregation2.dir/parallel_aggregation2.cpp.o"
+  "CMakeFiles/parallel_aggregation2.dir/parallel_aggregation2.cpp.o.d"
+  "parallel_aggregation2"
+  "parallel_aggregation2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_aggregation2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pod_array.dir/pod_array.cpp.o"
+  "CMakeFiles/pod_array.dir/pod_array.cpp.o.d"
+  "pod_array"
+  "pod_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pod_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shell_command_test.dir/shell_command_test.cpp.o"
+  "CMakeFiles/shell_command_test.dir/shell_command_test.cpp.o.d"
+  "shell_command_test"
+  "shell_command_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shell_command_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple_cache.dir/simple_cache.cpp.o"
+  "CMakeFiles/simple_cache.dir/simple_cache.cpp.o.d"
+  "simple_cache"
+  "simple_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
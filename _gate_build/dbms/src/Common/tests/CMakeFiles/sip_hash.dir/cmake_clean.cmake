@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sip_hash.dir/sip_hash.cpp.o"
+  "CMakeFiles/sip_hash.dir/sip_hash.cpp.o.d"
+  "sip_hash"
+  "sip_hash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sip_hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
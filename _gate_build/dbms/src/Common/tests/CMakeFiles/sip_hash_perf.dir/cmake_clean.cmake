@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sip_hash_perf.dir/sip_hash_perf.cpp.o"
+  "CMakeFiles/sip_hash_perf.dir/sip_hash_perf.cpp.o.d"
+  "sip_hash_perf"
+  "sip_hash_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sip_hash_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/small_table.dir/small_table.cpp.o"
+  "CMakeFiles/small_table.dir/small_table.cpp.o.d"
+  "small_table"
+  "small_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/small_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
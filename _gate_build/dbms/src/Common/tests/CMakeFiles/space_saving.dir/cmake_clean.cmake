@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/space_saving.dir/space_saving.cpp.o"
+  "CMakeFiles/space_saving.dir/space_saving.cpp.o.d"
+  "space_saving"
+  "space_saving.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/space_saving.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread_creation_latency.dir/thread_creation_latency.cpp.o"
+  "CMakeFiles/thread_creation_latency.dir/thread_creation_latency.cpp.o.d"
+  "thread_creation_latency"
+  "thread_creation_latency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_creation_latency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
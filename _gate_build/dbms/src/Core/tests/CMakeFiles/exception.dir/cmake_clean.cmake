@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exception.dir/exception.cpp.o"
+  "CMakeFiles/exception.dir/exception.cpp.o.d"
+  "exception"
+  "exception.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exception.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/field.dir/field.cpp.o"
+  "CMakeFiles/field.dir/field.cpp.o.d"
+  "field"
+  "field.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/field.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
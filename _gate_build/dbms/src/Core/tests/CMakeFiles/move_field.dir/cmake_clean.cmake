@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/move_field.dir/move_field.cpp.o"
+  "CMakeFiles/move_field.dir/move_field.cpp.o.d"
+  "move_field"
+  "move_field.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/move_field.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
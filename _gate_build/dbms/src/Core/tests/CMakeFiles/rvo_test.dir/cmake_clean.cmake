@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rvo_test.dir/rvo_test.cpp.o"
+  "CMakeFiles/rvo_test.dir/rvo_test.cpp.o.d"
+  "rvo_test"
+  "rvo_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rvo_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
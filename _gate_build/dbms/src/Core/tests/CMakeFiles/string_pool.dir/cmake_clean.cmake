@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/string_pool.dir/string_pool.cpp.o"
+  "CMakeFiles/string_pool.dir/string_pool.cpp.o.d"
+  "string_pool"
+  "string_pool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/string_ref_hash.dir/string_ref_hash.cpp.o"
+  "CMakeFiles/string_ref_hash.dir/string_ref_hash.cpp.o.d"
+  "string_ref_hash"
+  "string_ref_hash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_ref_hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aggregating_stream.dir/aggregating_stream.cpp.o"
+  "CMakeFiles/aggregating_stream.dir/aggregating_stream.cpp.o.d"
+  "aggregating_stream"
+  "aggregating_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aggregating_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
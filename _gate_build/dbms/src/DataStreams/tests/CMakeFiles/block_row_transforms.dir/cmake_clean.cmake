@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_row_transforms.dir/block_row_transforms.cpp.o"
+  "CMakeFiles/block_row_transforms.dir/block_row_transforms.cpp.o.d"
+  "block_row_transforms"
+  "block_row_transforms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_row_transforms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
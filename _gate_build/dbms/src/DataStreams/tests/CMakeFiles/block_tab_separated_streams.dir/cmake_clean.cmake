@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/block_tab_separated_streams.dir/block_tab_separated_streams.cpp.o"
+  "CMakeFiles/block_tab_separated_streams.dir/block_tab_separated_streams.cpp.o.d"
+  "block_tab_separated_streams"
+  "block_tab_separated_streams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/block_tab_separated_streams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
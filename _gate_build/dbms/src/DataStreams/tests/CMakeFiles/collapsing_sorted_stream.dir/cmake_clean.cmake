@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/collapsing_sorted_stream.dir/collapsing_sorted_stream.cpp.o"
+  "CMakeFiles/collapsing_sorted_stream.dir/collapsing_sorted_stream.cpp.o.d"
+  "collapsing_sorted_stream"
+  "collapsing_sorted_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collapsing_sorted_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expression_stream.dir/expression_stream.cpp.o"
+  "CMakeFiles/expression_stream.dir/expression_stream.cpp.o.d"
+  "expression_stream"
+  "expression_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expression_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
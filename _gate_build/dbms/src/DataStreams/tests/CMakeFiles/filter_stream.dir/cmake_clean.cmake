@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/filter_stream.dir/filter_stream.cpp.o"
+  "CMakeFiles/filter_stream.dir/filter_stream.cpp.o.d"
+  "filter_stream"
+  "filter_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filter_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/filter_stream_hitlog.dir/filter_stream_hitlog.cpp.o"
+  "CMakeFiles/filter_stream_hitlog.dir/filter_stream_hitlog.cpp.o.d"
+  "filter_stream_hitlog"
+  "filter_stream_hitlog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filter_stream_hitlog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fork_streams.dir/fork_streams.cpp.o"
+  "CMakeFiles/fork_streams.dir/fork_streams.cpp.o.d"
+  "fork_streams"
+  "fork_streams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fork_streams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/glue_streams.dir/glue_streams.cpp.o"
+  "CMakeFiles/glue_streams.dir/glue_streams.cpp.o.d"
+  "glue_streams"
+  "glue_streams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/glue_streams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
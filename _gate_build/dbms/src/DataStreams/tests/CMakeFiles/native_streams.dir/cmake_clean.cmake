@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/native_streams.dir/native_streams.cpp.o"
+  "CMakeFiles/native_streams.dir/native_streams.cpp.o.d"
+  "native_streams"
+  "native_streams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/native_streams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
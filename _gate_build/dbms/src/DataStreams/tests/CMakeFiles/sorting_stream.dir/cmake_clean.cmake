@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sorting_stream.dir/sorting_stream.cpp.o"
+  "CMakeFiles/sorting_stream.dir/sorting_stream.cpp.o.d"
+  "sorting_stream"
+  "sorting_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sorting_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tab_separated_streams.dir/tab_separated_streams.cpp.o"
+  "CMakeFiles/tab_separated_streams.dir/tab_separated_streams.cpp.o.d"
+  "tab_separated_streams"
+  "tab_separated_streams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tab_separated_streams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/union_stream.dir/union_stream.cpp.o"
+  "CMakeFiles/union_stream.dir/union_stream.cpp.o.d"
+  "union_stream"
+  "union_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/union_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
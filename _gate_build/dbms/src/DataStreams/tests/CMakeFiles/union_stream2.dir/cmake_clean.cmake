@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/union_stream2.dir/union_stream2.cpp.o"
+  "CMakeFiles/union_stream2.dir/union_stream2.cpp.o.d"
+  "union_stream2"
+  "union_stream2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/union_stream2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
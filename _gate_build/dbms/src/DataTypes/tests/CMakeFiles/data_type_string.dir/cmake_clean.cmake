@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/data_type_string.dir/data_type_string.cpp.o"
+  "CMakeFiles/data_type_string.dir/data_type_string.cpp.o.d"
+  "data_type_string"
+  "data_type_string.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/data_type_string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/data_types_number_fixed.dir/data_types_number_fixed.cpp.o"
+  "CMakeFiles/data_types_number_fixed.dir/data_types_number_fixed.cpp.o.d"
+  "data_types_number_fixed"
+  "data_types_number_fixed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/data_types_number_fixed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
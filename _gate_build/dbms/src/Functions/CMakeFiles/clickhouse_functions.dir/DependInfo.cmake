@@ -0,0 +1,140 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dbms/src/Functions/Conditional/ArgsInfo.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/ArgsInfo.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/ArgsInfo.cpp.o.d"
+  "/root/repo/dbms/src/Functions/Conditional/CondSource.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/CondSource.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/CondSource.cpp.o.d"
+  "/root/repo/dbms/src/Functions/Conditional/NullMapBuilder.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/NullMapBuilder.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/NullMapBuilder.cpp.o.d"
+  "/root/repo/dbms/src/Functions/Conditional/NumericPerformer.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/NumericPerformer.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/NumericPerformer.cpp.o.d"
+  "/root/repo/dbms/src/Functions/Conditional/StringArrayEvaluator.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/StringArrayEvaluator.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/StringArrayEvaluator.cpp.o.d"
+  "/root/repo/dbms/src/Functions/Conditional/StringEvaluator.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/StringEvaluator.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/StringEvaluator.cpp.o.d"
+  "/root/repo/dbms/src/Functions/Conditional/getArrayType.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/getArrayType.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/Conditional/getArrayType.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsArray.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsArray.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsArray.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsBitmap.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsBitmap.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsBitmap.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsCharset.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsCharset.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsCharset.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsCoding.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsCoding.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsCoding.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsComparison.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsComparison.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsComparison.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsConditional.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsConditional.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsConditional.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsConversion.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsConversion.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsConversion.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsDateTime.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsDateTime.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsDateTime.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsEmbeddedDictionaries.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsEmbeddedDictionaries.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsEmbeddedDictionaries.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsExternalDictionaries.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsExternalDictionaries.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsExternalDictionaries.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsFindCluster.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsFindCluster.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsFindCluster.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsFormatting.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsFormatting.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsFormatting.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsGeo.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsGeo.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsGeo.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsHashing.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsHashing.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsHashing.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsHigherOrder.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsHigherOrder.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsHigherOrder.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsLogical.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsLogical.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsLogical.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsMath.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsMath.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsMath.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsMiscellaneous.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsMiscellaneous.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsMiscellaneous.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsNull.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsNull.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsNull.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsRandom.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsRandom.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsRandom.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsReinterpret.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsReinterpret.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsReinterpret.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsRound.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsRound.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsRound.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsString.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsString.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsString.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsStringArray.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsStringArray.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsStringArray.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsStringSearch.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsStringSearch.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsStringSearch.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsTransform.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsTransform.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsTransform.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsURL.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsURL.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsURL.cpp.o.d"
+  "/root/repo/dbms/src/Functions/FunctionsVisitParam.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsVisitParam.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/FunctionsVisitParam.cpp.o.d"
+  "/root/repo/dbms/src/Functions/GatherUtils.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/GatherUtils.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/GatherUtils.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionAbs.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionAbs.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionAbs.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArray.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArray.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArray.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayConcat.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayConcat.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayConcat.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayElement.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayElement.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayElement.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayEnumerate.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerate.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerate.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayEnumerateUniq.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerateUniq.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerateUniq.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayPopBack.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopBack.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopBack.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayPopFront.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopFront.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopFront.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayPushBack.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushBack.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushBack.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayPushFront.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushFront.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushFront.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayReduce.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReduce.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReduce.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayReverse.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReverse.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReverse.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArraySlice.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArraySlice.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArraySlice.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionArrayUniq.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayUniq.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionArrayUniq.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitAnd.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitAnd.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitAnd.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitNot.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitNot.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitNot.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitOr.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitOr.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitOr.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitRotateLeft.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateLeft.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateLeft.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitRotateRight.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateRight.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateRight.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitShiftLeft.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftLeft.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftLeft.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitShiftRight.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftRight.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftRight.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitTest.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitTest.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitTest.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitTestAll.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAll.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAll.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitTestAny.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAny.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAny.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionBitXor.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitXor.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionBitXor.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionCountEqual.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionCountEqual.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionCountEqual.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionDivideFloating.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionDivideFloating.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionDivideFloating.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionDivideIntegral.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegral.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegral.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionDivideIntegralOrZero.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegralOrZero.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegralOrZero.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayDate.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDate.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDate.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayDateTime.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDateTime.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDateTime.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayFloat32.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat32.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat32.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayFloat64.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat64.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat64.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayInt16.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt16.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt16.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayInt32.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt32.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt32.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayInt64.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt64.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt64.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayInt8.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt8.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt8.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayString.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayString.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayString.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayToSingle.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayToSingle.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayToSingle.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayUInt16.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt16.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt16.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayUInt32.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt32.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt32.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayUInt64.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt64.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt64.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionEmptyArrayUInt8.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt8.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt8.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionGreatest.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionGreatest.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionGreatest.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionHas.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionHas.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionHas.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionIndexOf.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionIndexOf.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionIndexOf.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionLeast.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionLeast.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionLeast.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionMinus.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionMinus.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionMinus.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionModulo.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionModulo.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionModulo.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionMultiply.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionMultiply.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionMultiply.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionNegate.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionNegate.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionNegate.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionPlus.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionPlus.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionPlus.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionRange.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionRange.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionRange.cpp.o.d"
+  "/root/repo/dbms/src/Functions/registerFunctions.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctions.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctions.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionsArithmetic.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionsArithmetic.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionsArithmetic.cpp.o.d"
+  "/root/repo/_gate_build/dbms/src/Functions/registerFunctionsArray.cpp" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionsArray.cpp.o" "gcc" "dbms/src/Functions/CMakeFiles/clickhouse_functions.dir/registerFunctionsArray.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/dbms/CMakeFiles/dbms.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libcommon/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libpocoext/CMakeFiles/pocoext.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcityhash/CMakeFiles/cityhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcctz/CMakeFiles/cctz.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libmemcpy/CMakeFiles/memcpy.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libfarmhash/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libmetrohash/CMakeFiles/metrohash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/liblz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/dbms/CMakeFiles/string_utils.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcpuid/CMakeFiles/cpuid.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2_st.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_system_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Data/CMakeFiles/PocoData.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libbtrie/CMakeFiles/btrie.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,193 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse_functions.dir/Conditional/ArgsInfo.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/ArgsInfo.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/CondSource.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/CondSource.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/NullMapBuilder.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/NullMapBuilder.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/NumericPerformer.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/NumericPerformer.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/StringArrayEvaluator.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/StringArrayEvaluator.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/StringEvaluator.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/StringEvaluator.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/getArrayType.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/Conditional/getArrayType.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsArray.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsArray.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsBitmap.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsBitmap.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsCharset.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsCharset.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsCoding.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsCoding.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsComparison.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsComparison.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsConditional.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsConditional.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsConversion.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsConversion.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsDateTime.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsDateTime.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsEmbeddedDictionaries.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsEmbeddedDictionaries.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsExternalDictionaries.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsExternalDictionaries.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsFindCluster.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsFindCluster.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsFormatting.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsFormatting.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsGeo.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsGeo.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsHashing.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsHashing.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsHigherOrder.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsHigherOrder.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsLogical.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsLogical.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsMath.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsMath.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsMiscellaneous.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsMiscellaneous.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsNull.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsNull.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsRandom.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsRandom.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsReinterpret.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsReinterpret.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsRound.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsRound.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsString.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsString.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsStringArray.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsStringArray.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsStringSearch.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsStringSearch.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsTransform.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsTransform.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsURL.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsURL.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsVisitParam.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/FunctionsVisitParam.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/GatherUtils.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/GatherUtils.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionAbs.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionAbs.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArray.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArray.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayConcat.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayConcat.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayElement.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayElement.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerate.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerate.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerateUniq.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayEnumerateUniq.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopBack.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopBack.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopFront.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPopFront.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushBack.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushBack.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushFront.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayPushFront.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReduce.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReduce.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReverse.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayReverse.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArraySlice.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArraySlice.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayUniq.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionArrayUniq.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitAnd.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitAnd.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitNot.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitNot.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitOr.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitOr.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateLeft.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateLeft.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateRight.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitRotateRight.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftLeft.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftLeft.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftRight.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitShiftRight.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitTest.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitTest.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAll.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAll.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAny.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitTestAny.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitXor.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionBitXor.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionCountEqual.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionCountEqual.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionDivideFloating.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionDivideFloating.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegral.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegral.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegralOrZero.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionDivideIntegralOrZero.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDate.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDate.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDateTime.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayDateTime.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat32.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat32.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat64.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayFloat64.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt16.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt16.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt32.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt32.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt64.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt64.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt8.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayInt8.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayString.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayString.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayToSingle.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayToSingle.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt16.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt16.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt32.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt32.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt64.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt64.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt8.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionEmptyArrayUInt8.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionGreatest.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionGreatest.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionHas.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionHas.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionIndexOf.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionIndexOf.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionLeast.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionLeast.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionMinus.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionMinus.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionModulo.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionModulo.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionMultiply.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionMultiply.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionNegate.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionNegate.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionPlus.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionPlus.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionRange.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionRange.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctions.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctions.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionsArithmetic.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionsArithmetic.cpp.o.d"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionsArray.cpp.o"
+  "CMakeFiles/clickhouse_functions.dir/registerFunctionsArray.cpp.o.d"
+  "libclickhouse_functions.a"
+  "libclickhouse_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
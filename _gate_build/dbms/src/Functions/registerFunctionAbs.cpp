@@ -0,0 +1,14 @@
+#include <Functions/registerFunctionAbs.h>
+
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionsArithmetic.h>
+
+namespace DB
+{
+
+void registerFunctionAbs(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionAbs>();
+}
+
+}
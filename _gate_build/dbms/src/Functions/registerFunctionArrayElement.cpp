@@ -0,0 +1,14 @@
+#include <Functions/registerFunctionArrayElement.h>
+
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionsArray.h>
+
+namespace DB
+{
+
+void registerFunctionArrayElement(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionArrayElement>();
+}
+
+}
@@ -0,0 +1,14 @@
+#include <Functions/registerFunctionArrayEnumerateUniq.h>
+
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionsArray.h>
+
+namespace DB
+{
+
+void registerFunctionArrayEnumerateUniq(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionArrayEnumerateUniq>();
+}
+
+}
@@ -0,0 +1,14 @@
+#include <Functions/registerFunctionBitTestAll.h>
+
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionsArithmetic.h>
+
+namespace DB
+{
+
+void registerFunctionBitTestAll(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionBitTestAll>();
+}
+
+}
@@ -0,0 +1,14 @@
+#include <Functions/registerFunctionDivideFloating.h>
+
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionsArithmetic.h>
+
+namespace DB
+{
+
+void registerFunctionDivideFloating(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionDivideFloating>();
+}
+
+}
@@ -0,0 +1,14 @@
+#include <Functions/registerFunctionEmptyArrayDateTime.h>
+
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionsArray.h>
+
+namespace DB
+{
+
+void registerFunctionEmptyArrayDateTime(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionEmptyArrayDateTime>();
+}
+
+}
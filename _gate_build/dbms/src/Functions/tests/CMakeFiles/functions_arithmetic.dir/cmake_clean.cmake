@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functions_arithmetic.dir/functions_arithmetic.cpp.o"
+  "CMakeFiles/functions_arithmetic.dir/functions_arithmetic.cpp.o.d"
+  "functions_arithmetic"
+  "functions_arithmetic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functions_arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logical_functions_performance.dir/logical_functions_performance.cpp.o"
+  "CMakeFiles/logical_functions_performance.dir/logical_functions_performance.cpp.o.d"
+  "logical_functions_performance"
+  "logical_functions_performance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logical_functions_performance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
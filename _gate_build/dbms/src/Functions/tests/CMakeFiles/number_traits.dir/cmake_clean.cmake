@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/number_traits.dir/number_traits.cpp.o"
+  "CMakeFiles/number_traits.dir/number_traits.cpp.o.d"
+  "number_traits"
+  "number_traits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/number_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
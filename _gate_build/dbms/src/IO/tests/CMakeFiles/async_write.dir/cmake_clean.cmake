@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/async_write.dir/async_write.cpp.o"
+  "CMakeFiles/async_write.dir/async_write.cpp.o.d"
+  "async_write"
+  "async_write.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_write.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cached_compressed_read_buffer.dir/cached_compressed_read_buffer.cpp.o"
+  "CMakeFiles/cached_compressed_read_buffer.dir/cached_compressed_read_buffer.cpp.o.d"
+  "cached_compressed_read_buffer"
+  "cached_compressed_read_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cached_compressed_read_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compressed_buffer.dir/compressed_buffer.cpp.o"
+  "CMakeFiles/compressed_buffer.dir/compressed_buffer.cpp.o.d"
+  "compressed_buffer"
+  "compressed_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compressed_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
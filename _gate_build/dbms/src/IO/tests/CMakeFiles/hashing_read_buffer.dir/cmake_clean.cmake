@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashing_read_buffer.dir/hashing_read_buffer.cpp.o"
+  "CMakeFiles/hashing_read_buffer.dir/hashing_read_buffer.cpp.o.d"
+  "hashing_read_buffer"
+  "hashing_read_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hashing_read_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
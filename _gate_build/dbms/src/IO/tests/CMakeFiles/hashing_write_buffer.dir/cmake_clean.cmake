@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashing_write_buffer.dir/hashing_write_buffer.cpp.o"
+  "CMakeFiles/hashing_write_buffer.dir/hashing_write_buffer.cpp.o.d"
+  "hashing_write_buffer"
+  "hashing_write_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hashing_write_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
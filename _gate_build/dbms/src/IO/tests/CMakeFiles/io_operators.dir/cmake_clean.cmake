@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_operators.dir/operators.cpp.o"
+  "CMakeFiles/io_operators.dir/operators.cpp.o.d"
+  "io_operators"
+  "io_operators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_operators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/limit_read_buffer.dir/limit_read_buffer.cpp.o"
+  "CMakeFiles/limit_read_buffer.dir/limit_read_buffer.cpp.o.d"
+  "limit_read_buffer"
+  "limit_read_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/limit_read_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
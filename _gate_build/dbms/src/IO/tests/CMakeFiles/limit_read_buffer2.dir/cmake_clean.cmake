@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/limit_read_buffer2.dir/limit_read_buffer2.cpp.o"
+  "CMakeFiles/limit_read_buffer2.dir/limit_read_buffer2.cpp.o.d"
+  "limit_read_buffer2"
+  "limit_read_buffer2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/limit_read_buffer2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
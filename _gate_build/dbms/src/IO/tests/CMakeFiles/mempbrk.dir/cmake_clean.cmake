@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mempbrk.dir/mempbrk.cpp.o"
+  "CMakeFiles/mempbrk.dir/mempbrk.cpp.o.d"
+  "mempbrk"
+  "mempbrk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mempbrk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/o_direct_and_dirty_pages.dir/o_direct_and_dirty_pages.cpp.o"
+  "CMakeFiles/o_direct_and_dirty_pages.dir/o_direct_and_dirty_pages.cpp.o.d"
+  "o_direct_and_dirty_pages"
+  "o_direct_and_dirty_pages.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/o_direct_and_dirty_pages.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parse_int_perf.dir/parse_int_perf.cpp.o"
+  "CMakeFiles/parse_int_perf.dir/parse_int_perf.cpp.o.d"
+  "parse_int_perf"
+  "parse_int_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parse_int_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
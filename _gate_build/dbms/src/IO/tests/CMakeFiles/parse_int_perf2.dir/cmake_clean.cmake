@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parse_int_perf2.dir/parse_int_perf2.cpp.o"
+  "CMakeFiles/parse_int_perf2.dir/parse_int_perf2.cpp.o.d"
+  "parse_int_perf2"
+  "parse_int_perf2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parse_int_perf2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
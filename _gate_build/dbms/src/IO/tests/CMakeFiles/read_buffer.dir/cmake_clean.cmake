@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_buffer.dir/read_buffer.cpp.o"
+  "CMakeFiles/read_buffer.dir/read_buffer.cpp.o.d"
+  "read_buffer"
+  "read_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_buffer_aio.dir/read_buffer_aio.cpp.o"
+  "CMakeFiles/read_buffer_aio.dir/read_buffer_aio.cpp.o.d"
+  "read_buffer_aio"
+  "read_buffer_aio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_buffer_aio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_buffer_perf.dir/read_buffer_perf.cpp.o"
+  "CMakeFiles/read_buffer_perf.dir/read_buffer_perf.cpp.o.d"
+  "read_buffer_perf"
+  "read_buffer_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_buffer_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
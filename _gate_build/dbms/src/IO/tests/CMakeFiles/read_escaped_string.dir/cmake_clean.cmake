@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_escaped_string.dir/read_escaped_string.cpp.o"
+  "CMakeFiles/read_escaped_string.dir/read_escaped_string.cpp.o.d"
+  "read_escaped_string"
+  "read_escaped_string.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_escaped_string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
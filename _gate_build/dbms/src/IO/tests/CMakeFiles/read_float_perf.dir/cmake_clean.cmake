@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_float_perf.dir/read_float_perf.cpp.o"
+  "CMakeFiles/read_float_perf.dir/read_float_perf.cpp.o.d"
+  "read_float_perf"
+  "read_float_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_float_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/read_write_int.dir/read_write_int.cpp.o"
+  "CMakeFiles/read_write_int.dir/read_write_int.cpp.o.d"
+  "read_write_int"
+  "read_write_int.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/read_write_int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_read_write_buffer.dir/remote_read_write_buffer.cpp.o"
+  "CMakeFiles/remote_read_write_buffer.dir/remote_read_write_buffer.cpp.o.d"
+  "remote_read_write_buffer"
+  "remote_read_write_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remote_read_write_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/valid_utf8.dir/valid_utf8.cpp.o"
+  "CMakeFiles/valid_utf8.dir/valid_utf8.cpp.o.d"
+  "valid_utf8"
+  "valid_utf8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/valid_utf8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/valid_utf8_perf.dir/valid_utf8_perf.cpp.o"
+  "CMakeFiles/valid_utf8_perf.dir/valid_utf8_perf.cpp.o.d"
+  "valid_utf8_perf"
+  "valid_utf8_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/valid_utf8_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/var_uint.dir/var_uint.cpp.o"
+  "CMakeFiles/var_uint.dir/var_uint.cpp.o.d"
+  "var_uint"
+  "var_uint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/var_uint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
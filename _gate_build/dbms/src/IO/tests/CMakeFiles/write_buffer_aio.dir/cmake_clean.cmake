@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/write_buffer_aio.dir/write_buffer_aio.cpp.o"
+  "CMakeFiles/write_buffer_aio.dir/write_buffer_aio.cpp.o.d"
+  "write_buffer_aio"
+  "write_buffer_aio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/write_buffer_aio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/write_buffer_perf.dir/write_buffer_perf.cpp.o"
+  "CMakeFiles/write_buffer_perf.dir/write_buffer_perf.cpp.o.d"
+  "write_buffer_perf"
+  "write_buffer_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/write_buffer_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zlib_buffers.dir/zlib_buffers.cpp.o"
+  "CMakeFiles/zlib_buffers.dir/zlib_buffers.cpp.o.d"
+  "zlib_buffers"
+  "zlib_buffers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zlib_buffers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
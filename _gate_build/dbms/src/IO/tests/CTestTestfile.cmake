@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/src/IO/tests
+# Build directory: /root/repo/_gate_build/dbms/src/IO/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_hashing_write_buffer "/root/repo/_gate_build/dbms/src/IO/tests/hashing_write_buffer")
+set_tests_properties(test_hashing_write_buffer PROPERTIES  WORKING_DIRECTORY "/root/repo/dbms/src/IO/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/dbms/src/IO/tests/CMakeLists.txt;57;add_check;/root/repo/dbms/src/IO/tests/CMakeLists.txt;0;")
+add_test(test_hashing_read_buffer "/root/repo/_gate_build/dbms/src/IO/tests/hashing_read_buffer")
+set_tests_properties(test_hashing_read_buffer PROPERTIES  WORKING_DIRECTORY "/root/repo/dbms/src/IO/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/dbms/src/IO/tests/CMakeLists.txt;61;add_check;/root/repo/dbms/src/IO/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aggregate.dir/aggregate.cpp.o"
+  "CMakeFiles/aggregate.dir/aggregate.cpp.o.d"
+  "aggregate"
+  "aggregate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aggregate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
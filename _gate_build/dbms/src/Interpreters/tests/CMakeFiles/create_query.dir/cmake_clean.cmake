@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_query.dir/create_query.cpp.o"
+  "CMakeFiles/create_query.dir/create_query.cpp.o.d"
+  "create_query"
+  "create_query.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/create_query.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expression.dir/expression.cpp.o"
+  "CMakeFiles/expression.dir/expression.cpp.o.d"
+  "expression"
+  "expression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
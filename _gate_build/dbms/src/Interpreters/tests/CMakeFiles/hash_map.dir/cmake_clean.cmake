@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_map.dir/hash_map.cpp.o"
+  "CMakeFiles/hash_map.dir/hash_map.cpp.o.d"
+  "hash_map"
+  "hash_map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_map3.dir/hash_map3.cpp.o"
+  "CMakeFiles/hash_map3.dir/hash_map3.cpp.o.d"
+  "hash_map3"
+  "hash_map3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_map3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
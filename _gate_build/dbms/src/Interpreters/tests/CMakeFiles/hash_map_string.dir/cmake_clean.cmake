@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_map_string.dir/hash_map_string.cpp.o"
+  "CMakeFiles/hash_map_string.dir/hash_map_string.cpp.o.d"
+  "hash_map_string"
+  "hash_map_string.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_map_string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_map_string_2.dir/hash_map_string_2.cpp.o"
+  "CMakeFiles/hash_map_string_2.dir/hash_map_string_2.cpp.o.d"
+  "hash_map_string_2"
+  "hash_map_string_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_map_string_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
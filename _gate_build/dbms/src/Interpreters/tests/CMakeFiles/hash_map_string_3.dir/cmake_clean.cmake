@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_map_string_3.dir/hash_map_string_3.cpp.o"
+  "CMakeFiles/hash_map_string_3.dir/hash_map_string_3.cpp.o.d"
+  "hash_map_string_3"
+  "hash_map_string_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_map_string_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
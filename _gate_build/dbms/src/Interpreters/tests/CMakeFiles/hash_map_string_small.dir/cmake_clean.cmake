@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_map_string_small.dir/hash_map_string_small.cpp.o"
+  "CMakeFiles/hash_map_string_small.dir/hash_map_string_small.cpp.o.d"
+  "hash_map_string_small"
+  "hash_map_string_small.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_map_string_small.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
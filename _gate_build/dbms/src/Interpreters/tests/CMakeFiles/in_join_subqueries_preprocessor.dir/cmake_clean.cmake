@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/in_join_subqueries_preprocessor.dir/in_join_subqueries_preprocessor.cpp.o"
+  "CMakeFiles/in_join_subqueries_preprocessor.dir/in_join_subqueries_preprocessor.cpp.o.d"
+  "in_join_subqueries_preprocessor"
+  "in_join_subqueries_preprocessor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/in_join_subqueries_preprocessor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logical_expressions_optimizer.dir/logical_expressions_optimizer.cpp.o"
+  "CMakeFiles/logical_expressions_optimizer.dir/logical_expressions_optimizer.cpp.o.d"
+  "logical_expressions_optimizer"
+  "logical_expressions_optimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logical_expressions_optimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/select_query.dir/select_query.cpp.o"
+  "CMakeFiles/select_query.dir/select_query.cpp.o.d"
+  "select_query"
+  "select_query.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/select_query.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
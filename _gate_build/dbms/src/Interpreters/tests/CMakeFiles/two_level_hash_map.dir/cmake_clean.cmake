@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/two_level_hash_map.dir/two_level_hash_map.cpp.o"
+  "CMakeFiles/two_level_hash_map.dir/two_level_hash_map.cpp.o.d"
+  "two_level_hash_map"
+  "two_level_hash_map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/two_level_hash_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
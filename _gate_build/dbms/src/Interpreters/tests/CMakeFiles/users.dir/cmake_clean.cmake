@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/users.dir/users.cpp.o"
+  "CMakeFiles/users.dir/users.cpp.o.d"
+  "users"
+  "users.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/users.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
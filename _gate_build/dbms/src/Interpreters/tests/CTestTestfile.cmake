@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/src/Interpreters/tests
+# Build directory: /root/repo/_gate_build/dbms/src/Interpreters/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_in_join_subqueries_preprocessor "/root/repo/_gate_build/dbms/src/Interpreters/tests/in_join_subqueries_preprocessor")
+set_tests_properties(test_in_join_subqueries_preprocessor PROPERTIES  WORKING_DIRECTORY "/root/repo/dbms/src/Interpreters/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/dbms/src/Interpreters/tests/CMakeLists.txt;48;add_check;/root/repo/dbms/src/Interpreters/tests/CMakeLists.txt;0;")
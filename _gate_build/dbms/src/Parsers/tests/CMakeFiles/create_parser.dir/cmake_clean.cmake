@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_parser.dir/create_parser.cpp.o"
+  "CMakeFiles/create_parser.dir/create_parser.cpp.o.d"
+  "create_parser"
+  "create_parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/create_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/select_parser.dir/select_parser.cpp.o"
+  "CMakeFiles/select_parser.dir/select_parser.cpp.o.d"
+  "select_parser"
+  "select_parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/select_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-benchmark.dir/Benchmark.cpp.o"
+  "CMakeFiles/clickhouse-benchmark.dir/Benchmark.cpp.o.d"
+  "libclickhouse-benchmark.a"
+  "libclickhouse-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-client.dir/Client.cpp.o"
+  "CMakeFiles/clickhouse-client.dir/Client.cpp.o.d"
+  "libclickhouse-client.a"
+  "libclickhouse-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
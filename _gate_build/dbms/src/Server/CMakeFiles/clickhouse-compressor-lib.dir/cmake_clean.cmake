@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-compressor-lib.dir/Compressor.cpp.o"
+  "CMakeFiles/clickhouse-compressor-lib.dir/Compressor.cpp.o.d"
+  "libclickhouse-compressor-lib.a"
+  "libclickhouse-compressor-lib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-compressor-lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-extract-from-config.dir/ExtractFromConfig.cpp.o"
+  "CMakeFiles/clickhouse-extract-from-config.dir/ExtractFromConfig.cpp.o.d"
+  "libclickhouse-extract-from-config.a"
+  "libclickhouse-extract-from-config.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-extract-from-config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libclickhouse-extract-from-config.a"
+)
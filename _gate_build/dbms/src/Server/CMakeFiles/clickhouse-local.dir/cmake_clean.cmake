@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-local.dir/LocalServer.cpp.o"
+  "CMakeFiles/clickhouse-local.dir/LocalServer.cpp.o.d"
+  "libclickhouse-local.a"
+  "libclickhouse-local.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-local.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-performance-test.dir/PerformanceTest.cpp.o"
+  "CMakeFiles/clickhouse-performance-test.dir/PerformanceTest.cpp.o.d"
+  "libclickhouse-performance-test.a"
+  "libclickhouse-performance-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-performance-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
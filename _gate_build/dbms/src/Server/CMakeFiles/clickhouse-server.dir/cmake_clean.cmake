@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-server.dir/ConfigReloader.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/ConfigReloader.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/HTTPHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/HTTPHandler.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/InterserverIOHTTPHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/InterserverIOHTTPHandler.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/MetricsTransmitter.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/MetricsTransmitter.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/NotFoundHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/NotFoundHandler.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/PingRequestHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/PingRequestHandler.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/ReplicasStatusHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/ReplicasStatusHandler.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/RootRequestHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/RootRequestHandler.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/Server.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/Server.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/StatusFile.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/StatusFile.cpp.o.d"
+  "CMakeFiles/clickhouse-server.dir/TCPHandler.cpp.o"
+  "CMakeFiles/clickhouse-server.dir/TCPHandler.cpp.o.d"
+  "libclickhouse-server.a"
+  "libclickhouse-server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse.dir/main.cpp.o"
+  "CMakeFiles/clickhouse.dir/main.cpp.o.d"
+  "clickhouse"
+  "clickhouse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,107 @@
+# Install script for directory: /root/repo/dbms/src/Server
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "RelWithDebInfo")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse-client" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/etc/clickhouse-client/config.xml")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/etc/clickhouse-client" TYPE FILE RENAME "config.xml" FILES "/root/repo/dbms/src/Server/clickhouse-client.xml")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/clickhouse" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/clickhouse")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/clickhouse"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_gate_build/dbms/src/Server/clickhouse")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/clickhouse" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/clickhouse")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/clickhouse")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse-server" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND ln -sf clickhouse clickhouse-server WORKING_DIRECTORY "$ENV{DESTDIR}/usr/local/bin" )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse-client" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND ln -sf clickhouse clickhouse-client WORKING_DIRECTORY "$ENV{DESTDIR}/usr/local/bin" )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse-local" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND ln -sf clickhouse clickhouse-local WORKING_DIRECTORY "$ENV{DESTDIR}/usr/local/bin" )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse-benchmark" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND ln -sf clickhouse clickhouse-benchmark WORKING_DIRECTORY "$ENV{DESTDIR}/usr/local/bin" )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse-performance-test" OR NOT CMAKE_INSTALL_COMPONENT)
+  execute_process(COMMAND ln -sf clickhouse clickhouse-performance-test WORKING_DIRECTORY "$ENV{DESTDIR}/usr/local/bin" )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clickhouse" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/etc/clickhouse-server/config.xml;/usr/local/etc/clickhouse-server/users.xml")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/etc/clickhouse-server" TYPE FILE FILES
+    "/root/repo/dbms/src/Server/config.xml"
+    "/root/repo/dbms/src/Server/users.xml"
+    )
+endif()
+
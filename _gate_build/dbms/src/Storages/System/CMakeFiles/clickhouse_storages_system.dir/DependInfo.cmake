@@ -0,0 +1,71 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dbms/src/Storages/System/StorageSystemAsynchronousMetrics.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemAsynchronousMetrics.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemAsynchronousMetrics.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemBuildOptions.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemBuildOptions.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemBuildOptions.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemClusters.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemClusters.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemClusters.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemColumns.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemColumns.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemColumns.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemDatabases.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemDatabases.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemDatabases.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemDictionaries.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemDictionaries.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemDictionaries.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemEvents.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemEvents.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemEvents.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemFunctions.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemFunctions.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemFunctions.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemGraphite.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemGraphite.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemGraphite.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemMerges.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemMerges.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemMerges.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemMetricHistory.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetricHistory.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetricHistory.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemMetrics.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetrics.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetrics.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemNumbers.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemNumbers.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemNumbers.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemOne.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemOne.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemOne.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemParts.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemParts.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemParts.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemPartsColumns.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemPartsColumns.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemPartsColumns.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemProcesses.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemProcesses.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemProcesses.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemReplicas.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicas.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicas.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemReplicationQueue.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicationQueue.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicationQueue.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemSettings.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemSettings.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemSettings.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemTables.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemTables.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemTables.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/StorageSystemZooKeeper.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemZooKeeper.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/StorageSystemZooKeeper.cpp.o.d"
+  "/root/repo/dbms/src/Storages/System/attachSystemTables.cpp" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/attachSystemTables.cpp.o" "gcc" "dbms/src/Storages/System/CMakeFiles/clickhouse_storages_system.dir/attachSystemTables.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/dbms/CMakeFiles/dbms.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libcommon/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libpocoext/CMakeFiles/pocoext.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcityhash/CMakeFiles/cityhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcctz/CMakeFiles/cctz.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libmemcpy/CMakeFiles/memcpy.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libfarmhash/CMakeFiles/farmhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libmetrohash/CMakeFiles/metrohash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/liblz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzookeeper/CMakeFiles/zookeeper_mt.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/dbms/CMakeFiles/string_utils.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libdouble-conversion/CMakeFiles/double-conversion.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcpuid/CMakeFiles/cpuid.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libre2/CMakeFiles/re2_st.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_system_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Data/CMakeFiles/PocoData.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libbtrie/CMakeFiles/btrie.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/MongoDB/CMakeFiles/PocoMongoDB.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/NetSSL_OpenSSL/CMakeFiles/PocoNetSSL.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Crypto/CMakeFiles/PocoCrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
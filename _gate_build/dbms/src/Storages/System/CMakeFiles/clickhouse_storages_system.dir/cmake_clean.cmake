@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemAsynchronousMetrics.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemAsynchronousMetrics.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemBuildOptions.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemBuildOptions.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemClusters.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemClusters.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemColumns.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemColumns.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemDatabases.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemDatabases.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemDictionaries.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemDictionaries.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemEvents.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemEvents.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemFunctions.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemFunctions.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemGraphite.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemGraphite.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemMerges.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemMerges.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetricHistory.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetricHistory.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetrics.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemMetrics.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemNumbers.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemNumbers.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemOne.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemOne.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemParts.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemParts.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemPartsColumns.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemPartsColumns.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemProcesses.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemProcesses.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicas.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicas.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicationQueue.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemReplicationQueue.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemSettings.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemSettings.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemTables.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemTables.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemZooKeeper.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/StorageSystemZooKeeper.cpp.o.d"
+  "CMakeFiles/clickhouse_storages_system.dir/attachSystemTables.cpp.o"
+  "CMakeFiles/clickhouse_storages_system.dir/attachSystemTables.cpp.o.d"
+  "libclickhouse_storages_system.a"
+  "libclickhouse_storages_system.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse_storages_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
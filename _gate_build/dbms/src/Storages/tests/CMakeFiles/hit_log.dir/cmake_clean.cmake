@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hit_log.dir/hit_log.cpp.o"
+  "CMakeFiles/hit_log.dir/hit_log.cpp.o.d"
+  "hit_log"
+  "hit_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hit_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_selector.dir/merge_selector.cpp.o"
+  "CMakeFiles/merge_selector.dir/merge_selector.cpp.o.d"
+  "merge_selector"
+  "merge_selector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_selector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_selector2.dir/merge_selector2.cpp.o"
+  "CMakeFiles/merge_selector2.dir/merge_selector2.cpp.o.d"
+  "merge_selector2"
+  "merge_selector2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_selector2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/part_checker.dir/part_checker.cpp.o"
+  "CMakeFiles/part_checker.dir/part_checker.cpp.o.d"
+  "part_checker"
+  "part_checker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/part_checker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/part_name.dir/part_name.cpp.o"
+  "CMakeFiles/part_name.dir/part_name.cpp.o.d"
+  "part_name"
+  "part_name.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/part_name.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remove_symlink_directory.dir/remove_symlink_directory.cpp.o"
+  "CMakeFiles/remove_symlink_directory.dir/remove_symlink_directory.cpp.o.d"
+  "remove_symlink_directory"
+  "remove_symlink_directory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remove_symlink_directory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
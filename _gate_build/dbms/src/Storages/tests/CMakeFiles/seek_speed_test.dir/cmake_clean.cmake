@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/seek_speed_test.dir/seek_speed_test.cpp.o"
+  "CMakeFiles/seek_speed_test.dir/seek_speed_test.cpp.o.d"
+  "seek_speed_test"
+  "seek_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/seek_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
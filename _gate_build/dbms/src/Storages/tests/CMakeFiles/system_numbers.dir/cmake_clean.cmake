@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/system_numbers.dir/system_numbers.cpp.o"
+  "CMakeFiles/system_numbers.dir/system_numbers.cpp.o.d"
+  "system_numbers"
+  "system_numbers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/system_numbers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionGenerateRandom.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionGenerateRandom.cpp.o.d"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionMerge.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionMerge.cpp.o.d"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionNumbers.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionNumbers.cpp.o.d"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionRemote.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionRemote.cpp.o.d"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionShardByHash.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/TableFunctionShardByHash.cpp.o.d"
+  "CMakeFiles/clickhouse_table_functions.dir/getStructureOfRemoteTable.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/getStructureOfRemoteTable.cpp.o.d"
+  "CMakeFiles/clickhouse_table_functions.dir/registerTableFunctions.cpp.o"
+  "CMakeFiles/clickhouse_table_functions.dir/registerTableFunctions.cpp.o.d"
+  "libclickhouse_table_functions.a"
+  "libclickhouse_table_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse_table_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/tests
+# Build directory: /root/repo/_gate_build/dbms/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("googletest")
+subdirs("external_dictionaries")
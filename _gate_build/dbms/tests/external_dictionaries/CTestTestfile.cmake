@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/tests/external_dictionaries
+# Build directory: /root/repo/_gate_build/dbms/tests/external_dictionaries
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("dictionary_library")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dictionary_library.dir/dictionary_library.cpp.o"
+  "CMakeFiles/dictionary_library.dir/dictionary_library.cpp.o.d"
+  "libdictionary_library.pdb"
+  "libdictionary_library.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dictionary_library.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
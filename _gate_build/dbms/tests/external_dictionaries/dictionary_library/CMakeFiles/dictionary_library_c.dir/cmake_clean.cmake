@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dictionary_library_c.dir/dictionary_library_c.c.o"
+  "CMakeFiles/dictionary_library_c.dir/dictionary_library_c.c.o.d"
+  "libdictionary_library_c.pdb"
+  "libdictionary_library_c.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dictionary_library_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
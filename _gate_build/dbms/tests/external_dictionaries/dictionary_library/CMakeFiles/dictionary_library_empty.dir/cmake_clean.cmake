@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dictionary_library_empty.dir/dictionary_library_empty.cpp.o"
+  "CMakeFiles/dictionary_library_empty.dir/dictionary_library_empty.cpp.o.d"
+  "libdictionary_library_empty.pdb"
+  "libdictionary_library_empty.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dictionary_library_empty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
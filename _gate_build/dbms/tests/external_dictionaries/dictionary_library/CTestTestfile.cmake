@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dbms/tests/external_dictionaries/dictionary_library
+# Build directory: /root/repo/_gate_build/dbms/tests/external_dictionaries/dictionary_library
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
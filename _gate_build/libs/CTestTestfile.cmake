@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs
+# Build directory: /root/repo/_gate_build/libs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("libcommon")
+subdirs("libpocoext")
+subdirs("libdaemon")
+subdirs("libmemcpy")
+subdirs("libglibc-compatibility")
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/libcommon/src/DateLUT.cpp" "libs/libcommon/CMakeFiles/common.dir/src/DateLUT.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/DateLUT.cpp.o.d"
+  "/root/repo/libs/libcommon/src/DateLUTImpl.cpp" "libs/libcommon/CMakeFiles/common.dir/src/DateLUTImpl.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/DateLUTImpl.cpp.o.d"
+  "/root/repo/libs/libcommon/src/JSON.cpp" "libs/libcommon/CMakeFiles/common.dir/src/JSON.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/JSON.cpp.o.d"
+  "/root/repo/libs/libcommon/src/ThreadPool.cpp" "libs/libcommon/CMakeFiles/common.dir/src/ThreadPool.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/libs/libcommon/src/exp10.cpp" "libs/libcommon/CMakeFiles/common.dir/src/exp10.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/exp10.cpp.o.d"
+  "/root/repo/libs/libcommon/src/getMemoryAmount.cpp" "libs/libcommon/CMakeFiles/common.dir/src/getMemoryAmount.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/getMemoryAmount.cpp.o.d"
+  "/root/repo/libs/libcommon/src/iostream_debug_helpers.cpp" "libs/libcommon/CMakeFiles/common.dir/src/iostream_debug_helpers.cpp.o" "gcc" "libs/libcommon/CMakeFiles/common.dir/src/iostream_debug_helpers.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/libs/libpocoext/CMakeFiles/pocoext.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcityhash/CMakeFiles/cityhash.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libcctz/CMakeFiles/cctz.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_system_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libboost/CMakeFiles/boost_filesystem_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libtcmalloc/CMakeFiles/tcmalloc_minimal_internal.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/libs/libmemcpy/CMakeFiles/memcpy.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Util/CMakeFiles/PocoUtil.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Net/CMakeFiles/PocoNet.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/XML/CMakeFiles/PocoXML.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libpoco/Foundation/CMakeFiles/PocoFoundation.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/contrib/libzlib-ng/CMakeFiles/zlibstatic.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
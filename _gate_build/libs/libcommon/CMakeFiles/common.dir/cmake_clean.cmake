@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/common.dir/src/DateLUT.cpp.o"
+  "CMakeFiles/common.dir/src/DateLUT.cpp.o.d"
+  "CMakeFiles/common.dir/src/DateLUTImpl.cpp.o"
+  "CMakeFiles/common.dir/src/DateLUTImpl.cpp.o.d"
+  "CMakeFiles/common.dir/src/JSON.cpp.o"
+  "CMakeFiles/common.dir/src/JSON.cpp.o.d"
+  "CMakeFiles/common.dir/src/ThreadPool.cpp.o"
+  "CMakeFiles/common.dir/src/ThreadPool.cpp.o.d"
+  "CMakeFiles/common.dir/src/exp10.cpp.o"
+  "CMakeFiles/common.dir/src/exp10.cpp.o.d"
+  "CMakeFiles/common.dir/src/getMemoryAmount.cpp.o"
+  "CMakeFiles/common.dir/src/getMemoryAmount.cpp.o.d"
+  "CMakeFiles/common.dir/src/iostream_debug_helpers.cpp.o"
+  "CMakeFiles/common.dir/src/iostream_debug_helpers.cpp.o.d"
+  "libcommon.a"
+  "libcommon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
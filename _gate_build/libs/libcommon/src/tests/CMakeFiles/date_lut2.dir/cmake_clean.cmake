@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/date_lut2.dir/date_lut2.cpp.o"
+  "CMakeFiles/date_lut2.dir/date_lut2.cpp.o.d"
+  "date_lut2"
+  "date_lut2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/date_lut2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
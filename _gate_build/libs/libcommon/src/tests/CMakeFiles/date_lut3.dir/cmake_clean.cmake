@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/date_lut3.dir/date_lut3.cpp.o"
+  "CMakeFiles/date_lut3.dir/date_lut3.cpp.o.d"
+  "date_lut3"
+  "date_lut3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/date_lut3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/date_lut4.dir/date_lut4.cpp.o"
+  "CMakeFiles/date_lut4.dir/date_lut4.cpp.o.d"
+  "date_lut4"
+  "date_lut4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/date_lut4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/date_lut_default_timezone.dir/date_lut_default_timezone.cpp.o"
+  "CMakeFiles/date_lut_default_timezone.dir/date_lut_default_timezone.cpp.o.d"
+  "date_lut_default_timezone"
+  "date_lut_default_timezone.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/date_lut_default_timezone.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
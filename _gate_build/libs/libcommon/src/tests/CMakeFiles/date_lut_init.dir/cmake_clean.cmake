@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/date_lut_init.dir/date_lut_init.cpp.o"
+  "CMakeFiles/date_lut_init.dir/date_lut_init.cpp.o.d"
+  "date_lut_init"
+  "date_lut_init.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/date_lut_init.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
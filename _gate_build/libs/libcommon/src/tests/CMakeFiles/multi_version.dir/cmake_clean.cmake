@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_version.dir/multi_version.cpp.o"
+  "CMakeFiles/multi_version.dir/multi_version.cpp.o.d"
+  "multi_version"
+  "multi_version.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multi_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_libcommon.dir/gtest_json_test.cpp.o"
+  "CMakeFiles/unit_tests_libcommon.dir/gtest_json_test.cpp.o.d"
+  "CMakeFiles/unit_tests_libcommon.dir/gtest_strong_typedef.cpp.o"
+  "CMakeFiles/unit_tests_libcommon.dir/gtest_strong_typedef.cpp.o.d"
+  "unit_tests_libcommon"
+  "unit_tests_libcommon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_libcommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
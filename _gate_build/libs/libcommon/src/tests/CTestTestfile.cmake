@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/libcommon/src/tests
+# Build directory: /root/repo/_gate_build/libs/libcommon/src/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_unit_tests_libcommon "/root/repo/_gate_build/libs/libcommon/src/tests/unit_tests_libcommon")
+set_tests_properties(test_unit_tests_libcommon PROPERTIES  WORKING_DIRECTORY "/root/repo/libs/libcommon/src/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/libs/libcommon/src/tests/CMakeLists.txt;22;add_check;/root/repo/libs/libcommon/src/tests/CMakeLists.txt;0;")
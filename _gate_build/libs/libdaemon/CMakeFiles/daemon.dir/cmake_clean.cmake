@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/daemon.dir/src/BaseDaemon.cpp.o"
+  "CMakeFiles/daemon.dir/src/BaseDaemon.cpp.o.d"
+  "CMakeFiles/daemon.dir/src/GraphiteWriter.cpp.o"
+  "CMakeFiles/daemon.dir/src/GraphiteWriter.cpp.o.d"
+  "CMakeFiles/daemon.dir/src/OwnPatternFormatter.cpp.o"
+  "CMakeFiles/daemon.dir/src/OwnPatternFormatter.cpp.o.d"
+  "libdaemon.a"
+  "libdaemon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/daemon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "ASM"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_ASM
+  "/root/repo/libs/libglibc-compatibility/musl/longjmp.s" "/root/repo/_gate_build/libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/longjmp.s.o"
+  )
+set(CMAKE_ASM_COMPILER_ID "GNU")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_ASM
+  "BOOST_SYSTEM_NO_DEPRECATED"
+  )
+
+# The include file search paths:
+set(CMAKE_ASM_TARGET_INCLUDE_PATH
+  "contrib/libzlib-ng"
+  "/root/repo/contrib/libzlib-ng"
+  "/root/repo/contrib/libpoco/Crypto/include"
+  "/root/repo/contrib/libpoco/NetSSL_OpenSSL/include"
+  "/root/repo/contrib/libpoco/MongoDB/include"
+  "/root/repo/contrib/libpoco/XML/include"
+  "/root/repo/contrib/libpoco/Data/include"
+  "/root/repo/contrib/libpoco/Net/include"
+  "/root/repo/contrib/libpoco/Util/include"
+  "/root/repo/contrib/libpoco/Foundation/include"
+  "/usr/include"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libs/libglibc-compatibility/glibc-compatibility.c" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/glibc-compatibility.c.o" "gcc" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/glibc-compatibility.c.o.d"
+  "/root/repo/libs/libglibc-compatibility/musl/fallocate.c" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/fallocate.c.o" "gcc" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/fallocate.c.o.d"
+  "/root/repo/libs/libglibc-compatibility/musl/lgamma.c" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/lgamma.c.o" "gcc" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/lgamma.c.o.d"
+  "/root/repo/libs/libglibc-compatibility/musl/pipe2.c" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/pipe2.c.o" "gcc" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/pipe2.c.o.d"
+  "/root/repo/libs/libglibc-compatibility/musl/vasprintf.c" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/vasprintf.c.o" "gcc" "libs/libglibc-compatibility/CMakeFiles/glibc-compatibility.dir/musl/vasprintf.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
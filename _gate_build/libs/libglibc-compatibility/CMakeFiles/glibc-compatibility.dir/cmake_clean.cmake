@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/glibc-compatibility.dir/glibc-compatibility.c.o"
+  "CMakeFiles/glibc-compatibility.dir/glibc-compatibility.c.o.d"
+  "CMakeFiles/glibc-compatibility.dir/musl/fallocate.c.o"
+  "CMakeFiles/glibc-compatibility.dir/musl/fallocate.c.o.d"
+  "CMakeFiles/glibc-compatibility.dir/musl/lgamma.c.o"
+  "CMakeFiles/glibc-compatibility.dir/musl/lgamma.c.o.d"
+  "CMakeFiles/glibc-compatibility.dir/musl/longjmp.s.o"
+  "CMakeFiles/glibc-compatibility.dir/musl/pipe2.c.o"
+  "CMakeFiles/glibc-compatibility.dir/musl/pipe2.c.o.d"
+  "CMakeFiles/glibc-compatibility.dir/musl/vasprintf.c.o"
+  "CMakeFiles/glibc-compatibility.dir/musl/vasprintf.c.o.d"
+  "libglibc-compatibility.a"
+  "libglibc-compatibility.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang ASM C)
+  include(CMakeFiles/glibc-compatibility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
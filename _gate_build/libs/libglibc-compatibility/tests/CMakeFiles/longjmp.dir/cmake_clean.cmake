@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/longjmp.dir/longjmp.c.o"
+  "CMakeFiles/longjmp.dir/longjmp.c.o.d"
+  "longjmp"
+  "longjmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/longjmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/siglongjmp.dir/siglongjmp.c.o"
+  "CMakeFiles/siglongjmp.dir/siglongjmp.c.o.d"
+  "siglongjmp"
+  "siglongjmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/siglongjmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libs/libglibc-compatibility/tests
+# Build directory: /root/repo/_gate_build/libs/libglibc-compatibility/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_longjmp "/root/repo/_gate_build/libs/libglibc-compatibility/tests/longjmp")
+set_tests_properties(test_longjmp PROPERTIES  WORKING_DIRECTORY "/root/repo/libs/libglibc-compatibility/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/libs/libglibc-compatibility/tests/CMakeLists.txt;7;add_check;/root/repo/libs/libglibc-compatibility/tests/CMakeLists.txt;0;")
+add_test(test_siglongjmp "/root/repo/_gate_build/libs/libglibc-compatibility/tests/siglongjmp")
+set_tests_properties(test_siglongjmp PROPERTIES  WORKING_DIRECTORY "/root/repo/libs/libglibc-compatibility/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/add_check.cmake;17;add_test;/root/repo/libs/libglibc-compatibility/tests/CMakeLists.txt;7;add_check;/root/repo/libs/libglibc-compatibility/tests/CMakeLists.txt;0;")
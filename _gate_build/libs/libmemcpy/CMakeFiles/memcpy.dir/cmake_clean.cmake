@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memcpy.dir/memcpy.c.o"
+  "CMakeFiles/memcpy.dir/memcpy.c.o.d"
+  "libmemcpy.a"
+  "libmemcpy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/memcpy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
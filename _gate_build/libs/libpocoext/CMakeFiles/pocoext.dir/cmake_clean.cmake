@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pocoext.dir/src/LevelFilterChannel.cpp.o"
+  "CMakeFiles/pocoext.dir/src/LevelFilterChannel.cpp.o.d"
+  "CMakeFiles/pocoext.dir/src/ThreadNumber.cpp.o"
+  "CMakeFiles/pocoext.dir/src/ThreadNumber.cpp.o.d"
+  "libpocoext.a"
+  "libpocoext.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pocoext.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils
+# Build directory: /root/repo/_gate_build/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("compressor")
+subdirs("iotest")
+subdirs("corrector_utf8")
+subdirs("config-processor")
+subdirs("zookeeper-cli")
+subdirs("zookeeper-dump-tree")
+subdirs("zookeeper-remove-by-list")
+subdirs("zookeeper-create-entry-to-download-part")
+subdirs("wikistat-loader")
+subdirs("fill-factor")
+subdirs("check-marks")
+subdirs("test-data-generator")
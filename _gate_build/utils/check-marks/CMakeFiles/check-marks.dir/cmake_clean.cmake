@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/check-marks.dir/main.cpp.o"
+  "CMakeFiles/check-marks.dir/main.cpp.o.d"
+  "check-marks"
+  "check-marks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/check-marks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-compressor.dir/main.cpp.o"
+  "CMakeFiles/clickhouse-compressor.dir/main.cpp.o.d"
+  "clickhouse-compressor"
+  "clickhouse-compressor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-compressor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
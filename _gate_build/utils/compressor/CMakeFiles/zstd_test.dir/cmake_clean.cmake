@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zstd_test.dir/zstd_test.cpp.o"
+  "CMakeFiles/zstd_test.dir/zstd_test.cpp.o.d"
+  "zstd_test"
+  "zstd_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zstd_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/config-processor.dir/config-processor.cpp.o"
+  "CMakeFiles/config-processor.dir/config-processor.cpp.o.d"
+  "config-processor"
+  "config-processor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/config-processor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
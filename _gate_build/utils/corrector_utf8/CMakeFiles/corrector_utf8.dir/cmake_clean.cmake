@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corrector_utf8.dir/corrector_utf8.cpp.o"
+  "CMakeFiles/corrector_utf8.dir/corrector_utf8.cpp.o.d"
+  "corrector_utf8"
+  "corrector_utf8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corrector_utf8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
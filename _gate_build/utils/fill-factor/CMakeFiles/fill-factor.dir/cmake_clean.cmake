@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fill-factor.dir/main.cpp.o"
+  "CMakeFiles/fill-factor.dir/main.cpp.o.d"
+  "fill-factor"
+  "fill-factor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fill-factor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iotest.dir/iotest.cpp.o"
+  "CMakeFiles/iotest.dir/iotest.cpp.o.d"
+  "iotest"
+  "iotest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iotest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
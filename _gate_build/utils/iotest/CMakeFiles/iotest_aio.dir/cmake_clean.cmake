@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iotest_aio.dir/iotest_aio.cpp.o"
+  "CMakeFiles/iotest_aio.dir/iotest_aio.cpp.o.d"
+  "iotest_aio"
+  "iotest_aio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iotest_aio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iotest_nonblock.dir/iotest_nonblock.cpp.o"
+  "CMakeFiles/iotest_nonblock.dir/iotest_nonblock.cpp.o.d"
+  "iotest_nonblock"
+  "iotest_nonblock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iotest_nonblock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
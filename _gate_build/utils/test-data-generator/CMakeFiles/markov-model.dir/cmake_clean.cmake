@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/markov-model.dir/markov-model.cpp.o"
+  "CMakeFiles/markov-model.dir/markov-model.cpp.o.d"
+  "markov-model"
+  "markov-model.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/markov-model.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-data-generator.dir/main.cpp.o"
+  "CMakeFiles/test-data-generator.dir/main.cpp.o.d"
+  "test-data-generator"
+  "test-data-generator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-data-generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
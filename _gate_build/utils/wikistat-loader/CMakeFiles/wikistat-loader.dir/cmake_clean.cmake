@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wikistat-loader.dir/main.cpp.o"
+  "CMakeFiles/wikistat-loader.dir/main.cpp.o.d"
+  "wikistat-loader"
+  "wikistat-loader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wikistat-loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clickhouse-zookeeper-cli.dir/zookeeper-cli.cpp.o"
+  "CMakeFiles/clickhouse-zookeeper-cli.dir/zookeeper-cli.cpp.o.d"
+  "clickhouse-zookeeper-cli"
+  "clickhouse-zookeeper-cli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clickhouse-zookeeper-cli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zookeeper-create-entry-to-download-part.dir/main.cpp.o"
+  "CMakeFiles/zookeeper-create-entry-to-download-part.dir/main.cpp.o.d"
+  "zookeeper-create-entry-to-download-part"
+  "zookeeper-create-entry-to-download-part.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zookeeper-create-entry-to-download-part.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils/zookeeper-create-entry-to-download-part
+# Build directory: /root/repo/_gate_build/utils/zookeeper-create-entry-to-download-part
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zookeeper-dump-tree.dir/main.cpp.o"
+  "CMakeFiles/zookeeper-dump-tree.dir/main.cpp.o.d"
+  "zookeeper-dump-tree"
+  "zookeeper-dump-tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zookeeper-dump-tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zookeeper-remove-by-list.dir/main.cpp.o"
+  "CMakeFiles/zookeeper-remove-by-list.dir/main.cpp.o.d"
+  "zookeeper-remove-by-list"
+  "zookeeper-remove-by-list.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zookeeper-remove-by-list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils/zookeeper-remove-by-list
+# Build directory: /root/repo/_gate_build/utils/zookeeper-remove-by-list
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
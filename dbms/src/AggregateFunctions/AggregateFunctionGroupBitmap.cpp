@@ -0,0 +1,36 @@
+#include <Common/typeid_cast.h>
+#include <AggregateFunctions/AggregateFunctionFactory.h>
+#include <AggregateFunctions/AggregateFunctionGroupBitmap.h>
+
+namespace DB
+{
+
+namespace
+{
+
+AggregateFunctionPtr createAggregateFunctionGroupBitmap(const std::string & name, const DataTypes & argument_types, const Array & parameters)
+{
+    if (argument_types.size() != 1)
+        throw Exception("Incorrect number of arguments for aggregate function " + name,
+            ErrorCodes::NUMBER_OF_ARGUMENTS_DOESNT_MATCH);
+
+    const IDataType & argument_type = *argument_types[0];
+
+         if (typeid_cast<const DataTypeUInt8 *>(&argument_type))    return std::make_shared<AggregateFunctionGroupBitmap<UInt8>>();
+    else if (typeid_cast<const DataTypeUInt16 *>(&argument_type))    return std::make_shared<AggregateFunctionGroupBitmap<UInt16>>();
+    else if (typeid_cast<const DataTypeUInt32 *>(&argument_type))    return std::make_shared<AggregateFunctionGroupBitmap<UInt32>>();
+
+    /// The bitmap holds 32-bit ids; wider types would silently truncate.
+    throw Exception("Illegal type " + argument_type.getName() +
+        " of argument for aggregate function " + name + ", UInt8/UInt16/UInt32 is expected",
+        ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+}
+
+}
+
+void registerAggregateFunctionGroupBitmap(AggregateFunctionFactory & factory)
+{
+    factory.registerFunction("groupBitmap", createAggregateFunctionGroupBitmap);
+}
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <IO/WriteHelpers.h>
+#include <IO/ReadHelpers.h>
+
+#include <DataTypes/DataTypesNumber.h>
+
+#include <Columns/ColumnsNumber.h>
+
+#include <AggregateFunctions/IUnaryAggregateFunction.h>
+#include <AggregateFunctions/RoaringBitmap.h>
+
+
+namespace DB
+{
+
+/** The state is not templated on the input type: ids of any width up to 32 bits
+  *  go into the same bitmap, so states built over UInt8/16/32 columns interchange freely
+  *  and the scalar bitmap functions (see FunctionsBitmap.cpp) work on any of them.
+  */
+struct AggregateFunctionGroupBitmapData
+{
+    RoaringBitmap bitmap;
+};
+
+
+/// Collects values into a compressed bitmap. Returns its cardinality.
+template <typename T>
+class AggregateFunctionGroupBitmap
+    : public IUnaryAggregateFunction<AggregateFunctionGroupBitmapData, AggregateFunctionGroupBitmap<T>>
+{
+public:
+    String getName() const override { return "groupBitmap"; }
+
+    DataTypePtr getReturnType() const override
+    {
+        return std::make_shared<DataTypeUInt64>();
+    }
+
+    void setArgument(const DataTypePtr & argument)
+    {
+    }
+
+    void addImpl(AggregateDataPtr place, const IColumn & column, size_t row_num, Arena *) const
+    {
+        this->data(place).bitmap.add(static_cast<const ColumnVector<T> &>(column).getData()[row_num]);
+    }
+
+    void merge(AggregateDataPtr place, ConstAggregateDataPtr rhs, Arena *) const override
+    {
+        this->data(place).bitmap.merge(this->data(rhs).bitmap);
+    }
+
+    void serialize(ConstAggregateDataPtr place, WriteBuffer & buf) const override
+    {
+        this->data(place).bitmap.write(buf);
+    }
+
+    void deserialize(AggregateDataPtr place, ReadBuffer & buf, Arena *) const override
+    {
+        this->data(place).bitmap.read(buf);
+    }
+
+    void insertResultInto(ConstAggregateDataPtr place, IColumn & to) const override
+    {
+        static_cast<ColumnUInt64 &>(to).getData().push_back(this->data(place).bitmap.size());
+    }
+
+    const char * getHeaderFilePath() const override { return __FILE__; }
+};
+
+}
@@ -59,6 +59,12 @@ public:
         readBinary(this->data(place).sum, buf);
     }
 
+    size_t sizeOfFixedLayoutSerialization() const override
+    {
+        /// writeBinary of the bare value: the state and its serialization are the same bytes.
+        return sizeof(AggregateFunctionSumData<typename NearestFieldType<T>::Type>);
+    }
+
     void insertResultInto(ConstAggregateDataPtr place, IColumn & to) const override
     {
         static_cast<ColumnVector<typename NearestFieldType<T>::Type> &>(to).getData().push_back(this->data(place).sum);
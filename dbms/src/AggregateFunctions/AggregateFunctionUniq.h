@@ -14,9 +14,11 @@
 
 #include <Interpreters/AggregationCommon.h>
 #include <Common/HashTable/HashSet.h>
+#include <Common/HashTable/TwoLevelHashSet.h>
 #include <Common/HyperLogLogWithSmallSetOptimization.h>
 #include <Common/CombinedCardinalityEstimator.h>
 #include <Common/MemoryTracker.h>
+#include <Common/PODArray.h>
 
 #include <Columns/ColumnString.h>
 #include <Columns/ColumnTuple.h>
@@ -24,6 +26,7 @@
 
 #include <AggregateFunctions/IUnaryAggregateFunction.h>
 #include <AggregateFunctions/UniqCombinedBiasData.h>
+#include <AggregateFunctions/UniqExactSet.h>
 #include <AggregateFunctions/UniqVariadicHash.h>
 
 
@@ -86,13 +89,18 @@ struct AggregateFunctionUniqExactData
 {
     using Key = T;
 
-    /// When creating, the hash table must be small.
-    using Set = HashSet<
+    /// When creating, the hash table must be small. Above a size threshold it is converted
+    ///  to a two-level table, so that large states are merged bucket by bucket (see UniqExactSet.h).
+    using SingleLevelSet = HashSet<
         Key,
         HashCRC32<Key>,
         HashTableGrower<4>,
         HashTableAllocatorWithStackMemory<sizeof(Key) * (1 << 4)>>;
 
+    using TwoLevelSet = TwoLevelHashSet<Key, HashCRC32<Key>, TwoLevelHashTableGrower<4>>;
+
+    using Set = UniqExactSet<SingleLevelSet, TwoLevelSet>;
+
     Set set;
 
     static String getName() { return "uniqExact"; }
@@ -104,13 +112,18 @@ struct AggregateFunctionUniqExactData<String>
 {
     using Key = UInt128;
 
-    /// When creating, the hash table must be small.
-    using Set = HashSet<
+    /// When creating, the hash table must be small. Above a size threshold it is converted
+    ///  to a two-level table, so that large states are merged bucket by bucket (see UniqExactSet.h).
+    using SingleLevelSet = HashSet<
         Key,
         UInt128TrivialHash,
         HashTableGrower<3>,
         HashTableAllocatorWithStackMemory<sizeof(Key) * (1 << 3)>>;
 
+    using TwoLevelSet = TwoLevelHashSet<Key, UInt128TrivialHash, TwoLevelHashTableGrower<4>>;
+
+    using Set = UniqExactSet<SingleLevelSet, TwoLevelSet>;
+
     Set set;
 
     static String getName() { return "uniqExact"; }
@@ -402,6 +415,16 @@ public:
         this->data(place).set.insert(UniqVariadicHash<is_exact, argument_is_tuple>::apply(num_args, columns, row_num));
     }
 
+    void addBatch(size_t rows, AggregateDataPtr * places, size_t place_offset, const IColumn ** columns, Arena * arena) const override
+    {
+        addBatchImpl<is_exact>(rows, places, place_offset, columns, arena);
+    }
+
+    void addBatchSinglePlace(size_t rows, AggregateDataPtr place, const IColumn ** columns, Arena * arena) const override
+    {
+        addBatchSinglePlaceImpl<is_exact>(rows, place, columns, arena);
+    }
+
     void merge(AggregateDataPtr place, ConstAggregateDataPtr rhs, Arena * arena) const override
     {
         this->data(place).set.merge(this->data(rhs).set);
@@ -430,6 +453,47 @@ public:
     IAggregateFunction::AddFunc getAddressOfAddFunction() const override final { return &addFree; }
 
     const char * getHeaderFilePath() const override { return __FILE__; }
+
+private:
+    /** With a 64-bit hash, all the rows of the block are hashed at once: for fixed-width
+      *  arguments the hash loop reads the column data directly, without per-row virtual calls
+      *  (see UniqVariadicHash.h). The 128-bit SipHash of uniqExact has no batch variant.
+      */
+    template <bool e>
+    typename std::enable_if<!e>::type addBatchImpl(size_t rows, AggregateDataPtr * places, size_t place_offset, const IColumn ** columns, Arena *) const
+    {
+        PODArray<UInt64> hashes(rows);
+        UniqVariadicHash<false, argument_is_tuple>::apply(num_args, columns, rows, hashes.data());
+
+        for (size_t i = 0; i < rows; ++i)
+            if (places[i])
+                this->data(places[i] + place_offset).set.insert(hashes[i]);
+    }
+
+    template <bool e>
+    typename std::enable_if<e>::type addBatchImpl(size_t rows, AggregateDataPtr * places, size_t place_offset, const IColumn ** columns, Arena * arena) const
+    {
+        for (size_t i = 0; i < rows; ++i)
+            if (places[i])
+                add(places[i] + place_offset, columns, i, arena);
+    }
+
+    template <bool e>
+    typename std::enable_if<!e>::type addBatchSinglePlaceImpl(size_t rows, AggregateDataPtr place, const IColumn ** columns, Arena *) const
+    {
+        PODArray<UInt64> hashes(rows);
+        UniqVariadicHash<false, argument_is_tuple>::apply(num_args, columns, rows, hashes.data());
+
+        for (size_t i = 0; i < rows; ++i)
+            this->data(place).set.insert(hashes[i]);
+    }
+
+    template <bool e>
+    typename std::enable_if<e>::type addBatchSinglePlaceImpl(size_t rows, AggregateDataPtr place, const IColumn ** columns, Arena * arena) const
+    {
+        for (size_t i = 0; i < rows; ++i)
+            add(place, columns, i, arena);
+    }
 };
 
 
@@ -98,15 +98,48 @@ public:
      */
     virtual void add(AggregateDataPtr place, const IColumn ** columns, size_t row_num, Arena * arena) const = 0;
 
+    /** Adds the rows [0, rows) into the aggregation states places[i] + place_offset.
+      * places[i] may be nullptr - then the row is skipped.
+      * One call per block instead of one virtual call per row; the implementations for specific
+      *  functions are tight loops over the column data, suitable for vectorization.
+      */
+    virtual void addBatch(size_t rows, AggregateDataPtr * places, size_t place_offset, const IColumn ** columns, Arena * arena) const
+    {
+        for (size_t i = 0; i < rows; ++i)
+            if (places[i])
+                add(places[i] + place_offset, columns, i, arena);
+    }
+
+    /// The same for the case when all rows are added into the same aggregation state.
+    virtual void addBatchSinglePlace(size_t rows, AggregateDataPtr place, const IColumn ** columns, Arena * arena) const
+    {
+        for (size_t i = 0; i < rows; ++i)
+            add(place, columns, i, arena);
+    }
+
     /// Merges state (on which place points to) with other state of current aggregation function.
     virtual void merge(AggregateDataPtr place, ConstAggregateDataPtr rhs, Arena * arena) const = 0;
 
     /// Serializes state (to transmit it over the network, for example).
     virtual void serialize(ConstAggregateDataPtr place, WriteBuffer & buf) const = 0;
 
+    /// Serializes a batch of states: one virtual call per block instead of one per value.
+    virtual void serializeBatch(const AggregateDataPtr * places, size_t count, WriteBuffer & buf) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            serialize(places[i], buf);
+    }
+
     /// Deserializes state. This function is called only for empty (just created) states.
     virtual void deserialize(AggregateDataPtr place, ReadBuffer & buf, Arena * arena) const = 0;
 
+    /** Serialized size of a state, if every state is serialized as a plain copy of its
+      *  `sizeOfData` bytes (e.g. `sum` writes the bare value). 0 otherwise.
+      * Such states are read in bulk - one memcpy per buffer instead of per-state
+      *  `create` and `deserialize` calls (see DataTypeAggregateFunction::deserializeBinaryBulk).
+      */
+    virtual size_t sizeOfFixedLayoutSerialization() const { return 0; }
+
     /// Returns true if a function requires Arena to handle own states (see add(), merge(), deserialize()).
     virtual bool allocatesMemoryInArena() const
     {
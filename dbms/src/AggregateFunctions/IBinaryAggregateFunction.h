@@ -35,6 +35,19 @@ public:
     }
 
     IAggregateFunction::AddFunc getAddressOfAddFunction() const override final { return &addFree; }
+
+    void addBatch(size_t rows, AggregateDataPtr * places, size_t place_offset, const IColumn ** columns, Arena * arena) const override final
+    {
+        for (size_t i = 0; i < rows; ++i)
+            if (places[i])
+                getDerived().addImpl(places[i] + place_offset, *columns[0], *columns[1], i, arena);
+    }
+
+    void addBatchSinglePlace(size_t rows, AggregateDataPtr place, const IColumn ** columns, Arena * arena) const override final
+    {
+        for (size_t i = 0; i < rows; ++i)
+            getDerived().addImpl(place, *columns[0], *columns[1], i, arena);
+    }
 };
 
 }
@@ -39,6 +39,20 @@ public:
 
     IAggregateFunction::AddFunc getAddressOfAddFunction() const override { return &addFree; }
 
+    /// In these loops, addImpl is inlined: for trivial functions (sum, min, avg...) they vectorize.
+    void addBatch(size_t rows, AggregateDataPtr * places, size_t place_offset, const IColumn ** columns, Arena * arena) const override final
+    {
+        for (size_t i = 0; i < rows; ++i)
+            if (places[i])
+                getDerived().addImpl(places[i] + place_offset, *columns[0], i, arena);
+    }
+
+    void addBatchSinglePlace(size_t rows, AggregateDataPtr place, const IColumn ** columns, Arena * arena) const override final
+    {
+        for (size_t i = 0; i < rows; ++i)
+            getDerived().addImpl(place, *columns[0], i, arena);
+    }
+
     /** Implement the following in descendant class:
       * void addImpl(AggregateDataPtr place, const IColumn & column, size_t row_num, Arena * arena) const;
       * void setArgument(const DataTypePtr & argument);
@@ -0,0 +1,409 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <algorithm>
+
+#include <Core/Types.h>
+#include <IO/WriteBuffer.h>
+#include <IO/WriteHelpers.h>
+#include <IO/ReadBuffer.h>
+#include <IO/ReadHelpers.h>
+#include <IO/VarInt.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int INCORRECT_DATA;
+}
+
+/** A compressed bitmap over UInt32 values, in the spirit of Roaring bitmaps
+  *  (Chambi et al., "Better bitmap performance with Roaring bitmaps").
+  *
+  * The value space is split by the upper 16 bits into containers of 2^16 values each.
+  * A container stores the lower 16 bits of its values as a sorted array while it has
+  *  at most 4096 of them, and as a fixed 8 KiB bitset above that - so dense id sets
+  *  take at most one bit per value, and sparse ones two bytes per value.
+  *
+  * and/or/andnot work container against container: bitsets with 64-bit words (the loops
+  *  vectorize), sorted arrays by merging; a bitset container degrades back to an array
+  *  as soon as an operation makes it sparse, keeping results compact.
+  */
+class RoaringBitmap
+{
+public:
+    void add(UInt32 x)
+    {
+        Container & container = containers[x >> 16];
+        UInt16 low = x & 0xFFFF;
+
+        if (container.isArray())
+        {
+            auto it = std::lower_bound(container.array.begin(), container.array.end(), low);
+            if (it != container.array.end() && *it == low)
+                return;
+
+            if (container.array.size() < max_array_size)
+            {
+                container.array.insert(it, low);
+                return;
+            }
+
+            convertToBitset(container);
+        }
+
+        UInt64 & word = container.bitset[low >> 6];
+        UInt64 mask = 1ULL << (low & 63);
+
+        if (!(word & mask))
+        {
+            word |= mask;
+            ++container.count;
+        }
+    }
+
+    /// Bitwise OR.
+    void merge(const RoaringBitmap & rhs)
+    {
+        for (const auto & rhs_elem : rhs.containers)
+        {
+            auto it = containers.find(rhs_elem.first);
+            if (it == containers.end())
+            {
+                containers[rhs_elem.first] = rhs_elem.second;
+                continue;
+            }
+
+            orContainers(it->second, rhs_elem.second);
+        }
+    }
+
+    /// Bitwise AND.
+    void intersect(const RoaringBitmap & rhs)
+    {
+        for (auto it = containers.begin(); it != containers.end();)
+        {
+            auto rhs_it = rhs.containers.find(it->first);
+            if (rhs_it == rhs.containers.end())
+            {
+                it = containers.erase(it);
+                continue;
+            }
+
+            andContainers(it->second, rhs_it->second);
+
+            if (cardinality(it->second))
+                ++it;
+            else
+                it = containers.erase(it);
+        }
+    }
+
+    /// Bitwise AND NOT: remove the values present in `rhs`.
+    void subtract(const RoaringBitmap & rhs)
+    {
+        for (auto it = containers.begin(); it != containers.end();)
+        {
+            auto rhs_it = rhs.containers.find(it->first);
+            if (rhs_it != rhs.containers.end())
+                andnotContainers(it->second, rhs_it->second);
+
+            if (cardinality(it->second))
+                ++it;
+            else
+                it = containers.erase(it);
+        }
+    }
+
+    size_t size() const
+    {
+        size_t res = 0;
+        for (const auto & elem : containers)
+            res += cardinality(elem.second);
+        return res;
+    }
+
+    void write(WriteBuffer & out) const
+    {
+        writeVarUInt(containers.size(), out);
+
+        for (const auto & elem : containers)
+        {
+            writeBinary(elem.first, out);
+            const Container & container = elem.second;
+
+            writeBinary(UInt8(container.isArray() ? 0 : 1), out);
+
+            if (container.isArray())
+            {
+                writeVarUInt(container.array.size(), out);
+                out.write(reinterpret_cast<const char *>(container.array.data()), container.array.size() * sizeof(UInt16));
+            }
+            else
+            {
+                writeVarUInt(container.count, out);
+                out.write(reinterpret_cast<const char *>(container.bitset.data()), bitset_words * sizeof(UInt64));
+            }
+        }
+    }
+
+    void read(ReadBuffer & in)
+    {
+        size_t num_containers = 0;
+        readVarUInt(num_containers, in);
+
+        for (size_t i = 0; i < num_containers; ++i)
+        {
+            UInt16 key = 0;
+            readBinary(key, in);
+
+            UInt8 is_bitset = 0;
+            readBinary(is_bitset, in);
+
+            Container & container = containers[key];
+
+            if (!is_bitset)
+            {
+                size_t size = 0;
+                readVarUInt(size, in);
+
+                if (size > max_array_size)
+                    throw Exception("Too large array container in serialized bitmap", ErrorCodes::INCORRECT_DATA);
+
+                size_t old_size = container.array.size();
+                container.array.resize(old_size + size);
+                in.readStrict(reinterpret_cast<char *>(container.array.data() + old_size), size * sizeof(UInt16));
+
+                /// Merging into an existing container (possible if the state was merged) keeps it sorted.
+                if (old_size)
+                {
+                    std::inplace_merge(container.array.begin(), container.array.begin() + old_size, container.array.end());
+                    container.array.erase(std::unique(container.array.begin(), container.array.end()), container.array.end());
+                }
+
+                if (!container.isArray())
+                    throw Exception("Array container after bitset container for the same key in serialized bitmap", ErrorCodes::INCORRECT_DATA);
+            }
+            else
+            {
+                size_t count = 0;
+                readVarUInt(count, in);
+
+                Container read_container;
+                read_container.bitset.resize(bitset_words);
+                read_container.count = count;
+                in.readStrict(reinterpret_cast<char *>(read_container.bitset.data()), bitset_words * sizeof(UInt64));
+
+                if (cardinality(container))
+                    orContainers(read_container, container);
+
+                container = std::move(read_container);
+            }
+        }
+    }
+
+private:
+    /// A container keeps at most this many values as a sorted array; above - as a bitset.
+    static constexpr size_t max_array_size = 4096;
+    static constexpr size_t bitset_words = (1 << 16) / 64;
+
+    struct Container
+    {
+        /// The lower 16 bits of the values, sorted, while the container is small.
+        std::vector<UInt16> array;
+        /// Either empty, or `bitset_words` words; then `array` is empty and `count` is the number of set bits.
+        std::vector<UInt64> bitset;
+        size_t count = 0;
+
+        bool isArray() const { return bitset.empty(); }
+    };
+
+    std::map<UInt16, Container> containers;
+
+    static size_t cardinality(const Container & container)
+    {
+        return container.isArray() ? container.array.size() : container.count;
+    }
+
+    static void convertToBitset(Container & container)
+    {
+        container.bitset.assign(bitset_words, 0);
+        for (UInt16 v : container.array)
+            container.bitset[v >> 6] |= 1ULL << (v & 63);
+
+        container.count = container.array.size();
+        std::vector<UInt16>().swap(container.array);
+    }
+
+    /// A bitset container that became sparse goes back to a sorted array, keeping results compact.
+    static void convertToArrayIfSparse(Container & container)
+    {
+        if (container.isArray() || container.count > max_array_size)
+            return;
+
+        std::vector<UInt16> array;
+        array.reserve(container.count);
+
+        for (size_t word = 0; word < bitset_words; ++word)
+            for (UInt64 bits = container.bitset[word]; bits; bits &= bits - 1)
+                array.push_back(word * 64 + __builtin_ctzll(bits));
+
+        container.array = std::move(array);
+        std::vector<UInt64>().swap(container.bitset);
+        container.count = 0;
+    }
+
+    static void orContainers(Container & lhs, const Container & rhs)
+    {
+        if (lhs.isArray() && rhs.isArray())
+        {
+            std::vector<UInt16> merged;
+            merged.reserve(lhs.array.size() + rhs.array.size());
+            std::set_union(lhs.array.begin(), lhs.array.end(), rhs.array.begin(), rhs.array.end(), std::back_inserter(merged));
+
+            if (merged.size() <= max_array_size)
+            {
+                lhs.array = std::move(merged);
+                return;
+            }
+
+            convertToBitset(lhs);
+        }
+
+        if (lhs.isArray())
+        {
+            /// lhs is an array, rhs is a bitset: start from a copy of the bigger side.
+            Container res = rhs;
+            for (UInt16 v : lhs.array)
+            {
+                UInt64 & word = res.bitset[v >> 6];
+                UInt64 mask = 1ULL << (v & 63);
+                if (!(word & mask))
+                {
+                    word |= mask;
+                    ++res.count;
+                }
+            }
+            lhs = std::move(res);
+            return;
+        }
+
+        if (rhs.isArray())
+        {
+            for (UInt16 v : rhs.array)
+            {
+                UInt64 & word = lhs.bitset[v >> 6];
+                UInt64 mask = 1ULL << (v & 63);
+                if (!(word & mask))
+                {
+                    word |= mask;
+                    ++lhs.count;
+                }
+            }
+            return;
+        }
+
+        size_t count = 0;
+        for (size_t word = 0; word < bitset_words; ++word)
+        {
+            lhs.bitset[word] |= rhs.bitset[word];
+            count += __builtin_popcountll(lhs.bitset[word]);
+        }
+        lhs.count = count;
+    }
+
+    static void andContainers(Container & lhs, const Container & rhs)
+    {
+        if (lhs.isArray() && rhs.isArray())
+        {
+            std::vector<UInt16> res;
+            std::set_intersection(lhs.array.begin(), lhs.array.end(), rhs.array.begin(), rhs.array.end(), std::back_inserter(res));
+            lhs.array = std::move(res);
+            return;
+        }
+
+        if (lhs.isArray())
+        {
+            lhs.array.erase(
+                std::remove_if(lhs.array.begin(), lhs.array.end(),
+                    [&](UInt16 v) { return !(rhs.bitset[v >> 6] & (1ULL << (v & 63))); }),
+                lhs.array.end());
+            return;
+        }
+
+        if (rhs.isArray())
+        {
+            /// The result is at most the rhs array: filter it by our bits and become an array.
+            std::vector<UInt16> res;
+            for (UInt16 v : rhs.array)
+                if (lhs.bitset[v >> 6] & (1ULL << (v & 63)))
+                    res.push_back(v);
+
+            lhs.array = std::move(res);
+            std::vector<UInt64>().swap(lhs.bitset);
+            lhs.count = 0;
+            return;
+        }
+
+        size_t count = 0;
+        for (size_t word = 0; word < bitset_words; ++word)
+        {
+            lhs.bitset[word] &= rhs.bitset[word];
+            count += __builtin_popcountll(lhs.bitset[word]);
+        }
+        lhs.count = count;
+
+        convertToArrayIfSparse(lhs);
+    }
+
+    static void andnotContainers(Container & lhs, const Container & rhs)
+    {
+        if (lhs.isArray() && rhs.isArray())
+        {
+            std::vector<UInt16> res;
+            std::set_difference(lhs.array.begin(), lhs.array.end(), rhs.array.begin(), rhs.array.end(), std::back_inserter(res));
+            lhs.array = std::move(res);
+            return;
+        }
+
+        if (lhs.isArray())
+        {
+            lhs.array.erase(
+                std::remove_if(lhs.array.begin(), lhs.array.end(),
+                    [&](UInt16 v) { return rhs.bitset[v >> 6] & (1ULL << (v & 63)); }),
+                lhs.array.end());
+            return;
+        }
+
+        if (rhs.isArray())
+        {
+            for (UInt16 v : rhs.array)
+            {
+                UInt64 & word = lhs.bitset[v >> 6];
+                UInt64 mask = 1ULL << (v & 63);
+                if (word & mask)
+                {
+                    word &= ~mask;
+                    --lhs.count;
+                }
+            }
+        }
+        else
+        {
+            size_t count = 0;
+            for (size_t word = 0; word < bitset_words; ++word)
+            {
+                lhs.bitset[word] &= ~rhs.bitset[word];
+                count += __builtin_popcountll(lhs.bitset[word]);
+            }
+            lhs.count = count;
+        }
+
+        convertToArrayIfSparse(lhs);
+    }
+};
+
+}
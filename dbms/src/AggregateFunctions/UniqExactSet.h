@@ -0,0 +1,129 @@
+#pragma once
+
+#include <memory>
+
+#include <IO/WriteBuffer.h>
+#include <IO/ReadBuffer.h>
+#include <IO/VarInt.h>
+
+
+namespace DB
+{
+
+/** A set of keys for uniqExact: a flat hash table while small, converted to a two-level
+  *  hash table (256 buckets of the first level) above a size threshold.
+  *
+  * The two-level representation pays off on large states:
+  * - two such sets are merged bucket by bucket, so one step works over a small hash table
+  *   that fits in cache instead of the whole state, and the buckets are independent;
+  * - resizes happen per bucket, so their latency is amortized.
+  *
+  * A serialized state is merged in streaming fashion, inserting the keys as they are read,
+  *  without materializing the second set (see `readAndMerge`).
+  *
+  * The serialization format is the same for both representations (the number of keys, then
+  *  the keys), so the states interchange freely with each other and with older servers.
+  */
+template <typename SingleLevelSet, typename TwoLevelSet>
+class UniqExactSet
+{
+public:
+    using Key = typename SingleLevelSet::key_type;
+    using Cell = typename SingleLevelSet::Cell;
+
+    /// Convert to the two-level representation above this many keys.
+    static constexpr size_t TWO_LEVEL_THRESHOLD = 1 << 15;
+
+    void insert(Key key)
+    {
+        if (two_level)
+        {
+            two_level->insert(key);
+        }
+        else
+        {
+            single_level.insert(key);
+            if (single_level.size() > TWO_LEVEL_THRESHOLD)
+                convertToTwoLevel();
+        }
+    }
+
+    void merge(const UniqExactSet & rhs)
+    {
+        if (!two_level && !rhs.two_level
+            && single_level.size() + rhs.single_level.size() <= TWO_LEVEL_THRESHOLD)
+        {
+            single_level.merge(rhs.single_level);
+            return;
+        }
+
+        if (!two_level)
+            convertToTwoLevel();
+
+        if (rhs.two_level)
+        {
+            /// Bucket by bucket: each step works over one small pair of tables.
+            for (size_t i = 0; i < TwoLevelSet::NUM_BUCKETS; ++i)
+                two_level->impls[i].merge(rhs.two_level->impls[i]);
+        }
+        else
+        {
+            for (auto it = rhs.single_level.begin(); it != rhs.single_level.end(); ++it)
+                two_level->insert(*it);
+        }
+    }
+
+    void write(DB::WriteBuffer & wb) const
+    {
+        if (!two_level)
+        {
+            single_level.write(wb);
+            return;
+        }
+
+        /// The same format as the flat table writes (the cell state of a set is empty).
+        DB::writeVarUInt(two_level->size(), wb);
+
+        for (auto it = two_level->begin(); it != two_level->end(); ++it)
+            it.getPtr()->write(wb);
+    }
+
+    /// Insert the keys of a serialized set as they are read, without materializing it.
+    void readAndMerge(DB::ReadBuffer & rb)
+    {
+        size_t new_size = 0;
+        DB::readVarUInt(new_size, rb);
+
+        if (!two_level && single_level.size() + new_size > TWO_LEVEL_THRESHOLD)
+            convertToTwoLevel();
+
+        for (size_t i = 0; i < new_size; ++i)
+        {
+            Cell x;
+            x.read(rb);
+            insert(Cell::getKey(x.getValue()));
+        }
+    }
+
+    void read(DB::ReadBuffer & rb)
+    {
+        readAndMerge(rb);
+    }
+
+    size_t size() const
+    {
+        return two_level ? two_level->size() : single_level.size();
+    }
+
+private:
+    SingleLevelSet single_level;
+    std::unique_ptr<TwoLevelSet> two_level;
+
+    void convertToTwoLevel()
+    {
+        two_level = std::make_unique<TwoLevelSet>(single_level);
+        single_level.clearAndShrink();
+    }
+};
+
+}
@@ -9,6 +9,7 @@ void registerAggregateFunctionAvg(AggregateFunctionFactory & factory);
 void registerAggregateFunctionCount(AggregateFunctionFactory & factory);
 void registerAggregateFunctionGroupArray(AggregateFunctionFactory & factory);
 void registerAggregateFunctionGroupUniqArray(AggregateFunctionFactory & factory);
+void registerAggregateFunctionGroupBitmap(AggregateFunctionFactory & factory);
 void registerAggregateFunctionGroupArrayInsertAt(AggregateFunctionFactory & factory);
 void registerAggregateFunctionsQuantile(AggregateFunctionFactory & factory);
 void registerAggregateFunctionsQuantileExact(AggregateFunctionFactory & factory);
@@ -35,6 +36,7 @@ void registerAggregateFunctions()
     registerAggregateFunctionCount(factory);
     registerAggregateFunctionGroupArray(factory);
     registerAggregateFunctionGroupUniqArray(factory);
+    registerAggregateFunctionGroupBitmap(factory);
     registerAggregateFunctionGroupArrayInsertAt(factory);
     registerAggregateFunctionsQuantile(factory);
     registerAggregateFunctionsQuantileExact(factory);
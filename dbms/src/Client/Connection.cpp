@@ -309,12 +309,35 @@ void Connection::sendQuery(
         connect();
 
     network_compression_method = settings ? settings->network_compression_method.value : CompressionMethod::LZ4;
+    network_zstd_compression_level = settings ? settings->network_zstd_compression_level.value : 1;
+    lazy_columns = settings && settings->network_lazy_columns
+        && server_revision >= DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES;
 
     query_id = query_id_;
 
     //LOG_TRACE(log_wrapper.get(), "Sending query");
 
     writeVarUInt(Protocol::Client::Query, *out);
+    sendQueryHeader(stage, settings, client_info);
+
+    writeStringBinary(query, *out);
+
+    maybe_compressed_in.reset();
+    maybe_compressed_out.reset();
+    block_in.reset();
+    block_out.reset();
+
+    /// Send empty block which means end of data.
+    if (!with_pending_data)
+    {
+        sendData(Block());
+        out->next();
+    }
+}
+
+
+void Connection::sendQueryHeader(UInt64 stage, const Settings * settings, const ClientInfo * client_info)
+{
     writeStringBinary(query_id, *out);
 
     /// Client info.
@@ -347,20 +370,69 @@ void Connection::sendQuery(
 
     writeVarUInt(stage, *out);
     writeVarUInt(static_cast<bool>(compression), *out);
+}
+
+
+void Connection::sendPrepare(const String & statement_id, const String & query)
+{
+    if (!connected)
+        connect();
+
+    if (server_revision < DBMS_MIN_REVISION_WITH_PREPARED_STATEMENTS)
+        throw Exception("Server " + getDescription() + " is too old to support prepared statements",
+            ErrorCodes::SERVER_REVISION_IS_TOO_OLD);
 
+    writeVarUInt(Protocol::Client::Prepare, *out);
+    writeStringBinary(statement_id, *out);
     writeStringBinary(query, *out);
+    out->next();
+
+    /// The server responds with Prepared on success or with Exception.
+    Packet packet = receivePacket();
+
+    if (packet.type == Protocol::Server::Exception)
+        packet.exception->rethrow();
+    else if (packet.type != Protocol::Server::Prepared)
+        throw NetException("Unexpected packet from server " + getDescription()
+            + " (expected Prepared, got " + String(Protocol::Server::toString(packet.type)) + ")",
+            ErrorCodes::UNEXPECTED_PACKET_FROM_SERVER);
+}
+
+
+void Connection::sendQueryPrepared(
+    const String & statement_id,
+    const std::vector<String> & parameters,
+    const String & query_id_,
+    UInt64 stage,
+    const Settings * settings,
+    const ClientInfo * client_info)
+{
+    if (!connected)
+        connect();
+
+    network_compression_method = settings ? settings->network_compression_method.value : CompressionMethod::LZ4;
+    network_zstd_compression_level = settings ? settings->network_zstd_compression_level.value : 1;
+    lazy_columns = settings && settings->network_lazy_columns
+        && server_revision >= DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES;
+
+    query_id = query_id_;
+
+    writeVarUInt(Protocol::Client::ExecutePrepared, *out);
+    sendQueryHeader(stage, settings, client_info);
+
+    writeStringBinary(statement_id, *out);
+    writeVarUInt(parameters.size(), *out);
+    for (const String & parameter : parameters)
+        writeStringBinary(parameter, *out);
 
     maybe_compressed_in.reset();
     maybe_compressed_out.reset();
     block_in.reset();
     block_out.reset();
 
-    /// Send empty block which means end of data.
-    if (!with_pending_data)
-    {
-        sendData(Block());
-        out->next();
-    }
+    /// Send empty block which means end of data (no external tables).
+    sendData(Block());
+    out->next();
 }
 
 
@@ -380,7 +452,8 @@ void Connection::sendData(const Block & block, const String & name)
     if (!block_out)
     {
         if (compression == Protocol::Compression::Enable)
-            maybe_compressed_out = std::make_shared<CompressedWriteBuffer>(*out, network_compression_method);
+            maybe_compressed_out = std::make_shared<CompressedWriteBuffer>(*out, network_compression_method,
+                DBMS_DEFAULT_BUFFER_SIZE, 1, false, network_zstd_compression_level);
         else
             maybe_compressed_out = out;
 
@@ -519,6 +592,9 @@ Connection::Packet Connection::receivePacket()
             case Protocol::Server::EndOfStream:
                 return res;
 
+            case Protocol::Server::Prepared:
+                return res;
+
             default:
                 /// In unknown state, disconnect - to not leave unsynchronised connection.
                 disconnect();
@@ -570,6 +646,9 @@ void Connection::initBlockInput()
 
         block_in = std::make_shared<NativeBlockInputStream>(*maybe_compressed_in, server_revision);
     }
+
+    /// The setting may differ between queries executed over the same connection.
+    block_in->setLazyColumns(lazy_columns);
 }
 
 
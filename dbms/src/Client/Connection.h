@@ -26,6 +26,7 @@ namespace DB
 {
 
 class ClientInfo;
+class NativeBlockInputStream;
 
 /// The stream of blocks reading from the table and its name
 using ExternalTableData = std::pair<BlockInputStreamPtr, std::string>;
@@ -151,6 +152,20 @@ public:
         const ClientInfo * client_info = nullptr,
         bool with_pending_data = false);
 
+    /// Register a prepared statement (a query with ?1, ?2, ... placeholders) on the server under the given id.
+    /// Waits for the server's acknowledgement; throws the server exception if registration failed.
+    void sendPrepare(const String & statement_id, const String & query);
+
+    /// Execute a previously registered prepared statement.
+    /// Parameters are literals in SQL syntax, substituted for ?1, ?2, ... in order.
+    void sendQueryPrepared(
+        const String & statement_id,
+        const std::vector<String> & parameters,
+        const String & query_id_ = "",
+        UInt64 stage = QueryProcessingStage::Complete,
+        const Settings * settings = nullptr,
+        const ClientInfo * client_info = nullptr);
+
     void sendCancel();
     /// Send block of data; if name is specified, server will write it to external (temporary) table of that name.
     void sendData(const Block & block, const String & name = "");
@@ -224,6 +239,10 @@ private:
     Protocol::Encryption encryption;             /// Enable data encryption for communication.
     /// What compression algorithm to use while sending data for INSERT queries and external tables.
     CompressionMethod network_compression_method = CompressionMethod::LZ4;
+    int network_zstd_compression_level = 1;
+
+    /// Whether to receive columns of blocks in serialized form, deserializing them only on access.
+    bool lazy_columns = false;
 
     /** If not nullptr, used to limit network traffic.
       * Only traffic for transferring blocks is accounted. Other packets don't.
@@ -237,7 +256,7 @@ private:
 
     /// From where to read query execution result.
     std::shared_ptr<ReadBuffer> maybe_compressed_in;
-    BlockInputStreamPtr block_in;
+    std::shared_ptr<NativeBlockInputStream> block_in;
 
     /// Where to write data for INSERT.
     std::shared_ptr<WriteBuffer> maybe_compressed_out;
@@ -272,6 +291,9 @@ private:
     void receiveHello();
     bool ping();
 
+    /// Common part of the Query and ExecutePrepared packets: query id, client info, settings, stage, compression.
+    void sendQueryHeader(UInt64 stage, const Settings * settings, const ClientInfo * client_info);
+
     Block receiveData();
     std::unique_ptr<Exception> receiveException();
     Progress receiveProgress();
@@ -48,6 +48,18 @@ ConnectionPoolWithFailover::ConnectionPoolWithFailover(
 
         hostname_differences[i] = hostname_difference;
     }
+
+    /// Detect death and recovery of replicas out-of-band, so that queries after a failure
+    ///  fail over to known-healthy replicas at once instead of paying the connect timeout
+    ///  to rediscover the dead one.
+    enableHealthChecks(
+        [](NestedPool & pool, std::string & /* fail_message is filled from the exception */)
+        {
+            Entry entry = pool.get(nullptr, false);
+            entry->forceConnected();    /// Connects and performs the handshake, or pings.
+            return true;
+        },
+        DBMS_CONNECTION_POOL_WITH_FAILOVER_DEFAULT_HEALTH_CHECK_PERIOD_SEC);
 }
 
 IConnectionPool::Entry ConnectionPoolWithFailover::get(const Settings * settings, bool force_connected)
@@ -99,6 +111,31 @@ std::vector<ConnectionPoolWithFailover::TryResult> ConnectionPoolWithFailover::g
     return getManyImpl(settings, pool_mode, try_get_entry);
 }
 
+void ConnectionPoolWithFailover::warmUp(size_t connections_per_replica)
+{
+    for (auto & pool : nested_pools)
+    {
+        /// Hold the entries while connecting, so that distinct connections are established;
+        ///  they go back to the pool warm when released.
+        std::vector<Entry> entries;
+        entries.reserve(connections_per_replica);
+
+        try
+        {
+            for (size_t i = 0; i < connections_per_replica; ++i)
+            {
+                Entry entry = pool->get(nullptr, false);
+                entry->forceConnected();    /// Connects and performs the handshake, or pings (and reconnects if the connection was closed).
+                entries.push_back(entry);
+            }
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log);
+        }
+    }
+}
+
 std::vector<ConnectionPoolWithFailover::TryResult> ConnectionPoolWithFailover::getManyImpl(
         const Settings * settings,
         PoolMode pool_mode,
@@ -55,6 +55,12 @@ public:
     std::vector<TryResult> getManyChecked(
             const Settings * settings, PoolMode pool_mode, const QualifiedTableName & table_to_check);
 
+    /** Establish up to `connections_per_replica` connections in each nested pool (resolving the
+      *  address and performing the handshake), or ping the ones already established, and return
+      *  them to the pools warm. Failures of individual replicas are logged and skipped.
+      */
+    void warmUp(size_t connections_per_replica);
+
 private:
     /// Get the values of relevant settings and call Base::getMany()
     std::vector<TryResult> getManyImpl(
@@ -1,4 +1,10 @@
 #include <Client/MultiplexedConnections.h>
+#include <Common/ProfileEvents.h>
+
+namespace ProfileEvents
+{
+    extern const Event HedgedRequests;
+}
 
 namespace DB
 {
@@ -26,8 +32,9 @@ MultiplexedConnections::MultiplexedConnections(Connection & connection, const Se
 
 MultiplexedConnections::MultiplexedConnections(
         std::vector<IConnectionPool::Entry> && connections,
-        const Settings & settings_, const ThrottlerPtr & throttler, bool append_extra_info)
-    : settings(settings_)
+        const Settings & settings_, const ThrottlerPtr & throttler, bool append_extra_info,
+        bool multiplex_shards_)
+    : settings(settings_), multiplex_shards(multiplex_shards_)
 {
     /// If we didn't get any connections from pool and getMany() did not throw exceptions, this means that
     /// `skip_unavailable_shards` was set. Then just return.
@@ -53,6 +60,21 @@ MultiplexedConnections::MultiplexedConnections(
         block_extra_info = std::make_unique<BlockExtraInfo>();
 }
 
+void MultiplexedConnections::setBackupReplica(IConnectionPool::Entry && entry, const ThrottlerPtr & throttler)
+{
+    std::lock_guard<std::mutex> lock(cancel_mutex);
+
+    if (sent_query)
+        throw Exception("Cannot set a backup replica: query already sent.", ErrorCodes::LOGICAL_ERROR);
+    if (replica_states.size() != 1)
+        throw Exception("A backup replica is only supported for a single replica executing the whole query.",
+            ErrorCodes::LOGICAL_ERROR);
+
+    backup_connection = &*entry;
+    backup_connection->setThrottler(throttler);
+    backup_pool_entry = std::move(entry);
+}
+
 void MultiplexedConnections::sendExternalTablesData(std::vector<ExternalTablesData> & data)
 {
     std::lock_guard<std::mutex> lock(cancel_mutex);
@@ -87,7 +109,19 @@ void MultiplexedConnections::sendQuery(
     if (sent_query)
         throw Exception("Query already sent.", ErrorCodes::LOGICAL_ERROR);
 
-    if (replica_states.size() > 1)
+    if (replica_states.size() > 1 && multiplex_shards)
+    {
+        /// The connections belong to different shards, each of them executes the whole query for its shard.
+        for (ReplicaState & state : replica_states)
+        {
+            Connection * connection = state.connection;
+            if (connection == nullptr)
+                throw Exception("MultiplexedConnections: Internal error", ErrorCodes::LOGICAL_ERROR);
+
+            connection->sendQuery(query, query_id, stage, &settings, client_info, with_pending_data);
+        }
+    }
+    else if (replica_states.size() > 1)
     {
         Settings query_settings = settings;
         query_settings.parallel_replicas_count = replica_states.size();
@@ -109,6 +143,20 @@ void MultiplexedConnections::sendQuery(
             throw Exception("MultiplexedConnections: Internal error", ErrorCodes::LOGICAL_ERROR);
 
         connection->sendQuery(query, query_id, stage, &settings, client_info, with_pending_data);
+
+        /// Remember the query in case it has to be resent to the backup replica.
+        if (backup_connection)
+        {
+            sent_query_text = query;
+            sent_query_id = query_id;
+            sent_stage = stage;
+            if (client_info)
+            {
+                sent_client_info = *client_info;
+                sent_has_client_info = true;
+            }
+            sent_with_pending_data = with_pending_data;
+        }
     }
 
     sent_query = true;
@@ -233,6 +281,23 @@ Connection::Packet MultiplexedConnections::receivePacketUnlocked()
     if (!hasActiveConnections())
         throw Exception("No more packets are available.", ErrorCodes::LOGICAL_ERROR);
 
+    /// Hedged request: if the only replica has not sent anything within the budget, involve the backup replica.
+    if (backup_connection && !backup_query_sent && !got_first_packet)
+    {
+        Connection * connection = replica_states[0].connection;
+        if (connection != nullptr && !connection->hasReadBufferPendingData())
+        {
+            Poco::Net::Socket::SocketList read_list;
+            Poco::Net::Socket::SocketList write_list;
+            Poco::Net::Socket::SocketList except_list;
+            read_list.push_back(*connection->socket);
+
+            if (0 == Poco::Net::Socket::select(read_list, write_list, except_list,
+                    Poco::Timespan(settings.hedged_request_timeout_ms.totalMilliseconds() * 1000)))
+                sendBackupQuery();
+        }
+    }
+
     ReplicaState & state = getReplicaForReading();
     current_connection = state.connection;
     if (current_connection == nullptr)
@@ -240,6 +305,24 @@ Connection::Packet MultiplexedConnections::receivePacketUnlocked()
 
     Connection::Packet packet = current_connection->receivePacket();
 
+    if (!got_first_packet)
+    {
+        got_first_packet = true;
+
+        if (backup_query_sent)
+        {
+            /// Whichever replica responded first wins. The loser has not sent us anything,
+            ///  so no data is lost or duplicated by tearing its connection down.
+            keepOnlyReplica(state);
+        }
+        else if (backup_connection)
+        {
+            /// The replica responded within the budget - the backup is not needed.
+            backup_connection = nullptr;
+            backup_pool_entry = IConnectionPool::Entry();
+        }
+    }
+
     switch (packet.type)
     {
         case Protocol::Server::Data:
@@ -321,4 +404,44 @@ void MultiplexedConnections::invalidateReplica(ReplicaState & state)
     --active_connection_count;
 }
 
+void MultiplexedConnections::sendBackupQuery()
+{
+    ProfileEvents::increment(ProfileEvents::HedgedRequests);
+
+    backup_connection->sendQuery(sent_query_text, sent_query_id, sent_stage, &settings,
+        sent_has_client_info ? &sent_client_info : nullptr, sent_with_pending_data);
+
+    /// Queries with external tables are never hedged (see RemoteBlockInputStream),
+    ///  so only the end-of-data marker has to be sent.
+    if (sent_with_pending_data)
+    {
+        ExternalTablesData no_data;
+        backup_connection->sendExternalTablesData(no_data);
+    }
+
+    ReplicaState state;
+    state.connection = backup_connection;
+    state.pool_entry = std::move(backup_pool_entry);
+    replica_states.push_back(std::move(state));
+
+    ++active_connection_count;
+    /// To be rebuilt with the backup replica included.
+    fd_to_replica_state_idx.clear();
+
+    backup_query_sent = true;
+}
+
+void MultiplexedConnections::keepOnlyReplica(const ReplicaState & winner)
+{
+    for (ReplicaState & state : replica_states)
+    {
+        if (state.connection != nullptr && state.connection != winner.connection)
+        {
+            /// The server kills the query when it notices the closed connection.
+            state.connection->disconnect();
+            invalidateReplica(state);
+        }
+    }
+}
+
 }
@@ -3,6 +3,7 @@
 #include <Common/Throttler.h>
 #include <Client/Connection.h>
 #include <Client/ConnectionPoolWithFailover.h>
+#include <Interpreters/ClientInfo.h>
 #include <Poco/ScopedLock.h>
 #include <mutex>
 
@@ -24,10 +25,21 @@ public:
 
     /** Accepts a vector of connections to replicas of one shard already taken from pool.
       * If the append_extra_info flag is set, additional information appended to each received block.
+      * If the multiplex_shards flag is set, the connections belong to different shards
+      *  and each of them executes the whole query for its shard (see distributed_connections_per_stream).
       */
     MultiplexedConnections(
             std::vector<IConnectionPool::Entry> && connections,
-            const Settings & settings_, const ThrottlerPtr & throttler_, bool append_extra_info);
+            const Settings & settings_, const ThrottlerPtr & throttler_, bool append_extra_info,
+            bool multiplex_shards_ = false);
+
+    /** Set a backup replica for hedged requests (see hedged_request_timeout_ms).
+      * If the replica does not send anything within the budget after the query was sent,
+      *  the same query is opened on the backup connection and whichever replica responds
+      *  first is kept; the other connection is torn down before any packet is read from it.
+      * Only for the case of a single replica executing the whole query. Call before sendQuery.
+      */
+    void setBackupReplica(IConnectionPool::Entry && entry, const ThrottlerPtr & throttler);
 
     /// Send all content of external tables to replicas.
     void sendExternalTablesData(std::vector<ExternalTablesData> & data);
@@ -89,6 +101,12 @@ private:
     /// Mark the replica as invalid.
     void invalidateReplica(ReplicaState & replica_state);
 
+    /// Open the same query on the backup replica (the hedged request).
+    void sendBackupQuery();
+
+    /// Tear down all the replicas except the winner of the hedged request.
+    void keepOnlyReplica(const ReplicaState & winner);
+
 private:
     const Settings & settings;
 
@@ -107,6 +125,24 @@ private:
 
     bool cancelled = false;
 
+    /// Whether the connections belong to different shards rather than to replicas of one shard.
+    bool multiplex_shards = false;
+
+    /// Hedged request support (see setBackupReplica).
+    IConnectionPool::Entry backup_pool_entry;
+    Connection * backup_connection = nullptr;
+    bool backup_query_sent = false;
+    /// After the first packet the winner is known and hedging is not armed anymore.
+    bool got_first_packet = false;
+
+    /// The query is remembered to be resent to the backup replica.
+    String sent_query_text;
+    String sent_query_id;
+    UInt64 sent_stage = 0;
+    ClientInfo sent_client_info;
+    bool sent_has_client_info = false;
+    bool sent_with_pending_data = false;
+
     /// A mutex for the sendCancel function to execute safely
     /// in separate thread.
     mutable std::mutex cancel_mutex;
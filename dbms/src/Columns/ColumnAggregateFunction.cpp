@@ -252,6 +252,18 @@ void ColumnAggregateFunction::insertMergeFrom(const IColumn & src, size_t n)
     insertMergeFrom(static_cast<const ColumnAggregateFunction &>(src).getData()[n]);
 }
 
+void ColumnAggregateFunction::insertMergeRangeFrom(const IColumn & src, size_t start, size_t length)
+{
+    const auto & src_data = static_cast<const ColumnAggregateFunction &>(src).getData();
+
+    IAggregateFunction * function = func.get();
+    Arena * arena = &createOrGetArena();
+    AggregateDataPtr place = getData().back();
+
+    for (size_t i = 0; i < length; ++i)
+        function->merge(place, src_data[start + i], arena);
+}
+
 Arena & ColumnAggregateFunction::createOrGetArena()
 {
     if (unlikely(arenas.empty()))
@@ -123,6 +123,10 @@ public:
 
     void insertMergeFrom(const IColumn & src, size_t n);
 
+    /// Merge states [start, start + length) of another column into the last state.
+    /// The function and the arena are taken once for the whole range.
+    void insertMergeRangeFrom(const IColumn & src, size_t start, size_t length);
+
     Arena & createOrGetArena();
 
     void insert(const Field & x) override;
@@ -0,0 +1,340 @@
+#include <Columns/ColumnDictionary.h>
+#include <DataStreams/ColumnGathererStream.h>
+#include <Common/Exception.h>
+#include <Common/typeid_cast.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int SIZES_OF_COLUMNS_DOESNT_MATCH;
+}
+
+
+/// Bring the map up to date with dictionary values [0, limit).
+void ColumnDictionary::syncDedupMap(size_t limit)
+{
+    if (dedup_map_synced_values > limit)
+    {
+        /// The dictionary was replaced or shrunk - start over.
+        dedup_map.clearAndShrink();
+        dedup_map_synced_values = 0;
+    }
+
+    for (size_t i = dedup_map_synced_values; i < limit; ++i)
+    {
+        StringRef ref = dictionary->getDataAt(i);
+
+        DedupMap::iterator it;
+        bool inserted;
+        dedup_map.emplace(ref, it, inserted);
+        if (inserted)
+        {
+            it->first.data = dedup_arena.insert(ref.data, ref.size);
+            it->second = i;
+        }
+    }
+
+    dedup_map_synced_values = limit;
+}
+
+
+IColumn & ColumnDictionary::getDictionaryForModification()
+{
+    if (dictionary_is_shared)
+    {
+        dictionary = dictionary->clone();
+        dictionary_is_shared = false;
+    }
+
+    return *dictionary;
+}
+
+
+ColumnDictionary::Index ColumnDictionary::dedupLastDictionaryValue()
+{
+    size_t last = dictionary->size() - 1;
+
+    /// Everything before the just-appended value must be in the map.
+    syncDedupMap(last);
+
+    StringRef ref = dictionary->getDataAt(last);
+
+    DedupMap::iterator it;
+    bool inserted;
+    dedup_map.emplace(ref, it, inserted);
+    if (inserted)
+    {
+        it->first.data = dedup_arena.insert(ref.data, ref.size);
+        it->second = last;
+        dedup_map_synced_values = last + 1;
+        return last;
+    }
+
+    /// A duplicate - drop it. The dictionary is ours: the value was just appended to it.
+    dictionary->popBack(1);
+    return it->second;
+}
+
+
+void ColumnDictionary::insert(const Field & x)
+{
+    getDictionaryForModification().insert(x);
+    insertLastDictionaryValue();
+}
+
+void ColumnDictionary::insertFrom(const IColumn & src, size_t n)
+{
+    if (const ColumnDictionary * src_dict = typeid_cast<const ColumnDictionary *>(&src))
+    {
+        if (src_dict->dictionary.get() == dictionary.get())
+        {
+            indexes.push_back(src_dict->indexes[n]);
+            return;
+        }
+
+        insertFromFullColumn(*src_dict->dictionary, src_dict->indexes[n]);
+        return;
+    }
+
+    /// A column of the dictionary's (not encoded) type, e.g. INSERT SELECT from a plain column.
+    insertFromFullColumn(src, n);
+}
+
+void ColumnDictionary::insertRangeFrom(const IColumn & src, size_t start, size_t length)
+{
+    if (const ColumnDictionary * src_dict = typeid_cast<const ColumnDictionary *>(&src))
+    {
+        if (src_dict->dictionary.get() == dictionary.get())
+        {
+            indexes.insert(src_dict->indexes.begin() + start, src_dict->indexes.begin() + start + length);
+            return;
+        }
+
+        for (size_t i = 0; i < length; ++i)
+            insertFromFullColumn(*src_dict->dictionary, src_dict->indexes[start + i]);
+        return;
+    }
+
+    /// A column of the dictionary's (not encoded) type.
+    for (size_t i = 0; i < length; ++i)
+        insertFromFullColumn(src, start + i);
+}
+
+void ColumnDictionary::insertData(const char * pos, size_t length)
+{
+    getDictionaryForModification().insertData(pos, length);
+    insertLastDictionaryValue();
+}
+
+void ColumnDictionary::insertDefault()
+{
+    getDictionaryForModification().insertDefault();
+    insertLastDictionaryValue();
+}
+
+void ColumnDictionary::insertFromFullColumn(const IColumn & full_column, size_t n)
+{
+    getDictionaryForModification().insertFrom(full_column, n);
+    insertLastDictionaryValue();
+}
+
+const char * ColumnDictionary::deserializeAndInsertFromArena(const char * pos)
+{
+    const char * res = getDictionaryForModification().deserializeAndInsertFromArena(pos);
+    insertLastDictionaryValue();
+    return res;
+}
+
+
+ColumnPtr ColumnDictionary::cloneResized(size_t size) const
+{
+    auto res = cloneWithSharedDictionary();
+
+    size_t count = std::min(size, indexes.size());
+    res->indexes.assign(indexes.begin(), indexes.begin() + count);
+
+    if (size > count)
+    {
+        /// Pad with default values.
+        for (size_t i = count; i < size; ++i)
+            res->insertDefault();
+    }
+
+    return res;
+}
+
+ColumnPtr ColumnDictionary::cut(size_t start, size_t length) const
+{
+    if (start + length > indexes.size())
+        throw Exception("Parameters are out of bound in ColumnDictionary::cut() method.",
+            ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    auto res = cloneWithSharedDictionary();
+    res->indexes.assign(indexes.begin() + start, indexes.begin() + start + length);
+    return res;
+}
+
+ColumnPtr ColumnDictionary::filter(const Filter & filt, ssize_t result_size_hint) const
+{
+    size_t size = indexes.size();
+    if (size != filt.size())
+        throw Exception("Size of filter doesn't match size of column.", ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    auto res = cloneWithSharedDictionary();
+
+    if (result_size_hint > 0)
+        res->indexes.reserve(result_size_hint);
+
+    for (size_t i = 0; i < size; ++i)
+        if (filt[i])
+            res->indexes.push_back(indexes[i]);
+
+    return res;
+}
+
+ColumnPtr ColumnDictionary::permute(const Permutation & perm, size_t limit) const
+{
+    size_t size = indexes.size();
+
+    if (limit == 0)
+        limit = size;
+    else
+        limit = std::min(size, limit);
+
+    if (perm.size() < limit)
+        throw Exception("Size of permutation is less than required.", ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    auto res = cloneWithSharedDictionary();
+    res->indexes.resize(limit);
+    for (size_t i = 0; i < limit; ++i)
+        res->indexes[i] = indexes[perm[i]];
+
+    return res;
+}
+
+int ColumnDictionary::compareAt(size_t n, size_t m, const IColumn & rhs, int nan_direction_hint) const
+{
+    const ColumnDictionary & rhs_dict = static_cast<const ColumnDictionary &>(rhs);
+
+    Index left = indexes[n];
+    Index right = rhs_dict.indexes[m];
+
+    if (dictionary.get() == rhs_dict.dictionary.get() && left == right)
+        return 0;
+
+    return dictionary->compareAt(left, right, *rhs_dict.dictionary, nan_direction_hint);
+}
+
+void ColumnDictionary::getPermutation(bool reverse, size_t limit, int nan_direction_hint, Permutation & res) const
+{
+    /// Sort the dictionary once, then rows are ordered by the rank of their dictionary value.
+    size_t dictionary_size = dictionary->size();
+    Permutation dict_perm;
+    dictionary->getPermutation(reverse, 0, nan_direction_hint, dict_perm);
+
+    std::vector<size_t> ranks(dictionary_size);
+    for (size_t i = 0; i < dictionary_size; ++i)
+        ranks[dict_perm[i]] = i;
+
+    size_t size = indexes.size();
+    res.resize(size);
+    for (size_t i = 0; i < size; ++i)
+        res[i] = i;
+
+    auto less = [&](size_t lhs, size_t rhs) { return ranks[indexes[lhs]] < ranks[indexes[rhs]]; };
+
+    if (limit >= size)
+        limit = 0;
+
+    if (limit)
+        std::partial_sort(res.begin(), res.begin() + limit, res.end(), less);
+    else
+        std::sort(res.begin(), res.end(), less);
+}
+
+ColumnPtr ColumnDictionary::replicate(const Offsets_t & offsets) const
+{
+    size_t size = indexes.size();
+    if (size != offsets.size())
+        throw Exception("Size of offsets doesn't match size of column.", ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    auto res = cloneWithSharedDictionary();
+    if (0 == size)
+        return res;
+
+    res->indexes.reserve(offsets.back());
+
+    IColumn::Offset_t prev_offset = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t size_to_replicate = offsets[i] - prev_offset;
+        prev_offset = offsets[i];
+
+        for (size_t j = 0; j < size_to_replicate; ++j)
+            res->indexes.push_back(indexes[i]);
+    }
+
+    return res;
+}
+
+Columns ColumnDictionary::scatter(ColumnIndex num_columns, const Selector & selector) const
+{
+    size_t size = indexes.size();
+    if (size != selector.size())
+        throw Exception("Size of selector doesn't match size of column.", ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    Columns res(num_columns);
+    for (size_t i = 0; i < num_columns; ++i)
+        res[i] = cloneWithSharedDictionary();
+
+    for (size_t i = 0; i < size; ++i)
+        static_cast<ColumnDictionary &>(*res[selector[i]]).indexes.push_back(indexes[i]);
+
+    return res;
+}
+
+void ColumnDictionary::gather(ColumnGathererStream & gatherer)
+{
+    gatherer.gather(*this);
+}
+
+void ColumnDictionary::getExtremes(Field & min, Field & max) const
+{
+    size_t size = indexes.size();
+
+    if (0 == size)
+    {
+        dictionary->cloneEmpty()->getExtremes(min, max);    /// Defaults of the nested type.
+        return;
+    }
+
+    Index min_idx = indexes[0];
+    Index max_idx = indexes[0];
+
+    for (size_t i = 1; i < size; ++i)
+    {
+        Index idx = indexes[i];
+        if (dictionary->compareAt(idx, min_idx, *dictionary, 1) < 0)
+            min_idx = idx;
+        else if (dictionary->compareAt(idx, max_idx, *dictionary, 1) > 0)
+            max_idx = idx;
+    }
+
+    dictionary->get(min_idx, min);
+    dictionary->get(max_idx, max);
+}
+
+ColumnPtr ColumnDictionary::convertToFullColumn() const
+{
+    ColumnPtr res = dictionary->cloneEmpty();
+    size_t size = indexes.size();
+    res->reserve(size);
+    for (size_t i = 0; i < size; ++i)
+        res->insertFrom(*dictionary, indexes[i]);
+    return res;
+}
+
+}
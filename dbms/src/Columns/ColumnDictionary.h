@@ -0,0 +1,130 @@
+#pragma once
+
+#include <Columns/IColumn.h>
+#include <Common/PODArray.h>
+#include <Common/Arena.h>
+#include <Common/HashTable/HashMap.h>
+
+
+namespace DB
+{
+
+/** A dictionary-encoded column: each distinct value is stored once in the `dictionary` column,
+  *  and rows are represented by 32-bit indices into it.
+  * Significantly reduces memory usage for low-cardinality String columns (see DataTypeDictionary).
+  *
+  * The dictionary is append-only. Operations that rearrange rows (cut, filter, permute, replicate,
+  *  scatter) share the dictionary between the source and the result; it is copied lazily if one of
+  *  the sharers wants to append values afterwards.
+  */
+class ColumnDictionary final : public IColumn
+{
+public:
+    using Index = UInt32;
+    using Indexes = PaddedPODArray<Index>;
+
+    explicit ColumnDictionary(ColumnPtr dictionary_) : dictionary(std::move(dictionary_)) {}
+
+    std::string getName() const override { return "ColumnDictionary"; }
+
+    size_t size() const override { return indexes.size(); }
+
+    Field operator[](size_t n) const override { return (*dictionary)[indexes[n]]; }
+    void get(size_t n, Field & res) const override { dictionary->get(indexes[n], res); }
+    StringRef getDataAt(size_t n) const override { return dictionary->getDataAt(indexes[n]); }
+    StringRef getDataAtWithTerminatingZero(size_t n) const override { return dictionary->getDataAtWithTerminatingZero(indexes[n]); }
+
+    ColumnPtr cloneResized(size_t size) const override;
+    ColumnPtr cut(size_t start, size_t length) const override;
+
+    void insert(const Field & x) override;
+    void insertFrom(const IColumn & src, size_t n) override;
+    void insertRangeFrom(const IColumn & src, size_t start, size_t length) override;
+    void insertData(const char * pos, size_t length) override;
+    void insertDefault() override;
+
+    /// Insert the n-th value of a column of the dictionary's (not encoded) type.
+    void insertFromFullColumn(const IColumn & full_column, size_t n);
+
+    void popBack(size_t n) override { indexes.resize_assume_reserved(indexes.size() - n); }
+
+    StringRef serializeValueIntoArena(size_t n, Arena & arena, char const *& begin) const override
+    {
+        return dictionary->serializeValueIntoArena(indexes[n], arena, begin);
+    }
+
+    const char * deserializeAndInsertFromArena(const char * pos) override;
+
+    void updateHashWithValue(size_t n, SipHash & hash) const override
+    {
+        dictionary->updateHashWithValue(indexes[n], hash);
+    }
+
+    ColumnPtr filter(const Filter & filt, ssize_t result_size_hint) const override;
+    ColumnPtr permute(const Permutation & perm, size_t limit) const override;
+
+    int compareAt(size_t n, size_t m, const IColumn & rhs, int nan_direction_hint) const override;
+
+    void getPermutation(bool reverse, size_t limit, int nan_direction_hint, Permutation & res) const override;
+
+    ColumnPtr replicate(const Offsets_t & offsets) const override;
+    Columns scatter(ColumnIndex num_columns, const Selector & selector) const override;
+
+    void gather(ColumnGathererStream & gatherer_stream) override;
+
+    void getExtremes(Field & min, Field & max) const override;
+
+    void reserve(size_t n) override { indexes.reserve(n); }
+
+    size_t byteSize() const override { return dictionary->byteSize() + indexes.size() * sizeof(indexes[0]); }
+    size_t allocatedBytes() const override { return dictionary->allocatedBytes() + indexes.allocated_bytes(); }
+
+    /// Decode into a column of the dictionary's type.
+    ColumnPtr convertToFullColumn() const;
+
+    const ColumnPtr & getDictionary() const { return dictionary; }
+    const Indexes & getIndexes() const { return indexes; }
+    Indexes & getIndexes() { return indexes; }
+
+    /// Append the last value of the dictionary if it is new, or pop it and return the index
+    ///  of the existing equal value. Does not touch `indexes`.
+    Index dedupLastDictionaryValue();
+
+    /// Append a (possibly duplicated) value to the dictionary and an index for it.
+    /// The value must have been already appended to `dictionary` as its last element.
+    void insertLastDictionaryValue() { indexes.push_back(dedupLastDictionaryValue()); }
+
+    /// Dictionary mutation helper: returns the dictionary, copying it first if it is shared with another column.
+    IColumn & getDictionaryForModification();
+
+    /// State of a chunked deserialization between deserializeBinaryBulk calls (see DataTypeDictionary).
+    size_t deserialize_rows_pending = 0;
+    std::vector<Index> deserialize_chunk_index_map;
+
+private:
+    ColumnPtr dictionary;
+    Indexes indexes;
+
+    /// Deduplication of dictionary values on insertion. Keys point into `dedup_arena`.
+    using DedupMap = HashMap<StringRef, Index, StringRefHash>;
+    DedupMap dedup_map;
+    Arena dedup_arena;
+    /// How many dictionary values are reflected in dedup_map (the map is (re)built lazily).
+    size_t dedup_map_synced_values = 0;
+
+    /// Set when the dictionary may be referenced by another ColumnDictionary.
+    mutable bool dictionary_is_shared = false;
+
+    ColumnDictionary(ColumnPtr dictionary_, bool shared) : dictionary(std::move(dictionary_)), dictionary_is_shared(shared) {}
+
+    /// Share our dictionary with a new column (both sides become copy-on-append).
+    std::shared_ptr<ColumnDictionary> cloneWithSharedDictionary() const
+    {
+        dictionary_is_shared = true;
+        return std::shared_ptr<ColumnDictionary>(new ColumnDictionary(dictionary, true));
+    }
+
+    void syncDedupMap(size_t limit);
+};
+
+}
@@ -0,0 +1,33 @@
+#include <Columns/ColumnLazy.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <IO/ReadBufferFromMemory.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_READ_ALL_DATA;
+}
+
+
+const ColumnPtr & ColumnLazy::getMaterializedColumn() const
+{
+    if (!materialized_column)
+    {
+        ColumnPtr column = type->createColumn();
+
+        ReadBufferFromMemory istr(serialized.data(), serialized.size());
+        NativeBlockInputStream::readData(*type, *column, istr, s, 0);
+
+        if (!istr.eof())
+            throw Exception("Serialized column contains extra data", ErrorCodes::CANNOT_READ_ALL_DATA);
+
+        materialized_column = std::move(column);
+    }
+
+    return materialized_column;
+}
+
+}
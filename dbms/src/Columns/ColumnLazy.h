@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Columns/IColumn.h>
+#include <DataTypes/IDataType.h>
+#include <Common/typeid_cast.h>
+
+
+namespace DB
+{
+
+/** A column whose payload is kept in the serialized form of the Native format.
+  * It is produced by NativeBlockInputStream when lazy reading is enabled and the sender
+  *  has prefixed each column with its serialized size (see DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES).
+  *
+  * If nothing reads the values, NativeBlockOutputStream writes the payload back verbatim,
+  *  so a query that merely relays blocks does not pay for deserialization and serialization.
+  * Any access to the values transparently deserializes the payload into an ordinary column
+  *  and is forwarded to it, after which the column behaves as usual.
+  *
+  * Note that the column must not be passed directly to IDataType serialization methods
+  *  or to methods of other columns - those cast to concrete column types. The usual
+  *  chokepoint for this is convertToFullColumnIfConst (see MaterializingBlockOutputStream),
+  *  which returns the deserialized column.
+  */
+class ColumnLazy final : public IColumn
+{
+public:
+    ColumnLazy(const DataTypePtr & type_, size_t s_, String && serialized_)
+        : type(type_), s(s_), serialized(std::move(serialized_)) {}
+
+    std::string getName() const override { return "ColumnLazy"; }
+
+    /// The payload has not been deserialized (and not modified), so it may be written back verbatim.
+    bool isMaterialized() const { return bool(materialized_column); }
+
+    const DataTypePtr & getType() const { return type; }
+    const String & getSerializedData() const { return serialized; }
+
+    /// Deserialize the payload (if not done yet) and return the ordinary column.
+    const ColumnPtr & getMaterializedColumn() const;
+
+    ColumnPtr convertToFullColumnIfConst() const override { return getMaterializedColumn(); }
+
+    size_t size() const override { return materialized_column ? materialized_column->size() : s; }
+
+    Field operator[](size_t n) const override { return (*getMaterializedColumn())[n]; }
+    void get(size_t n, Field & res) const override { getMaterializedColumn()->get(n, res); }
+    StringRef getDataAt(size_t n) const override { return getMaterializedColumn()->getDataAt(n); }
+    StringRef getDataAtWithTerminatingZero(size_t n) const override { return getMaterializedColumn()->getDataAtWithTerminatingZero(n); }
+    UInt64 get64(size_t n) const override { return getMaterializedColumn()->get64(n); }
+    UInt64 getUInt(size_t n) const override { return getMaterializedColumn()->getUInt(n); }
+    Int64 getInt(size_t n) const override { return getMaterializedColumn()->getInt(n); }
+
+    ColumnPtr cloneResized(size_t new_size) const override { return getMaterializedColumn()->cloneResized(new_size); }
+    ColumnPtr cut(size_t start, size_t length) const override { return getMaterializedColumn()->cut(start, length); }
+
+    void insert(const Field & x) override { mutableMaterializedColumn().insert(x); }
+    void insertFrom(const IColumn & src, size_t n) override { mutableMaterializedColumn().insertFrom(unwrap(src), n); }
+    void insertRangeFrom(const IColumn & src, size_t start, size_t length) override { mutableMaterializedColumn().insertRangeFrom(unwrap(src), start, length); }
+    void insertData(const char * pos, size_t length) override { mutableMaterializedColumn().insertData(pos, length); }
+    void insertDataWithTerminatingZero(const char * pos, size_t length) override { mutableMaterializedColumn().insertDataWithTerminatingZero(pos, length); }
+    void insertDefault() override { mutableMaterializedColumn().insertDefault(); }
+    void popBack(size_t n) override { mutableMaterializedColumn().popBack(n); }
+
+    StringRef serializeValueIntoArena(size_t n, Arena & arena, char const *& begin) const override
+    {
+        return getMaterializedColumn()->serializeValueIntoArena(n, arena, begin);
+    }
+
+    const char * deserializeAndInsertFromArena(const char * pos) override { return mutableMaterializedColumn().deserializeAndInsertFromArena(pos); }
+
+    void updateHashWithValue(size_t n, SipHash & hash) const override { getMaterializedColumn()->updateHashWithValue(n, hash); }
+
+    ColumnPtr filter(const Filter & filt, ssize_t result_size_hint) const override { return getMaterializedColumn()->filter(filt, result_size_hint); }
+    ColumnPtr permute(const Permutation & perm, size_t limit) const override { return getMaterializedColumn()->permute(perm, limit); }
+
+    int compareAt(size_t n, size_t m, const IColumn & rhs, int nan_direction_hint) const override
+    {
+        return getMaterializedColumn()->compareAt(n, m, unwrap(rhs), nan_direction_hint);
+    }
+
+    void getPermutation(bool reverse, size_t limit, int nan_direction_hint, Permutation & res) const override
+    {
+        getMaterializedColumn()->getPermutation(reverse, limit, nan_direction_hint, res);
+    }
+
+    ColumnPtr replicate(const Offsets_t & offsets) const override { return getMaterializedColumn()->replicate(offsets); }
+    Columns scatter(ColumnIndex num_columns, const Selector & selector) const override { return getMaterializedColumn()->scatter(num_columns, selector); }
+    void gather(ColumnGathererStream & gatherer_stream) override { mutableMaterializedColumn().gather(gatherer_stream); }
+    void getExtremes(Field & min, Field & max) const override { getMaterializedColumn()->getExtremes(min, max); }
+
+    void reserve(size_t n) override { mutableMaterializedColumn().reserve(n); }
+
+    size_t byteSize() const override { return materialized_column ? materialized_column->byteSize() : serialized.size(); }
+    size_t allocatedBytes() const override { return materialized_column ? materialized_column->allocatedBytes() : serialized.capacity(); }
+
+private:
+    DataTypePtr type;
+    size_t s;
+    String serialized;
+
+    mutable ColumnPtr materialized_column;
+
+    IColumn & mutableMaterializedColumn() { return *const_cast<ColumnPtr &>(getMaterializedColumn()); }
+
+    /// A method of the deserialized column must never see a ColumnLazy as its argument.
+    static const IColumn & unwrap(const IColumn & column)
+    {
+        if (const ColumnLazy * lazy = typeid_cast<const ColumnLazy *>(&column))
+            return *lazy->getMaterializedColumn();
+        return column;
+    }
+};
+
+}
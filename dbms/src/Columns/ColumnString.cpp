@@ -109,6 +109,41 @@ ColumnPtr ColumnString::filter(const Filter & filt, ssize_t result_size_hint) co
 }
 
 
+void ColumnString::filterInPlace(const Filter & filt)
+{
+    size_t size = offsets.size();
+    if (size != filt.size())
+        throw Exception("Size of filter doesn't match size of column.", ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    if (0 == size)
+        return;
+
+    Offset_t current_offset = 0;
+    size_t res_pos = 0;
+    Offset_t prev_src_offset = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t string_offset = prev_src_offset;
+        size_t string_size = offsets[i] - prev_src_offset;
+        prev_src_offset = offsets[i];
+
+        if (filt[i])
+        {
+            /// The destination is always at or before the source, so strings are moved towards the beginning.
+            if (current_offset != string_offset)
+                memmove(&chars[current_offset], &chars[string_offset], string_size);
+
+            current_offset += string_size;
+            offsets[res_pos++] = current_offset;
+        }
+    }
+
+    chars.resize(current_offset);
+    offsets.resize(res_pos);
+}
+
+
 ColumnPtr ColumnString::permute(const Permutation & perm, size_t limit) const
 {
     size_t size = offsets.size();
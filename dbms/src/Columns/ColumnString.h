@@ -200,6 +200,9 @@ public:
 
     ColumnPtr filter(const Filter & filt, ssize_t result_size_hint) const override;
 
+    bool canBeFilteredInPlace() const override { return true; }
+    void filterInPlace(const Filter & filt) override;
+
     ColumnPtr permute(const Permutation & perm, size_t limit) const override;
 
     void insertDefault() override
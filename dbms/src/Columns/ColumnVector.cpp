@@ -15,14 +15,80 @@
 
 #include <ext/bit_cast.h>
 
+#include <Common/TargetSpecific.h>
+
 #if __SSE2__
     #include <emmintrin.h>
 #endif
 
+#if USE_MULTITARGET_CODE
+    #include <immintrin.h>
+#endif
+
+#include <algorithm>
+
 
 namespace DB
 {
 
+#if USE_MULTITARGET_CODE
+BEGIN_AVX2_SPECIFIC_CODE
+
+namespace
+{
+
+/** Analog of the SSE2 loop in ColumnVector<T>::filter, processing 32 filter bytes at a time.
+  * All-zero chunks are skipped entirely; mixed chunks are processed by iterating
+  *  the set bits of the mask, which suits very selective filters.
+  */
+template <typename T, typename Container>
+void NO_INLINE filterImplAVX2(const UInt8 * filt_pos, const UInt8 * filt_end, const T * data_pos, Container & res_data)
+{
+    static constexpr size_t SIMD_BYTES = 32;
+    const __m256i zero32 = _mm256_setzero_si256();
+    const UInt8 * filt_end_avx = filt_pos + (filt_end - filt_pos) / SIMD_BYTES * SIMD_BYTES;
+
+    while (filt_pos < filt_end_avx)
+    {
+        UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(filt_pos)), zero32)));
+
+        if (0 == mask)
+        {
+            /// Nothing is inserted.
+        }
+        else if (0xFFFFFFFF == mask)
+        {
+            res_data.insert(data_pos, data_pos + SIMD_BYTES);
+        }
+        else
+        {
+            while (mask)
+            {
+                res_data.push_back(data_pos[__builtin_ctz(mask)]);
+                mask &= mask - 1;
+            }
+        }
+
+        filt_pos += SIMD_BYTES;
+        data_pos += SIMD_BYTES;
+    }
+
+    while (filt_pos < filt_end)
+    {
+        if (*filt_pos)
+            res_data.push_back(*data_pos);
+
+        ++filt_pos;
+        ++data_pos;
+    }
+}
+
+}
+
+END_TARGET_SPECIFIC_CODE
+#endif
+
 namespace ErrorCodes
 {
     extern const int PARAMETER_OUT_OF_BOUND;
@@ -162,6 +228,14 @@ ColumnPtr ColumnVector<T>::filter(const IColumn::Filter & filt, ssize_t result_s
     const UInt8 * filt_end = filt_pos + size;
     const T * data_pos = &data[0];
 
+#if USE_MULTITARGET_CODE
+    if (isArchSupported(TargetArch::AVX2))
+    {
+        filterImplAVX2(filt_pos, filt_end, data_pos, res_data);
+        return res;
+    }
+#endif
+
 #if __SSE2__
     /** A slightly more optimized version.
         * Based on the assumption that often pieces of consecutive values
@@ -209,6 +283,24 @@ ColumnPtr ColumnVector<T>::filter(const IColumn::Filter & filt, ssize_t result_s
     return res;
 }
 
+template <typename T>
+void ColumnVector<T>::filterInPlace(const IColumn::Filter & filt)
+{
+    size_t size = data.size();
+    if (size != filt.size())
+        throw Exception("Size of filter doesn't match size of column.", ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH);
+
+    const UInt8 * filt_pos = &filt[0];
+    T * data_pos = &data[0];
+    size_t res_pos = 0;
+
+    for (size_t i = 0; i < size; ++i)
+        if (filt_pos[i])
+            data_pos[res_pos++] = data_pos[i];
+
+    data.resize(res_pos);    /// Only trims the size: never reallocates.
+}
+
 template <typename T>
 ColumnPtr ColumnVector<T>::permute(const IColumn::Permutation & perm, size_t limit) const
 {
@@ -242,16 +334,19 @@ ColumnPtr ColumnVector<T>::replicate(const IColumn::Offsets_t & offsets) const
 
     std::shared_ptr<Self> res = std::make_shared<Self>();
     typename Self::Container_t & res_data = res->getData();
-    res_data.reserve(offsets.back());
 
+    /// Filling by whole runs instead of push_back of single elements allows the compiler
+    ///  to vectorize the copies and avoids a capacity check per element.
+    res_data.resize(offsets.back());
+
+    T * out = &res_data[0];
     IColumn::Offset_t prev_offset = 0;
     for (size_t i = 0; i < size; ++i)
     {
         size_t size_to_replicate = offsets[i] - prev_offset;
         prev_offset = offsets[i];
 
-        for (size_t j = 0; j < size_to_replicate; ++j)
-            res_data.push_back(data[i]);
+        out = std::fill_n(out, size_to_replicate, data[i]);
     }
 
     return res;
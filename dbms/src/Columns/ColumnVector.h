@@ -240,6 +240,9 @@ public:
 
     ColumnPtr filter(const IColumn::Filter & filt, ssize_t result_size_hint) const override;
 
+    bool canBeFilteredInPlace() const override { return true; }
+    void filterInPlace(const IColumn::Filter & filt) override;
+
     ColumnPtr permute(const IColumn::Permutation & perm, size_t limit) const override;
 
     ColumnPtr replicate(const IColumn::Offsets_t & offsets) const override;
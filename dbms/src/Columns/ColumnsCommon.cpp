@@ -2,12 +2,76 @@
     #include <emmintrin.h>
 #endif
 
+#include <Core/Defines.h>
 #include <Columns/IColumn.h>
+#include <Common/TargetSpecific.h>
+
+#if USE_MULTITARGET_CODE
+    #include <immintrin.h>
+#endif
 
 
 namespace DB
 {
 
+#if USE_MULTITARGET_CODE
+
+/// AVX2 variants of the hot loops below, chosen at run time on machines that support it.
+BEGIN_AVX2_SPECIFIC_CODE
+
+namespace
+{
+
+size_t countBytesInFilterAVX2(const Int8 * pos, const Int8 * end)
+{
+    size_t count = 0;
+
+    const __m256i zero32 = _mm256_setzero_si256();
+    const Int8 * end64 = pos + (end - pos) / 64 * 64;
+
+    for (; pos < end64; pos += 64)
+        count += __builtin_popcountll(
+            static_cast<UInt64>(static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos)),
+                zero32))))
+            | (static_cast<UInt64>(static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos + 32)),
+                zero32)))) << 32));
+
+    for (; pos < end; ++pos)
+        count += *pos > 0;
+
+    return count;
+}
+
+bool memoryIsZeroAVX2(const Int8 * pos, const Int8 * end)
+{
+    const Int8 * end64 = pos + (end - pos) / 64 * 64;
+
+    for (; pos < end64; pos += 64)
+    {
+        __m256i bytes = _mm256_or_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos + 32)));
+
+        if (!_mm256_testz_si256(bytes, bytes))
+            return false;
+    }
+
+    for (; pos < end; ++pos)
+        if (*pos)
+            return false;
+
+    return true;
+}
+
+}
+
+END_TARGET_SPECIFIC_CODE
+
+#endif
+
+
 size_t countBytesInFilter(const IColumn::Filter & filt)
 {
     size_t count = 0;
@@ -20,6 +84,11 @@ size_t countBytesInFilter(const IColumn::Filter & filt)
     const Int8 * pos = reinterpret_cast<const Int8 *>(&filt[0]);
     const Int8 * end = pos + filt.size();
 
+#if USE_MULTITARGET_CODE
+    if (isArchSupported(TargetArch::AVX2))
+        return count + countBytesInFilterAVX2(pos, end);
+#endif
+
 #if __SSE2__ && __POPCNT__
     const __m128i zero16 = _mm_setzero_si128();
     const Int8 * end64 = pos + filt.size() / 64 * 64;
@@ -57,6 +126,11 @@ bool memoryIsZero(const void * data, size_t size)
     const Int8 * pos = reinterpret_cast<const Int8 *>(data);
     const Int8 * end = pos + size;
 
+#if USE_MULTITARGET_CODE
+    if (isArchSupported(TargetArch::AVX2))
+        return memoryIsZeroAVX2(pos, end);
+#endif
+
 #if __SSE2__
     const __m128 zero16 = _mm_setzero_ps();
     const Int8 * end64 = pos + size / 64 * 64;
@@ -162,6 +236,96 @@ namespace
     };
 
 
+#if USE_MULTITARGET_CODE
+BEGIN_AVX2_SPECIFIC_CODE
+
+    /** Analog of the SSE2 loop in filterArraysImplGeneric, processing 32 filter bytes at a time.
+      * All-zero chunks are skipped entirely; mixed chunks are processed by iterating
+      *  the set bits of the mask, which suits very selective filters.
+      */
+    template <typename T, typename ResultOffsetsBuilder>
+    void NO_INLINE filterArraysImplAVX2(
+        const PaddedPODArray<T> & src_elems, const IColumn::Offsets_t & src_offsets,
+        PaddedPODArray<T> & res_elems, ResultOffsetsBuilder & result_offsets_builder,
+        const IColumn::Filter & filt)
+    {
+        const size_t size = src_offsets.size();
+
+        const UInt8 * filt_pos = &filt[0];
+        const auto filt_end = filt_pos + size;
+
+        auto offsets_pos = &src_offsets[0];
+        const auto offsets_begin = offsets_pos;
+
+        /// copy array ending at *end_offset_ptr
+        const auto copy_array = [&] (const IColumn::Offset_t * offset_ptr)
+        {
+            const auto offset = offset_ptr == offsets_begin ? 0 : offset_ptr[-1];
+            const auto size = *offset_ptr - offset;
+
+            result_offsets_builder.insertOne(size);
+
+            const auto elems_size_old = res_elems.size();
+            res_elems.resize(elems_size_old + size);
+            memcpy(&res_elems[elems_size_old], &src_elems[offset], size * sizeof(T));
+        };
+
+        const __m256i zero_vec = _mm256_setzero_si256();
+        static constexpr size_t SIMD_BYTES = 32;
+        const auto filt_end_aligned = filt_pos + size / SIMD_BYTES * SIMD_BYTES;
+
+        while (filt_pos < filt_end_aligned)
+        {
+            UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(filt_pos)),
+                zero_vec)));
+
+            if (mask == 0)
+            {
+                /// SIMD_BYTES consecutive rows do not pass the filter
+            }
+            else if (mask == 0xffffffff)
+            {
+                /// SIMD_BYTES consecutive rows pass the filter
+                const auto first = offsets_pos == offsets_begin;
+
+                const auto chunk_offset = first ? 0 : offsets_pos[-1];
+                const auto chunk_size = offsets_pos[SIMD_BYTES - 1] - chunk_offset;
+
+                result_offsets_builder.template insertChunk<SIMD_BYTES>(offsets_pos, first, chunk_offset, chunk_size);
+
+                /// copy elements for SIMD_BYTES arrays at once
+                const auto elems_size_old = res_elems.size();
+                res_elems.resize(elems_size_old + chunk_size);
+                memcpy(&res_elems[elems_size_old], &src_elems[chunk_offset], chunk_size * sizeof(T));
+            }
+            else
+            {
+                while (mask)
+                {
+                    copy_array(offsets_pos + __builtin_ctz(mask));
+                    mask &= mask - 1;
+                }
+            }
+
+            filt_pos += SIMD_BYTES;
+            offsets_pos += SIMD_BYTES;
+        }
+
+        while (filt_pos < filt_end)
+        {
+            if (*filt_pos)
+                copy_array(offsets_pos);
+
+            ++filt_pos;
+            ++offsets_pos;
+        }
+    }
+
+END_TARGET_SPECIFIC_CODE
+#endif
+
+
     template <typename T, typename ResultOffsetsBuilder>
     void filterArraysImplGeneric(
         const PaddedPODArray<T> & src_elems, const IColumn::Offsets_t & src_offsets,
@@ -184,6 +348,14 @@ namespace
                 res_elems.reserve((result_size_hint * src_elems.size() + size - 1) / size);
         }
 
+#if USE_MULTITARGET_CODE
+        if (isArchSupported(TargetArch::AVX2))
+        {
+            filterArraysImplAVX2<T>(src_elems, src_offsets, res_elems, result_offsets_builder, filt);
+            return;
+        }
+#endif
+
         const UInt8 * filt_pos = &filt[0];
         const auto filt_end = filt_pos + size;
 
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstring>
+
+#if __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include <Columns/IColumn.h>
 
 
@@ -11,6 +17,50 @@ namespace DB
 /// Counts how many bytes of `filt` are greater than zero.
 size_t countBytesInFilter(const IColumn::Filter & filt);
 
+/** Find the end of the run of equal values starting at `pos`: the first position whose
+  *  value differs from `*pos`, or `end`. The values are compared bitwise, which makes
+  *  the result usable for any pure elementwise function, including floats with NaNs:
+  *  identical bytes give identical results.
+  * On data without runs, returns after a single vector comparison.
+  */
+template <typename T>
+inline const T * findRunEnd(const T * pos, const T * end)
+{
+    static_assert(16 % sizeof(T) == 0, "findRunEnd supports only element sizes that divide 16");
+
+    if (pos == end)
+        return end;
+
+    const char * bytes = reinterpret_cast<const char *>(pos + 1);
+    const char * bytes_end = reinterpret_cast<const char *>(end);
+
+#if __SSE2__
+    /** Compare 16 bytes at a time with the 16 bytes one element earlier: while the windows
+      *  are equal, every element in the window is equal to its predecessor, and therefore
+      *  (by induction from the start of the run) to `*pos`.
+      */
+    while (bytes + 16 <= bytes_end)
+    {
+        __m128i window = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+        __m128i prev_window = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes - sizeof(T)));
+        UInt32 mask = _mm_movemask_epi8(_mm_cmpeq_epi8(window, prev_window));
+
+        if (mask != 0xFFFF)
+        {
+            size_t first_diff_byte = __builtin_ctz(~mask & 0xFFFF);
+            return reinterpret_cast<const T *>(bytes + first_diff_byte / sizeof(T) * sizeof(T));
+        }
+
+        bytes += 16;
+    }
+#endif
+
+    while (bytes < bytes_end && 0 == memcmp(bytes, pos, sizeof(T)))
+        bytes += sizeof(T);
+
+    return reinterpret_cast<const T *>(bytes);
+}
+
 /// Returns true, if the memory contains only zeros.
 bool memoryIsZero(const void * data, size_t size);
 
@@ -195,6 +195,20 @@ public:
     using Filter = PaddedPODArray<UInt8>;
     virtual ColumnPtr filter(const Filter & filt, ssize_t result_size_hint) const = 0;
 
+    /// Whether filterInPlace is implemented for this column.
+    virtual bool canBeFilteredInPlace() const { return false; }
+
+    /** In-place variant of `filter`: compacts the column's own buffers instead of allocating
+      *  a result column. Rows only move towards the beginning, so no temporary storage is needed.
+      * The caller must hold the only reference to the column (ColumnPtr::unique()),
+      *  otherwise the mutation would be visible through other references; use the
+      *  `filterColumn` helper below, which checks this.
+      */
+    virtual void filterInPlace(const Filter & filt)
+    {
+        throw Exception("Method filterInPlace is not supported for " + getName(), ErrorCodes::NOT_IMPLEMENTED);
+    }
+
     /// Permutes elements using specified permutation. Is used in sortings.
     /// limit - if it isn't 0, puts only first limit elements in the result.
     using Permutation = PaddedPODArray<size_t>;
@@ -299,4 +313,16 @@ protected:
 };
 
 
+/** Replaces the column in `column` with the filtered one.
+  * When the column is exclusively owned and supports it, filtering is done in place,
+  *  reusing the already allocated buffers; otherwise falls back to the allocating `filter`.
+  */
+inline void filterColumn(ColumnPtr & column, const IColumn::Filter & filt)
+{
+    if (column.unique() && column->canBeFilteredInPlace())
+        column->filterInPlace(filt);
+    else
+        column = column->filter(filt, -1);
+}
+
 }
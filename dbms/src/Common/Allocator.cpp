@@ -2,11 +2,13 @@
 #include <malloc.h>
 #endif
 
+#include <atomic>
 #include <cstdlib>
 #include <sys/mman.h>
 
 #include <Common/MemoryTracker.h>
 #include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
 #include <Common/Allocator.h>
 
 #include <IO/WriteHelpers.h>
@@ -17,6 +19,12 @@
 #endif
 
 
+namespace ProfileEvents
+{
+    extern const Event AllocatorHugePagesAdvised;
+    extern const Event AllocatorHugePagesAdvisedBytes;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -29,6 +37,40 @@ namespace ErrorCodes
 }
 
 
+static std::atomic<bool> allocator_huge_pages_enabled{true};
+
+void DB::setAllocatorHugePagesEnabled(bool value)
+{
+    allocator_huge_pages_enabled.store(value, std::memory_order_relaxed);
+}
+
+bool DB::allocatorHugePagesEnabled()
+{
+    return allocator_huge_pages_enabled.load(std::memory_order_relaxed);
+}
+
+
+/** Advise the kernel to back the chunk with transparent huge pages.
+  * We deliberately do not align the mapping itself to 2 MB: that would change the size passed
+  *  to munmap for every caller. khugepaged collapses every 2 MB-aligned region fully covered
+  *  by the advised range, which is all but the edges of a chunk of MMAP_THRESHOLD or more.
+  * The advice is best effort: failure (e.g. THP disabled in the kernel) is ignored.
+  */
+static void adviseHugePages(void * buf, size_t size)
+{
+#if defined(MADV_HUGEPAGE)
+    if (!DB::allocatorHugePagesEnabled())
+        return;
+
+    if (0 == madvise(buf, size, MADV_HUGEPAGE))
+    {
+        ProfileEvents::increment(ProfileEvents::AllocatorHugePagesAdvised);
+        ProfileEvents::increment(ProfileEvents::AllocatorHugePagesAdvisedBytes, size);
+    }
+#endif
+}
+
+
 /** Many modern allocators (for example, tcmalloc) do not do a mremap for realloc,
   *  even in case of large enough chunks of memory.
   * Although this allows you to increase performance and reduce memory consumption during realloc.
@@ -61,6 +103,8 @@ void * Allocator<clear_memory_>::alloc(size_t size, size_t alignment)
             DB::throwFromErrno("Allocator: Cannot mmap.", DB::ErrorCodes::CANNOT_ALLOCATE_MEMORY);
 
         /// No need for zero-fill, because mmap guarantees it.
+
+        adviseHugePages(buf, size);
     }
     else
     {
@@ -133,6 +177,8 @@ void * Allocator<clear_memory_>::realloc(void * buf, size_t old_size, size_t new
             DB::throwFromErrno("Allocator: Cannot mremap memory chunk from " + DB::toString(old_size) + " to " + DB::toString(new_size) + " bytes.", DB::ErrorCodes::CANNOT_MREMAP);
 
         /// No need for zero-fill, because mmap guarantees it.
+
+        adviseHugePages(buf, new_size);
     }
 #else
     // TODO: We need to use mmap/calloc on Apple too.
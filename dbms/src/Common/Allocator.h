@@ -3,6 +3,20 @@
 #include <string.h>
 
 
+namespace DB
+{
+
+/** Whether to advise the kernel (madvise(MADV_HUGEPAGE)) to back large mmapped chunks
+  *  with transparent huge pages. Noticeably lowers dTLB miss rates on multi-gigabyte
+  *  aggregation states. Enabled by default; can be turned off in the server config
+  *  (use_transparent_huge_pages).
+  */
+void setAllocatorHugePagesEnabled(bool value);
+bool allocatorHugePagesEnabled();
+
+}
+
+
 /** Responsible for allocating / freeing memory. Used, for example, in PODArray, Arena.
   * Also used in hash tables.
   * The interface is different from std::allocator
@@ -8,6 +8,7 @@
 #include <Core/Defines.h>
 #include <Common/ProfileEvents.h>
 #include <Common/Allocator.h>
+#include <Common/ArenaChunkPool.h>
 
 
 namespace ProfileEvents
@@ -45,7 +46,11 @@ private:
             ProfileEvents::increment(ProfileEvents::ArenaAllocChunks);
             ProfileEvents::increment(ProfileEvents::ArenaAllocBytes, size_);
 
-            begin = reinterpret_cast<char *>(Allocator::alloc(size_));
+            /// Prefer an already mapped and faulted in chunk from the pool of finished arenas.
+            begin = ArenaChunkPool::instance().tryPop(size_);
+            if (!begin)
+                begin = reinterpret_cast<char *>(Allocator::alloc(size_));
+
             pos = begin;
             end = begin + size_;
             prev = prev_;
@@ -53,7 +58,8 @@ private:
 
         ~Chunk()
         {
-            Allocator::free(begin, size());
+            if (!ArenaChunkPool::instance().tryPush(begin, size()))
+                Allocator::free(begin, size());
 
             if (prev)
                 delete prev;
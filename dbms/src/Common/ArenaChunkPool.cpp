@@ -0,0 +1,117 @@
+#include <Common/ArenaChunkPool.h>
+#include <Common/BitHelpers.h>
+#include <Common/MemoryTracker.h>
+#include <Common/ProfileEvents.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event ArenaChunkPoolHits;
+    extern const Event ArenaChunkPoolMisses;
+}
+
+
+namespace DB
+{
+
+ArenaChunkPool & ArenaChunkPool::instance()
+{
+    static ArenaChunkPool pool;
+    return pool;
+}
+
+
+bool ArenaChunkPool::isPooledSize(size_t size)
+{
+    return size >= (1ULL << min_size_degree)
+        && size <= (1ULL << max_size_degree)
+        && 0 == (size & (size - 1));
+}
+
+
+size_t ArenaChunkPool::sizeClass(size_t size)
+{
+    return bitScanReverse(size) - min_size_degree;
+}
+
+
+char * ArenaChunkPool::tryPop(size_t size)
+{
+    if (0 == max_size.load(std::memory_order_relaxed) || !isPooledSize(size))
+        return nullptr;
+
+    Node * node = nullptr;
+
+    {
+        auto & list = free_lists[sizeClass(size)];
+        std::lock_guard<std::mutex> lock(list.mutex);
+
+        node = list.head;
+        if (node)
+            list.head = node->next;
+    }
+
+    if (!node)
+    {
+        ProfileEvents::increment(ProfileEvents::ArenaChunkPoolMisses);
+        return nullptr;
+    }
+
+    pooled_bytes.fetch_sub(size, std::memory_order_relaxed);
+
+    /// The chunk now belongs to the query - account it like a fresh allocation.
+    try
+    {
+        CurrentMemoryTracker::alloc(size);
+    }
+    catch (...)
+    {
+        /// Memory limit exceeded - put the chunk back.
+        pooled_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        auto & list = free_lists[sizeClass(size)];
+        std::lock_guard<std::mutex> lock(list.mutex);
+        node->next = list.head;
+        list.head = node;
+
+        throw;
+    }
+
+    ProfileEvents::increment(ProfileEvents::ArenaChunkPoolHits);
+    return reinterpret_cast<char *>(node);
+}
+
+
+bool ArenaChunkPool::tryPush(char * ptr, size_t size)
+{
+    if (!isPooledSize(size))
+        return false;
+
+    /// Reserve space under the cap; if it does not fit, the chunk is freed for real.
+    if (pooled_bytes.fetch_add(size, std::memory_order_relaxed) + size > max_size.load(std::memory_order_relaxed))
+    {
+        pooled_bytes.fetch_sub(size, std::memory_order_relaxed);
+        return false;
+    }
+
+    {
+        auto & list = free_lists[sizeClass(size)];
+        std::lock_guard<std::mutex> lock(list.mutex);
+
+        Node * node = reinterpret_cast<Node *>(ptr);
+        node->next = list.head;
+        list.head = node;
+    }
+
+    /// The chunk no longer belongs to the query.
+    CurrentMemoryTracker::free(size);
+    return true;
+}
+
+
+void ArenaChunkPool::setMaxSize(size_t max_size_)
+{
+    max_size.store(max_size_, std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <boost/noncopyable.hpp>
+
+
+namespace DB
+{
+
+/** Process-wide pool of memory chunks for Arena.
+  *
+  * Every aggregation query builds arenas and frees them at the end; under a high rate of
+  *  short queries this causes constant mmap/munmap traffic and page fault storms.
+  * Instead of returning chunks to the allocator, Arena offers them to this pool,
+  *  and new arenas take chunks from it, already mapped and faulted in.
+  *
+  * Only power-of-two sizes in the range that Arena actually produces are pooled,
+  *  one free list per size class. The total amount of memory kept in the pool is bounded:
+  *  when the cap is reached, chunks are freed for real, so no separate trimming thread is needed.
+  * Memory in the pool is not attributed to any query; taking a chunk out of the pool
+  *  is accounted in MemoryTracker exactly like a fresh allocation.
+  *
+  * The pool is disabled (max_size = 0) by default and is enabled by the server
+  *  through the arena_chunk_pool_size config option.
+  */
+class ArenaChunkPool : private boost::noncopyable
+{
+public:
+    static ArenaChunkPool & instance();
+
+    /// Take a chunk of exactly `size` bytes from the pool. Returns nullptr if there is none
+    ///  or the size is not pooled. Accounts the chunk in the current memory tracker.
+    char * tryPop(size_t size);
+
+    /// Offer a chunk to the pool. Returns false if the size is not pooled or the cap is reached -
+    ///  then the caller must free the chunk itself. Otherwise releases it from the current memory tracker.
+    bool tryPush(char * ptr, size_t size);
+
+    /// Total amount of memory allowed to be kept in the pool. Zero disables pooling.
+    void setMaxSize(size_t max_size_);
+
+    size_t bytesInPool() const { return pooled_bytes.load(std::memory_order_relaxed); }
+
+private:
+    /// A free chunk stores the link to the next one in its first bytes.
+    struct Node
+    {
+        Node * next;
+    };
+
+    /// Size classes are powers of two from 4 KiB (initial arena chunks) to 256 MiB
+    ///  (above the default linear growth threshold).
+    static constexpr size_t min_size_degree = 12;
+    static constexpr size_t max_size_degree = 28;
+    static constexpr size_t num_size_classes = max_size_degree - min_size_degree + 1;
+
+    struct FreeList
+    {
+        std::mutex mutex;
+        Node * head = nullptr;
+    };
+
+    FreeList free_lists[num_size_classes];
+
+    std::atomic<size_t> pooled_bytes {0};
+    std::atomic<size_t> max_size {0};
+
+    static bool isPooledSize(size_t size);
+    static size_t sizeClass(size_t size);
+};
+
+}
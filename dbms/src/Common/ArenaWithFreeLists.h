@@ -1,7 +1,17 @@
 #pragma once
 
+#include <sys/mman.h>
+
 #include <Common/Arena.h>
 #include <Common/BitHelpers.h>
+#include <Common/ProfileEvents.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event ArenaLazyReleaseChunks;
+    extern const Event ArenaLazyReleaseBytes;
+}
 
 
 namespace DB
@@ -44,11 +54,40 @@ private:
     /// The first two elements are not used, but are intended to simplify arithmetic.
     Block * free_lists[16] {};
 
+    /// Give the pages of freed blocks back to the kernel lazily (madvise(MADV_FREE)).
+    bool lazy_release = false;
+
+    /** Let the kernel reclaim the pages of a freed block until they are written to again.
+      * Only pages lying entirely inside the block are released - its edges may share pages
+      *  with neighbouring live blocks. The page with the free list link is kept intact.
+      * Contents of released pages may be replaced with zeros at any moment, which is fine:
+      *  the block is free and will be fully overwritten by the next user.
+      */
+    void releaseLazily(char * ptr, const size_t size)
+    {
+#if defined(MADV_FREE)
+        static constexpr uintptr_t page_size = 4096;
+
+        const uintptr_t release_begin = (reinterpret_cast<uintptr_t>(ptr) + sizeof(Block *) + page_size - 1) / page_size * page_size;
+        const uintptr_t release_end = (reinterpret_cast<uintptr_t>(ptr) + size) / page_size * page_size;
+
+        if (release_begin >= release_end)
+            return;
+
+        if (0 == madvise(reinterpret_cast<void *>(release_begin), release_end - release_begin, MADV_FREE))
+        {
+            ProfileEvents::increment(ProfileEvents::ArenaLazyReleaseChunks);
+            ProfileEvents::increment(ProfileEvents::ArenaLazyReleaseBytes, release_end - release_begin);
+        }
+#endif
+    }
+
 public:
     ArenaWithFreeLists(
         const size_t initial_size = 4096, const size_t growth_factor = 2,
-        const size_t linear_growth_threshold = 128 * 1024 * 1024)
-        : pool{initial_size, growth_factor, linear_growth_threshold}
+        const size_t linear_growth_threshold = 128 * 1024 * 1024,
+        const bool lazy_release_ = false)
+        : pool{initial_size, growth_factor, linear_growth_threshold}, lazy_release(lazy_release_)
     {
     }
 
@@ -86,6 +125,9 @@ public:
         const auto old_head = free_block_ptr;
         free_block_ptr = reinterpret_cast<Block *>(ptr);
         free_block_ptr->next = old_head;
+
+        if (lazy_release)
+            releaseLazily(ptr, 1ULL << (list_idx + 1));
     }
 
     /// Size of the allocated pool in bytes
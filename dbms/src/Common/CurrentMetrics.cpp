@@ -30,6 +30,7 @@
     M(EphemeralNode) \
     M(ZooKeeperWatch) \
     M(DelayedInserts) \
+    M(QueriesQueued) \
     M(ContextLockWait) \
     M(StorageBufferRows) \
     M(StorageBufferBytes) \
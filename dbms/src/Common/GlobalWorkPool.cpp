@@ -0,0 +1,204 @@
+#include <Common/GlobalWorkPool.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
+#include <Common/MemoryTracker.h>
+#include <Common/setThreadName.h>
+
+
+namespace DB
+{
+
+GlobalWorkPool & GlobalWorkPool::instance()
+{
+    static GlobalWorkPool res;
+    return res;
+}
+
+
+GlobalWorkPool::GlobalWorkPool()
+{
+    /// Twice the number of cores: the jobs are not pure CPU - they also wait on disks,
+    ///  the network and the bounded queues between the pipeline stages.
+    size_t num_threads = 2 * getNumberOfPhysicalCPUCores();
+
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+        threads.emplace_back([this] { worker(); });
+}
+
+
+GlobalWorkPool::~GlobalWorkPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        shutdown = true;
+        has_work.notify_all();
+
+        while (surge_workers)
+            surge_finished.wait(lock);
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+}
+
+
+void GlobalWorkPool::schedule(const GroupPtr & group, Job job)
+{
+    bool spawn_surge_worker = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        group->pending.push_back(std::move(job));
+        ++group->unfinished;
+        ++pending_jobs;
+
+        if (!group->in_rotation)
+        {
+            rotation.push_back(group);
+            group->in_rotation = true;
+        }
+
+        /** The jobs of the pipeline may block on the queues between the pipeline stages,
+          *  so a job must not wait for a busy worker: the consumer that would unblock
+          *  a worker may itself be waiting for the job being scheduled right now.
+          * If there are not enough idle workers to claim every queued job, spawn
+          *  a short-lived worker for the burst.
+          */
+        if (pending_jobs > idle_workers)
+        {
+            ++surge_workers;
+            spawn_surge_worker = true;
+        }
+    }
+
+    if (spawn_surge_worker)
+        std::thread([this] { surgeWorker(); }).detach();
+    else
+        has_work.notify_one();
+}
+
+
+bool GlobalWorkPool::takeJob(std::unique_lock<std::mutex> & lock, GroupPtr & group, Job & job)
+{
+    if (rotation.empty())
+        return false;
+
+    group = rotation.front();
+    rotation.pop_front();
+
+    /// One job from the group at the head, then the group goes to the tail
+    ///  - round robin between the groups, so one query with many queued jobs
+    ///  does not delay the others.
+    job = std::move(group->pending.front());
+    group->pending.pop_front();
+    --pending_jobs;
+
+    if (!group->pending.empty())
+        rotation.push_back(group);
+    else
+        group->in_rotation = false;
+
+    return true;
+}
+
+
+void GlobalWorkPool::worker()
+{
+    setThreadName("GlobalWorkPool");
+
+    while (true)
+    {
+        GroupPtr group;
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            ++idle_workers;
+            has_work.wait(lock, [this] { return shutdown || !rotation.empty(); });
+            --idle_workers;
+
+            if (shutdown)
+                return;
+
+            if (!takeJob(lock, group, job))
+                continue;
+        }
+
+        runJob(group, job);
+    }
+}
+
+
+void GlobalWorkPool::surgeWorker()
+{
+    setThreadName("SurgeWorkPool");
+
+    while (true)
+    {
+        GroupPtr group;
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            /// Unlike the fixed workers, exit as soon as there is nothing to do.
+            if (!takeJob(lock, group, job))
+            {
+                --surge_workers;
+                surge_finished.notify_all();
+                return;
+            }
+        }
+
+        runJob(group, job);
+    }
+}
+
+
+void GlobalWorkPool::runJob(const GroupPtr & group, Job & job)
+{
+    std::exception_ptr exception;
+
+    try
+    {
+        job();
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    /// The jobs set the thread-local pointers of their query; do not leak them to the next job.
+    current_memory_tracker = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (exception && !group->first_exception)
+            group->first_exception = exception;
+
+        --group->unfinished;
+        if (!group->unfinished)
+            group_done.notify_all();
+    }
+}
+
+
+void GlobalWorkPool::wait(const GroupPtr & group)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (group->unfinished)
+        group_done.wait(lock);
+
+    if (group->first_exception)
+    {
+        std::exception_ptr exception = group->first_exception;
+        group->first_exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace DB
+{
+
+/** A process-wide pool of worker threads for the parallelism of query pipelines.
+  *
+  * Under a high rate of short queries, creating and joining fresh threads for every
+  *  UnionBlockInputStream and AsynchronousBlockInputStream costs more than the useful work
+  *  the threads do. The pool keeps a fixed population of workers (twice the number of
+  *  physical cores) and reuses them across queries.
+  *
+  * Jobs are tagged with a group - one group per pipeline operator. The workers take one job
+  *  at a time from the groups in round robin order, so concurrent queries progress fairly
+  *  regardless of how many jobs each of them has queued. The owner of a group waits for
+  *  the completion of exactly its jobs with `wait`.
+  *
+  * The jobs of the pipeline are long-running and may block on the bounded queues between
+  *  the pipeline stages, so a job must never wait in the queue for a busy worker: the
+  *  consumer that would unblock the worker may itself be waiting for that queued job.
+  * Therefore, when a job is scheduled and no worker is idle, the pool spawns a short-lived
+  *  "surge" worker that exits as soon as the queue is empty again. Under normal load the
+  *  fixed workers absorb everything and no threads are created; thread creation remains
+  *  only for bursts above the fixed population.
+  *
+  * Cancellation stays cooperative, as everywhere in the pipeline: `cancel` of the streams
+  *  raises flags that the running jobs observe; the pool itself never aborts a job.
+  */
+class GlobalWorkPool
+{
+public:
+    using Job = std::function<void()>;
+
+    /// The jobs of one owner (typically - one operator of one query pipeline).
+    class Group
+    {
+        friend class GlobalWorkPool;
+
+        std::deque<Job> pending;
+        size_t unfinished = 0;    /// Pending + currently running.
+        bool in_rotation = false;
+        std::exception_ptr first_exception;
+    };
+
+    using GroupPtr = std::shared_ptr<Group>;
+
+    static GlobalWorkPool & instance();
+
+    GroupPtr createGroup() const { return std::make_shared<Group>(); }
+
+    /// Queue a job. Never blocks waiting for a free worker.
+    void schedule(const GroupPtr & group, Job job);
+
+    /** Wait until all the jobs of the group have finished.
+      * Rethrows the first exception thrown by a job of the group.
+      */
+    void wait(const GroupPtr & group);
+
+    ~GlobalWorkPool();
+
+private:
+    GlobalWorkPool();
+
+    void worker();
+    void surgeWorker();
+    /// Take one job under the already taken lock; returns false if there is nothing to do.
+    bool takeJob(std::unique_lock<std::mutex> & lock, GroupPtr & group, Job & job);
+    void runJob(const GroupPtr & group, Job & job);
+
+    std::mutex mutex;
+    std::condition_variable has_work;      /// A job was queued or shutdown was requested.
+    std::condition_variable group_done;    /// Some group has no unfinished jobs left.
+    std::condition_variable surge_finished;
+
+    /// Groups with pending jobs, in round robin order.
+    std::deque<GroupPtr> rotation;
+
+    std::vector<std::thread> threads;
+    size_t pending_jobs = 0;    /// Queued and not yet taken by any worker.
+    size_t idle_workers = 0;
+    size_t surge_workers = 0;
+    bool shutdown = false;
+};
+
+}
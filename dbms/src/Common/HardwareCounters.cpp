@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+#include <Common/HardwareCounters.h>
+
+
+namespace DB
+{
+
+thread_local HardwareCounters * current_hardware_counters = nullptr;
+
+namespace
+{
+
+#if defined(__linux__)
+
+int openPerfEvent(UInt32 type, UInt64 config)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_idle = 1;
+
+    /// pid = 0, cpu = -1: the calling thread, on any CPU.
+    int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+    if (fd < 0 && (errno == EACCES || errno == EPERM))
+    {
+        /// Counting kernel events may be forbidden by perf_event_paranoid - count only user space then.
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+
+    return fd;
+}
+
+int openCounter(size_t counter)
+{
+    switch (counter)
+    {
+        case HardwareCounters::CYCLES:        return openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        case HardwareCounters::INSTRUCTIONS:  return openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        case HardwareCounters::CACHE_MISSES:  return openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        case HardwareCounters::BRANCH_MISSES: return openPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        case HardwareCounters::PAGE_FAULTS:   return openPerfEvent(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+        default:                              return -1;
+    }
+}
+
+#else
+
+int openCounter(size_t)
+{
+    return -1;
+}
+
+#endif
+
+/// Each read of a perf event fd returns the current total value of the counter.
+/// The fd of another thread's counter may be read as well - this is used for system.processes.
+UInt64 readCounter(int fd)
+{
+    UInt64 value = 0;
+
+    if (fd >= 0 && sizeof(value) != ::read(fd, &value, sizeof(value)))
+        value = 0;
+
+    return value;
+}
+
+}
+
+
+HardwareCounters::Values HardwareCounters::getValues() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Values res = accumulated;
+
+    for (const ThreadCounters * thread_counters : threads)
+        for (size_t i = 0; i < NUM_COUNTERS; ++i)
+            res.values[i] += readCounter(thread_counters->fds[i]);
+
+    return res;
+}
+
+
+void HardwareCounters::attachThread(const ThreadCounters * thread_counters)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.push_back(thread_counters);
+}
+
+
+void HardwareCounters::detachThread(const ThreadCounters * thread_counters)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (size_t i = 0; i < NUM_COUNTERS; ++i)
+        accumulated.values[i] += readCounter(thread_counters->fds[i]);
+
+    threads.erase(std::find(threads.begin(), threads.end(), thread_counters));
+}
+
+
+HardwareCountersThreadScope::HardwareCountersThreadScope(HardwareCounters & parent_)
+    : parent(parent_)
+{
+    for (size_t i = 0; i < HardwareCounters::NUM_COUNTERS; ++i)
+        thread_counters.fds[i] = openCounter(i);
+
+    parent.attachThread(&thread_counters);
+}
+
+
+HardwareCountersThreadScope::~HardwareCountersThreadScope()
+{
+    parent.detachThread(&thread_counters);
+
+    for (size_t i = 0; i < HardwareCounters::NUM_COUNTERS; ++i)
+        if (thread_counters.fds[i] >= 0)
+            close(thread_counters.fds[i]);
+}
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+class HardwareCountersThreadScope;
+
+/** Hardware performance counters of a query (via perf_event_open), accumulated over all its threads.
+  * Each query thread opens its own set of counters with HardwareCountersThreadScope;
+  *  the values of the running threads can be read at any time (for system.processes),
+  *  and the values of finished threads are accumulated here.
+  *
+  * Works only on Linux. If the kernel forbids to open the events
+  *  (see /proc/sys/kernel/perf_event_paranoid), the values stay zero.
+  */
+class HardwareCounters : private boost::noncopyable
+{
+public:
+    enum Counter : size_t
+    {
+        CYCLES = 0,
+        INSTRUCTIONS,
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        PAGE_FAULTS,
+
+        NUM_COUNTERS
+    };
+
+    struct Values
+    {
+        UInt64 values[NUM_COUNTERS] {};
+    };
+
+    /// Values of the finished threads plus the current values of the running ones.
+    Values getValues() const;
+
+private:
+    friend class HardwareCountersThreadScope;
+
+    struct ThreadCounters
+    {
+        int fds[NUM_COUNTERS];
+    };
+
+    mutable std::mutex mutex;
+    std::vector<const ThreadCounters *> threads;    /// Counters of the running threads.
+    Values accumulated;                             /// Values of the finished threads.
+
+    void attachThread(const ThreadCounters * thread_counters);
+    void detachThread(const ThreadCounters * thread_counters);
+};
+
+
+/** Opens the hardware counters for the current thread and registers them in the per-query object.
+  * Create in the thread that should be counted; on destruction the values are accumulated.
+  */
+class HardwareCountersThreadScope : private boost::noncopyable
+{
+public:
+    HardwareCountersThreadScope(HardwareCounters & parent_);
+    ~HardwareCountersThreadScope();
+
+private:
+    HardwareCounters & parent;
+    HardwareCounters::ThreadCounters thread_counters;
+};
+
+
+/** Hardware counters of the query of the current thread, if they are enabled.
+  * Used to attach the worker threads of the query, analogous to current_memory_tracker.
+  */
+extern thread_local HardwareCounters * current_hardware_counters;
+
+}
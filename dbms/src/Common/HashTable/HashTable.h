@@ -721,6 +721,18 @@ public:
     }
 
 
+    /** Prefetch the cell where a key with the given hash would be looked up.
+      * Allows to overlap the memory latency of several probes: calculate the hashes of keys
+      *  a few rows ahead, prefetch their cells, and only then do the inserts or lookups
+      *  (see Aggregator::executeImplCase). If the table is resized in between, the prefetched
+      *  address becomes stale - this is harmless, the prefetch is just a hint.
+      */
+    void ALWAYS_INLINE prefetch(size_t hash_value) const
+    {
+        __builtin_prefetch(&buf[grower.place(hash_value)]);
+    }
+
+
     /// Copy the cell from another hash table. It is assumed that the cell is not zero, and also that there was no such key in the table yet.
     void ALWAYS_INLINE insertUniqueNonZero(const Cell * cell, size_t hash_value)
     {
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <Common/HashTable/TwoLevelHashTable.h>
+#include <Common/HashTable/HashSet.h>
+
+
+template
+<
+    typename Key,
+    typename Hash = DefaultHash<Key>,
+    typename Grower = TwoLevelHashTableGrower<>,
+    typename Allocator = HashTableAllocator
+>
+using TwoLevelHashSet = TwoLevelHashTable<Key, HashTableCell<Key, Hash>, Hash, Grower, Allocator,
+    HashSetTable<Key, HashTableCell<Key, Hash>, Hash, Grower, Allocator>>;
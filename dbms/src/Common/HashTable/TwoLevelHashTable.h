@@ -252,6 +252,13 @@ public:
     }
 
 
+    /// Prefetch the cell where a key with the given hash would be looked up.
+    void ALWAYS_INLINE prefetch(size_t hash_value) const
+    {
+        impls[getBucketFromHash(hash_value)].prefetch(hash_value);
+    }
+
+
     iterator ALWAYS_INLINE find(Key x)
     {
         size_t hash_value = hash(x);
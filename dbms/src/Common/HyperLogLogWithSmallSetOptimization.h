@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include <Common/HyperLogLogCounter.h>
 #include <Common/HashTable/SmallTable.h>
 #include <Common/MemoryTracker.h>
@@ -10,9 +13,17 @@ namespace DB
 
 
 /** For a small number of keys - an array of fixed size "on the stack".
-  * For large, HyperLogLog is allocated.
-  * See also the more practical implementation in CombinedCardinalityEstimator.h,
-  *  where a hash table is also used for medium-sized sets.
+  * Then a sorted list of (bucket, rank) pairs: the same information the dense register
+  *  array would hold, but in a few bytes per value actually seen.
+  * Only when the list approaches the size of the register array, HyperLogLog is allocated.
+  * Most groups of a typical GROUP BY with uniq() hold well under a hundred distinct values,
+  *  and the sparse stage keeps them from paying for the full register array.
+  *
+  * The serialized format is unchanged: a sparse state is written in the dense form,
+  *  because states are exchanged between servers, possibly of different versions.
+  *
+  * See also the implementation in CombinedCardinalityEstimator.h, where a hash table
+  *  of the values themselves is used for medium-sized sets.
   */
 template
 <
@@ -27,41 +38,137 @@ private:
     using Small = SmallSet<Key, small_set_size>;
     using Large = HyperLogLogCounter<K, Hash, UInt32, DenominatorType>;
 
+    /// Sorted (bucket << 8 | rank) entries: ordering by bucket allows binary search and merge.
+    using Sparse = std::vector<UInt32>;
+
+    /// Past this number of entries the list is within a small factor of the register array's
+    ///  size, and the dense representation wins on lookup cost.
+    static constexpr size_t sparse_max_entries = (1ULL << K) / 8;
+
+    enum class Kind : UInt8 { IsSmall = 0, IsSparse = 1, IsLarge = 2 };
+
     Small small;
-    Large * large = nullptr;
 
-    bool isLarge() const
+    /// Which representation the address holds is recorded in its lowest bits (they are zero
+    ///  for any allocation), as in CombinedCardinalityEstimator.
+    union
+    {
+        Sparse * sparse;
+        Large * large;
+        UInt64 address = 0;
+    };
+    static constexpr UInt64 mask = 0xFFFFFFFFFFFFFFFC;
+
+    Kind getKind() const { return static_cast<Kind>(address & ~mask); }
+    void setKind(Kind kind) { address = (address & mask) | static_cast<UInt8>(kind); }
+
+    Sparse & getSparse() { return *reinterpret_cast<Sparse *>(address & mask); }
+    const Sparse & getSparse() const { return *reinterpret_cast<Sparse *>(address & mask); }
+    Large & getLarge() { return *reinterpret_cast<Large *>(address & mask); }
+    const Large & getLarge() const { return *reinterpret_cast<Large *>(address & mask); }
+
+    /// Raise the rank of the bucket in a sorted entry list, inserting the bucket if it is new.
+    static void addSparseEntry(Sparse & entries, UInt32 bucket, UInt8 rank)
+    {
+        UInt32 entry = (bucket << 8) | rank;
+        auto it = std::lower_bound(entries.begin(), entries.end(), bucket << 8);
+
+        if (it != entries.end() && (*it >> 8) == bucket)
+        {
+            if (static_cast<UInt8>(*it) < rank)
+                *it = entry;
+        }
+        else
+            entries.insert(it, entry);
+    }
+
+    void toSparse()
+    {
+        CurrentMemoryTracker::alloc(sizeof(Sparse));
+        auto tmp_sparse = std::make_unique<Sparse>();
+        tmp_sparse->reserve(small_set_size * 2);
+
+        for (const auto & x : small)
+        {
+            UInt32 bucket;
+            UInt8 rank;
+            Large::bucketAndRank(x, bucket, rank);
+            addSparseEntry(*tmp_sparse, bucket, rank);
+        }
+
+        sparse = tmp_sparse.release();
+        setKind(Kind::IsSparse);
+    }
+
+    void destroySparse()
     {
-        return large != nullptr;
+        Sparse * old_sparse = &getSparse();
+        address = 0;
+        delete old_sparse;
+        CurrentMemoryTracker::free(sizeof(Sparse));
     }
 
     void toLarge()
     {
         CurrentMemoryTracker::alloc(sizeof(Large));
 
-        /// At the time of copying data from `tiny`, setting the value of `large` is still not possible (otherwise it will overwrite some data).
-        Large * tmp_large = new Large;
+        /// At the time of copying the data, setting the value of `large` is still not possible
+        ///  (otherwise it will overwrite some data).
+        auto tmp_large = std::make_unique<Large>();
 
-        for (const auto & x : small)
-            tmp_large->insert(x);
+        if (getKind() == Kind::IsSparse)
+        {
+            materializeSparse(*tmp_large);
+            destroySparse();
+        }
+        else
+        {
+            for (const auto & x : small)
+                tmp_large->insert(x);
+        }
 
-        large = tmp_large;
+        large = tmp_large.release();
+        setKind(Kind::IsLarge);
+    }
+
+    void materializeSparse(Large & out) const
+    {
+        for (UInt32 entry : getSparse())
+            out.update(entry >> 8, static_cast<UInt8>(entry));
+    }
+
+    void insertIntoSparse(Key value)
+    {
+        UInt32 bucket;
+        UInt8 rank;
+        Large::bucketAndRank(value, bucket, rank);
+
+        auto & entries = getSparse();
+        addSparseEntry(entries, bucket, rank);
+
+        if (entries.size() > sparse_max_entries)
+            toLarge();
     }
 
 public:
     ~HyperLogLogWithSmallSetOptimization()
     {
-        if (isLarge())
-        {
-            delete large;
+        auto kind = getKind();
 
+        if (kind == Kind::IsSparse)
+            destroySparse();
+        else if (kind == Kind::IsLarge)
+        {
+            delete &getLarge();
             CurrentMemoryTracker::free(sizeof(Large));
         }
     }
 
     void insert(Key value)
     {
-        if (!isLarge())
+        auto kind = getKind();
+
+        if (kind == Kind::IsSmall)
         {
             if (small.find(value) == small.end())
             {
@@ -69,33 +176,68 @@ public:
                     small.insert(value);
                 else
                 {
-                    toLarge();
-                    large->insert(value);
+                    toSparse();
+                    insertIntoSparse(value);
                 }
             }
         }
+        else if (kind == Kind::IsSparse)
+            insertIntoSparse(value);
         else
-            large->insert(value);
+            getLarge().insert(value);
     }
 
     UInt32 size() const
     {
-        return !isLarge() ? small.size() : large->size();
+        auto kind = getKind();
+
+        if (kind == Kind::IsSmall)
+            return small.size();
+
+        if (kind == Kind::IsSparse)
+        {
+            /// The estimate is computed by the dense counter over a temporary materialization,
+            ///  so sparse and dense states of the same data give the same answer.
+            Large tmp;
+            materializeSparse(tmp);
+            return tmp.size();
+        }
+
+        return getLarge().size();
     }
 
     void merge(const HyperLogLogWithSmallSetOptimization & rhs)
     {
-        if (rhs.isLarge())
+        auto rhs_kind = rhs.getKind();
+
+        if (rhs_kind == Kind::IsSmall)
         {
-            if (!isLarge())
-                toLarge();
+            for (const auto & x : rhs.small)
+                insert(x);
+        }
+        else if (rhs_kind == Kind::IsSparse)
+        {
+            if (getKind() == Kind::IsSmall)
+                toSparse();
 
-            large->merge(*rhs.large);
+            if (getKind() == Kind::IsSparse)
+            {
+                auto & entries = getSparse();
+                for (UInt32 entry : rhs.getSparse())
+                    addSparseEntry(entries, entry >> 8, static_cast<UInt8>(entry));
+
+                if (entries.size() > sparse_max_entries)
+                    toLarge();
+            }
+            else
+                rhs.materializeSparse(getLarge());
         }
         else
         {
-            for (const auto & x : rhs.small)
-                insert(x);
+            if (getKind() != Kind::IsLarge)
+                toLarge();
+
+            getLarge().merge(rhs.getLarge());
         }
     }
 
@@ -108,7 +250,7 @@ public:
         if (is_large)
         {
             toLarge();
-            large->read(in);
+            getLarge().read(in);
         }
         else
             small.read(in);
@@ -119,9 +261,6 @@ public:
         bool is_rhs_large;
         readBinary(is_rhs_large, in);
 
-        if (!isLarge() && is_rhs_large)
-            toLarge();
-
         if (!is_rhs_large)
         {
             typename Small::Reader reader(in);
@@ -129,17 +268,31 @@ public:
                 insert(reader.get());
         }
         else
-            large->readAndMerge(in);
+        {
+            /// A dense state follows; the merge-heavy path works on the dense form.
+            if (getKind() != Kind::IsLarge)
+                toLarge();
+
+            getLarge().readAndMerge(in);
+        }
     }
 
     void write(DB::WriteBuffer & out) const
     {
-        writeBinary(isLarge(), out);
+        auto kind = getKind();
+        writeBinary(kind != Kind::IsSmall, out);
 
-        if (isLarge())
-            large->write(out);
-        else
+        if (kind == Kind::IsSmall)
             small.write(out);
+        else if (kind == Kind::IsSparse)
+        {
+            /// Written in the dense form, to keep the serialized format versionless.
+            Large tmp;
+            materializeSparse(tmp);
+            tmp.write(out);
+        }
+        else
+            getLarge().write(out);
     }
 };
 
@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 #include <list>
+#include <vector>
 #include <memory>
 #include <chrono>
 #include <mutex>
@@ -29,6 +30,14 @@ struct TrivialWeightFunction
 /// Cache starts to evict entries when their total weight exceeds max_size and when expiration time of these
 /// entries is due.
 /// Value weight should not change after insertion.
+///
+/// Eviction is guided by the SLRU policy: a new entry lands in a "probationary" part of the cache
+///  and is promoted to a "protected" part (at most half of the cache) only when it is accessed again.
+/// Eviction takes entries from the probationary part, so a one-shot scan of a large table
+///  cannot displace entries that are accessed repeatedly.
+///
+/// The cache can be split into several shards, selected by the hash of the key,
+///  each with its own mutex: use it when the cache is accessed concurrently at high rate.
 template <typename TKey, typename TMapped, typename HashFunction = std::hash<TKey>, typename WeightFunction = TrivialWeightFunction<TMapped>>
 class LRUCache
 {
@@ -43,27 +52,23 @@ private:
     using Timestamp = Clock::time_point;
 
 public:
-    LRUCache(size_t max_size_, const Delay & expiration_delay_ = Delay::zero())
-        : max_size(std::max(static_cast<size_t>(1), max_size_)), expiration_delay(expiration_delay_) {}
+    LRUCache(size_t max_size_, const Delay & expiration_delay_ = Delay::zero(), size_t num_shards_ = 1)
+    {
+        num_shards_ = std::max(static_cast<size_t>(1), num_shards_);
+        shards.reserve(num_shards_);
+        for (size_t i = 0; i < num_shards_; ++i)
+            shards.emplace_back(std::make_unique<Shard>(
+                *this, std::max(static_cast<size_t>(1), max_size_ / num_shards_), expiration_delay_));
+    }
 
     MappedPtr get(const Key & key)
     {
-        std::lock_guard<std::mutex> lock(mutex);
-
-        auto res = getImpl(key, lock);
-        if (res)
-            ++hits;
-        else
-            ++misses;
-
-        return res;
+        return shardForKey(key).get(key);
     }
 
     void set(const Key & key, const MappedPtr & mapped)
     {
-        std::lock_guard<std::mutex> lock(mutex);
-
-        setImpl(key, mapped, lock);
+        shardForKey(key).set(key, mapped);
     }
 
     /// If the value for the key is in the cache, returns it. If it is not, calls load_func() to
@@ -77,80 +82,49 @@ public:
     template <typename LoadFunc>
     std::pair<MappedPtr, bool> getOrSet(const Key & key, LoadFunc && load_func)
     {
-        InsertTokenHolder token_holder;
-        {
-            std::lock_guard<std::mutex> cache_lock(mutex);
-
-            auto val = getImpl(key, cache_lock);
-            if (val)
-            {
-                ++hits;
-                return std::make_pair(val, false);
-            }
-
-            auto & token = insert_tokens[key];
-            if (!token)
-                token = std::make_shared<InsertToken>(*this);
-
-            token_holder.acquire(&key, token, cache_lock);
-        }
-
-        InsertToken * token = token_holder.token.get();
-
-        std::lock_guard<std::mutex> token_lock(token->mutex);
-
-        token_holder.cleaned_up = token->cleaned_up;
-
-        if (token->value)
-        {
-            /// Another thread already produced the value while we waited for token->mutex.
-            ++hits;
-            return std::make_pair(token->value, false);
-        }
-
-        ++misses;
-        token->value = load_func();
-
-        std::lock_guard<std::mutex> cache_lock(mutex);
-
-        /// Insert the new value only if the token is still in present in insert_tokens.
-        /// (The token may be absent because of a concurrent reset() call).
-        auto token_it = insert_tokens.find(key);
-        if (token_it != insert_tokens.end() && token_it->second.get() == token)
-            setImpl(key, token->value, cache_lock);
-
-        if (!token->cleaned_up)
-            token_holder.cleanup(token_lock, cache_lock);
+        return shardForKey(key).getOrSet(key, std::forward<LoadFunc>(load_func));
+    }
 
-        return std::make_pair(token->value, true);
+    /// Returns true if the key is in the cache. Does not affect the eviction order and the statistics.
+    bool contains(const Key & key) const
+    {
+        const Shard & shard = shardForKey(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cells.count(key);
     }
 
     void getStats(size_t & out_hits, size_t & out_misses) const
     {
-        std::lock_guard<std::mutex> lock(mutex);
         out_hits = hits;
         out_misses = misses;
     }
 
     size_t weight() const
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        return current_size;
+        size_t res = 0;
+        for (const auto & shard : shards)
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            res += shard->current_size;
+        }
+        return res;
     }
 
     size_t count() const
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        return cells.size();
+        size_t res = 0;
+        for (const auto & shard : shards)
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            res += shard->cells.size();
+        }
+        return res;
     }
 
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        queue.clear();
-        cells.clear();
-        insert_tokens.clear();
-        current_size = 0;
+        for (auto & shard : shards)
+            shard->reset();
         hits = 0;
         misses = 0;
         current_weight_lost = 0;
@@ -158,21 +132,22 @@ public:
 
 protected:
     /// Total weight of evicted values. This value is reset every time it is sent to profile events.
-    size_t current_weight_lost = 0;
+    std::atomic<size_t> current_weight_lost {0};
 
 private:
+    struct Shard;
 
     /// Represents pending insertion attempt.
     struct InsertToken
     {
-        InsertToken(LRUCache & cache_) : cache(cache_) {}
+        InsertToken(Shard & shard_) : shard(shard_) {}
 
         std::mutex mutex;
         bool cleaned_up = false; /// Protected by the token mutex
         MappedPtr value; /// Protected by the token mutex
 
-        LRUCache & cache;
-        size_t refcount = 0; /// Protected by the cache mutex
+        Shard & shard;
+        size_t refcount = 0; /// Protected by the shard mutex
     };
 
     using InsertTokenById = std::unordered_map<Key, std::shared_ptr<InsertToken>, HashFunction>;
@@ -188,16 +163,16 @@ private:
 
         InsertTokenHolder() = default;
 
-        void acquire(const Key * key_, const std::shared_ptr<InsertToken> & token_, std::lock_guard<std::mutex> & cache_lock)
+        void acquire(const Key * key_, const std::shared_ptr<InsertToken> & token_, std::lock_guard<std::mutex> & shard_lock)
         {
             key = key_;
             token = token_;
             ++token->refcount;
         }
 
-        void cleanup(std::lock_guard<std::mutex> & token_lock, std::lock_guard<std::mutex> & cache_lock)
+        void cleanup(std::lock_guard<std::mutex> & token_lock, std::lock_guard<std::mutex> & shard_lock)
         {
-            token->cache.insert_tokens.erase(*key);
+            token->shard.insert_tokens.erase(*key);
             token->cleaned_up = true;
             cleaned_up = true;
         }
@@ -215,11 +190,11 @@ private:
             if (token->cleaned_up)
                 return;
 
-            std::lock_guard<std::mutex> cache_lock(token->cache.mutex);
+            std::lock_guard<std::mutex> shard_lock(token->shard.mutex);
 
             --token->refcount;
             if (token->refcount == 0)
-                cleanup(token_lock, cache_lock);
+                cleanup(token_lock, shard_lock);
         }
     };
 
@@ -239,108 +214,271 @@ private:
         MappedPtr value;
         size_t size;
         LRUQueueIterator queue_iterator;
+        bool is_protected = false;
         Timestamp timestamp;
     };
 
     using Cells = std::unordered_map<Key, Cell, HashFunction>;
 
-    InsertTokenById insert_tokens;
+    /// A part of the cache with its own mutex, LRU queues and entries.
+    struct Shard
+    {
+        Shard(LRUCache & cache_, size_t max_size_, const Delay & expiration_delay_)
+            : cache(cache_), max_size(max_size_),
+            max_protected_size(max_size_ / 2),      /// The rest is left to the probationary part.
+            expiration_delay(expiration_delay_) {}
+
+        LRUCache & cache;
 
-    LRUQueue queue;
-    Cells cells;
+        InsertTokenById insert_tokens;
 
-    /// Total weight of values.
-    size_t current_size = 0;
-    const size_t max_size;
-    const Delay expiration_delay;
+        /// Entries that were accessed only once so far. They are evicted first.
+        LRUQueue probationary_queue;
+        /// Entries that were accessed at least twice. They can only be displaced by other such entries.
+        LRUQueue protected_queue;
+        Cells cells;
 
-    mutable std::mutex mutex;
-    std::atomic<size_t> hits {0};
-    std::atomic<size_t> misses {0};
+        /// Total weight of values.
+        size_t current_size = 0;
+        size_t current_protected_size = 0;
+        const size_t max_size;
+        const size_t max_protected_size;
+        const Delay expiration_delay;
 
-    WeightFunction weight_function;
+        mutable std::mutex mutex;
 
-    MappedPtr getImpl(const Key & key, std::lock_guard<std::mutex> & cache_lock)
-    {
-        auto it = cells.find(key);
-        if (it == cells.end())
+        MappedPtr get(const Key & key)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto res = getImpl(key, lock);
+            if (res)
+                ++cache.hits;
+            else
+                ++cache.misses;
+
+            return res;
+        }
+
+        void set(const Key & key, const MappedPtr & mapped)
         {
-            return MappedPtr();
+            std::lock_guard<std::mutex> lock(mutex);
+
+            setImpl(key, mapped, lock);
         }
 
-        Cell & cell = it->second;
-        updateCellTimestamp(cell);
+        template <typename LoadFunc>
+        std::pair<MappedPtr, bool> getOrSet(const Key & key, LoadFunc && load_func)
+        {
+            InsertTokenHolder token_holder;
+            {
+                std::lock_guard<std::mutex> shard_lock(mutex);
 
-        /// Move the key to the end of the queue. The iterator remains valid.
-        queue.splice(queue.end(), queue, cell.queue_iterator);
+                auto val = getImpl(key, shard_lock);
+                if (val)
+                {
+                    ++cache.hits;
+                    return std::make_pair(val, false);
+                }
 
-        return cell.value;
-    }
+                auto & token = insert_tokens[key];
+                if (!token)
+                    token = std::make_shared<InsertToken>(*this);
 
-    void setImpl(const Key & key, const MappedPtr & mapped, std::lock_guard<std::mutex> & cache_lock)
-    {
-        auto res = cells.emplace(std::piecewise_construct,
-            std::forward_as_tuple(key),
-            std::forward_as_tuple());
+                token_holder.acquire(&key, token, shard_lock);
+            }
 
-        Cell & cell = res.first->second;
-        bool inserted = res.second;
+            InsertToken * token = token_holder.token.get();
 
-        if (inserted)
-        {
-            cell.queue_iterator = queue.insert(queue.end(), key);
+            std::lock_guard<std::mutex> token_lock(token->mutex);
+
+            token_holder.cleaned_up = token->cleaned_up;
+
+            if (token->value)
+            {
+                /// Another thread already produced the value while we waited for token->mutex.
+                ++cache.hits;
+                return std::make_pair(token->value, false);
+            }
+
+            ++cache.misses;
+            token->value = load_func();
+
+            std::lock_guard<std::mutex> shard_lock(mutex);
+
+            /// Insert the new value only if the token is still in present in insert_tokens.
+            /// (The token may be absent because of a concurrent reset() call).
+            auto token_it = insert_tokens.find(key);
+            if (token_it != insert_tokens.end() && token_it->second.get() == token)
+                setImpl(key, token->value, shard_lock);
+
+            if (!token->cleaned_up)
+                token_holder.cleanup(token_lock, shard_lock);
+
+            return std::make_pair(token->value, true);
         }
-        else
+
+        void reset()
         {
-            current_size -= cell.size;
-            queue.splice(queue.end(), queue, cell.queue_iterator);
+            std::lock_guard<std::mutex> lock(mutex);
+            probationary_queue.clear();
+            protected_queue.clear();
+            cells.clear();
+            insert_tokens.clear();
+            current_size = 0;
+            current_protected_size = 0;
         }
 
-        cell.value = mapped;
-        cell.size = cell.value ? weight_function(*cell.value) : 0;
-        current_size += cell.size;
-        updateCellTimestamp(cell);
+        MappedPtr getImpl(const Key & key, std::lock_guard<std::mutex> & shard_lock)
+        {
+            auto it = cells.find(key);
+            if (it == cells.end())
+            {
+                return MappedPtr();
+            }
 
-        removeOverflow(cell.timestamp);
-    }
+            Cell & cell = it->second;
+            updateCellTimestamp(cell);
 
-    void updateCellTimestamp(Cell & cell)
-    {
-        if (expiration_delay != Delay::zero())
-            cell.timestamp = Clock::now();
-    }
+            /// Move the key to the end of the corresponding queue. The iterator remains valid.
+            if (cell.is_protected)
+            {
+                protected_queue.splice(protected_queue.end(), protected_queue, cell.queue_iterator);
+            }
+            else
+            {
+                /// Second access: promote to the protected part.
+                protected_queue.splice(protected_queue.end(), probationary_queue, cell.queue_iterator);
+                cell.is_protected = true;
+                current_protected_size += cell.size;
+                shrinkProtected(cell.timestamp);
+            }
 
-    void removeOverflow(const Timestamp & last_timestamp)
-    {
-        size_t queue_size = cells.size();
-        while ((current_size > max_size) && (queue_size > 1))
+            return cell.value;
+        }
+
+        void setImpl(const Key & key, const MappedPtr & mapped, std::lock_guard<std::mutex> & shard_lock)
         {
-            const Key & key = queue.front();
+            auto res = cells.emplace(std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple());
 
-            auto it = cells.find(key);
-            if (it == cells.end())
+            Cell & cell = res.first->second;
+            bool inserted = res.second;
+
+            if (inserted)
             {
-                LOG_ERROR(&Logger::get("LRUCache"), "LRUCache became inconsistent. There must be a bug in it.");
-                abort();
+                cell.queue_iterator = probationary_queue.insert(probationary_queue.end(), key);
+            }
+            else
+            {
+                current_size -= cell.size;
+                if (cell.is_protected)
+                {
+                    current_protected_size -= cell.size;
+                    protected_queue.splice(protected_queue.end(), protected_queue, cell.queue_iterator);
+                }
+                else
+                    probationary_queue.splice(probationary_queue.end(), probationary_queue, cell.queue_iterator);
             }
 
-            const auto & cell = it->second;
-            if (!cell.expired(last_timestamp, expiration_delay))
-                break;
+            cell.value = mapped;
+            cell.size = cell.value ? cache.weight_function(*cell.value) : 0;
+            current_size += cell.size;
+            updateCellTimestamp(cell);
 
-            current_size -= cell.size;
-            current_weight_lost += cell.size;
+            if (cell.is_protected)
+            {
+                current_protected_size += cell.size;
+                shrinkProtected(cell.timestamp);
+            }
 
-            cells.erase(it);
-            queue.pop_front();
-            --queue_size;
+            removeOverflow(cell.timestamp);
         }
 
-        if (current_size > (1ull << 63))
+        void updateCellTimestamp(Cell & cell)
         {
-            LOG_ERROR(&Logger::get("LRUCache"), "LRUCache became inconsistent. There must be a bug in it.");
-            abort();
+            if (expiration_delay != Delay::zero())
+                cell.timestamp = Clock::now();
+        }
+
+        /// Move the least recently used protected entries back to the probationary part
+        ///  until the protected part fits into its share of the cache. Nothing is evicted here.
+        void shrinkProtected(const Timestamp & last_timestamp)
+        {
+            while ((current_protected_size > max_protected_size) && (protected_queue.size() > 1))
+            {
+                const Key & key = protected_queue.front();
+
+                auto it = cells.find(key);
+                if (it == cells.end())
+                {
+                    LOG_ERROR(&Logger::get("LRUCache"), "LRUCache became inconsistent. There must be a bug in it.");
+                    abort();
+                }
+
+                Cell & cell = it->second;
+                probationary_queue.splice(probationary_queue.end(), protected_queue, cell.queue_iterator);
+                cell.is_protected = false;
+                current_protected_size -= cell.size;
+            }
         }
+
+        void removeOverflow(const Timestamp & last_timestamp)
+        {
+            size_t queue_size = cells.size();
+            while ((current_size > max_size) && (queue_size > 1))
+            {
+                /// If everything resident is protected, demote the least recently used protected entry
+                ///  so that it can be evicted.
+                if (probationary_queue.empty())
+                {
+                    const Key & demoted_key = protected_queue.front();
+                    Cell & demoted_cell = cells.find(demoted_key)->second;
+                    probationary_queue.splice(probationary_queue.end(), protected_queue, demoted_cell.queue_iterator);
+                    demoted_cell.is_protected = false;
+                    current_protected_size -= demoted_cell.size;
+                }
+
+                const Key & key = probationary_queue.front();
+
+                auto it = cells.find(key);
+                if (it == cells.end())
+                {
+                    LOG_ERROR(&Logger::get("LRUCache"), "LRUCache became inconsistent. There must be a bug in it.");
+                    abort();
+                }
+
+                const auto & cell = it->second;
+                if (!cell.expired(last_timestamp, expiration_delay))
+                    break;
+
+                current_size -= cell.size;
+                cache.current_weight_lost += cell.size;
+
+                cells.erase(it);
+                probationary_queue.pop_front();
+                --queue_size;
+            }
+
+            if (current_size > (1ull << 63))
+            {
+                LOG_ERROR(&Logger::get("LRUCache"), "LRUCache became inconsistent. There must be a bug in it.");
+                abort();
+            }
+        }
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    std::atomic<size_t> hits {0};
+    std::atomic<size_t> misses {0};
+
+    WeightFunction weight_function;
+
+    Shard & shardForKey(const Key & key) const
+    {
+        return *shards[HashFunction()(key) % shards.size()];
     }
 };
 
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+/** A bounded multi-producer multi-consumer queue that does not take a lock on the fast path
+  *  (the algorithm of Dmitry Vyukov's bounded MPMC queue: a ring of cache-line-padded slots,
+  *  each carrying a sequence number that tells whether it is ready to be written or read).
+  *
+  * A drop-in alternative to ConcurrentBoundedQueue for pipeline handoff, where at high thread
+  *  counts the queue mutex itself becomes a point of contention. Blocking (a mutex + condition
+  *  variable, i.e. a futex on Linux) is used only when the queue is actually empty on pop or
+  *  full on push; while data flows, producers and consumers only do atomic operations.
+  *
+  * T must be default-constructible and movable. size() is approximate (it may transiently
+  *  overcount while operations are in flight) - use it for heuristics only.
+  */
+template <typename T>
+class LockFreeBoundedQueue : private boost::noncopyable
+{
+private:
+    struct alignas(64) Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    const size_t capacity;
+    std::vector<Cell> cells;
+
+    alignas(64) std::atomic<size_t> enqueue_pos {0};
+    alignas(64) std::atomic<size_t> dequeue_pos {0};
+
+    /// Used only while the queue is empty/full. The counters let the fast path skip
+    ///  taking the mutex for notification when nobody is waiting.
+    std::mutex wait_mutex;
+    std::condition_variable not_full_cv;
+    std::condition_variable not_empty_cv;
+    std::atomic<size_t> waiting_producers {0};
+    std::atomic<size_t> waiting_consumers {0};
+
+    template <typename... Args>
+    bool tryEmplaceImpl(Args &&... args)
+    {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell & cell = cells[pos % capacity];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.data = T(std::forward<Args>(args)...);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;   /// Full.
+            else
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPopImpl(T & x)
+    {
+        size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell & cell = cells[pos % capacity];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    x = std::move(cell.data);
+                    cell.data = T();    /// Release the resources held by the slot right away.
+                    cell.sequence.store(pos + capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;   /// Empty.
+            else
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    void notifyNotEmpty()
+    {
+        /// The fence orders the slot publication before the check of the counter; together with
+        ///  the waiter's counter increment (a sequentially consistent RMW) before its re-check of
+        ///  the queue, it rules out the "both sides read stale values" lost-wakeup race.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_consumers.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(wait_mutex);
+            not_empty_cv.notify_one();
+        }
+    }
+
+    void notifyNotFull()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_producers.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(wait_mutex);
+            not_full_cv.notify_one();
+        }
+    }
+
+public:
+    LockFreeBoundedQueue(size_t max_fill)
+        : capacity(std::max<size_t>(1, max_fill)), cells(capacity)
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    template <typename... Args>
+    void emplace(Args &&... args)
+    {
+        if (tryEmplaceImpl(std::forward<Args>(args)...))
+        {
+            notifyNotEmpty();
+            return;
+        }
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(wait_mutex);
+            ++waiting_producers;
+
+            /// Re-check under the lock: a slot could have been freed between the attempt and the registration.
+            if (tryEmplaceImpl(std::forward<Args>(args)...))
+            {
+                --waiting_producers;
+                lock.unlock();
+                notifyNotEmpty();
+                return;
+            }
+
+            not_full_cv.wait(lock);
+            --waiting_producers;
+        }
+    }
+
+    void push(const T & x) { emplace(x); }
+    void push(T && x) { emplace(std::move(x)); }
+
+    void pop(T & x)
+    {
+        if (tryPopImpl(x))
+        {
+            notifyNotFull();
+            return;
+        }
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(wait_mutex);
+            ++waiting_consumers;
+
+            if (tryPopImpl(x))
+            {
+                --waiting_consumers;
+                lock.unlock();
+                notifyNotFull();
+                return;
+            }
+
+            not_empty_cv.wait(lock);
+            --waiting_consumers;
+        }
+    }
+
+    bool tryPush(const T & x, UInt64 milliseconds)
+    {
+        if (tryEmplaceImpl(x))
+        {
+            notifyNotEmpty();
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mutex);
+        ++waiting_producers;
+
+        bool res = tryEmplaceImpl(x);
+        if (!res && not_full_cv.wait_for(lock, std::chrono::milliseconds(milliseconds)) != std::cv_status::timeout)
+            res = tryEmplaceImpl(x);
+
+        --waiting_producers;
+        lock.unlock();
+
+        if (res)
+            notifyNotEmpty();
+        return res;
+    }
+
+    bool tryPop(T & x, UInt64 milliseconds)
+    {
+        if (tryPopImpl(x))
+        {
+            notifyNotFull();
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mutex);
+        ++waiting_consumers;
+
+        bool res = tryPopImpl(x);
+        if (!res && not_empty_cv.wait_for(lock, std::chrono::milliseconds(milliseconds)) != std::cv_status::timeout)
+            res = tryPopImpl(x);
+
+        --waiting_consumers;
+        lock.unlock();
+
+        if (res)
+            notifyNotFull();
+        return res;
+    }
+
+    /// Approximate: may transiently overcount while operations are in flight.
+    size_t size() const
+    {
+        size_t enqueued = enqueue_pos.load(std::memory_order_relaxed);
+        size_t dequeued = dequeue_pos.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+};
+
+}
@@ -19,7 +19,7 @@ namespace DB
 
 MemoryTracker::~MemoryTracker()
 {
-    if (peak)
+    if (peak && log_peak_in_destructor)
         logPeakMemoryUsage();
 
     /** This is needed for next memory tracker to be consistent with sum of all referring memory trackers.
@@ -34,6 +34,10 @@ class MemoryTracker
     /// This description will be used as prefix into log messages (if isn't nullptr)
     const char * description = nullptr;
 
+    /// Whether to log the peak on destruction. Disabled for short-lived trackers
+    ///  (e.g. one per pipeline stage) that would flood the log.
+    bool log_peak_in_destructor = true;
+
 public:
     MemoryTracker() {}
     MemoryTracker(Int64 limit_) : limit(limit_) {}
@@ -95,6 +99,11 @@ public:
         description = description_;
     }
 
+    void setLogPeakInDestructor(bool value)
+    {
+        log_peak_in_destructor = value;
+    }
+
     /// Reset the accumulated data.
     void reset();
 
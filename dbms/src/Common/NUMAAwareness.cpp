@@ -0,0 +1,132 @@
+#include <Common/NUMAAwareness.h>
+
+#if defined(__linux__)
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sched.h>
+
+
+namespace
+{
+
+/// CPUs of each NUMA node. Empty if the system is not NUMA or the topology could not be determined.
+std::vector<cpu_set_t> node_cpus;
+std::once_flag topology_init;
+
+
+/// Parse a sysfs cpulist of the kind "0-15,32-47".
+bool parseCPUList(const std::string & list, cpu_set_t & set)
+{
+    CPU_ZERO(&set);
+
+    size_t pos = 0;
+    while (pos < list.size())
+    {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos)
+            end = list.size();
+
+        std::string range = list.substr(pos, end - pos);
+        size_t dash = range.find('-');
+
+        try
+        {
+            unsigned first = std::stoul(range.substr(0, dash));
+            unsigned last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+
+            if (first > last || last >= CPU_SETSIZE)
+                return false;
+
+            for (unsigned cpu = first; cpu <= last; ++cpu)
+                CPU_SET(cpu, &set);
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        pos = end + 1;
+    }
+
+    return CPU_COUNT(&set) != 0;
+}
+
+
+void initTopology()
+{
+    for (size_t node = 0;; ++node)
+    {
+        std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!in.is_open())
+            break;
+
+        std::string cpulist;
+        std::getline(in, cpulist);
+
+        cpu_set_t set;
+        if (!parseCPUList(cpulist, set))
+        {
+            node_cpus.clear();
+            return;
+        }
+
+        node_cpus.push_back(set);
+    }
+
+    /// A single node - nothing to bind to.
+    if (node_cpus.size() < 2)
+        node_cpus.clear();
+}
+
+
+const std::vector<cpu_set_t> & getTopology()
+{
+    std::call_once(topology_init, initTopology);
+    return node_cpus;
+}
+
+}
+
+
+namespace DB
+{
+
+size_t getNUMANodeCount()
+{
+    const auto & topology = getTopology();
+    return topology.empty() ? 1 : topology.size();
+}
+
+void bindThreadToNUMANode(size_t node)
+{
+    const auto & topology = getTopology();
+    if (topology.empty())
+        return;
+
+    /// Binding is only a performance hint, a failure is not an error.
+    sched_setaffinity(0, sizeof(cpu_set_t), &topology[node % topology.size()]);
+}
+
+}
+
+#else
+
+namespace DB
+{
+
+size_t getNUMANodeCount()
+{
+    return 1;
+}
+
+void bindThreadToNUMANode(size_t)
+{
+}
+
+}
+
+#endif
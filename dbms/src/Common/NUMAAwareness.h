@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+
+namespace DB
+{
+
+/** Helpers for NUMA-aware thread placement.
+  *
+  * On multi-socket servers, a thread that works with memory allocated on the remote
+  *  NUMA node pays substantially higher latency for every cache miss. We do not
+  *  manage per-node memory pools explicitly: it is enough to pin worker threads to
+  *  nodes before they allocate anything, and the kernel's first-touch policy places
+  *  arenas and hash tables on the node of the thread that fills them.
+  *
+  * The topology is read from sysfs; no dependency on libnuma.
+  */
+
+/// Number of NUMA nodes on the system. Returns 1 if the system is not NUMA or the topology is unknown.
+size_t getNUMANodeCount();
+
+/// Restrict the calling thread to the CPUs of the given node (taken modulo the node count).
+/// Does nothing if the system is not NUMA or the topology is unknown. Best effort: errors are ignored.
+void bindThreadToNUMANode(size_t node);
+
+}
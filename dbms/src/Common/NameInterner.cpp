@@ -0,0 +1,41 @@
+#include <string.h>
+
+#include <Common/NameInterner.h>
+
+
+namespace DB
+{
+
+NameInterner & NameInterner::instance()
+{
+    static NameInterner res;
+    return res;
+}
+
+
+StringRef NameInterner::intern(const StringRef & name)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+
+        auto it = names.find(name);
+        if (it != names.end())
+            return it->first;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    /// Could have been interned by a concurrent thread between the locks.
+    auto it = names.find(name);
+    if (it != names.end())
+        return it->first;
+
+    char * data = arena.alloc(name.size);
+    memcpy(data, name.data, name.size);
+
+    StringRef interned{data, name.size};
+    names[interned] = 0;
+    return interned;
+}
+
+}
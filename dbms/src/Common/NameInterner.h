@@ -0,0 +1,38 @@
+#pragma once
+
+#include <shared_mutex>
+
+#include <common/StringRef.h>
+#include <Common/Arena.h>
+#include <Common/HashTable/HashMap.h>
+
+
+namespace DB
+{
+
+/** Process-wide interning of column names.
+  * A name is hash-consed into an arena: equal names always map to the same bytes in memory,
+  *  so interned names can be compared by pointer and used as hash table keys by reference,
+  *  without every holder owning a copy of the string.
+  * Analysis of a query over a wide table passes the same few hundred names through
+  *  NamesAndTypes, Block and ExpressionActions thousands of times; interning turns that
+  *  from an allocation per copy into a lookup in a read-mostly table.
+  *
+  * The memory is never released, so only names that recur should be interned: column names
+  *  and the names of expressions, which repeat across the blocks and queries of a workload.
+  */
+class NameInterner
+{
+public:
+    static NameInterner & instance();
+
+    /// Returns a reference to the interned bytes, valid for the lifetime of the process.
+    StringRef intern(const StringRef & name);
+
+private:
+    std::shared_mutex mutex;
+    Arena arena;
+    HashMap<StringRef, UInt8, StringRefHash> names;
+};
+
+}
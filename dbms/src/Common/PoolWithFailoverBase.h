@@ -3,8 +3,11 @@
 #include <time.h>
 #include <cstdlib>
 #include <climits>
+#include <chrono>
+#include <condition_variable>
 #include <random>
 #include <functional>
+#include <thread>
 #include <common/Types.h>
 #include <ext/scope_guard.h>
 #include <Core/Types.h>
@@ -115,6 +118,23 @@ public:
 
     void reportError(const Entry & entry);
 
+    /// A lightweight probe of a single nested pool, used by the background health-check
+    ///  thread (see enableHealthChecks). Returns true if the replica answers; exceptions
+    ///  thrown from the functor are treated as a failed probe.
+    using CheckPoolFunc = std::function<bool(NestedPool & pool, std::string & fail_message)>;
+
+    /** Enable out-of-band health checks: when a connection failure is recorded, a background
+      *  thread starts probing the pools with nonzero error counts every `period` seconds.
+      * A successful probe resets the error count of the pool, so queries return to a
+      *  recovered replica within one period instead of rediscovering it with their own
+      *  connect timeouts. A failed probe bumps the count, so the periodic decay cannot
+      *  resurrect a replica that is still dead. The thread stops as soon as every pool
+      *  is healthy again.
+      */
+    void enableHealthChecks(CheckPoolFunc check_pool_, time_t health_check_period_);
+
+    ~PoolWithFailoverBase();
+
 protected:
     struct PoolState;
 
@@ -134,6 +154,19 @@ protected:
     /// The time when error counts were last decreased.
     time_t last_error_decrease_time = 0;
 
+    /// Health checks (see enableHealthChecks). The thread exists only while some pool
+    ///  has errors; it is restarted on the next recorded failure.
+    CheckPoolFunc check_pool;
+    time_t health_check_period = 0;
+    std::mutex health_check_mutex;
+    std::condition_variable health_check_cond;
+    std::thread health_check_thread;
+    bool health_check_thread_active = false;
+    bool health_check_shutdown = false;
+
+    void startHealthCheckThread();
+    void healthCheckThreadFunction();
+
     Logger * log;
 };
 
@@ -195,9 +228,17 @@ PoolWithFailoverBase<TNestedPool>::getMany(
     /// At exit update shared error counts with error counts occured during this call.
     SCOPE_EXIT(
     {
-        std::lock_guard<std::mutex> lock(pool_states_mutex);
-        for (const ShuffledPool & pool: shuffled_pools)
-            shared_pool_states[pool.index].error_count += pool.error_count;
+        size_t errors_added = 0;
+        {
+            std::lock_guard<std::mutex> lock(pool_states_mutex);
+            for (const ShuffledPool & pool: shuffled_pools)
+            {
+                shared_pool_states[pool.index].error_count += pool.error_count;
+                errors_added += pool.error_count;
+            }
+        }
+        if (errors_added)
+            startHealthCheckThread();
     });
 
     std::string fail_messages;
@@ -300,8 +341,11 @@ void PoolWithFailoverBase<TNestedPool>::reportError(const Entry & entry)
     {
         if (nested_pools[i]->contains(entry))
         {
-            std::lock_guard<std::mutex> lock(pool_states_mutex);
-            ++shared_pool_states[i].error_count;
+            {
+                std::lock_guard<std::mutex> lock(pool_states_mutex);
+                ++shared_pool_states[i].error_count;
+            }
+            startHealthCheckThread();
             return;
         }
     }
@@ -330,6 +374,110 @@ private:
     std::minstd_rand rng = std::minstd_rand(randomSeed());
 };
 
+template <typename TNestedPool>
+PoolWithFailoverBase<TNestedPool>::~PoolWithFailoverBase()
+{
+    {
+        std::lock_guard<std::mutex> lock(health_check_mutex);
+        health_check_shutdown = true;
+    }
+    health_check_cond.notify_all();
+    if (health_check_thread.joinable())
+        health_check_thread.join();
+}
+
+template <typename TNestedPool>
+void PoolWithFailoverBase<TNestedPool>::enableHealthChecks(CheckPoolFunc check_pool_, time_t health_check_period_)
+{
+    check_pool = std::move(check_pool_);
+    health_check_period = health_check_period_;
+}
+
+template <typename TNestedPool>
+void PoolWithFailoverBase<TNestedPool>::startHealthCheckThread()
+{
+    if (!check_pool)
+        return;
+
+    std::lock_guard<std::mutex> lock(health_check_mutex);
+
+    if (health_check_shutdown || health_check_thread_active)
+        return;
+
+    /// The previous thread, if any, has already decided to exit; finish it off.
+    if (health_check_thread.joinable())
+        health_check_thread.join();
+
+    health_check_thread_active = true;
+    health_check_thread = std::thread([this] { healthCheckThreadFunction(); });
+}
+
+template <typename TNestedPool>
+void PoolWithFailoverBase<TNestedPool>::healthCheckThreadFunction()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(health_check_mutex);
+            if (health_check_cond.wait_for(lock, std::chrono::seconds(health_check_period),
+                    [this] { return health_check_shutdown; }))
+            {
+                health_check_thread_active = false;
+                return;
+            }
+        }
+
+        size_t pools_with_errors = 0;
+
+        for (size_t i = 0; i < nested_pools.size(); ++i)
+        {
+            UInt64 error_count;
+            {
+                std::lock_guard<std::mutex> lock(pool_states_mutex);
+                error_count = shared_pool_states[i].error_count;
+            }
+
+            /// Healthy pools are not probed: queries check them well enough themselves.
+            if (!error_count)
+                continue;
+
+            std::string fail_message;
+            bool alive = false;
+
+            try
+            {
+                alive = check_pool(*nested_pools[i], fail_message);
+            }
+            catch (...)
+            {
+                fail_message = DB::getCurrentExceptionMessage(false);
+            }
+
+            std::lock_guard<std::mutex> lock(pool_states_mutex);
+
+            if (alive)
+            {
+                LOG_INFO(log, "Health check: replica №" << i << " is alive again");
+                shared_pool_states[i].error_count = 0;
+            }
+            else
+            {
+                LOG_TRACE(log, "Health check: replica №" << i << " is still unreachable, reason: " << fail_message);
+                /// Make sure the periodic decay does not resurrect the replica while it stays dead.
+                ++shared_pool_states[i].error_count;
+                ++pools_with_errors;
+            }
+        }
+
+        if (!pools_with_errors)
+        {
+            std::lock_guard<std::mutex> lock(health_check_mutex);
+            health_check_thread_active = false;
+            return;
+        }
+    }
+}
+
 template <typename TNestedPool>
 typename PoolWithFailoverBase<TNestedPool>::PoolStates
 PoolWithFailoverBase<TNestedPool>::updatePoolStates()
@@ -25,15 +25,28 @@
     M(UncompressedCacheHits) \
     M(UncompressedCacheMisses) \
     M(UncompressedCacheWeightLost) \
+    M(QueryResultCacheHits) \
+    M(QueryResultCacheMisses) \
+    M(SetCacheHits) \
+    M(SetCacheMisses) \
     M(IOBufferAllocs) \
     M(IOBufferAllocBytes) \
     M(ArenaAllocChunks) \
     M(ArenaAllocBytes) \
+    M(ArenaLazyReleaseChunks) \
+    M(ArenaLazyReleaseBytes) \
+    M(ArenaChunkPoolHits) \
+    M(ArenaChunkPoolMisses) \
+    M(AllocatorHugePagesAdvised) \
+    M(AllocatorHugePagesAdvisedBytes) \
     M(FunctionExecute) \
+    M(CompiledFunctionChainExecute) \
+    M(HedgedRequests) \
     M(MarkCacheHits) \
     M(MarkCacheMisses) \
     M(CreatedReadBufferOrdinary) \
     M(CreatedReadBufferAIO) \
+    M(CreatedReadBufferMMap) \
     M(CreatedWriteBufferOrdinary) \
     M(CreatedWriteBufferAIO) \
     \
@@ -51,6 +64,7 @@
     M(DelayedInserts) \
     M(RejectedInserts) \
     M(DelayedInsertsMilliseconds) \
+    M(QueryAdmissionWaitMilliseconds) \
     \
     M(ZooKeeperInit) \
     M(ZooKeeperTransactions) \
@@ -137,6 +151,53 @@ namespace ProfileEvents
 
     std::atomic<Count> counters[END] {};    /// Global variable, initialized by zeros.
 
+    thread_local Count thread_counters[END] {};
+
+    namespace
+    {
+        /// Folds the deltas of this thread, so the events of a thread that never reaches
+        ///  a flush point again are not lost.
+        struct FlushAtThreadExit
+        {
+            ~FlushAtThreadExit();
+        };
+        thread_local FlushAtThreadExit flush_at_thread_exit;
+
+        void flushThreadCounters(Counters * query_counters)
+        {
+            for (Event i = 0; i < END; ++i)
+            {
+                Count value = thread_counters[i];
+                if (!value)
+                    continue;
+
+                thread_counters[i] = 0;
+                counters[i].fetch_add(value, std::memory_order_relaxed);
+                if (query_counters)
+                    query_counters->add(i, value);
+            }
+        }
+
+        FlushAtThreadExit::~FlushAtThreadExit()
+        {
+            flushThreadCounters(nullptr);
+        }
+    }
+
+    Counters::Counters()
+        : data(new std::atomic<Count>[END])
+    {
+        for (Event i = 0; i < END; ++i)
+            data[i].store(0, std::memory_order_relaxed);
+    }
+
+    void updateCounters(Counters * query_counters)
+    {
+        (void) &flush_at_thread_exit;   /// Make sure the flush at thread exit is registered.
+
+        flushThreadCounters(query_counters);
+    }
+
     const char * getDescription(Event event)
     {
         static const char * descriptions[] =
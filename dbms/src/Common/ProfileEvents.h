@@ -2,6 +2,7 @@
 
 #include <stddef.h>
 #include <atomic>
+#include <memory>
 
 
 /** Implements global counters for various events happening in the application
@@ -18,15 +19,43 @@ namespace ProfileEvents
     /// Get text description of event by identifier. Returns statically allocated string.
     const char * getDescription(Event event);
 
-    /// Counters - how many times each event happened.
+    /// Counters - how many times each event happened, server-wide.
+    /// Filled from the per-thread blocks at the flush points (see thread_counters).
     extern std::atomic<Count> counters[];
 
-    /// Increment a counter for event. Thread-safe.
+    /** The events are counted in a per-thread block first: an increment is a plain add to a
+      *  thread-local array, so the hottest counters do not bounce one cache line between all
+      *  the threads of the server.
+      * The accumulated deltas are folded into the global counters - and into the per-query
+      *  block, when there is one - at coarse boundaries: after a batch of rows in
+      *  IProfilingBlockInputStream::read, after a background pool task, at thread exit
+      *  (see updateCounters).
+      */
+    extern thread_local Count thread_counters[];
+
+    /// A separate block of counters: for everything done on behalf of one query.
+    class Counters
+    {
+    public:
+        Counters();
+
+        Count get(Event event) const { return data[event].load(std::memory_order_relaxed); }
+        void add(Event event, Count amount) { data[event].fetch_add(amount, std::memory_order_relaxed); }
+
+    private:
+        std::unique_ptr<std::atomic<Count>[]> data;
+    };
+
+    /// Increment a counter for event. Thread-safe; becomes visible in `counters` after a flush.
     inline void increment(Event event, Count amount = 1)
     {
-        counters[event].fetch_add(amount, std::memory_order_relaxed);
+        thread_counters[event] += amount;
     }
 
+    /// Fold the deltas accumulated by this thread into the global counters
+    ///  and, if `query_counters` is set, into the per-query block as well.
+    void updateCounters(Counters * query_counters = nullptr);
+
     /// Get index just after last event identifier.
     Event end();
 }
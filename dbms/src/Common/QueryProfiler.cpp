@@ -0,0 +1,143 @@
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include <signal.h>
+#include <unistd.h>
+#include <execinfo.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include <Poco/Ext/ThreadNumber.h>
+
+#include <Common/QueryProfiler.h>
+#include <Common/Exception.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_CREATE_TIMER;
+    extern const int CANNOT_SET_SIGNAL_HANDLER;
+}
+
+namespace
+{
+
+/// Write end of the pipe of TraceCollector. Set once before any profiler is created.
+std::atomic<int> trace_pipe_write_fd {-1};
+
+/// The query_id of the current thread, in a form that is safe to read from a signal handler.
+thread_local char thread_query_id[QueryProfilerTraceRecord::max_query_id_size];
+thread_local UInt32 thread_query_id_size = 0;
+
+/// To recreate the profiler in child threads of the same query.
+thread_local UInt64 thread_profiler_period_ns = 0;
+
+void profilerSignalHandler(int, siginfo_t *, void *)
+{
+    int fd = trace_pipe_write_fd.load(std::memory_order_relaxed);
+    if (fd < 0)
+        return;
+
+    int saved_errno = errno;    /// The signal interrupts arbitrary code - keep errno intact.
+
+    QueryProfilerTraceRecord record;
+    record.query_id_size = thread_query_id_size;
+    record.thread_number = Poco::ThreadNumber::get();
+    record.frames_size = backtrace(record.frames, QueryProfilerTraceRecord::max_frames);
+    memcpy(record.query_id, thread_query_id, thread_query_id_size);
+
+    /// A single write of less than PIPE_BUF bytes is atomic. If the pipe is full, the sample is lost.
+    ssize_t res = ::write(fd, &record, sizeof(record));
+    (void)res;
+
+    errno = saved_errno;
+}
+
+}
+
+
+QueryProfiler::QueryProfiler(const String & query_id, UInt64 period_ns)
+{
+    thread_query_id_size = UInt32(std::min(query_id.size(), QueryProfilerTraceRecord::max_query_id_size));
+    memcpy(thread_query_id, query_id.data(), thread_query_id_size);
+    thread_profiler_period_ns = period_ns;
+
+    if (!period_ns)
+        return;
+
+#if defined(__linux__)
+    /// The first call to backtrace loads the unwinding library - do it outside of the signal handler.
+    void * frames[QueryProfilerTraceRecord::max_frames];
+    backtrace(frames, QueryProfilerTraceRecord::max_frames);
+
+    struct sigaction sa {};
+    sa.sa_sigaction = profilerSignalHandler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+
+    if (sigemptyset(&sa.sa_mask) || sigaddset(&sa.sa_mask, SIGPROF) || sigaction(SIGPROF, &sa, nullptr))
+        throwFromErrno("Failed to set up signal handler for query profiler", ErrorCodes::CANNOT_SET_SIGNAL_HANDLER);
+
+    /// A timer that sends SIGPROF to this particular thread.
+    struct sigevent sev {};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = SIGPROF;
+    sev._sigev_un._tid = syscall(SYS_gettid);
+
+    if (timer_create(CLOCK_MONOTONIC, &sev, &timer_id))
+        throwFromErrno("Failed to create thread timer for query profiler", ErrorCodes::CANNOT_CREATE_TIMER);
+
+    timer_created = true;
+
+    struct itimerspec timer_spec {};
+    timer_spec.it_interval.tv_sec = period_ns / 1000000000;
+    timer_spec.it_interval.tv_nsec = period_ns % 1000000000;
+    timer_spec.it_value = timer_spec.it_interval;
+
+    if (timer_settime(timer_id, 0, &timer_spec, nullptr))
+        throwFromErrno("Failed to set thread timer period for query profiler", ErrorCodes::CANNOT_CREATE_TIMER);
+#endif
+}
+
+
+QueryProfiler::~QueryProfiler()
+{
+#if defined(__linux__)
+    /// After the timer is deleted, no more signals are delivered to the thread.
+    if (timer_created)
+        timer_delete(timer_id);
+#endif
+
+    thread_profiler_period_ns = 0;
+}
+
+
+QueryProfiler::Params QueryProfiler::getParamsOfCurrentThread()
+{
+    Params params;
+    params.query_id.assign(thread_query_id, thread_query_id_size);
+    params.period_ns = thread_profiler_period_ns;
+    return params;
+}
+
+
+std::unique_ptr<QueryProfiler> QueryProfiler::createForCurrentThread(const Params & params)
+{
+    if (!params.period_ns)
+        return nullptr;
+
+    return std::make_unique<QueryProfiler>(params.query_id, params.period_ns);
+}
+
+
+void QueryProfiler::setTracePipeWriteFd(int fd)
+{
+    trace_pipe_write_fd.store(fd, std::memory_order_relaxed);
+}
+
+}
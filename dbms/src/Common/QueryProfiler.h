@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <time.h>
+
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+/** A record that the sampling profiler's signal handler writes into the trace pipe for every sample.
+  * It is written with a single write() and is smaller than PIPE_BUF, so records never interleave.
+  */
+struct QueryProfilerTraceRecord
+{
+    static constexpr size_t max_query_id_size = 64;
+    static constexpr size_t max_frames = 32;    /// Same as STACK_TRACE_MAX_DEPTH.
+
+    UInt32 query_id_size;
+    UInt32 thread_number;
+    UInt32 frames_size;
+    char query_id[max_query_id_size];
+    void * frames[max_frames];
+};
+
+
+/** Samples stack traces of the current thread with the specified period of wall clock time.
+  * Each sample is written from a per-thread timer signal handler into the pipe of TraceCollector,
+  *  which symbolizes the frames and puts them into the system.trace_log table with the query_id.
+  *
+  * Create the object in the thread that should be profiled. The timers work only on Linux;
+  *  on other systems the object does nothing.
+  */
+class QueryProfiler
+{
+public:
+    /// Parameters with which the profiler can be recreated in another thread of the same query.
+    struct Params
+    {
+        String query_id;
+        UInt64 period_ns = 0;    /// 0 means that the profiler is disabled.
+    };
+
+    QueryProfiler(const String & query_id, UInt64 period_ns);
+    ~QueryProfiler();
+
+    QueryProfiler(const QueryProfiler &) = delete;
+    QueryProfiler & operator=(const QueryProfiler &) = delete;
+
+    /// Parameters of the profiler of the current thread, to spawn profilers in child threads of the same query.
+    static Params getParamsOfCurrentThread();
+
+    /// Returns nullptr if the profiler is disabled in params.
+    static std::unique_ptr<QueryProfiler> createForCurrentThread(const Params & params);
+
+    /// Called by TraceCollector. While no fd is set, samples are discarded.
+    static void setTracePipeWriteFd(int fd);
+
+private:
+#if defined(__linux__)
+    timer_t timer_id {};
+    bool timer_created = false;
+#endif
+};
+
+}
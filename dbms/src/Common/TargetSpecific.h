@@ -0,0 +1,98 @@
+#pragma once
+
+/** Facility to compile hot kernels several times for different instruction sets
+  *  and to select the best available implementation at run time.
+  *
+  * The release binary is built for the oldest supported machines (SSE 4.2), so newer
+  *  instruction sets (AVX2) would stay unused even on machines that have them.
+  *
+  * DECLARE_MULTITARGET_CODE(...) expands the enclosed code twice:
+  *  - in the namespace TargetSpecific::Default, compiled with the flags of the build;
+  *  - in the namespace TargetSpecific::AVX2, compiled with AVX2 enabled.
+  * Inside the AVX2 copy both the auto-vectorizer and the _mm256_* intrinsics may be used.
+  *
+  * Usage:
+  *
+  *     DECLARE_MULTITARGET_CODE(
+  *     template <typename T>
+  *     void compute(const T * data, size_t size, T * out)
+  *     {
+  *         ...tight loop...
+  *     }
+  *     )
+  *
+  *     if (isArchSupported(TargetArch::AVX2))
+  *         TargetSpecific::AVX2::compute(data, size, out);
+  *     else
+  *         TargetSpecific::Default::compute(data, size, out);
+  *
+  * The check is a cached cpuid lookup and may be done per block of data, not per row.
+  * On non-x86 builds both namespaces contain the ordinary code and AVX2 is reported
+  *  as unsupported.
+  */
+
+#if defined(__x86_64__) && defined(__GNUC__)
+    #define USE_MULTITARGET_CODE 1
+#else
+    #define USE_MULTITARGET_CODE 0
+#endif
+
+#if USE_MULTITARGET_CODE
+
+#if defined(__clang__)
+
+#define BEGIN_AVX2_SPECIFIC_CODE \
+    _Pragma("clang attribute push(__attribute__((target(\"sse,sse2,sse3,ssse3,sse4,popcnt,avx,avx2\"))), apply_to=function)")
+#define END_TARGET_SPECIFIC_CODE \
+    _Pragma("clang attribute pop")
+
+#else
+
+#define BEGIN_AVX2_SPECIFIC_CODE \
+    _Pragma("GCC push_options") \
+    _Pragma("GCC target(\"sse,sse2,sse3,ssse3,sse4,popcnt,avx,avx2,tune=haswell\")")
+#define END_TARGET_SPECIFIC_CODE \
+    _Pragma("GCC pop_options")
+
+#endif
+
+#define DECLARE_MULTITARGET_CODE(...) \
+    namespace TargetSpecific::Default { __VA_ARGS__ } \
+    BEGIN_AVX2_SPECIFIC_CODE \
+    namespace TargetSpecific::AVX2 { __VA_ARGS__ } \
+    END_TARGET_SPECIFIC_CODE
+
+#else
+
+/// Both namespaces exist, so the dispatching code compiles unchanged, but only the default
+///  implementation is ever chosen.
+#define DECLARE_MULTITARGET_CODE(...) \
+    namespace TargetSpecific::Default { __VA_ARGS__ } \
+    namespace TargetSpecific::AVX2 { __VA_ARGS__ }
+
+#endif
+
+
+namespace DB
+{
+
+enum class TargetArch
+{
+    Default,    /// Whatever the binary is compiled with.
+    AVX2,
+};
+
+inline bool isArchSupported(TargetArch arch)
+{
+    if (arch == TargetArch::Default)
+        return true;
+
+#if USE_MULTITARGET_CODE
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return arch == TargetArch::AVX2 && has_avx2;
+#else
+    return false;
+#endif
+}
+
+}
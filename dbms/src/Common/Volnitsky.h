@@ -3,11 +3,14 @@
 #include <Common/StringSearcher.h>
 #include <Common/StringUtils.h>
 #include <Core/Types.h>
+#include <common/StringRef.h>
 #include <Poco/UTF8Encoding.h>
 #include <Poco/Unicode.h>
 #include <ext/range.h>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
+#include <type_traits>
 
 
 /** Search for a substring in a string by Volnitsky's algorithm
@@ -455,4 +458,263 @@ using VolnitskyCaseInsensitive = VolnitskyImpl<false, true>;    /// ignores non-
 using VolnitskyCaseInsensitiveUTF8 = VolnitskyImpl<false, false>;
 
 
+/** Search for several substrings in a string at once.
+  *
+  * The same idea as above, but a single shared hash table is filled with the bigrams of all needles:
+  *  a cell stores the index of the needle along with the offset of the bigram inside it.
+  * All bigrams of every needle are inserted (not only those that correspond to its tail),
+  *  and the scan step is determined by the shortest needle,
+  *  so the haystack is traversed once regardless of the number of needles.
+  *
+  * The case-insensitive variant considers only ASCII case folding, same as ASCIICaseInsensitiveStringSearcher.
+  */
+template <bool CaseSensitive>
+class MultiVolnitskyImpl
+{
+private:
+    using Ngram = UInt16;    /// n-gram (2 bytes).
+
+    struct Cell
+    {
+        UInt16 id;          /// Index of the needle.
+        UInt8 offset_1;     /// Offset of the n-gram in the needle plus one. Zero means an empty cell.
+    };
+
+    /// Also used for bytewise verification of the candidates found by the main algorithm.
+    using NeedleSearcher = std::conditional_t<CaseSensitive, ASCIICaseSensitiveStringSearcher, ASCIICaseInsensitiveStringSearcher>;
+
+    const std::vector<StringRef> needles;
+    std::vector<NeedleSearcher> searchers;
+
+    /// For how long we move, if the n-gram from haystack is not found in the hash table.
+    size_t step = 1;
+
+    static const size_t hash_size = 64 * 1024;    /// Same as in VolnitskyBase.
+    Cell hash[hash_size];
+
+    const bool fallback; /// Do we need to search each needle separately.
+
+public:
+    MultiVolnitskyImpl(const std::vector<StringRef> & needles_)
+        : needles(needles_), fallback(isFallbackNeeded(needles))
+    {
+        searchers.reserve(needles.size());
+        for (const auto & needle : needles)
+            searchers.emplace_back(needle.data, needle.size);
+
+        if (fallback)
+            return;
+
+        memset(hash, 0, sizeof(hash));
+
+        size_t min_needle_size = needles.front().size;
+
+        for (size_t id = 0; id < needles.size(); ++id)
+        {
+            const auto * needle_data = reinterpret_cast<const UInt8 *>(needles[id].data);
+
+            for (size_t i = 0; i + sizeof(Ngram) <= needles[id].size; ++i)
+                putNGram(needle_data + i, id, i + 1);
+
+            min_needle_size = std::min(min_needle_size, needles[id].size);
+        }
+
+        step = min_needle_size - sizeof(Ngram) + 1;
+    }
+
+    /// Is at least one of the needles a substring of the haystack?
+    bool searchAny(const UInt8 * const haystack, const size_t haystack_size) const
+    {
+        const auto * haystack_end = haystack + haystack_size;
+
+        if (fallback)
+        {
+            for (size_t id = 0; id < needles.size(); ++id)
+                if (0 == needles[id].size || searchers[id].search(haystack, haystack_end) != haystack_end)
+                    return true;
+
+            return false;
+        }
+
+        for (const auto * pos = haystack; pos + sizeof(Ngram) <= haystack_end; pos += step)
+        {
+            for (size_t cell_num = toNGram(pos) % hash_size; hash[cell_num].offset_1; cell_num = (cell_num + 1) % hash_size)
+            {
+                const auto & cell = hash[cell_num];
+                const auto * res = pos - (cell.offset_1 - 1);
+
+                if (res >= haystack && res + needles[cell.id].size <= haystack_end && searchers[cell.id].compare(res))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** Index of the needle with the leftmost occurrence in the haystack, starting from 1
+      *  (the one with the smallest index wins ties); 0 if there is no occurrence.
+      */
+    size_t searchFirstIndex(const UInt8 * const haystack, const size_t haystack_size) const
+    {
+        const auto * haystack_end = haystack + haystack_size;
+
+        size_t best_id = 0;
+        const UInt8 * best_pos = nullptr;
+
+        if (fallback)
+        {
+            for (size_t id = 0; id < needles.size(); ++id)
+            {
+                const UInt8 * res;
+
+                if (0 == needles[id].size)
+                    res = haystack;    /// The empty string is always at the very beginning of the haystack.
+                else
+                {
+                    res = searchers[id].search(haystack, haystack_end);
+                    if (res == haystack_end)
+                        continue;
+                }
+
+                if (0 == best_id || res < best_pos)
+                {
+                    best_id = id + 1;
+                    best_pos = res;
+                }
+            }
+
+            return best_id;
+        }
+
+        for (const auto * pos = haystack; pos + sizeof(Ngram) <= haystack_end; pos += step)
+        {
+            for (size_t cell_num = toNGram(pos) % hash_size; hash[cell_num].offset_1; cell_num = (cell_num + 1) % hash_size)
+            {
+                const auto & cell = hash[cell_num];
+                const auto * res = pos - (cell.offset_1 - 1);
+
+                if (res >= haystack && res + needles[cell.id].size <= haystack_end
+                    && (0 == best_id || res < best_pos || (res == best_pos && cell.id + 1 < best_id))
+                    && searchers[cell.id].compare(res))
+                {
+                    best_id = cell.id + 1;
+                    best_pos = res;
+                }
+            }
+
+            /// An occurrence starting earlier would have been found at this or an earlier step of the scan.
+            if (best_id)
+                return best_id;
+        }
+
+        return 0;
+    }
+
+    bool searchAny(const char * haystack, size_t haystack_size) const
+    {
+        return searchAny(reinterpret_cast<const UInt8 *>(haystack), haystack_size);
+    }
+
+    size_t searchFirstIndex(const char * haystack, size_t haystack_size) const
+    {
+        return searchFirstIndex(reinterpret_cast<const UInt8 *>(haystack), haystack_size);
+    }
+
+private:
+    static bool isFallbackNeeded(const std::vector<StringRef> & needles)
+    {
+        if (needles.empty() || needles.size() >= std::numeric_limits<UInt16>::max())
+            return true;
+
+        size_t ngrams = 0;
+        for (const auto & needle : needles)
+        {
+            if (needle.size < 2 * sizeof(Ngram) || needle.size >= std::numeric_limits<UInt8>::max())
+                return true;
+
+            ngrams += (needle.size - sizeof(Ngram) + 1) * (CaseSensitive ? 1 : 4);
+        }
+
+        /// Do not let the open-addressing hash table become too dense (or even overflow).
+        return ngrams > hash_size / 2;
+    }
+
+    static const Ngram & toNGram(const UInt8 * const pos)
+    {
+        return *reinterpret_cast<const Ngram *>(pos);
+    }
+
+    void putNGramBase(const Ngram ngram, const size_t id, const size_t offset_1)
+    {
+        /// Put the cell for the n-gram in the corresponding cell or the nearest free cell.
+        size_t cell_num = ngram % hash_size;
+
+        while (hash[cell_num].offset_1)
+            cell_num = (cell_num + 1) % hash_size; /// Search for the next free cell.
+
+        hash[cell_num].id = id;
+        hash[cell_num].offset_1 = offset_1;
+    }
+
+    void putNGram(const UInt8 * const pos, const size_t id, const size_t offset_1)
+    {
+        struct Chars
+        {
+            UInt8 c0;
+            UInt8 c1;
+        };
+
+        union
+        {
+            Ngram n;
+            Chars chars;
+        };
+
+        n = toNGram(pos);
+
+        if (CaseSensitive)
+        {
+            putNGramBase(n, id, offset_1);
+            return;
+        }
+
+        /// Same combinations of character cases as in putNGramASCIICaseInsensitive.
+        const auto c0_al = isAlphaASCII(chars.c0);
+        const auto c1_al = isAlphaASCII(chars.c1);
+
+        if (c0_al && c1_al)
+        {
+            /// 4 combinations: AB, aB, Ab, ab
+            putNGramBase(n, id, offset_1);
+            chars.c0 = alternateCaseIfAlphaASCII(chars.c0);
+            putNGramBase(n, id, offset_1);
+            chars.c1 = alternateCaseIfAlphaASCII(chars.c1);
+            putNGramBase(n, id, offset_1);
+            chars.c0 = alternateCaseIfAlphaASCII(chars.c0);
+            putNGramBase(n, id, offset_1);
+        }
+        else if (c0_al)
+        {
+            /// 2 combinations: A1, a1
+            putNGramBase(n, id, offset_1);
+            chars.c0 = alternateCaseIfAlphaASCII(chars.c0);
+            putNGramBase(n, id, offset_1);
+        }
+        else if (c1_al)
+        {
+            /// 2 combinations: 0B, 0b
+            putNGramBase(n, id, offset_1);
+            chars.c1 = alternateCaseIfAlphaASCII(chars.c1);
+            putNGramBase(n, id, offset_1);
+        }
+        else
+            /// 1 combination: 01
+            putNGramBase(n, id, offset_1);
+    }
+};
+
+using MultiVolnitsky = MultiVolnitskyImpl<true>;
+using MultiVolnitskyCaseInsensitive = MultiVolnitskyImpl<false>;
+
+
 }
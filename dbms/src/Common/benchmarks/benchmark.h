@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <iostream>
+
+#include <Common/Stopwatch.h>
+
+/** Helpers for the microbenchmarks in this directory.
+  *
+  * Every measurement is printed to stdout as one TSV line:
+  *
+  *     <benchmark name> <TAB> <items> <TAB> <seconds> <TAB> <items per second>
+  *
+  * so that results can be collected with standard tools and compared across releases.
+  * Checksums and progress messages go to stderr.
+  */
+
+namespace benchmark
+{
+
+inline void report(const std::string & name, size_t items, double seconds)
+{
+    std::cout << name << "\t" << items << "\t" << seconds << "\t"
+        << static_cast<size_t>(items / seconds) << "\n";
+}
+
+/// Measure `func`, which processes `items` items per call, over `runs` calls. Report the best run.
+template <typename F>
+void run(const std::string & name, size_t items, size_t runs, F && func)
+{
+    double best_seconds = -1;
+
+    for (size_t i = 0; i < runs; ++i)
+    {
+        Stopwatch watch;
+        func();
+        double seconds = watch.elapsedSeconds();
+
+        if (best_seconds < 0 || seconds < best_seconds)
+            best_seconds = seconds;
+    }
+
+    report(name, items, best_seconds);
+}
+
+}
@@ -0,0 +1,81 @@
+#include <random>
+#include <pcg_random.hpp>
+
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnString.h>
+#include <IO/WriteHelpers.h>
+
+#include "benchmark.h"
+
+
+/** Throughput of IColumn::filter (the kernel behind WHERE and PREWHERE) on numeric
+  * and string columns, at low, medium and high selectivity.
+  * The dataset is generated with a fixed seed, so results are comparable across releases.
+  */
+
+namespace
+{
+
+constexpr size_t NUM_ROWS = 10000000;
+constexpr size_t NUM_RUNS = 5;
+
+DB::IColumn::Filter makeFilter(pcg64 & generator, double selectivity)
+{
+    DB::IColumn::Filter filt(NUM_ROWS);
+    std::bernoulli_distribution distribution(selectivity);
+
+    for (auto & value : filt)
+        value = distribution(generator);
+
+    return filt;
+}
+
+void benchmarkFilter(const std::string & name, const DB::IColumn & column, const DB::IColumn::Filter & filt)
+{
+    size_t filtered_rows = 0;
+
+    benchmark::run(name, column.size(), NUM_RUNS, [&]
+    {
+        filtered_rows += column.filter(filt, -1)->size();
+    });
+
+    std::cerr << name << ": check = " << filtered_rows << "\n";
+}
+
+}
+
+
+int main(int, char **)
+{
+    pcg64 generator(0);
+
+    auto column_uint64 = std::make_shared<DB::ColumnUInt64>();
+    {
+        auto & data = column_uint64->getData();
+        data.resize(NUM_ROWS);
+        for (size_t i = 0; i < NUM_ROWS; ++i)
+            data[i] = i;
+    }
+
+    auto column_string = std::make_shared<DB::ColumnString>();
+    {
+        std::uniform_int_distribution<size_t> length_distribution(0, 50);
+        std::string value;
+        for (size_t i = 0; i < NUM_ROWS; ++i)
+        {
+            value.assign(length_distribution(generator), 'x');
+            column_string->insertData(value.data(), value.size());
+        }
+    }
+
+    for (double selectivity : {0.1, 0.5, 0.9})
+    {
+        DB::IColumn::Filter filt = makeFilter(generator, selectivity);
+        std::string suffix = "_" + DB::toString(static_cast<size_t>(selectivity * 100)) + "pct";
+
+        benchmarkFilter("filter_uint64" + suffix, *column_uint64, filt);
+        benchmarkFilter("filter_string" + suffix, *column_string, filt);
+    }
+
+    return 0;
+}
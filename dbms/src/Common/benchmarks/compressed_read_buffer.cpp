@@ -0,0 +1,75 @@
+#include <vector>
+#include <random>
+#include <pcg_random.hpp>
+
+#include <IO/ReadBufferFromMemory.h>
+#include <IO/WriteBufferFromString.h>
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedWriteBuffer.h>
+#include <IO/WriteHelpers.h>
+
+#include "benchmark.h"
+
+
+/** Decompression throughput of CompressedReadBuffer for LZ4 and ZSTD.
+  * The data is a monotonic sequence of UInt64 values with random steps - compressible,
+  *  like typical column data, but not degenerate. Items in the report are uncompressed bytes.
+  * The dataset is generated with a fixed seed, so results are comparable across releases.
+  */
+
+namespace
+{
+
+constexpr size_t UNCOMPRESSED_BYTES = 64 * 1024 * 1024;
+constexpr size_t NUM_RUNS = 5;
+
+std::string compress(const std::vector<UInt64> & data, DB::CompressionMethod method)
+{
+    std::string compressed;
+    DB::WriteBufferFromString out(compressed);
+    DB::CompressedWriteBuffer compressed_out(out, method);
+
+    compressed_out.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(UInt64));
+    compressed_out.next();
+
+    return compressed;
+}
+
+void benchmarkDecompression(const std::string & name, const std::string & compressed)
+{
+    std::vector<char> decompressed(UNCOMPRESSED_BYTES);
+    size_t bytes_read = 0;
+
+    benchmark::run(name, UNCOMPRESSED_BYTES, NUM_RUNS, [&]
+    {
+        DB::ReadBufferFromMemory in(compressed.data(), compressed.size());
+        DB::CompressedReadBuffer decompressing_in(in);
+
+        bytes_read += decompressing_in.readBig(decompressed.data(), decompressed.size());
+    });
+
+    std::cerr << name << ": compressed to " << compressed.size() << " bytes, check = " << bytes_read << "\n";
+}
+
+}
+
+
+int main(int, char **)
+{
+    pcg64 generator(0);
+    std::uniform_int_distribution<UInt64> step(0, 1000);
+
+    std::vector<UInt64> data(UNCOMPRESSED_BYTES / sizeof(UInt64));
+
+    UInt64 value = 0;
+    for (auto & element : data)
+    {
+        value += step(generator);
+        element = value;
+    }
+
+    benchmarkDecompression("decompress_lz4", compress(data, DB::CompressionMethod::LZ4));
+    benchmarkDecompression("decompress_zstd", compress(data, DB::CompressionMethod::ZSTD));
+
+    return 0;
+}
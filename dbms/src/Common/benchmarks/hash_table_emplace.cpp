@@ -0,0 +1,71 @@
+#include <vector>
+#include <random>
+#include <pcg_random.hpp>
+
+#include <Common/HashTable/HashMap.h>
+
+#include "benchmark.h"
+
+
+/** Emplace throughput of HashMap under the key patterns typical for aggregation:
+  * sequential keys, unique random keys, random keys from a small set (many duplicates).
+  * The dataset is generated with a fixed seed, so results are comparable across releases.
+  */
+
+namespace
+{
+
+constexpr size_t NUM_KEYS = 10000000;
+constexpr size_t NUM_RUNS = 5;
+
+using Map = HashMap<UInt64, UInt64>;
+
+void benchmarkEmplace(const std::string & name, const std::vector<UInt64> & keys)
+{
+    size_t found = 0;
+
+    benchmark::run(name, keys.size(), NUM_RUNS, [&]
+    {
+        Map map;
+        Map::iterator it;
+        bool inserted;
+
+        for (UInt64 key : keys)
+        {
+            map.emplace(key, it, inserted);
+            if (inserted)
+                it->second = 0;
+            ++it->second;
+        }
+
+        found += map.size();
+    });
+
+    std::cerr << name << ": check = " << found << "\n";
+}
+
+}
+
+
+int main(int, char **)
+{
+    pcg64 generator(0);
+
+    std::vector<UInt64> keys(NUM_KEYS);
+
+    for (size_t i = 0; i < NUM_KEYS; ++i)
+        keys[i] = i;
+    benchmarkEmplace("hash_map_emplace_sequential", keys);
+
+    std::uniform_int_distribution<UInt64> full_range;
+    for (auto & key : keys)
+        key = full_range(generator);
+    benchmarkEmplace("hash_map_emplace_random_unique", keys);
+
+    std::uniform_int_distribution<UInt64> small_range(0, 65535);
+    for (auto & key : keys)
+        key = small_range(generator);
+    benchmarkEmplace("hash_map_emplace_random_duplicates", keys);
+
+    return 0;
+}
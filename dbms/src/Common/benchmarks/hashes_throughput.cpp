@@ -0,0 +1,72 @@
+#include <vector>
+#include <string>
+#include <random>
+#include <pcg_random.hpp>
+
+#include <city.h>
+#include <Common/SipHash.h>
+
+#include "benchmark.h"
+
+
+/** SipHash and CityHash64 throughput on short, medium and long strings.
+  * Items in the report are bytes, not strings.
+  * The dataset is generated with a fixed seed, so results are comparable across releases.
+  */
+
+namespace
+{
+
+constexpr size_t TOTAL_BYTES = 128 * 1024 * 1024;
+constexpr size_t NUM_RUNS = 5;
+
+std::vector<std::string> makeStrings(pcg64 & generator, size_t string_size)
+{
+    std::vector<std::string> strings(TOTAL_BYTES / string_size);
+    std::uniform_int_distribution<int> distribution('a', 'z');
+
+    for (auto & s : strings)
+    {
+        s.resize(string_size);
+        for (auto & c : s)
+            c = distribution(generator);
+    }
+
+    return strings;
+}
+
+}
+
+
+int main(int, char **)
+{
+    pcg64 generator(0);
+
+    for (size_t string_size : {8, 64, 1024})
+    {
+        std::vector<std::string> strings = makeStrings(generator, string_size);
+        std::string suffix = "_" + std::to_string(string_size) + "b";
+
+        UInt64 check = 0;
+
+        benchmark::run("sip_hash" + suffix, TOTAL_BYTES, NUM_RUNS, [&]
+        {
+            for (const auto & s : strings)
+            {
+                SipHash hash;
+                hash.update(s.data(), s.size());
+                check += hash.get64();
+            }
+        });
+
+        benchmark::run("city_hash_64" + suffix, TOTAL_BYTES, NUM_RUNS, [&]
+        {
+            for (const auto & s : strings)
+                check += CityHash_v1_0_2::CityHash64(s.data(), s.size());
+        });
+
+        std::cerr << "string size " << string_size << ": check = " << check << "\n";
+    }
+
+    return 0;
+}
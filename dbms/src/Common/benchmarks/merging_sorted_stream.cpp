@@ -0,0 +1,73 @@
+#include <random>
+#include <pcg_random.hpp>
+
+#include <Columns/ColumnsNumber.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataStreams/OneBlockInputStream.h>
+#include <DataStreams/MergingSortedBlockInputStream.h>
+
+#include "benchmark.h"
+
+
+/** Throughput of the MergingSortedBlockInputStream merge loop - the kernel behind
+  * reading from MergeTree with FINAL and the merge stage of external sort.
+  * Merges 8 sorted streams of UInt64 with interleaved values. Items are total input rows.
+  * The dataset is generated with a fixed seed, so results are comparable across releases.
+  */
+
+namespace
+{
+
+constexpr size_t NUM_STREAMS = 8;
+constexpr size_t ROWS_PER_STREAM = 2000000;
+constexpr size_t NUM_RUNS = 5;
+
+}
+
+
+int main(int, char **)
+{
+    pcg64 generator(0);
+    std::uniform_int_distribution<UInt64> step(0, 1000);
+
+    DB::Blocks blocks;
+
+    for (size_t i = 0; i < NUM_STREAMS; ++i)
+    {
+        auto column = std::make_shared<DB::ColumnUInt64>();
+        auto & data = column->getData();
+        data.resize(ROWS_PER_STREAM);
+
+        UInt64 value = i;
+        for (auto & element : data)
+        {
+            value += step(generator);
+            element = value;
+        }
+
+        blocks.emplace_back(DB::Block{{column, std::make_shared<DB::DataTypeUInt64>(), "x"}});
+    }
+
+    DB::SortDescription description;
+    description.emplace_back("x", 1, 1);
+
+    size_t rows_read = 0;
+
+    benchmark::run("merging_sorted_uint64", NUM_STREAMS * ROWS_PER_STREAM, NUM_RUNS, [&]
+    {
+        DB::BlockInputStreams inputs;
+        for (const auto & block : blocks)
+            inputs.emplace_back(std::make_shared<DB::OneBlockInputStream>(block));
+
+        DB::MergingSortedBlockInputStream merging(inputs, description, DEFAULT_BLOCK_SIZE, 0, nullptr, true);
+
+        merging.readPrefix();
+        while (DB::Block block = merging.read())
+            rows_read += block.rows();
+        merging.readSuffix();
+    });
+
+    std::cerr << "merging_sorted_uint64: check = " << rows_read << "\n";
+
+    return 0;
+}
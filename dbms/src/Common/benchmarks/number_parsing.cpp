@@ -0,0 +1,81 @@
+#include <random>
+#include <pcg_random.hpp>
+
+#include <IO/ReadBufferFromMemory.h>
+#include <IO/WriteBufferFromString.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+
+#include "benchmark.h"
+
+
+/** Throughput of readIntText and readFloatText — the kernels behind parsing of
+  * TSV/CSV/Values input. Items in the report are parsed values.
+  * The dataset is generated with a fixed seed, so results are comparable across releases.
+  */
+
+namespace
+{
+
+constexpr size_t NUM_VALUES = 10000000;
+constexpr size_t NUM_RUNS = 5;
+
+}
+
+
+int main(int, char **)
+{
+    pcg64 generator(0);
+
+    std::string int_text;
+    {
+        DB::WriteBufferFromString out(int_text);
+        std::uniform_int_distribution<UInt64> distribution;
+        for (size_t i = 0; i < NUM_VALUES; ++i)
+        {
+            DB::writeIntText(distribution(generator), out);
+            DB::writeChar('\n', out);
+        }
+    }
+
+    std::string float_text;
+    {
+        DB::WriteBufferFromString out(float_text);
+        std::uniform_real_distribution<double> distribution(-1e9, 1e9);
+        for (size_t i = 0; i < NUM_VALUES; ++i)
+        {
+            DB::writeFloatText(distribution(generator), out);
+            DB::writeChar('\n', out);
+        }
+    }
+
+    UInt64 int_check = 0;
+    benchmark::run("read_int_text", NUM_VALUES, NUM_RUNS, [&]
+    {
+        DB::ReadBufferFromMemory in(int_text.data(), int_text.size());
+        while (!in.eof())
+        {
+            UInt64 x;
+            DB::readIntText(x, in);
+            DB::assertChar('\n', in);
+            int_check += x;
+        }
+    });
+    std::cerr << "read_int_text: check = " << int_check << "\n";
+
+    double float_check = 0;
+    benchmark::run("read_float_text", NUM_VALUES, NUM_RUNS, [&]
+    {
+        DB::ReadBufferFromMemory in(float_text.data(), float_text.size());
+        while (!in.eof())
+        {
+            double x;
+            DB::readFloatText(x, in);
+            DB::assertChar('\n', in);
+            float_check += x;
+        }
+    });
+    std::cerr << "read_float_text: check = " << float_check << "\n";
+
+    return 0;
+}
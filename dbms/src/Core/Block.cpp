@@ -12,7 +12,9 @@
 #include <IO/WriteBufferFromString.h>
 #include <IO/Operators.h>
 #include <Common/typeid_cast.h>
+#include <Common/NameInterner.h>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 
@@ -94,8 +96,9 @@ Block::Block(const ColumnsWithTypeAndName & data_) : data{data_}
 
 void Block::initializeIndexByName()
 {
+    index_by_name.reserve(data.size());
     for (size_t i = 0, size = data.size(); i < size; ++i)
-        index_by_name[data[i].name] = i;
+        index_by_name[NameInterner::instance().intern(data[i].name)] = i;
 }
 
 
@@ -109,7 +112,7 @@ void Block::insert(size_t position, const ColumnWithTypeAndName & elem)
         if (name_pos.second >= position)
             ++name_pos.second;
 
-    index_by_name[elem.name] = position;
+    index_by_name[NameInterner::instance().intern(elem.name)] = position;
     data.emplace(data.begin() + position, elem);
 }
 
@@ -123,20 +126,20 @@ void Block::insert(size_t position, ColumnWithTypeAndName && elem)
         if (name_pos.second >= position)
             ++name_pos.second;
 
-    index_by_name[elem.name] = position;
+    index_by_name[NameInterner::instance().intern(elem.name)] = position;
     data.emplace(data.begin() + position, std::move(elem));
 }
 
 
 void Block::insert(const ColumnWithTypeAndName & elem)
 {
-    index_by_name[elem.name] = data.size();
+    index_by_name[NameInterner::instance().intern(elem.name)] = data.size();
     data.emplace_back(elem);
 }
 
 void Block::insert(ColumnWithTypeAndName && elem)
 {
-    index_by_name[elem.name] = data.size();
+    index_by_name[NameInterner::instance().intern(elem.name)] = data.size();
     data.emplace_back(std::move(elem));
 }
 
@@ -362,8 +365,16 @@ Block Block::sortColumns() const
 {
     Block sorted_block;
 
-    for (const auto & name : index_by_name)
-        sorted_block.insert(data[name.second]);
+    /// The index is hashed and does not provide an order, so sort the names explicitly.
+    std::vector<IndexByName::const_iterator> sorted_index;
+    sorted_index.reserve(index_by_name.size());
+    for (auto it = index_by_name.begin(); it != index_by_name.end(); ++it)
+        sorted_index.emplace_back(it);
+    std::sort(sorted_index.begin(), sorted_index.end(),
+        [](const IndexByName::const_iterator & lhs, const IndexByName::const_iterator & rhs) { return lhs->first < rhs->first; });
+
+    for (const auto & it : sorted_index)
+        sorted_block.insert(data[it->second]);
 
     return sorted_block;
 }
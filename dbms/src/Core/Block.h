@@ -1,9 +1,10 @@
 #pragma once
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include <initializer_list>
 
+#include <common/StringRef.h>
 #include <Common/Exception.h>
 #include <Core/BlockInfo.h>
 #include <Core/NamesAndTypes.h>
@@ -30,7 +31,12 @@ class Block
 {
 private:
     using Container = ColumnsWithTypeAndName;
-    using IndexByName = std::map<String, size_t>;
+
+    /// Hashed, not ordered: name lookups are done several times per action per block
+    ///  in ExpressionActions::execute, and a tree walk with string compares is measurable there.
+    /// Keys are interned (NameInterner), so the index stores 16-byte references instead of
+    ///  copying every name; lookups hash the passed string directly, without interning it.
+    using IndexByName = std::unordered_map<StringRef, size_t, StringRefHash>;
 
     Container data;
     IndexByName index_by_name;
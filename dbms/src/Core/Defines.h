@@ -52,6 +52,8 @@
 /// each period reduces the error counter by 2 times
 /// too short a period can cause errors to disappear immediately after creation.
 #define DBMS_CONNECTION_POOL_WITH_FAILOVER_DEFAULT_DECREASE_ERROR_PERIOD (2 * DBMS_DEFAULT_SEND_TIMEOUT_SEC)
+/// how often the background health-check thread probes replicas with errors
+#define DBMS_CONNECTION_POOL_WITH_FAILOVER_DEFAULT_HEALTH_CHECK_PERIOD_SEC 5
 #define DEFAULT_QUERIES_QUEUE_WAIT_TIME_MS 5000 /// Maximum waiting time in the request queue.
 #define DBMS_DEFAULT_BACKGROUND_POOL_SIZE 16
 
@@ -65,6 +67,9 @@
 #define DBMS_MIN_REVISION_WITH_SERVER_TIMEZONE 54058
 #define DBMS_MIN_REVISION_WITH_QUOTA_KEY_IN_CLIENT_INFO 54060
 #define DBMS_MIN_REVISION_WITH_TABLES_STATUS 54226
+/// Each column of a block in the Native format is prefixed with its serialized size, which allows to skip it.
+#define DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES 54300
+#define DBMS_MIN_REVISION_WITH_PREPARED_STATEMENTS 54300
 
 /// Version of ClickHouse TCP protocol. Set to git tag with latest protocol change.
 #define DBMS_TCP_PROTOCOL_VERSION 54226
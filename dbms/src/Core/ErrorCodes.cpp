@@ -384,6 +384,11 @@ namespace ErrorCodes
     extern const int UNKNOWN_STATUS_OF_DISTRIBUTED_DDL_TASK = 379;
     extern const int CANNOT_KILL = 380;
     extern const int HTTP_LENGTH_REQUIRED = 381;
+    extern const int CANNOT_CREATE_TIMER = 382;
+    extern const int CANNOT_SET_SIGNAL_HANDLER = 383;
+    extern const int CANNOT_FCNTL = 384;
+    extern const int UNKNOWN_PREPARED_STATEMENT = 385;
+    extern const int CANNOT_FSTAT = 386;
 
     extern const int KEEPER_EXCEPTION = 999;
     extern const int POCO_EXCEPTION = 1000;
@@ -182,4 +182,141 @@ struct SortCursorWithCollation
     }
 };
 
+
+/** A tournament tree over cursors - "tree of losers" (Knuth, vol. 3, 5.4.1).
+  * Every internal node stores the cursor that lost the match played at this node;
+  *  the winner of the whole tournament - the cursor with the least current row - is stored at the root.
+  * After the winner advances, only the matches on the path from its leaf to the root are replayed:
+  *  log2(k) comparisons instead of up to 2 * log2(k) of a pop/push cycle on a binary heap,
+  *  and the cursors themselves are never moved.
+  */
+template <typename TSortCursor>
+class LoserTree
+{
+public:
+    LoserTree() = default;
+
+    explicit LoserTree(std::vector<TSortCursor> cursors_)
+    {
+        build(std::move(cursors_));
+    }
+
+    void build(std::vector<TSortCursor> cursors_)
+    {
+        cursors = std::move(cursors_);
+        size_t k = cursors.size();
+        active = k;
+        is_exhausted.assign(k, false);
+        tree.assign(std::max(k, static_cast<size_t>(1)), 0);
+
+        if (k < 2)
+            return;
+
+        /// Play the tournament bottom-up. Internal node t has children 2t and 2t + 1;
+        ///  node j >= k is the leaf of cursor j - k. `winners[t]` is the winner of the subtree of node t.
+        std::vector<size_t> winners(k);
+        for (size_t t = k - 1; t > 0; --t)
+        {
+            size_t left = 2 * t < k ? winners[2 * t] : 2 * t - k;
+            size_t right = 2 * t + 1 < k ? winners[2 * t + 1] : 2 * t + 1 - k;
+
+            if (beats(left, right))
+            {
+                winners[t] = left;
+                tree[t] = right;
+            }
+            else
+            {
+                winners[t] = right;
+                tree[t] = left;
+            }
+        }
+
+        tree[0] = winners[1];
+    }
+
+    bool empty() const { return active == 0; }
+
+    size_t activeCursors() const { return active; }
+
+    /// The cursor with the least current row. Valid only if the tree is not empty.
+    TSortCursor & winner() { return cursors[tree[0]]; }
+
+    /** The least of the current rows of all cursors except the winner.
+      * The runner-up must have lost a match directly to the winner, so it is the least
+      *  of the losers stored on the path from the winner's leaf to the root.
+      * Valid only if more than one cursor is active.
+      */
+    const TSortCursor & secondBest() const
+    {
+        size_t s = tree[0];
+        size_t best = 0;
+        bool found = false;
+
+        for (size_t t = (s + cursors.size()) / 2; t > 0; t /= 2)
+        {
+            size_t loser = tree[t];
+            if (is_exhausted[loser])
+                continue;
+
+            if (!found || beats(loser, best))
+            {
+                best = loser;
+                found = true;
+            }
+        }
+
+        return cursors[best];
+    }
+
+    /// Replay the matches on the path from the winner's leaf to the root after the winner's current row has changed.
+    void replayWinner()
+    {
+        size_t w = tree[0];
+        for (size_t t = (w + cursors.size()) / 2; t > 0; t /= 2)
+            if (beats(tree[t], w))
+                std::swap(w, tree[t]);
+        tree[0] = w;
+    }
+
+    /// Remove the winner from the tournament - its source is exhausted.
+    void retireWinner()
+    {
+        is_exhausted[tree[0]] = true;
+        --active;
+        if (active)
+            replayWinner();
+    }
+
+    /// Apply `f` to every cursor that is still in play, e.g. to move them back into a queue.
+    template <typename F>
+    void forEachActive(F && f)
+    {
+        for (size_t i = 0; i < cursors.size(); ++i)
+            if (!is_exhausted[i])
+                f(cursors[i]);
+    }
+
+private:
+    std::vector<TSortCursor> cursors;
+
+    /// tree[0] - the index of the winner; tree[1 .. k-1] - the indices of the losers of internal nodes.
+    std::vector<size_t> tree;
+
+    /// Exhausted cursors stay in their leaves but lose every match.
+    std::vector<UInt8> is_exhausted;
+
+    size_t active = 0;
+
+    /// Whether the current row of cursor `a` should be given out before the current row of cursor `b`.
+    bool beats(size_t a, size_t b) const
+    {
+        if (is_exhausted[a])
+            return false;
+        if (is_exhausted[b])
+            return true;
+        return !cursors[a].greater(cursors[b]);
+    }
+};
+
 }
@@ -0,0 +1,159 @@
+#include <algorithm>
+
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnsCommon.h>
+#include <Columns/ColumnConst.h>
+#include <Common/Stopwatch.h>
+#include <Common/typeid_cast.h>
+#include <Interpreters/ExpressionActions.h>
+
+#include <DataStreams/AdaptiveFilterBlockInputStream.h>
+
+
+namespace DB
+{
+
+namespace
+{
+
+/// Weight of the statistics of one new block against the accumulated ones.
+constexpr double smoothing_factor = 0.1;
+/// How often (in blocks) the order of the conjuncts is reconsidered.
+constexpr size_t reorder_period = 16;
+/// After this many rows a conjunct passing more than `useless_selectivity` of them is switched off.
+constexpr size_t min_rows_to_disable = 65536;
+constexpr double useless_selectivity = 0.98;
+
+}
+
+
+AdaptiveFilterBlockInputStream::AdaptiveFilterBlockInputStream(const BlockInputStreamPtr & input, Conjuncts conjuncts_)
+    : conjuncts(std::move(conjuncts_))
+{
+    children.push_back(input);
+}
+
+
+String AdaptiveFilterBlockInputStream::getName() const { return "AdaptiveFilter"; }
+
+
+String AdaptiveFilterBlockInputStream::getID() const
+{
+    std::stringstream res;
+    res << "AdaptiveFilter(" << children.back()->getID();
+    for (const auto & conjunct : conjuncts)
+        res << ", " << conjunct.result_name;
+    res << ")";
+    return res.str();
+}
+
+
+size_t AdaptiveFilterBlockInputStream::executeConjunct(Conjunct & conjunct, Block & block, size_t rows)
+{
+    /// Execute the conjunct on a copy of the block header, so that the columns it adds
+    ///  (the result and possible intermediates) do not leak into the pipeline.
+    Block tmp = block;
+
+    Stopwatch watch;
+    conjunct.actions->execute(tmp);
+
+    ColumnPtr result_column = tmp.getByName(conjunct.result_name).column;
+
+    if (result_column->isConst())
+    {
+        /// A constant conjunct does not discriminate rows within this stream; the main filter handles it.
+        conjunct.disabled = true;
+        return rows;
+    }
+
+    const ColumnUInt8 * column_vec = typeid_cast<const ColumnUInt8 *>(result_column.get());
+    if (!column_vec)
+    {
+        /// Nullable or unexpected result type - leave the conjunct to the main filter.
+        conjunct.disabled = true;
+        return rows;
+    }
+
+    const IColumn::Filter & filter = column_vec->getData();
+    size_t passed = countBytesInFilter(filter);
+
+    double elapsed_ns = watch.elapsed();
+    double cost = elapsed_ns / rows;
+    double sel = static_cast<double>(passed) / rows;
+
+    if (conjunct.rows_examined)
+    {
+        conjunct.cost_per_row_ns += smoothing_factor * (cost - conjunct.cost_per_row_ns);
+        conjunct.selectivity += smoothing_factor * (sel - conjunct.selectivity);
+    }
+    else
+    {
+        conjunct.cost_per_row_ns = cost;
+        conjunct.selectivity = sel;
+    }
+    conjunct.rows_examined += rows;
+
+    if (conjunct.rows_examined >= min_rows_to_disable && conjunct.selectivity > useless_selectivity)
+        conjunct.disabled = true;
+
+    if (passed == rows)
+        return rows;
+
+    size_t columns = block.columns();
+    for (size_t i = 0; i < columns; ++i)
+    {
+        ColumnWithTypeAndName & current_column = block.safeGetByPosition(i);
+
+        if (current_column.column->isConst())
+            current_column.column = current_column.column->cut(0, passed);
+        else
+            current_column.column = current_column.column->filter(filter, -1);
+    }
+
+    return passed;
+}
+
+
+void AdaptiveFilterBlockInputStream::updateOrder()
+{
+    /// Cheapest expected price of one discarded row first; switched off conjuncts go last.
+    std::stable_sort(conjuncts.begin(), conjuncts.end(), [](const Conjunct & lhs, const Conjunct & rhs)
+    {
+        if (lhs.disabled != rhs.disabled)
+            return !lhs.disabled;
+        return lhs.cost_per_row_ns * (1 - rhs.selectivity) < rhs.cost_per_row_ns * (1 - lhs.selectivity);
+    });
+}
+
+
+Block AdaptiveFilterBlockInputStream::readImpl()
+{
+    /// Until non-empty block after filtering or end of stream.
+    while (1)
+    {
+        Block res = children.back()->read();
+        if (!res)
+            return res;
+
+        if (++blocks_processed % reorder_period == 0)
+            updateOrder();
+
+        size_t rows = res.rows();
+
+        for (auto & conjunct : conjuncts)
+        {
+            if (!rows)
+                break;
+
+            if (conjunct.disabled)
+                continue;
+
+            rows = executeConjunct(conjunct, res, rows);
+        }
+
+        if (rows)
+            return res;
+    }
+}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <DataStreams/IProfilingBlockInputStream.h>
+
+
+namespace DB
+{
+
+class ExpressionActions;
+
+
+/** Applies cheap conjuncts of the WHERE expression to the block one by one, before the main filter,
+  *  in an order chosen from runtime feedback.
+  *
+  * The main FilterBlockInputStream evaluates the whole WHERE expression on every row of the block,
+  *  so an expensive conjunct (e.g. LIKE over a long string) is computed even for rows that a cheap
+  *  equality comparison next to it would have discarded. This stream evaluates each cheap conjunct
+  *  separately and immediately filters the block by it, shrinking the input of everything that follows.
+  *
+  * For every conjunct it measures the per-row cost and the selectivity on the blocks processed so far
+  *  and periodically reorders the conjuncts by cost / (1 - selectivity) - the expected price of one
+  *  discarded row. Conjuncts that turn out to discard almost nothing are switched off, since filtering
+  *  by them only adds work: the main filter will evaluate them anyway.
+  *
+  * Only deterministic conjuncts may be passed here, because they are evaluated twice - here and in the
+  *  main filter (see InterpreterSelectQuery::executeWhere).
+  */
+class AdaptiveFilterBlockInputStream : public IProfilingBlockInputStream
+{
+private:
+    using ExpressionActionsPtr = std::shared_ptr<ExpressionActions>;
+
+public:
+    struct Conjunct
+    {
+        ExpressionActionsPtr actions;
+        /// Name of the ColumnUInt8 column with the result of the conjunct.
+        String result_name;
+
+        /// Exponentially smoothed runtime statistics.
+        double cost_per_row_ns = 0;
+        double selectivity = 0.5;
+        UInt64 rows_examined = 0;
+
+        /// The conjunct passes almost all rows - filtering by it is not worth the evaluation.
+        bool disabled = false;
+    };
+
+    using Conjuncts = std::vector<Conjunct>;
+
+    AdaptiveFilterBlockInputStream(const BlockInputStreamPtr & input, Conjuncts conjuncts_);
+
+    String getName() const override;
+    String getID() const override;
+
+protected:
+    Block readImpl() override;
+
+private:
+    /// Execute one conjunct on the block and filter the block by its result. Returns the remaining number of rows.
+    size_t executeConjunct(Conjunct & conjunct, Block & block, size_t rows);
+
+    /// Reorder the conjuncts by the expected cost of discarding a row; switch off non-selective ones.
+    void updateOrder();
+
+    Conjuncts conjuncts;
+    size_t blocks_processed = 0;
+};
+
+}
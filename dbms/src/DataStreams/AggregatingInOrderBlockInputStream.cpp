@@ -0,0 +1,167 @@
+#include <DataStreams/AggregatingInOrderBlockInputStream.h>
+
+
+namespace DB
+{
+
+AggregatingInOrderBlockInputStream::~AggregatingInOrderBlockInputStream()
+{
+    if (has_current_group)
+        for (size_t i = 0; i < aggregates.size(); ++i)
+            aggregates[i].function->destroy(places[i]);
+}
+
+
+String AggregatingInOrderBlockInputStream::getID() const
+{
+    std::stringstream res;
+    res << "AggregatingInOrder(" << children.back()->getID() << ", keys";
+
+    for (const auto & name : key_names)
+        res << ", " << name;
+
+    res << ", aggregates";
+
+    for (const auto & aggregate : aggregates)
+        res << ", " << aggregate.column_name;
+
+    res << ")";
+    return res.str();
+}
+
+
+void AggregatingInOrderBlockInputStream::init(const Block & block)
+{
+    for (const auto & name : key_names)
+    {
+        key_positions.push_back(block.getPositionByName(name));
+        res_header.insert(block.getByName(name).cloneEmpty());
+    }
+
+    for (const auto & aggregate : aggregates)
+    {
+        ColumnNumbers positions;
+        for (const auto & name : aggregate.argument_names)
+            positions.push_back(block.getPositionByName(name));
+        argument_positions.emplace_back(std::move(positions));
+
+        DataTypePtr type = aggregate.function->getReturnType();
+        res_header.insert(ColumnWithTypeAndName(type->createColumn(), type, aggregate.column_name));
+    }
+
+    current_key.resize(key_names.size());
+    places.resize(aggregates.size(), nullptr);
+}
+
+
+void AggregatingInOrderBlockInputStream::insertCurrentGroup(Block & res)
+{
+    for (size_t i = 0; i < key_positions.size(); ++i)
+        res.getByPosition(i).column->insert(current_key[i]);
+
+    for (size_t i = 0; i < aggregates.size(); ++i)
+    {
+        aggregates[i].function->insertResultInto(places[i], *res.getByPosition(key_positions.size() + i).column);
+        aggregates[i].function->destroy(places[i]);
+    }
+
+    has_current_group = false;
+}
+
+
+Block AggregatingInOrderBlockInputStream::readImpl()
+{
+    if (finished)
+        return Block();
+
+    Block res;
+
+    while (true)
+    {
+        Block block = children.back()->read();
+
+        if (!block)
+        {
+            finished = true;
+
+            /// Give out the last group.
+            if (has_current_group)
+            {
+                if (!res)
+                    res = res_header.cloneEmpty();
+                insertCurrentGroup(res);
+            }
+
+            return res;
+        }
+
+        size_t rows = block.rows();
+        if (!rows)
+            continue;
+
+        if (!res_header)
+            init(block);
+
+        if (!res)
+            res = res_header.cloneEmpty();
+
+        ConstColumnPlainPtrs key_columns(key_positions.size());
+        for (size_t i = 0; i < key_positions.size(); ++i)
+            key_columns[i] = block.safeGetByPosition(key_positions[i]).column.get();
+
+        std::vector<ConstColumnPlainPtrs> argument_columns(aggregates.size());
+        for (size_t i = 0; i < aggregates.size(); ++i)
+            for (size_t position : argument_positions[i])
+                argument_columns[i].push_back(block.safeGetByPosition(position).column.get());
+
+        for (size_t row = 0; row < rows; ++row)
+        {
+            bool key_differs;
+
+            if (row == 0)
+            {
+                /// Compare with the key of the group accumulated from the previous blocks.
+                key_differs = !has_current_group;
+                Field value;
+                for (size_t i = 0; !key_differs && i < key_columns.size(); ++i)
+                {
+                    key_columns[i]->get(row, value);
+                    key_differs = value != current_key[i];
+                }
+            }
+            else
+            {
+                key_differs = false;
+                for (size_t i = 0; !key_differs && i < key_columns.size(); ++i)
+                    key_differs = 0 != key_columns[i]->compareAt(row, row - 1, *key_columns[i], 1);
+            }
+
+            if (key_differs)
+            {
+                if (has_current_group)
+                    insertCurrentGroup(res);
+
+                for (size_t i = 0; i < key_columns.size(); ++i)
+                    key_columns[i]->get(row, current_key[i]);
+
+                for (size_t i = 0; i < aggregates.size(); ++i)
+                {
+                    if (!places[i])
+                        places[i] = arena.alloc(aggregates[i].function->sizeOfData());
+                    aggregates[i].function->create(places[i]);
+                }
+
+                has_current_group = true;
+            }
+
+            for (size_t i = 0; i < aggregates.size(); ++i)
+                aggregates[i].function->add(places[i], argument_columns[i].data(), row, &arena);
+        }
+
+        /// The group that is still being accumulated is not given out until its last row has arrived.
+        if (res.rows())
+            return res;
+    }
+}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Core/Names.h>
+#include <Core/ColumnNumbers.h>
+#include <Common/Arena.h>
+#include <Interpreters/AggregateDescription.h>
+#include <DataStreams/IProfilingBlockInputStream.h>
+
+
+namespace DB
+{
+
+/** Aggregates a stream that is already sorted by the GROUP BY keys: a group is finalized
+  *  as soon as a row with a different key arrives, so only the state of a single group is kept
+  *  in memory at any time (unlike Aggregator, which keeps a hash table with all the groups).
+  * Produces finalized values of the aggregate functions right away.
+  *
+  * Used by InterpreterSelectQuery when the GROUP BY keys form a prefix of the primary key
+  *  (see the optimize_aggregation_in_order setting).
+  */
+class AggregatingInOrderBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    AggregatingInOrderBlockInputStream(
+        const BlockInputStreamPtr & input, const Names & key_names_, const AggregateDescriptions & aggregates_)
+        : key_names(key_names_), aggregates(aggregates_)
+    {
+        children.push_back(input);
+    }
+
+    ~AggregatingInOrderBlockInputStream() override;
+
+    String getName() const override { return "AggregatingInOrder"; }
+
+    String getID() const override;
+
+protected:
+    Block readImpl() override;
+
+private:
+    Names key_names;
+    AggregateDescriptions aggregates;
+
+    /// The structure of the result: the key columns, then a column per aggregate function.
+    Block res_header;
+
+    /// Positions of the key columns and of the argument columns of each aggregate function in the source blocks.
+    ColumnNumbers key_positions;
+    std::vector<ColumnNumbers> argument_positions;
+
+    Arena arena;                            /// The aggregation states are allocated here.
+    std::vector<AggregateDataPtr> places;   /// One state per aggregate function.
+
+    std::vector<Field> current_key;         /// The key of the group being accumulated.
+    bool has_current_group = false;
+
+    bool finished = false;
+
+    /// Initialize the result structure and the column positions from the first source block.
+    void init(const Block & block);
+
+    /// Insert the accumulated group into the result and reset the aggregation states.
+    void insertCurrentGroup(Block & res);
+};
+
+}
@@ -108,18 +108,29 @@ void AggregatingSortedBlockInputStream::merge(ColumnPlainPtrs & merged_columns,
                 merged_columns[j]->insertFrom(*current->all_columns[j], current->pos);
             }
 
-            /// Add the empty aggregation state to the aggregate columns. The state will be updated in the `addRow` function.
+            /// Add the empty aggregation state to the aggregate columns. The state will be updated in the `addRows` function.
             for (auto & column_to_aggregate : columns_to_aggregate)
                 column_to_aggregate->insertDefault();
 
             ++merged_rows;
         }
 
-        addRow(current);
+        /** All following rows of the current block with the same key are aggregated wholesale:
+          *  the current cursor was the least of the queue and the keys are equal, so they are
+          *  not greater than the tops of the other cursors, and the queue does not have to be
+          *  consulted between them.
+          */
+        size_t run_begin = current->pos;
+        size_t run_end = run_begin + 1;
+        while (run_end < current->rows && !current.greaterAt(current, run_end, run_begin))
+            ++run_end;
 
-        if (!current->isLast())
+        addRows(current, run_begin, run_end - run_begin);
+
+        current->pos = run_end;
+
+        if (current->pos != current->rows)
         {
-            current->next();
             queue.push(current);
         }
         else
@@ -134,12 +145,12 @@ void AggregatingSortedBlockInputStream::merge(ColumnPlainPtrs & merged_columns,
 
 
 template <typename TSortCursor>
-void AggregatingSortedBlockInputStream::addRow(TSortCursor & cursor)
+void AggregatingSortedBlockInputStream::addRows(TSortCursor & cursor, size_t begin, size_t length)
 {
     for (size_t i = 0, size = column_numbers_to_aggregate.size(); i < size; ++i)
     {
         size_t j = column_numbers_to_aggregate[i];
-        columns_to_aggregate[i]->insertMergeFrom(*cursor->all_columns[j], cursor->pos);
+        columns_to_aggregate[i]->insertMergeRangeFrom(*cursor->all_columns[j], begin, length);
     }
 }
 
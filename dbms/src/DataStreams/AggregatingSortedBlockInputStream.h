@@ -73,10 +73,11 @@ private:
     template <typename TSortCursor>
     void merge(ColumnPlainPtrs & merged_columns, std::priority_queue<TSortCursor> & queue);
 
-    /** Extract all states of aggregate functions and merge them with the current group.
+    /** Merge the states of the rows [begin, begin + length) of the cursor's block
+      *  into the current group. One arena and function lookup per column, not per row.
       */
     template <typename TSortCursor>
-    void addRow(TSortCursor & cursor);
+    void addRows(TSortCursor & cursor, size_t begin, size_t length);
 };
 
 }
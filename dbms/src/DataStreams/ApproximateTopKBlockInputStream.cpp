@@ -0,0 +1,145 @@
+#include <Columns/ColumnsNumber.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypeFixedString.h>
+#include <DataStreams/ApproximateTopKBlockInputStream.h>
+#include <Common/typeid_cast.h>
+
+
+namespace DB
+{
+
+namespace
+{
+    /// Allow NxK more space in the sketch than results requested, to increase accuracy
+    ///  (same as in AggregateFunctionTopK).
+    constexpr size_t sketch_load_factor = 3;
+}
+
+
+ApproximateTopKBlockInputStream::ApproximateTopKBlockInputStream(
+    const BlockInputStreams & inputs,
+    const String & key_column_name_, const DataTypePtr & key_type_,
+    const String & count_column_name_,
+    size_t num_results_, size_t max_threads_)
+    : key_column_name(key_column_name_), key_type(key_type_), count_column_name(count_column_name_),
+    num_results(num_results_), max_threads(std::min(inputs.size(), max_threads_)),
+    handler(*this), processor(inputs, nullptr, max_threads, handler)
+{
+    children = inputs;
+}
+
+
+String ApproximateTopKBlockInputStream::getID() const
+{
+    std::stringstream res;
+    res << "ApproximateTopK(";
+
+    Strings children_ids(children.size());
+    for (size_t i = 0; i < children.size(); ++i)
+        children_ids[i] = children[i]->getID();
+
+    /// Order does not matter.
+    std::sort(children_ids.begin(), children_ids.end());
+
+    for (size_t i = 0; i < children_ids.size(); ++i)
+        res << (i == 0 ? "" : ", ") << children_ids[i];
+
+    res << ", " << key_column_name << ", " << count_column_name << ", " << num_results << ")";
+    return res.str();
+}
+
+
+void ApproximateTopKBlockInputStream::cancel()
+{
+    bool old_val = false;
+    if (!is_cancelled.compare_exchange_strong(old_val, true, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return;
+
+    if (!executed)
+        processor.cancel();
+}
+
+
+bool ApproximateTopKBlockInputStream::isSupportedKeyType(const DataTypePtr & type)
+{
+    return type->isNumeric()
+        || typeid_cast<const DataTypeString *>(type.get())
+        || typeid_cast<const DataTypeFixedString *>(type.get());
+}
+
+
+void ApproximateTopKBlockInputStream::Handler::onBlock(Block & block, size_t thread_num)
+{
+    ColumnPtr column = block.getByName(parent.key_column_name).column;
+    if (auto full_column = column->convertToFullColumnIfConst())
+        column = full_column;
+
+    auto & sketch = *parent.sketches[thread_num];
+
+    size_t rows = block.rows();
+    for (size_t i = 0; i < rows; ++i)
+        sketch.insert(column->getDataAt(i));
+}
+
+void ApproximateTopKBlockInputStream::Handler::onException(std::exception_ptr & exception, size_t thread_num)
+{
+    parent.exceptions[thread_num] = exception;
+    parent.cancel();
+}
+
+
+Block ApproximateTopKBlockInputStream::readImpl()
+{
+    if (executed)
+        return {};
+    executed = true;
+
+    exceptions.resize(max_threads);
+
+    sketches.resize(max_threads);
+    for (auto & sketch : sketches)
+        sketch = std::make_unique<Sketch>(num_results * sketch_load_factor);
+
+    LOG_TRACE(log, "Collecting top " << num_results << " keys with SpaceSaving sketches");
+
+    processor.process();
+    processor.wait();
+
+    rethrowFirstException(exceptions);
+
+    if (isCancelled())
+        return {};
+
+    Sketch & merged = *sketches[0];
+    for (size_t i = 1; i < sketches.size(); ++i)
+        merged.merge(*sketches[i]);
+
+    auto counters = merged.topK(num_results);
+
+    ColumnWithTypeAndName key_column;
+    key_column.name = key_column_name;
+    key_column.type = key_type;
+    key_column.column = key_type->createColumn();
+
+    ColumnWithTypeAndName count_column;
+    count_column.name = count_column_name;
+    count_column.type = std::make_shared<DataTypeUInt64>();
+    auto count_data = std::make_shared<ColumnUInt64>();
+    count_column.column = count_data;
+
+    for (const auto & counter : counters)
+    {
+        key_column.column->insertData(counter.key.data, counter.key.size);
+        count_data->getData().push_back(counter.count);
+    }
+
+    sketches.clear();
+
+    Block res;
+    res.insert(std::move(key_column));
+    res.insert(std::move(count_column));
+    return res;
+}
+
+}
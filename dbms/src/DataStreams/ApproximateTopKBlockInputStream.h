@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Common/SpaceSaving.h>
+#include <DataTypes/IDataType.h>
+#include <DataStreams/IProfilingBlockInputStream.h>
+#include <DataStreams/ParallelInputsProcessor.h>
+
+
+namespace DB
+{
+
+/** Computes an approximate `SELECT key, count() ... GROUP BY key ORDER BY count() DESC LIMIT n`
+  *  with bounded memory: instead of the aggregate table with all the groups, every thread
+  *  maintains a small SpaceSaving sketch over the key (see Common/SpaceSaving.h), and the
+  *  sketches are merged at the end.
+  * Returns a single block with the candidate groups and their counts - a small multiple of n
+  *  rows - which is then sorted and limited by the usual following steps of the pipeline.
+  * The keys with the largest counts are found with high probability if they stand out from
+  *  the rest, but both the set of returned keys and their counts may be inexact;
+  *  that is why this mode is opt-in (see optimize_approximate_topk).
+  */
+class ApproximateTopKBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    ApproximateTopKBlockInputStream(
+        const BlockInputStreams & inputs,
+        const String & key_column_name_, const DataTypePtr & key_type_,
+        const String & count_column_name_,
+        size_t num_results_, size_t max_threads_);
+
+    String getName() const override { return "ApproximateTopK"; }
+
+    String getID() const override;
+
+    void cancel() override;
+
+    /// Whether values of this type are losslessly represented by IColumn::getDataAt / insertData,
+    ///  so that they can be used as sketch keys.
+    static bool isSupportedKeyType(const DataTypePtr & type);
+
+protected:
+    /// Do nothing that preparation to execution of the query be done in parallel, in ParallelInputsProcessor.
+    void readPrefix() override
+    {
+    }
+
+    Block readImpl() override;
+
+private:
+    using Sketch = SpaceSaving<StringRef, StringRefHash>;
+
+    String key_column_name;
+    DataTypePtr key_type;
+    String count_column_name;
+    size_t num_results;
+    size_t max_threads;
+
+    /// One sketch per thread; merged when the sources are exhausted.
+    std::vector<std::unique_ptr<Sketch>> sketches;
+    Exceptions exceptions;
+
+    std::atomic<bool> executed {false};
+
+    Logger * log = &Logger::get("ApproximateTopKBlockInputStream");
+
+
+    struct Handler
+    {
+        Handler(ApproximateTopKBlockInputStream & parent_)
+            : parent(parent_) {}
+
+        void onBlock(Block & block, size_t thread_num);
+        void onFinishThread(size_t thread_num) {}
+        void onFinish() {}
+        void onException(std::exception_ptr & exception, size_t thread_num);
+
+        ApproximateTopKBlockInputStream & parent;
+    };
+
+    Handler handler;
+    ParallelInputsProcessor<Handler> processor;
+};
+
+}
@@ -5,7 +5,8 @@
 #include <DataStreams/IProfilingBlockInputStream.h>
 #include <Common/setThreadName.h>
 #include <Common/CurrentMetrics.h>
-#include <common/ThreadPool.h>
+#include <Common/LockFreeBoundedQueue.h>
+#include <Common/GlobalWorkPool.h>
 #include <Common/MemoryTracker.h>
 
 
@@ -24,11 +25,21 @@ namespace DB
   *    This is necessary, for example, so that during the waiting period you can check if a packet
   *     has come over the network with a request to interrupt the execution of the query.
   *    It also allows you to execute multiple queries at the same time.
+  *
+  * The inner thread puts the prepared blocks into a bounded queue.
+  * With `queue_depth` = 1 (the default) at most one prepared block waits for the consumer -
+  *  the classic double buffering. A deeper queue smooths out sources whose per-block time varies
+  *  (e.g. remote servers on a jittery network): while the consumer digests a burst of quickly
+  *  produced blocks, the source keeps working ahead instead of stalling the pipeline later.
+  * If `max_queued_bytes` is nonzero, the inner thread additionally pauses while the prepared
+  *  blocks hold more than the specified number of bytes, so that a deep queue of wide blocks
+  *  cannot take an unbounded amount of memory.
   */
 class AsynchronousBlockInputStream : public IProfilingBlockInputStream
 {
 public:
-    AsynchronousBlockInputStream(const BlockInputStreamPtr & in)
+    AsynchronousBlockInputStream(const BlockInputStreamPtr & in, size_t queue_depth = 1, size_t max_queued_bytes_ = 0)
+        : max_queued_bytes(max_queued_bytes_), output_queue(std::max(queue_depth, static_cast<size_t>(1)))
     {
         children.push_back(in);
     }
@@ -46,19 +57,14 @@ public:
     {
         /// Do not call `readPrefix` on the child, so that the corresponding actions are performed in a separate thread.
         if (!started)
-        {
-            next();
-            started = true;
-        }
+            start();
     }
 
     void readSuffix() override
     {
         if (started)
         {
-            pool.wait();
-            if (exception)
-                std::rethrow_exception(exception);
+            finalize();
             children.back()->readSuffix();
             started = false;
         }
@@ -71,10 +77,10 @@ public:
     bool poll(UInt64 milliseconds)
     {
         if (!started)
-        {
-            next();
-            started = true;
-        }
+            start();
+
+        if (all_read)
+            return true;
 
         return ready.tryWait(milliseconds);
     }
@@ -82,78 +88,182 @@ public:
 
     ~AsynchronousBlockInputStream() override
     {
-        if (started)
-            pool.wait();
+        try
+        {
+            if (started)
+            {
+                if (!all_read)
+                    cancel();
+
+                finalize();
+            }
+        }
+        catch (...)
+        {
+            tryLogCurrentException(__PRETTY_FUNCTION__);
+        }
     }
 
 protected:
-    ThreadPool pool{1};
+    /// A block or an exception. An empty block is the end marker.
+    struct OutputData
+    {
+        Block block;
+        std::exception_ptr exception;
+
+        OutputData() {}
+        OutputData(Block && block_) : block(std::move(block_)) {}
+        OutputData(std::exception_ptr exception_) : exception(exception_) {}
+    };
+
+    const size_t max_queued_bytes;
+
+    /// The inner job in the global pool of worker threads.
+    GlobalWorkPool::GroupPtr job_group;
     Poco::Event ready;
     bool started = false;
-    bool first = true;
+    bool all_read = false;
+
+    /** The queue of the prepared blocks. Also, you can put an exception instead of a block.
+      * The inner thread always finishes by putting the end marker into the queue (even after an exception),
+      *  and the queue must always be read up to the end marker (see `finalize`),
+      *  otherwise the inner thread could be blocked during insertion into the queue.
+      */
+    LockFreeBoundedQueue<OutputData> output_queue;
+
+    /// Whether the end marker has been taken out of the queue.
+    bool drained = false;
 
-    Block block;
-    std::exception_ptr exception;
+    /// Bytes in the blocks waiting in the queue. For backpressure by bytes, not only by the number of blocks.
+    std::atomic<size_t> queued_bytes {0};
+    Poco::Event bytes_freed;
 
 
+    void start()
+    {
+        started = true;
+        job_group = GlobalWorkPool::instance().createGroup();
+        GlobalWorkPool::instance().schedule(job_group, std::bind(&AsynchronousBlockInputStream::loop, this, current_memory_tracker));
+    }
+
     Block readImpl() override
     {
-        /// If there were no calculations yet, calculate the first block synchronously
+        if (all_read)
+            return Block();
+
         if (!started)
+            start();
+
+        OutputData res;
+        output_queue.pop(res);
+
+        if (res.exception)
+            std::rethrow_exception(res.exception);
+
+        if (!res.block)
         {
-            calculate(current_memory_tracker);
-            started = true;
+            all_read = true;
+            drained = true;
+            return Block();
         }
-        else    /// If the calculations are already in progress - wait for the result
-            pool.wait();
 
-        if (exception)
-            std::rethrow_exception(exception);
+        releaseQueuedBytes(res.block);
 
-        Block res = block;
-        if (!res)
-            return res;
+        /// Keep `poll` working: the event was consumed, but there may be more prepared blocks.
+        if (output_queue.size())
+            ready.set();
 
-        /// Start the next block calculation
-        block.clear();
-        next();
-
-        return res;
+        return res.block;
     }
 
-
-    void next()
+    void releaseQueuedBytes(const Block & block)
     {
-        ready.reset();
-        pool.schedule(std::bind(&AsynchronousBlockInputStream::calculate, this, current_memory_tracker));
+        if (max_queued_bytes)
+        {
+            queued_bytes -= block.bytes();
+            bytes_freed.set();
+        }
     }
 
+    /** Read the queue up to the end marker and wait for the inner thread.
+      * Rethrows an exception found in the queue, if any.
+      */
+    void finalize()
+    {
+        std::exception_ptr exception;
 
-    /// Calculations that can be performed in a separate thread
-    void calculate(MemoryTracker * memory_tracker)
+        if (!drained)
+        {
+            OutputData res;
+            while (true)
+            {
+                output_queue.pop(res);
+
+                if (res.exception)
+                {
+                    if (!exception)
+                        exception = res.exception;
+                }
+                else if (!res.block)
+                    break;
+                else
+                    releaseQueuedBytes(res.block);    /// The inner thread may be waiting for the byte limit.
+            }
+
+            drained = true;
+        }
+
+        if (job_group)
+        {
+            GlobalWorkPool::instance().wait(job_group);
+            job_group = nullptr;
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    /// The work of the inner thread: read blocks ahead of the consumer, while there is space in the queue.
+    void loop(MemoryTracker * memory_tracker)
     {
         CurrentMetrics::Increment metric_increment{CurrentMetrics::QueryThread};
 
+        setThreadName("AsyncBlockInput");
+        current_memory_tracker = memory_tracker;
+
         try
         {
-            if (first)
+            children.back()->readPrefix();
+
+            while (true)
             {
-                first = false;
-                setThreadName("AsyncBlockInput");
-                current_memory_tracker = memory_tracker;
-                children.back()->readPrefix();
-            }
+                Block block = children.back()->read();
+
+                if (!block)
+                    break;
+
+                if (max_queued_bytes)
+                    queued_bytes += block.bytes();
 
-            block = children.back()->read();
+                output_queue.emplace(std::move(block));
+                ready.set();
+
+                /// Backpressure by bytes: do not read further while the prepared blocks hold too much memory.
+                if (max_queued_bytes)
+                    while (queued_bytes.load(std::memory_order_relaxed) >= max_queued_bytes)
+                        bytes_freed.wait();
+            }
         }
         catch (...)
         {
-            exception = std::current_exception();
+            output_queue.emplace(std::current_exception());
+            ready.set();
         }
 
+        /// The end marker.
+        output_queue.emplace();
         ready.set();
     }
 };
 
 }
-
@@ -30,6 +30,12 @@ struct BlockStreamProfileInfo
     size_t blocks = 0;
     size_t bytes = 0;
 
+    /// Peak of the memory tracked while this stream was producing blocks. Includes the
+    ///  allocations of child streams read from within readImpl in the same thread,
+    ///  so the values are "inclusive", like times in a profile.
+    /// Filled only locally; not serialized.
+    Int64 peak_memory_usage = 0;
+
     using BlockStreamProfileInfos = std::vector<const BlockStreamProfileInfo *>;
 
     /// Collect BlockStreamProfileInfo for the nearest sources in the tree named `name`. Example; collect all info for PartialSorting streams.
@@ -1,4 +1,5 @@
 #include <Interpreters/Set.h>
+#include <Interpreters/SetCache.h>
 #include <Interpreters/Join.h>
 #include <DataStreams/IBlockOutputStream.h>
 #include <DataStreams/CreatingSetsBlockInputStream.h>
@@ -98,7 +99,10 @@ void CreatingSetsBlockInputStream::createOne(SubqueryForSet & subquery)
         if (!done_with_set)
         {
             if (!subquery.set->insertFromBlock(block))
+            {
                 done_with_set = true;
+                subquery.set_cache = nullptr;    /// Don't share a set truncated by the size limits.
+            }
         }
 
         if (!done_with_join)
@@ -148,6 +152,10 @@ void CreatingSetsBlockInputStream::createOne(SubqueryForSet & subquery)
     if (table_out)
         table_out->writeSuffix();
 
+    /// The set was built in full - share it with other queries (see the use_set_cache setting).
+    if (subquery.set_cache && subquery.set)
+        subquery.set_cache->set(subquery.set_cache_key, subquery.set);
+
     /// We will display information about how many rows and bytes are read.
     size_t rows = 0;
     size_t bytes = 0;
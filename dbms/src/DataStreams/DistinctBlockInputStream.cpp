@@ -1,4 +1,13 @@
 #include <DataStreams/DistinctBlockInputStream.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <DataStreams/NativeBlockOutputStream.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/WriteBufferFromFile.h>
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedWriteBuffer.h>
+#include <Common/SipHash.h>
+#include <Poco/TemporaryFile.h>
+#include <common/logger_useful.h>
 
 namespace DB
 {
@@ -8,16 +17,63 @@ namespace ErrorCodes
     extern const int SET_SIZE_LIMIT_EXCEEDED;
 }
 
-DistinctBlockInputStream::DistinctBlockInputStream(const BlockInputStreamPtr & input, const Limits & limits, size_t limit_hint_, const Names & columns)
+
+/// A bucket with rows that have new (not seen before the set was frozen) keys, in a temporary file.
+struct DistinctBlockInputStream::Bucket
+{
+    Poco::TemporaryFile file;
+    WriteBufferFromFile file_buf;
+    CompressedWriteBuffer compressed_buf;
+    NativeBlockOutputStream out;
+    size_t rows = 0;
+
+    Bucket(const std::string & tmp_path)
+        : file(tmp_path), file_buf(file.path()), compressed_buf(file_buf), out(compressed_buf)
+    {
+    }
+
+    void write(const Block & block)
+    {
+        out.write(block);
+        rows += block.rows();
+    }
+
+    void finishWriting()
+    {
+        out.flush();
+        compressed_buf.next();
+        file_buf.next();
+    }
+};
+
+struct DistinctBlockInputStream::BucketReader
+{
+    ReadBufferFromFile file_in;
+    CompressedReadBuffer compressed_in;
+    NativeBlockInputStream block_in;
+
+    BucketReader(const std::string & path)
+        : file_in(path), compressed_in(file_in), block_in(compressed_in)
+    {
+    }
+};
+
+
+DistinctBlockInputStream::DistinctBlockInputStream(const BlockInputStreamPtr & input, const Limits & limits, size_t limit_hint_, const Names & columns,
+    const std::string & tmp_path_)
     : columns_names(columns)
     , limit_hint(limit_hint_)
     , max_rows(limits.max_rows_in_distinct)
     , max_bytes(limits.max_bytes_in_distinct)
     , overflow_mode(limits.distinct_overflow_mode)
+    , max_bytes_before_external(limits.max_bytes_before_external_distinct)
+    , tmp_path(tmp_path_)
 {
     children.push_back(input);
 }
 
+DistinctBlockInputStream::~DistinctBlockInputStream() = default;
+
 String DistinctBlockInputStream::getID() const
 {
     std::stringstream res;
@@ -32,12 +88,25 @@ Block DistinctBlockInputStream::readImpl()
     while (1)
     {
         /// Stop reading if we already reach the limit.
-        if (limit_hint && data.getTotalRowCount() >= limit_hint)
+        if (limit_hint && emitted_rows >= limit_hint)
             return Block();
 
+        if (reading_buckets)
+            return readFromBuckets();
+
         Block block = children[0]->read();
         if (!block)
-            return Block();
+        {
+            if (!external)
+                return Block();
+
+            /// The source is exhausted - deduplicate and return the spilled buckets.
+            for (auto & bucket : buckets)
+                bucket->finishWriting();
+
+            reading_buckets = true;
+            continue;
+        }
 
         const ConstColumnPlainPtrs column_ptrs(getKeyColumns(block));
         if (column_ptrs.empty())
@@ -46,10 +115,45 @@ Block DistinctBlockInputStream::readImpl()
         if (data.empty())
             data.init(SetVariants::chooseMethod(column_ptrs, key_sizes));
 
-        const size_t old_set_size = data.getTotalRowCount();
         const size_t rows = block.rows();
         IColumn::Filter filter(rows);
 
+        if (external)
+        {
+            /// Keys from the frozen set were already emitted; rows with new keys go into the buckets.
+            switch (data.type)
+            {
+                case SetVariants::Type::EMPTY:
+                    break;
+        #define M(NAME) \
+                case SetVariants::Type::NAME: \
+                    buildFilterFrozen(*data.NAME, column_ptrs, filter, rows); \
+                    break;
+            APPLY_FOR_SET_VARIANTS(M)
+        #undef M
+            }
+
+            size_t passed = 0;
+            for (size_t i = 0; i < rows; ++i)
+                passed += filter[i];
+
+            if (passed)
+            {
+                if (passed < rows)
+                {
+                    size_t all_columns = block.columns();
+                    for (size_t i = 0; i < all_columns; ++i)
+                        block.safeGetByPosition(i).column = block.safeGetByPosition(i).column->filter(filter, passed);
+                }
+
+                scatterBlockToBuckets(block);
+            }
+
+            continue;
+        }
+
+        const size_t old_set_size = data.getTotalRowCount();
+
         switch (data.type)
         {
             case SetVariants::Type::EMPTY:
@@ -68,28 +172,19 @@ Block DistinctBlockInputStream::readImpl()
 
         if (!checkLimits())
         {
-            switch (overflow_mode)
-            {
-                case OverflowMode::THROW:
-                    throw Exception("DISTINCT-Set size limit exceeded."
-                        " Rows: " + toString(data.getTotalRowCount()) +
-                        ", limit: " + toString(max_rows) +
-                        ". Bytes: " + toString(data.getTotalByteCount()) +
-                        ", limit: " + toString(max_bytes) + ".",
-                        ErrorCodes::SET_SIZE_LIMIT_EXCEEDED);
-
-                case OverflowMode::BREAK:
-                    return Block();
-
-                default:
-                    throw Exception("Logical error: unknown overflow mode", ErrorCodes::LOGICAL_ERROR);
-            }
+            handleOverflow();
+            return Block();
         }
 
+        /// If the set has grown too large, freeze it and spill the following new keys to disk.
+        if (max_bytes_before_external && !tmp_path.empty() && data.getTotalByteCount() > max_bytes_before_external)
+            switchToExternal();
+
         size_t all_columns = block.columns();
         for (size_t i = 0; i < all_columns; ++i)
             block.safeGetByPosition(i).column = block.safeGetByPosition(i).column->filter(filter, -1);
 
+        emitted_rows += block.rows();
         return block;
     }
 }
@@ -103,6 +198,143 @@ bool DistinctBlockInputStream::checkLimits() const
     return true;
 }
 
+/// For THROW mode - throws; for BREAK mode - returns, and the caller stops the stream.
+void DistinctBlockInputStream::handleOverflow() const
+{
+    switch (overflow_mode)
+    {
+        case OverflowMode::THROW:
+            throw Exception("DISTINCT-Set size limit exceeded."
+                " Rows: " + toString(data.getTotalRowCount()) +
+                ", limit: " + toString(max_rows) +
+                ". Bytes: " + toString(data.getTotalByteCount()) +
+                ", limit: " + toString(max_bytes) + ".",
+                ErrorCodes::SET_SIZE_LIMIT_EXCEEDED);
+
+        case OverflowMode::BREAK:
+            return;
+
+        default:
+            throw Exception("Logical error: unknown overflow mode", ErrorCodes::LOGICAL_ERROR);
+    }
+}
+
+void DistinctBlockInputStream::switchToExternal()
+{
+    LOG_DEBUG(&Logger::get("DistinctBlockInputStream"), "The DISTINCT value set has reached " << data.getTotalByteCount()
+        << " bytes. Freezing it and spilling new keys into " << NUM_EXTERNAL_BUCKETS << " buckets in temporary files.");
+
+    buckets.reserve(NUM_EXTERNAL_BUCKETS);
+    for (size_t i = 0; i < NUM_EXTERNAL_BUCKETS; ++i)
+        buckets.emplace_back(std::make_unique<Bucket>(tmp_path));
+
+    external = true;
+}
+
+void DistinctBlockInputStream::scatterBlockToBuckets(const Block & block)
+{
+    /// The bucket is chosen by a hash of the key columns, so all duplicates of a key fall into one bucket.
+    const ConstColumnPlainPtrs key_columns(getKeyColumns(block));
+    size_t rows = block.rows();
+
+    IColumn::Selector selector(rows);
+    for (size_t i = 0; i < rows; ++i)
+    {
+        SipHash hash;
+        for (const auto * column : key_columns)
+            column->updateHashWithValue(i, hash);
+        selector[i] = hash.get64() % NUM_EXTERNAL_BUCKETS;
+    }
+
+    std::vector<Block> bucket_blocks(NUM_EXTERNAL_BUCKETS);
+    for (size_t b = 0; b < NUM_EXTERNAL_BUCKETS; ++b)
+        bucket_blocks[b] = block.cloneEmpty();
+
+    size_t all_columns = block.columns();
+    for (size_t i = 0; i < all_columns; ++i)
+    {
+        ColumnPtr column = block.safeGetByPosition(i).column;
+        if (auto converted = column->convertToFullColumnIfConst())
+            column = converted;
+
+        Columns parts = column->scatter(NUM_EXTERNAL_BUCKETS, selector);
+        for (size_t b = 0; b < NUM_EXTERNAL_BUCKETS; ++b)
+            bucket_blocks[b].safeGetByPosition(i).column = parts[b];
+    }
+
+    for (size_t b = 0; b < NUM_EXTERNAL_BUCKETS; ++b)
+        if (bucket_blocks[b].rows())
+            buckets[b]->write(bucket_blocks[b]);
+}
+
+Block DistinctBlockInputStream::readFromBuckets()
+{
+    while (current_bucket < NUM_EXTERNAL_BUCKETS)
+    {
+        Bucket & bucket = *buckets[current_bucket];
+
+        if (bucket.rows == 0)
+        {
+            buckets[current_bucket].reset();
+            ++current_bucket;
+            continue;
+        }
+
+        if (!bucket_reader)
+        {
+            bucket_reader = std::make_unique<BucketReader>(bucket.file.path());
+            bucket_data = std::make_unique<SetVariants>();
+            bucket_data->init(data.type);
+        }
+
+        while (Block block = bucket_reader->block_in.read())
+        {
+            const ConstColumnPlainPtrs column_ptrs(getKeyColumns(block));
+            const size_t rows = block.rows();
+            IColumn::Filter filter(rows);
+
+            const size_t old_set_size = bucket_data->getTotalRowCount();
+
+            switch (bucket_data->type)
+            {
+                case SetVariants::Type::EMPTY:
+                    break;
+        #define M(NAME) \
+                case SetVariants::Type::NAME: \
+                    buildFilter(*bucket_data->NAME, column_ptrs, filter, rows, *bucket_data); \
+                    break;
+            APPLY_FOR_SET_VARIANTS(M)
+        #undef M
+            }
+
+            if (bucket_data->getTotalRowCount() == old_set_size)
+                continue;
+
+            size_t all_columns = block.columns();
+            for (size_t i = 0; i < all_columns; ++i)
+                block.safeGetByPosition(i).column = block.safeGetByPosition(i).column->filter(filter, -1);
+
+            emitted_rows += block.rows();
+
+            if (max_rows && emitted_rows > max_rows)
+            {
+                handleOverflow();
+                return Block();
+            }
+
+            return block;
+        }
+
+        /// The bucket is done - its set is freed and its temporary file is removed.
+        bucket_reader.reset();
+        bucket_data.reset();
+        buckets[current_bucket].reset();
+        ++current_bucket;
+    }
+
+    return Block();
+}
+
 template <typename Method>
 void DistinctBlockInputStream::buildFilter(
     Method & method,
@@ -132,6 +364,25 @@ void DistinctBlockInputStream::buildFilter(
     }
 }
 
+template <typename Method>
+void DistinctBlockInputStream::buildFilterFrozen(
+    Method & method,
+    const ConstColumnPlainPtrs & columns,
+    IColumn::Filter & filter,
+    size_t rows) const
+{
+    typename Method::State state;
+    state.init(columns);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        typename Method::Key key = state.getKey(columns, columns.size(), i, key_sizes);
+
+        /// The keys from the frozen set were already emitted; the rest are deduplicated in the buckets.
+        filter[i] = !method.data.has(key);
+    }
+}
+
 ConstColumnPlainPtrs DistinctBlockInputStream::getKeyColumns(const Block & block) const
 {
     size_t columns = columns_names.empty() ? block.columns() : columns_names.size();
@@ -13,12 +13,19 @@ namespace DB
   * To optimize the SELECT DISTINCT ... LIMIT clause we can
   * set limit_hint to non zero value. So we stop emitting new rows after
   * count of already emitted rows will reach the limit_hint.
+  *
+  * If the size of the value set exceeds max_bytes_before_external_distinct, the set is frozen
+  *  and the remaining new rows are scattered by a hash of the key into buckets in temporary files;
+  *  at the end of the stream the buckets are deduplicated one by one, so the memory usage
+  *  is bounded by the threshold plus the size of one bucket.
   */
 class DistinctBlockInputStream : public IProfilingBlockInputStream
 {
 public:
     /// Empty columns_ means all collumns.
-    DistinctBlockInputStream(const BlockInputStreamPtr & input, const Limits & limits, size_t limit_hint_, const Names & columns);
+    DistinctBlockInputStream(const BlockInputStreamPtr & input, const Limits & limits, size_t limit_hint_, const Names & columns,
+        const std::string & tmp_path_ = "");
+    ~DistinctBlockInputStream() override;
 
     String getName() const override { return "Distinct"; }
 
@@ -29,6 +36,7 @@ protected:
 
 private:
     bool checkLimits() const;
+    void handleOverflow() const;
 
     ConstColumnPlainPtrs getKeyColumns(const Block & block) const;
 
@@ -40,16 +48,52 @@ private:
         size_t rows,
         SetVariants & variants) const;
 
+    /// Check belonging to the frozen set without inserting (for the external mode).
+    template <typename Method>
+    void buildFilterFrozen(
+        Method & method,
+        const ConstColumnPlainPtrs & key_columns,
+        IColumn::Filter & filter,
+        size_t rows) const;
+
+    void switchToExternal();
+
+    /// Scatter the rows of the block (with new keys only) into the bucket files.
+    void scatterBlockToBuckets(const Block & block);
+
+    /// Deduplicate and return the next portion of the spilled buckets.
+    Block readFromBuckets();
+
 
     Names columns_names;
     SetVariants data;
     Sizes key_sizes;
     size_t limit_hint;
 
+    size_t emitted_rows = 0;
+
     /// Restrictions on the maximum size of the output data.
     size_t max_rows;
     size_t max_bytes;
     OverflowMode overflow_mode;
+
+    /// Everything below is for the external mode.
+
+    size_t max_bytes_before_external;
+    const std::string tmp_path;
+
+    static constexpr size_t NUM_EXTERNAL_BUCKETS = 64;
+
+    struct Bucket;
+    struct BucketReader;
+
+    bool external = false;            /// The set is frozen and new rows go into the buckets.
+    bool reading_buckets = false;     /// The source is exhausted and the buckets are being returned.
+    std::vector<std::unique_ptr<Bucket>> buckets;
+
+    size_t current_bucket = 0;
+    std::unique_ptr<BucketReader> bucket_reader;
+    std::unique_ptr<SetVariants> bucket_data;    /// The set for deduplication of the current bucket.
 };
 
 }
@@ -0,0 +1,183 @@
+#include <DataStreams/DistinctOrderedLimitBlockInputStream.h>
+#include <Interpreters/sortBlock.h>
+#include <Common/SipHash.h>
+
+namespace DB
+{
+
+DistinctOrderedLimitBlockInputStream::DistinctOrderedLimitBlockInputStream(
+    const BlockInputStreamPtr & input, const SortDescription & description_,
+    const Names & columns_, size_t limit_, bool input_sorted_)
+    : description(description_)
+    , columns_names(columns_)
+    , limit(limit_)
+    , input_sorted(input_sorted_)
+{
+    children.push_back(input);
+}
+
+
+String DistinctOrderedLimitBlockInputStream::getID() const
+{
+    std::stringstream res;
+    res << "DistinctOrderedLimit(" << children.back()->getID();
+
+    for (size_t i = 0; i < description.size(); ++i)
+        res << ", " << description[i].getID();
+
+    res << ", " << limit << ")";
+    return res.str();
+}
+
+
+ConstColumnPlainPtrs DistinctOrderedLimitBlockInputStream::getKeyColumns(const Block & block) const
+{
+    size_t columns = columns_names.empty() ? block.columns() : columns_names.size();
+
+    ConstColumnPlainPtrs column_ptrs;
+    column_ptrs.reserve(columns);
+
+    for (size_t i = 0; i < columns; ++i)
+    {
+        auto & column = columns_names.empty()
+            ? block.safeGetByPosition(i).column
+            : block.getByName(columns_names[i]).column;
+
+        column_ptrs.emplace_back(column.get());
+    }
+
+    return column_ptrs;
+}
+
+
+ConstColumnPlainPtrs DistinctOrderedLimitBlockInputStream::getOrderColumns(const Block & block) const
+{
+    ConstColumnPlainPtrs column_ptrs;
+    column_ptrs.reserve(description.size());
+
+    for (const auto & elem : description)
+        column_ptrs.emplace_back(!elem.column_name.empty()
+            ? block.getByName(elem.column_name).column.get()
+            : block.safeGetByPosition(elem.column_number).column.get());
+
+    return column_ptrs;
+}
+
+
+bool DistinctOrderedLimitBlockInputStream::rowPassesCutoff(const ConstColumnPlainPtrs & order_columns, size_t row) const
+{
+    for (size_t i = 0, size = description.size(); i < size; ++i)
+    {
+        int res = description[i].direction * order_columns[i]->compareAt(row, 0, *cutoff_columns[i], description[i].nulls_direction);
+        if (res != 0)
+            return res < 0;
+    }
+
+    /// Equal to the cutoff - that position is already occupied.
+    return false;
+}
+
+
+void DistinctOrderedLimitBlockInputStream::shrinkBuffer()
+{
+    size_t rows = buffer.rows();
+
+    sortBlock(buffer, description, limit);
+
+    if (rows > limit)
+    {
+        for (size_t i = 0, columns = buffer.columns(); i < columns; ++i)
+        {
+            auto & column = buffer.getByPosition(i).column;
+            column = column->cut(0, limit);
+        }
+        rows = limit;
+
+        /// The filter must reflect only the rows that survived,
+        ///  so that an evicted row showing up again is not mistaken for a duplicate.
+        buffered_keys.clear();
+        const ConstColumnPlainPtrs key_columns(getKeyColumns(buffer));
+        for (size_t i = 0; i < rows; ++i)
+        {
+            SipHash hash;
+            for (const auto * column : key_columns)
+                column->updateHashWithValue(i, hash);
+
+            UInt128 key;
+            hash.get128(key.low, key.high);
+            buffered_keys.insert(key);
+        }
+    }
+
+    if (rows >= limit && limit)
+    {
+        /// Remember the n-th row: later rows that do not precede it cannot enter the result.
+        cutoff_columns.clear();
+        for (const auto * column : getOrderColumns(buffer))
+            cutoff_columns.emplace_back(column->cut(rows - 1, 1));
+    }
+}
+
+
+Block DistinctOrderedLimitBlockInputStream::readImpl()
+{
+    if (executed)
+        return Block();
+    executed = true;
+
+    while (Block block = children.back()->read())
+    {
+        size_t rows = block.rows();
+        size_t columns = block.columns();
+
+        /// The buffer accumulates single rows from different blocks - constants would get in the way.
+        for (size_t i = 0; i < columns; ++i)
+        {
+            auto & column = block.safeGetByPosition(i).column;
+            column = column->convertToFullColumnIfConst();
+        }
+
+        if (!buffer)
+            buffer = block.cloneEmpty();
+
+        const ConstColumnPlainPtrs key_columns(getKeyColumns(block));
+        const ConstColumnPlainPtrs order_columns(getOrderColumns(block));
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            if (!cutoff_columns.empty() && !rowPassesCutoff(order_columns, i))
+                continue;
+
+            SipHash hash;
+            for (const auto * column : key_columns)
+                column->updateHashWithValue(i, hash);
+
+            UInt128 key;
+            hash.get128(key.low, key.high);
+
+            if (!buffered_keys.insert(key).second)
+                continue;
+
+            for (size_t j = 0; j < columns; ++j)
+                buffer.getByPosition(j).column->insertFrom(*block.safeGetByPosition(j).column, i);
+        }
+
+        if (buffer.rows() >= limit * 2)
+            shrinkBuffer();
+
+        /// The input is already in the required order - the first n distinct rows are the answer.
+        if (input_sorted && buffer.rows() >= limit)
+            break;
+    }
+
+    if (!buffer)
+        return Block();
+
+    shrinkBuffer();
+
+    Block res;
+    res.swap(buffer);
+    return res;
+}
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Core/Names.h>
+#include <Core/SortDescription.h>
+#include <Common/UInt128.h>
+#include <Common/HashTable/HashSet.h>
+#include <DataStreams/IProfilingBlockInputStream.h>
+
+namespace DB
+{
+
+/** Fused DISTINCT + ORDER BY + LIMIT n.
+  *
+  * Keeps only the first n distinct rows in the required order: a buffer of at most 2 * n
+  *  candidate rows, periodically sorted and truncated back to n, plus a hash filter with one
+  *  entry per buffered row. Once the buffer has been full, incoming rows that do not precede
+  *  the current n-th row are discarded right away, so the memory usage is O(n) regardless of
+  *  how many distinct values the stream contains - instead of materializing all of them in
+  *  DistinctBlockInputStream and sorting them in MergeSortingBlockInputStream.
+  *
+  * If input_sorted is set (the data already comes in the required order, e.g. it is read in
+  *  the order of the primary key), reading stops as soon as n distinct rows are collected.
+  *
+  * Rows that compare equal in the ORDER BY key compete for the last positions in an
+  *  unspecified way - same as the usual sort + LIMIT pipeline. Collations are not supported
+  *  (the caller must not fuse in that case).
+  */
+class DistinctOrderedLimitBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    /// Empty columns_ means DISTINCT by all columns.
+    /// The ORDER BY columns must be among the DISTINCT columns (ensured by the caller).
+    DistinctOrderedLimitBlockInputStream(const BlockInputStreamPtr & input, const SortDescription & description_,
+        const Names & columns_, size_t limit_, bool input_sorted_);
+
+    String getName() const override { return "DistinctOrderedLimit"; }
+
+    String getID() const override;
+
+    bool isGroupedOutput() const override { return true; }
+    bool isSortedOutput() const override { return true; }
+    const SortDescription & getSortDescription() const override { return description; }
+
+protected:
+    Block readImpl() override;
+
+private:
+    ConstColumnPlainPtrs getKeyColumns(const Block & block) const;
+    ConstColumnPlainPtrs getOrderColumns(const Block & block) const;
+
+    /// Does the row precede the current cutoff (the n-th buffered row) in the required order?
+    bool rowPassesCutoff(const ConstColumnPlainPtrs & order_columns, size_t row) const;
+
+    /// Sort the buffer, truncate it to `limit` rows, rebuild the filter and update the cutoff.
+    void shrinkBuffer();
+
+    SortDescription description;
+    Names columns_names;
+    size_t limit;
+    bool input_sorted;
+
+    bool executed = false;
+
+    /// At most 2 * limit distinct candidate rows; unordered between the shrinks.
+    Block buffer;
+
+    /// 128-bit hashes of the DISTINCT columns of the buffered rows
+    ///  (a collision loses a row - negligible, as in uniqExact).
+    HashSet<UInt128, UInt128TrivialHash> buffered_keys;
+
+    /// One row - the ORDER BY columns of the n-th buffered row, after the buffer has been full.
+    /// Rows that do not precede it can never enter the result.
+    Columns cutoff_columns;
+};
+
+}
@@ -31,15 +31,62 @@ const Block & ExpressionBlockInputStream::getTotals()
     return totals;
 }
 
+/// The number of rows of an execution range: the intermediate columns of a long chain of
+///  actions over this many rows stay in the cache between the actions.
+static constexpr size_t execution_range_rows = 4096;
+
 Block ExpressionBlockInputStream::readImpl()
 {
     Block res = children.back()->read();
     if (!res)
         return res;
 
-    expression->execute(res);
+    if (!split_into_ranges_decided)
+    {
+        split_into_ranges = expression->executableOverRanges();
+        split_into_ranges_decided = true;
+    }
+
+    size_t rows = res.rows();
+
+    if (!split_into_ranges || rows < 2 * execution_range_rows)
+    {
+        expression->execute(res);
+        return res;
+    }
+
+    /** Execute the chain of actions over ranges of the block, so that the intermediate columns of
+      *  one range are still cache-resident when the next action reads them, and emit a block of the
+      *  original size downstream.
+      */
+    Block merged;
+
+    for (size_t offset = 0; offset < rows; offset += execution_range_rows)
+    {
+        size_t length = std::min(execution_range_rows, rows - offset);
+
+        Block range_block;
+        for (size_t i = 0, columns = res.columns(); i < columns; ++i)
+        {
+            ColumnWithTypeAndName elem = res.getByPosition(i);
+            elem.column = elem.column->cut(offset, length);
+            range_block.insert(std::move(elem));
+        }
+
+        expression->execute(range_block);
+
+        if (!merged)
+        {
+            merged = range_block.cloneEmpty();
+            for (size_t i = 0, columns = merged.columns(); i < columns; ++i)
+                merged.getByPosition(i).column->reserve(rows);
+        }
+
+        for (size_t i = 0, columns = merged.columns(); i < columns; ++i)
+            merged.getByPosition(i).column->insertRangeFrom(*range_block.getByPosition(i).column, 0, range_block.rows());
+    }
 
-    return res;
+    return merged;
 }
 
 }
@@ -30,6 +30,11 @@ protected:
 
 private:
     ExpressionActionsPtr expression;
+
+    /// Whether the expression may be executed over row ranges of a block (see `readImpl`).
+    /// Decided once, on the first block.
+    bool split_into_ranges_decided = false;
+    bool split_into_ranges = false;
 };
 
 }
@@ -201,7 +201,7 @@ Block FilterBlockInputStream::readImpl()
         if (first_non_constant_column != static_cast<size_t>(filter_column))
         {
             ColumnWithTypeAndName & current_column = res.safeGetByPosition(first_non_constant_column);
-            current_column.column = current_column.column->filter(filter, -1);
+            filterColumn(current_column.column, filter);
             filtered_rows = current_column.column->size();
         }
         else
@@ -244,7 +244,7 @@ Block FilterBlockInputStream::readImpl()
             if (current_column.column->isConst())
                 current_column.column = current_column.column->cut(0, filtered_rows);
             else
-                current_column.column = current_column.column->filter(filter, -1);
+                filterColumn(current_column.column, filter);
         }
 
         return res;
@@ -15,7 +15,9 @@
 #include <DataStreams/VerticalRowOutputStream.h>
 #include <DataStreams/NullBlockOutputStream.h>
 #include <DataStreams/BlockInputStreamFromRowInputStream.h>
+#include <DataStreams/ParallelParsingBlockInputStream.h>
 #include <DataStreams/BlockOutputStreamFromRowOutputStream.h>
+#include <DataStreams/ParallelFormattingBlockOutputStream.h>
 #include <DataStreams/JSONRowOutputStream.h>
 #include <DataStreams/JSONCompactRowOutputStream.h>
 #include <DataStreams/JSONEachRowRowOutputStream.h>
@@ -52,6 +54,19 @@ BlockInputStreamPtr FormatFactory::getInput(const String & name, ReadBuffer & bu
             settings.input_format_allow_errors_num, settings.input_format_allow_errors_ratio);
     };
 
+    /// For header-less formats where a row boundary can be found without parsing the rows,
+    ///  the input can be split into segments parsed by a pool of threads.
+    auto wrap_parallel = [&](ParallelParsingBlockInputStream::Segmentation segmentation,
+        ParallelParsingBlockInputStream::RowInputCreator && creator) -> BlockInputStreamPtr
+    {
+        if (settings.input_format_parallel_parsing && settings.max_threads > 1)
+            return std::make_shared<ParallelParsingBlockInputStream>(buf, std::move(creator), sample, max_block_size,
+                settings.input_format_allow_errors_num, settings.input_format_allow_errors_ratio,
+                segmentation, settings.max_threads);
+
+        return wrap_row_stream(creator(buf));
+    };
+
     if (name == "Native")
     {
         return std::make_shared<NativeBlockInputStream>(buf);
@@ -62,7 +77,8 @@ BlockInputStreamPtr FormatFactory::getInput(const String & name, ReadBuffer & bu
     }
     else if (name == "TabSeparated" || name == "TSV") /// TSV is a synonym/alias for the original TabSeparated format
     {
-        return wrap_row_stream(std::make_shared<TabSeparatedRowInputStream>(buf, sample));
+        return wrap_parallel(ParallelParsingBlockInputStream::Segmentation::Newline,
+            [sample](ReadBuffer & in) -> RowInputStreamPtr { return std::make_shared<TabSeparatedRowInputStream>(in, sample); });
     }
     else if (name == "TabSeparatedWithNames" || name == "TSVWithNames")
     {
@@ -78,7 +94,8 @@ BlockInputStreamPtr FormatFactory::getInput(const String & name, ReadBuffer & bu
     }
     else if (name == "CSV")
     {
-        return wrap_row_stream(std::make_shared<CSVRowInputStream>(buf, sample, ','));
+        return wrap_parallel(ParallelParsingBlockInputStream::Segmentation::CSV,
+            [sample](ReadBuffer & in) -> RowInputStreamPtr { return std::make_shared<CSVRowInputStream>(in, sample, ','); });
     }
     else if (name == "CSVWithNames")
     {
@@ -86,11 +103,19 @@ BlockInputStreamPtr FormatFactory::getInput(const String & name, ReadBuffer & bu
     }
     else if (name == "TSKV")
     {
-        return wrap_row_stream(std::make_shared<TSKVRowInputStream>(buf, sample, settings.input_format_skip_unknown_fields));
+        return wrap_parallel(ParallelParsingBlockInputStream::Segmentation::Newline,
+            [sample, skip_unknown = bool(settings.input_format_skip_unknown_fields)](ReadBuffer & in) -> RowInputStreamPtr
+            {
+                return std::make_shared<TSKVRowInputStream>(in, sample, skip_unknown);
+            });
     }
     else if (name == "JSONEachRow")
     {
-        return wrap_row_stream(std::make_shared<JSONEachRowRowInputStream>(buf, sample, settings.input_format_skip_unknown_fields));
+        return wrap_parallel(ParallelParsingBlockInputStream::Segmentation::JSON,
+            [sample, skip_unknown = bool(settings.input_format_skip_unknown_fields)](ReadBuffer & in) -> RowInputStreamPtr
+            {
+                return std::make_shared<JSONEachRowRowInputStream>(in, sample, skip_unknown);
+            });
     }
     else if (name == "TabSeparatedRaw"
         || name == "TSVRaw"
@@ -123,24 +148,34 @@ static BlockOutputStreamPtr getOutputImpl(const String & name, WriteBuffer & buf
     const Settings & settings = context.getSettingsRef();
     FormatSettingsJSON json_settings(settings.output_format_json_quote_64bit_integers, settings.output_format_json_quote_denormals);
 
+    /// For formats where rows are self-delimited and independent of each other,
+    ///  the blocks can be rendered to memory buffers by a pool of threads.
+    auto wrap_parallel = [&](ParallelFormattingBlockOutputStream::RowOutputCreator && creator) -> BlockOutputStreamPtr
+    {
+        if (settings.output_format_parallel_formatting && settings.max_threads > 1)
+            return std::make_shared<ParallelFormattingBlockOutputStream>(buf, std::move(creator), settings.max_threads);
+
+        return std::make_shared<BlockOutputStreamFromRowOutputStream>(creator(buf));
+    };
+
     if (name == "Native")
         return std::make_shared<NativeBlockOutputStream>(buf);
     else if (name == "RowBinary")
         return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<BinaryRowOutputStream>(buf));
     else if (name == "TabSeparated" || name == "TSV")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<TabSeparatedRowOutputStream>(buf, sample));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<TabSeparatedRowOutputStream>(out, sample); });
     else if (name == "TabSeparatedWithNames" || name == "TSVWithNames")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<TabSeparatedRowOutputStream>(buf, sample, true));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<TabSeparatedRowOutputStream>(out, sample, true); });
     else if (name == "TabSeparatedWithNamesAndTypes" || name == "TSVWithNamesAndTypes")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<TabSeparatedRowOutputStream>(buf, sample, true, true));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<TabSeparatedRowOutputStream>(out, sample, true, true); });
     else if (name == "TabSeparatedRaw" || name == "TSVRaw")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<TabSeparatedRawRowOutputStream>(buf, sample));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<TabSeparatedRawRowOutputStream>(out, sample); });
     else if (name == "BlockTabSeparated")
         return std::make_shared<TabSeparatedBlockOutputStream>(buf);
     else if (name == "CSV")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<CSVRowOutputStream>(buf, sample));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<CSVRowOutputStream>(out, sample); });
     else if (name == "CSVWithNames")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<CSVRowOutputStream>(buf, sample, true));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<CSVRowOutputStream>(out, sample, true); });
     else if (name == "Pretty")
         return std::make_shared<PrettyBlockOutputStream>(buf, false, settings.output_format_pretty_max_rows, context);
     else if (name == "PrettyCompact")
@@ -175,13 +210,15 @@ static BlockOutputStreamPtr getOutputImpl(const String & name, WriteBuffer & buf
         return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<JSONCompactRowOutputStream>(
             buf, sample, settings.output_format_write_statistics, json_settings));
     else if (name == "JSONEachRow")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<JSONEachRowRowOutputStream>(
-            buf, sample, json_settings));
+        return wrap_parallel([sample, json_settings](WriteBuffer & out) -> RowOutputStreamPtr
+        {
+            return std::make_shared<JSONEachRowRowOutputStream>(out, sample, json_settings);
+        });
     else if (name == "XML")
         return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<XMLRowOutputStream>(buf, sample,
             settings.output_format_write_statistics));
     else if (name == "TSKV")
-        return std::make_shared<BlockOutputStreamFromRowOutputStream>(std::make_shared<TSKVRowOutputStream>(buf, sample));
+        return wrap_parallel([sample](WriteBuffer & out) -> RowOutputStreamPtr { return std::make_shared<TSKVRowOutputStream>(out, sample); });
     else if (name == "ODBCDriver")
         return std::make_shared<ODBCDriverBlockOutputStream>(buf, sample);
     else if (name == "Null")
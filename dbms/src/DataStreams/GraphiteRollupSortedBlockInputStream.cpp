@@ -1,4 +1,5 @@
 #include <DataStreams/GraphiteRollupSortedBlockInputStream.h>
+#include <algorithm>
 #include <type_traits>
 
 
@@ -11,8 +12,51 @@ namespace ErrorCodes
 }
 
 
+void GraphiteRollupSortedBlockInputStream::buildPatternMatcher()
+{
+    first_pattern_without_regexp = params.patterns.size();
+
+    /// Defaults match the options OptimizedRegularExpression compiles the patterns with.
+    re2::RE2::Options options;
+    auto set = std::make_unique<re2::RE2::Set>(options, re2::RE2::UNANCHORED);
+
+    for (size_t i = 0; i < params.patterns.size(); ++i)
+    {
+        const auto & pattern = params.patterns[i];
+
+        if (!pattern.regexp)
+        {
+            first_pattern_without_regexp = i;
+            break;
+        }
+
+        std::string error;
+        if (set->Add(re2::StringPiece(pattern.regexp_str), &error) < 0)
+            return;    /// Keep the sequential fallback.
+
+        matcher_pattern_indices.push_back(i);
+    }
+
+    if (!matcher_pattern_indices.empty() && set->Compile())
+        matcher = std::move(set);
+}
+
+
 const Graphite::Pattern * GraphiteRollupSortedBlockInputStream::selectPatternForPath(StringRef path) const
 {
+    if (matcher)
+    {
+        /// The first pattern in the config wins, so of all matches the minimal index is taken.
+        std::vector<int> matches;
+        if (matcher->Match(re2::StringPiece(path.data, path.size), &matches))
+            return &params.patterns[matcher_pattern_indices[*std::min_element(matches.begin(), matches.end())]];
+
+        if (first_pattern_without_regexp < params.patterns.size())
+            return &params.patterns[first_pattern_without_regexp];
+
+        return nullptr;
+    }
+
     for (const auto & pattern : params.patterns)
         if (!pattern.regexp || pattern.regexp->match(path.data, path.size))
             return &pattern;
@@ -9,6 +9,8 @@
 #include <Columns/ColumnAggregateFunction.h>
 #include <Common/OptimizedRegularExpression.h>
 
+#include <re2/set.h>
+
 
 namespace DB
 {
@@ -95,6 +97,7 @@ namespace Graphite
     struct Pattern
     {
         std::shared_ptr<OptimizedRegularExpression> regexp;
+        String regexp_str;    /// Source of the regexp - to build the combined matcher.
         AggregateFunctionPtr function;
         Retentions retentions;    /// Must be ordered by 'age' descending.
     };
@@ -131,6 +134,7 @@ public:
         : MergingSortedBlockInputStream(inputs_, description_, max_block_size_),
         params(params), time_of_merge(time_of_merge)
     {
+        buildPatternMatcher();
     }
 
     String getName() const override { return "GraphiteRollupSorted"; }
@@ -166,6 +170,20 @@ private:
 
     const Graphite::Params params;
 
+    /** Combined matcher over all patterns with a regexp: a single automaton pass per path
+      *  instead of trying every regexp in turn. Built once per merge.
+      * nullptr if it could not be built - then patterns are tried sequentially.
+      */
+    std::unique_ptr<re2::RE2::Set> matcher;
+
+    /// Pattern index for each regexp added to the matcher.
+    std::vector<size_t> matcher_pattern_indices;
+
+    /// Index of the first pattern without a regexp - it matches everything, so patterns after it can never win.
+    size_t first_pattern_without_regexp = 0;
+
+    void buildPatternMatcher();
+
     size_t path_column_num;
     size_t time_column_num;
     size_t value_column_num;
@@ -1,5 +1,7 @@
 #include <math.h>
 
+#include <Common/formatReadable.h>
+
 #include <DataStreams/IProfilingBlockInputStream.h>
 #include <DataStreams/IBlockInputStream.h>
 
@@ -96,6 +98,27 @@ void IBlockInputStream::dumpTree(std::ostream & ostr, size_t indent, size_t mult
 }
 
 
+void IBlockInputStream::dumpPeakMemoryUsage(std::ostream & ostr, size_t indent)
+{
+    /// We will not display the wrapper of the block stream in the AsynchronousBlockInputStream in the tree.
+    if (getName() != "Asynchronous")
+    {
+        ostr << String(indent, ' ') << getName();
+
+        if (auto * profiling = dynamic_cast<IProfilingBlockInputStream *>(this))
+            if (Int64 peak = profiling->getProfileInfo().peak_memory_usage)
+                ostr << ": " << formatReadableSizeWithBinarySuffix(peak);
+
+        ostr << std::endl;
+        ++indent;
+    }
+
+    /// Unlike dumpTree, repeated subtrees are not collapsed: their peaks differ.
+    for (BlockInputStreams::iterator it = children.begin(); it != children.end(); ++it)
+        (*it)->dumpPeakMemoryUsage(ostr, indent);
+}
+
+
 BlockInputStreams IBlockInputStream::getLeaves()
 {
     BlockInputStreams res;
@@ -95,6 +95,12 @@ public:
 
     void dumpTree(std::ostream & ostr, size_t indent = 0, size_t multiplier = 1);
 
+    /** Output the tree with the peak amount of memory held by each stream while it was
+      *  producing blocks (see BlockStreamProfileInfo::peak_memory_usage).
+      * Makes sense after the execution has finished.
+      */
+    void dumpPeakMemoryUsage(std::ostream & ostr, size_t indent = 0);
+
     /// Get leaf sources (not including this one).
     BlockInputStreams getLeaves();
 
@@ -1,6 +1,8 @@
 #include <iomanip>
 #include <random>
 
+#include <ext/scope_guard.h>
+
 #include <Interpreters/Quota.h>
 #include <Interpreters/ProcessList.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
@@ -21,8 +23,21 @@ namespace ErrorCodes
 IProfilingBlockInputStream::IProfilingBlockInputStream()
 {
     info.parent = this;
+
+    /// The peaks are reported through the profile info; a log message per stream would be a flood.
+    memory_tracker.setLogPeakInDestructor(false);
 }
 
+
+/** The cadence of the batched checks (see `read`): flush the locally accumulated progress
+  *  and check the limits and quotas after this many rows or after this much time,
+  *  whichever comes first. The time bound keeps KILL QUERY and the speed limits responsive
+  *  even on sources producing tiny blocks slowly.
+  */
+static constexpr size_t checks_batch_rows = 8192;
+static constexpr UInt64 checks_batch_period_ns = 100000000;    /// 100 ms.
+
+
 Block IProfilingBlockInputStream::read()
 {
     collectAndSendTotalRowsApprox();
@@ -39,8 +54,25 @@ Block IProfilingBlockInputStream::read()
         return res;
 
     if (!limit_exceeded_need_break)
+    {
+        /** Account the allocations made while producing the block to this stream, so that
+          *  the per-stage peaks are visible in the profile info. Through `next` everything
+          *  is still passed to the tracker that was active (ultimately - of the query),
+          *  so the totals and the memory limits are not affected.
+          */
+        MemoryTracker * prev_memory_tracker = current_memory_tracker;
+        if (prev_memory_tracker && prev_memory_tracker != &memory_tracker)
+        {
+            memory_tracker.setNext(prev_memory_tracker);
+            current_memory_tracker = &memory_tracker;
+        }
+        SCOPE_EXIT({ current_memory_tracker = prev_memory_tracker; });
+
         res = readImpl();
 
+        info.peak_memory_usage = memory_tracker.getPeak();
+    }
+
     if (res)
     {
         info.update(res);
@@ -48,11 +80,8 @@ Block IProfilingBlockInputStream::read()
         if (enabled_extremes)
             updateExtremes(res);
 
-        if (!checkLimits())
-            limit_exceeded_need_break = true;
-
-        if (quota != nullptr)
-            checkQuota(res);
+        unreported_rows += res.rows();
+        unreported_bytes += res.bytes();
     }
     else
     {
@@ -65,7 +94,36 @@ Block IProfilingBlockInputStream::read()
         cancel();
     }
 
-    progress(Progress(res.rows(), res.bytes()));
+    /** The limit and quota checks and the progress updates touch counters in the ProcessList
+      *  shared by all the streams of the query, so on short blocks doing them per block turns
+      *  into cache line ping-pong between the threads. Batch them: accumulate locally and
+      *  only go to the shared state every `checks_batch_rows` rows or `checks_batch_period_ns`.
+      */
+    UInt64 elapsed_ns = info.total_stopwatch.elapsed();
+
+    if (!res
+        || unreported_rows >= checks_batch_rows
+        || elapsed_ns - last_checks_time_ns >= checks_batch_period_ns)
+    {
+        last_checks_time_ns = elapsed_ns;
+
+        if (res)
+        {
+            if (!checkLimits())
+                limit_exceeded_need_break = true;
+
+            if (quota != nullptr)
+                checkQuota(unreported_rows, unreported_bytes);
+        }
+
+        progress(Progress(unreported_rows, unreported_bytes));
+        unreported_rows = 0;
+        unreported_bytes = 0;
+
+        /// Also fold the profile event deltas of this thread into the global counters
+        ///  and into the per-query block (for attribution in the query log).
+        ProfileEvents::updateCounters(process_list_elem ? &process_list_elem->profile_counters : nullptr);
+    }
 
     return res;
 }
@@ -82,6 +140,17 @@ void IProfilingBlockInputStream::readPrefix()
 
 void IProfilingBlockInputStream::readSuffix()
 {
+    /// The consumer may stop before the source is exhausted (e.g. because of LIMIT)
+    ///  - report what has accumulated since the last batched check, so the query statistics are exact.
+    if (unreported_rows || unreported_bytes)
+    {
+        progress(Progress(unreported_rows, unreported_bytes));
+        unreported_rows = 0;
+        unreported_bytes = 0;
+    }
+
+    ProfileEvents::updateCounters(process_list_elem ? &process_list_elem->profile_counters : nullptr);
+
     for (auto & child : children)
         child->readSuffix();
 
@@ -185,7 +254,7 @@ bool IProfilingBlockInputStream::checkLimits()
 }
 
 
-void IProfilingBlockInputStream::checkQuota(Block & block)
+void IProfilingBlockInputStream::checkQuota(size_t rows, size_t bytes)
 {
     switch (limits.mode)
     {
@@ -198,7 +267,7 @@ void IProfilingBlockInputStream::checkQuota(Block & block)
             time_t current_time = time(nullptr);
             double total_elapsed = info.total_stopwatch.elapsedSeconds();
 
-            quota->checkAndAddResultRowsBytes(current_time, block.rows(), block.bytes());
+            quota->checkAndAddResultRowsBytes(current_time, rows, bytes);
             quota->checkAndAddExecutionTime(current_time, Poco::Timespan((total_elapsed - prev_elapsed) * 1000000.0));
 
             prev_elapsed = total_elapsed;
@@ -211,6 +280,30 @@ void IProfilingBlockInputStream::checkQuota(Block & block)
 }
 
 
+/** CPU time consumed by the calling thread since the previous call for the same query.
+  * A pool thread serves different queries over time and the thread CPU clock only moves forward,
+  *  so remember which query was accounted last and don't charge one query the work of another.
+  */
+static UInt64 getThreadCPUTimeDeltaNanoseconds(const ProcessListElement * elem)
+{
+    struct timespec ts;
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+        return 0;
+
+    UInt64 current_ns = UInt64(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+
+    static thread_local const ProcessListElement * prev_elem = nullptr;
+    static thread_local UInt64 prev_ns = 0;
+
+    UInt64 delta = (elem == prev_elem && current_ns > prev_ns) ? current_ns - prev_ns : 0;
+
+    prev_elem = elem;
+    prev_ns = current_ns;
+
+    return delta;
+}
+
+
 void IProfilingBlockInputStream::progressImpl(const Progress & value)
 {
     if (progress_callback)
@@ -301,6 +394,16 @@ void IProfilingBlockInputStream::progressImpl(const Progress & value)
         {
             quota->checkAndAddReadRowsBytes(time(0), value.rows, value.bytes);
         }
+
+        /// Scheduler-enforced resource shares: sleep if the query (or all queries of the user) got ahead
+        ///  of its read or CPU budget (see the max_read_bandwidth, max_cpu_usage_percent settings).
+
+        if (process_list_elem->read_throttler && value.bytes)
+            process_list_elem->read_throttler->add(value.bytes);
+
+        if (process_list_elem->cpu_throttler)
+            if (UInt64 cpu_ns = getThreadCPUTimeDeltaNanoseconds(process_list_elem))
+                process_list_elem->cpu_throttler->add(cpu_ns);
     }
 }
 
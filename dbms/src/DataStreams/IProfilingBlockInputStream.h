@@ -4,6 +4,8 @@
 
 #include <Interpreters/Limits.h>
 
+#include <Common/MemoryTracker.h>
+
 #include <DataStreams/BlockStreamProfileInfo.h>
 #include <DataStreams/IBlockInputStream.h>
 
@@ -64,7 +66,7 @@ public:
 
     /** Set the execution progress bar callback.
       * The callback is passed to all child sources.
-      * By default, it is called for leaf sources, after each block.
+      * By default, it is called for leaf sources, after each batch of blocks (see `read`).
       * (But this can be overridden in the progress() method)
       * The function takes the number of rows in the last block, the number of bytes in the last block.
       * Note that the callback can be called from different threads.
@@ -184,6 +186,10 @@ protected:
     size_t total_rows_approx = 0;
 
 private:
+    /// Accounts the allocations made while this stream produces blocks; the peak is
+    ///  reported in `info` (see `read`). Chained via `next` to the tracker of the query.
+    MemoryTracker memory_tracker;
+
     bool enabled_extremes = false;
 
     /// Information about the approximate total number of rows is collected in the parent source.
@@ -199,6 +205,12 @@ private:
     QuotaForIntervals * quota = nullptr;    /// If nullptr - the quota is not used.
     double prev_elapsed = 0;
 
+    /// Rows and bytes accumulated since the last batched check in `read`, not yet reported to `progress`.
+    size_t unreported_rows = 0;
+    size_t unreported_bytes = 0;
+    /// When the last batched check was done, by `info.total_stopwatch`.
+    UInt64 last_checks_time_ns = 0;
+
     /// The successors must implement this function.
     virtual Block readImpl() = 0;
 
@@ -214,7 +226,7 @@ private:
       * But only those that can be tested within each separate source.
       */
     bool checkLimits();
-    void checkQuota(Block & block);
+    void checkQuota(size_t rows, size_t bytes);
 
     /// Gather information about the approximate total number of rows from all children.
     void collectTotalRowsApprox();
@@ -13,18 +13,23 @@ JSONEachRowRowOutputStream::JSONEachRowRowOutputStream(WriteBuffer & ostr_, cons
     size_t columns = sample.columns();
     fields.resize(columns);
 
+    /// The field delimiter and the colon are folded into the prepared fragments,
+    ///  so a whole ",\"name\":" is written with a single copy per field.
     for (size_t i = 0; i < columns; ++i)
     {
         WriteBufferFromString out(fields[i]);
+        if (i != 0)
+            writeChar(',', out);
         writeJSONString(sample.getByPosition(i).name, out);
+        writeChar(':', out);
     }
 }
 
 
 void JSONEachRowRowOutputStream::writeField(const IColumn & column, const IDataType & type, size_t row_num)
 {
-    writeString(fields[field_number], ostr);
-    writeChar(':', ostr);
+    const String & field = fields[field_number];
+    ostr.write(field.data(), field.size());
     type.serializeTextJSON(column, row_num, ostr, settings);
     ++field_number;
 }
@@ -32,7 +37,7 @@ void JSONEachRowRowOutputStream::writeField(const IColumn & column, const IDataT
 
 void JSONEachRowRowOutputStream::writeFieldDelimiter()
 {
-    writeChar(',', ostr);
+    /// Already folded into the prepared field fragments (see the constructor).
 }
 
 
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <DataStreams/IProfilingBlockInputStream.h>
+#include <Core/SortDescription.h>
+#include <Core/FieldVisitors.h>
+
+
+namespace DB
+{
+
+/** Leaves only the rows whose values of the columns from `description` fall into the
+  *  half-interval [lower, upper) in the order given by `description` (lexicographic,
+  *  respecting the direction of each column). An empty bound means "unbounded".
+  * Used to split a FINAL merge or an external sort merge into independent disjoint key ranges:
+  *  rows with equal keys always fall into the same half-interval, so each range can be merged separately.
+  */
+class KeyRangeFilterBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    KeyRangeFilterBlockInputStream(
+        const BlockInputStreamPtr & input,
+        const SortDescription & description_,
+        const std::vector<Field> & lower_,
+        const std::vector<Field> & upper_)
+        : description(description_), lower(lower_), upper(upper_)
+    {
+        children.push_back(input);
+    }
+
+    String getName() const override { return "KeyRangeFilter"; }
+
+    String getID() const override
+    {
+        std::stringstream res;
+        res << "KeyRangeFilter(" << children.back()->getID();
+
+        for (size_t i = 0; i < description.size(); ++i)
+            res << ", " << description[i].getID();
+
+        res << ", lower";
+        for (const Field & field : lower)
+            res << ", " << applyVisitor(FieldVisitorToString(), field);
+        res << ", upper";
+        for (const Field & field : upper)
+            res << ", " << applyVisitor(FieldVisitorToString(), field);
+
+        res << ")";
+        return res.str();
+    }
+
+protected:
+    Block readImpl() override
+    {
+        while (Block block = children.back()->read())
+        {
+            size_t rows = block.rows();
+            if (!rows)
+                continue;
+
+            ConstColumnPlainPtrs key_columns(description.size());
+            Columns lower_columns(description.size());
+            Columns upper_columns(description.size());
+
+            for (size_t i = 0; i < description.size(); ++i)
+            {
+                size_t column_number = !description[i].column_name.empty()
+                    ? block.getPositionByName(description[i].column_name)
+                    : description[i].column_number;
+
+                key_columns[i] = block.safeGetByPosition(column_number).column.get();
+
+                /// One-row columns with the bound values, to compare with IColumn::compareAt.
+                if (!lower.empty())
+                {
+                    lower_columns[i] = key_columns[i]->cloneEmpty();
+                    lower_columns[i]->insert(lower[i]);
+                }
+                if (!upper.empty())
+                {
+                    upper_columns[i] = key_columns[i]->cloneEmpty();
+                    upper_columns[i]->insert(upper[i]);
+                }
+            }
+
+            auto compare_with_bound = [&](size_t row, const Columns & bound_columns)
+            {
+                for (size_t i = 0; i < key_columns.size(); ++i)
+                    if (int res = description[i].direction
+                        * key_columns[i]->compareAt(row, 0, *bound_columns[i], description[i].nulls_direction))
+                        return res;
+                return 0;
+            };
+
+            IColumn::Filter filter(rows);
+            size_t passed = 0;
+
+            for (size_t row = 0; row < rows; ++row)
+            {
+                bool fits = (lower.empty() || compare_with_bound(row, lower_columns) >= 0)
+                    && (upper.empty() || compare_with_bound(row, upper_columns) < 0);
+
+                filter[row] = fits;
+                passed += fits;
+            }
+
+            if (passed == rows)
+                return block;
+
+            if (!passed)
+                continue;
+
+            for (size_t i = 0; i < block.columns(); ++i)
+            {
+                ColumnWithTypeAndName & column = block.safeGetByPosition(i);
+                column.column = column.column->filter(filter, passed);
+            }
+
+            return block;
+        }
+
+        return {};
+    }
+
+private:
+    SortDescription description;
+    std::vector<Field> lower;
+    std::vector<Field> upper;
+};
+
+}
@@ -1,4 +1,7 @@
 #include <DataStreams/LimitByBlockInputStream.h>
+#include <Interpreters/AggregationCommon.h>
+#include <Columns/ColumnsNumber.h>
+#include <Common/typeid_cast.h>
 
 namespace DB
 {
@@ -10,6 +13,58 @@ LimitByBlockInputStream::LimitByBlockInputStream(const BlockInputStreamPtr & inp
     children.push_back(input);
 }
 
+/// The raw bit pattern of the value; a uniform key for integers and floats alike.
+template <typename T>
+static inline UInt64 keyOf(T x)
+{
+    union
+    {
+        T in;
+        UInt64 out;
+    } u {};
+    u.out = 0;
+    u.in = x;
+    return u.out;
+}
+
+template <typename T>
+bool LimitByBlockInputStream::processNumericColumn(const IColumn & column, IColumn::Filter & filter, size_t & inserted_count)
+{
+    const ColumnVector<T> * concrete = typeid_cast<const ColumnVector<T> *>(&column);
+    if (!concrete)
+        return false;
+
+    const typename ColumnVector<T>::Container_t & data = concrete->getData();
+    size_t rows = data.size();
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (keys_counts_64[keyOf(data[i])]++ < group_size)
+        {
+            ++inserted_count;
+            filter[i] = 1;
+        }
+        else
+            filter[i] = 0;
+    }
+
+    return true;
+}
+
+bool LimitByBlockInputStream::processSingleNumericColumn(const IColumn & column, IColumn::Filter & filter, size_t & inserted_count)
+{
+    return processNumericColumn<UInt8>(column, filter, inserted_count)
+        || processNumericColumn<UInt16>(column, filter, inserted_count)
+        || processNumericColumn<UInt32>(column, filter, inserted_count)
+        || processNumericColumn<UInt64>(column, filter, inserted_count)
+        || processNumericColumn<Int8>(column, filter, inserted_count)
+        || processNumericColumn<Int16>(column, filter, inserted_count)
+        || processNumericColumn<Int32>(column, filter, inserted_count)
+        || processNumericColumn<Int64>(column, filter, inserted_count)
+        || processNumericColumn<Float32>(column, filter, inserted_count)
+        || processNumericColumn<Float64>(column, filter, inserted_count);
+}
+
 Block LimitByBlockInputStream::readImpl()
 {
     /// Execute until end of stream or until
@@ -25,23 +80,33 @@ Block LimitByBlockInputStream::readImpl()
         IColumn::Filter filter(rows);
         size_t inserted_count = 0;
 
-        for (size_t i = 0; i < rows; ++i)
+        /// A single numeric key is counted by its value: hashing every row with SipHash
+        ///  and probing a 128-bit map is several times more expensive.
+        bool processed = false;
+        if (keys_kind != KeysKind::Hashed && column_ptrs.size() == 1)
         {
-            UInt128 key;
-            SipHash hash;
-
-            for (auto & column : column_ptrs)
-                column->updateHashWithValue(i, hash);
+            processed = processSingleNumericColumn(*column_ptrs[0], filter, inserted_count);
+            if (processed)
+                keys_kind = KeysKind::SingleNumeric;
+        }
 
-            hash.get128(key.low, key.high);
+        if (!processed)
+        {
+            if (keys_kind == KeysKind::Unknown)
+                keys_kind = KeysKind::Hashed;
 
-            if (keys_counts[key]++ < group_size)
+            for (size_t i = 0; i < rows; ++i)
             {
-                inserted_count++;
-                filter[i] = 1;
+                UInt128 key = hash128(i, column_ptrs.size(), column_ptrs);
+
+                if (keys_counts[key]++ < group_size)
+                {
+                    ++inserted_count;
+                    filter[i] = 1;
+                }
+                else
+                    filter[i] = 0;
             }
-            else
-                filter[i] = 0;
         }
 
         /// Just go to the next block if there isn't any new records in the current one.
@@ -28,12 +28,31 @@ protected:
 private:
     ConstColumnPlainPtrs getKeyColumns(Block & block) const;
 
+    /// The typed path for the common case of a single numeric key column (LIMIT N BY site_id):
+    ///  the raw 64-bit value is the map key, no hashing of every row.
+    bool processSingleNumericColumn(const IColumn & column, IColumn::Filter & filter, size_t & inserted_count);
+
+    template <typename T>
+    bool processNumericColumn(const IColumn & column, IColumn::Filter & filter, size_t & inserted_count);
+
 private:
     using MapHashed = HashMap<UInt128, UInt64, UInt128TrivialHash>;
+    using MapUInt64 = HashMap<UInt64, UInt64, HashCRC32<UInt64>>;
 
     const Names columns_names;
     const size_t group_size;
     MapHashed keys_counts;
+    MapUInt64 keys_counts_64;
+
+    /// Which of the maps is used. Decided on the first block and kept, so that all blocks
+    ///  of the stream count their groups in the same map.
+    enum class KeysKind : UInt8
+    {
+        Unknown,
+        SingleNumeric,
+        Hashed,
+    };
+    KeysKind keys_kind = KeysKind::Unknown;
 };
 
 }
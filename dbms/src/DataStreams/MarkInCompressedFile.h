@@ -36,4 +36,77 @@ struct MarkInCompressedFile
 
 using MarksInCompressedFile = PODArray<MarkInCompressedFile>;
 
+
+/** Marks of one file in the form they are kept in the mark cache.
+  *
+  * On disk each mark is a pair of raw UInt64s, but the offsets in the compressed file grow
+  *  monotonically, so in memory the marks are frame-of-reference encoded: for every frame of
+  *  `marks_per_frame` marks only the base offset is stored in full, and each mark keeps a
+  *  32-bit offset relative to that base together with the 32-bit offset in the decompressed
+  *  block. This halves the memory per mark, so twice as many marks stay resident in a cache
+  *  of the same size.
+  *
+  * In the unlikely case when the offsets do not fit (a frame spanning 4 GiB or more of
+  *  compressed data), the marks of the file are kept as is.
+  */
+class CompactMarksInCompressedFile
+{
+public:
+    CompactMarksInCompressedFile() = default;
+
+    explicit CompactMarksInCompressedFile(const MarksInCompressedFile & marks)
+    {
+        frame_bases.reserve((marks.size() + marks_per_frame - 1) / marks_per_frame);
+        packed.reserve(marks.size());
+
+        for (size_t i = 0; i < marks.size(); ++i)
+        {
+            if (i % marks_per_frame == 0)
+                frame_bases.push_back(marks[i].offset_in_compressed_file);
+
+            size_t offset_rel = marks[i].offset_in_compressed_file - frame_bases.back();
+            size_t offset_in_decompressed_block = marks[i].offset_in_decompressed_block;
+
+            if (offset_rel >= (1ULL << 32) || offset_in_decompressed_block >= (1ULL << 32))
+            {
+                frame_bases.clear();
+                packed.clear();
+                plain.assign(marks.begin(), marks.end());
+                return;
+            }
+
+            packed.push_back(offset_rel << 32 | offset_in_decompressed_block);
+        }
+    }
+
+    size_t size() const
+    {
+        return plain.empty() ? packed.size() : plain.size();
+    }
+
+    MarkInCompressedFile operator[](size_t index) const
+    {
+        if (!plain.empty())
+            return plain[index];
+
+        UInt64 value = packed[index];
+        return { frame_bases[index / marks_per_frame] + (value >> 32), value & 0xFFFFFFFFULL };
+    }
+
+    size_t allocatedBytes() const
+    {
+        return frame_bases.allocated_bytes() + packed.allocated_bytes() + plain.allocated_bytes();
+    }
+
+private:
+    static constexpr size_t marks_per_frame = 64;
+
+    /// Offset in the compressed file of the first mark of each frame.
+    PODArray<UInt64> frame_bases;
+    /// Per mark: (offset relative to the frame base) << 32 | offset in the decompressed block.
+    PODArray<UInt64> packed;
+    /// Non-empty only when the compact representation cannot be used.
+    MarksInCompressedFile plain;
+};
+
 }
@@ -1,9 +1,13 @@
 #include <DataStreams/MergeSortingBlockInputStream.h>
 #include <DataStreams/MergingSortedBlockInputStream.h>
 #include <DataStreams/NativeBlockOutputStream.h>
+#include <DataStreams/KeyRangeFilterBlockInputStream.h>
+#include <DataStreams/ConcatBlockInputStream.h>
 #include <DataStreams/copyData.h>
+#include <Interpreters/sortBlock.h>
 #include <IO/WriteBufferFromFile.h>
 #include <IO/CompressedWriteBuffer.h>
+#include <common/ThreadPool.h>
 
 
 namespace ProfileEvents
@@ -63,6 +67,14 @@ static void enrichBlockWithConstants(Block & block, const Block & sample_block)
 }
 
 
+static const ColumnWithTypeAndName & columnWithSortDescription(const Block & block, const SortColumnDescription & description)
+{
+    return !description.column_name.empty()
+        ? block.getByName(description.column_name)
+        : block.safeGetByPosition(description.column_number);
+}
+
+
 Block MergeSortingBlockInputStream::readImpl()
 {
     /** Algorithm:
@@ -98,22 +110,7 @@ Block MergeSortingBlockInputStream::readImpl()
               * NOTE. It's possible to check free space in filesystem.
               */
             if (max_bytes_before_external_sort && sum_bytes_in_blocks > max_bytes_before_external_sort)
-            {
-                temporary_files.emplace_back(new Poco::TemporaryFile(tmp_path));
-                const std::string & path = temporary_files.back()->path();
-                WriteBufferFromFile file_buf(path);
-                CompressedWriteBuffer compressed_buf(file_buf);
-                NativeBlockOutputStream block_out(compressed_buf);
-                MergeSortingBlocksBlockInputStream block_in(blocks, description, max_merged_block_size, limit);
-
-                LOG_INFO(log, "Sorting and writing part of data into temporary file " + path);
-                ProfileEvents::increment(ProfileEvents::ExternalSortWritePart);
-                copyData(block_in, block_out, &is_cancelled);    /// NOTE. Possibly limit disk usage.
-                LOG_INFO(log, "Done writing part of data into temporary file " + path);
-
-                blocks.clear();
-                sum_bytes_in_blocks = 0;
-            }
+                writeBlocksToTemporaryFile();
         }
 
         if ((blocks.empty() && temporary_files.empty()) || isCancelled())
@@ -128,21 +125,31 @@ Block MergeSortingBlockInputStream::readImpl()
             /// If there was temporary files.
             ProfileEvents::increment(ProfileEvents::ExternalSortMerge);
 
-            LOG_INFO(log, "There are " << temporary_files.size() << " temporary sorted parts to merge.");
+            /// If there are too many files to merge at once, first decrease their number with cascade merges.
+            mergeTemporaryFiles();
+            if (isCancelled())
+                return Block();
 
-            /// Create sorted streams to merge.
-            for (const auto & file : temporary_files)
+            /// If requested and there is no LIMIT, merge the files in parallel by disjoint key ranges.
+            if (!(merge_threads > 1 && !limit && temporary_files.size() > 1 && mergeTemporaryFilesInParallel()))
             {
-                temporary_inputs.emplace_back(std::make_unique<TemporaryFileStream>(file->path()));
-                inputs_to_merge.emplace_back(temporary_inputs.back()->block_in);
+                LOG_INFO(log, "There are " << temporary_files.size() << " temporary sorted parts to merge.");
+
+                /// Create sorted streams to merge.
+                size_t buf_size = runReadBufferSize(temporary_files.size());
+                for (const auto & file : temporary_files)
+                {
+                    temporary_inputs.emplace_back(std::make_unique<TemporaryFileStream>(file->path(), buf_size));
+                    inputs_to_merge.emplace_back(temporary_inputs.back()->block_in);
+                }
+
+                /// Rest of blocks in memory.
+                if (!blocks.empty())
+                    inputs_to_merge.emplace_back(std::make_shared<MergeSortingBlocksBlockInputStream>(blocks, description, max_merged_block_size, limit));
+
+                /// Will merge that sorted streams.
+                impl = std::make_unique<MergingSortedBlockInputStream>(inputs_to_merge, description, max_merged_block_size, limit);
             }
-
-            /// Rest of blocks in memory.
-            if (!blocks.empty())
-                inputs_to_merge.emplace_back(std::make_shared<MergeSortingBlocksBlockInputStream>(blocks, description, max_merged_block_size, limit));
-
-            /// Will merge that sorted streams.
-            impl = std::make_unique<MergingSortedBlockInputStream>(inputs_to_merge, description, max_merged_block_size, limit);
         }
     }
 
@@ -153,6 +160,215 @@ Block MergeSortingBlockInputStream::readImpl()
 }
 
 
+void MergeSortingBlockInputStream::writeBlocksToTemporaryFile()
+{
+    temporary_files.emplace_back(new Poco::TemporaryFile(tmp_path));
+    const std::string & path = temporary_files.back()->path();
+    WriteBufferFromFile file_buf(path);
+    CompressedWriteBuffer compressed_buf(file_buf);
+    NativeBlockOutputStream block_out(compressed_buf);
+    MergeSortingBlocksBlockInputStream block_in(blocks, description, max_merged_block_size, limit);
+
+    LOG_INFO(log, "Sorting and writing part of data into temporary file " + path);
+    ProfileEvents::increment(ProfileEvents::ExternalSortWritePart);
+
+    if (merge_threads <= 1)
+    {
+        copyData(block_in, block_out, &is_cancelled);    /// NOTE. Possibly limit disk usage.
+    }
+    else
+    {
+        /// Same as copyData, but also remember the first key of each written block -
+        ///  these are the candidate boundaries for the parallel merge of the files.
+        block_in.readPrefix();
+        block_out.writePrefix();
+
+        while (Block block = block_in.read())
+        {
+            if (is_cancelled)
+                break;
+
+            if (!key_samples)
+                for (const auto & elem : description)
+                    key_samples.insert(columnWithSortDescription(block, elem).cloneEmpty());
+
+            for (size_t i = 0; i < description.size(); ++i)
+                key_samples.getByPosition(i).column->insertFrom(
+                    *columnWithSortDescription(block, description[i]).column, 0);
+
+            block_out.write(block);
+        }
+
+        block_in.readSuffix();
+        block_out.writeSuffix();
+    }
+
+    LOG_INFO(log, "Done writing part of data into temporary file " + path);
+
+    blocks.clear();
+    sum_bytes_in_blocks = 0;
+}
+
+
+void MergeSortingBlockInputStream::mergeTemporaryFiles()
+{
+    while (max_merge_fan_in > 1 && temporary_files.size() > max_merge_fan_in && !is_cancelled)
+    {
+        /// Merge no more files than needed: if after this pass `max_merge_fan_in` files remain,
+        ///  the rest of the work is left to the final merge.
+        size_t num_files_to_merge = std::min(max_merge_fan_in, temporary_files.size() - max_merge_fan_in + 1);
+
+        LOG_INFO(log, "Merging " << num_files_to_merge << " of " << temporary_files.size()
+            << " temporary sorted parts into a new part (max merge fan-in is " << max_merge_fan_in << ").");
+        ProfileEvents::increment(ProfileEvents::ExternalSortMerge);
+
+        std::vector<std::unique_ptr<TemporaryFileStream>> inputs;
+        BlockInputStreams streams_to_merge;
+        size_t buf_size = runReadBufferSize(num_files_to_merge);
+
+        for (size_t i = 0; i < num_files_to_merge; ++i)
+        {
+            inputs.emplace_back(std::make_unique<TemporaryFileStream>(temporary_files[i]->path(), buf_size));
+            streams_to_merge.emplace_back(inputs.back()->block_in);
+        }
+
+        /// If there is a LIMIT, the merged file also needs no more than `limit` first rows.
+        MergingSortedBlockInputStream merge(streams_to_merge, description, max_merged_block_size, limit);
+
+        temporary_files.emplace_back(new Poco::TemporaryFile(tmp_path));
+        const std::string & path = temporary_files.back()->path();
+        WriteBufferFromFile file_buf(path);
+        CompressedWriteBuffer compressed_buf(file_buf);
+        NativeBlockOutputStream block_out(compressed_buf);
+
+        copyData(merge, block_out, &is_cancelled);
+
+        /// The merged files are deleted when their Poco::TemporaryFile objects are destroyed.
+        temporary_files.erase(temporary_files.begin(), temporary_files.begin() + num_files_to_merge);
+    }
+}
+
+
+size_t MergeSortingBlockInputStream::runReadBufferSize(size_t num_runs) const
+{
+    /// Spend up to half of the external sort memory budget on read buffers for the runs
+    ///  (leaving the rest for decompression and the merged blocks themselves),
+    ///  so that the merge does large sequential reads instead of small random ones.
+    static constexpr size_t max_buf_size = 32 * DBMS_DEFAULT_BUFFER_SIZE;
+
+    if (!max_bytes_before_external_sort || !num_runs)
+        return DBMS_DEFAULT_BUFFER_SIZE;
+
+    return std::min(max_buf_size,
+        std::max(static_cast<size_t>(DBMS_DEFAULT_BUFFER_SIZE), max_bytes_before_external_sort / 2 / num_runs));
+}
+
+
+bool MergeSortingBlockInputStream::mergeTemporaryFilesInParallel()
+{
+    /// KeyRangeFilterBlockInputStream does not support collations.
+    for (const auto & elem : description)
+        if (elem.collator)
+            return false;
+
+    if (!key_samples || key_samples.rows() == 0)
+        return false;
+
+    /// All the data to merge must be in the files.
+    if (!blocks.empty())
+        writeBlocksToTemporaryFile();
+
+    /** Choose the boundaries of the key ranges: sort the sampled keys
+      *  and take every (count / merge_threads)-th of them.
+      * Rows with equal keys always fall into the same range, so each range can be merged
+      *  independently, and the concatenation of the merged ranges is sorted as a whole.
+      */
+    SortDescription samples_description = description;
+    for (size_t i = 0; i < samples_description.size(); ++i)
+    {
+        samples_description[i].column_name.clear();
+        samples_description[i].column_number = i;
+    }
+    sortBlock(key_samples, samples_description);
+
+    size_t num_keys = description.size();
+    size_t num_samples = key_samples.rows();
+
+    std::vector<std::vector<Field>> boundaries;
+    for (size_t i = 1; i < merge_threads; ++i)
+    {
+        size_t pos = num_samples * i / merge_threads;
+
+        std::vector<Field> key(num_keys);
+        for (size_t j = 0; j < num_keys; ++j)
+            key_samples.getByPosition(j).column->get(pos, key[j]);
+
+        /// Coinciding boundaries would give empty ranges - don't create threads for them.
+        if (boundaries.empty() || key != boundaries.back())
+            boundaries.push_back(std::move(key));
+    }
+
+    /// All the sampled keys are equal - nothing to split by.
+    if (boundaries.empty())
+        return false;
+
+    size_t num_ranges = boundaries.size() + 1;
+
+    LOG_INFO(log, "There are " << temporary_files.size() << " temporary sorted parts to merge in "
+        << num_ranges << " threads by disjoint key ranges.");
+
+    /// Merge each range in a separate thread into its own temporary file.
+    ThreadPool pool(num_ranges);
+
+    /// Every thread opens all the files, so the read buffers are shared between that many runs.
+    size_t buf_size = runReadBufferSize(temporary_files.size() * num_ranges);
+
+    for (size_t range = 0; range < num_ranges; ++range)
+    {
+        range_files.emplace_back(new Poco::TemporaryFile(tmp_path));
+
+        std::vector<Field> lower = range == 0 ? std::vector<Field>{} : boundaries[range - 1];
+        std::vector<Field> upper = range + 1 == num_ranges ? std::vector<Field>{} : boundaries[range];
+        std::string path = range_files.back()->path();
+
+        pool.schedule([this, lower, upper, path, buf_size]
+        {
+            /// Each thread opens the files by itself: the read buffers are not thread-safe.
+            std::vector<std::unique_ptr<TemporaryFileStream>> inputs;
+            BlockInputStreams inputs_to_merge_range;
+
+            for (const auto & file : temporary_files)
+            {
+                inputs.emplace_back(std::make_unique<TemporaryFileStream>(file->path(), buf_size));
+                inputs_to_merge_range.emplace_back(std::make_shared<KeyRangeFilterBlockInputStream>(
+                    inputs.back()->block_in, description, lower, upper));
+            }
+
+            MergingSortedBlockInputStream merge(inputs_to_merge_range, description, max_merged_block_size);
+
+            WriteBufferFromFile file_buf(path);
+            CompressedWriteBuffer compressed_buf(file_buf);
+            NativeBlockOutputStream block_out(compressed_buf);
+
+            copyData(merge, block_out, &is_cancelled);
+        });
+    }
+
+    pool.wait();
+
+    /// Reading the merged ranges one by one gives the final sorted stream.
+    BlockInputStreams range_streams;
+    for (const auto & file : range_files)
+    {
+        temporary_inputs.emplace_back(std::make_unique<TemporaryFileStream>(file->path(), runReadBufferSize(1)));
+        range_streams.emplace_back(temporary_inputs.back()->block_in);
+    }
+
+    impl = std::make_unique<ConcatBlockInputStream>(range_streams);
+    return true;
+}
+
+
 MergeSortingBlocksBlockInputStream::MergeSortingBlocksBlockInputStream(
     Blocks & blocks_, SortDescription & description_, size_t max_merged_block_size_, size_t limit_)
     : blocks(blocks_), description(description_), max_merged_block_size(max_merged_block_size_), limit(limit_)
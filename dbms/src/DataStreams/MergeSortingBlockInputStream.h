@@ -69,11 +69,17 @@ class MergeSortingBlockInputStream : public IProfilingBlockInputStream
 {
 public:
     /// limit - if not 0, allowed to return just first 'limit' rows in sorted order.
+    /// merge_threads - if more than 1, the final merge of temporary files is done in parallel,
+    ///  by splitting the data into that many key ranges (see mergeTemporaryFilesInParallel).
+    /// max_merge_fan_in - if more than 1, no more than that many temporary files are merged at once;
+    ///  extra files are first combined by intermediate cascade merges (see mergeTemporaryFiles).
     MergeSortingBlockInputStream(const BlockInputStreamPtr & input, SortDescription & description_,
         size_t max_merged_block_size_, size_t limit_,
-        size_t max_bytes_before_external_sort_, const std::string & tmp_path_)
+        size_t max_bytes_before_external_sort_, const std::string & tmp_path_,
+        size_t merge_threads_ = 1, size_t max_merge_fan_in_ = 0)
         : description(description_), max_merged_block_size(max_merged_block_size_), limit(limit_),
-        max_bytes_before_external_sort(max_bytes_before_external_sort_), tmp_path(tmp_path_)
+        max_bytes_before_external_sort(max_bytes_before_external_sort_), tmp_path(tmp_path_),
+        merge_threads(merge_threads_), max_merge_fan_in(max_merge_fan_in_)
     {
         children.push_back(input);
     }
@@ -106,6 +112,8 @@ private:
 
     size_t max_bytes_before_external_sort;
     const std::string tmp_path;
+    size_t merge_threads;
+    size_t max_merge_fan_in;
 
     Logger * log = &Logger::get("MergeSortingBlockInputStream");
 
@@ -128,13 +136,42 @@ private:
         CompressedReadBuffer compressed_in;
         BlockInputStreamPtr block_in;
 
-        TemporaryFileStream(const std::string & path)
-            : file_in(path), compressed_in(file_in), block_in(std::make_shared<NativeBlockInputStream>(compressed_in)) {}
+        TemporaryFileStream(const std::string & path, size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE)
+            : file_in(path, buf_size), compressed_in(file_in), block_in(std::make_shared<NativeBlockInputStream>(compressed_in)) {}
     };
 
     std::vector<std::unique_ptr<TemporaryFileStream>> temporary_inputs;
 
     BlockInputStreams inputs_to_merge;
+
+    /// Everything below is for the parallel merge of temporary files (merge_threads > 1).
+
+    /// First key of each block written to the temporary files - candidate boundaries of the key ranges.
+    Block key_samples;
+
+    /// Files with the already merged key ranges; read one by one, they form the final sorted stream.
+    std::vector<std::unique_ptr<Poco::TemporaryFile>> range_files;
+
+    /// Merge the blocks accumulated in memory and write them to a new temporary file.
+    void writeBlocksToTemporaryFile();
+
+    /** While there are more temporary files than `max_merge_fan_in`, merge groups of them
+      *  into single larger files (a cascade merge). Each pass reads and writes the data once,
+      *  so the number of simultaneously opened files stays bounded at the cost of extra I/O.
+      */
+    void mergeTemporaryFiles();
+
+    /// Size of the read buffer for a single temporary file, when `num_runs` of them are read at once.
+    /// The larger it is, the more sequential is the I/O pattern of the merge.
+    size_t runReadBufferSize(size_t num_runs) const;
+
+    /** Split the data in the temporary files into `merge_threads` disjoint key ranges,
+      *  merge each range in a separate thread into its own file (range_files)
+      *  and set `impl` to the concatenation of those files.
+      * Returns false if the split is not possible (no key samples or collations are used) -
+      *  then the caller falls back to the single-threaded merge.
+      */
+    bool mergeTemporaryFilesInParallel();
 };
 
 }
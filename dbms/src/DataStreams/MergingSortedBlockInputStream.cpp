@@ -177,6 +177,13 @@ Block MergingSortedBlockInputStream::readImpl()
 
 template <typename TSortCursor>
 void MergingSortedBlockInputStream::fetchNextBlock(const TSortCursor & current, std::priority_queue<TSortCursor> & queue)
+{
+    if (fetchNextBlock(current))
+        queue.push(TSortCursor(current.impl));
+}
+
+template <typename TSortCursor>
+bool MergingSortedBlockInputStream::fetchNextBlock(const TSortCursor & current)
 {
     size_t i = 0;
     size_t size = cursors.size();
@@ -188,15 +195,14 @@ void MergingSortedBlockInputStream::fetchNextBlock(const TSortCursor & current,
             if (*source_blocks[i])
             {
                 cursors[i].reset(*source_blocks[i]);
-                queue.push(TSortCursor(&cursors[i]));
+                return true;
             }
 
-            break;
+            return false;
         }
     }
 
-    if (i == size)
-        throw Exception("Logical error in MergingSortedBlockInputStream", ErrorCodes::LOGICAL_ERROR);
+    throw Exception("Logical error in MergingSortedBlockInputStream", ErrorCodes::LOGICAL_ERROR);
 }
 
 template
@@ -208,6 +214,27 @@ void MergingSortedBlockInputStream::fetchNextBlock<SortCursorWithCollation>(cons
 
 template <typename TSortCursor>
 void MergingSortedBlockInputStream::merge(Block & merged_block, ColumnPlainPtrs & merged_columns, std::priority_queue<TSortCursor> & queue)
+{
+    /// For the duration of the merge the cursors are moved from the queue into a tree of losers,
+    ///  which replays only log2(k) matches per produced row instead of a pop/push cycle on the heap.
+    std::vector<TSortCursor> tree_cursors;
+    tree_cursors.reserve(queue.size());
+    while (!queue.empty())
+    {
+        tree_cursors.push_back(queue.top());
+        queue.pop();
+    }
+
+    LoserTree<TSortCursor> loser_tree(std::move(tree_cursors));
+
+    mergeImpl(merged_block, merged_columns, loser_tree);
+
+    loser_tree.forEachActive([&](const TSortCursor & cursor) { queue.push(cursor); });
+}
+
+
+template <typename TSortCursor>
+void MergingSortedBlockInputStream::mergeImpl(Block & merged_block, ColumnPlainPtrs & merged_columns, LoserTree<TSortCursor> & loser_tree)
 {
     size_t merged_rows = 0;
 
@@ -235,49 +262,56 @@ void MergingSortedBlockInputStream::merge(Block & merged_block, ColumnPlainPtrs
         return false;
     };
 
+    /// Advance the winner to the next block of its source, or remove it from the tournament if the source is exhausted.
+    auto pass_to_next_block = [&](TSortCursor & current)
+    {
+        if (fetchNextBlock(current))
+            loser_tree.replayWinner();
+        else
+            loser_tree.retireWinner();
+    };
+
     /// Take rows in required order and put them into `merged_block`, while the rows are no more than `max_block_size`
-    while (!queue.empty())
+    while (!loser_tree.empty())
     {
-        TSortCursor current = queue.top();
-        queue.pop();
+        TSortCursor current = loser_tree.winner();
 
-        while (true)
+        bool has_competitors = loser_tree.activeCursors() > 1;
+
+        /// The least of the current rows of the other cursors. It does not move while `current` stays the winner.
+        TSortCursor runner_up = has_competitors ? loser_tree.secondBest() : current;
+
+        /** And what if the rest of the block of the current cursor is smaller or equal than the rest for the other cursors?
+          * Or is there only one data source left? Then you can take the rest of the block of current cursor wholesale.
+          */
+        if (!has_competitors || current.totallyLessOrEquals(runner_up))
         {
-            /** And what if the block is smaller or equal than the rest for the current cursor?
-              * Or is there only one data source left in the queue? Then you can take the entire block of current cursor.
-              */
-            if (current.impl->isFirst() && (queue.empty() || current.totallyLessOrEquals(queue.top())))
-            {
-    //            std::cerr << "current block is totally less or equals\n";
+            /// Actually, current.impl->order stores source number (i.e. cursors[current.impl->order] == current.impl)
+            size_t source_num = current.impl->order;
+
+            if (source_num >= cursors.size())
+                throw Exception("Logical error in MergingSortedBlockInputStream", ErrorCodes::LOGICAL_ERROR);
 
-                /// If there are already data in the current block, we first return it. We'll get here again the next time we call the merge function.
+            if (current.impl->isFirst())
+            {
+                /// If there are already data in the current block, we first return it.
+                /// We'll take over the winner's whole block the next time we call the merge function.
                 if (merged_rows != 0)
-                {
-    //                std::cerr << "merged rows is non-zero\n";
-                    queue.push(current);
                     return;
-                }
-
-                /// Actually, current.impl->order stores source number (i.e. cursors[current.impl->order] == current.impl)
-                size_t source_num = current.impl->order;
-
-                if (source_num >= cursors.size())
-                    throw Exception("Logical error in MergingSortedBlockInputStream", ErrorCodes::LOGICAL_ERROR);
 
+                /// The result block is still empty - take over the whole block of the winner without copying.
                 for (size_t i = 0; i < num_columns; ++i)
                     merged_block.getByPosition(i).column = source_blocks[source_num]->getByPosition(i).column;
 
-    //            std::cerr << "copied columns\n";
+                size_t taken_rows = merged_block.rows();
 
-                size_t merged_rows = merged_block.rows();
-
-                if (limit && total_merged_rows + merged_rows > limit)
+                if (limit && total_merged_rows + taken_rows > limit)
                 {
-                    merged_rows = limit - total_merged_rows;
+                    taken_rows = limit - total_merged_rows;
                     for (size_t i = 0; i < num_columns; ++i)
                     {
                         auto & column = merged_block.getByPosition(i).column;
-                        column = column->cut(0, merged_rows);
+                        column = column->cut(0, taken_rows);
                     }
 
                     cancel();
@@ -287,19 +321,59 @@ void MergingSortedBlockInputStream::merge(Block & merged_block, ColumnPlainPtrs
                 if (out_row_sources_buf)
                 {
                     RowSourcePart row_source(source_num);
-                    for (size_t i = 0; i < merged_rows; ++i)
+                    for (size_t i = 0; i < taken_rows; ++i)
                         out_row_sources_buf->write(row_source.data);
                 }
 
-    //            std::cerr << "fetching next block\n";
+                total_merged_rows += taken_rows;
+
+                if (!finished)
+                    pass_to_next_block(current);
 
-                total_merged_rows += merged_rows;
-                fetchNextBlock(current, queue);
                 return;
             }
 
-    //        std::cerr << "total_merged_rows: " << total_merged_rows << ", merged_rows: " << merged_rows << "\n";
-    //        std::cerr << "Inserting row\n";
+            /// The winner is in the middle of its block - append the rest of it (or as much as fits) in one pass.
+            size_t taken_rows = current->rows - current->pos;
+
+            if (merged_rows + taken_rows > max_block_size)
+                taken_rows = max_block_size - merged_rows;
+
+            if (limit && total_merged_rows + taken_rows > limit)
+                taken_rows = limit - total_merged_rows;
+
+            for (size_t i = 0; i < num_columns; ++i)
+                merged_columns[i]->insertRangeFrom(*current->all_columns[i], current->pos, taken_rows);
+
+            if (out_row_sources_buf)
+            {
+                RowSourcePart row_source(source_num);
+                for (size_t i = 0; i < taken_rows; ++i)
+                    out_row_sources_buf->write(row_source.data);
+            }
+
+            merged_rows += taken_rows;
+            total_merged_rows += taken_rows;
+            current->pos += taken_rows;
+
+            if (limit && total_merged_rows == limit)
+            {
+                cancel();
+                finished = true;
+                return;
+            }
+
+            if (current->pos == current->rows)
+                pass_to_next_block(current);
+
+            if (merged_rows >= max_block_size)
+                return;
+
+            continue;
+        }
+
+        while (true)
+        {
             for (size_t i = 0; i < num_columns; ++i)
                 merged_columns[i]->insertFrom(*current->all_columns[i], current->pos);
 
@@ -312,33 +386,24 @@ void MergingSortedBlockInputStream::merge(Block & merged_block, ColumnPlainPtrs
 
             if (!current->isLast())
             {
-    //            std::cerr << "moving to next row\n";
                 current->next();
 
-                if (queue.empty() || !(current.greater(queue.top())))
+                if (!current.greater(runner_up))
                 {
                     if (count_row_and_check_limit())
-                    {
-    //                    std::cerr << "pushing back to queue\n";
-                        queue.push(current);
                         return;
-                    }
 
-                    /// Do not put the cursor back in the queue, but continue to work with the current cursor.
-    //                std::cerr << "current is still on top, using current row\n";
+                    /// The current cursor is still no greater than the runner-up - it remains the winner,
+                    ///  and there is nothing to replay.
                     continue;
                 }
-                else
-                {
-    //                std::cerr << "next row is not least, pushing back to queue\n";
-                    queue.push(current);
-                }
+
+                loser_tree.replayWinner();
             }
             else
             {
                 /// We get the next block from the corresponding source, if there is one.
-    //            std::cerr << "It was last row, fetching next block\n";
-                fetchNextBlock(current, queue);
+                pass_to_next_block(current);
             }
 
             break;
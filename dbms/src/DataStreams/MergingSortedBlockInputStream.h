@@ -119,6 +119,12 @@ protected:
     template <typename TSortCursor>
     void fetchNextBlock(const TSortCursor & current, std::priority_queue<TSortCursor> & queue);
 
+    /** Same, but without touching the queue. The cursor is reset to the new block.
+      * Returns false if the source is exhausted.
+      */
+    template <typename TSortCursor>
+    bool fetchNextBlock(const TSortCursor & current);
+
 
     const SortDescription description;
     const size_t max_block_size;
@@ -216,6 +222,12 @@ private:
     template <typename TSortCursor>
     void merge(Block & merged_block, ColumnPlainPtrs & merged_columns, std::priority_queue<TSortCursor> & queue);
 
+    /** The merge loop itself, over a tree of losers built from the cursors of the queue.
+      * The queue (it is also used by the derived streams) only holds the cursors between the calls.
+      */
+    template <typename TSortCursor>
+    void mergeImpl(Block & merged_block, ColumnPlainPtrs & merged_columns, LoserTree<TSortCursor> & loser_tree);
+
     Logger * log = &Logger::get("MergingSortedBlockInputStream");
 
     /// Read is finished.
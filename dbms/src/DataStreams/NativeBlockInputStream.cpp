@@ -5,6 +5,7 @@
 #include <IO/CompressedReadBufferFromFile.h>
 
 #include <Columns/ColumnArray.h>
+#include <Columns/ColumnLazy.h>
 #include <Columns/ColumnNullable.h>
 #include <Columns/ColumnsNumber.h>
 #include <DataTypes/DataTypeArray.h>
@@ -151,12 +152,36 @@ Block NativeBlockInputStream::readImpl()
                 throw Exception("Index points to column with wrong type: corrupted index or data", ErrorCodes::INCORRECT_INDEX);
         }
 
+        /// Size of the serialized data, if the sender is recent enough to write it.
+        size_t serialized_size = 0;
+        if (server_revision >= DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES)
+            readVarUInt(serialized_size, istr);
+
         /// Data
-        column.column = column.type->createColumn();
+        if (rows && lazy_columns && serialized_size)
+        {
+            /// The payload is carried in serialized form and will be deserialized only on access.
+            String serialized;
+            serialized.resize(serialized_size);
+            istr.readStrict(&serialized[0], serialized_size);
+            column.column = std::make_shared<ColumnLazy>(column.type, rows, std::move(serialized));
+        }
+        else
+        {
+            column.column = column.type->createColumn();
 
-        double avg_value_size_hint = avg_value_size_hints.empty() ? 0 : avg_value_size_hints[i];
-        if (rows)    /// If no rows, nothing to read.
-            readData(*column.type, *column.column, istr, rows, avg_value_size_hint);
+            double avg_value_size_hint = avg_value_size_hints.empty() ? 0 : avg_value_size_hints[i];
+
+            /// Until hints accumulated from previous blocks are available, derive one from
+            ///  the exact serialized size written by the sender, so that even the very first
+            ///  block is deserialized without repeated reallocations. Serialized values lack
+            ///  the in-memory offsets that the hint convention accounts for, hence the correction.
+            if (!avg_value_size_hint && serialized_size && rows)
+                avg_value_size_hint = static_cast<double>(serialized_size) / rows + sizeof(UInt64);
+
+            if (rows)    /// If no rows, nothing to read.
+                readData(*column.type, *column.column, istr, rows, avg_value_size_hint);
+        }
 
         res.insert(std::move(column));
 
@@ -174,6 +199,8 @@ Block NativeBlockInputStream::readImpl()
             index_column_it = index_block_it->columns.begin();
     }
 
+    updateAvgValueSizeHints(res);
+
     return res;
 }
 
@@ -72,6 +72,12 @@ public:
 
     String getName() const override { return "Native"; }
 
+    /** Keep column payloads in serialized form (as ColumnLazy), deserializing them only on access.
+      * Only takes effect if the sender prefixed the columns with their sizes
+      *  (server_revision >= DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES).
+      */
+    void setLazyColumns(bool lazy_columns_) { lazy_columns = lazy_columns_; }
+
     String getID() const override
     {
         std::stringstream res;
@@ -88,6 +94,8 @@ private:
     ReadBuffer & istr;
     UInt64 server_revision;
 
+    bool lazy_columns = false;
+
     bool use_index;
     IndexForNativeFormat::Blocks::const_iterator index_block_it;
     IndexForNativeFormat::Blocks::const_iterator index_block_end;
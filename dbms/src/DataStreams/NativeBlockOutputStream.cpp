@@ -4,8 +4,10 @@
 #include <IO/WriteHelpers.h>
 #include <IO/VarInt.h>
 #include <IO/CompressedWriteBuffer.h>
+#include <IO/WriteBufferFromString.h>
 
 #include <Columns/ColumnArray.h>
+#include <Columns/ColumnLazy.h>
 #include <Columns/ColumnNullable.h>
 #include <Columns/ColumnsNumber.h>
 
@@ -156,8 +158,35 @@ void NativeBlockOutputStream::write(const Block & block)
         writeStringBinary(column.type->getName(), ostr);
 
         /// Data
-        if (rows)    /// Zero items of data is always represented as zero number of bytes.
-            writeData(*column.type, column.column, ostr, 0, 0);
+        const ColumnLazy * lazy = typeid_cast<const ColumnLazy *>(column.column.get());
+
+        if (lazy && !lazy->isMaterialized())
+        {
+            /// The payload was received in serialized form and nothing has read the values:
+            ///  write it back verbatim.
+            const String & serialized = lazy->getSerializedData();
+
+            if (client_revision >= DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES)
+                writeVarUInt(serialized.size(), ostr);
+
+            ostr.write(serialized.data(), serialized.size());
+        }
+        else if (client_revision >= DBMS_MIN_REVISION_WITH_COLUMN_BYTE_SIZES)
+        {
+            /// The size prefix allows the receiver to carry the column as an opaque buffer.
+            String serialized;
+
+            if (rows)
+            {
+                WriteBufferFromString serialized_out(serialized);
+                writeData(*column.type, lazy ? lazy->getMaterializedColumn() : column.column, serialized_out, 0, 0);
+            }
+
+            writeVarUInt(serialized.size(), ostr);
+            ostr.write(serialized.data(), serialized.size());
+        }
+        else if (rows)    /// Zero items of data is always represented as zero number of bytes.
+            writeData(*column.type, lazy ? lazy->getMaterializedColumn() : column.column, ostr, 0, 0);
 
         if (index_ostr)
         {
@@ -31,6 +31,9 @@ public:
 
     void cancel() override;
 
+    /// Pin aggregation threads to NUMA nodes (see ParallelInputsProcessor::setNUMAAware).
+    void setNUMAAware(bool value) { processor.setNUMAAware(value); }
+
 protected:
     /// Do nothing that preparation to execution of the query be done in parallel, in ParallelInputsProcessor.
     void readPrefix() override
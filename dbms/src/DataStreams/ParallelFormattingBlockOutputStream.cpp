@@ -0,0 +1,73 @@
+#include <common/ThreadPool.h>
+
+#include <Core/Block.h>
+#include <DataStreams/ParallelFormattingBlockOutputStream.h>
+#include <DataStreams/BlockOutputStreamFromRowOutputStream.h>
+#include <IO/WriteBuffer.h>
+#include <IO/WriteBufferFromString.h>
+
+
+namespace DB
+{
+
+ParallelFormattingBlockOutputStream::ParallelFormattingBlockOutputStream(
+    WriteBuffer & out_,
+    RowOutputCreator row_output_creator_,
+    size_t num_threads_)
+    : out(out_), row_output_creator(std::move(row_output_creator_)), num_threads(num_threads_),
+    row_output(row_output_creator(out))
+{
+}
+
+
+void ParallelFormattingBlockOutputStream::write(const Block & block)
+{
+    pending_blocks.push_back(block);
+
+    if (pending_blocks.size() >= num_threads)
+        formatPendingBlocks();
+}
+
+
+void ParallelFormattingBlockOutputStream::formatPendingBlocks()
+{
+    if (pending_blocks.empty())
+        return;
+
+    std::vector<String> chunks(pending_blocks.size());
+
+    ThreadPool pool(std::min(num_threads, pending_blocks.size()));
+
+    for (size_t i = 0; i < pending_blocks.size(); ++i)
+        pool.schedule([&, i]
+        {
+            /// The buffer must be destroyed before the string is used: it trims the string to the written size.
+            WriteBufferFromString chunk_buf(chunks[i]);
+
+            BlockOutputStreamFromRowOutputStream stream(row_output_creator(chunk_buf));
+            stream.write(pending_blocks[i]);
+        });
+
+    pool.wait();
+
+    for (const auto & chunk : chunks)
+        out.write(chunk.data(), chunk.size());
+
+    pending_blocks.clear();
+}
+
+
+void ParallelFormattingBlockOutputStream::writeSuffix()
+{
+    formatPendingBlocks();
+    row_output->writeSuffix();
+}
+
+
+void ParallelFormattingBlockOutputStream::flush()
+{
+    formatPendingBlocks();
+    row_output->flush();
+}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <DataStreams/IBlockOutputStream.h>
+#include <DataStreams/IRowOutputStream.h>
+
+namespace DB
+{
+
+class WriteBuffer;
+
+/** Formats row-based formats on several threads.
+  * Incoming blocks are accumulated and rendered to in-memory buffers by a thread pool,
+  *  one block per task with its own row output stream; the rendered chunks are then
+  *  written to the target WriteBuffer in the order of the incoming blocks.
+  * The counterpart of ParallelParsingBlockInputStream: on big extracts the query itself
+  *  runs on all cores but the final serialization is single-threaded otherwise.
+  *
+  * Only suitable for formats where rows are self-delimited and independent of each other
+  *  (no delimiter between rows, no state carried from row to row), such as TabSeparated,
+  *  CSV, TSKV and JSONEachRow. The prefix, suffix, totals and extremes are written
+  *  directly to the target through a separate row output stream.
+  */
+class ParallelFormattingBlockOutputStream : public IBlockOutputStream
+{
+public:
+    using RowOutputCreator = std::function<RowOutputStreamPtr(WriteBuffer &)>;
+
+    ParallelFormattingBlockOutputStream(
+        WriteBuffer & out_,
+        RowOutputCreator row_output_creator_,
+        size_t num_threads_);
+
+    void write(const Block & block) override;
+    void writePrefix() override { row_output->writePrefix(); }
+    void writeSuffix() override;
+
+    void flush() override;
+
+    void setRowsBeforeLimit(size_t rows_before_limit) override { row_output->setRowsBeforeLimit(rows_before_limit); }
+    void setTotals(const Block & totals) override { row_output->setTotals(totals); }
+    void setExtremes(const Block & extremes) override { row_output->setExtremes(extremes); }
+    void onProgress(const Progress & progress) override { row_output->onProgress(progress); }
+
+    String getContentType() const override { return row_output->getContentType(); }
+
+private:
+    /// Render the accumulated blocks on the pool and write them out in order.
+    void formatPendingBlocks();
+
+    WriteBuffer & out;
+    RowOutputCreator row_output_creator;
+    size_t num_threads;
+
+    /// Writes everything except the rows: the prefix, the suffix, totals and extremes.
+    RowOutputStreamPtr row_output;
+
+    /// Blocks not yet rendered, in the order they were written.
+    std::vector<Block> pending_blocks;
+};
+
+}
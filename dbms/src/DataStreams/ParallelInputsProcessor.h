@@ -9,9 +9,13 @@
 #include <common/logger_useful.h>
 
 #include <DataStreams/IProfilingBlockInputStream.h>
+#include <Common/GlobalWorkPool.h>
 #include <Common/setThreadName.h>
+#include <Common/QueryProfiler.h>
+#include <Common/HardwareCounters.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/MemoryTracker.h>
+#include <Common/NUMAAwareness.h>
 
 
 /** Allows to process multiple block input streams (sources) in parallel, using specified number of threads.
@@ -19,7 +23,7 @@
   *
   * Implemented in following way:
   * - there are multiple input sources to read blocks from;
-  * - there are multiple threads, that could simultaneously read blocks from different sources;
+  * - there are multiple jobs in the global work pool, that could simultaneously read blocks from different sources;
   * - "available" sources (that are not read in any thread right now) are put in queue of sources;
   * - when thread take a source to read from, it removes source from queue of sources,
   *    then read block from source and then put source back to queue of available sources.
@@ -95,13 +99,18 @@ public:
         }
     }
 
-    /// Start background threads, start work.
+    /// Schedule the work to the global pool of worker threads, start work.
     void process()
     {
         active_threads = max_threads;
-        threads.reserve(max_threads);
+        job_group = GlobalWorkPool::instance().createGroup();
+
+        /// If the calling (query) thread is profiled, profile the worker threads of the query too.
+        QueryProfiler::Params profiler_params = QueryProfiler::getParamsOfCurrentThread();
+
         for (size_t i = 0; i < max_threads; ++i)
-            threads.emplace_back(std::bind(&ParallelInputsProcessor::thread, this, current_memory_tracker, i));
+            GlobalWorkPool::instance().schedule(job_group, std::bind(&ParallelInputsProcessor::thread, this,
+                current_memory_tracker, current_hardware_counters, profiler_params, i));
     }
 
     /// Ask all sources to stop earlier than they run out.
@@ -129,17 +138,14 @@ public:
         }
     }
 
-    /// Wait until all threads are finished, before the destructor.
+    /// Wait until all the jobs are finished, before the destructor.
     void wait()
     {
-        if (joined_threads)
+        if (!job_group)
             return;
 
-        for (auto & thread : threads)
-            thread.join();
-
-        threads.clear();
-        joined_threads = true;
+        GlobalWorkPool::instance().wait(job_group);
+        job_group = nullptr;
     }
 
     size_t getNumActiveThreads() const
@@ -147,6 +153,15 @@ public:
         return active_threads;
     }
 
+    /** Pin worker threads to NUMA nodes in round-robin fashion.
+      * Together with the first-touch policy of the kernel, this keeps the data each thread
+      *  accumulates (arenas, hash tables) on the local node. Must be called before `process`.
+      */
+    void setNUMAAware(bool value)
+    {
+        numa_aware = value;
+    }
+
 private:
     /// Single source data
     struct InputData
@@ -173,14 +188,25 @@ private:
         handler.onBlock(block, extra_info, thread_num);
     }
 
-    void thread(MemoryTracker * memory_tracker, size_t thread_num)
+    void thread(MemoryTracker * memory_tracker, HardwareCounters * hardware_counters,
+        const QueryProfiler::Params & profiler_params, size_t thread_num)
     {
         current_memory_tracker = memory_tracker;
         std::exception_ptr exception;
 
+        auto profiler = QueryProfiler::createForCurrentThread(profiler_params);
+
+        std::unique_ptr<HardwareCountersThreadScope> hardware_counters_scope;
+        if (hardware_counters)
+            hardware_counters_scope = std::make_unique<HardwareCountersThreadScope>(*hardware_counters);
+
         setThreadName("ParalInputsProc");
         CurrentMetrics::Increment metric_increment{CurrentMetrics::QueryThread};
 
+        /// Bind before the first allocation, so that first touch places the thread's data on its node.
+        if (numa_aware)
+            bindThreadToNUMANode(thread_num % getNUMANodeCount());
+
         try
         {
             loop(thread_num);
@@ -278,11 +304,13 @@ private:
     BlockInputStreamPtr additional_input_at_end;
     unsigned max_threads;
 
+    /// Pin worker threads to NUMA nodes.
+    bool numa_aware = false;
+
     Handler & handler;
 
-    /// Streams.
-    using ThreadsData = std::vector<std::thread>;
-    ThreadsData threads;
+    /// The jobs of this processor in the global pool; nullptr before `process` and after `wait`.
+    GlobalWorkPool::GroupPtr job_group;
 
     /** A set of available sources that are not currently processed by any thread.
       * Each thread takes one source from this set, takes a block out of the source (at this moment the source does the calculations)
@@ -311,8 +339,6 @@ private:
     std::atomic<size_t> active_threads { 0 };
     /// Finish the threads work (before the sources run out).
     std::atomic<bool> finish { false };
-    /// Wait for the completion of all threads.
-    std::atomic<bool> joined_threads { false };
 
     Logger * log = &Logger::get("ParallelInputsProcessor");
 };
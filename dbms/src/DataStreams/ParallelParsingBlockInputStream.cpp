@@ -0,0 +1,192 @@
+#include <string.h>
+
+#include <common/ThreadPool.h>
+#include <common/find_first_symbols.h>
+
+#include <DataStreams/ParallelParsingBlockInputStream.h>
+#include <DataStreams/BlockInputStreamFromRowInputStream.h>
+#include <IO/ReadBuffer.h>
+#include <IO/ReadBufferFromMemory.h>
+
+
+namespace DB
+{
+
+ParallelParsingBlockInputStream::ParallelParsingBlockInputStream(
+    ReadBuffer & in_,
+    RowInputCreator row_input_creator_,
+    const Block & sample_,
+    size_t max_block_size_,
+    UInt64 allow_errors_num_,
+    Float64 allow_errors_ratio_,
+    Segmentation segmentation_,
+    size_t num_threads_,
+    size_t min_segment_size_)
+    : in(in_), row_input_creator(std::move(row_input_creator_)), sample(sample_), max_block_size(max_block_size_),
+    allow_errors_num(allow_errors_num_), allow_errors_ratio(allow_errors_ratio_),
+    segmentation(segmentation_), num_threads(num_threads_), min_segment_size(min_segment_size_)
+{
+}
+
+
+bool ParallelParsingBlockInputStream::readSegment(String & segment)
+{
+    segment.clear();
+
+    bool in_quotes = false;         /// For Segmentation::CSV.
+    bool in_string = false;         /// For Segmentation::JSON.
+    bool after_backslash = false;
+    size_t depth = 0;
+
+    while (!in.eof())
+    {
+        char * begin = in.position();
+        char * end = in.buffer().end();
+
+        if (segmentation == Segmentation::Newline)
+        {
+            /// No state to track, so the gap to the minimal size is taken in bulk
+            ///  and the row boundary is found with memchr.
+            if (segment.size() < min_segment_size)
+            {
+                size_t to_copy = std::min(static_cast<size_t>(end - begin), min_segment_size - segment.size());
+                segment.append(begin, to_copy);
+                in.position() += to_copy;
+                continue;
+            }
+
+            if (char * pos = static_cast<char *>(memchr(begin, '\n', end - begin)))
+            {
+                segment.append(begin, pos + 1 - begin);
+                in.position() = pos + 1;
+                return true;
+            }
+        }
+        else
+        {
+            /// The quoting state has to be tracked, so jump from one character
+            ///  that can change it to the next with a vectorized search.
+            const char * pos = begin;
+            while (pos != end)
+            {
+                if (after_backslash)
+                {
+                    after_backslash = false;
+                    ++pos;
+                    continue;
+                }
+
+                pos = segmentation == Segmentation::CSV
+                    ? find_first_symbols<'"', '\n'>(pos, end)
+                    : find_first_symbols<'"', '\\', '{', '}', '\n'>(pos, end);
+
+                if (pos == end)
+                    break;
+
+                char c = *pos;
+                bool at_row_boundary = false;
+
+                if (segmentation == Segmentation::CSV)
+                {
+                    if (c == '"')
+                        in_quotes = !in_quotes;
+                    else if (c == '\n' && !in_quotes)
+                        at_row_boundary = true;
+                }
+                else
+                {
+                    if (in_string)
+                    {
+                        if (c == '\\')
+                            after_backslash = true;
+                        else if (c == '"')
+                            in_string = false;
+                    }
+                    else if (c == '"')
+                        in_string = true;
+                    else if (c == '{')
+                        ++depth;
+                    else if (c == '}')
+                    {
+                        if (depth)
+                            --depth;
+                    }
+                    else if (c == '\n' && !depth)
+                        at_row_boundary = true;
+                }
+
+                if (at_row_boundary && segment.size() + (pos - begin) >= min_segment_size)
+                {
+                    segment.append(begin, pos + 1 - begin);
+                    in.position() += pos + 1 - begin;
+                    return true;
+                }
+
+                ++pos;
+            }
+        }
+
+        segment.append(begin, end - begin);
+        in.position() = end;
+    }
+
+    return !segment.empty();
+}
+
+
+void ParallelParsingBlockInputStream::parseNextSegments()
+{
+    std::vector<String> segments;
+    segments.reserve(num_threads);
+
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        String segment;
+        if (!readSegment(segment))
+            break;
+        segments.emplace_back(std::move(segment));
+    }
+
+    if (segments.empty())
+        return;
+
+    std::vector<std::vector<Block>> parsed(segments.size());
+
+    ThreadPool pool(std::min(num_threads, segments.size()));
+
+    for (size_t i = 0; i < segments.size(); ++i)
+        pool.schedule([&, i]
+        {
+            ReadBufferFromMemory segment_buf(segments[i].data(), segments[i].size());
+
+            BlockInputStreamFromRowInputStream stream(
+                row_input_creator(segment_buf), sample, max_block_size, allow_errors_num, allow_errors_ratio);
+
+            stream.readPrefix();
+            while (Block block = stream.read())
+                parsed[i].emplace_back(std::move(block));
+            stream.readSuffix();
+        });
+
+    pool.wait();
+
+    for (auto & blocks : parsed)
+        for (auto & block : blocks)
+            pending_blocks.emplace_back(std::move(block));
+}
+
+
+Block ParallelParsingBlockInputStream::readImpl()
+{
+    if (pending_blocks.empty())
+        parseNextSegments();
+
+    if (pending_blocks.empty())
+        return {};
+
+    Block res = std::move(pending_blocks.front());
+    pending_blocks.pop_front();
+    return res;
+}
+
+}
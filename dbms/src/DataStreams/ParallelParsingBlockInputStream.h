@@ -0,0 +1,84 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+
+#include <Core/Defines.h>
+#include <DataStreams/IProfilingBlockInputStream.h>
+#include <DataStreams/IRowInputStream.h>
+
+
+namespace DB
+{
+
+/** Parses row-based formats on several threads.
+  * The input is split on row boundaries into segments of roughly min_segment_size bytes;
+  *  the segments are parsed into Blocks by a thread pool and returned in the original order.
+  * Splitting only looks for row separators, so it runs at memory speed and the parsing
+  *  itself (which dominates bulk loads) uses all the threads.
+  *
+  * Only suitable for formats where a row boundary can be found without parsing the rows
+  *  (see Segmentation) and which have no header, since every segment is parsed by its own
+  *  row input stream, created from scratch.
+  */
+class ParallelParsingBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    using RowInputCreator = std::function<RowInputStreamPtr(ReadBuffer &)>;
+
+    /// How a row boundary is found in the raw input.
+    enum class Segmentation
+    {
+        Newline,    /// A row ends at a newline; newlines inside values are always escaped (TabSeparated, TSKV).
+        CSV,        /// A row ends at a newline outside of a quoted field.
+        JSON,       /// A row ends at a newline outside of a string when all curly braces are balanced (JSONEachRow).
+    };
+
+    ParallelParsingBlockInputStream(
+        ReadBuffer & in_,
+        RowInputCreator row_input_creator_,
+        const Block & sample_,
+        size_t max_block_size_,
+        UInt64 allow_errors_num_,
+        Float64 allow_errors_ratio_,
+        Segmentation segmentation_,
+        size_t num_threads_,
+        size_t min_segment_size_ = DBMS_DEFAULT_BUFFER_SIZE);
+
+    String getName() const override { return "ParallelParsingBlockInputStream"; }
+
+    String getID() const override
+    {
+        std::stringstream res;
+        res << this;
+        return res.str();
+    }
+
+protected:
+    Block readImpl() override;
+
+private:
+    /// Cut the next segment from the input: at least min_segment_size bytes, extended to a row boundary.
+    /// Returns false when the input is exhausted.
+    bool readSegment(String & segment);
+
+    /// Read and parse the next batch of segments, one per thread.
+    void parseNextSegments();
+
+    ReadBuffer & in;
+    RowInputCreator row_input_creator;
+    const Block sample;
+    size_t max_block_size;
+
+    UInt64 allow_errors_num;
+    Float64 allow_errors_ratio;
+
+    Segmentation segmentation;
+    size_t num_threads;
+    size_t min_segment_size;
+
+    /// Parsed blocks in the order of the input, not yet returned from readImpl.
+    std::deque<Block> pending_blocks;
+};
+
+}
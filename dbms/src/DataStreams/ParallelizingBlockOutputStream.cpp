@@ -0,0 +1,117 @@
+#include <DataStreams/ParallelizingBlockOutputStream.h>
+#include <Common/setThreadName.h>
+#include <Common/Exception.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+}
+
+
+ParallelizingBlockOutputStream::ParallelizingBlockOutputStream(std::vector<BlockOutputStreamPtr> outputs_)
+    : outputs(std::move(outputs_)), queue(outputs.size() * 2)
+{
+    if (outputs.empty())
+        throw Exception("ParallelizingBlockOutputStream requires at least one output", ErrorCodes::LOGICAL_ERROR);
+}
+
+
+ParallelizingBlockOutputStream::~ParallelizingBlockOutputStream()
+{
+    try
+    {
+        waitForWorkers();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
+
+void ParallelizingBlockOutputStream::writePrefix()
+{
+    for (auto & output : outputs)
+        output->writePrefix();
+
+    threads.reserve(outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i)
+        threads.emplace_back([this, i] { workerThread(i); });
+    started = true;
+}
+
+
+void ParallelizingBlockOutputStream::write(const Block & block)
+{
+    if (has_exception)
+    {
+        waitForWorkers();
+        std::rethrow_exception(exception);
+    }
+
+    if (block)
+        queue.push(block);
+}
+
+
+void ParallelizingBlockOutputStream::writeSuffix()
+{
+    waitForWorkers();
+
+    if (exception)
+        std::rethrow_exception(exception);
+
+    for (auto & output : outputs)
+        output->writeSuffix();
+}
+
+
+void ParallelizingBlockOutputStream::workerThread(size_t num)
+{
+    setThreadName("ParalInsert");
+
+    while (true)
+    {
+        Block block;
+        queue.pop(block);
+
+        if (!block)
+            break;
+
+        /// After an exception, keep draining the queue so that the writing thread does not block on push.
+        if (has_exception)
+            continue;
+
+        try
+        {
+            outputs[num]->write(block);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+                exception = std::current_exception();
+            has_exception = true;
+        }
+    }
+}
+
+
+void ParallelizingBlockOutputStream::waitForWorkers()
+{
+    if (!started || finished)
+        return;
+    finished = true;
+
+    for (size_t i = 0; i < threads.size(); ++i)
+        queue.push(Block());
+
+    for (auto & thread : threads)
+        thread.join();
+}
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Core/Block.h>
+#include <DataStreams/IBlockOutputStream.h>
+#include <Common/ConcurrentBoundedQueue.h>
+
+
+namespace DB
+{
+
+/** Distributes the written blocks over several underlying output streams, each served by its own thread.
+  * write() only puts the block into a queue; the worker threads pull from it and push downstream.
+  * Used for INSERT SELECT (see the max_insert_threads setting): parts formed by different sinks
+  *  are independent, so sorting and compression run in parallel.
+  *
+  * The distribution of blocks over the underlying streams is not defined.
+  */
+class ParallelizingBlockOutputStream : public IBlockOutputStream
+{
+public:
+    ParallelizingBlockOutputStream(std::vector<BlockOutputStreamPtr> outputs_);
+    ~ParallelizingBlockOutputStream() override;
+
+    void write(const Block & block) override;
+    void writePrefix() override;
+    void writeSuffix() override;
+
+private:
+    void workerThread(size_t num);
+
+    /// Signals the workers to stop and waits for them. Does not rethrow.
+    void waitForWorkers();
+
+    std::vector<BlockOutputStreamPtr> outputs;
+
+    /// An empty block is the signal for a worker to stop.
+    ConcurrentBoundedQueue<Block> queue;
+    std::vector<std::thread> threads;
+    bool started = false;
+    bool finished = false;
+
+    std::atomic<bool> has_exception {false};
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+};
+
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <thread>
+
+#include <Common/ConcurrentBoundedQueue.h>
+#include <Common/MemoryTracker.h>
 #include <DataStreams/copyData.h>
 #include <DataStreams/IBlockOutputStream.h>
 #include <DataStreams/OneBlockInputStream.h>
@@ -13,6 +17,12 @@ namespace DB
 
 
 /** Writes data to the specified table and to all dependent materialized views.
+  *
+  * With the `parallel_view_processing` setting, each view is pushed to in its own thread,
+  *  so that the latency of a block is that of the slowest view rather than the sum of all of them.
+  * With the `async_view_processing` setting, the views are fed from a background thread,
+  *  overlapping them with writes to the main table; the INSERT waits for the views
+  *  (and reports their errors) only at writeSuffix, after the main table was written.
   */
 class PushingToViewsBlockOutputStream : public IBlockOutputStream
 {
@@ -37,14 +47,27 @@ public:
         output = storage->write(query_ptr, context.getSettingsRef());
     }
 
+    ~PushingToViewsBlockOutputStream() override
+    {
+        /// If the query failed before writeSuffix, stop the background thread, suppressing its error.
+        if (views_thread.joinable())
+        {
+            blocks_for_views.emplace();
+            views_thread.join();
+        }
+    }
+
     void write(const Block & block) override
     {
-        for (auto & view : views)
+        if (!views.empty())
         {
-            BlockInputStreamPtr from = std::make_shared<OneBlockInputStream>(block);
-            InterpreterSelectQuery select(view.first, context, QueryProcessingStage::Complete, 0, from);
-            BlockInputStreamPtr data = std::make_shared<MaterializingBlockInputStream>(select.execute().in);
-            copyData(*data, *view.second);
+            if (context.getSettingsRef().async_view_processing)
+            {
+                startViewsThread();
+                blocks_for_views.push(block);
+            }
+            else
+                writeToViews(block);
         }
 
         if (output)
@@ -67,14 +90,114 @@ public:
     {
         if (output)
             output->writeSuffix();
+
+        /// The views lag slightly behind the main table; their deferred errors surface here.
+        finishViewsThread();
     }
 
 private:
+    void writeToViews(const Block & block)
+    {
+        if (context.getSettingsRef().parallel_view_processing && views.size() > 1)
+        {
+            std::vector<std::exception_ptr> exceptions(views.size());
+            std::vector<std::thread> threads;
+            threads.reserve(views.size());
+
+            MemoryTracker * memory_tracker = current_memory_tracker;
+
+            for (size_t i = 0; i < views.size(); ++i)
+                threads.emplace_back([&, i, memory_tracker]
+                {
+                    /// Account the allocations of the view pipeline to the query that does the insertion.
+                    current_memory_tracker = memory_tracker;
+
+                    try
+                    {
+                        writeToView(views[i], block);
+                    }
+                    catch (...)
+                    {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
+
+            for (auto & thread : threads)
+                thread.join();
+
+            for (auto & exception : exceptions)
+                if (exception)
+                    std::rethrow_exception(exception);
+        }
+        else
+        {
+            for (auto & view : views)
+                writeToView(view, block);
+        }
+    }
+
+    void writeToView(std::pair<ASTPtr, BlockOutputStreamPtr> & view, const Block & block)
+    {
+        BlockInputStreamPtr from = std::make_shared<OneBlockInputStream>(block);
+        InterpreterSelectQuery select(view.first, context, QueryProcessingStage::Complete, 0, from);
+        BlockInputStreamPtr data = std::make_shared<MaterializingBlockInputStream>(select.execute().in);
+        copyData(*data, *view.second);
+    }
+
+    void startViewsThread()
+    {
+        if (views_thread.joinable())
+            return;
+
+        MemoryTracker * memory_tracker = current_memory_tracker;
+
+        views_thread = std::thread([this, memory_tracker]
+        {
+            current_memory_tracker = memory_tracker;
+
+            while (true)
+            {
+                Block block;
+                blocks_for_views.pop(block);
+                if (!block)
+                    break;
+
+                /// Remember the first error but keep draining the queue, so that `write` does not block.
+                try
+                {
+                    writeToViews(block);
+                }
+                catch (...)
+                {
+                    if (!views_exception)
+                        views_exception = std::current_exception();
+                }
+            }
+        });
+    }
+
+    void finishViewsThread()
+    {
+        if (!views_thread.joinable())
+            return;
+
+        blocks_for_views.emplace();
+        views_thread.join();
+
+        if (views_exception)
+            std::rethrow_exception(views_exception);
+    }
+
     StoragePtr storage;
     BlockOutputStreamPtr output;
     const Context & context;
     ASTPtr query_ptr;
     std::vector<std::pair<ASTPtr, BlockOutputStreamPtr>> views;
+
+    /// For async_view_processing: blocks pending to be pushed to the views (an empty block terminates).
+    ConcurrentBoundedQueue<Block> blocks_for_views{16};
+    std::thread views_thread;
+    std::exception_ptr views_exception;
 };
 
 
@@ -58,7 +58,18 @@ RemoteBlockInputStream::RemoteBlockInputStream(
 
     create_multiplexed_connections = [this, pool, throttler]()
     {
-        const Settings & settings = context.getSettingsRef();
+        const Settings & current_settings = context.getSettingsRef();
+
+        /** For hedged requests (see hedged_request_timeout_ms), get one more connection - the backup replica.
+          * Queries with external tables are not hedged: their data streams can be read only once.
+          */
+        bool use_hedged_requests = current_settings.hedged_request_timeout_ms.totalMilliseconds() != 0
+            && current_settings.max_parallel_replicas <= 1
+            && external_tables.empty();
+
+        Settings settings = current_settings;
+        if (use_hedged_requests)
+            settings.max_parallel_replicas = 2;
 
         std::vector<IConnectionPool::Entry> connections;
         if (main_table)
@@ -71,8 +82,59 @@ RemoteBlockInputStream::RemoteBlockInputStream(
         else
             connections = pool->getMany(&settings, pool_mode);
 
+        IConnectionPool::Entry backup;
+        if (use_hedged_requests && connections.size() > 1)
+        {
+            backup = std::move(connections.back());
+            connections.pop_back();
+        }
+
+        auto res = std::make_unique<MultiplexedConnections>(
+                std::move(connections), current_settings, throttler, append_extra_info);
+
+        if (!backup.isNull())
+            res->setBackupReplica(std::move(backup), throttler);
+
+        return res;
+    };
+}
+
+RemoteBlockInputStream::RemoteBlockInputStream(
+        const ConnectionPoolWithFailoverPtrs & pools,
+        const String & query_, const Context & context_, const Settings * settings,
+        const ThrottlerPtr & throttler, const Tables & external_tables_, QueryProcessingStage::Enum stage_)
+    : query(query_), context(context_), external_tables(external_tables_), stage(stage_)
+{
+    if (settings)
+        context.setSettings(*settings);
+
+    create_multiplexed_connections = [this, pools, throttler]()
+    {
+        const Settings & current_settings = context.getSettingsRef();
+
+        /// One connection per shard: parallel replicas within a shard are not used in this mode.
+        /// Unavailable shards are silently skipped here if skip_unavailable_shards is set.
+        std::vector<IConnectionPool::Entry> connections;
+        connections.reserve(pools.size());
+
+        for (const auto & shard_pool : pools)
+        {
+            if (main_table)
+            {
+                auto try_results = shard_pool->getManyChecked(&current_settings, PoolMode::GET_ONE, main_table.value());
+                for (auto & try_result : try_results)
+                    connections.emplace_back(std::move(try_result.entry));
+            }
+            else
+            {
+                auto entries = shard_pool->getMany(&current_settings, PoolMode::GET_ONE);
+                for (auto & entry : entries)
+                    connections.emplace_back(std::move(entry));
+            }
+        }
+
         return std::make_unique<MultiplexedConnections>(
-                std::move(connections), settings, throttler, append_extra_info);
+                std::move(connections), current_settings, throttler, append_extra_info, /* multiplex_shards = */ true);
     };
 }
 
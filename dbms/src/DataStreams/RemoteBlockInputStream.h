@@ -44,6 +44,15 @@ public:
             const ThrottlerPtr & throttler = nullptr, const Tables & external_tables_ = Tables(),
             QueryProcessingStage::Enum stage_ = QueryProcessingStage::Complete);
 
+    /// Takes pools of several shards and gets one connection from each of them.
+    /// All the connections are then served by a single thread (see distributed_connections_per_stream).
+    /// If `settings` is nullptr, settings will be taken from context.
+    RemoteBlockInputStream(
+            const ConnectionPoolWithFailoverPtrs & pools,
+            const String & query_, const Context & context_, const Settings * settings = nullptr,
+            const ThrottlerPtr & throttler = nullptr, const Tables & external_tables_ = Tables(),
+            QueryProcessingStage::Enum stage_ = QueryProcessingStage::Complete);
+
     ~RemoteBlockInputStream() override;
 
     /// Specify how we allocate connections on a shard.
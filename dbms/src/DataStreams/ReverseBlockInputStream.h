@@ -0,0 +1,68 @@
+#pragma once
+
+#include <DataStreams/IProfilingBlockInputStream.h>
+
+
+namespace DB
+{
+
+/** Emits the blocks of the source in reverse order, also reversing the rows of each block.
+  * Reads the source completely into memory before emitting anything, so it should only wrap
+  *  streams that read a bounded amount of data (e.g. a few granules of a MergeTree part).
+  * Used for reading in the descending order of the primary key
+  *  (see MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsInPKOrder).
+  */
+class ReverseBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    ReverseBlockInputStream(const BlockInputStreamPtr & input)
+    {
+        children.push_back(input);
+    }
+
+    String getName() const override { return "Reverse"; }
+
+    String getID() const override
+    {
+        return "Reverse(" + children.back()->getID() + ")";
+    }
+
+protected:
+    Block readImpl() override
+    {
+        if (!read_all)
+        {
+            while (Block block = children.back()->read())
+                blocks.push_back(block);
+            read_all = true;
+        }
+
+        if (blocks.empty())
+            return {};
+
+        Block res = blocks.back();
+        blocks.pop_back();
+
+        size_t rows = res.rows();
+        if (rows > 1)
+        {
+            IColumn::Permutation perm(rows);
+            for (size_t i = 0; i < rows; ++i)
+                perm[i] = rows - 1 - i;
+
+            for (size_t i = 0; i < res.columns(); ++i)
+            {
+                ColumnWithTypeAndName & elem = res.safeGetByPosition(i);
+                elem.column = elem.column->permute(perm, 0);
+            }
+        }
+
+        return res;
+    }
+
+private:
+    bool read_all = false;
+    Blocks blocks;
+};
+
+}
@@ -23,8 +23,8 @@ SquashingTransform::Result SquashingTransform::add(Block && block)
             return Result(std::move(block));
 
         /// Return accumulated data (may be it has small size) and place new block to accumulated data.
+        /// Cloning of its shared columns is deferred to `append`: if nothing gets appended, the block is passed on as is.
         accumulated_block.swap(block);
-        accumulated_block.unshareColumns();
         return Result(std::move(block));
     }
 
@@ -33,7 +33,6 @@ SquashingTransform::Result SquashingTransform::add(Block && block)
     {
         /// Return accumulated data and place new block to accumulated data.
         accumulated_block.swap(block);
-        accumulated_block.unshareColumns();
         return Result(std::move(block));
     }
 
@@ -56,16 +55,26 @@ void SquashingTransform::append(Block && block)
     if (!accumulated_block)
     {
         accumulated_block = std::move(block);
-        accumulated_block.unshareColumns();
         return;
     }
 
+    /// The accumulated columns are about to be mutated; until this point they may still be shared
+    ///  with the source of the block, so clone them only now (no-op on subsequent appends).
+    accumulated_block.unshareColumns();
+
     size_t columns = block.columns();
     size_t rows = block.rows();
+    size_t accumulated_rows = accumulated_block.rows();
 
     for (size_t i = 0; i < columns; ++i)
-        accumulated_block.getByPosition(i).column->insertRangeFrom(
-            *block.getByPosition(i).column, 0, rows);
+    {
+        auto & column = accumulated_block.getByPosition(i).column;
+
+        /// Reserve for the target block size right away instead of growing with every small block.
+        column->reserve(std::max(min_block_size_rows, accumulated_rows + rows));
+
+        column->insertRangeFrom(*block.getByPosition(i).column, 0, rows);
+    }
 }
 
 
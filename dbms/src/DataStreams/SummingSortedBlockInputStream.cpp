@@ -1,6 +1,8 @@
 #include <DataStreams/SummingSortedBlockInputStream.h>
 #include <DataTypes/DataTypeNested.h>
 #include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Columns/ColumnsNumber.h>
 #include <Common/StringUtils.h>
 #include <Core/FieldVisitors.h>
 #include <common/logger_useful.h>
@@ -31,11 +33,39 @@ String SummingSortedBlockInputStream::getID() const
 
 void SummingSortedBlockInputStream::insertCurrentRow(ColumnPlainPtrs & merged_columns)
 {
+    /// The sums of numeric columns live in the typed accumulators, not in current_row.
+    for (const auto & acc : column_sums)
+        current_row[acc.column_number] = acc.toField();
+
     for (size_t i = 0; i < num_columns; ++i)
         merged_columns[i]->insert(current_row[i]);
 }
 
 
+bool SummingSortedBlockInputStream::tryInitAccumulator(const IDataType & type, size_t column_number, ColumnSumAccumulator & acc)
+{
+    using Kind = ColumnSumAccumulator::Kind;
+
+    acc.column_number = column_number;
+    acc.reset();
+
+    if (typeid_cast<const DataTypeUInt8 *>(&type))        { acc.kind = Kind::UInt;  acc.add_range = ColumnSumAccumulator::addRangeUInt<ColumnUInt8>; }
+    else if (typeid_cast<const DataTypeUInt16 *>(&type))  { acc.kind = Kind::UInt;  acc.add_range = ColumnSumAccumulator::addRangeUInt<ColumnUInt16>; }
+    else if (typeid_cast<const DataTypeUInt32 *>(&type))  { acc.kind = Kind::UInt;  acc.add_range = ColumnSumAccumulator::addRangeUInt<ColumnUInt32>; }
+    else if (typeid_cast<const DataTypeUInt64 *>(&type))  { acc.kind = Kind::UInt;  acc.add_range = ColumnSumAccumulator::addRangeUInt<ColumnUInt64>; }
+    else if (typeid_cast<const DataTypeInt8 *>(&type))    { acc.kind = Kind::Int;   acc.add_range = ColumnSumAccumulator::addRangeInt<ColumnInt8>; }
+    else if (typeid_cast<const DataTypeInt16 *>(&type))   { acc.kind = Kind::Int;   acc.add_range = ColumnSumAccumulator::addRangeInt<ColumnInt16>; }
+    else if (typeid_cast<const DataTypeInt32 *>(&type))   { acc.kind = Kind::Int;   acc.add_range = ColumnSumAccumulator::addRangeInt<ColumnInt32>; }
+    else if (typeid_cast<const DataTypeInt64 *>(&type))   { acc.kind = Kind::Int;   acc.add_range = ColumnSumAccumulator::addRangeInt<ColumnInt64>; }
+    else if (typeid_cast<const DataTypeFloat32 *>(&type)) { acc.kind = Kind::Float; acc.add_range = ColumnSumAccumulator::addRangeFloat<ColumnFloat32>; }
+    else if (typeid_cast<const DataTypeFloat64 *>(&type)) { acc.kind = Kind::Float; acc.add_range = ColumnSumAccumulator::addRangeFloat<ColumnFloat64>; }
+    else
+        return false;
+
+    return true;
+}
+
+
 namespace
 {
     bool isInPrimaryKey(const SortDescription & description, const std::string & name, const size_t number)
@@ -54,7 +84,8 @@ Block SummingSortedBlockInputStream::readImpl()
     if (finished)
         return Block();
 
-    if (children.size() == 1)
+    /// With a single source the result is the same as the input, but the row sources must still be written.
+    if (children.size() == 1 && !out_row_sources_buf)
         return children[0]->read();
 
     Block merged_block;
@@ -110,7 +141,11 @@ Block SummingSortedBlockInputStream::readImpl()
                     || column_names_to_sum.end() !=
                        std::find(column_names_to_sum.begin(), column_names_to_sum.end(), column.name))
                 {
-                    column_numbers_to_sum.push_back(i);
+                    ColumnSumAccumulator acc;
+                    if (tryInitAccumulator(*column.type, i, acc))
+                        column_sums.emplace_back(acc);
+                    else
+                        column_numbers_to_sum.push_back(i);
                 }
             }
         }
@@ -213,16 +248,63 @@ void SummingSortedBlockInputStream::merge(ColumnPlainPtrs & merged_columns, std:
                 ++merged_rows;
                 output_is_non_empty = true;
                 insertCurrentRow(merged_columns);
+
+                /// The non-summed columns of the group are the ones of its first row.
+                if (out_row_sources_buf)
+                    current_row_sources.front().setSkipFlag(false);
+            }
+
+            if (out_row_sources_buf)
+            {
+                out_row_sources_buf->write(
+                    reinterpret_cast<const char *>(current_row_sources.data()),
+                    current_row_sources.size() * sizeof(RowSourcePart));
+                current_row_sources.resize(0);
             }
 
             current_key.swap(next_key);
 
             setRow(current_row, current);
+
+            /// The sums of the new group start from the values of its first row.
+            for (auto & acc : column_sums)
+            {
+                acc.reset();
+                acc.add_range(acc, *current->all_columns[acc.column_number], current->pos, current->pos + 1);
+            }
+
             current_row_is_zero = false;
         }
         else
         {
-            current_row_is_zero = !addRow(current_row, current);
+            current_row_is_zero = !addRows(current, current->pos, current->pos + 1);
+        }
+
+        /// true flag value means "skip row"
+        if (out_row_sources_buf)
+            current_row_sources.emplace_back(current.impl->order, true);
+
+        /** Rows with the same key from the same cursor can be taken right away: summation is
+          *  commutative, so it does not matter that rows with this key from other cursors
+          *  will only be added afterwards. This sums whole runs in one pass per column
+          *  instead of returning to the queue for every row.
+          */
+        if (!current->isLast())
+        {
+            size_t run_end = current->pos + 1;    /// Past-the-end of the run of rows with the same key.
+            while (run_end < current->rows && equalKeysAt(current, run_end - 1, run_end))
+                ++run_end;
+
+            if (run_end != current->pos + 1)
+            {
+                current_row_is_zero = !addRows(current, current->pos + 1, run_end);
+
+                if (out_row_sources_buf)
+                    for (size_t i = current->pos + 1; i < run_end; ++i)
+                        current_row_sources.emplace_back(current.impl->order, true);
+
+                current->pos = run_end - 1;
+            }
         }
 
         if (!current->isLast())
@@ -243,19 +325,30 @@ void SummingSortedBlockInputStream::merge(ColumnPlainPtrs & merged_columns, std:
     {
         ++merged_rows;  /// Dead store (result is unused). Left for clarity.
         insertCurrentRow(merged_columns);
+
+        if (out_row_sources_buf && !current_row_sources.empty())
+            current_row_sources.front().setSkipFlag(false);
+    }
+
+    if (out_row_sources_buf)
+    {
+        out_row_sources_buf->write(
+            reinterpret_cast<const char *>(current_row_sources.data()),
+            current_row_sources.size() * sizeof(RowSourcePart));
+        current_row_sources.resize(0);
     }
 
     finished = true;
 }
 
 template <typename TSortCursor>
-bool SummingSortedBlockInputStream::mergeMaps(Row & row, TSortCursor & cursor)
+bool SummingSortedBlockInputStream::mergeMaps(Row & row, TSortCursor & cursor, size_t row_num)
 {
     bool non_empty_map_present = false;
 
     /// merge nested maps
     for (const auto & map : maps_to_sum)
-        if (mergeMap(map, row, cursor))
+        if (mergeMap(map, row, cursor, row_num))
             non_empty_map_present = true;
 
     return non_empty_map_present;
@@ -263,7 +356,7 @@ bool SummingSortedBlockInputStream::mergeMaps(Row & row, TSortCursor & cursor)
 
 
 template <typename TSortCursor>
-bool SummingSortedBlockInputStream::mergeMap(const MapDescription & desc, Row & row, TSortCursor & cursor)
+bool SummingSortedBlockInputStream::mergeMap(const MapDescription & desc, Row & row, TSortCursor & cursor, size_t cursor_row_num)
 {
     /// Strongly non-optimal.
 
@@ -271,10 +364,10 @@ bool SummingSortedBlockInputStream::mergeMap(const MapDescription & desc, Row &
     Row right(left.size());
 
     for (size_t col_num : desc.key_col_nums)
-        right[col_num] = (*cursor->all_columns[col_num])[cursor->pos].template get<Array>();
+        right[col_num] = (*cursor->all_columns[col_num])[cursor_row_num].template get<Array>();
 
     for (size_t col_num : desc.val_col_nums)
-        right[col_num] = (*cursor->all_columns[col_num])[cursor->pos].template get<Array>();
+        right[col_num] = (*cursor->all_columns[col_num])[cursor_row_num].template get<Array>();
 
     auto at_ith_column_jth_row = [&](const Row & matrix, size_t i, size_t j) -> const Field &
     {
@@ -347,17 +440,32 @@ bool SummingSortedBlockInputStream::mergeMap(const MapDescription & desc, Row &
 
 
 template <typename TSortCursor>
-bool SummingSortedBlockInputStream::addRow(Row & row, TSortCursor & cursor)
+bool SummingSortedBlockInputStream::addRows(TSortCursor & cursor, size_t begin, size_t end)
 {
-    bool res = mergeMaps(row, cursor);    /// Is there at least one non-zero number or non-empty array
+    bool res = false;
 
-    for (size_t i = 0, size = column_numbers_to_sum.size(); i < size; ++i)
+    /// Nested maps and columns without a typed accumulator are processed row by row.
+    if (!maps_to_sum.empty() || !column_numbers_to_sum.empty())
     {
-        size_t j = column_numbers_to_sum[i];
-        if (applyVisitor(FieldVisitorSum((*cursor->all_columns[j])[cursor->pos]), row[j]))
-            res = true;
+        for (size_t row_num = begin; row_num < end; ++row_num)
+        {
+            /// Is there at least one non-empty array after the merge.
+            res = mergeMaps(current_row, cursor, row_num);
+
+            for (size_t j : column_numbers_to_sum)
+                if (applyVisitor(FieldVisitorSum((*cursor->all_columns[j])[row_num]), current_row[j]))
+                    res = true;
+        }
     }
 
+    /// Numeric columns are summed over the whole range in one pass per column.
+    for (auto & acc : column_sums)
+        acc.add_range(acc, *cursor->all_columns[acc.column_number], begin, end);
+
+    for (const auto & acc : column_sums)
+        if (!acc.isZero())
+            res = true;
+
     return res;
 }
 
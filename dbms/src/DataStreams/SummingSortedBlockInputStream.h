@@ -26,8 +26,10 @@ public:
         const SortDescription & description_,
         /// List of columns to be summed. If empty, all numeric columns that are not in the description are taken.
         const Names & column_names_to_sum_,
-        size_t max_block_size_)
-        : MergingSortedBlockInputStream(inputs_, description_, max_block_size_), column_names_to_sum(column_names_to_sum_)
+        size_t max_block_size_,
+        WriteBuffer * out_row_sources_buf_ = nullptr)
+        : MergingSortedBlockInputStream(inputs_, description_, max_block_size_, 0, out_row_sources_buf_)
+        , column_names_to_sum(column_names_to_sum_)
     {
     }
 
@@ -47,8 +49,99 @@ private:
 
     /// Columns with which numbers should be summed.
     Names column_names_to_sum;    /// If set, it is converted to column_numbers_to_sum when initialized.
+
+    /// Summed columns that could not get a typed accumulator - they go through Field arithmetic.
     ColumnNumbers column_numbers_to_sum;
 
+    /** Typed accumulator for one summed numeric column.
+      * Values are read directly from ColumnVector data and accumulated in UInt64, Int64 or Float64 -
+      *  the same types Field arithmetic would use, so the results are identical,
+      *  but without boxing each value into a Field and dispatching on its type.
+      */
+    struct ColumnSumAccumulator
+    {
+        size_t column_number;
+
+        enum class Kind : UInt8
+        {
+            UInt,
+            Int,
+            Float,
+        };
+
+        Kind kind;
+
+        union
+        {
+            UInt64 uint_value;
+            Int64 int_value;
+            Float64 float_value;
+        };
+
+        /// Sums rows [begin, end) of the column into the accumulator. Instantiated for the concrete column type.
+        void (* add_range)(ColumnSumAccumulator &, const IColumn &, size_t begin, size_t end);
+
+        void reset() { uint_value = 0; }
+
+        bool isZero() const
+        {
+            switch (kind)
+            {
+                case Kind::UInt:  return uint_value == 0;
+                case Kind::Int:   return int_value == 0;
+                case Kind::Float: return float_value == 0;
+            }
+            __builtin_unreachable();
+        }
+
+        Field toField() const
+        {
+            switch (kind)
+            {
+                case Kind::UInt:  return uint_value;
+                case Kind::Int:   return int_value;
+                case Kind::Float: return float_value;
+            }
+            __builtin_unreachable();
+        }
+
+        template <typename ColumnType>
+        static void addRangeUInt(ColumnSumAccumulator & acc, const IColumn & column, size_t begin, size_t end)
+        {
+            const auto & data = static_cast<const ColumnType &>(column).getData();
+            UInt64 sum = 0;
+            for (size_t i = begin; i < end; ++i)
+                sum += data[i];
+            acc.uint_value += sum;
+        }
+
+        template <typename ColumnType>
+        static void addRangeInt(ColumnSumAccumulator & acc, const IColumn & column, size_t begin, size_t end)
+        {
+            const auto & data = static_cast<const ColumnType &>(column).getData();
+            Int64 sum = 0;
+            for (size_t i = begin; i < end; ++i)
+                sum += data[i];
+            acc.int_value += sum;
+        }
+
+        template <typename ColumnType>
+        static void addRangeFloat(ColumnSumAccumulator & acc, const IColumn & column, size_t begin, size_t end)
+        {
+            const auto & data = static_cast<const ColumnType &>(column).getData();
+            Float64 sum = 0;
+            for (size_t i = begin; i < end; ++i)
+                sum += data[i];
+            acc.float_value += sum;
+        }
+    };
+
+    /// Accumulators of the current group, one per summed column of a supported type.
+    std::vector<ColumnSumAccumulator> column_sums;
+
+    /// Fill the accumulator for a column of a supported numeric type. Returns false for other types.
+    static bool tryInitAccumulator(const IDataType & type, size_t column_number, ColumnSumAccumulator & acc);
+
     /** A table can have nested tables that are treated in a special way.
      *    If the name of the nested table ends in `Map` and it contains at least two columns,
      *    satisfying the following criteria:
@@ -87,6 +180,10 @@ private:
 
     bool output_is_non_empty = false;    /// Have we given out at least one row as a result.
 
+    /// Sources of the rows with the current primary key. The first row of a group is the one
+    ///  the non-summed columns are taken from, so only it is marked as not skipped.
+    PODArray<RowSourcePart> current_row_sources;
+
     /** We support two different cursors - with Collation and without.
      *  Templates are used instead of polymorphic SortCursor and calls to virtual functions.
      */
@@ -100,16 +197,28 @@ private:
       * all items are zero.
       */
     template <typename TSortCursor>
-    bool mergeMaps(Row & row, TSortCursor & cursor);
+    bool mergeMaps(Row & row, TSortCursor & cursor, size_t row_num);
 
     template <typename TSortCursor>
-    bool mergeMap(const MapDescription & map, Row & row, TSortCursor & cursor);
+    bool mergeMap(const MapDescription & map, Row & row, TSortCursor & cursor, size_t cursor_row_num);
 
-    /** Add the row under the cursor to the `row`.
+    /** Add rows [begin, end) of the cursor's current block to the current group.
+      * Numeric columns are summed over the whole range in one pass per column;
+      *  nested maps and Field-summed columns are processed row by row.
       * Returns false if the result is zero.
       */
     template <typename TSortCursor>
-    bool addRow(Row & row, TSortCursor & cursor);
+    bool addRows(TSortCursor & cursor, size_t begin, size_t end);
+
+    /// Whether rows `lhs` and `rhs` of the cursor's current block have equal values of the primary key columns.
+    template <typename TSortCursor>
+    static bool equalKeysAt(const TSortCursor & cursor, size_t lhs, size_t rhs)
+    {
+        for (size_t i = 0; i < cursor->sort_columns_size; ++i)
+            if (0 != cursor->sort_columns[i]->compareAt(lhs, rhs, *cursor->sort_columns[i], 1))
+                return false;
+        return true;
+    }
 };
 
 }
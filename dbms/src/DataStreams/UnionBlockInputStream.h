@@ -2,7 +2,7 @@
 
 #include <common/logger_useful.h>
 
-#include <Common/ConcurrentBoundedQueue.h>
+#include <Common/LockFreeBoundedQueue.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
 #include <DataStreams/ParallelInputsProcessor.h>
 
@@ -105,6 +105,12 @@ public:
         return res.str();
     }
 
+    /// Pin reading threads to NUMA nodes (see ParallelInputsProcessor::setNUMAAware).
+    void setNUMAAware(bool value)
+    {
+        processor.setNUMAAware(value);
+    }
+
 
     ~UnionBlockInputStream() override
     {
@@ -252,7 +258,9 @@ private:
 
 private:
     using Payload = OutputData<mode>;
-    using OutputQueue = ConcurrentBoundedQueue<Payload>;
+    /// Handoff from many workers to one consumer: the lock-free queue keeps the
+    ///  per-block exchange off a shared mutex at high thread counts.
+    using OutputQueue = LockFreeBoundedQueue<Payload>;
 
 private:
     /** The queue of the finished blocks. Also, you can put an exception instead of a block.
@@ -1,10 +1,19 @@
 #include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
 #include <Interpreters/evaluateConstantExpression.h>
 #include <Interpreters/convertFieldToType.h>
+#include <Interpreters/ExpressionAnalyzer.h>
+#include <Interpreters/ExpressionActions.h>
 #include <Parsers/TokenIterator.h>
 #include <Parsers/ExpressionListParsers.h>
+#include <Parsers/ASTIdentifier.h>
+#include <Parsers/ASTLiteral.h>
 #include <DataStreams/ValuesRowInputStream.h>
 #include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataTypes/FieldToDataType.h>
+#include <Columns/ColumnConst.h>
+#include <Columns/ColumnsNumber.h>
 #include <Core/FieldVisitors.h>
 #include <Core/Block.h>
 #include <Common/typeid_cast.h>
@@ -26,6 +35,26 @@ namespace ErrorCodes
 }
 
 
+namespace
+{
+
+/// Replace every literal in the expression with a named placeholder, collecting the literals.
+void replaceLiteralsWithPlaceholders(ASTPtr & ast, std::vector<Field> & literals)
+{
+    if (const ASTLiteral * literal = typeid_cast<const ASTLiteral *>(ast.get()))
+    {
+        literals.emplace_back(literal->value);
+        ast = std::make_shared<ASTIdentifier>(ast->range, "_template_arg_" + toString(literals.size() - 1));
+        return;
+    }
+
+    for (auto & child : ast->children)
+        replaceLiteralsWithPlaceholders(child, literals);
+}
+
+}
+
+
 ValuesRowInputStream::ValuesRowInputStream(ReadBuffer & istr_, const Context & context_, bool interpret_expressions_)
     : istr(istr_), context(context_), interpret_expressions(interpret_expressions_)
 {
@@ -34,6 +63,55 @@ ValuesRowInputStream::ValuesRowInputStream(ReadBuffer & istr_, const Context & c
 }
 
 
+std::pair<Field, std::shared_ptr<IDataType>> ValuesRowInputStream::evaluateExpressionWithTemplate(ASTPtr & ast)
+{
+    /** Typical clients (ORMs) emit the same expression in every row, differing only in literals:
+      *  (1, now(), toDate('2017-09-01')), (2, now(), toDate('2017-09-02')), ...
+      * Building an ExpressionAnalyzer and ExpressionActions for every value is tens of times
+      *  more expensive than executing them. So compiled actions are cached by the structure
+      *  of the expression - with literals replaced by placeholder columns - and for subsequent
+      *  rows only the literals are substituted as constant columns.
+      */
+    ASTPtr templ = ast->clone();
+
+    std::vector<Field> literals;
+    replaceLiteralsWithPlaceholders(templ, literals);
+
+    /// The dummy column determines the number of rows even when the expression has no arguments.
+    Block arguments
+    {
+        { std::make_shared<ColumnConst>(std::make_shared<ColumnUInt8>(1, 0), 1), std::make_shared<DataTypeUInt8>(), "_dummy" }
+    };
+
+    NamesAndTypesList argument_types{{ "_dummy", std::make_shared<DataTypeUInt8>() }};
+
+    String key = templ->getColumnName();
+
+    for (size_t i = 0; i < literals.size(); ++i)
+    {
+        DataTypePtr literal_type = applyVisitor(FieldToDataType(), literals[i]);
+        String name = "_template_arg_" + toString(i);
+
+        arguments.insert({ literal_type->createConstColumn(1, literals[i]), literal_type, name });
+        argument_types.emplace_back(name, literal_type);
+
+        /// The same structure over literals of different types compiles to different actions.
+        key += '/';
+        key += literal_type->getName();
+    }
+
+    auto it = expression_templates.find(key);
+    if (it == expression_templates.end())
+        it = expression_templates.emplace(key,
+            ExpressionAnalyzer(templ, context, nullptr, argument_types).getActions(false)).first;
+
+    it->second->execute(arguments);
+
+    const ColumnWithTypeAndName & result = arguments.getByName(templ->getColumnName());
+    return std::make_pair((*result.column)[0], result.type);
+}
+
+
 bool ValuesRowInputStream::read(Block & block)
 {
     size_t size = block.columns();
@@ -111,7 +189,25 @@ bool ValuesRowInputStream::read(Block & block)
 
                 istr.position() = const_cast<char *>(token_iterator->begin);
 
-                std::pair<Field, DataTypePtr> value_raw = evaluateConstantExpression(ast, context);
+                std::pair<Field, DataTypePtr> value_raw;
+                if (ASTLiteral * literal = typeid_cast<ASTLiteral *>(ast.get()))
+                {
+                    /// A bare literal needs no actions at all.
+                    value_raw = std::make_pair(literal->value, applyVisitor(FieldToDataType(), literal->value));
+                }
+                else
+                {
+                    try
+                    {
+                        value_raw = evaluateExpressionWithTemplate(ast);
+                    }
+                    catch (...)
+                    {
+                        /// Whatever the template path cannot handle is evaluated the old, slow way.
+                        value_raw = evaluateConstantExpression(ast, context);
+                    }
+                }
+
                 Field value = convertFieldToType(value_raw.first, type, value_raw.second.get());
 
                 if (value.isNull())
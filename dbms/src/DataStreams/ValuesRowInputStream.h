@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <unordered_map>
+
+#include <Core/Field.h>
 #include <DataStreams/IRowInputStream.h>
 
 
@@ -9,6 +13,9 @@ namespace DB
 class Block;
 class Context;
 class ReadBuffer;
+class IAST;
+class IDataType;
+class ExpressionActions;
 
 
 /** Stream to read data in VALUES format (as in INSERT query).
@@ -28,6 +35,14 @@ private:
     ReadBuffer & istr;
     const Context & context;
     bool interpret_expressions;
+
+    /// Evaluate an expression instead of a value, reusing compiled actions for rows
+    ///  with the same expression structure (see the comment in the implementation).
+    std::pair<Field, std::shared_ptr<IDataType>> evaluateExpressionWithTemplate(std::shared_ptr<IAST> & ast);
+
+    /// Compiled actions, keyed by the expression structure with literals replaced
+    ///  by placeholders, plus the types of the literals.
+    std::unordered_map<String, std::shared_ptr<ExpressionActions>> expression_templates;
 };
 
 }
@@ -100,14 +100,10 @@ void DataTypeAggregateFunction::serializeBinaryBulk(const IColumn & column, Writ
     const ColumnAggregateFunction & real_column = typeid_cast<const ColumnAggregateFunction &>(column);
     const ColumnAggregateFunction::Container_t & vec = real_column.getData();
 
-    ColumnAggregateFunction::Container_t::const_iterator it = vec.begin() + offset;
-    ColumnAggregateFunction::Container_t::const_iterator end = limit ? it + limit : vec.end();
+    size_t end = limit && offset + limit < vec.size() ? offset + limit : vec.size();
 
-    if (end > vec.end())
-        end = vec.end();
-
-    for (; it != end; ++it)
-        function->serialize(*it, ostr);
+    if (end > offset)
+        function->serializeBatch(&vec[offset], end - offset, ostr);
 }
 
 void DataTypeAggregateFunction::deserializeBinaryBulk(IColumn & column, ReadBuffer & istr, size_t limit, double avg_value_size_hint) const
@@ -120,27 +116,61 @@ void DataTypeAggregateFunction::deserializeBinaryBulk(IColumn & column, ReadBuff
     vec.reserve(vec.size() + limit);
 
     size_t size_of_state = function->sizeOfData();
+    size_t fixed_layout_size = function->sizeOfFixedLayoutSerialization();
 
-    for (size_t i = 0; i < limit; ++i)
-    {
-        if (istr.eof())
-            break;
-
-        AggregateDataPtr place = arena.alloc(size_of_state);
+    /// Allocate the states in slabs of up to this many, not one by one: fewer arena calls,
+    ///  and states read together lie together, which speeds up their subsequent merge.
+    static constexpr size_t states_per_slab = 256;
 
-        function->create(place);
+    size_t i = 0;
+    while (i < limit && !istr.eof())
+    {
+        size_t slab_states = std::min(limit - i, states_per_slab);
 
-        try
+        if (fixed_layout_size && fixed_layout_size == size_of_state)
         {
-            function->deserialize(place, istr, &arena);
+            /// The serialization is a plain copy of the state: take all whole states available
+            ///  in the buffer with one memcpy, without per-state `create` and `deserialize`.
+            size_t states_in_buffer = (istr.buffer().end() - istr.position()) / size_of_state;
+            size_t bulk_states = std::min(slab_states, states_in_buffer);
+
+            if (bulk_states)
+            {
+                AggregateDataPtr slab = arena.alloc(size_of_state * bulk_states);
+                memcpy(slab, istr.position(), size_of_state * bulk_states);
+                istr.position() += size_of_state * bulk_states;
+
+                for (size_t j = 0; j < bulk_states; ++j)
+                    vec.push_back(slab + j * size_of_state);
+
+                i += bulk_states;
+                continue;
+            }
+
+            /// A state is split across the buffer boundary: read just it the generic way.
+            slab_states = 1;
         }
-        catch (...)
+
+        AggregateDataPtr slab = arena.alloc(size_of_state * slab_states);
+
+        for (size_t j = 0; j < slab_states && !istr.eof(); ++j, ++i)
         {
-            function->destroy(place);
-            throw;
-        }
+            AggregateDataPtr place = slab + j * size_of_state;
+
+            function->create(place);
 
-        vec.push_back(place);
+            try
+            {
+                function->deserialize(place, istr, &arena);
+            }
+            catch (...)
+            {
+                function->destroy(place);
+                throw;
+            }
+
+            vec.push_back(place);
+        }
     }
 }
 
@@ -0,0 +1,239 @@
+#include <DataTypes/DataTypeDictionary.h>
+#include <DataTypes/DataTypeFactory.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypeFixedString.h>
+#include <Columns/ColumnDictionary.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <Parsers/ASTFunction.h>
+#include <Common/typeid_cast.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int BAD_ARGUMENTS;
+    extern const int ILLEGAL_COLUMN;
+    extern const int NUMBER_OF_ARGUMENTS_DOESNT_MATCH;
+}
+
+
+DataTypeDictionary::DataTypeDictionary(const DataTypePtr & nested_)
+    : nested(nested_)
+{
+    if (!nested->isNumeric()
+        && !typeid_cast<const DataTypeString *>(nested.get())
+        && !typeid_cast<const DataTypeFixedString *>(nested.get()))
+        throw Exception("Dictionary type can only wrap numbers, String and FixedString, but got " + nested->getName(),
+            ErrorCodes::BAD_ARGUMENTS);
+}
+
+
+static const ColumnDictionary & getDictionaryColumn(const IColumn & column)
+{
+    const ColumnDictionary * res = typeid_cast<const ColumnDictionary *>(&column);
+    if (!res)
+        throw Exception("Unexpected column " + column.getName() + " for data type Dictionary", ErrorCodes::ILLEGAL_COLUMN);
+    return *res;
+}
+
+static ColumnDictionary & getDictionaryColumn(IColumn & column)
+{
+    ColumnDictionary * res = typeid_cast<ColumnDictionary *>(&column);
+    if (!res)
+        throw Exception("Unexpected column " + column.getName() + " for data type Dictionary", ErrorCodes::ILLEGAL_COLUMN);
+    return *res;
+}
+
+
+void DataTypeDictionary::serializeBinary(const Field & field, WriteBuffer & ostr) const
+{
+    nested->serializeBinary(field, ostr);
+}
+
+void DataTypeDictionary::deserializeBinary(Field & field, ReadBuffer & istr) const
+{
+    nested->deserializeBinary(field, istr);
+}
+
+void DataTypeDictionary::serializeBinary(const IColumn & column, size_t row_num, WriteBuffer & ostr) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeBinary(*col.getDictionary(), col.getIndexes()[row_num], ostr);
+}
+
+template <typename F>
+void DataTypeDictionary::deserializeValueImpl(IColumn & column, F && deserialize) const
+{
+    ColumnDictionary & col = getDictionaryColumn(column);
+    ColumnPtr tmp = nested->createColumn();
+    deserialize(*tmp);
+    col.insertFromFullColumn(*tmp, 0);
+}
+
+void DataTypeDictionary::deserializeBinary(IColumn & column, ReadBuffer & istr) const
+{
+    deserializeValueImpl(column, [&](IColumn & tmp) { nested->deserializeBinary(tmp, istr); });
+}
+
+
+void DataTypeDictionary::serializeBinaryBulk(const IColumn & column, WriteBuffer & ostr, size_t offset, size_t limit) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+
+    size_t size = col.size();
+    if (limit == 0 || offset + limit > size)
+        limit = size - offset;
+
+    if (limit == 0)
+        return;
+
+    const ColumnDictionary::Indexes & indexes = col.getIndexes();
+    const IColumn & dictionary = *col.getDictionary();
+
+    /// A chunk stores only the dictionary values that are actually referenced by its rows,
+    ///  numbered in the order of first use.
+    std::vector<ColumnDictionary::Index> global_to_local(dictionary.size(), std::numeric_limits<ColumnDictionary::Index>::max());
+    ColumnPtr local_dictionary = dictionary.cloneEmpty();
+    PaddedPODArray<ColumnDictionary::Index> local_indexes(limit);
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        ColumnDictionary::Index global = indexes[offset + i];
+        if (global_to_local[global] == std::numeric_limits<ColumnDictionary::Index>::max())
+        {
+            global_to_local[global] = local_dictionary->size();
+            local_dictionary->insertFrom(dictionary, global);
+        }
+        local_indexes[i] = global_to_local[global];
+    }
+
+    writeVarUInt(local_dictionary->size(), ostr);
+    nested->serializeBinaryBulk(*local_dictionary, ostr, 0, 0);
+    writeVarUInt(limit, ostr);
+    ostr.write(reinterpret_cast<const char *>(&local_indexes[0]), sizeof(local_indexes[0]) * limit);
+}
+
+void DataTypeDictionary::deserializeBinaryBulk(IColumn & column, ReadBuffer & istr, size_t limit, double avg_value_size_hint) const
+{
+    ColumnDictionary & col = getDictionaryColumn(column);
+    ColumnDictionary::Indexes & indexes = col.getIndexes();
+
+    size_t rows_read = 0;
+    while (rows_read < limit && !istr.eof())
+    {
+        if (col.deserialize_rows_pending == 0)
+        {
+            /// Start of the next chunk: merge its local dictionary into ours.
+            size_t local_dictionary_size = 0;
+            readVarUInt(local_dictionary_size, istr);
+
+            ColumnPtr local_dictionary = nested->createColumn();
+            nested->deserializeBinaryBulk(*local_dictionary, istr, local_dictionary_size, avg_value_size_hint);
+
+            col.deserialize_chunk_index_map.resize(local_dictionary_size);
+            for (size_t i = 0; i < local_dictionary_size; ++i)
+            {
+                col.getDictionaryForModification().insertFrom(*local_dictionary, i);
+                col.deserialize_chunk_index_map[i] = col.dedupLastDictionaryValue();
+            }
+
+            readVarUInt(col.deserialize_rows_pending, istr);
+        }
+
+        size_t to_read = std::min(limit - rows_read, col.deserialize_rows_pending);
+
+        PaddedPODArray<ColumnDictionary::Index> local_indexes(to_read);
+        istr.readStrict(reinterpret_cast<char *>(&local_indexes[0]), sizeof(local_indexes[0]) * to_read);
+
+        indexes.reserve(indexes.size() + to_read);
+        for (size_t i = 0; i < to_read; ++i)
+            indexes.push_back(col.deserialize_chunk_index_map[local_indexes[i]]);
+
+        col.deserialize_rows_pending -= to_read;
+        rows_read += to_read;
+    }
+}
+
+
+void DataTypeDictionary::serializeText(const IColumn & column, size_t row_num, WriteBuffer & ostr) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeText(*col.getDictionary(), col.getIndexes()[row_num], ostr);
+}
+
+void DataTypeDictionary::serializeTextEscaped(const IColumn & column, size_t row_num, WriteBuffer & ostr) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeTextEscaped(*col.getDictionary(), col.getIndexes()[row_num], ostr);
+}
+
+void DataTypeDictionary::deserializeTextEscaped(IColumn & column, ReadBuffer & istr) const
+{
+    deserializeValueImpl(column, [&](IColumn & tmp) { nested->deserializeTextEscaped(tmp, istr); });
+}
+
+void DataTypeDictionary::serializeTextQuoted(const IColumn & column, size_t row_num, WriteBuffer & ostr) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeTextQuoted(*col.getDictionary(), col.getIndexes()[row_num], ostr);
+}
+
+void DataTypeDictionary::deserializeTextQuoted(IColumn & column, ReadBuffer & istr) const
+{
+    deserializeValueImpl(column, [&](IColumn & tmp) { nested->deserializeTextQuoted(tmp, istr); });
+}
+
+void DataTypeDictionary::serializeTextJSON(const IColumn & column, size_t row_num, WriteBuffer & ostr, const FormatSettingsJSON & settings) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeTextJSON(*col.getDictionary(), col.getIndexes()[row_num], ostr, settings);
+}
+
+void DataTypeDictionary::deserializeTextJSON(IColumn & column, ReadBuffer & istr) const
+{
+    deserializeValueImpl(column, [&](IColumn & tmp) { nested->deserializeTextJSON(tmp, istr); });
+}
+
+void DataTypeDictionary::serializeTextXML(const IColumn & column, size_t row_num, WriteBuffer & ostr) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeTextXML(*col.getDictionary(), col.getIndexes()[row_num], ostr);
+}
+
+void DataTypeDictionary::serializeTextCSV(const IColumn & column, size_t row_num, WriteBuffer & ostr) const
+{
+    const ColumnDictionary & col = getDictionaryColumn(column);
+    nested->serializeTextCSV(*col.getDictionary(), col.getIndexes()[row_num], ostr);
+}
+
+void DataTypeDictionary::deserializeTextCSV(IColumn & column, ReadBuffer & istr, const char delimiter) const
+{
+    deserializeValueImpl(column, [&](IColumn & tmp) { nested->deserializeTextCSV(tmp, istr, delimiter); });
+}
+
+
+ColumnPtr DataTypeDictionary::createColumn() const
+{
+    return std::make_shared<ColumnDictionary>(nested->createColumn());
+}
+
+
+static DataTypePtr create(const ASTPtr & arguments)
+{
+    if (!arguments || arguments->children.size() != 1)
+        throw Exception("Dictionary data type family must have exactly one argument - nested type",
+            ErrorCodes::NUMBER_OF_ARGUMENTS_DOESNT_MATCH);
+
+    return std::make_shared<DataTypeDictionary>(DataTypeFactory::instance().get(arguments->children[0]));
+}
+
+
+void registerDataTypeDictionary(DataTypeFactory & factory)
+{
+    factory.registerDataType("Dictionary", create);
+}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <DataTypes/IDataType.h>
+
+
+namespace DB
+{
+
+/** Dictionary(T) - a dictionary-encoded (low cardinality) version of type T.
+  * Values are stored once per distinct value, rows hold 32-bit indices (see ColumnDictionary).
+  *
+  * On disk the column is stored as a sequence of self-describing chunks:
+  *  <dictionary size> <dictionary values> <rows count> <32-bit indices>,
+  * one chunk per serializeBinaryBulk call, so reads can start at any mark.
+  */
+class DataTypeDictionary final : public IDataType
+{
+public:
+    explicit DataTypeDictionary(const DataTypePtr & nested_);
+
+    std::string getName() const override { return "Dictionary(" + nested->getName() + ")"; }
+    const char * getFamilyName() const override { return "Dictionary"; }
+
+    DataTypePtr clone() const override { return std::make_shared<DataTypeDictionary>(nested); }
+
+    const DataTypePtr & getNestedType() const { return nested; }
+
+    bool canBeInsideNullable() const override { return false; }
+
+    void serializeBinary(const Field & field, WriteBuffer & ostr) const override;
+    void deserializeBinary(Field & field, ReadBuffer & istr) const override;
+    void serializeBinary(const IColumn & column, size_t row_num, WriteBuffer & ostr) const override;
+    void deserializeBinary(IColumn & column, ReadBuffer & istr) const override;
+
+    void serializeBinaryBulk(const IColumn & column, WriteBuffer & ostr, size_t offset, size_t limit) const override;
+    void deserializeBinaryBulk(IColumn & column, ReadBuffer & istr, size_t limit, double avg_value_size_hint) const override;
+
+    void serializeText(const IColumn & column, size_t row_num, WriteBuffer & ostr) const override;
+
+    void serializeTextEscaped(const IColumn & column, size_t row_num, WriteBuffer & ostr) const override;
+    void deserializeTextEscaped(IColumn & column, ReadBuffer & istr) const override;
+
+    void serializeTextQuoted(const IColumn & column, size_t row_num, WriteBuffer & ostr) const override;
+    void deserializeTextQuoted(IColumn & column, ReadBuffer & istr) const override;
+
+    void serializeTextJSON(const IColumn & column, size_t row_num, WriteBuffer & ostr, const FormatSettingsJSON & settings) const override;
+    void deserializeTextJSON(IColumn & column, ReadBuffer & istr) const override;
+
+    void serializeTextXML(const IColumn & column, size_t row_num, WriteBuffer & ostr) const override;
+
+    void serializeTextCSV(const IColumn & column, size_t row_num, WriteBuffer & ostr) const override;
+    void deserializeTextCSV(IColumn & column, ReadBuffer & istr, const char delimiter) const override;
+
+    ColumnPtr createColumn() const override;
+
+    Field getDefault() const override { return nested->getDefault(); }
+
+private:
+    DataTypePtr nested;
+
+    /// Deserialize one value with `deserialize` into a temporary nested column and append it (deduplicated).
+    template <typename F>
+    void deserializeValueImpl(IColumn & column, F && deserialize) const;
+};
+
+}
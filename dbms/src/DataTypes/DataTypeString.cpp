@@ -119,7 +119,7 @@ static NO_INLINE void deserializeBinarySSE2(ColumnString::Chars_t & data, Column
             break;
 
         UInt64 size;
-        readVarUInt(size, istr);
+        readVarUIntFast(size, istr);
 
         offset += size + 1;
         offsets.push_back(offset);
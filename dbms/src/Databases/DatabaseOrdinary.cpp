@@ -7,6 +7,7 @@
 #include <Common/escapeForFileName.h>
 #include <Common/StringUtils.h>
 #include <Common/Stopwatch.h>
+#include <Common/setThreadName.h>
 #include <common/ThreadPool.h>
 #include <Parsers/ASTCreateQuery.h>
 #include <Parsers/parseQuery.h>
@@ -43,6 +44,35 @@ static String getTableMetadataPath(const String & base_path, const String & tabl
     return base_path + (endsWith(base_path, "/") ? "" : "/") + escapeForFileName(table_name) + ".sql";
 }
 
+/// Returns the name of the table and its engine from the definition, without constructing the table.
+static std::pair<String, String> getTableNameAndEngine(const String & definition, const String & description_for_error_message)
+{
+    ParserCreateQuery parser;
+    ASTPtr ast = parseQuery(parser, definition.data(), definition.data() + definition.size(), description_for_error_message);
+    const ASTCreateQuery & create = typeid_cast<const ASTCreateQuery &>(*ast);
+
+    String engine;
+    if (create.is_view)
+        engine = "View";
+    else if (create.is_materialized_view)
+        engine = "MaterializedView";
+    else
+        engine = typeid_cast<const ASTFunction &>(*create.storage).name;
+
+    return {create.table, engine};
+}
+
+/// Tables with data parts or background activity are constructed at startup even in lazy mode:
+///  MergeTree tables own the data, Distributed tables send the queued inserts,
+///  Buffer tables flush by timeout, MaterializedView tables receive data from their source.
+static bool mustBeLoadedAtStartup(const String & engine)
+{
+    return engine.find("MergeTree") != String::npos
+        || engine == "Distributed"
+        || engine == "Buffer"
+        || engine == "MaterializedView";
+}
+
 static void loadTable(
     Context & context,
     const String & database_metadata_path,
@@ -50,7 +80,8 @@ static void loadTable(
     const String & database_name,
     const String & database_data_path,
     const String & file_name,
-    bool has_force_restore_data_flag)
+    bool has_force_restore_data_flag,
+    bool lazy_load_auxiliary_tables)
 {
     Logger * log = &Logger::get("loadTable");
 
@@ -75,6 +106,19 @@ static void loadTable(
 
     try
     {
+        if (lazy_load_auxiliary_tables)
+        {
+            String table_name;
+            String engine;
+            std::tie(table_name, engine) = getTableNameAndEngine(s, "in file " + table_metadata_path);
+
+            if (!mustBeLoadedAtStartup(engine))
+            {
+                database.addLazyTable(table_name, s);
+                return;
+            }
+        }
+
         String table_name;
         StoragePtr table;
         std::tie(table_name, table) = createTableFromDefinition(
@@ -145,6 +189,11 @@ void DatabaseOrdinary::loadTables(
 
     String data_path = context.getPath() + "/data/" + escapeForFileName(name) + "/";
 
+    bool lazy_load_auxiliary_tables = context.getSettingsRef().lazy_load_auxiliary_tables;
+    lazy_context = &context;
+    lazy_data_path = data_path;
+    lazy_has_force_restore_data_flag = has_force_restore_data_flag;
+
     StopwatchWithLock watch;
     std::atomic<size_t> tables_processed {0};
 
@@ -162,7 +211,7 @@ void DatabaseOrdinary::loadTables(
                 watch.restart();
             }
 
-            loadTable(context, path, *this, name, data_path, table, has_force_restore_data_flag);
+            loadTable(context, path, *this, name, data_path, table, has_force_restore_data_flag, lazy_load_auxiliary_tables);
         }
     };
 
@@ -189,6 +238,134 @@ void DatabaseOrdinary::loadTables(
 
     /// After all tables was basically initialized, startup them.
     startupTables(thread_pool);
+
+    /// The deferred tables attach in the background while the server is already accepting queries.
+    {
+        std::lock_guard<std::mutex> lock(lazy_mutex);
+        if (!lazy_tables.empty())
+        {
+            LOG_INFO(log, "Construction of " << lazy_tables.size() << " tables is deferred.");
+            lazy_load_thread = std::thread(&DatabaseOrdinary::lazyLoadThread, this);
+        }
+    }
+}
+
+
+void DatabaseOrdinary::addLazyTable(const String & table_name, const String & definition)
+{
+    std::lock_guard<std::mutex> lock(lazy_mutex);
+    lazy_tables.emplace(table_name, definition);
+}
+
+
+StoragePtr DatabaseOrdinary::loadLazyTable(const String & table_name)
+{
+    std::lock_guard<std::mutex> lock(lazy_mutex);
+
+    /// The table could have been constructed by another thread while we were waiting for the lock.
+    if (auto res = DatabaseMemory::tryGetTable(*lazy_context, table_name))
+        return res;
+
+    auto it = lazy_tables.find(table_name);
+    if (it == lazy_tables.end())
+        return {};
+
+    String loaded_name;
+    StoragePtr table;
+    std::tie(loaded_name, table) = createTableFromDefinition(
+        it->second, name, lazy_data_path, *lazy_context, lazy_has_force_restore_data_flag,
+        "in deferred table " + table_name);
+
+    table->startup();
+    attachTable(loaded_name, table);
+    lazy_tables.erase(it);
+
+    LOG_DEBUG(log, "Attached deferred table " << table_name << ".");
+    return table;
+}
+
+
+void DatabaseOrdinary::loadAllLazyTables()
+{
+    Strings table_names;
+    {
+        std::lock_guard<std::mutex> lock(lazy_mutex);
+        for (const auto & table : lazy_tables)
+            table_names.push_back(table.first);
+    }
+
+    for (const auto & table_name : table_names)
+        loadLazyTable(table_name);
+}
+
+
+void DatabaseOrdinary::lazyLoadThread()
+{
+    setThreadName("LazyTablesLoad");
+
+    try
+    {
+        while (!lazy_shutdown)
+        {
+            String table_name;
+            {
+                std::lock_guard<std::mutex> lock(lazy_mutex);
+                if (lazy_tables.empty())
+                    break;
+                table_name = lazy_tables.begin()->first;
+            }
+
+            loadLazyTable(table_name);
+        }
+    }
+    catch (...)
+    {
+        /// The failed table stays deferred - the error will be thrown to the user on first access.
+        tryLogCurrentException(log, "Cannot attach deferred table");
+    }
+}
+
+
+bool DatabaseOrdinary::isTableExist(
+    const Context & context,
+    const String & table_name) const
+{
+    if (DatabaseMemory::isTableExist(context, table_name))
+        return true;
+
+    std::lock_guard<std::mutex> lock(lazy_mutex);
+    return lazy_tables.count(table_name);
+}
+
+
+StoragePtr DatabaseOrdinary::tryGetTable(
+    const Context & context,
+    const String & table_name)
+{
+    if (auto res = DatabaseMemory::tryGetTable(context, table_name))
+        return res;
+
+    return loadLazyTable(table_name);
+}
+
+
+DatabaseIteratorPtr DatabaseOrdinary::getIterator(const Context & context)
+{
+    /// All the deferred tables have to be constructed for the iterator to see them.
+    loadAllLazyTables();
+    return DatabaseMemory::getIterator(context);
+}
+
+
+bool DatabaseOrdinary::empty(const Context & context) const
+{
+    {
+        std::lock_guard<std::mutex> lock(lazy_mutex);
+        if (!lazy_tables.empty())
+            return false;
+    }
+
+    return DatabaseMemory::empty(context);
 }
 
 
@@ -422,6 +599,15 @@ void DatabaseOrdinary::shutdown()
     /// You can not hold a lock during shutdown.
     /// Because inside `shutdown` function the tables can work with database, and mutex is not recursive.
 
+    lazy_shutdown = true;
+    if (lazy_load_thread.joinable())
+        lazy_load_thread.join();
+
+    {
+        std::lock_guard<std::mutex> lock(lazy_mutex);
+        lazy_tables.clear();
+    }
+
     Tables tables_snapshot;
     {
         std::lock_guard<std::mutex> lock(mutex);
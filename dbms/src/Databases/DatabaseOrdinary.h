@@ -2,6 +2,9 @@
 
 #include <Databases/DatabaseMemory.h>
 
+#include <atomic>
+#include <thread>
+
 
 namespace DB
 {
@@ -9,6 +12,10 @@ namespace DB
 /** Default engine of databases.
   * It stores tables list in filesystem using list of .sql files,
   *  that contain declaration of table represented by SQL ATTACH TABLE query.
+  *
+  * If the lazy_load_auxiliary_tables setting is enabled, tables with engines that have no data parts
+  *  and no background activity are not constructed at startup: they attach in the background
+  *  and on first access, so the server starts accepting queries sooner.
   */
 class DatabaseOrdinary : public DatabaseMemory
 {
@@ -25,6 +32,21 @@ public:
         ThreadPool * thread_pool,
         bool has_force_restore_data_flag) override;
 
+    bool isTableExist(
+        const Context & context,
+        const String & table_name) const override;
+
+    StoragePtr tryGetTable(
+        const Context & context,
+        const String & table_name) override;
+
+    DatabaseIteratorPtr getIterator(const Context & context) override;
+
+    bool empty(const Context & context) const override;
+
+    /// Defer the construction of the table until first access. Only used during loadTables.
+    void addLazyTable(const String & table_name, const String & definition);
+
     void createTable(
         const Context & context,
         const String & table_name,
@@ -64,6 +86,25 @@ public:
 
 private:
     void startupTables(ThreadPool * thread_pool);
+
+    /// Construct a deferred table right now. Returns nullptr if there is no such table.
+    StoragePtr loadLazyTable(const String & table_name);
+    void loadAllLazyTables();
+    void lazyLoadThread();
+
+    /// Definitions of tables whose construction is deferred until first access: table name -> query text.
+    /// The same mutex serializes the constructions of such tables.
+    std::map<String, String> lazy_tables;
+    mutable std::mutex lazy_mutex;
+
+    /// Attaches the deferred tables in the background.
+    std::thread lazy_load_thread;
+    std::atomic<bool> lazy_shutdown {false};
+
+    /// State needed to construct the deferred tables. Set in loadTables.
+    Context * lazy_context = nullptr;
+    String lazy_data_path;
+    bool lazy_has_force_restore_data_flag = false;
 };
 
 }
@@ -65,9 +65,12 @@ CacheDictionary::CacheDictionary(const std::string & name, const DictionaryStruc
     const size_t size)
     : name{name}, dict_struct(dict_struct),
         source_ptr{std::move(source_ptr)}, dict_lifetime(dict_lifetime),
-        size{roundUpToPowerOfTwoOrZero(std::max(size, size_t(max_collision_length)))},
+        size{roundUpToPowerOfTwoOrZero(std::max(size, size_t(max_collision_length * num_shards)))},
         size_overlap_mask{this->size - 1},
+        shard_overlap_mask{this->size / num_shards - 1},
+        shard_bits{static_cast<size_t>(__builtin_ctzll(this->size / num_shards))},
         cells{this->size},
+        protected_flags(this->size),
         rnd_engine(randomSeed())
 {
     if (!this->source_ptr->supportsSelectiveLoad())
@@ -335,12 +338,19 @@ void CacheDictionary::getString(
 CacheDictionary::FindResult CacheDictionary::findCellIdx(const Key & id, const CellMetadata::time_point_t now) const
 {
     auto pos = getCellIdx(id);
+    /// Probing never leaves the shard of the key, so the whole lookup is covered by one shard lock.
+    const auto shard_base = pos & ~shard_overlap_mask;
     auto oldest_id = pos;
     auto oldest_time = CellMetadata::time_point_t::max();
+    /// The preferred victim: the oldest cell of the probe window outside of the protected segment.
+    auto oldest_unprotected_id = pos;
+    auto oldest_unprotected_time = CellMetadata::time_point_t::max();
+    bool found_unprotected = false;
+
     const auto stop = pos + max_collision_length;
     for (; pos < stop; ++pos)
     {
-        const auto cell_idx = pos & size_overlap_mask;
+        const auto cell_idx = shard_base | (pos & shard_overlap_mask);
         const auto & cell = cells[cell_idx];
 
         if (cell.id != id)
@@ -351,6 +361,17 @@ CacheDictionary::FindResult CacheDictionary::findCellIdx(const Key & id, const C
                 oldest_time = cell.expiresAt();
                 oldest_id = cell_idx;
             }
+
+            if (!protected_flags[cell_idx].load(std::memory_order_relaxed))
+            {
+                found_unprotected = true;
+                if (oldest_unprotected_time > now && oldest_unprotected_time > cell.expiresAt())
+                {
+                    oldest_unprotected_time = cell.expiresAt();
+                    oldest_unprotected_id = cell_idx;
+                }
+            }
+
             continue;
         }
 
@@ -362,7 +383,16 @@ CacheDictionary::FindResult CacheDictionary::findCellIdx(const Key & id, const C
         return {cell_idx, true, false};
     }
 
-    return {oldest_id, false, false};
+    return {found_unprotected ? oldest_unprotected_id : oldest_id, false, false};
+}
+
+void CacheDictionary::demoteProbeWindow(const Key id) const
+{
+    auto pos = getCellIdx(id);
+    const auto shard_base = pos & ~shard_overlap_mask;
+    const auto stop = pos + max_collision_length;
+    for (; pos < stop; ++pos)
+        protected_flags[shard_base | (pos & shard_overlap_mask)].store(0, std::memory_order_relaxed);
 }
 
 void CacheDictionary::has(const PaddedPODArray<Key> & ids, PaddedPODArray<UInt8> & out) const
@@ -374,13 +404,14 @@ void CacheDictionary::has(const PaddedPODArray<Key> & ids, PaddedPODArray<UInt8>
 
     const auto rows = ext::size(ids);
     {
-        const ProfilingScopedReadRWLock read_lock{rw_lock, ProfileEvents::DictCacheLockReadNs};
+        ShardedReadLock read_lock{*this};
 
         const auto now = std::chrono::system_clock::now();
         /// fetch up-to-date values, decide which ones require update
         for (const auto row : ext::range(0, rows))
         {
             const auto id = ids[row];
+            read_lock.lockShard(getShardIdx(getCellIdx(id)));
             const auto find_result = findCellIdx(id, now);
             const auto & cell_idx = find_result.cell_idx;
             if (!find_result.valid)
@@ -396,6 +427,7 @@ void CacheDictionary::has(const PaddedPODArray<Key> & ids, PaddedPODArray<UInt8>
                 ++cache_hit;
                 const auto & cell = cells[cell_idx];
                 out[row] = !cell.isDefault();
+                promoteCell(cell_idx);
             }
         }
     }
@@ -435,6 +467,7 @@ void CacheDictionary::createAttributes()
     attributes.reserve(attributes_size);
 
     bytes_allocated += size * sizeof(CellMetadata);
+    bytes_allocated += size * sizeof(protected_flags.front());
     bytes_allocated += attributes_size * sizeof(attributes.front());
 
     for (const auto & attribute : dict_struct.attributes)
@@ -515,7 +548,8 @@ CacheDictionary::Attribute CacheDictionary::createAttributeWithType(const Attrib
             std::get<ContainerPtrType<StringRef>>(attr.arrays) = std::make_unique<ContainerType<StringRef>>(size);
             bytes_allocated += size * sizeof(StringRef);
             if (!string_arena)
-                string_arena = std::make_unique<ArenaWithFreeLists>();
+                string_arena = std::make_unique<ArenaWithFreeLists>(
+                    4096, 2, 128 * 1024 * 1024, /* lazy_release */ true);
             break;
     }
 
@@ -564,7 +598,7 @@ void CacheDictionary::getItemsNumberImpl(
     size_t cache_expired = 0, cache_not_found = 0, cache_hit = 0;
 
     {
-        const ProfilingScopedReadRWLock read_lock{rw_lock, ProfileEvents::DictCacheLockReadNs};
+        ShardedReadLock read_lock{*this};
 
         const auto now = std::chrono::system_clock::now();
         /// fetch up-to-date values, decide which ones require update
@@ -577,6 +611,7 @@ void CacheDictionary::getItemsNumberImpl(
                 *    2. cell has expired,
                 *    3. explicit defaults were specified and cell was set default. */
 
+            read_lock.lockShard(getShardIdx(getCellIdx(id)));
             const auto find_result = findCellIdx(id, now);
             if (!find_result.valid)
             {
@@ -592,6 +627,7 @@ void CacheDictionary::getItemsNumberImpl(
                 const auto & cell_idx = find_result.cell_idx;
                 const auto & cell = cells[cell_idx];
                 out[row] = cell.isDefault() ? get_default(row) : attribute_array[cell_idx];
+                promoteCell(cell_idx);
             }
         }
     }
@@ -644,7 +680,7 @@ void CacheDictionary::getItemsString(
 
     /// perform optimistic version, fallback to pessimistic if failed
     {
-        const ProfilingScopedReadRWLock read_lock{rw_lock, ProfileEvents::DictCacheLockReadNs};
+        ShardedReadLock read_lock{*this};
 
         const auto now = std::chrono::system_clock::now();
         /// fetch up-to-date values, discard on fail
@@ -652,6 +688,7 @@ void CacheDictionary::getItemsString(
         {
             const auto id = ids[row];
 
+            read_lock.lockShard(getShardIdx(getCellIdx(id)));
             const auto find_result = findCellIdx(id, now);
             if (!find_result.valid)
             {
@@ -664,6 +701,7 @@ void CacheDictionary::getItemsString(
                 const auto & cell = cells[cell_idx];
                 const auto string_ref = cell.isDefault() ? get_default(row) : attribute_array[cell_idx];
                 out->insertData(string_ref.data, string_ref.size);
+                promoteCell(cell_idx);
             }
         }
     }
@@ -688,13 +726,14 @@ void CacheDictionary::getItemsString(
     size_t total_length = 0;
     size_t cache_expired = 0, cache_not_found = 0, cache_hit = 0;
     {
-        const ProfilingScopedReadRWLock read_lock{rw_lock, ProfileEvents::DictCacheLockReadNs};
+        ShardedReadLock read_lock{*this};
 
         const auto now = std::chrono::system_clock::now();
         for (const auto row : ext::range(0, ids.size()))
         {
             const auto id = ids[row];
 
+            read_lock.lockShard(getShardIdx(getCellIdx(id)));
             const auto find_result = findCellIdx(id, now);
             if (!find_result.valid)
             {
@@ -715,6 +754,7 @@ void CacheDictionary::getItemsString(
                     map[id] = String{string_ref};
 
                 total_length += string_ref.size + 1;
+                promoteCell(cell_idx);
             }
         }
     }
@@ -766,8 +806,121 @@ void CacheDictionary::update(
     PresentIdHandler && on_cell_updated,
     AbsentIdHandler && on_id_not_found) const
 {
-    std::unordered_map<Key, UInt8> remaining_ids{requested_ids.size()};
-    for (const auto id : requested_ids)
+    /// Ids already being fetched by another thread - we will wait for them instead of requesting again.
+    std::vector<Key> ids_to_wait;
+    /// Ids we registered as in flight.
+    std::vector<Key> registered_ids;
+
+    {
+        const std::lock_guard<std::mutex> lock{in_flight_mutex};
+
+        for (const auto id : requested_ids)
+        {
+            if (in_flight_ids.count(id))
+                ids_to_wait.push_back(id);
+            else
+            {
+                in_flight_ids.insert(id);
+                pending_fetch_ids.push_back(id);
+                registered_ids.push_back(id);
+            }
+        }
+    }
+
+    if (!registered_ids.empty())
+    {
+        /// Updates are serialized with each other, but not with lookups: those take only the shard locks.
+        const std::lock_guard<std::mutex> update_guard{update_mutex};
+
+        /// Take everything accumulated so far - our ids and the ids of queries that registered
+        ///  while the previous fetch was running - and request it from the source in one batch.
+        std::vector<Key> batch;
+        {
+            const std::lock_guard<std::mutex> lock{in_flight_mutex};
+            batch.swap(pending_fetch_ids);
+        }
+
+        if (!batch.empty())
+        {
+            try
+            {
+                fetchFromSource(batch, on_cell_updated, on_id_not_found);
+            }
+            catch (...)
+            {
+                finishFetch(batch);
+                throw;
+            }
+
+            finishFetch(batch);
+        }
+
+        /// A fetcher ahead of us could have taken some of our ids into its batch - wait for those below.
+        const std::unordered_set<Key> batch_set{std::begin(batch), std::end(batch)};
+        for (const auto id : registered_ids)
+            if (!batch_set.count(id))
+                ids_to_wait.push_back(id);
+    }
+
+    if (ids_to_wait.empty())
+        return;
+
+    /// Wait for the fetches in flight in other threads.
+    {
+        std::unique_lock<std::mutex> lock{in_flight_mutex};
+        in_flight_cv.wait(lock, [&]
+        {
+            for (const auto id : ids_to_wait)
+                if (in_flight_ids.count(id))
+                    return false;
+            return true;
+        });
+    }
+
+    /// Read the cells written by the other thread out of the cache.
+    std::vector<Key> leftover_ids;
+
+    {
+        ShardedReadLock read_lock{*this};
+        const auto now = std::chrono::system_clock::now();
+
+        for (const auto id : ids_to_wait)
+        {
+            read_lock.lockShard(getShardIdx(getCellIdx(id)));
+            const auto find_result = findCellIdx(id, now);
+            const auto & cell_idx = find_result.cell_idx;
+
+            if (find_result.valid)
+            {
+                if (cells[cell_idx].isDefault())
+                    on_id_not_found(id, cell_idx);
+                else
+                    on_cell_updated(id, cell_idx);
+            }
+            else
+            {
+                /// The fetch has failed, or the cell has been evicted right away.
+                leftover_ids.push_back(id);
+            }
+        }
+    }
+
+    /// The corner case: request the leftovers ourselves, without coalescing.
+    if (!leftover_ids.empty())
+    {
+        const std::lock_guard<std::mutex> update_guard{update_mutex};
+        fetchFromSource(leftover_ids, on_cell_updated, on_id_not_found);
+    }
+}
+
+template <typename PresentIdHandler, typename AbsentIdHandler>
+void CacheDictionary::fetchFromSource(
+    const std::vector<Key> & batch_ids,
+    PresentIdHandler && on_cell_updated,
+    AbsentIdHandler && on_id_not_found) const
+{
+    std::unordered_map<Key, UInt8> remaining_ids{batch_ids.size()};
+    for (const auto id : batch_ids)
         remaining_ids.insert({ id, 0 });
 
     std::uniform_int_distribution<UInt64> distribution
@@ -776,12 +929,13 @@ void CacheDictionary::update(
         dict_lifetime.max_sec
     };
 
-    const ProfilingScopedWriteRWLock write_lock{rw_lock, ProfileEvents::DictCacheLockWriteNs};
+    /// Cells are written under the lock of their shard.
+    ShardedWriteLock write_lock{*this};
 
     {
         CurrentMetrics::Increment metric_increment{CurrentMetrics::DictCacheRequests};
         Stopwatch watch;
-        auto stream = source_ptr->loadIds(requested_ids);
+        auto stream = source_ptr->loadIds(batch_ids);
         stream->readPrefix();
 
         const auto now = std::chrono::system_clock::now();
@@ -806,10 +960,12 @@ void CacheDictionary::update(
             {
                 const auto id = ids[i];
 
+                write_lock.lockShard(getShardIdx(getCellIdx(id)));
                 const auto find_result = findCellIdx(id, now);
                 const auto & cell_idx = find_result.cell_idx;
 
                 auto & cell = cells[cell_idx];
+                const auto evicting = cell.id != id;
 
                 for (const auto attribute_idx : ext::range(0, attributes.size()))
                 {
@@ -829,6 +985,17 @@ void CacheDictionary::update(
                 else
                     cell.setExpiresAt(std::chrono::time_point<std::chrono::system_clock>::max());
 
+                /** The new arrival starts in the probationary (unprotected) segment. If it displaced
+                  *  a protected cell, the whole probe window is protected - demote it, so that
+                  *  the cache can still turn over.
+                  */
+                if (evicting)
+                {
+                    if (protected_flags[cell_idx].load(std::memory_order_relaxed))
+                        demoteProbeWindow(id);
+                    protected_flags[cell_idx].store(0, std::memory_order_relaxed);
+                }
+
                 /// inform caller
                 on_cell_updated(id, cell_idx);
                 /// mark corresponding id as found
@@ -838,7 +1005,7 @@ void CacheDictionary::update(
 
         stream->readSuffix();
 
-        ProfileEvents::increment(ProfileEvents::DictCacheKeysRequested, requested_ids.size());
+        ProfileEvents::increment(ProfileEvents::DictCacheKeysRequested, batch_ids.size());
         ProfileEvents::increment(ProfileEvents::DictCacheRequestTimeNs, watch.elapsed());
     }
 
@@ -857,10 +1024,12 @@ void CacheDictionary::update(
 
         const auto id = id_found_pair.first;
 
+        write_lock.lockShard(getShardIdx(getCellIdx(id)));
         const auto find_result = findCellIdx(id, now);
         const auto & cell_idx = find_result.cell_idx;
 
         auto & cell = cells[cell_idx];
+        const auto evicting = cell.id != id;
 
         /// Set null_value for each attribute
         for (auto & attribute : attributes)
@@ -878,6 +1047,13 @@ void CacheDictionary::update(
 
         cell.setDefault();
 
+        if (evicting)
+        {
+            if (protected_flags[cell_idx].load(std::memory_order_relaxed))
+                demoteProbeWindow(id);
+            protected_flags[cell_idx].store(0, std::memory_order_relaxed);
+        }
+
         /// inform caller that the cell has not been found
         on_id_not_found(id, cell_idx);
     }
@@ -887,6 +1063,17 @@ void CacheDictionary::update(
     ProfileEvents::increment(ProfileEvents::DictCacheRequests);
 }
 
+void CacheDictionary::finishFetch(const std::vector<Key> & batch_ids) const
+{
+    {
+        const std::lock_guard<std::mutex> lock{in_flight_mutex};
+        for (const auto id : batch_ids)
+            in_flight_ids.erase(id);
+    }
+
+    in_flight_cv.notify_all();
+}
+
 
 void CacheDictionary::setDefaultAttributeValue(Attribute & attribute, const Key idx) const
 {
@@ -979,15 +1166,20 @@ bool CacheDictionary::isEmptyCell(const UInt64 idx) const
 
 PaddedPODArray<CacheDictionary::Key> CacheDictionary::getCachedIds() const
 {
-    const ProfilingScopedReadRWLock read_lock{rw_lock, ProfileEvents::DictCacheLockReadNs};
-
     PaddedPODArray<Key> array;
-    for (size_t idx = 0; idx < cells.size(); ++idx)
+    for (size_t shard = 0; shard < num_shards; ++shard)
     {
-        auto & cell = cells[idx];
-        if (!isEmptyCell(idx) && !cells[idx].isDefault())
+        const ProfilingScopedReadRWLock read_lock{shard_mutexes[shard], ProfileEvents::DictCacheLockReadNs};
+
+        const auto shard_begin = shard << shard_bits;
+        const auto shard_end = shard_begin + shard_overlap_mask + 1;
+        for (size_t idx = shard_begin; idx < shard_end; ++idx)
         {
-            array.push_back(cell.id);
+            auto & cell = cells[idx];
+            if (!isEmptyCell(idx) && !cells[idx].isDefault())
+            {
+                array.push_back(cell.id);
+            }
         }
     }
     return array;
@@ -5,18 +5,31 @@
 #include <Dictionaries/DictionaryStructure.h>
 #include <Common/ArenaWithFreeLists.h>
 #include <Common/CurrentMetrics.h>
+#include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
 #include <Columns/ColumnString.h>
 #include <ext/bit_cast.h>
 #include <cmath>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <tuple>
+#include <unordered_set>
 #include <pcg_random.hpp>
 #include <shared_mutex>
 
 
+namespace ProfileEvents
+{
+    extern const Event DictCacheLockReadNs;
+    extern const Event DictCacheLockWriteNs;
+}
+
+
 namespace DB
 {
 
@@ -205,11 +218,27 @@ private:
         ColumnString * out,
         DefaultGetter && get_default) const;
 
+    /** Brings the requested ids into the cache and informs the caller through the handlers.
+      * Misses of concurrent queries are coalesced: ids that another thread is already requesting
+      *  from the source are not requested again - we wait for the fetch in flight and read
+      *  the cells it has written. Ids that accumulated while a fetch was running are taken
+      *  by the next fetcher in one batched source request; the handlers may therefore be called
+      *  for ids of other queries merged into the same batch - they ignore ids they did not ask for.
+      */
     template <typename PresentIdHandler, typename AbsentIdHandler>
     void update(
         const std::vector<Key> & requested_ids, PresentIdHandler && on_cell_updated,
         AbsentIdHandler && on_id_not_found) const;
 
+    /// Requests the batch from the source and writes the cells. Called under `update_mutex`.
+    template <typename PresentIdHandler, typename AbsentIdHandler>
+    void fetchFromSource(
+        const std::vector<Key> & batch_ids, PresentIdHandler && on_cell_updated,
+        AbsentIdHandler && on_id_not_found) const;
+
+    /// Removes the batch from the in-flight table and wakes up the waiting queries.
+    void finishFetch(const std::vector<Key> & batch_ids) const;
+
     PaddedPODArray<Key> getCachedIds() const;
 
     bool isEmptyCell(const UInt64 idx) const;
@@ -231,6 +260,99 @@ private:
 
     FindResult findCellIdx(const Key & id, const CellMetadata::time_point_t now) const;
 
+    /// The shard of the cell: the cell array is divided into `num_shards` aligned regions,
+    ///  and probing for a key never leaves its region (see findCellIdx).
+    size_t getShardIdx(const size_t cell_idx) const { return cell_idx >> shard_bits; }
+
+    /// Mark the cell as belonging to the protected segment: its value has been read after insertion.
+    void promoteCell(const size_t cell_idx) const
+    {
+        protected_flags[cell_idx].store(1, std::memory_order_relaxed);
+    }
+
+    /// Clear the protection of all cells of the probe window of `id`.
+    void demoteProbeWindow(const Key id) const;
+
+    /** Keeps at most one shard locked for reading; re-locks only when another shard is required.
+      * The ids within a block are often clustered, so consecutive rows mostly hit the already locked shard.
+      */
+    class ShardedReadLock
+    {
+    public:
+        ShardedReadLock(const CacheDictionary & dict_) : dict(dict_) {}
+        ~ShardedReadLock() { unlock(); }
+
+        void lockShard(const size_t shard)
+        {
+            if (locked)
+            {
+                if (shard == current_shard)
+                    return;
+                dict.shard_mutexes[current_shard].unlock_shared();
+            }
+
+            Stopwatch watch;
+            dict.shard_mutexes[shard].lock_shared();
+            ProfileEvents::increment(ProfileEvents::DictCacheLockReadNs, watch.elapsed());
+
+            current_shard = shard;
+            locked = true;
+        }
+
+        void unlock()
+        {
+            if (locked)
+            {
+                dict.shard_mutexes[current_shard].unlock_shared();
+                locked = false;
+            }
+        }
+
+    private:
+        const CacheDictionary & dict;
+        size_t current_shard = 0;
+        bool locked = false;
+    };
+
+    /// Same, but locks the shards exclusively. Used by `update`.
+    class ShardedWriteLock
+    {
+    public:
+        ShardedWriteLock(const CacheDictionary & dict_) : dict(dict_) {}
+        ~ShardedWriteLock() { unlock(); }
+
+        void lockShard(const size_t shard)
+        {
+            if (locked)
+            {
+                if (shard == current_shard)
+                    return;
+                dict.shard_mutexes[current_shard].unlock();
+            }
+
+            Stopwatch watch;
+            dict.shard_mutexes[shard].lock();
+            ProfileEvents::increment(ProfileEvents::DictCacheLockWriteNs, watch.elapsed());
+
+            current_shard = shard;
+            locked = true;
+        }
+
+        void unlock()
+        {
+            if (locked)
+            {
+                dict.shard_mutexes[current_shard].unlock();
+                locked = false;
+            }
+        }
+
+    private:
+        const CacheDictionary & dict;
+        size_t current_shard = 0;
+        bool locked = false;
+    };
+
     template <typename AncestorType>
     void isInImpl(
         const PaddedPODArray<Key> & child_ids,
@@ -242,7 +364,26 @@ private:
     const DictionarySourcePtr source_ptr;
     const DictionaryLifetime dict_lifetime;
 
-    mutable std::shared_mutex rw_lock;
+    /// Number of independently locked regions ("shards") of the cell array.
+    static constexpr size_t num_shards = 16;
+
+    /** Each shard of the cell array is protected by its own lock, so concurrent lookups
+      *  of different keys mostly take different locks instead of serializing on a single one.
+      */
+    mutable std::array<std::shared_mutex, num_shards> shard_mutexes;
+
+    /// Serializes updates (requests to the source) with each other, but not with lookups.
+    /// Also covers `rnd_engine` and `string_arena`, which are used only during updates.
+    mutable std::mutex update_mutex;
+
+    /** Coalescing of cache misses (see `update`): `in_flight_ids` holds the ids some thread
+      *  is currently requesting from the source; `pending_fetch_ids` - the ids registered
+      *  while another fetch was running, to be taken by the next fetcher in one batch.
+      */
+    mutable std::mutex in_flight_mutex;
+    mutable std::condition_variable in_flight_cv;
+    mutable std::unordered_set<Key> in_flight_ids;
+    mutable std::vector<Key> pending_fetch_ids;
 
     /// Actual size will be increased to match power of 2
     const size_t size;
@@ -250,6 +391,12 @@ private:
     /// all bits to 1  mask (size - 1) (0b1000 - 1 = 0b111)
     const size_t size_overlap_mask;
 
+    /// Mask of the cell index within one shard (the shard size is a power of two).
+    const size_t shard_overlap_mask;
+
+    /// log2 of the shard size: cell_idx >> shard_bits is the shard of the cell.
+    const size_t shard_bits;
+
     /// Max tries to find cell, overlaped with mask: if size = 16 and start_cell=10: will try cells: 10,11,12,13,14,15,0,1,2,3
     static constexpr size_t max_collision_length = 10;
 
@@ -257,6 +404,15 @@ private:
     std::map<std::string, size_t> attribute_index_by_name;
     mutable std::vector<Attribute> attributes;
     mutable std::vector<CellMetadata> cells;
+
+    /** SLRU-style protection of the working set. A cell is inserted unprotected ("probationary")
+      *  and becomes protected on the first read after insertion. On eviction, the unprotected
+      *  cells of the probe window are preferred as victims, so a burst of cold keys (a scan)
+      *  cannot displace established hot keys. When a whole probe window becomes protected,
+      *  it is demoted and the oldest cell is evicted, so the cache can still turn over.
+      */
+    mutable std::vector<std::atomic<UInt8>> protected_flags;
+
     Attribute * hierarchical_attribute = nullptr;
     std::unique_ptr<ArenaWithFreeLists> string_arena;
 
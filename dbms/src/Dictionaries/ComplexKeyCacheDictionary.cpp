@@ -316,7 +316,8 @@ ComplexKeyCacheDictionary::Attribute ComplexKeyCacheDictionary::createAttributeW
             std::get<ContainerPtrType<StringRef>>(attr.arrays) = std::make_unique<ContainerType<StringRef>>(size);
             bytes_allocated += size * sizeof(StringRef);
             if (!string_arena)
-                string_arena = std::make_unique<ArenaWithFreeLists>();
+                string_arena = std::make_unique<ArenaWithFreeLists>(
+                    4096, 2, 128 * 1024 * 1024, /* lazy_release */ true);
             break;
     }
 
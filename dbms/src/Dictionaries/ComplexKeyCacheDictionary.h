@@ -717,7 +717,8 @@ private:
     mutable std::vector<CellMetadata> cells{size};
     const bool key_size_is_fixed{dict_struct.isKeySizeFixed()};
     size_t key_size{key_size_is_fixed ? dict_struct.getKeySize() : 0};
-    std::unique_ptr<ArenaWithFreeLists> keys_pool = key_size_is_fixed ? nullptr : std::make_unique<ArenaWithFreeLists>();
+    std::unique_ptr<ArenaWithFreeLists> keys_pool = key_size_is_fixed ? nullptr
+        : std::make_unique<ArenaWithFreeLists>(4096, 2, 128 * 1024 * 1024, /* lazy_release */ true);
     std::unique_ptr<SmallObjectPool> fixed_size_keys_pool = key_size_is_fixed ? std::make_unique<SmallObjectPool>(key_size) : nullptr;
     std::unique_ptr<ArenaWithFreeLists> string_arena;
 
@@ -0,0 +1,59 @@
+#include <Dictionaries/DictionarySnapshot.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <DataStreams/OwningBlockInputStream.h>
+#include <IO/ReadBufferFromFile.h>
+#include <Common/Exception.h>
+#include <Poco/File.h>
+
+
+namespace DB
+{
+
+BlockInputStreamPtr tryOpenDictionarySnapshot(const std::string & path)
+{
+    if (!Poco::File{path}.exists())
+        return nullptr;
+
+    auto in_ptr = std::make_unique<ReadBufferFromFile>(path);
+    auto stream = std::make_shared<NativeBlockInputStream>(*in_ptr);
+    return std::make_shared<OwningBlockInputStream<ReadBuffer>>(stream, std::move(in_ptr));
+}
+
+
+DictionarySnapshotWriter::DictionarySnapshotWriter(const std::string & path)
+    : path{path}, tmp_path{path + ".tmp"}, out{tmp_path}, stream{out}
+{
+    stream.writePrefix();
+}
+
+DictionarySnapshotWriter::~DictionarySnapshotWriter()
+{
+    if (committed)
+        return;
+
+    try
+    {
+        out.close();
+        Poco::File{tmp_path}.remove();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
+void DictionarySnapshotWriter::write(const Block & block)
+{
+    stream.write(block);
+}
+
+void DictionarySnapshotWriter::commit()
+{
+    stream.writeSuffix();
+    out.next();
+    out.sync();
+    Poco::File{tmp_path}.renameTo(path);
+    committed = true;
+}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <DataStreams/IBlockInputStream.h>
+#include <DataStreams/NativeBlockOutputStream.h>
+#include <IO/WriteBufferFromFile.h>
+
+
+namespace DB
+{
+
+/** A snapshot of dictionary data: the blocks of a successful load, saved to a local file
+  *  in Native format. On server start the dictionary is served from the snapshot right away,
+  *  instead of being rebuilt from the source for minutes, and `ExternalDictionaries` then
+  *  refreshes it from the source in background.
+  */
+
+/// Returns a stream over the snapshot file, or nullptr if there is no snapshot yet.
+BlockInputStreamPtr tryOpenDictionarySnapshot(const std::string & path);
+
+/** Writes the blocks of a load into a temporary file; `commit` atomically renames it
+  *  in place of the snapshot. Without `commit` (the load has failed) the temporary file
+  *  is removed and the old snapshot, if any, stays intact.
+  */
+class DictionarySnapshotWriter
+{
+public:
+    explicit DictionarySnapshotWriter(const std::string & path);
+    ~DictionarySnapshotWriter();
+
+    void write(const Block & block);
+    void commit();
+
+private:
+    const std::string path;
+    const std::string tmp_path;
+    WriteBufferFromFile out;
+    NativeBlockOutputStream stream;
+    bool committed = false;
+};
+
+}
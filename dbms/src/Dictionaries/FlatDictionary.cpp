@@ -1,5 +1,6 @@
 #include <Dictionaries/FlatDictionary.h>
 #include <Dictionaries/DictionaryBlockInputStream.h>
+#include <Dictionaries/DictionarySnapshot.h>
 
 namespace DB
 {
@@ -20,10 +21,12 @@ static const auto max_array_size = 500000;
 
 
 FlatDictionary::FlatDictionary(const std::string & name, const DictionaryStructure & dict_struct,
-    DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty)
+    DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty,
+    const std::string & snapshot_path, bool prefer_snapshot)
     : name{name}, dict_struct(dict_struct),
         source_ptr{std::move(source_ptr)}, dict_lifetime(dict_lifetime),
         require_nonempty(require_nonempty),
+        snapshot_path{snapshot_path}, prefer_snapshot(prefer_snapshot),
         loaded_ids(initial_array_size, false)
 {
     createAttributes();
@@ -42,7 +45,8 @@ FlatDictionary::FlatDictionary(const std::string & name, const DictionaryStructu
 }
 
 FlatDictionary::FlatDictionary(const FlatDictionary & other)
-    : FlatDictionary{other.name, other.dict_struct, other.source_ptr->clone(), other.dict_lifetime, other.require_nonempty}
+    : FlatDictionary{other.name, other.dict_struct, other.source_ptr->clone(), other.dict_lifetime, other.require_nonempty,
+        other.snapshot_path, false}
 {
 }
 
@@ -285,11 +289,41 @@ void FlatDictionary::createAttributes()
 
 void FlatDictionary::loadData()
 {
-    auto stream = source_ptr->loadAll();
-    stream->readPrefix();
+    if (auto snapshot_stream = prefer_snapshot && !snapshot_path.empty()
+        ? tryOpenDictionarySnapshot(snapshot_path) : nullptr)
+    {
+        /// Serve the saved data right away; `ExternalDictionaries` will refresh from the source in background.
+        loadDataFromStream(*snapshot_stream, nullptr);
+        loaded_from_snapshot = true;
+    }
+    else
+    {
+        std::unique_ptr<DictionarySnapshotWriter> snapshot_writer;
+        if (!snapshot_path.empty())
+            snapshot_writer = std::make_unique<DictionarySnapshotWriter>(snapshot_path);
+
+        auto stream = source_ptr->loadAll();
+        loadDataFromStream(*stream, snapshot_writer.get());
 
-    while (const auto block = stream->read())
+        if (snapshot_writer)
+            snapshot_writer->commit();
+    }
+
+    if (require_nonempty && 0 == element_count)
+        throw Exception{
+            name + ": dictionary source is empty and 'require_nonempty' property is set.",
+            ErrorCodes::DICTIONARY_IS_EMPTY};
+}
+
+void FlatDictionary::loadDataFromStream(IBlockInputStream & stream, DictionarySnapshotWriter * snapshot_writer)
+{
+    stream.readPrefix();
+
+    while (const auto block = stream.read())
     {
+        if (snapshot_writer)
+            snapshot_writer->write(block);
+
         const auto & id_column = *block.safeGetByPosition(0).column;
 
         element_count += id_column.size();
@@ -304,12 +338,7 @@ void FlatDictionary::loadData()
         }
     }
 
-    stream->readSuffix();
-
-    if (require_nonempty && 0 == element_count)
-        throw Exception{
-            name + ": dictionary source is empty and 'require_nonempty' property is set.",
-            ErrorCodes::DICTIONARY_IS_EMPTY};
+    stream.readSuffix();
 }
 
 
@@ -15,11 +15,14 @@
 namespace DB
 {
 
+class DictionarySnapshotWriter;
+
 class FlatDictionary final : public IDictionary
 {
 public:
     FlatDictionary(const std::string & name, const DictionaryStructure & dict_struct,
-        DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty);
+        DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty,
+        const std::string & snapshot_path = {}, bool prefer_snapshot = true);
 
     FlatDictionary(const FlatDictionary & other);
 
@@ -41,6 +44,8 @@ public:
 
     bool isCached() const override { return false; }
 
+    bool isLoadedFromSnapshot() const override { return loaded_from_snapshot; }
+
     DictionaryPtr clone() const override { return std::make_unique<FlatDictionary>(*this); }
 
     const IDictionarySource * getSource() const override { return source_ptr.get(); }
@@ -149,6 +154,7 @@ private:
 
     void createAttributes();
     void loadData();
+    void loadDataFromStream(IBlockInputStream & stream, DictionarySnapshotWriter * snapshot_writer);
 
     template <typename T>
     void addAttributeSize(const Attribute & attribute);
@@ -200,11 +206,16 @@ private:
     const DictionarySourcePtr source_ptr;
     const DictionaryLifetime dict_lifetime;
     const bool require_nonempty;
+    /// Where to save the data of a successful load; empty - snapshots are disabled.
+    const std::string snapshot_path;
+    /// Whether to serve from an existing snapshot. False for clones, so that periodic reloads go to the source.
+    const bool prefer_snapshot;
 
     std::map<std::string, size_t> attribute_index_by_name;
     std::vector<Attribute> attributes;
     const Attribute * hierarchical_attribute = nullptr;
     std::vector<bool> loaded_ids;
+    bool loaded_from_snapshot = false;
 
     size_t bytes_allocated = 0;
     size_t element_count = 0;
@@ -1,6 +1,7 @@
 #include <ext/size.h>
 #include <Dictionaries/HashedDictionary.h>
 #include <Dictionaries/DictionaryBlockInputStream.h>
+#include <Dictionaries/DictionarySnapshot.h>
 
 namespace DB
 {
@@ -15,9 +16,11 @@ namespace ErrorCodes
 
 
 HashedDictionary::HashedDictionary(const std::string & name, const DictionaryStructure & dict_struct,
-    DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty)
+    DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty,
+    bool sparse, const std::string & snapshot_path, bool prefer_snapshot)
     : name{name}, dict_struct(dict_struct), source_ptr{std::move(source_ptr)}, dict_lifetime(dict_lifetime),
-        require_nonempty(require_nonempty)
+        require_nonempty(require_nonempty), sparse(sparse),
+        snapshot_path{snapshot_path}, prefer_snapshot(prefer_snapshot)
 {
     createAttributes();
 
@@ -35,7 +38,8 @@ HashedDictionary::HashedDictionary(const std::string & name, const DictionaryStr
 }
 
 HashedDictionary::HashedDictionary(const HashedDictionary & other)
-    : HashedDictionary{other.name, other.dict_struct, other.source_ptr->clone(), other.dict_lifetime, other.require_nonempty}
+    : HashedDictionary{other.name, other.dict_struct, other.source_ptr->clone(), other.dict_lifetime, other.require_nonempty, other.sparse,
+        other.snapshot_path, false}
 {
 }
 
@@ -61,25 +65,27 @@ void HashedDictionary::isInImpl(
     PaddedPODArray<UInt8> & out) const
 {
     const auto null_value = std::get<UInt64>(hierarchical_attribute->null_values);
-    const auto & attr = *std::get<CollectionPtrType<Key>>(hierarchical_attribute->maps);
     const auto rows = out.size();
 
-    for (const auto row : ext::range(0, rows))
+    withAttributeMap<Key>(*hierarchical_attribute, [&] (const auto & attr)
     {
-        auto id = getAt(child_ids, row);
-        const auto ancestor_id = getAt(ancestor_ids, row);
-
-        while (id != null_value && id != ancestor_id)
+        for (const auto row : ext::range(0, rows))
         {
-            auto it = attr.find(id);
-            if (it != std::end(attr))
-                id = it->second;
-            else
-                break;
-        }
+            auto id = getAt(child_ids, row);
+            const auto ancestor_id = getAt(ancestor_ids, row);
 
-        out[row] = id != null_value && id == ancestor_id;
-    }
+            while (id != null_value && id != ancestor_id)
+            {
+                auto it = attr.find(id);
+                if (it != std::end(attr))
+                    id = it->second;
+                else
+                    break;
+            }
+
+            out[row] = id != null_value && id == ancestor_id;
+        }
+    });
 
     query_count.fetch_add(rows, std::memory_order_relaxed);
 }
@@ -278,11 +284,41 @@ void HashedDictionary::createAttributes()
 
 void HashedDictionary::loadData()
 {
-    auto stream = source_ptr->loadAll();
-    stream->readPrefix();
+    if (auto snapshot_stream = prefer_snapshot && !snapshot_path.empty()
+        ? tryOpenDictionarySnapshot(snapshot_path) : nullptr)
+    {
+        /// Serve the saved data right away; `ExternalDictionaries` will refresh from the source in background.
+        loadDataFromStream(*snapshot_stream, nullptr);
+        loaded_from_snapshot = true;
+    }
+    else
+    {
+        std::unique_ptr<DictionarySnapshotWriter> snapshot_writer;
+        if (!snapshot_path.empty())
+            snapshot_writer = std::make_unique<DictionarySnapshotWriter>(snapshot_path);
+
+        auto stream = source_ptr->loadAll();
+        loadDataFromStream(*stream, snapshot_writer.get());
+
+        if (snapshot_writer)
+            snapshot_writer->commit();
+    }
+
+    if (require_nonempty && 0 == element_count)
+        throw Exception{
+            name + ": dictionary source is empty and 'require_nonempty' property is set.",
+            ErrorCodes::DICTIONARY_IS_EMPTY};
+}
+
+void HashedDictionary::loadDataFromStream(IBlockInputStream & stream, DictionarySnapshotWriter * snapshot_writer)
+{
+    stream.readPrefix();
 
-    while (const auto block = stream->read())
+    while (const auto block = stream.read())
     {
+        if (snapshot_writer)
+            snapshot_writer->write(block);
+
         const auto & id_column = *block.safeGetByPosition(0).column;
 
         element_count += id_column.size();
@@ -297,20 +333,26 @@ void HashedDictionary::loadData()
         }
     }
 
-    stream->readSuffix();
+    stream.readSuffix();
+}
 
-    if (require_nonempty && 0 == element_count)
-        throw Exception{
-            name + ": dictionary source is empty and 'require_nonempty' property is set.",
-            ErrorCodes::DICTIONARY_IS_EMPTY};
+template <typename T, typename Attr, typename F>
+void HashedDictionary::withAttributeMap(Attr & attribute, F && f) const
+{
+    if (!sparse)
+        f(*std::get<CollectionPtrType<T>>(attribute.maps));
+    else
+        f(*std::get<SparseCollectionPtrType<T>>(attribute.sparse_maps));
 }
 
 template <typename T>
 void HashedDictionary::addAttributeSize(const Attribute & attribute)
 {
-    const auto & map_ref = std::get<CollectionPtrType<T>>(attribute.maps);
-    bytes_allocated += sizeof(CollectionType<T>) + map_ref->getBufferSizeInBytes();
-    bucket_count = map_ref->getBufferSizeInCells();
+    withAttributeMap<T>(attribute, [&] (const auto & map)
+    {
+        bytes_allocated += sizeof(map) + map.getBufferSizeInBytes();
+        bucket_count = map.getBufferSizeInCells();
+    });
 }
 
 void HashedDictionary::calculateBytesAllocated()
@@ -346,7 +388,11 @@ template <typename T>
 void HashedDictionary::createAttributeImpl(Attribute & attribute, const Field & null_value)
 {
     std::get<T>(attribute.null_values) = null_value.get<typename NearestFieldType<T>::Type>();
-    std::get<CollectionPtrType<T>>(attribute.maps) = std::make_unique<CollectionType<T>>();
+
+    if (!sparse)
+        std::get<CollectionPtrType<T>>(attribute.maps) = std::make_unique<CollectionType<T>>();
+    else
+        std::get<SparseCollectionPtrType<T>>(attribute.sparse_maps) = std::make_unique<SparseCollectionType<T>>();
 }
 
 HashedDictionary::Attribute HashedDictionary::createAttributeWithType(const AttributeUnderlyingType type, const Field & null_value)
@@ -368,7 +414,12 @@ HashedDictionary::Attribute HashedDictionary::createAttributeWithType(const Attr
         case AttributeUnderlyingType::String:
         {
             std::get<String>(attr.null_values) = null_value.get<String>();
-            std::get<CollectionPtrType<StringRef>>(attr.maps) = std::make_unique<CollectionType<StringRef>>();
+
+            if (!sparse)
+                std::get<CollectionPtrType<StringRef>>(attr.maps) = std::make_unique<CollectionType<StringRef>>();
+            else
+                std::get<SparseCollectionPtrType<StringRef>>(attr.sparse_maps) = std::make_unique<SparseCollectionType<StringRef>>();
+
             attr.string_arena = std::make_unique<Arena>();
             break;
         }
@@ -411,14 +462,16 @@ void HashedDictionary::getItemsImpl(
     ValueSetter && set_value,
     DefaultGetter && get_default) const
 {
-    const auto & attr = *std::get<CollectionPtrType<AttributeType>>(attribute.maps);
     const auto rows = ext::size(ids);
 
-    for (const auto i : ext::range(0, rows))
+    withAttributeMap<AttributeType>(attribute, [&] (const auto & attr)
     {
-        const auto it = attr.find(ids[i]);
-        set_value(i, it != attr.end() ? it->second : get_default(i));
-    }
+        for (const auto i : ext::range(0, rows))
+        {
+            const auto it = attr.find(ids[i]);
+            set_value(i, it != attr.end() ? it->second : get_default(i));
+        }
+    });
 
     query_count.fetch_add(rows, std::memory_order_relaxed);
 }
@@ -427,8 +480,7 @@ void HashedDictionary::getItemsImpl(
 template <typename T>
 void HashedDictionary::setAttributeValueImpl(Attribute & attribute, const Key id, const T value)
 {
-    auto & map = *std::get<CollectionPtrType<T>>(attribute.maps);
-    map.insert({ id, value });
+    withAttributeMap<T>(attribute, [&] (auto & map) { map.insert({ id, value }); });
 }
 
 void HashedDictionary::setAttributeValue(Attribute & attribute, const Key id, const Field & value)
@@ -447,10 +499,9 @@ void HashedDictionary::setAttributeValue(Attribute & attribute, const Key id, co
         case AttributeUnderlyingType::Float64: setAttributeValueImpl<Float64>(attribute, id, value.get<Float64>()); break;
         case AttributeUnderlyingType::String:
         {
-            auto & map = *std::get<CollectionPtrType<StringRef>>(attribute.maps);
             const auto & string = value.get<String>();
             const auto string_in_arena = attribute.string_arena->insert(string.data(), string.size());
-            map.insert({ id, StringRef{string_in_arena, string.size()} });
+            withAttributeMap<StringRef>(attribute, [&] (auto & map) { map.insert({ id, StringRef{string_in_arena, string.size()} }); });
             break;
         }
     }
@@ -470,11 +521,13 @@ const HashedDictionary::Attribute & HashedDictionary::getAttribute(const std::st
 template <typename T>
 void HashedDictionary::has(const Attribute & attribute, const PaddedPODArray<Key> & ids, PaddedPODArray<UInt8> & out) const
 {
-    const auto & attr = *std::get<CollectionPtrType<T>>(attribute.maps);
     const auto rows = ext::size(ids);
 
-    for (const auto i : ext::range(0, rows))
-        out[i] = attr.find(ids[i]) != std::end(attr);
+    withAttributeMap<T>(attribute, [&] (const auto & attr)
+    {
+        for (const auto i : ext::range(0, rows))
+            out[i] = attr.find(ids[i]) != std::end(attr);
+    });
 
     query_count.fetch_add(rows, std::memory_order_relaxed);
 }
@@ -482,13 +535,16 @@ void HashedDictionary::has(const Attribute & attribute, const PaddedPODArray<Key
 template <typename T>
 PaddedPODArray<HashedDictionary::Key> HashedDictionary::getIds(const Attribute & attribute) const
 {
-    const HashMap<UInt64, T> & attr = *std::get<CollectionPtrType<T>>(attribute.maps);
-
     PaddedPODArray<Key> ids;
-    ids.reserve(attr.size());
-    for (const auto & value : attr) {
-        ids.push_back(value.first);
-    }
+
+    withAttributeMap<T>(attribute, [&] (const auto & attr)
+    {
+        ids.reserve(attr.size());
+        for (const auto & value : attr) {
+            ids.push_back(value.first);
+        }
+    });
+
     return ids;
 }
 
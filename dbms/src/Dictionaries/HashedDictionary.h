@@ -14,11 +14,14 @@
 namespace DB
 {
 
+class DictionarySnapshotWriter;
+
 class HashedDictionary final : public IDictionary
 {
 public:
     HashedDictionary(const std::string & name, const DictionaryStructure & dict_struct,
-        DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty);
+        DictionarySourcePtr source_ptr, const DictionaryLifetime dict_lifetime, bool require_nonempty,
+        bool sparse = false, const std::string & snapshot_path = {}, bool prefer_snapshot = true);
 
     HashedDictionary(const HashedDictionary & other);
 
@@ -26,7 +29,7 @@ public:
 
     std::string getName() const override { return name; }
 
-    std::string getTypeName() const override { return "Hashed"; }
+    std::string getTypeName() const override { return sparse ? "SparseHashed" : "Hashed"; }
 
     size_t getBytesAllocated() const override { return bytes_allocated; }
 
@@ -40,6 +43,8 @@ public:
 
     bool isCached() const override { return false; }
 
+    bool isLoadedFromSnapshot() const override { return loaded_from_snapshot; }
+
     DictionaryPtr clone() const override { return std::make_unique<HashedDictionary>(*this); }
 
     const IDictionarySource * getSource() const override { return source_ptr.get(); }
@@ -129,6 +134,20 @@ private:
     template <typename Value> using CollectionType = HashMap<UInt64, Value>;
     template <typename Value> using CollectionPtrType = std::unique_ptr<CollectionType<Value>>;
 
+    /** A grower for the memory-optimized ('sparse_hashed') layout: the table is filled up to 3/4
+      *  and grows twofold, whereas the default one is filled up to 1/2 and grows fourfold.
+      * Lookups walk longer collision chains, but large dictionaries take about half the memory.
+      */
+    struct SparseGrower : public HashTableGrower<>
+    {
+        size_t maxFill() const { return (3ULL << size_degree) >> 2; }
+        bool overflow(size_t elems) const { return elems > maxFill(); }
+        void increaseSize() { ++size_degree; }
+    };
+
+    template <typename Value> using SparseCollectionType = HashMap<UInt64, Value, DefaultHash<UInt64>, SparseGrower>;
+    template <typename Value> using SparseCollectionPtrType = std::unique_ptr<SparseCollectionType<Value>>;
+
     struct Attribute final
     {
         AttributeUnderlyingType type;
@@ -142,13 +161,24 @@ private:
             CollectionPtrType<Int8>, CollectionPtrType<Int16>, CollectionPtrType<Int32>, CollectionPtrType<Int64>,
             CollectionPtrType<Float32>, CollectionPtrType<Float64>,
             CollectionPtrType<StringRef>> maps;
+        std::tuple<
+            SparseCollectionPtrType<UInt8>, SparseCollectionPtrType<UInt16>, SparseCollectionPtrType<UInt32>, SparseCollectionPtrType<UInt64>,
+            SparseCollectionPtrType<Int8>, SparseCollectionPtrType<Int16>, SparseCollectionPtrType<Int32>, SparseCollectionPtrType<Int64>,
+            SparseCollectionPtrType<Float32>, SparseCollectionPtrType<Float64>,
+            SparseCollectionPtrType<StringRef>> sparse_maps;
         std::unique_ptr<Arena> string_arena;
     };
 
+    /// Applies `f` to the map of the attribute, whichever of the two layouts is in use.
+    template <typename T, typename Attr, typename F>
+    void withAttributeMap(Attr & attribute, F && f) const;
+
     void createAttributes();
 
     void loadData();
 
+    void loadDataFromStream(IBlockInputStream & stream, DictionarySnapshotWriter * snapshot_writer);
+
     template <typename T>
     void addAttributeSize(const Attribute & attribute);
 
@@ -199,10 +229,16 @@ private:
     const DictionarySourcePtr source_ptr;
     const DictionaryLifetime dict_lifetime;
     const bool require_nonempty;
+    const bool sparse;
+    /// Where to save the data of a successful load; empty - snapshots are disabled.
+    const std::string snapshot_path;
+    /// Whether to serve from an existing snapshot. False for clones, so that periodic reloads go to the source.
+    const bool prefer_snapshot;
 
     std::map<std::string, size_t> attribute_index_by_name;
     std::vector<Attribute> attributes;
     const Attribute * hierarchical_attribute = nullptr;
+    bool loaded_from_snapshot = false;
 
     size_t bytes_allocated = 0;
     size_t element_count = 0;
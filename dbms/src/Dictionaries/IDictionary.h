@@ -45,6 +45,10 @@ struct IDictionaryBase : public std::enable_shared_from_this<IDictionaryBase>
     virtual double getLoadFactor() const = 0;
 
     virtual bool isCached() const = 0;
+
+    /// Whether the data was served from a local snapshot rather than loaded from the source.
+    virtual bool isLoadedFromSnapshot() const { return false; }
+
     virtual DictionaryPtr clone() const = 0;
 
     virtual const IDictionarySource * getSource() const = 0;
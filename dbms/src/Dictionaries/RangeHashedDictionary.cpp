@@ -1,5 +1,6 @@
 #include <Dictionaries/RangeHashedDictionary.h>
 #include <Dictionaries/RangeDictionaryBlockInputStream.h>
+#include <set>
 
 
 namespace DB
@@ -12,6 +13,24 @@ namespace ErrorCodes
     extern const int TYPE_MISMATCH;
 }
 
+namespace
+{
+    /// In the segment index: the segment matches no range.
+    constexpr UInt32 no_match = 0xFFFFFFFFU;
+
+    /// `Range::contains(date)` is equivalent to `leftBound(range) <= date <= rightBound(range)`:
+    ///  a bound of 0 or beyond DATE_LUT_MAX_DAY_NUM means the range is open on that side.
+    UInt16 leftBound(const std::pair<UInt16, UInt16> & range)
+    {
+        return (0 < range.first && range.first <= DATE_LUT_MAX_DAY_NUM) ? range.first : 0;
+    }
+
+    UInt16 rightBound(const std::pair<UInt16, UInt16> & range)
+    {
+        return (0 < range.second && range.second <= DATE_LUT_MAX_DAY_NUM) ? range.second : 0xFFFF;
+    }
+}
+
 
 RangeHashedDictionary::RangeHashedDictionary(
     const std::string & name, const DictionaryStructure & dict_struct, DictionarySourcePtr source_ptr,
@@ -74,12 +93,8 @@ void RangeHashedDictionary::getString(
         const auto it = attr.find(ids[i]);
         if (it != std::end(attr))
         {
-            const auto date = dates[i];
-            const auto & ranges_and_values = it->second;
-            const auto val_it = std::find_if(std::begin(ranges_and_values), std::end(ranges_and_values),
-                [date] (const Value<StringRef> & v) { return v.range.contains(date); });
-
-            const auto string_ref = val_it != std::end(ranges_and_values) ? val_it->value : StringRef{null_value};
+            const auto val = findValue(it->second, dates[i]);
+            const auto string_ref = val ? val->value : StringRef{null_value};
             out->insertData(string_ref.data, string_ref.size);
         }
         else
@@ -134,12 +149,126 @@ void RangeHashedDictionary::loadData()
 
     stream->readSuffix();
 
+    buildIndices();
+
     if (require_nonempty && 0 == element_count)
         throw Exception{
             name + ": dictionary source is empty and 'require_nonempty' property is set.",
             ErrorCodes::DICTIONARY_IS_EMPTY};
 }
 
+void RangeHashedDictionary::buildIndices()
+{
+    for (auto & attribute : attributes)
+    {
+        switch (attribute.type)
+        {
+            case AttributeUnderlyingType::UInt8: buildIndicesImpl<UInt8>(attribute); break;
+            case AttributeUnderlyingType::UInt16: buildIndicesImpl<UInt16>(attribute); break;
+            case AttributeUnderlyingType::UInt32: buildIndicesImpl<UInt32>(attribute); break;
+            case AttributeUnderlyingType::UInt64: buildIndicesImpl<UInt64>(attribute); break;
+            case AttributeUnderlyingType::Int8: buildIndicesImpl<Int8>(attribute); break;
+            case AttributeUnderlyingType::Int16: buildIndicesImpl<Int16>(attribute); break;
+            case AttributeUnderlyingType::Int32: buildIndicesImpl<Int32>(attribute); break;
+            case AttributeUnderlyingType::Int64: buildIndicesImpl<Int64>(attribute); break;
+            case AttributeUnderlyingType::Float32: buildIndicesImpl<Float32>(attribute); break;
+            case AttributeUnderlyingType::Float64: buildIndicesImpl<Float64>(attribute); break;
+            case AttributeUnderlyingType::String: buildIndicesImpl<StringRef>(attribute); break;
+        }
+    }
+}
+
+template <typename T>
+void RangeHashedDictionary::buildIndicesImpl(Attribute & attribute)
+{
+    auto & map = *std::get<Ptr<T>>(attribute.maps);
+    for (auto & pair : map)
+        buildIndex(pair.second);
+}
+
+template <typename T>
+void RangeHashedDictionary::buildIndex(Values<T> & values)
+{
+    values.bounds.clear();
+    values.winners.clear();
+
+    /// Sweep over the boundary points of the ranges; the winner of each segment between two
+    ///  adjacent points is the first range covering it - the one the linear scan would find.
+    struct Event
+    {
+        UInt32 point;
+        UInt32 idx;
+        bool is_end;
+    };
+
+    const size_t n = values.values.size();
+
+    std::vector<Event> events;
+    events.reserve(2 * n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto & range = values.values[i].range;
+        events.push_back({leftBound(range), static_cast<UInt32>(i), false});
+        events.push_back({static_cast<UInt32>(rightBound(range)) + 1, static_cast<UInt32>(i), true});
+    }
+
+    std::sort(std::begin(events), std::end(events),
+        [] (const Event & lhs, const Event & rhs) { return lhs.point < rhs.point; });
+
+    std::set<UInt32> active;
+    size_t pos = 0;
+
+    while (pos < events.size())
+    {
+        const auto point = events[pos].point;
+
+        /// Past the end of the domain - only deactivations remain.
+        if (point > 0xFFFF)
+            break;
+
+        /// Nothing matches before the first range starts.
+        if (values.bounds.empty() && point > 0)
+        {
+            values.bounds.push_back(0);
+            values.winners.push_back(no_match);
+        }
+
+        while (pos < events.size() && events[pos].point == point)
+        {
+            if (events[pos].is_end)
+                active.erase(events[pos].idx);
+            else
+                active.insert(events[pos].idx);
+            ++pos;
+        }
+
+        const auto winner = active.empty() ? no_match : *std::begin(active);
+        if (values.winners.empty() || values.winners.back() != winner)
+        {
+            values.bounds.push_back(static_cast<UInt16>(point));
+            values.winners.push_back(winner);
+        }
+    }
+}
+
+template <typename T>
+const RangeHashedDictionary::Value<T> * RangeHashedDictionary::findValue(const Values<T> & values, const UInt16 date)
+{
+    if (values.bounds.empty())
+    {
+        /// The index has not been built yet - fall back to the scan.
+        const auto val_it = std::find_if(std::begin(values.values), std::end(values.values),
+            [date] (const Value<T> & v) { return v.range.contains(date); });
+
+        return val_it != std::end(values.values) ? &*val_it : nullptr;
+    }
+
+    const auto pos = std::upper_bound(std::begin(values.bounds), std::end(values.bounds), date) - std::begin(values.bounds);
+    const auto winner = values.winners[pos - 1];
+    return winner != no_match ? &values.values[winner] : nullptr;
+}
+
 template <typename T>
 void RangeHashedDictionary::addAttributeSize(const Attribute & attribute)
 {
@@ -254,12 +383,8 @@ void RangeHashedDictionary::getItemsImpl(
         const auto it = attr.find(ids[i]);
         if (it != std::end(attr))
         {
-            const auto date = dates[i];
-            const auto & ranges_and_values = it->second;
-            const auto val_it = std::find_if(std::begin(ranges_and_values), std::end(ranges_and_values),
-                [date] (const Value<AttributeType> & v) { return v.range.contains(date); });
-
-            out[i] = val_it != std::end(ranges_and_values) ? val_it->value : null_value;
+            const auto val = findValue(it->second, dates[i]);
+            out[i] = val ? val->value : null_value;
         }
         else
             out[i] = null_value;
@@ -277,7 +402,7 @@ void RangeHashedDictionary::setAttributeValueImpl(Attribute & attribute, const K
 
     if (it != map.end())
     {
-        auto & values = it->second;
+        auto & values = it->second.values;
 
         const auto insert_it = std::lower_bound(std::begin(values), std::end(values), range,
             [] (const Value<T> & lhs, const Range & range) {
@@ -287,7 +412,7 @@ void RangeHashedDictionary::setAttributeValueImpl(Attribute & attribute, const K
         values.insert(insert_it, Value<T>{ range, value });
     }
     else
-        map.insert({ id, Values<T>{ Value<T>{ range, value } } });
+        map.insert({ id, Values<T>{ { Value<T>{ range, value } } } });
 }
 
 void RangeHashedDictionary::setAttributeValue(Attribute & attribute, const Key id, const Range & range, const Field & value)
@@ -315,7 +440,7 @@ void RangeHashedDictionary::setAttributeValue(Attribute & attribute, const Key i
 
             if (it != map.end())
             {
-                auto & values = it->second;
+                auto & values = it->second.values;
 
                 const auto insert_it = std::lower_bound(std::begin(values), std::end(values), range,
                     [] (const Value<StringRef> & lhs, const Range & range) {
@@ -325,7 +450,7 @@ void RangeHashedDictionary::setAttributeValue(Attribute & attribute, const Key i
                 values.insert(insert_it, Value<StringRef>{ range, string_ref });
             }
             else
-                map.insert({ id, Values<StringRef>{ Value<StringRef>{ range, string_ref } } });
+                map.insert({ id, Values<StringRef>{ { Value<StringRef>{ range, string_ref } } } });
 
             break;
         }
@@ -387,7 +512,7 @@ void RangeHashedDictionary::getIdsAndDates(const Attribute& attribute, PaddedPOD
 
     for (const auto & key : attr) {
         ids.push_back(key.first);
-        for (const auto & value : key.second)
+        for (const auto & value : key.second.values)
         {
             start_dates.push_back(value.range.first);
             end_dates.push_back(value.range.second);
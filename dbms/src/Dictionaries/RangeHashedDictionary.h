@@ -111,7 +111,21 @@ private:
         T value;
     };
 
-    template <typename T> using Values = std::vector<Value<T>>;
+    template <typename T>
+    struct Values final
+    {
+        std::vector<Value<T>> values;
+
+        /** Decomposition of the ranges into disjoint segments, built by `buildIndices` after
+          *  loading: `bounds[i]` opens the i-th segment and `winners[i]` is the index in
+          *  `values` that the linear scan would match anywhere inside it (`no_match` - none).
+          * A lookup is then a single `upper_bound` over `bounds` instead of a scan over
+          *  all ranges of the key.
+          */
+        std::vector<UInt16> bounds;
+        std::vector<UInt32> winners;
+    };
+
     template <typename T> using Collection = HashMap<UInt64, Values<T>>;
     template <typename T> using Ptr = std::unique_ptr<Collection<T>>;
 
@@ -133,6 +147,18 @@ private:
 
     void loadData();
 
+    void buildIndices();
+
+    template <typename T>
+    void buildIndicesImpl(Attribute & attribute);
+
+    template <typename T>
+    static void buildIndex(Values<T> & values);
+
+    /// Returns the range containing the date the way the linear scan would, or nullptr.
+    template <typename T>
+    static const Value<T> * findValue(const Values<T> & values, UInt16 date);
+
     template <typename T>
     void addAttributeSize(const Attribute & attribute);
 
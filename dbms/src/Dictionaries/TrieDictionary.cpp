@@ -11,6 +11,7 @@
 #include <DataTypes/DataTypeString.h>
 #include <IO/WriteIntText.h>
 #include <Common/formatIPv6.h>
+#include <Common/typeid_cast.h>
 #include <iostream>
 #include <btrie.h>
 
@@ -285,12 +286,69 @@ void TrieDictionary::loadData()
 
     stream->readSuffix();
 
+    buildIPv4Table();
+
     if (require_nonempty && 0 == element_count)
         throw Exception{
             name + ": dictionary source is empty and 'require_nonempty' property is set.",
             ErrorCodes::DICTIONARY_IS_EMPTY};
 }
 
+void TrieDictionary::buildIPv4Table()
+{
+    if (ipv4_prefixes.empty())
+        return;
+
+    /// Shortest prefixes first: a longer prefix repaints the sub-range of any prefix it refines,
+    ///  so every entry ends up with its longest match. Leaf nodes appear only for prefixes
+    ///  longer than the root stride and inherit the entry they split.
+    std::stable_sort(std::begin(ipv4_prefixes), std::end(ipv4_prefixes),
+        [] (const IPv4Prefix & lhs, const IPv4Prefix & rhs) { return lhs.len < rhs.len; });
+
+    ipv4_root.assign(1ULL << ipv4_root_bits, ipv4_null);
+
+    for (const auto & prefix : ipv4_prefixes)
+    {
+        if (prefix.len <= ipv4_root_bits)
+        {
+            const size_t base = prefix.addr >> (32 - ipv4_root_bits);
+            const size_t count = 1ULL << (ipv4_root_bits - prefix.len);
+            std::fill(&ipv4_root[base], &ipv4_root[base] + count, prefix.slot);
+        }
+        else
+        {
+            auto & root_entry = ipv4_root[prefix.addr >> (32 - ipv4_root_bits)];
+            if (root_entry == ipv4_null || !(root_entry & ipv4_leaf_flag))
+            {
+                const auto block = static_cast<UInt32>(ipv4_leaves.size() / 256);
+                ipv4_leaves.resize(ipv4_leaves.size() + 256, root_entry);
+                root_entry = ipv4_leaf_flag | block;
+            }
+
+            const auto block_begin = &ipv4_leaves[(root_entry & ~ipv4_leaf_flag) * 256];
+            const size_t offset = prefix.addr & 0xFF;
+            const size_t count = 1ULL << (32 - prefix.len);
+            std::fill(block_begin + offset, block_begin + offset + count, prefix.slot);
+        }
+    }
+
+    ipv4_prefixes.clear();
+    ipv4_prefixes.shrink_to_fit();
+}
+
+void TrieDictionary::lookupIPv4Column(const UInt32 * addrs, size_t rows, UInt32 * slots) const
+{
+    static constexpr size_t prefetch_distance = 16;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (i + prefetch_distance < rows)
+            __builtin_prefetch(&ipv4_root[addrs[i + prefetch_distance] >> (32 - ipv4_root_bits)]);
+
+        slots[i] = findIPv4Slot(addrs[i]);
+    }
+}
+
 template <typename T>
 void TrieDictionary::addAttributeSize(const Attribute & attribute)
 {
@@ -328,6 +386,7 @@ void TrieDictionary::calculateBytesAllocated()
     }
 
     bytes_allocated += btrie_allocated(trie);
+    bytes_allocated += (ipv4_root.capacity() + ipv4_leaves.capacity()) * sizeof(UInt32);
 }
 
 void TrieDictionary::validateKeyTypes(const DataTypes & key_types) const
@@ -421,11 +480,28 @@ void TrieDictionary::getItemsImpl(
     const auto rows = first_column->size();
     if (first_column->isNumeric())
     {
-        for (const auto i : ext::range(0, rows))
+        if (!ipv4_root.empty())
         {
-            auto addr = Int32(first_column->get64(i));
-            uintptr_t slot = btrie_find(trie, addr);
-            set_value(i, slot != BTRIE_NULL ? vec[slot] : get_default(i));
+            /// The batch path: resolve the whole column through the level-compressed table at once.
+            PaddedPODArray<UInt32> slots(rows);
+
+            if (const auto vector_column = typeid_cast<const ColumnVector<UInt32> *>(first_column.get()))
+                lookupIPv4Column(vector_column->getData().data(), rows, slots.data());
+            else
+                for (const auto i : ext::range(0, rows))
+                    slots[i] = findIPv4Slot(static_cast<UInt32>(first_column->get64(i)));
+
+            for (const auto i : ext::range(0, rows))
+                set_value(i, slots[i] != ipv4_null ? vec[slots[i]] : get_default(i));
+        }
+        else
+        {
+            for (const auto i : ext::range(0, rows))
+            {
+                auto addr = Int32(first_column->get64(i));
+                uintptr_t slot = btrie_find(trie, addr);
+                set_value(i, slot != BTRIE_NULL ? vec[slot] : get_default(i));
+            }
         }
     }
     else
@@ -480,7 +556,18 @@ bool TrieDictionary::setAttributeValueImpl(Attribute & attribute, const StringRe
     {
         UInt32 addr_v4 = Poco::ByteOrder::toNetwork(*reinterpret_cast<const UInt32*>(addr.addr()));
         UInt32 mask_v4 = Poco::ByteOrder::toNetwork(*reinterpret_cast<const UInt32*>(mask.addr()));
-        return btrie_insert(trie, addr_v4, mask_v4, row) == 0;
+        const auto inserted = btrie_insert(trie, addr_v4, mask_v4, row) == 0;
+
+        /// Remember the prefix for `buildIPv4Table`. The same key arrives once per attribute
+        ///  with the same slot - record it once.
+        const IPv4Prefix prefix{addr_v4 & mask_v4, static_cast<UInt8>(__builtin_popcount(mask_v4)), static_cast<UInt32>(row)};
+        if (ipv4_prefixes.empty()
+            || ipv4_prefixes.back().addr != prefix.addr
+            || ipv4_prefixes.back().len != prefix.len
+            || ipv4_prefixes.back().slot != prefix.slot)
+            ipv4_prefixes.push_back(prefix);
+
+        return inserted;
     }
 
     const uint8_t* addr_v6 = reinterpret_cast<const uint8_t*>(addr.addr());
@@ -532,11 +619,27 @@ void TrieDictionary::has(const Attribute & attribute, const Columns & key_column
     const auto rows = first_column->size();
     if (first_column->isNumeric())
     {
-        for (const auto i : ext::range(0, rows))
+        if (!ipv4_root.empty())
         {
-            auto addr = Int32(first_column->get64(i));
-            uintptr_t slot = btrie_find(trie, addr);
-            out[i] = (slot != BTRIE_NULL);
+            PaddedPODArray<UInt32> slots(rows);
+
+            if (const auto vector_column = typeid_cast<const ColumnVector<UInt32> *>(first_column.get()))
+                lookupIPv4Column(vector_column->getData().data(), rows, slots.data());
+            else
+                for (const auto i : ext::range(0, rows))
+                    slots[i] = findIPv4Slot(static_cast<UInt32>(first_column->get64(i)));
+
+            for (const auto i : ext::range(0, rows))
+                out[i] = (slots[i] != ipv4_null);
+        }
+        else
+        {
+            for (const auto i : ext::range(0, rows))
+            {
+                auto addr = Int32(first_column->get64(i));
+                uintptr_t slot = btrie_find(trie, addr);
+                out[i] = (slot != BTRIE_NULL);
+            }
         }
     }
     else
@@ -199,6 +199,35 @@ private:
 
     Columns getKeyColumns() const;
 
+    /** Level-compressed representation of the IPv4 part of the trie, built after loading:
+      *  the root node has a 24-bit stride and, for prefixes longer than /24, points to
+      *  second-level nodes with an 8-bit stride, all in contiguous arrays. A lookup is one
+      *  or two indexed reads instead of a bit-by-bit trie walk. IPv6 keys keep the trie.
+      */
+    struct IPv4Prefix
+    {
+        UInt32 addr;
+        UInt8 len;
+        UInt32 slot;
+    };
+
+    static constexpr size_t ipv4_root_bits = 24;
+    static constexpr UInt32 ipv4_null = 0xFFFFFFFFU;
+    static constexpr UInt32 ipv4_leaf_flag = 0x80000000U;
+
+    void buildIPv4Table();
+
+    UInt32 findIPv4Slot(UInt32 addr) const
+    {
+        UInt32 entry = ipv4_root[addr >> (32 - ipv4_root_bits)];
+        if (entry != ipv4_null && (entry & ipv4_leaf_flag))
+            entry = ipv4_leaves[(entry & ~ipv4_leaf_flag) * 256 + (addr & 0xFF)];
+        return entry;
+    }
+
+    /// Resolves a whole column of addresses at once, prefetching the root entries ahead of use.
+    void lookupIPv4Column(const UInt32 * addrs, size_t rows, UInt32 * slots) const;
+
     const std::string name;
     const DictionaryStructure dict_struct;
     const DictionarySourcePtr source_ptr;
@@ -211,6 +240,10 @@ private:
     std::map<std::string, size_t> attribute_index_by_name;
     std::vector<Attribute> attributes;
 
+    std::vector<IPv4Prefix> ipv4_prefixes;    /// Only while loading; consumed by `buildIPv4Table`.
+    std::vector<UInt32> ipv4_root;
+    std::vector<UInt32> ipv4_leaves;
+
     size_t bytes_allocated = 0;
     size_t element_count = 0;
     size_t bucket_count = 0;
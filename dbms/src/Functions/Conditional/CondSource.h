@@ -28,6 +28,17 @@ public:
         return data_array.size();
     }
 
+    /// Whether the condition may contain NULLs. If not, getData() gives raw access for vectorized processing.
+    inline bool hasNullMap() const
+    {
+        return !null_map.empty();
+    }
+
+    inline const PaddedPODArray<UInt8> & getData() const
+    {
+        return data_array;
+    }
+
 private:
     const ColumnPtr materialized_col;
     const PaddedPODArray<UInt8> & data_array;
@@ -37,6 +37,10 @@ class NumericSource
 {
 public:
     virtual TResult get(size_t i) const = 0;
+
+    /// Write the values of all rows at once; used by the branchless path of NumericEvaluator.
+    virtual void fill(TResult * res, size_t count) const = 0;
+
     virtual ~NumericSource() = default;
 };
 
@@ -70,6 +74,12 @@ public:
         return static_cast<TResult>(data);
     };
 
+    void fill(TResult * res, size_t count) const override
+    {
+        for (size_t i = 0; i < count; ++i)
+            res[i] = static_cast<TResult>(data);
+    }
+
 private:
     TType data;
 };
@@ -88,6 +98,12 @@ public:
         return static_cast<TResult>(data_array[i]);
     };
 
+    void fill(TResult * res, size_t count) const override
+    {
+        for (size_t i = 0; i < count; ++i)
+            res[i] = static_cast<TResult>(data_array[i]);
+    }
+
 private:
     static const PaddedPODArray<TType> & initDataArray(const Block & block,
         const ColumnNumbers & args, const Branch & br)
@@ -144,6 +160,22 @@ public:
         if (builder)
             builder.init(args);
 
+        /** If no null map has to be maintained and the conditions cannot contain NULLs,
+          *  evaluate every branch wholesale and blend the columns with mask arithmetic
+          *  instead of branching per row: the inner loops are trivial for the compiler
+          *  to vectorize, and there are no data-dependent branches to mispredict.
+          */
+        bool has_nullable_cond = false;
+        for (const auto & cond : conds)
+            if (cond.hasNullMap())
+                has_nullable_cond = true;
+
+        if (!builder && !has_nullable_cond)
+        {
+            performBranchless(conds, sources, res, row_count);
+            return;
+        }
+
         for (size_t cur_row = 0; cur_row < row_count; ++cur_row)
         {
             bool has_triggered_cond = false;
@@ -172,6 +204,25 @@ public:
     }
 
 private:
+    static void performBranchless(const CondSources & conds, const NumericSources<TResult> & sources,
+        PaddedPODArray<TResult> & res, size_t row_count)
+    {
+        /// Start from the else branch and apply the conditions from the last to the first,
+        ///  so that the values of earlier triggered conditions prevail.
+        sources.back()->fill(res.data(), row_count);
+
+        PaddedPODArray<TResult> branch_values(row_count);
+
+        for (size_t cur_source = conds.size(); cur_source > 0; --cur_source)
+        {
+            const UInt8 * cond_data = conds[cur_source - 1].getData().data();
+            sources[cur_source - 1]->fill(branch_values.data(), row_count);
+
+            for (size_t cur_row = 0; cur_row < row_count; ++cur_row)
+                res[cur_row] = cond_data[cur_row] ? branch_values[cur_row] : res[cur_row];
+        }
+    }
+
     /// Create the result column.
     static PaddedPODArray<TResult> & createSink(Block & block, size_t result, size_t size)
     {
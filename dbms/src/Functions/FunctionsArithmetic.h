@@ -5,12 +5,14 @@
 #include <DataTypes/DataTypeDateTime.h>
 #include <Columns/ColumnVector.h>
 #include <Columns/ColumnConst.h>
+#include <Columns/ColumnsCommon.h>
 #include <Functions/IFunction.h>
 #include <Functions/FunctionHelpers.h>
 #include <DataTypes/NumberTraits.h>
 #include <Core/AccurateComparison.h>
 #include <Core/FieldVisitors.h>
 #include <Common/typeid_cast.h>
+#include <Common/TargetSpecific.h>
 #include <IO/WriteHelpers.h>
 #include <ext/range.h>
 
@@ -33,11 +35,13 @@ namespace ErrorCodes
   * Etc.
   */
 
-template <typename A, typename B, typename Op, typename ResultType_ = typename Op::ResultType>
-struct BinaryOperationImplBase
-{
-    using ResultType = ResultType_;
+/// The inner loops are compiled both for the build target and for AVX2 (see TargetSpecific.h),
+///  so the stock binary uses wider vectors on machines that have them.
+DECLARE_MULTITARGET_CODE(
 
+template <typename A, typename B, typename Op, typename ResultType>
+struct BinaryOperationImplLoops
+{
     static void NO_INLINE vector_vector(const PaddedPODArray<A> & a, const PaddedPODArray<B> & b, PaddedPODArray<ResultType> & c)
     {
         size_t size = a.size();
@@ -45,18 +49,110 @@ struct BinaryOperationImplBase
             c[i] = Op::template apply<ResultType>(a[i], b[i]);
     }
 
-    static void NO_INLINE vector_constant(const PaddedPODArray<A> & a, B b, PaddedPODArray<ResultType> & c)
+    static void NO_INLINE vector_constant(const A * a_pos, const A * a_end, B b, ResultType * c_pos)
+    {
+        while (a_pos < a_end)
+        {
+            *c_pos = Op::template apply<ResultType>(*a_pos, b);
+            ++a_pos;
+            ++c_pos;
+        }
+    }
+
+    static void NO_INLINE constant_vector(A a, const B * b_pos, const B * b_end, ResultType * c_pos)
+    {
+        while (b_pos < b_end)
+        {
+            *c_pos = Op::template apply<ResultType>(a, *b_pos);
+            ++b_pos;
+            ++c_pos;
+        }
+    }
+};
+
+template <typename A, typename Op, typename ResultType>
+struct UnaryOperationImplLoops
+{
+    static void NO_INLINE vector(const PaddedPODArray<A> & a, PaddedPODArray<ResultType> & c)
     {
         size_t size = a.size();
         for (size_t i = 0; i < size; ++i)
-            c[i] = Op::template apply<ResultType>(a[i], b);
+            c[i] = Op::apply(a[i]);
     }
+};
+
+) /// DECLARE_MULTITARGET_CODE
 
-    static void NO_INLINE constant_vector(A a, const PaddedPODArray<B> & b, PaddedPODArray<ResultType> & c)
+template <typename A, typename B, typename Op, typename ResultType_ = typename Op::ResultType>
+struct BinaryOperationImplBase
+{
+    using ResultType = ResultType_;
+
+    static void vector_vector(const PaddedPODArray<A> & a, const PaddedPODArray<B> & b, PaddedPODArray<ResultType> & c)
     {
-        size_t size = b.size();
-        for (size_t i = 0; i < size; ++i)
-            c[i] = Op::template apply<ResultType>(a, b[i]);
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::BinaryOperationImplLoops<A, B, Op, ResultType>::vector_vector(a, b, c);
+        else
+            TargetSpecific::Default::BinaryOperationImplLoops<A, B, Op, ResultType>::vector_vector(a, b, c);
+    }
+
+    static void vector_constant(const PaddedPODArray<A> & a, B b, PaddedPODArray<ResultType> & c)
+    {
+        /** Long runs of equal values (leading primary key columns read in PK order) are
+          *  computed once per run; see the analogous code in NumComparisonImpl.
+          */
+        static constexpr size_t min_run_length = 64;
+
+        const A * a_pos = &a[0];
+        const A * a_end = a_pos + a.size();
+        ResultType * c_pos = &c[0];
+
+        while (a_pos < a_end)
+        {
+            const A * run_end = findRunEnd(a_pos, a_end);
+            if (static_cast<size_t>(run_end - a_pos) < min_run_length)
+                break;
+
+            std::fill(c_pos, c_pos + (run_end - a_pos), Op::template apply<ResultType>(*a_pos, b));
+            c_pos += run_end - a_pos;
+            a_pos = run_end;
+        }
+
+        if (a_pos == a_end)
+            return;
+
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::BinaryOperationImplLoops<A, B, Op, ResultType>::vector_constant(a_pos, a_end, b, c_pos);
+        else
+            TargetSpecific::Default::BinaryOperationImplLoops<A, B, Op, ResultType>::vector_constant(a_pos, a_end, b, c_pos);
+    }
+
+    static void constant_vector(A a, const PaddedPODArray<B> & b, PaddedPODArray<ResultType> & c)
+    {
+        static constexpr size_t min_run_length = 64;
+
+        const B * b_pos = &b[0];
+        const B * b_end = b_pos + b.size();
+        ResultType * c_pos = &c[0];
+
+        while (b_pos < b_end)
+        {
+            const B * run_end = findRunEnd(b_pos, b_end);
+            if (static_cast<size_t>(run_end - b_pos) < min_run_length)
+                break;
+
+            std::fill(c_pos, c_pos + (run_end - b_pos), Op::template apply<ResultType>(a, *b_pos));
+            c_pos += run_end - b_pos;
+            b_pos = run_end;
+        }
+
+        if (b_pos == b_end)
+            return;
+
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::BinaryOperationImplLoops<A, B, Op, ResultType>::constant_vector(a, b_pos, b_end, c_pos);
+        else
+            TargetSpecific::Default::BinaryOperationImplLoops<A, B, Op, ResultType>::constant_vector(a, b_pos, b_end, c_pos);
     }
 
     static void constant_constant(A a, B b, ResultType & c)
@@ -76,11 +172,12 @@ struct UnaryOperationImpl
 {
     using ResultType = typename Op::ResultType;
 
-    static void NO_INLINE vector(const PaddedPODArray<A> & a, PaddedPODArray<ResultType> & c)
+    static void vector(const PaddedPODArray<A> & a, PaddedPODArray<ResultType> & c)
     {
-        size_t size = a.size();
-        for (size_t i = 0; i < size; ++i)
-            c[i] = Op::apply(a[i]);
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::UnaryOperationImplLoops<A, Op, ResultType>::vector(a, c);
+        else
+            TargetSpecific::Default::UnaryOperationImplLoops<A, Op, ResultType>::vector(a, c);
     }
 
     static void constant(A a, ResultType & c)
@@ -689,6 +786,82 @@ private:
         return false;
     }
 
+    /// The kernel for a fully resolved pair of argument data types, for the dispatch cache
+    ///  (see IFunction::resolveKernel). Only the checks of the column forms remain per block.
+    template <typename LeftDataType, typename RightDataType>
+    static void resolvedKernel(Block & block, const ColumnNumbers & arguments, size_t result)
+    {
+        FunctionBinaryArithmetic func;
+        using ColVecLeft = ColumnVector<typename LeftDataType::FieldType>;
+
+        if (auto col_left = checkAndGetColumn<ColVecLeft>(block.getByPosition(arguments[0]).column.get()))
+        {
+            if (func.template executeRightType<LeftDataType, RightDataType>(block, arguments, result, col_left))
+                return;
+        }
+        else if (auto col_left = checkAndGetColumnConst<ColVecLeft>(block.getByPosition(arguments[0]).column.get()))
+        {
+            if (func.template executeRightType<LeftDataType, RightDataType>(block, arguments, result, col_left))
+                return;
+        }
+        else
+            throw Exception("Illegal column " + block.getByPosition(arguments[0]).column->getName()
+                + " of first argument of function " + String(name),
+                ErrorCodes::ILLEGAL_COLUMN);
+
+        throw Exception("Illegal column " + block.getByPosition(arguments[1]).column->getName()
+            + " of second argument of function " + String(name),
+            ErrorCodes::ILLEGAL_COLUMN);
+    }
+
+    /// Overload for InvalidType
+    template <typename LeftDataType, typename RightDataType,
+              typename std::enable_if<std::is_same<
+                  typename BinaryOperationTraits<Op, LeftDataType, RightDataType>::ResultDataType, InvalidType>::value>::type * = nullptr>
+    static Kernel resolveRightKernelImpl()
+    {
+        return nullptr;
+    }
+
+    /// Overload for well-defined operations
+    template <typename LeftDataType, typename RightDataType,
+              typename std::enable_if<!std::is_same<
+                  typename BinaryOperationTraits<Op, LeftDataType, RightDataType>::ResultDataType, InvalidType>::value>::type * = nullptr>
+    static Kernel resolveRightKernelImpl()
+    {
+        return &resolvedKernel<LeftDataType, RightDataType>;
+    }
+
+    template <typename LeftDataType, typename RightDataType>
+    bool resolveRightKernel(const Block & block, const ColumnNumbers & arguments, Kernel & res) const
+    {
+        if (!typeid_cast<const RightDataType *>(block.getByPosition(arguments[1]).type.get()))
+            return false;
+
+        res = resolveRightKernelImpl<LeftDataType, RightDataType>();
+        return res != nullptr;
+    }
+
+    template <typename LeftDataType>
+    bool resolveLeftKernel(const Block & block, const ColumnNumbers & arguments, Kernel & res) const
+    {
+        if (!typeid_cast<const LeftDataType *>(block.getByPosition(arguments[0]).type.get()))
+            return false;
+
+        return resolveRightKernel<LeftDataType, DataTypeDate>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeDateTime>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeUInt8>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeUInt16>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeUInt32>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeUInt64>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeInt8>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeInt16>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeInt32>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeInt64>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeFloat32>(block, arguments, res)
+            || resolveRightKernel<LeftDataType, DataTypeFloat64>(block, arguments, res);
+    }
+
     template <typename LeftDataType>
     bool executeLeftType(Block & block, const ColumnNumbers & arguments, const size_t result)
     {
@@ -793,6 +966,27 @@ public:
                 + " of first argument of function " + getName(),
                 ErrorCodes::ILLEGAL_COLUMN);
     }
+
+    Kernel resolveKernel(const Block & block, const ColumnNumbers & arguments) const override
+    {
+        Kernel res = nullptr;
+
+        if (   resolveLeftKernel<DataTypeDate>(block, arguments, res)
+            || resolveLeftKernel<DataTypeDateTime>(block, arguments, res)
+            || resolveLeftKernel<DataTypeUInt8>(block, arguments, res)
+            || resolveLeftKernel<DataTypeUInt16>(block, arguments, res)
+            || resolveLeftKernel<DataTypeUInt32>(block, arguments, res)
+            || resolveLeftKernel<DataTypeUInt64>(block, arguments, res)
+            || resolveLeftKernel<DataTypeInt8>(block, arguments, res)
+            || resolveLeftKernel<DataTypeInt16>(block, arguments, res)
+            || resolveLeftKernel<DataTypeInt32>(block, arguments, res)
+            || resolveLeftKernel<DataTypeInt64>(block, arguments, res)
+            || resolveLeftKernel<DataTypeFloat32>(block, arguments, res)
+            || resolveLeftKernel<DataTypeFloat64>(block, arguments, res))
+            return res;
+
+        return nullptr;
+    }
 };
 
 
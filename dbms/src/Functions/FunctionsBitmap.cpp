@@ -0,0 +1,179 @@
+#include <Functions/IFunction.h>
+#include <Functions/FunctionFactory.h>
+#include <Functions/FunctionHelpers.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataTypes/DataTypeAggregateFunction.h>
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnAggregateFunction.h>
+#include <Common/typeid_cast.h>
+#include <AggregateFunctions/AggregateFunctionGroupBitmap.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int ILLEGAL_TYPE_OF_ARGUMENT;
+    extern const int ILLEGAL_COLUMN;
+}
+
+/** Bitwise operations over the states of the `groupBitmap` aggregate function
+  *  (compressed bitmaps of 32-bit ids, see AggregateFunctionGroupBitmap.h):
+  *
+  * bitmapCardinality(bitmap) - the number of set bits, as UInt64;
+  * bitmapAnd(a, b), bitmapOr(a, b), bitmapAndnot(a, b) - combine two states into a new state.
+  *
+  * The binary functions work row by row and return a state again, so they compose:
+  *  bitmapCardinality(bitmapAnd(a, bitmapOr(b, c))).
+  */
+
+static void checkBitmapArgumentType(const DataTypePtr & argument, const String & function_name)
+{
+    const DataTypeAggregateFunction * type = checkAndGetDataType<DataTypeAggregateFunction>(argument.get());
+    if (!type || type->getFunctionName() != "groupBitmap")
+        throw Exception("Argument for function " + function_name + " must have type AggregateFunction(groupBitmap, ...).",
+            ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+}
+
+static const ColumnAggregateFunction & getBitmapStatesColumn(Block & block, size_t argument, const String & function_name)
+{
+    const ColumnAggregateFunction * column
+        = typeid_cast<const ColumnAggregateFunction *>(&*block.getByPosition(argument).column);
+    if (!column)
+        throw Exception("Illegal column " + block.getByPosition(argument).column->getName()
+                + " of argument of function " + function_name,
+            ErrorCodes::ILLEGAL_COLUMN);
+
+    return *column;
+}
+
+static const AggregateFunctionGroupBitmapData & bitmapStateAt(const ColumnAggregateFunction & column, size_t row_num)
+{
+    /// The state layout does not depend on the width of the input column (see AggregateFunctionGroupBitmapData).
+    return *reinterpret_cast<const AggregateFunctionGroupBitmapData *>(column.getData()[row_num]);
+}
+
+
+class FunctionBitmapCardinality : public IFunction
+{
+public:
+    static constexpr auto name = "bitmapCardinality";
+    static FunctionPtr create(const Context & context)
+    {
+        return std::make_shared<FunctionBitmapCardinality>();
+    }
+
+    String getName() const override
+    {
+        return name;
+    }
+
+    size_t getNumberOfArguments() const override
+    {
+        return 1;
+    }
+
+    DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
+    {
+        checkBitmapArgumentType(arguments[0], getName());
+        return std::make_shared<DataTypeUInt64>();
+    }
+
+    void executeImpl(Block & block, const ColumnNumbers & arguments, size_t result) override
+    {
+        const ColumnAggregateFunction & column = getBitmapStatesColumn(block, arguments[0], getName());
+
+        auto col_res = std::make_shared<ColumnUInt64>();
+        ColumnUInt64::Container_t & vec_res = col_res->getData();
+
+        size_t rows = column.size();
+        vec_res.resize(rows);
+
+        for (size_t i = 0; i < rows; ++i)
+            vec_res[i] = bitmapStateAt(column, i).bitmap.size();
+
+        block.getByPosition(result).column = col_res;
+    }
+};
+
+
+template <typename Impl>
+class FunctionBitmapBinary : public IFunction
+{
+public:
+    static constexpr auto name = Impl::name;
+    static FunctionPtr create(const Context & context)
+    {
+        return std::make_shared<FunctionBitmapBinary>();
+    }
+
+    String getName() const override
+    {
+        return name;
+    }
+
+    size_t getNumberOfArguments() const override
+    {
+        return 2;
+    }
+
+    DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
+    {
+        checkBitmapArgumentType(arguments[0], getName());
+        checkBitmapArgumentType(arguments[1], getName());
+        return arguments[0]->clone();
+    }
+
+    void executeImpl(Block & block, const ColumnNumbers & arguments, size_t result) override
+    {
+        const ColumnAggregateFunction & column_a = getBitmapStatesColumn(block, arguments[0], getName());
+        const ColumnAggregateFunction & column_b = getBitmapStatesColumn(block, arguments[1], getName());
+
+        auto col_res = std::make_shared<ColumnAggregateFunction>(column_a.getAggregateFunction());
+
+        size_t rows = column_a.size();
+        col_res->reserve(rows);
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            /// A copy of the left state in the arena of the result column, then the operation in place.
+            col_res->insertFrom(column_a.getData()[i]);
+
+            AggregateFunctionGroupBitmapData & state
+                = *reinterpret_cast<AggregateFunctionGroupBitmapData *>(col_res->getData().back());
+            Impl::apply(state.bitmap, bitmapStateAt(column_b, i).bitmap);
+        }
+
+        block.getByPosition(result).column = col_res;
+    }
+};
+
+struct BitmapAndImpl
+{
+    static constexpr auto name = "bitmapAnd";
+    static void apply(RoaringBitmap & a, const RoaringBitmap & b) { a.intersect(b); }
+};
+
+struct BitmapOrImpl
+{
+    static constexpr auto name = "bitmapOr";
+    static void apply(RoaringBitmap & a, const RoaringBitmap & b) { a.merge(b); }
+};
+
+struct BitmapAndnotImpl
+{
+    static constexpr auto name = "bitmapAndnot";
+    static void apply(RoaringBitmap & a, const RoaringBitmap & b) { a.subtract(b); }
+};
+
+
+void registerFunctionsBitmap(FunctionFactory & factory)
+{
+    factory.registerFunction<FunctionBitmapCardinality>();
+    factory.registerFunction<FunctionBitmapBinary<BitmapAndImpl>>();
+    factory.registerFunction<FunctionBitmapBinary<BitmapOrImpl>>();
+    factory.registerFunction<FunctionBitmapBinary<BitmapAndnotImpl>>();
+}
+
+}
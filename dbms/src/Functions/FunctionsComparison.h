@@ -6,6 +6,8 @@
 #include <Columns/ColumnFixedString.h>
 #include <Columns/ColumnTuple.h>
 #include <Columns/ColumnArray.h>
+#include <Columns/ColumnDictionary.h>
+#include <Columns/ColumnsCommon.h>
 
 #include <DataTypes/DataTypesNumber.h>
 #include <DataTypes/DataTypeDateTime.h>
@@ -15,11 +17,14 @@
 #include <DataTypes/DataTypeFixedString.h>
 #include <DataTypes/DataTypeTuple.h>
 #include <DataTypes/DataTypeEnum.h>
+#include <DataTypes/DataTypeDictionary.h>
 
 #include <Functions/FunctionsLogical.h>
 #include <Functions/IFunction.h>
 #include <Functions/FunctionHelpers.h>
 
+#include <Common/TargetSpecific.h>
+
 #include <Core/AccurateComparison.h>
 #include <IO/ReadBufferFromMemory.h>
 #include <IO/ReadHelpers.h>
@@ -90,8 +95,11 @@ template <typename A, typename B> struct GreaterOrEqualsOp
 };
 
 
+/// The comparison loops are compiled both for the build target and for AVX2 (see TargetSpecific.h).
+DECLARE_MULTITARGET_CODE(
+
 template <typename A, typename B, typename Op>
-struct NumComparisonImpl
+struct NumComparisonImplLoops
 {
     /// If you don't specify NO_INLINE, the compiler will inline this function, but we don't need this as this function contains tight loop inside.
     static void NO_INLINE vector_vector(const PaddedPODArray<A> & a, const PaddedPODArray<B> & b, PaddedPODArray<UInt8> & c)
@@ -116,13 +124,8 @@ struct NumComparisonImpl
         }
     }
 
-    static void NO_INLINE vector_constant(const PaddedPODArray<A> & a, B b, PaddedPODArray<UInt8> & c)
+    static void NO_INLINE vector_constant(const A * a_pos, const A * a_end, B b, UInt8 * c_pos)
     {
-        size_t size = a.size();
-        const A * a_pos = &a[0];
-        UInt8 * c_pos = &c[0];
-        const A * a_end = a_pos + size;
-
         while (a_pos < a_end)
         {
             *c_pos = Op::apply(*a_pos, b);
@@ -130,6 +133,56 @@ struct NumComparisonImpl
             ++c_pos;
         }
     }
+};
+
+) /// DECLARE_MULTITARGET_CODE
+
+template <typename A, typename B, typename Op>
+struct NumComparisonImpl
+{
+    static void vector_vector(const PaddedPODArray<A> & a, const PaddedPODArray<B> & b, PaddedPODArray<UInt8> & c)
+    {
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::NumComparisonImplLoops<A, B, Op>::vector_vector(a, b, c);
+        else
+            TargetSpecific::Default::NumComparisonImplLoops<A, B, Op>::vector_vector(a, b, c);
+    }
+
+    static void vector_constant(const PaddedPODArray<A> & a, B b, PaddedPODArray<UInt8> & c)
+    {
+        /** After reading in the order of the primary key, the leading key columns arrive
+          *  as long runs of equal values (e.g. WHERE date = today() over date-ordered data).
+          * For such data the answer is computed once per run and the mask is filled with
+          *  memset, so the comparison costs O(runs) instead of O(rows). The first short
+          *  run means the data is not run-ordered, and the rest is processed by the usual
+          *  element-wise loop; for data without runs the probe costs a single vector
+          *  comparison.
+          */
+        static constexpr size_t min_run_length = 64;
+
+        const A * a_pos = &a[0];
+        const A * a_end = a_pos + a.size();
+        UInt8 * c_pos = &c[0];
+
+        while (a_pos < a_end)
+        {
+            const A * run_end = findRunEnd(a_pos, a_end);
+            if (static_cast<size_t>(run_end - a_pos) < min_run_length)
+                break;
+
+            memset(c_pos, Op::apply(*a_pos, b), run_end - a_pos);
+            c_pos += run_end - a_pos;
+            a_pos = run_end;
+        }
+
+        if (a_pos == a_end)
+            return;
+
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::NumComparisonImplLoops<A, B, Op>::vector_constant(a_pos, a_end, b, c_pos);
+        else
+            TargetSpecific::Default::NumComparisonImplLoops<A, B, Op>::vector_constant(a_pos, a_end, b, c_pos);
+    }
 
     static void constant_vector(A a, const PaddedPODArray<B> & b, PaddedPODArray<UInt8> & c)
     {
@@ -577,6 +630,9 @@ public:
     static constexpr auto name = Name::name;
     static FunctionPtr create(const Context & context) { return std::make_shared<FunctionComparison>(); };
 
+    /// Dictionary-encoded columns are handled in their encoded form (see executeDictionary).
+    bool useDefaultImplementationForDictionaryColumns() const override { return false; }
+
 private:
     template <typename T0, typename T1>
     bool executeNumRightType(Block & block, size_t result, const ColumnVector<T0> * col_left, const IColumn * col_right_untyped)
@@ -974,6 +1030,82 @@ private:
         block.getByPosition(result).column = tmp_block.getByPosition(tmp_block.columns() - 1).column;
     }
 
+    static DataTypePtr removeDictionaryType(const DataTypePtr & type)
+    {
+        if (const DataTypeDictionary * dict_type = checkAndGetDataType<DataTypeDictionary>(type.get()))
+            return dict_type->getNestedType();
+        return type;
+    }
+
+    /// Comparison with a dictionary-encoded column.
+    /// If the other side is constant, the operation is evaluated once per distinct dictionary value,
+    ///  and the result is expanded by indices; otherwise the column is decoded and compared as usual.
+    bool executeDictionary(Block & block, const ColumnNumbers & arguments, size_t result)
+    {
+        const auto & left = block.getByPosition(arguments[0]);
+        const auto & right = block.getByPosition(arguments[1]);
+
+        const ColumnDictionary * left_dict = typeid_cast<const ColumnDictionary *>(left.column.get());
+        const ColumnDictionary * right_dict = typeid_cast<const ColumnDictionary *>(right.column.get());
+
+        if (!left_dict && !right_dict)
+            return false;
+
+        const auto & result_type = block.getByPosition(result).type;
+
+        const ColumnDictionary * dict_col = left_dict ? left_dict : right_dict;
+        const auto & other = left_dict ? right : left;
+
+        if (!left_dict != !right_dict && other.column->isConst())
+        {
+            /// Compare the dictionary itself with the constant.
+            size_t dictionary_size = dict_col->getDictionary()->size();
+
+            Block dict_block
+            {
+                left_dict
+                    ? ColumnWithTypeAndName(left_dict->getDictionary(), removeDictionaryType(left.type), left.name)
+                    : ColumnWithTypeAndName(left.column->cloneResized(dictionary_size), left.type, left.name),
+                right_dict
+                    ? ColumnWithTypeAndName(right_dict->getDictionary(), removeDictionaryType(right.type), right.name)
+                    : ColumnWithTypeAndName(right.column->cloneResized(dictionary_size), right.type, right.name),
+                ColumnWithTypeAndName(nullptr, result_type, "")
+            };
+
+            executeImpl(dict_block, {0, 1}, 2);
+
+            const ColumnUInt8 * dict_res = checkAndGetColumn<ColumnUInt8>(dict_block.getByPosition(2).column.get());
+            if (!dict_res)
+                throw Exception("Unexpected result column while comparing dictionary column in function " + getName(),
+                    ErrorCodes::ILLEGAL_COLUMN);
+
+            const auto & indexes = dict_col->getIndexes();
+            size_t rows = indexes.size();
+
+            auto col_res = std::make_shared<ColumnUInt8>(rows);
+            ColumnUInt8::Container_t & vec_res = col_res->getData();
+            const ColumnUInt8::Container_t & dict_res_data = dict_res->getData();
+
+            for (size_t i = 0; i < rows; ++i)
+                vec_res[i] = dict_res_data[indexes[i]];
+
+            block.getByPosition(result).column = col_res;
+            return true;
+        }
+
+        /// Generic case - decode and compare as the nested type.
+        Block full_block
+        {
+            ColumnWithTypeAndName(left_dict ? left_dict->convertToFullColumn() : left.column, removeDictionaryType(left.type), left.name),
+            ColumnWithTypeAndName(right_dict ? right_dict->convertToFullColumn() : right.column, removeDictionaryType(right.type), right.name),
+            ColumnWithTypeAndName(nullptr, result_type, "")
+        };
+
+        executeImpl(full_block, {0, 1}, 2);
+        block.getByPosition(result).column = full_block.getByPosition(2).column;
+        return true;
+    }
+
     void executeGeneric(Block & block, size_t result, const IColumn * c0, const IColumn * c1)
     {
         bool c0_const = c0->isConst();
@@ -1012,6 +1144,11 @@ public:
     /// Get result types by argument types. If the function does not apply to these arguments, throw an exception.
     DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
     {
+        /// Dictionary(T) is compared as its nested type.
+        if (checkAndGetDataType<DataTypeDictionary>(arguments[0].get())
+            || checkAndGetDataType<DataTypeDictionary>(arguments[1].get()))
+            return getReturnTypeImpl({ removeDictionaryType(arguments[0]), removeDictionaryType(arguments[1]) });
+
         bool left_is_date = false;
         bool left_is_date_time = false;
         bool left_is_uuid = false;
@@ -1085,6 +1222,9 @@ public:
 
     void executeImpl(Block & block, const ColumnNumbers & arguments, size_t result) override
     {
+        if (executeDictionary(block, arguments, result))
+            return;
+
         const auto & col_with_type_and_name_left = block.getByPosition(arguments[0]);
         const auto & col_with_type_and_name_right = block.getByPosition(arguments[1]);
         const IColumn * col_left_untyped = col_with_type_and_name_left.column.get();
@@ -19,6 +19,8 @@
 #include <DataTypes/DataTypeTuple.h>
 #include <DataTypes/DataTypeNullable.h>
 #include <DataTypes/DataTypeUUID.h>
+#include <DataTypes/DataTypeDictionary.h>
+#include <Columns/ColumnDictionary.h>
 #include <Columns/ColumnString.h>
 #include <Columns/ColumnFixedString.h>
 #include <Columns/ColumnConst.h>
@@ -1425,6 +1427,56 @@ private:
         };
     }
 
+    /// Decode a Dictionary(T) input to T, then convert as usual.
+    WrapperType createFromDictionaryWrapper(const DataTypeDictionary * from_type, const IDataType * to_type)
+    {
+        const DataTypePtr & nested_type = from_type->getNestedType();
+        WrapperType nested_wrapper = prepareImpl(nested_type, to_type);
+
+        return [nested_wrapper, nested_type] (Block & block, const ColumnNumbers & arguments, const size_t result)
+        {
+            Block tmp_block = block;
+            auto & elem = tmp_block.getByPosition(arguments.front());
+
+            if (const ColumnDictionary * dict_col = typeid_cast<const ColumnDictionary *>(elem.column.get()))
+                elem.column = dict_col->convertToFullColumn();
+            elem.type = nested_type;
+
+            nested_wrapper(tmp_block, arguments, result);
+            block.getByPosition(result).column = tmp_block.getByPosition(result).column;
+        };
+    }
+
+    /// Convert to the nested type, then dictionary-encode the result.
+    WrapperType createDictionaryWrapper(const DataTypePtr & from_type, const DataTypeDictionary * to_type)
+    {
+        WrapperType nested_wrapper = prepareImpl(from_type, to_type->getNestedType().get());
+        const DataTypePtr & nested_type = to_type->getNestedType();
+
+        return [nested_wrapper, nested_type] (Block & block, const ColumnNumbers & arguments, const size_t result)
+        {
+            Block tmp_block = block;
+            size_t tmp_res_index = tmp_block.columns();
+            tmp_block.insert({ nullptr, nested_type, "" });
+
+            nested_wrapper(tmp_block, arguments, tmp_res_index);
+
+            ColumnPtr full_column = tmp_block.getByPosition(tmp_res_index).column;
+            if (auto converted = full_column->convertToFullColumnIfConst())
+                full_column = converted;
+
+            ColumnPtr res_column = block.getByPosition(result).type->createColumn();
+            ColumnDictionary & res_dict = typeid_cast<ColumnDictionary &>(*res_column);
+
+            size_t rows = full_column->size();
+            res_dict.reserve(rows);
+            for (size_t i = 0; i < rows; ++i)
+                res_dict.insertFromFullColumn(*full_column, i);
+
+            block.getByPosition(result).column = res_column;
+        };
+    }
+
     /// Actions to be taken when performing a conversion.
     struct Action
     {
@@ -1515,6 +1567,10 @@ private:
     {
         if (from_type->equals(*to_type))
             return createIdentityWrapper(from_type);
+        else if (const auto from_dict_type = checkAndGetDataType<DataTypeDictionary>(from_type.get()))
+            return createFromDictionaryWrapper(from_dict_type, to_type);
+        else if (const auto to_dict_type = checkAndGetDataType<DataTypeDictionary>(to_type))
+            return createDictionaryWrapper(from_type, to_dict_type);
         else if (const auto to_actual_type = checkAndGetDataType<DataTypeUInt8>(to_type))
             return createWrapper(from_type, to_actual_type);
         else if (const auto to_actual_type = checkAndGetDataType<DataTypeUInt16>(to_type))
@@ -1612,6 +1668,7 @@ public:
     String getName() const override { return name; }
 
     bool useDefaultImplementationForNulls() const override { return false; }
+    bool useDefaultImplementationForDictionaryColumns() const override { return false; }
 
     size_t getNumberOfArguments() const override { return 2; }
 
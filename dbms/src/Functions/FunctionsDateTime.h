@@ -30,6 +30,7 @@ namespace DB
 namespace ErrorCodes
 {
     extern const int NUMBER_OF_ARGUMENTS_DOESNT_MATCH;
+    extern const int BAD_ARGUMENTS;
 }
 
 /** Functions for working with date and time.
@@ -641,6 +642,7 @@ public:
     }
 
     size_t getNumberOfArguments() const override { return 0; }
+    bool isDeterministic() override { return false; }
 
     DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
     {
@@ -668,6 +670,7 @@ public:
     }
 
     size_t getNumberOfArguments() const override { return 0; }
+    bool isDeterministic() override { return false; }
 
     DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
     {
@@ -695,6 +698,7 @@ public:
     }
 
     size_t getNumberOfArguments() const override { return 0; }
+    bool isDeterministic() override { return false; }
 
     DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
     {
@@ -906,6 +910,228 @@ public:
 };
 
 
+/** formatDateTime(t, 'pattern') - formats Date or DateTime according to the MySQL-style pattern.
+  *
+  * Every supported substitution produces a fixed number of characters, so the pattern is compiled
+  *  once per block into a template string and a list of (writer, position) instructions.
+  * For every row the template is copied into the result buffer and only the time-dependent
+  *  fragments are overwritten, writing digits pairwise from the DateLUT values.
+  */
+class FunctionFormatDateTime : public IFunction
+{
+private:
+    struct Instruction
+    {
+        void (* func)(char *, time_t, const DateLUTImpl &);
+        size_t shift;
+    };
+
+    static void writeNumber2(char * p, UInt8 v)
+    {
+        p[0] = '0' + v / 10;
+        p[1] = '0' + v % 10;
+    }
+
+    static void writeNumber3(char * p, UInt16 v)
+    {
+        p[0] = '0' + v / 100;
+        p[1] = '0' + (v / 10) % 10;
+        p[2] = '0' + v % 10;
+    }
+
+    static void writeNumber4(char * p, UInt16 v)
+    {
+        p[0] = '0' + v / 1000;
+        p[1] = '0' + (v / 100) % 10;
+        p[2] = '0' + (v / 10) % 10;
+        p[3] = '0' + v % 10;
+    }
+
+    static void century(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toYear(t) / 100); }
+    static void year2(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toYear(t) % 100); }
+    static void year4(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber4(p, date_lut.toYear(t)); }
+    static void month(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toMonth(t)); }
+    static void dayOfMonth(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toDayOfMonth(t)); }
+
+    static void dayOfMonthSpacePadded(char * p, time_t t, const DateLUTImpl & date_lut)
+    {
+        UInt8 day = date_lut.toDayOfMonth(t);
+        p[0] = day < 10 ? ' ' : '0' + day / 10;
+        p[1] = '0' + day % 10;
+    }
+
+    static void dayOfYear(char * p, time_t t, const DateLUTImpl & date_lut)
+    {
+        DayNum_t day_num = date_lut.toDayNum(t);
+        writeNumber3(p, day_num - date_lut.toFirstDayNumOfYear(day_num) + 1);
+    }
+
+    static void dayOfWeekFrom1(char * p, time_t t, const DateLUTImpl & date_lut) { p[0] = '0' + date_lut.toDayOfWeek(t); }
+    static void dayOfWeekFrom0(char * p, time_t t, const DateLUTImpl & date_lut) { p[0] = '0' + date_lut.toDayOfWeek(t) % 7; }
+    static void hour24(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toHour(t)); }
+
+    static void hour12(char * p, time_t t, const DateLUTImpl & date_lut)
+    {
+        UInt8 hour = date_lut.toHour(t) % 12;
+        writeNumber2(p, hour == 0 ? 12 : hour);
+    }
+
+    static void minute(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toMinuteInaccurate(t)); }
+    static void second(char * p, time_t t, const DateLUTImpl & date_lut) { writeNumber2(p, date_lut.toSecondInaccurate(t)); }
+
+    /// The template already holds 'M' in the second position.
+    static void AMPM(char * p, time_t t, const DateLUTImpl & date_lut) { p[0] = date_lut.toHour(t) < 12 ? 'A' : 'P'; }
+
+    /// Returns the template string; fragments to be overwritten are collected in `instructions`.
+    static String compilePattern(const String & pattern, std::vector<Instruction> & instructions)
+    {
+        String res;
+
+        auto add = [&](void (* func)(char *, time_t, const DateLUTImpl &), const char * filler)
+        {
+            instructions.push_back({func, res.size()});
+            res += filler;
+        };
+
+        for (size_t i = 0; i < pattern.size(); ++i)
+        {
+            if (pattern[i] != '%')
+            {
+                res += pattern[i];
+                continue;
+            }
+
+            if (++i == pattern.size())
+                throw Exception("Sign '%' is the last symbol in the pattern of function formatDateTime",
+                    ErrorCodes::BAD_ARGUMENTS);
+
+            switch (pattern[i])
+            {
+                case 'C': add(&century, "00"); break;
+                case 'd': add(&dayOfMonth, "00"); break;
+                case 'D': add(&month, "00"); res += '/'; add(&dayOfMonth, "00"); res += '/'; add(&year2, "00"); break;
+                case 'e': add(&dayOfMonthSpacePadded, " 0"); break;
+                case 'F': add(&year4, "0000"); res += '-'; add(&month, "00"); res += '-'; add(&dayOfMonth, "00"); break;
+                case 'H': add(&hour24, "00"); break;
+                case 'I': add(&hour12, "12"); break;
+                case 'j': add(&dayOfYear, "000"); break;
+                case 'm': add(&month, "00"); break;
+                case 'M': add(&minute, "00"); break;
+                case 'n': res += '\n'; break;
+                case 'p': add(&AMPM, "AM"); break;
+                case 'R': add(&hour24, "00"); res += ':'; add(&minute, "00"); break;
+                case 'S': add(&second, "00"); break;
+                case 't': res += '\t'; break;
+                case 'T': add(&hour24, "00"); res += ':'; add(&minute, "00"); res += ':'; add(&second, "00"); break;
+                case 'u': add(&dayOfWeekFrom1, "0"); break;
+                case 'w': add(&dayOfWeekFrom0, "0"); break;
+                case 'y': add(&year2, "00"); break;
+                case 'Y': add(&year4, "0000"); break;
+                case '%': res += '%'; break;
+                default:
+                    throw Exception("Wrong pattern '" + pattern + "' of function formatDateTime: unexpected symbol '"
+                        + pattern[i] + "' after '%'", ErrorCodes::BAD_ARGUMENTS);
+            }
+        }
+
+        return res;
+    }
+
+public:
+    static constexpr auto name = "formatDateTime";
+    static FunctionPtr create(const Context & context) { return std::make_shared<FunctionFormatDateTime>(); };
+
+    String getName() const override
+    {
+        return name;
+    }
+
+    size_t getNumberOfArguments() const override { return 2; }
+
+    bool useDefaultImplementationForConstants() const override { return true; }
+    ColumnNumbers getArgumentsThatAreAlwaysConstant() const override { return {1}; }
+
+    DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
+    {
+        if (!checkDataType<DataTypeDate>(arguments[0].get()) && !checkDataType<DataTypeDateTime>(arguments[0].get()))
+            throw Exception("Illegal type " + arguments[0]->getName() + " of first argument of function " + getName()
+                + ". Must be Date or DateTime.", ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+
+        if (!checkDataType<DataTypeString>(arguments[1].get()))
+            throw Exception("Illegal type " + arguments[1]->getName() + " of second argument of function " + getName()
+                + ". Must be String.", ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+
+        return std::make_shared<DataTypeString>();
+    }
+
+    void executeImpl(Block & block, const ColumnNumbers & arguments, size_t result) override
+    {
+        const auto * pattern_column = checkAndGetColumnConst<ColumnString>(block.getByPosition(arguments[1]).column.get());
+        if (!pattern_column)
+            throw Exception("Illegal column " + block.getByPosition(arguments[1]).column->getName()
+                    + " of second argument of function " + getName() + ". Must be constant string.",
+                ErrorCodes::ILLEGAL_COLUMN);
+
+        std::vector<Instruction> instructions;
+        String pattern_template = compilePattern(pattern_column->getValue<String>(), instructions);
+
+        if (!executeType<DataTypeDateTime::FieldType>(block, arguments, result, pattern_template, instructions)
+            && !executeType<DataTypeDate::FieldType>(block, arguments, result, pattern_template, instructions))
+            throw Exception("Illegal column " + block.getByPosition(arguments[0]).column->getName()
+                    + " of first argument of function " + getName(),
+                ErrorCodes::ILLEGAL_COLUMN);
+    }
+
+private:
+    template <typename FromType>
+    bool executeType(Block & block, const ColumnNumbers & arguments, size_t result,
+        const String & pattern_template, const std::vector<Instruction> & instructions)
+    {
+        const auto * times = checkAndGetColumn<ColumnVector<FromType>>(block.getByPosition(arguments[0]).column.get());
+        if (!times)
+            return false;
+
+        const typename ColumnVector<FromType>::Container_t & vec = times->getData();
+        size_t size = vec.size();
+
+        auto col_res = std::make_shared<ColumnString>();
+        ColumnString::Chars_t & data_to = col_res->getChars();
+        ColumnString::Offsets_t & offsets_to = col_res->getOffsets();
+
+        /// All rows have the same length: the length of the template plus the terminating zero.
+        data_to.resize(size * (pattern_template.size() + 1));
+        offsets_to.resize(size);
+
+        const DateLUTImpl & date_lut = DateLUT::instance();
+
+        char * begin = reinterpret_cast<char *>(&data_to[0]);
+        char * pos = begin;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            memcpy(pos, pattern_template.data(), pattern_template.size());
+
+            /// A Date is formatted as the beginning of its day.
+            time_t t = std::is_same<FromType, DataTypeDate::FieldType>::value
+                ? date_lut.fromDayNum(DayNum_t(vec[i]))
+                : time_t(vec[i]);
+
+            for (const auto & instruction : instructions)
+                instruction.func(pos + instruction.shift, t, date_lut);
+
+            pos += pattern_template.size();
+            *pos = '\0';
+            ++pos;
+
+            offsets_to[i] = pos - begin;
+        }
+
+        block.getByPosition(result).column = col_res;
+        return true;
+    }
+};
+
+
 struct NameToYear              { static constexpr auto name = "toYear"; };
 struct NameToMonth             { static constexpr auto name = "toMonth"; };
 struct NameToDayOfMonth        { static constexpr auto name = "toDayOfMonth"; };
@@ -97,6 +97,9 @@ using UInt8Container = ColumnUInt8::Container_t;
 using UInt8ColumnPtrs = std::vector<const ColumnUInt8 *>;
 
 
+/// The combining loop is compiled both for the build target and for AVX2 (see TargetSpecific.h).
+DECLARE_MULTITARGET_CODE(
+
 template <typename Op, size_t N>
 struct AssociativeOperationImpl
 {
@@ -160,6 +163,8 @@ struct AssociativeOperationImpl<Op, 1>
     }
 };
 
+) /// DECLARE_MULTITARGET_CODE
+
 
 template <template <typename> class Impl, typename Name>
 class FunctionAnyArityLogical : public IFunction
@@ -350,7 +355,10 @@ public:
         {
             /// With a large block size, combining 6 columns per pass is the fastest.
             /// When small - more, is faster.
-            AssociativeOperationImpl<Impl<UInt8>, 10>::execute(uint8_in, vec_res);
+            if (isArchSupported(TargetArch::AVX2))
+                TargetSpecific::AVX2::AssociativeOperationImpl<Impl<UInt8>, 10>::execute(uint8_in, vec_res);
+            else
+                TargetSpecific::Default::AssociativeOperationImpl<Impl<UInt8>, 10>::execute(uint8_in, vec_res);
             uint8_in.push_back(col_res.get());
         }
 
@@ -1294,6 +1294,11 @@ public:
         return 0;
     }
 
+    bool isDeterministic() override
+    {
+        return false;
+    }
+
     DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
     {
         return std::make_shared<DataTypeUInt32>();
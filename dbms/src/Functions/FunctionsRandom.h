@@ -185,6 +185,7 @@ public:
 
     bool isVariadic() const override { return true; }
     size_t getNumberOfArguments() const override { return 0; }
+    bool isDeterministic() override { return false; }
 
     DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
     {
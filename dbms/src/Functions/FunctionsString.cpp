@@ -130,6 +130,111 @@ struct LengthUTF8Impl
 };
 
 
+/** Whether the string is valid UTF-8.
+  * Pure-ASCII 16-byte chunks are detected with the same classification as in LowerUpperUTF8Impl::array
+  *  and skipped wholesale; only chunks containing multi-byte sequences are decoded byte by byte.
+  */
+struct IsValidUTF8Impl
+{
+    static UInt8 isValid(const UInt8 * src, size_t size)
+    {
+        const UInt8 * src_end = src + size;
+
+#if __SSE2__
+        const auto bytes_sse = sizeof(__m128i);
+
+        /// SSE2 packed comparison operate on signed types, hence compare (c < 0) instead of (c > 0x7f)
+        const auto v_zero = _mm_setzero_si128();
+#endif
+
+        while (src < src_end)
+        {
+#if __SSE2__
+            /// Skip whole chunks of ASCII at once.
+            while (src + bytes_sse <= src_end
+                && 0 == _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)), v_zero)))
+                src += bytes_sse;
+
+            if (src == src_end)
+                break;
+#endif
+            const UInt8 c = *src++;
+
+            if (c < 0x80)
+                continue;
+
+            size_t continuation_bytes;
+            UInt8 first_continuation_min = 0x80;
+            UInt8 first_continuation_max = 0xBF;
+
+            if (c >= 0xC2 && c <= 0xDF)
+                continuation_bytes = 1;
+            else if (c >= 0xE0 && c <= 0xEF)
+            {
+                continuation_bytes = 2;
+                if (c == 0xE0)
+                    first_continuation_min = 0xA0;    /// overlong sequence
+                else if (c == 0xED)
+                    first_continuation_max = 0x9F;    /// UTF-16 surrogate half
+            }
+            else if (c >= 0xF0 && c <= 0xF4)
+            {
+                continuation_bytes = 3;
+                if (c == 0xF0)
+                    first_continuation_min = 0x90;    /// overlong sequence
+                else if (c == 0xF4)
+                    first_continuation_max = 0x8F;    /// code point above U+10FFFF
+            }
+            else
+                return 0;    /// misplaced continuation byte, overlong two-byte sequence or invalid leading byte
+
+            if (src + continuation_bytes > src_end)
+                return 0;    /// unexpected end of string
+
+            /// The constrained range applies only to the first continuation byte.
+            if (*src < first_continuation_min || *src > first_continuation_max)
+                return 0;
+            ++src;
+
+            for (size_t i = 1; i < continuation_bytes; ++i, ++src)
+                if (*src < 0x80 || *src > 0xBF)
+                    return 0;
+        }
+
+        return 1;
+    }
+
+    static void vector(const ColumnString::Chars_t & data, const ColumnString::Offsets_t & offsets, PaddedPODArray<UInt8> & res)
+    {
+        size_t size = offsets.size();
+
+        ColumnString::Offset_t prev_offset = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            res[i] = isValid(&data[prev_offset], offsets[i] - prev_offset - 1);
+            prev_offset = offsets[i];
+        }
+    }
+
+    static void vector_fixed_to_constant(const ColumnString::Chars_t & data, size_t n, UInt8 & res)
+    {
+    }
+
+    static void vector_fixed_to_vector(const ColumnString::Chars_t & data, size_t n, PaddedPODArray<UInt8> & res)
+    {
+        size_t size = data.size() / n;
+
+        for (size_t i = 0; i < size; ++i)
+            res[i] = isValid(&data[i * n], n);
+    }
+
+    static void array(const ColumnString::Offsets_t & offsets, PaddedPODArray<UInt8> & res)
+    {
+        throw Exception("Cannot apply function isValidUTF8 to Array argument", ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+    }
+};
+
+
 template <char not_case_lower_bound, char not_case_upper_bound>
 struct LowerUpperImpl
 {
@@ -550,8 +655,8 @@ public:
         }
         else if (const ColumnFixedString * col = checkAndGetColumn<ColumnFixedString>(column.get()))
         {
-            /// For a fixed string only `lengthUTF8` function returns not a constant.
-            if ("lengthUTF8" != getName())
+            /// For a fixed string, only the `lengthUTF8` and `isValidUTF8` functions return not a constant.
+            if ("lengthUTF8" != getName() && "isValidUTF8" != getName())
             {
                 ResultType res = 0;
                 Impl::vector_fixed_to_constant(col->getChars(), col->getN(), res);
@@ -1084,6 +1189,10 @@ struct NameLengthUTF8
 {
     static constexpr auto name = "lengthUTF8";
 };
+struct NameIsValidUTF8
+{
+    static constexpr auto name = "isValidUTF8";
+};
 struct NameLower
 {
     static constexpr auto name = "lower";
@@ -1109,6 +1218,7 @@ using FunctionEmpty = FunctionStringOrArrayToT<EmptyImpl<false>, NameEmpty, UInt
 using FunctionNotEmpty = FunctionStringOrArrayToT<EmptyImpl<true>, NameNotEmpty, UInt8>;
 using FunctionLength = FunctionStringOrArrayToT<LengthImpl, NameLength, UInt64>;
 using FunctionLengthUTF8 = FunctionStringOrArrayToT<LengthUTF8Impl, NameLengthUTF8, UInt64>;
+using FunctionIsValidUTF8 = FunctionStringOrArrayToT<IsValidUTF8Impl, NameIsValidUTF8, UInt8>;
 using FunctionLower = FunctionStringToString<LowerUpperImpl<'A', 'Z'>, NameLower>;
 using FunctionUpper = FunctionStringToString<LowerUpperImpl<'a', 'z'>, NameUpper>;
 using FunctionReverseUTF8 = FunctionStringToString<ReverseUTF8Impl, NameReverseUTF8, true>;
@@ -1122,6 +1232,7 @@ void registerFunctionsString(FunctionFactory & factory)
     factory.registerFunction<FunctionNotEmpty>();
     factory.registerFunction<FunctionLength>();
     factory.registerFunction<FunctionLengthUTF8>();
+    factory.registerFunction<FunctionIsValidUTF8>();
     factory.registerFunction<FunctionLower>();
     factory.registerFunction<FunctionUpper>();
     factory.registerFunction<FunctionLowerUTF8>();
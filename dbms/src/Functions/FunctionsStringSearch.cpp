@@ -11,10 +11,12 @@
 #include <IO/WriteHelpers.h>
 #include <Common/config.h>
 #include <re2/re2.h>
+#include <re2/set.h>
 #include <re2/stringpiece.h>
 
 #if USE_RE2_ST
     #include <re2_st/re2.h>
+    #include <re2_st/set.h>
 #else
     #define re2_st re2
 #endif
@@ -297,6 +299,52 @@ struct PositionImpl
 };
 
 
+/// Is at least one of the needles a substring of the haystack?
+template <typename MultiSearcher>
+struct MultiSearchAnyImpl
+{
+    using ResultType = UInt8;
+
+    static void vector_constant(const ColumnString::Chars_t & data,
+        const ColumnString::Offsets_t & offsets,
+        const std::vector<StringRef> & needles,
+        PaddedPODArray<UInt8> & res)
+    {
+        /// The hash table over the bigrams of all needles is filled once per block.
+        MultiSearcher searcher(needles);
+
+        size_t prev_offset = 0;
+        for (size_t i = 0; i < offsets.size(); ++i)
+        {
+            res[i] = searcher.searchAny(&data[prev_offset], offsets[i] - prev_offset - 1);
+            prev_offset = offsets[i];
+        }
+    }
+};
+
+/// The index (starting from 1) of the needle with the leftmost occurrence, or 0 if none of them occurs.
+template <typename MultiSearcher>
+struct MultiSearchFirstIndexImpl
+{
+    using ResultType = UInt64;
+
+    static void vector_constant(const ColumnString::Chars_t & data,
+        const ColumnString::Offsets_t & offsets,
+        const std::vector<StringRef> & needles,
+        PaddedPODArray<UInt64> & res)
+    {
+        MultiSearcher searcher(needles);
+
+        size_t prev_offset = 0;
+        for (size_t i = 0; i < offsets.size(); ++i)
+        {
+            res[i] = searcher.searchFirstIndex(&data[prev_offset], offsets[i] - prev_offset - 1);
+            prev_offset = offsets[i];
+        }
+    }
+};
+
+
 /// Is the LIKE expression reduced to finding a substring in a string?
 inline bool likePatternIsStrstr(const String & pattern, String & res)
 {
@@ -516,6 +564,115 @@ struct MatchImpl
 };
 
 
+/** Does at least one of the re2 regexps match the haystack?
+  * All the patterns are compiled into a single regexp set, so the haystack is scanned once however many there are.
+  * The required substrings of the patterns (see OptimizedRegularExpression) are checked
+  *  with the multi-needle searcher first, so most rows never enter the regex engine.
+  */
+struct MultiMatchAnyImpl
+{
+    using ResultType = UInt8;
+
+    static void vector_constant(const ColumnString::Chars_t & data,
+        const ColumnString::Offsets_t & offsets,
+        const std::vector<StringRef> & patterns,
+        PaddedPODArray<UInt8> & res)
+    {
+        size_t size = offsets.size();
+
+        if (patterns.empty())
+        {
+            memset(&res[0], 0, size * sizeof(res[0]));
+            return;
+        }
+
+        /** The pre-filter can be used only if every pattern has a non-empty required substring
+          *  (a string matching the pattern is guaranteed to contain it).
+          */
+        std::vector<String> required_substrings;
+        required_substrings.reserve(patterns.size());
+        bool can_prefilter = true;
+        bool all_trivial = true;
+
+        for (const auto & pattern : patterns)
+        {
+            const auto & regexp = Regexps::get<false, true>(pattern.toString());
+
+            std::string required_substring;
+            bool is_trivial;
+            bool required_substring_is_prefix;
+            regexp->getAnalyzeResult(required_substring, is_trivial, required_substring_is_prefix);
+
+            if (required_substring.empty())
+            {
+                can_prefilter = false;
+                break;
+            }
+
+            all_trivial = all_trivial && is_trivial;
+            required_substrings.push_back(std::move(required_substring));
+        }
+
+        std::vector<StringRef> needles;
+        if (can_prefilter)
+        {
+            needles.reserve(required_substrings.size());
+            for (const auto & required_substring : required_substrings)
+                needles.emplace_back(required_substring);
+        }
+
+        if (can_prefilter && all_trivial)
+        {
+            /// All the patterns are plain substrings - the searcher alone gives the answer.
+            MultiVolnitsky searcher(needles);
+
+            size_t prev_offset = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                res[i] = searcher.searchAny(&data[prev_offset], offsets[i] - prev_offset - 1);
+                prev_offset = offsets[i];
+            }
+
+            return;
+        }
+
+        re2_st::RE2::Options options;
+        options.set_log_errors(false);
+        re2_st::RE2::Set regexps(options, re2_st::RE2::UNANCHORED);
+
+        for (const auto & pattern : patterns)
+        {
+            std::string error;
+            if (regexps.Add(re2_st::StringPiece(pattern.data, pattern.size), &error) < 0)
+                throw Exception("Error in regexp '" + pattern.toString() + "': " + error, ErrorCodes::BAD_ARGUMENTS);
+        }
+
+        if (!regexps.Compile())
+            throw Exception("Cannot compile regexp set of function multiMatchAny", ErrorCodes::BAD_ARGUMENTS);
+
+        std::unique_ptr<MultiVolnitsky> prefilter;
+        if (can_prefilter)
+            prefilter = std::make_unique<MultiVolnitsky>(needles);
+
+        std::vector<int> matches;
+
+        size_t prev_offset = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const char * str_data = reinterpret_cast<const char *>(&data[prev_offset]);
+            size_t str_size = offsets[i] - prev_offset - 1;
+
+            if (prefilter && !prefilter->searchAny(str_data, str_size))
+                res[i] = 0;
+            else
+                res[i] = regexps.Match(re2_st::StringPiece(str_data, str_size), &matches);
+
+            prev_offset = offsets[i];
+        }
+    }
+};
+
+
 struct ExtractImpl
 {
     static void vector(const ColumnString::Chars_t & data,
@@ -1035,6 +1192,26 @@ struct NamePositionCaseInsensitiveUTF8
 {
     static constexpr auto name = "positionCaseInsensitiveUTF8";
 };
+struct NameMultiSearchAny
+{
+    static constexpr auto name = "multiSearchAny";
+};
+struct NameMultiSearchAnyCaseInsensitive
+{
+    static constexpr auto name = "multiSearchAnyCaseInsensitive";
+};
+struct NameMultiSearchFirstIndex
+{
+    static constexpr auto name = "multiSearchFirstIndex";
+};
+struct NameMultiSearchFirstIndexCaseInsensitive
+{
+    static constexpr auto name = "multiSearchFirstIndexCaseInsensitive";
+};
+struct NameMultiMatchAny
+{
+    static constexpr auto name = "multiMatchAny";
+};
 struct NameMatch
 {
     static constexpr auto name = "match";
@@ -1074,6 +1251,15 @@ using FunctionPositionCaseInsensitive = FunctionsStringSearch<PositionImpl<Posit
 using FunctionPositionCaseInsensitiveUTF8
     = FunctionsStringSearch<PositionImpl<PositionCaseInsensitiveUTF8>, NamePositionCaseInsensitiveUTF8>;
 
+using FunctionMultiSearchAny = FunctionsMultiStringSearch<MultiSearchAnyImpl<MultiVolnitsky>, NameMultiSearchAny>;
+using FunctionMultiSearchAnyCaseInsensitive
+    = FunctionsMultiStringSearch<MultiSearchAnyImpl<MultiVolnitskyCaseInsensitive>, NameMultiSearchAnyCaseInsensitive>;
+using FunctionMultiSearchFirstIndex = FunctionsMultiStringSearch<MultiSearchFirstIndexImpl<MultiVolnitsky>, NameMultiSearchFirstIndex>;
+using FunctionMultiSearchFirstIndexCaseInsensitive
+    = FunctionsMultiStringSearch<MultiSearchFirstIndexImpl<MultiVolnitskyCaseInsensitive>, NameMultiSearchFirstIndexCaseInsensitive>;
+
+using FunctionMultiMatchAny = FunctionsMultiStringSearch<MultiMatchAnyImpl, NameMultiMatchAny>;
+
 using FunctionMatch = FunctionsStringSearch<MatchImpl<false>, NameMatch>;
 using FunctionLike = FunctionsStringSearch<MatchImpl<true>, NameLike>;
 using FunctionNotLike = FunctionsStringSearch<MatchImpl<true, true>, NameNotLike>;
@@ -1094,6 +1280,11 @@ void registerFunctionsStringSearch(FunctionFactory & factory)
     factory.registerFunction<FunctionPositionUTF8>();
     factory.registerFunction<FunctionPositionCaseInsensitive>();
     factory.registerFunction<FunctionPositionCaseInsensitiveUTF8>();
+    factory.registerFunction<FunctionMultiSearchAny>();
+    factory.registerFunction<FunctionMultiSearchAnyCaseInsensitive>();
+    factory.registerFunction<FunctionMultiSearchFirstIndex>();
+    factory.registerFunction<FunctionMultiSearchFirstIndexCaseInsensitive>();
+    factory.registerFunction<FunctionMultiMatchAny>();
     factory.registerFunction<FunctionMatch>();
     factory.registerFunction<FunctionLike>();
     factory.registerFunction<FunctionNotLike>();
@@ -2,10 +2,13 @@
 
 #include <Columns/ColumnConst.h>
 #include <Columns/ColumnString.h>
+#include <DataTypes/DataTypeArray.h>
 #include <DataTypes/DataTypeString.h>
 #include <Functions/FunctionsArithmetic.h>
 #include <Functions/IFunction.h>
 #include <Functions/FunctionHelpers.h>
+#include <common/StringRef.h>
+#include <vector>
 
 
 namespace DB
@@ -18,11 +21,22 @@ namespace DB
   * positionCaseInsensitive(haystack, needle)
   * positionCaseInsensitiveUTF8(haystack, needle)
   *
+  * multiSearchAny(haystack, [needle_1, needle_2, ...]) - whether at least one of the needles is a substring of haystack;
+  *  the haystack is scanned only once regardless of the number of needles.
+  * multiSearchAnyCaseInsensitive(haystack, [needle_1, needle_2, ...])
+  *
+  * multiSearchFirstIndex(haystack, [needle_1, needle_2, ...]) - the index (starting from 1) of the needle
+  *  with the leftmost occurrence in haystack, or 0 if none of them occurs.
+  * multiSearchFirstIndexCaseInsensitive(haystack, [needle_1, needle_2, ...])
+  *
   * like(haystack, pattern)        - search by the regular expression LIKE; Returns 0 or 1. Case-insensitive, but only for Latin.
   * notLike(haystack, pattern)
   *
   * match(haystack, pattern)       - search by regular expression re2; Returns 0 or 1.
   *
+  * multiMatchAny(haystack, [pattern_1, pattern_2, ...]) - whether at least one of the re2 regexps matches;
+  *  all the patterns are compiled into a single regexp set and the haystack is scanned once.
+  *
   * Applies regexp re2 and pulls:
   * - the first subpattern, if the regexp has a subpattern;
   * - the zero subpattern (the match part, otherwise);
@@ -119,6 +133,81 @@ public:
 };
 
 
+/// Functions of the form multiSearch*(haystack, [needle_1, needle_2, ...]). The array of needles must be constant.
+template <typename Impl, typename Name>
+class FunctionsMultiStringSearch : public IFunction
+{
+public:
+    static constexpr auto name = Name::name;
+    static FunctionPtr create(const Context & context)
+    {
+        return std::make_shared<FunctionsMultiStringSearch>();
+    }
+
+    String getName() const override
+    {
+        return name;
+    }
+
+    size_t getNumberOfArguments() const override
+    {
+        return 2;
+    }
+
+    bool useDefaultImplementationForConstants() const override { return true; }
+    ColumnNumbers getArgumentsThatAreAlwaysConstant() const override { return {1}; }
+
+    DataTypePtr getReturnTypeImpl(const DataTypes & arguments) const override
+    {
+        if (!checkDataType<DataTypeString>(&*arguments[0]))
+            throw Exception(
+                "Illegal type " + arguments[0]->getName() + " of argument of function " + getName(), ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+
+        const DataTypeArray * array_type = checkAndGetDataType<DataTypeArray>(&*arguments[1]);
+        if (!array_type || !checkDataType<DataTypeString>(array_type->getNestedType().get()))
+            throw Exception(
+                "Illegal type " + arguments[1]->getName() + " of argument of function " + getName() + ", expected Array(String)",
+                ErrorCodes::ILLEGAL_TYPE_OF_ARGUMENT);
+
+        return std::make_shared<DataTypeNumber<typename Impl::ResultType>>();
+    }
+
+    void executeImpl(Block & block, const ColumnNumbers & arguments, size_t result) override
+    {
+        using ResultType = typename Impl::ResultType;
+
+        const ColumnPtr & column_haystack = block.getByPosition(arguments[0]).column;
+        const ColumnPtr & column_needles = block.getByPosition(arguments[1]).column;
+
+        const ColumnConst * col_needles_const = typeid_cast<const ColumnConst *>(&*column_needles);
+        if (!col_needles_const)
+            throw Exception(
+                "Second argument of function " + getName() + " must be constant array of strings.", ErrorCodes::ILLEGAL_COLUMN);
+
+        Array needles_arr = col_needles_const->getValue<Array>();
+
+        std::vector<StringRef> needles;
+        needles.reserve(needles_arr.size());
+        for (const auto & needle : needles_arr)
+            needles.emplace_back(needle.safeGet<String>());
+
+        const ColumnString * col_haystack_vector = checkAndGetColumn<ColumnString>(&*column_haystack);
+        if (!col_haystack_vector)
+            throw Exception(
+                "Illegal column " + block.getByPosition(arguments[0]).column->getName() + " of argument of function " + getName(),
+                ErrorCodes::ILLEGAL_COLUMN);
+
+        auto col_res = std::make_shared<ColumnVector<ResultType>>();
+        block.getByPosition(result).column = col_res;
+
+        typename ColumnVector<ResultType>::Container_t & vec_res = col_res->getData();
+        vec_res.resize(column_haystack->size());
+
+        Impl::vector_constant(col_haystack_vector->getChars(), col_haystack_vector->getOffsets(), needles, vec_res);
+    }
+};
+
+
 template <typename Impl, typename Name>
 class FunctionsStringSearchToString : public IFunction
 {
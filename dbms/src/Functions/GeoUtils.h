@@ -95,8 +95,9 @@ public:
     using Box = boost::geometry::model::box<Point>;
     using Segment = boost::geometry::model::segment<Point>;
 
-    explicit PointInPolygonWithGrid(const Polygon & polygon, UInt16 grid_size = 8)
-            : grid_size(std::max<UInt16>(1, grid_size)), polygon(polygon) {}
+    /// grid_size = 0 means: choose the resolution from the number of polygon vertices.
+    explicit PointInPolygonWithGrid(const Polygon & polygon, UInt16 grid_size = 0)
+            : grid_size(grid_size ? std::max<UInt16>(1, grid_size) : calcGridSize(polygon)), polygon(polygon) {}
 
     void init();
 
@@ -146,6 +147,9 @@ private:
         CellType type;
     };
 
+    static constexpr UInt16 min_grid_size = 8;
+    static constexpr UInt16 max_grid_size = 64;
+
     const UInt16 grid_size;
 
     Polygon polygon;
@@ -163,6 +167,20 @@ private:
     bool has_empty_bound = false;
     bool was_grid_built = false;
 
+    /** Choose the grid resolution from the number of polygon vertices, so that a boundary cell
+      *  keeps only a few edges and most cells are answered with a single array lookup.
+      * With a fixed small grid a polygon with thousands of vertices degrades to the exact
+      *  edge test for almost every cell.
+      */
+    static UInt16 calcGridSize(const Polygon & polygon)
+    {
+        size_t vertices = polygon.outer().size();
+        for (const auto & inner : polygon.inners())
+            vertices += inner.size();
+
+        return std::min<size_t>(max_grid_size, std::max<size_t>(min_grid_size, static_cast<size_t>(std::sqrt(vertices))));
+    }
+
     void buildGrid();
 
     void calcGridAttributes(Box & box);
@@ -415,7 +433,10 @@ void PointInPolygonWithGrid<CoordinateType>::addCell(
         const PointInPolygonWithGrid<CoordinateType>::Polygon & intersection)
 {
     if (!intersection.inners().empty())
+    {
         addComplexPolygonCell(index, box);
+        return;
+    }
 
     auto half_planes = findHalfPlanes(box, intersection);
 
@@ -444,7 +465,10 @@ void PointInPolygonWithGrid<CoordinateType>::addCell(
         const PointInPolygonWithGrid<CoordinateType>::Polygon & second)
 {
     if (!first.inners().empty() || !second.inners().empty())
+    {
         addComplexPolygonCell(index, box);
+        return;
+    }
 
     auto first_half_planes = findHalfPlanes(box, first);
     auto second_half_planes = findHalfPlanes(box, second);
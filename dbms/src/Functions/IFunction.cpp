@@ -1,8 +1,10 @@
 #include <Functions/IFunction.h>
 #include <Functions/FunctionHelpers.h>
 #include <Columns/ColumnNullable.h>
+#include <Columns/ColumnDictionary.h>
 #include <DataTypes/DataTypeNull.h>
 #include <DataTypes/DataTypeNullable.h>
+#include <DataTypes/DataTypeDictionary.h>
 #include <Columns/ColumnConst.h>
 #include <Interpreters/ExpressionActions.h>
 #include <Common/typeid_cast.h>
@@ -140,6 +142,106 @@ DataTypes toNestedDataTypes(const DataTypes & args)
 }
 
 
+/// Replace Dictionary(T) with T in the specified set of data types.
+DataTypes toNonDictionaryDataTypes(const DataTypes & args)
+{
+    DataTypes new_args;
+    new_args.reserve(args.size());
+
+    for (const auto & arg : args)
+    {
+        if (const DataTypeDictionary * dict_type = typeid_cast<const DataTypeDictionary *>(arg.get()))
+            new_args.push_back(dict_type->getNestedType());
+        else
+            new_args.push_back(arg);
+    }
+
+    return new_args;
+}
+
+bool hasDictionaryDataTypes(const DataTypes & args)
+{
+    for (const auto & arg : args)
+        if (typeid_cast<const DataTypeDictionary *>(arg.get()))
+            return true;
+    return false;
+}
+
+/// Decode dictionary-encoded columns of the specified set to their nested type.
+ColumnsWithTypeAndName toNonDictionaryColumns(const ColumnsWithTypeAndName & args)
+{
+    ColumnsWithTypeAndName new_args;
+    new_args.reserve(args.size());
+
+    for (const auto & arg : args)
+    {
+        if (const DataTypeDictionary * dict_type = typeid_cast<const DataTypeDictionary *>(arg.type.get()))
+        {
+            const ColumnDictionary * dict_col = typeid_cast<const ColumnDictionary *>(arg.column.get());
+            new_args.emplace_back(dict_col ? dict_col->convertToFullColumn() : nullptr, dict_type->getNestedType(), arg.name);
+        }
+        else
+            new_args.emplace_back(arg.column, arg.type, arg.name);
+    }
+
+    return new_args;
+}
+
+bool hasDictionaryColumnsOrTypes(const ColumnsWithTypeAndName & args)
+{
+    for (const auto & arg : args)
+        if (typeid_cast<const DataTypeDictionary *>(arg.type.get()))
+            return true;
+    return false;
+}
+
+bool defaultImplementationForDictionaryColumns(
+    IFunction & func, Block & block, const ColumnNumbers & args, size_t result)
+{
+    if (args.empty() || !func.useDefaultImplementationForDictionaryColumns())
+        return false;
+
+    bool has_dictionary = false;
+    for (auto arg : args)
+        if (typeid_cast<const ColumnDictionary *>(block.getByPosition(arg).column.get()))
+        {
+            has_dictionary = true;
+            break;
+        }
+
+    if (!has_dictionary)
+        return false;
+
+    /// Execute the function on a block where the dictionary-encoded arguments are decoded.
+    Block temporary_block;
+
+    size_t arguments_size = args.size();
+    for (size_t arg_num = 0; arg_num < arguments_size; ++arg_num)
+    {
+        const ColumnWithTypeAndName & column = block.getByPosition(args[arg_num]);
+
+        if (const ColumnDictionary * dict_col = typeid_cast<const ColumnDictionary *>(column.column.get()))
+        {
+            const DataTypeDictionary & dict_type = static_cast<const DataTypeDictionary &>(*column.type);
+            temporary_block.insert({ dict_col->convertToFullColumn(), dict_type.getNestedType(), column.name });
+        }
+        else
+            temporary_block.insert(column);
+    }
+
+    temporary_block.insert(block.getByPosition(result));
+
+    ColumnNumbers temporary_argument_numbers(arguments_size);
+    for (size_t i = 0; i < arguments_size; ++i)
+        temporary_argument_numbers[i] = i;
+
+    func.execute(temporary_block, temporary_argument_numbers, arguments_size);
+
+    block.getByPosition(result).column = temporary_block.getByPosition(arguments_size).column;
+    return true;
+}
+
+
 bool allArgumentsAreConstants(const Block & block, const ColumnNumbers & args)
 {
     for (auto arg : args)
@@ -243,6 +345,10 @@ DataTypePtr IFunction::getReturnType(const DataTypes & arguments) const
 {
     checkNumberOfArguments(arguments.size());
 
+    /// Dictionary(T) arguments are decoded to T before execution (see defaultImplementationForDictionaryColumns).
+    if (!arguments.empty() && useDefaultImplementationForDictionaryColumns() && hasDictionaryDataTypes(arguments))
+        return getReturnType(toNonDictionaryDataTypes(arguments));
+
     if (!arguments.empty() && useDefaultImplementationForNulls())
     {
         NullPresense null_presense = getNullPresense(arguments);
@@ -263,6 +369,13 @@ void IFunction::getReturnTypeAndPrerequisites(
 {
     checkNumberOfArguments(arguments.size());
 
+    /// Dictionary(T) arguments are decoded to T before execution (see defaultImplementationForDictionaryColumns).
+    if (!arguments.empty() && useDefaultImplementationForDictionaryColumns() && hasDictionaryColumnsOrTypes(arguments))
+    {
+        getReturnTypeAndPrerequisites(toNonDictionaryColumns(arguments), out_return_type, out_prerequisites);
+        return;
+    }
+
     if (!arguments.empty() && useDefaultImplementationForNulls())
     {
         NullPresense null_presense = getNullPresense(arguments);
@@ -296,13 +409,62 @@ void IFunction::execute(Block & block, const ColumnNumbers & args, size_t result
     if (defaultImplementationForConstantArguments(*this, block, args, result))
         return;
 
+    if (defaultImplementationForDictionaryColumns(*this, block, args, result))
+        return;
+
     if (defaultImplementationForNulls(*this, block, args, result))
         return;
 
+    if (executeWithResolvedKernel(block, args, result))
+        return;
+
     executeImpl(block, args, result);
 }
 
 
+bool IFunction::executeWithResolvedKernel(Block & block, const ColumnNumbers & args, size_t result)
+{
+    if (const KernelCacheEntry * cached = kernel_cache.load(std::memory_order_acquire))
+    {
+        /// The structure of the blocks does not change within a query, so normally the check
+        ///  succeeds on every block after the first one.
+        if (cached->column_types.size() != args.size())
+            return false;
+
+        for (size_t i = 0; i < args.size(); ++i)
+            if (typeid(*block.getByPosition(args[i]).column) != *cached->column_types[i])
+                return false;
+
+        cached->kernel(block, args, result);
+        return true;
+    }
+
+    Kernel kernel = resolveKernel(block, args);
+    if (!kernel)
+        return false;
+
+    auto entry = std::make_unique<KernelCacheEntry>();
+    entry->kernel = kernel;
+    entry->column_types.reserve(args.size());
+    for (size_t arg : args)
+        entry->column_types.push_back(&typeid(*block.getByPosition(arg).column));
+
+    /// Publish the entry; if a concurrent thread was first, its (identical) entry remains.
+    const KernelCacheEntry * expected = nullptr;
+    if (kernel_cache.compare_exchange_strong(expected, entry.get(), std::memory_order_release, std::memory_order_relaxed))
+        entry.release();
+
+    kernel(block, args, result);
+    return true;
+}
+
+
+IFunction::~IFunction()
+{
+    delete kernel_cache.load(std::memory_order_relaxed);
+}
+
+
 void IFunction::execute(Block & block, const ColumnNumbers & args, const ColumnNumbers & prerequisites, size_t result)
 {
     if (!prerequisites.empty())
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <typeinfo>
+#include <vector>
 
 #include <Core/Names.h>
 #include <Core/Field.h>
@@ -94,6 +97,13 @@ public:
       */
     virtual bool isDeterministicInScopeOfQuery() { return true; }
 
+    /** Is the function deterministic in general: would it give the same result if executed again
+      *  as part of another query. Counterexamples: now() and randConstant() are constant in the scope
+      *  of a query but differ between queries. Used to decide whether the result of a query
+      *  may be stored in the query result cache (see executeQuery.cpp).
+      */
+    virtual bool isDeterministic() { return isDeterministicInScopeOfQuery(); }
+
     /// Get the result type by argument type. If the function does not apply to these arguments, throw an exception.
     /// Overloading for those who do not need prerequisites and values of constant arguments. Not called from outside.
     DataTypePtr getReturnType(const DataTypes & arguments) const;
@@ -153,6 +163,22 @@ public:
         executeImpl(block, arguments, result);
     }
 
+    /// A concrete kernel, resolved for one particular combination of argument columns.
+    using Kernel = void (*)(Block & block, const ColumnNumbers & arguments, size_t result);
+
+    /** Functions whose executeImpl spends noticeable time choosing the kernel by argument types
+      *  (such as the type ladder of binary arithmetic) may override this method and return the
+      *  kernel matching the given argument columns, or nullptr if there is none.
+      * The first resolved kernel is remembered in the function object, and subsequent blocks
+      *  with the same column types call it directly, skipping the dispatch. The structure of
+      *  the blocks does not change within a query, so in practice the dispatch runs once per
+      *  query instead of once per block.
+      */
+    virtual Kernel resolveKernel(const Block & block, const ColumnNumbers & arguments) const
+    {
+        return nullptr;
+    }
+
     /** Default implementation in presense of Nullable arguments or NULL constants as arguments is the following:
       *  if some of arguments are NULL constants then return NULL constant,
       *  if some of arguments are Nullable, then execute function as usual for block,
@@ -168,6 +194,14 @@ public:
       */
     virtual bool useDefaultImplementationForConstants() const { return false; }
 
+    /** Default implementation in presense of dictionary-encoded (Dictionary(T)) arguments:
+      *  the function is executed as usual on a block where such arguments are decoded
+      *  to their nested type (ColumnDictionary::convertToFullColumn).
+      * Functions that handle the encoded form themselves (e.g. comparisons evaluate constant
+      *  comparisons once per dictionary entry) return false.
+      */
+    virtual bool useDefaultImplementationForDictionaryColumns() const { return true; }
+
     /** Some arguments could remain constant during this implementation.
       */
     virtual ColumnNumbers getArgumentsThatAreAlwaysConstant() const { return {}; }
@@ -199,7 +233,21 @@ public:
         throw Exception("Function " + getName() + " has no information about its monotonicity.", ErrorCodes::NOT_IMPLEMENTED);
     }
 
-    virtual ~IFunction() {}
+    virtual ~IFunction();
+
+private:
+    /// See resolveKernel. The kernel is remembered together with the concrete types of the
+    ///  argument columns it was resolved for, and is reused only when they match.
+    struct KernelCacheEntry
+    {
+        Kernel kernel;
+        std::vector<const std::type_info *> column_types;
+    };
+
+    std::atomic<const KernelCacheEntry *> kernel_cache {nullptr};
+
+    /// Returns false if no kernel is cached or the cached one doesn't apply to this block.
+    bool executeWithResolvedKernel(Block & block, const ColumnNumbers & args, size_t result);
 };
 
 
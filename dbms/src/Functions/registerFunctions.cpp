@@ -37,6 +37,7 @@ void registerFunctionsMath(FunctionFactory &);
 void registerFunctionsTransform(FunctionFactory &);
 void registerFunctionsGeo(FunctionFactory &);
 void registerFunctionsCharset(FunctionFactory &);
+void registerFunctionsBitmap(FunctionFactory &);
 void registerFunctionsNull(FunctionFactory &);
 void registerFunctionsFindCluster(FunctionFactory &);
 
@@ -71,6 +72,7 @@ void registerFunctions()
     registerFunctionsTransform(factory);
     registerFunctionsGeo(factory);
     registerFunctionsCharset(factory);
+    registerFunctionsBitmap(factory);
     registerFunctionsNull(factory);
     registerFunctionsFindCluster(factory);
 }
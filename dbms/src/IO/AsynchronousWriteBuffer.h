@@ -21,6 +21,7 @@ private:
     std::vector <char> memory;       /// A piece of memory for duplicating the buffer.
     ThreadPool pool;                 /// For asynchronous data writing.
     bool started;                    /// Has an asynchronous data write started?
+    bool finished = false;           /// Has `finish` already been called?
 
     /// Swap the main and duplicate buffers.
     void swapBuffers()
@@ -52,15 +53,26 @@ public:
         set(memory.data(), memory.size());
     }
 
+    /// Wait for the write in flight and flush the rest synchronously.
+    /// Nothing must be written to the buffer after that.
+    void finish()
+    {
+        if (finished)
+            return;
+        finished = true;
+
+        if (started)
+            pool.wait();
+
+        swapBuffers();
+        out.next();
+    }
+
     ~AsynchronousWriteBuffer() override
     {
         try
         {
-            if (started)
-                pool.wait();
-
-            swapBuffers();
-            out.next();
+            finish();
         }
         catch (...)
         {
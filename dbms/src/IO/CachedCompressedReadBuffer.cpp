@@ -15,11 +15,14 @@ void CachedCompressedReadBuffer::initInput()
 {
     if (!file_in)
     {
-        file_in = createReadBufferFromFileBase(path, estimated_size, aio_threshold, buf_size);
+        file_in = createReadBufferFromFileBase(path, estimated_size, aio_threshold, mmap_threshold, buf_size);
         compressed_in = &*file_in;
 
         if (profile_callback)
             file_in->setProfileCallback(profile_callback, clock_type);
+
+        if (max_gap_to_read_through)
+            file_in->setMaxGapToReadThrough(max_gap_to_read_through);
     }
 }
 
@@ -69,9 +72,9 @@ bool CachedCompressedReadBuffer::nextImpl()
 
 CachedCompressedReadBuffer::CachedCompressedReadBuffer(
     const std::string & path_, UncompressedCache * cache_, size_t estimated_size_, size_t aio_threshold_,
-    size_t buf_size_)
+    size_t mmap_threshold_, size_t buf_size_)
     : ReadBuffer(nullptr, 0), path(path_), cache(cache_), buf_size(buf_size_), estimated_size(estimated_size_),
-        aio_threshold(aio_threshold_), file_pos(0)
+        aio_threshold(aio_threshold_), mmap_threshold(mmap_threshold_), file_pos(0)
 {
 }
 
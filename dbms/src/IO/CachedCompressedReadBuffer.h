@@ -26,10 +26,14 @@ private:
     size_t buf_size;
     size_t estimated_size;
     size_t aio_threshold;
+    size_t mmap_threshold;
 
     std::unique_ptr<ReadBufferFromFileBase> file_in;
     size_t file_pos;
 
+    /// Passed into file_in (which is created lazily).
+    size_t max_gap_to_read_through = 0;
+
     /// A piece of data from the cache, or a piece of read data that we put into the cache.
     UncompressedCache::MappedPtr owned_cell;
 
@@ -43,7 +47,7 @@ private:
 public:
     CachedCompressedReadBuffer(
         const std::string & path_, UncompressedCache * cache_, size_t estimated_size_, size_t aio_threshold_,
-        size_t buf_size_ = DBMS_DEFAULT_BUFFER_SIZE);
+        size_t mmap_threshold_ = 0, size_t buf_size_ = DBMS_DEFAULT_BUFFER_SIZE);
 
 
     void seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block);
@@ -53,6 +57,14 @@ public:
         profile_callback = profile_callback_;
         clock_type = clock_type_;
     }
+
+    /// See ReadBufferFromFileBase::setMaxGapToReadThrough.
+    void setMaxGapToReadThrough(size_t max_gap)
+    {
+        max_gap_to_read_through = max_gap;
+        if (file_in)
+            file_in->setMaxGapToReadThrough(max_gap);
+    }
 };
 
 }
@@ -1,6 +1,10 @@
 #include <IO/CompressedReadBufferBase.h>
 
 #include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <string.h>
 #include <city.h>
@@ -10,6 +14,7 @@
 #include <Common/PODArray.h>
 #include <Common/ProfileEvents.h>
 #include <Common/Exception.h>
+#include <Common/setThreadName.h>
 #include <common/unaligned.h>
 #include <IO/ReadBuffer.h>
 #include <IO/BufferWithOwnMemory.h>
@@ -36,6 +41,129 @@ namespace ErrorCodes
 }
 
 
+/// Check the block checksum. The lowest bit of the method byte says which algorithm was used on write.
+static void verifyChecksum(const CityHash_v1_0_2::uint128 & checksum, const char * data, size_t size)
+{
+    bool ok;
+
+    if (static_cast<UInt8>(data[0]) & CHECKSUM_CRC32C_FLAG)
+        ok = checksum.first == crc32cOfBuffer(data, size) && checksum.second == 0;
+    else
+        ok = checksum == CityHash_v1_0_2::CityHash128(data, size);
+
+    if (!ok)
+        throw Exception("Checksum doesn't match: corrupted data.", ErrorCodes::CHECKSUM_DOESNT_MATCH);
+}
+
+
+/** Verifies checksums on a helper thread. The reading thread only copies the block into a queue,
+  *  so verification overlaps decompression of the same block. An error found by the helper
+  *  is rethrown on the next submit (or logged in the destructor if no more reads happen).
+  */
+struct CompressedReadBufferBase::AsyncChecksumState
+{
+    struct Task
+    {
+        CityHash_v1_0_2::uint128 checksum;
+        std::vector<char> block;
+    };
+
+    std::mutex mutex;
+    std::condition_variable has_tasks;
+    std::condition_variable has_space;
+    std::deque<Task> tasks;
+    bool quit = false;
+    std::exception_ptr exception;
+    std::thread thread;
+
+    static constexpr size_t max_queue_size = 8;
+
+    AsyncChecksumState()
+    {
+        thread = std::thread([this] { run(); });
+    }
+
+    void submit(const CityHash_v1_0_2::uint128 & checksum, const char * data, size_t size)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        if (exception)
+        {
+            std::exception_ptr to_throw = exception;
+            exception = {};
+            std::rethrow_exception(to_throw);
+        }
+
+        has_space.wait(lock, [this] { return tasks.size() < max_queue_size; });
+
+        /// The block may point into the underlying read buffer and be overwritten by the next read, so copy it.
+        tasks.push_back({ checksum, std::vector<char>(data, data + size) });
+        has_tasks.notify_one();
+    }
+
+    void run()
+    {
+        setThreadName("AsyncChecksums");
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            has_tasks.wait(lock, [this] { return quit || !tasks.empty(); });
+
+            if (tasks.empty())
+                return;
+
+            Task task = std::move(tasks.front());
+            tasks.pop_front();
+            has_space.notify_one();
+
+            lock.unlock();
+            try
+            {
+                verifyChecksum(task.checksum, task.block.data(), task.block.size());
+            }
+            catch (...)
+            {
+                lock.lock();
+                if (!exception)
+                    exception = std::current_exception();
+                continue;
+            }
+            lock.lock();
+        }
+    }
+
+    ~AsyncChecksumState()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+            has_tasks.notify_one();
+        }
+        thread.join();
+
+        if (exception)
+        {
+            try
+            {
+                std::rethrow_exception(exception);
+            }
+            catch (...)
+            {
+                tryLogCurrentException(__PRETTY_FUNCTION__);
+            }
+        }
+    }
+};
+
+
+void CompressedReadBufferBase::setAsyncChecksumming()
+{
+    if (!async_checksums)
+        async_checksums = std::make_unique<AsyncChecksumState>();
+}
+
+
 /// Read compressed data into compressed_buffer. Get size of decompressed data from block header. Checksum if need.
 /// Returns number of compressed bytes read.
 size_t CompressedReadBufferBase::readCompressedData(size_t & size_decompressed, size_t & size_compressed_without_checksum)
@@ -49,13 +177,16 @@ size_t CompressedReadBufferBase::readCompressedData(size_t & size_decompressed,
     own_compressed_buffer.resize(COMPRESSED_BLOCK_HEADER_SIZE);
     compressed_in->readStrict(&own_compressed_buffer[0], COMPRESSED_BLOCK_HEADER_SIZE);
 
-    UInt8 method = own_compressed_buffer[0];    /// See CompressedWriteBuffer.h
+    UInt8 method = own_compressed_buffer[0] & ~CHECKSUM_CRC32C_FLAG;    /// See CompressedStream.h
 
     size_t & size_compressed = size_compressed_without_checksum;
 
     if (method == static_cast<UInt8>(CompressionMethodByte::LZ4) ||
         method == static_cast<UInt8>(CompressionMethodByte::ZSTD) ||
-        method == static_cast<UInt8>(CompressionMethodByte::NONE))
+        method == static_cast<UInt8>(CompressionMethodByte::NONE) ||
+        method == static_cast<UInt8>(CompressionMethodByte::DELTA) ||
+        method == static_cast<UInt8>(CompressionMethodByte::DOUBLE_DELTA) ||
+        method == static_cast<UInt8>(CompressionMethodByte::ZSTD_DICT))
     {
         size_compressed = unalignedLoad<UInt32>(&own_compressed_buffer[1]);
         size_decompressed = unalignedLoad<UInt32>(&own_compressed_buffer[5]);
@@ -83,8 +214,13 @@ size_t CompressedReadBufferBase::readCompressedData(size_t & size_decompressed,
         compressed_in->readStrict(&compressed_buffer[COMPRESSED_BLOCK_HEADER_SIZE], size_compressed - COMPRESSED_BLOCK_HEADER_SIZE);
     }
 
-    if (!disable_checksum && checksum != CityHash_v1_0_2::CityHash128(&compressed_buffer[0], size_compressed))
-        throw Exception("Checksum doesn't match: corrupted data.", ErrorCodes::CHECKSUM_DOESNT_MATCH);
+    if (!disable_checksum)
+    {
+        if (async_checksums)
+            async_checksums->submit(checksum, &compressed_buffer[0], size_compressed);
+        else
+            verifyChecksum(checksum, &compressed_buffer[0], size_compressed);
+    }
 
     return size_compressed + sizeof(checksum);
 }
@@ -95,7 +231,7 @@ void CompressedReadBufferBase::decompress(char * to, size_t size_decompressed, s
     ProfileEvents::increment(ProfileEvents::CompressedReadBufferBlocks);
     ProfileEvents::increment(ProfileEvents::CompressedReadBufferBytes, size_decompressed);
 
-    UInt8 method = compressed_buffer[0];    /// See CompressedWriteBuffer.h
+    UInt8 method = compressed_buffer[0] & ~CHECKSUM_CRC32C_FLAG;    /// See CompressedStream.h
 
     if (method == static_cast<UInt8>(CompressionMethodByte::LZ4))
     {
@@ -111,6 +247,37 @@ void CompressedReadBufferBase::decompress(char * to, size_t size_decompressed, s
         if (ZSTD_isError(res))
             throw Exception("Cannot ZSTD_decompress: " + std::string(ZSTD_getErrorName(res)), ErrorCodes::CANNOT_DECOMPRESS);
     }
+    else if (method == static_cast<UInt8>(CompressionMethodByte::DELTA) ||
+        method == static_cast<UInt8>(CompressionMethodByte::DOUBLE_DELTA))
+    {
+        /// One extra header byte with the width of an element, then LZ4-compressed delta-encoded data.
+        static constexpr size_t header_size = COMPRESSED_BLOCK_HEADER_SIZE + 1;
+
+        size_t delta_width = static_cast<UInt8>(compressed_buffer[COMPRESSED_BLOCK_HEADER_SIZE]);
+        if (!delta_width)
+            throw Exception("Zero element width in delta-compressed block. Most likely corrupted data.", ErrorCodes::CANNOT_DECOMPRESS);
+
+        if (LZ4_decompress_fast(&compressed_buffer[header_size], to, size_decompressed) < 0)
+            throw Exception("Cannot LZ4_decompress_fast", ErrorCodes::CANNOT_DECOMPRESS);
+
+        deltaDecode(reinterpret_cast<unsigned char *>(to), size_decompressed, delta_width);
+        if (method == static_cast<UInt8>(CompressionMethodByte::DOUBLE_DELTA))
+            deltaDecode(reinterpret_cast<unsigned char *>(to), size_decompressed, delta_width);
+    }
+    else if (method == static_cast<UInt8>(CompressionMethodByte::ZSTD_DICT))
+    {
+        if (!zstd_ddict)
+            throw Exception("Block is compressed with a ZSTD dictionary, but no dictionary was provided", ErrorCodes::CANNOT_DECOMPRESS);
+
+        size_t res = ZSTD_decompress_usingDDict(
+            zstd_dctx,
+            to, size_decompressed,
+            &compressed_buffer[COMPRESSED_BLOCK_HEADER_SIZE], size_compressed_without_checksum - COMPRESSED_BLOCK_HEADER_SIZE,
+            zstd_ddict);
+
+        if (ZSTD_isError(res))
+            throw Exception("Cannot ZSTD_decompress_usingDDict: " + std::string(ZSTD_getErrorName(res)), ErrorCodes::CANNOT_DECOMPRESS);
+    }
     else if (method == static_cast<UInt8>(CompressionMethodByte::NONE))
     {
         memcpy(to, &compressed_buffer[COMPRESSED_BLOCK_HEADER_SIZE], size_decompressed);
@@ -127,7 +294,27 @@ CompressedReadBufferBase::CompressedReadBufferBase(ReadBuffer * in)
 }
 
 
-CompressedReadBufferBase::~CompressedReadBufferBase() = default;    /// Proper destruction of unique_ptr of forward-declared type.
+void CompressedReadBufferBase::setCompressionDictionary(const std::string & dictionary)
+{
+    if (zstd_ddict)
+        ZSTD_freeDDict(zstd_ddict);
+    if (!zstd_dctx)
+        zstd_dctx = ZSTD_createDCtx();
+
+    zstd_ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+
+    if (!zstd_dctx || !zstd_ddict)
+        throw Exception("Cannot create ZSTD decompression dictionary", ErrorCodes::CANNOT_DECOMPRESS);
+}
+
+
+CompressedReadBufferBase::~CompressedReadBufferBase()    /// Proper destruction of unique_ptr of forward-declared type.
+{
+    if (zstd_ddict)
+        ZSTD_freeDDict(zstd_ddict);
+    if (zstd_dctx)
+        ZSTD_freeDCtx(zstd_dctx);
+}
 
 
 }
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <string>
+#include <memory>
+
 #include <Common/PODArray.h>
 
+struct ZSTD_DCtx_s;
+struct ZSTD_DDict_s;
+
 
 namespace DB
 {
@@ -24,6 +30,14 @@ protected:
     /// Don't checksum on decompressing.
     bool disable_checksum = false;
 
+    /// For blocks compressed with a ZSTD dictionary (CompressionMethodByte::ZSTD_DICT).
+    ZSTD_DCtx_s * zstd_dctx = nullptr;
+    ZSTD_DDict_s * zstd_ddict = nullptr;
+
+    /// If set, checksums are verified by a helper thread, overlapping decompression (see setAsyncChecksumming).
+    struct AsyncChecksumState;
+    std::unique_ptr<AsyncChecksumState> async_checksums;
+
 
     /// Read compressed data into compressed_buffer. Get size of decompressed data from block header. Checksum if need.
     /// Returns number of compressed bytes read.
@@ -44,6 +58,17 @@ public:
     {
         disable_checksum = true;
     }
+
+    /// Provide the dictionary for blocks compressed with ZSTD_compress_usingCDict.
+    /// Without it, an attempt to decompress such a block throws an exception.
+    void setCompressionDictionary(const std::string & dictionary);
+
+    /** Verify checksums on a helper thread instead of the reading thread, so verification
+      *  overlaps decompression. A corrupted block is then reported not on the exact read
+      *  that hit it, but on one of the next reads from this buffer (or logged, if the
+      *  buffer is destroyed before). Starts one thread per buffer - use for long scans.
+      */
+    void setAsyncChecksumming();
 };
 
 }
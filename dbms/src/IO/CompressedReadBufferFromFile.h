@@ -30,7 +30,8 @@ private:
 
 public:
     CompressedReadBufferFromFile(
-        const std::string & path, size_t estimated_size, size_t aio_threshold, size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE);
+        const std::string & path, size_t estimated_size, size_t aio_threshold, size_t mmap_threshold = 0,
+        size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE);
 
     void seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block);
 
@@ -40,6 +41,12 @@ public:
     {
         file_in.setProfileCallback(profile_callback_, clock_type_);
     }
+
+    /// See ReadBufferFromFileBase::setMaxGapToReadThrough.
+    void setMaxGapToReadThrough(size_t max_gap)
+    {
+        file_in.setMaxGapToReadThrough(max_gap);
+    }
 };
 
 }
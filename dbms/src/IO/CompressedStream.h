@@ -1,6 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <nmmintrin.h>
 
 /** Common Defines */
 
@@ -19,6 +23,8 @@ enum class CompressionMethod
     LZ4HC = 2,        /// The format is the same as for LZ4. The difference is only in compression.
     ZSTD = 3,         /// Experimental algorithm: https://github.com/Cyan4973/zstd
     NONE = 4,         /// No compression
+    Delta = 5,        /// Delta pre-transform of fixed-width values, then LZ4.
+    DoubleDelta = 6,  /// Delta pre-transform applied twice, then LZ4. For monotonic sequences with a stable step.
 };
 
 /** The compressed block format is as follows:
@@ -39,14 +45,67 @@ enum class CompressionMethod
   *
   * 0x90 - ZSTD
   *
+  * 0x92 - Delta, 0x94 - DoubleDelta.
+  *        Next 4 bytes - the size of the compressed data taking into account the header; 4 bytes is the size of the uncompressed data;
+  *        1 byte - the width of an element in bytes. Then LZ4-compressed delta-encoded data.
+  *
+  * 0x96 - ZSTD with a dictionary. The format is the same as for ZSTD, but decompression requires
+  *        the dictionary the block was compressed with (stored next to the data, see MergedBlockOutputStream).
+  *
   * All sizes are little endian.
   */
 
 enum class CompressionMethodByte : uint8_t
 {
-    NONE     = 0x02,
-    LZ4      = 0x82,
-    ZSTD     = 0x90,
+    NONE         = 0x02,
+    LZ4          = 0x82,
+    ZSTD         = 0x90,
+    DELTA        = 0x92,
+    DOUBLE_DELTA = 0x94,
+    ZSTD_DICT    = 0x96,
 };
 
+/** All method bytes are even, so their lowest bit is free. It is set when the 16-byte checksum field
+  *  of the block holds a hardware CRC32C (SSE 4.2) of the block in its first 8 bytes (the second
+  *  8 bytes are zero) instead of CityHash128. CRC32C is several times cheaper to verify,
+  *  which matters on wide scans where checksumming is in the decompression hot path.
+  */
+constexpr uint8_t CHECKSUM_CRC32C_FLAG = 0x01;
+
+inline uint64_t crc32cOfBuffer(const char * data, size_t size)
+{
+    uint64_t crc = -1ULL;
+
+    const char * end = data + size;
+    while (data + 8 <= end)
+    {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        crc = _mm_crc32_u64(crc, word);
+        data += 8;
+    }
+    while (data < end)
+        crc = _mm_crc32_u8(crc, static_cast<unsigned char>(*data++));
+
+    return ~crc;
+}
+
+
+/** Byte-wise delta pre-transform for fixed-width values (see CompressionMethodByte::DELTA).
+  * Subtracts from every byte the corresponding byte of the previous element. It is invertible, cheap
+  *  and turns slowly changing sequences (timestamps, counters) into mostly-zero bytes that the
+  *  generic algorithm compresses much better. Applied twice it approximates a double delta.
+  */
+inline void deltaEncode(unsigned char * data, size_t size, size_t width)
+{
+    for (size_t i = size; i-- > width;)
+        data[i] -= data[i - width];
+}
+
+inline void deltaDecode(unsigned char * data, size_t size, size_t width)
+{
+    for (size_t i = width; i < size; ++i)
+        data[i] += data[i - width];
+}
+
 }
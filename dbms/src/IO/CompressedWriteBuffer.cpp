@@ -33,7 +33,36 @@ void CompressedWriteBuffer::nextImpl()
     /** The format of compressed block - see CompressedStream.h
       */
 
-    switch (method)
+    if (zstd_cdict)
+    {
+        static constexpr size_t header_size = 1 + sizeof(UInt32) + sizeof(UInt32);
+
+        compressed_buffer.resize(header_size + ZSTD_compressBound(uncompressed_size));
+
+        compressed_buffer[0] = static_cast<UInt8>(CompressionMethodByte::ZSTD_DICT);
+
+        size_t res = ZSTD_compress_usingCDict(
+            zstd_cctx,
+            &compressed_buffer[header_size],
+            compressed_buffer.size() - header_size,
+            working_buffer.begin(),
+            uncompressed_size,
+            zstd_cdict);
+
+        if (ZSTD_isError(res))
+            throw Exception("Cannot compress block with ZSTD dictionary: " + std::string(ZSTD_getErrorName(res)), ErrorCodes::CANNOT_COMPRESS);
+
+        compressed_size = header_size + res;
+
+        UInt32 compressed_size_32 = compressed_size;
+        UInt32 uncompressed_size_32 = uncompressed_size;
+
+        unalignedStore(&compressed_buffer[1], compressed_size_32);
+        unalignedStore(&compressed_buffer[5], uncompressed_size_32);
+
+        compressed_buffer_ptr = &compressed_buffer[0];
+    }
+    else switch (method)
     {
         case CompressionMethod::LZ4:
         case CompressionMethod::LZ4HC:
@@ -83,7 +112,7 @@ void CompressedWriteBuffer::nextImpl()
                 compressed_buffer.size() - header_size,
                 working_buffer.begin(),
                 uncompressed_size,
-                1);
+                zstd_level);
 
             if (ZSTD_isError(res))
                 throw Exception("Cannot compress block with ZSTD: " + std::string(ZSTD_getErrorName(res)), ErrorCodes::CANNOT_COMPRESS);
@@ -99,6 +128,40 @@ void CompressedWriteBuffer::nextImpl()
             compressed_buffer_ptr = &compressed_buffer[0];
             break;
         }
+        case CompressionMethod::Delta:
+        case CompressionMethod::DoubleDelta:
+        {
+            static constexpr size_t header_size = 1 + sizeof(UInt32) + sizeof(UInt32) + 1;
+
+            /// The buffer is being flushed, so the data can be delta-encoded in place.
+            deltaEncode(reinterpret_cast<unsigned char *>(working_buffer.begin()), uncompressed_size, delta_width);
+            if (method == CompressionMethod::DoubleDelta)
+                deltaEncode(reinterpret_cast<unsigned char *>(working_buffer.begin()), uncompressed_size, delta_width);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+            compressed_buffer.resize(header_size + LZ4_COMPRESSBOUND(uncompressed_size));
+
+            compressed_buffer[0] = static_cast<UInt8>(method == CompressionMethod::Delta
+                ? CompressionMethodByte::DELTA : CompressionMethodByte::DOUBLE_DELTA);
+            compressed_buffer[9] = static_cast<UInt8>(delta_width);
+
+            compressed_size = header_size + LZ4_compress_default(
+                working_buffer.begin(),
+                &compressed_buffer[header_size],
+                uncompressed_size,
+                LZ4_COMPRESSBOUND(uncompressed_size));
+#pragma GCC diagnostic pop
+
+            UInt32 compressed_size_32 = compressed_size;
+            UInt32 uncompressed_size_32 = uncompressed_size;
+
+            unalignedStore(&compressed_buffer[1], compressed_size_32);
+            unalignedStore(&compressed_buffer[5], uncompressed_size_32);
+
+            compressed_buffer_ptr = &compressed_buffer[0];
+            break;
+        }
         case CompressionMethod::NONE:
         {
             static constexpr size_t header_size = 1 + sizeof (UInt32) + sizeof (UInt32);
@@ -122,8 +185,18 @@ void CompressedWriteBuffer::nextImpl()
             throw Exception("Unknown compression method", ErrorCodes::UNKNOWN_COMPRESSION_METHOD);
     }
 
-    CityHash_v1_0_2::uint128 checksum = CityHash_v1_0_2::CityHash128(compressed_buffer_ptr, compressed_size);
-    out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+    if (crc32c_checksum)
+    {
+        *compressed_buffer_ptr = static_cast<char>(static_cast<UInt8>(*compressed_buffer_ptr) | CHECKSUM_CRC32C_FLAG);
+
+        UInt64 checksum[2] = { crc32cOfBuffer(compressed_buffer_ptr, compressed_size), 0 };
+        out.write(reinterpret_cast<const char *>(checksum), sizeof(checksum));
+    }
+    else
+    {
+        CityHash_v1_0_2::uint128 checksum = CityHash_v1_0_2::CityHash128(compressed_buffer_ptr, compressed_size);
+        out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+    }
 
     out.write(compressed_buffer_ptr, compressed_size);
 }
@@ -132,12 +205,33 @@ void CompressedWriteBuffer::nextImpl()
 CompressedWriteBuffer::CompressedWriteBuffer(
     WriteBuffer & out_,
     CompressionMethod method_,
-    size_t buf_size)
-    : BufferWithOwnMemory<WriteBuffer>(buf_size), out(out_), method(method_)
+    size_t buf_size,
+    size_t delta_width_,
+    bool crc32c_checksum_,
+    int zstd_level_)
+    : BufferWithOwnMemory<WriteBuffer>(buf_size), out(out_), method(method_), zstd_level(zstd_level_),
+    delta_width(delta_width_), crc32c_checksum(crc32c_checksum_)
 {
 }
 
 
+void CompressedWriteBuffer::setCompressionDictionary(const std::string & dictionary)
+{
+    /// Flush the data accumulated so far, so it is compressed with the old method.
+    next();
+
+    if (zstd_cdict)
+        ZSTD_freeCDict(zstd_cdict);
+    if (!zstd_cctx)
+        zstd_cctx = ZSTD_createCCtx();
+
+    zstd_cdict = ZSTD_createCDict(dictionary.data(), dictionary.size(), 1);
+
+    if (!zstd_cctx || !zstd_cdict)
+        throw Exception("Cannot create ZSTD compression dictionary", ErrorCodes::CANNOT_COMPRESS);
+}
+
+
 CompressedWriteBuffer::~CompressedWriteBuffer()
 {
     try
@@ -148,6 +242,11 @@ CompressedWriteBuffer::~CompressedWriteBuffer()
     {
         tryLogCurrentException(__PRETTY_FUNCTION__);
     }
+
+    if (zstd_cdict)
+        ZSTD_freeCDict(zstd_cdict);
+    if (zstd_cctx)
+        ZSTD_freeCCtx(zstd_cctx);
 }
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include <Common/PODArray.h>
 
@@ -8,6 +9,9 @@
 #include <IO/BufferWithOwnMemory.h>
 #include <IO/CompressedStream.h>
 
+struct ZSTD_CCtx_s;
+struct ZSTD_CDict_s;
+
 
 namespace DB
 {
@@ -18,6 +22,19 @@ private:
     WriteBuffer & out;
     CompressionMethod method;
 
+    /// Compression level for the ZSTD method (ignored by the other methods).
+    int zstd_level;
+
+    /// The width of an element in bytes for the Delta and DoubleDelta methods.
+    size_t delta_width;
+
+    /// Checksum blocks with hardware CRC32C instead of CityHash128 (see CHECKSUM_CRC32C_FLAG).
+    bool crc32c_checksum;
+
+    /// If set, blocks are compressed with ZSTD using this dictionary, regardless of `method`.
+    ZSTD_CCtx_s * zstd_cctx = nullptr;
+    ZSTD_CDict_s * zstd_cdict = nullptr;
+
     PODArray<char> compressed_buffer;
 
     void nextImpl() override;
@@ -26,7 +43,14 @@ public:
     CompressedWriteBuffer(
         WriteBuffer & out_,
         CompressionMethod method_ = CompressionMethod::LZ4,
-        size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE);
+        size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE,
+        size_t delta_width_ = 1,
+        bool crc32c_checksum_ = false,
+        int zstd_level_ = 1);
+
+    /// Compress all subsequent blocks with ZSTD using the given dictionary
+    ///  (CompressionMethodByte::ZSTD_DICT). Blocks written before this call keep their method.
+    void setCompressionDictionary(const std::string & dictionary);
 
     /// The amount of compressed data
     size_t getCompressedBytes()
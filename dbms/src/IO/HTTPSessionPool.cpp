@@ -0,0 +1,71 @@
+#include <IO/HTTPSessionPool.h>
+
+#include <Common/config.h>
+
+#if Poco_NetSSL_FOUND
+#include <Poco/Net/HTTPSClientSession.h>
+#endif
+
+
+namespace DB
+{
+
+HTTPSessionPool & HTTPSessionPool::instance()
+{
+    static HTTPSessionPool res;
+    return res;
+}
+
+
+HTTPSessionPool::SessionPtr HTTPSessionPool::get(const std::string & host, UInt16 port, bool is_ssl)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = endpoints.find(Key{host, port, is_ssl});
+        if (it != endpoints.end())
+        {
+            auto & sessions = it->second;
+            time_t now = time(nullptr);
+
+            while (!sessions.empty())
+            {
+                PooledSession pooled = std::move(sessions.back());
+                sessions.pop_back();
+
+                if (pooled.idle_since + static_cast<time_t>(idle_timeout_seconds) >= now)
+                    return std::move(pooled.session);
+
+                /// The session sat idle for too long: the server has likely closed it already.
+            }
+        }
+    }
+
+    return SessionPtr(
+#if Poco_NetSSL_FOUND
+        is_ssl ? new Poco::Net::HTTPSClientSession :
+#endif
+            new Poco::Net::HTTPClientSession);
+}
+
+
+void HTTPSessionPool::put(const std::string & host, UInt16 port, bool is_ssl, SessionPtr session)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto & sessions = endpoints[Key{host, port, is_ssl}];
+    if (sessions.size() >= max_sessions_per_endpoint)
+        return;
+
+    sessions.push_back(PooledSession{std::move(session), time(nullptr)});
+}
+
+
+void HTTPSessionPool::setLimits(size_t max_sessions_per_endpoint_, size_t idle_timeout_seconds_)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    max_sessions_per_endpoint = max_sessions_per_endpoint_;
+    idle_timeout_seconds = idle_timeout_seconds_;
+}
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <Poco/Net/HTTPClientSession.h>
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+/** A process-wide pool of keep-alive HTTP sessions, keyed by endpoint (host, port, scheme).
+  * Plays the same role for HTTP-based communication (replication fetches, HTTP dictionaries)
+  *  as ConnectionPool does for the native protocol: a session whose response was fully read
+  *  is returned to the pool and the next request to the same endpoint skips the TCP handshake
+  *  and slow start.
+  *
+  * A returned session is dropped if the endpoint already has `max_sessions_per_endpoint` idle
+  *  sessions; an idle session is dropped when it is older than `idle_timeout_seconds`.
+  */
+class HTTPSessionPool : private boost::noncopyable
+{
+public:
+    using SessionPtr = std::unique_ptr<Poco::Net::HTTPClientSession>;
+
+    static HTTPSessionPool & instance();
+
+    /// Returns an idle keep-alive session for the endpoint, or a new, not yet connected one
+    ///  (the caller then has to set the host, port and timeouts).
+    SessionPtr get(const std::string & host, UInt16 port, bool is_ssl);
+
+    /// Return a session for reuse. Call only if the whole response has been read,
+    ///  otherwise leftover body would be prepended to the next response on this connection.
+    void put(const std::string & host, UInt16 port, bool is_ssl, SessionPtr session);
+
+    void setLimits(size_t max_sessions_per_endpoint_, size_t idle_timeout_seconds_);
+
+private:
+    using Key = std::tuple<std::string, UInt16, bool>;
+
+    struct PooledSession
+    {
+        SessionPtr session;
+        time_t idle_since;
+    };
+
+    std::map<Key, std::vector<PooledSession>> endpoints;
+    std::mutex mutex;
+
+    /// The default idle timeout matches the default keep_alive_timeout of the server,
+    ///  so a session is not reused after the peer has already closed it.
+    size_t max_sessions_per_endpoint = 16;
+    size_t idle_timeout_seconds = 10;
+};
+
+}
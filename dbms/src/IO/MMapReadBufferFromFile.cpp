@@ -0,0 +1,89 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <Common/ProfileEvents.h>
+#include <IO/MMapReadBufferFromFile.h>
+#include <IO/WriteHelpers.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event FileOpen;
+}
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int FILE_DOESNT_EXIST;
+    extern const int CANNOT_OPEN_FILE;
+    extern const int CANNOT_FSTAT;
+    extern const int CANNOT_ALLOCATE_MEMORY;
+    extern const int ARGUMENT_OUT_OF_BOUND;
+}
+
+
+MMapReadBufferFromFile::MMapReadBufferFromFile(const std::string & file_name_)
+    : ReadBufferFromFileBase(0, nullptr, 0), file_name(file_name_)
+{
+    ProfileEvents::increment(ProfileEvents::FileOpen);
+
+    fd = open(file_name.c_str(), O_RDONLY);
+    if (-1 == fd)
+        throwFromErrno("Cannot open file " + file_name, errno == ENOENT ? ErrorCodes::FILE_DOESNT_EXIST : ErrorCodes::CANNOT_OPEN_FILE);
+
+    struct stat stat_res {};
+    if (-1 == fstat(fd, &stat_res))
+    {
+        close(fd);
+        throwFromErrno("Cannot fstat file " + file_name, ErrorCodes::CANNOT_FSTAT);
+    }
+
+    length = stat_res.st_size;
+    if (length)
+    {
+        void * res = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == res)
+        {
+            close(fd);
+            throwFromErrno("Cannot mmap file " + file_name, ErrorCodes::CANNOT_ALLOCATE_MEMORY);
+        }
+        mapped = static_cast<char *>(res);
+
+        BufferBase::set(mapped, length, 0);
+    }
+}
+
+MMapReadBufferFromFile::~MMapReadBufferFromFile()
+{
+    /// Cannot throw from a destructor; a failed munmap only leaks address space.
+    if (mapped)
+        munmap(mapped, length);
+
+    if (-1 != fd)
+        close(fd);
+}
+
+off_t MMapReadBufferFromFile::doSeek(off_t off, int whence)
+{
+    off_t new_pos;
+    if (whence == SEEK_SET)
+        new_pos = off;
+    else if (whence == SEEK_CUR)
+        new_pos = count() + off;
+    else
+        throw Exception("MMapReadBufferFromFile::seek expects SEEK_SET or SEEK_CUR as whence", ErrorCodes::ARGUMENT_OUT_OF_BOUND);
+
+    working_buffer = internal_buffer;
+    if (new_pos < 0 || static_cast<size_t>(new_pos) > working_buffer.size())
+        throw Exception("Cannot seek through file " + file_name + " because seek position (" + toString(new_pos)
+            + ") is out of bounds [0, " + toString(working_buffer.size()) + "]", ErrorCodes::ARGUMENT_OUT_OF_BOUND);
+
+    pos = working_buffer.begin() + new_pos;
+    return new_pos;
+}
+
+}
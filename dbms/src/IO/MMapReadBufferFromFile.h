@@ -0,0 +1,34 @@
+#pragma once
+
+#include <IO/ReadBufferFromFileBase.h>
+
+
+namespace DB
+{
+
+/** Reads a file through a private read-only memory mapping.
+  * The whole mapping is presented as a single working buffer, so data is consumed
+  *  directly out of the page cache without read() system calls or an intermediate copy.
+  * Suitable for files that are expected to stay hot; a cold mapping produces
+  *  a page fault per page instead of readahead-friendly sequential reads.
+  */
+class MMapReadBufferFromFile : public ReadBufferFromFileBase
+{
+public:
+    MMapReadBufferFromFile(const std::string & file_name_);
+    ~MMapReadBufferFromFile() override;
+
+    off_t getPositionInFile() override { return count(); }
+    std::string getFileName() const override { return file_name; }
+    int getFD() const override { return fd; }
+
+private:
+    std::string file_name;
+    int fd = -1;
+    char * mapped = nullptr;
+    size_t length = 0;
+
+    off_t doSeek(off_t off, int whence) override;
+};
+
+}
@@ -42,6 +42,13 @@ public:
         clock_type = clock_type_;
     }
 
+    /** Forward seeks over a gap smaller than this are performed by reading and discarding
+      *  the gap bytes instead of a true seek. This keeps the kernel readahead window and,
+      *  on spinning disks, avoids moving the head for scattered but nearby ranges.
+      * No-op for implementations that cannot benefit from it (e.g. unbuffered AIO reads).
+      */
+    virtual void setMaxGapToReadThrough(size_t) {}
+
 protected:
     ProfileCallback profile_callback;
     clockid_t clock_type;
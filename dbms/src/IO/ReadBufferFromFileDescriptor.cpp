@@ -117,6 +117,20 @@ off_t ReadBufferFromFileDescriptor::doSeek(off_t offset, int whence)
     }
     else
     {
+        /// A small seek forward is cheaper to perform by reading and discarding the gap bytes:
+        ///  this keeps the kernel readahead window, while a true seek would drop it
+        ///  and, on spinning disks, could move the head.
+        off_t current_pos = pos_in_file - (working_buffer.end() - pos);
+        if (max_gap_to_read_through
+            && new_pos > current_pos
+            && new_pos - current_pos <= static_cast<off_t>(max_gap_to_read_through))
+        {
+            if (static_cast<off_t>(tryIgnore(new_pos - current_pos)) == new_pos - current_pos)
+                return new_pos;
+
+            /// The file turned out to be shorter; fall through to a true seek.
+        }
+
         ProfileEvents::increment(ProfileEvents::Seek);
 
         pos = working_buffer.end();
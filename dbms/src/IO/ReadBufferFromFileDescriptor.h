@@ -17,6 +17,9 @@ protected:
     int fd;
     off_t pos_in_file; /// What offset in file corresponds to working_buffer.end().
 
+    /// See setMaxGapToReadThrough.
+    size_t max_gap_to_read_through = 0;
+
     bool nextImpl() override;
 
     /// Name or some description of file.
@@ -38,6 +41,11 @@ public:
         return pos_in_file - (working_buffer.end() - pos);
     }
 
+    void setMaxGapToReadThrough(size_t max_gap) override
+    {
+        max_gap_to_read_through = max_gap;
+    }
+
 private:
     /// If 'offset' is small enough to stay in buffer after seek, then true seek in file does not happen.
     off_t doSeek(off_t offset, int whence) override;
@@ -548,10 +548,7 @@ void readCSVStringInto(Vector & s, ReadBuffer & buf, const char delimiter)
         /// Unquoted case. Look for delimiter or \r or \n.
         while (!buf.eof())
         {
-            const char * next_pos = buf.position();
-            while (next_pos < buf.buffer().end()
-                && *next_pos != delimiter && *next_pos != '\r' && *next_pos != '\n')    /// NOTE You can make a SIMD version.
-                ++next_pos;
+            const char * next_pos = find_first_symbols_or<'\r', '\n'>(buf.position(), buf.buffer().end(), delimiter);
 
             appendToStringOrVector(s, buf.position(), next_pos);
             buf.position() += next_pos - buf.position();
@@ -109,7 +109,7 @@ inline void readFloatBinary(T & x, ReadBuffer & buf)
 inline void readStringBinary(std::string & s, ReadBuffer & buf, size_t MAX_STRING_SIZE = DEFAULT_MAX_STRING_SIZE)
 {
     size_t size = 0;
-    readVarUInt(size, buf);
+    readVarUIntFast(size, buf);
 
     if (size > MAX_STRING_SIZE)
         throw Poco::Exception("Too large string size.");
@@ -122,7 +122,7 @@ inline void readStringBinary(std::string & s, ReadBuffer & buf, size_t MAX_STRIN
 inline StringRef readStringBinaryInto(Arena & arena, ReadBuffer & buf)
 {
     size_t size = 0;
-    readVarUInt(size, buf);
+    readVarUIntFast(size, buf);
 
     char * data = arena.alloc(size);
     buf.readStrict(data, size);
@@ -372,6 +372,110 @@ void assertInfinity(ReadBuffer & buf);
 void assertNaN(ReadBuffer & buf);
 
 
+/** Fast path of float parsing: the mantissa is accumulated as an integer and then
+  *  multiplied (or divided) by an exactly representable power of ten, which gives the
+  *  correctly rounded result when both fit in a double without rounding.
+  * Handles the common case of numbers with up to 19 significant digits and a decimal
+  *  exponent within [-22, 22] that lie entirely within the current buffer chunk.
+  * Returns false without moving the position when the number does not qualify
+  *  (too many digits, large exponent, inf/nan, possible continuation in the next chunk),
+  *  so the caller can re-parse with the general code.
+  */
+template <typename T, char point_symbol = '.'>
+inline bool readFloatTextFastPath(T & x, ReadBuffer & buf)
+{
+    static const double powers_of_ten[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char * pos = buf.position();
+    const char * end = buf.buffer().end();
+
+    if (pos == end)
+        return false;
+
+    bool negative = false;
+    if (*pos == '-' || *pos == '+')
+    {
+        negative = *pos == '-';
+        ++pos;
+    }
+
+    UInt64 mantissa = 0;
+    size_t digits = 0;
+    Int32 exponent = 0;
+
+    while (pos != end && *pos >= '0' && *pos <= '9')
+    {
+        if (digits >= 19)
+            return false;
+        mantissa = mantissa * 10 + (*pos - '0');
+        ++digits;
+        ++pos;
+    }
+
+    if (pos != end && *pos == point_symbol)
+    {
+        ++pos;
+        while (pos != end && *pos >= '0' && *pos <= '9')
+        {
+            if (digits >= 19)
+                return false;
+            mantissa = mantissa * 10 + (*pos - '0');
+            ++digits;
+            --exponent;
+            ++pos;
+        }
+    }
+
+    if (!digits)
+        return false;
+
+    if (pos != end && (*pos == 'e' || *pos == 'E'))
+    {
+        ++pos;
+
+        bool exponent_negative = false;
+        if (pos != end && (*pos == '-' || *pos == '+'))
+        {
+            exponent_negative = *pos == '-';
+            ++pos;
+        }
+
+        if (pos == end || *pos < '0' || *pos > '9')
+            return false;
+
+        Int32 exponent_value = 0;
+        while (pos != end && *pos >= '0' && *pos <= '9')
+        {
+            exponent_value = exponent_value * 10 + (*pos - '0');
+            if (exponent_value > 1000)
+                return false;
+            ++pos;
+        }
+
+        exponent += exponent_negative ? -exponent_value : exponent_value;
+    }
+
+    /// The number might continue in the next buffer chunk.
+    if (pos == end)
+        return false;
+
+    if (mantissa > (1ULL << 53) || exponent < -22 || exponent > 22)
+        return false;
+
+    double res = exponent >= 0
+        ? static_cast<double>(mantissa) * powers_of_ten[exponent]
+        : static_cast<double>(mantissa) / powers_of_ten[-exponent];
+
+    x = negative ? -res : res;
+    buf.position() += pos - buf.position();
+    return true;
+}
+
+
 /// Rough: not exactly nearest machine representable number is returned.
 /// Some garbage may be successfully parsed, examples: '.' parsed as 0; 123Inf parsed as inf.
 template <typename T, typename ReturnType, char point_symbol = '.'>
@@ -392,6 +496,9 @@ ReturnType readFloatTextImpl(T & x, ReadBuffer & buf)
             return ReturnType(false);
     }
 
+    if (readFloatTextFastPath<T, point_symbol>(x, buf))
+        return ReturnType(true);
+
     while (!buf.eof())
     {
         switch (*buf.position())
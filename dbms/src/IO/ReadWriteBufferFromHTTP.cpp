@@ -1,5 +1,6 @@
 #include <IO/ReadWriteBufferFromHTTP.h>
 
+#include <IO/HTTPSessionPool.h>
 #include <Common/SimpleCache.h>
 #include <Common/config.h>
 #include <Core/Types.h>
@@ -34,17 +35,14 @@ ReadWriteBufferFromHTTP::ReadWriteBufferFromHTTP(const Poco::URI & uri,
       method{!method_.empty() ? method_ : out_stream_callback ? Poco::Net::HTTPRequest::HTTP_POST : Poco::Net::HTTPRequest::HTTP_GET},
       timeouts{timeouts},
       is_ssl{uri.getScheme() == "https"},
-      session
+      session{HTTPSessionPool::instance().get(uri.getHost(), uri.getPort(), is_ssl)}
 {
-    std::unique_ptr<Poco::Net::HTTPClientSession>(
-#if Poco_NetSSL_FOUND
-        is_ssl ? new Poco::Net::HTTPSClientSession :
-#endif
-               new Poco::Net::HTTPClientSession)
-}
-{
-    session->setHost(DNSCache::instance().resolveHost(uri.getHost()).toString());
-    session->setPort(uri.getPort());
+    /// A session from the pool is already connected; the host cannot be changed on it anyway.
+    if (!session->connected())
+    {
+        session->setHost(DNSCache::instance().resolveHost(uri.getHost()).toString());
+        session->setPort(uri.getPort());
+    }
 
 #if POCO_CLICKHOUSE_PATCH || POCO_VERSION >= 0x02000000
     session->setTimeout(timeouts.connection_timeout, timeouts.send_timeout, timeouts.receive_timeout);
@@ -54,6 +52,7 @@ ReadWriteBufferFromHTTP::ReadWriteBufferFromHTTP(const Poco::URI & uri,
 
     Poco::Net::HTTPRequest request(method, uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
     request.setHost(uri.getHost()); // use original, not resolved host name in header
+    request.setKeepAlive(true);
 
     if (out_stream_callback)
         request.setChunkedTransferEncoding(true);
@@ -82,14 +81,28 @@ ReadWriteBufferFromHTTP::ReadWriteBufferFromHTTP(const Poco::URI & uri,
                                              : ErrorCodes::RECEIVED_ERROR_FROM_REMOTE_IO_SERVER);
     }
 
+    keep_alive = response.getKeepAlive();
+
     impl = std::make_unique<ReadBufferFromIStream>(*istr, buffer_size_);
 }
 
 
+ReadWriteBufferFromHTTP::~ReadWriteBufferFromHTTP()
+{
+    /// A session with an unread rest of the response cannot be reused: the leftover
+    ///  would be read as the beginning of the next response on this connection.
+    if (keep_alive && all_read)
+        HTTPSessionPool::instance().put(uri.getHost(), uri.getPort(), is_ssl, std::move(session));
+}
+
+
 bool ReadWriteBufferFromHTTP::nextImpl()
 {
     if (!impl->next())
+    {
+        all_read = true;
         return false;
+    }
     internal_buffer = impl->buffer();
     working_buffer = internal_buffer;
     return true;
@@ -35,6 +35,11 @@ private:
     std::istream * istr;    /// owned by session
     std::unique_ptr<ReadBuffer> impl;
 
+    /// Whether the server agreed to keep the connection alive and the whole response
+    ///  has been read: only then the session may be returned to HTTPSessionPool.
+    bool keep_alive = false;
+    bool all_read = false;
+
 public:
     using OutStreamCallback = std::function<void(std::ostream &)>;
 
@@ -45,6 +50,9 @@ public:
         size_t buffer_size_ = DBMS_DEFAULT_BUFFER_SIZE,
         const HTTPTimeouts & timeouts = {});
 
+    /// Returns the session to the pool for reuse, if possible.
+    ~ReadWriteBufferFromHTTP() override;
+
     bool nextImpl() override;
 };
 
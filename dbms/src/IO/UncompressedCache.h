@@ -40,9 +40,12 @@ class UncompressedCache : public LRUCache<UInt128, UncompressedCacheCell, UInt12
 private:
     using Base = LRUCache<UInt128, UncompressedCacheCell, UInt128TrivialHash, UncompressedSizeWeightFunction>;
 
+    /// Blocks are small and lookups are frequent, so spread the mutex over enough shards.
+    static constexpr size_t NUM_SHARDS = 16;
+
 public:
     UncompressedCache(size_t max_size_in_bytes)
-        : Base(max_size_in_bytes) {}
+        : Base(max_size_in_bytes, Delay::zero(), NUM_SHARDS) {}
 
     /// Calculate key from path to file and offset.
     static UInt128 hash(const String & path_to_file, size_t offset)
@@ -72,8 +75,7 @@ public:
     void set(const Key & key, const MappedPtr & mapped)
     {
         Base::set(key, mapped);
-        ProfileEvents::increment(ProfileEvents::UncompressedCacheWeightLost, current_weight_lost);
-        current_weight_lost = 0;
+        ProfileEvents::increment(ProfileEvents::UncompressedCacheWeightLost, current_weight_lost.exchange(0));
     }
 };
 
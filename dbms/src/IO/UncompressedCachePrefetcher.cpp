@@ -0,0 +1,90 @@
+#include <IO/UncompressedCachePrefetcher.h>
+#include <IO/CachedCompressedReadBuffer.h>
+
+#include <Common/setThreadName.h>
+
+
+namespace DB
+{
+
+UncompressedCachePrefetcher & UncompressedCachePrefetcher::instance()
+{
+    static UncompressedCachePrefetcher res;
+    return res;
+}
+
+
+UncompressedCachePrefetcher::UncompressedCachePrefetcher()
+{
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+        threads.emplace_back([this] { run(); });
+}
+
+
+void UncompressedCachePrefetcher::submit(const std::string & path, size_t offset, UncompressedCache * cache, size_t max_blocks)
+{
+    if (!max_blocks)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (tasks.size() >= max_queue_size)
+        return;
+
+    tasks.push_back({ path, offset, cache, max_blocks });
+    has_tasks.notify_one();
+}
+
+
+void UncompressedCachePrefetcher::run()
+{
+    setThreadName("UncmprsPrefetch");
+
+    while (true)
+    {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            has_tasks.wait(lock, [this] { return quit || !tasks.empty(); });
+
+            if (quit)
+                return;
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        try
+        {
+            /// Goes through the regular cached read path, so every block is checksummed,
+            ///  decompressed and put into the cache exactly as a query thread would do it
+            ///  (and blocks that are already cached are skipped almost for free).
+            CachedCompressedReadBuffer buf(task.path, task.cache, 0, 0);
+            buf.seek(task.offset, 0);
+
+            for (size_t i = 0; i < task.max_blocks && !buf.eof(); ++i)
+                buf.position() = buf.buffer().end();
+        }
+        catch (...)
+        {
+            /// Best effort: the query thread that reads the block will report the error.
+        }
+    }
+}
+
+
+UncompressedCachePrefetcher::~UncompressedCachePrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+        has_tasks.notify_all();
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+}
+
+}
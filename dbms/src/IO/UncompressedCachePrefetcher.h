@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace DB
+{
+
+class UncompressedCache;
+
+/** Reads compressed blocks ahead of the query threads and decompresses them into the
+  *  UncompressedCache, so that scans overlap disk latency with decompression instead of
+  *  paying for them in series (see the merge_tree_prefetch_ahead_blocks setting).
+  *
+  * Prefetch is best effort: requests are dropped when all threads are busy and the queue
+  *  is full, and a broken block is simply left for the query thread to report.
+  */
+class UncompressedCachePrefetcher
+{
+public:
+    static UncompressedCachePrefetcher & instance();
+
+    /// Schedule reading of up to max_blocks consecutive compressed blocks of the file,
+    ///  starting at the given offset, into the cache.
+    void submit(const std::string & path, size_t offset, UncompressedCache * cache, size_t max_blocks);
+
+    ~UncompressedCachePrefetcher();
+
+private:
+    UncompressedCachePrefetcher();
+
+    struct Task
+    {
+        std::string path;
+        size_t offset;
+        UncompressedCache * cache;
+        size_t max_blocks;
+    };
+
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable has_tasks;
+    std::deque<Task> tasks;
+    bool quit = false;
+    std::vector<std::thread> threads;
+
+    static constexpr size_t num_threads = 4;
+    static constexpr size_t max_queue_size = 64;
+};
+
+}
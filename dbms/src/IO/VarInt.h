@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <string.h>
 #include <Core/Types.h>
 #include <IO/ReadBuffer.h>
 #include <IO/WriteBuffer.h>
@@ -140,6 +141,55 @@ inline void readVarUInt(UInt64 & x, std::istream & istr)
     }
 }
 
+/// A varint never takes more than this many bytes (only values up to 2^63 - 1 are supported).
+constexpr size_t MAX_LENGTH_OF_VAR_UINT = 9;
+
+/** Read a varint from memory that is known to hold at least `MAX_LENGTH_OF_VAR_UINT` readable
+  *  bytes, regardless of the length of the value. The end of the value is found in all eight
+  *  loaded continuation bits at once, instead of a branch per byte; values shorter than eight
+  *  bytes (i.e. almost all) are then decoded without any data-dependent branches.
+  * Returns the position after the value.
+  */
+inline const char * readVarUIntWord(UInt64 & x, const char * istr)
+{
+    UInt64 word;
+    memcpy(&word, istr, 8);
+
+    /// Bits 7, 15, ... are the continuation bits; the first byte with a zero one ends the value.
+    UInt64 non_continuation = ~word & 0x8080808080808080ULL;
+
+    if (unlikely(!non_continuation))
+    {
+        /// A value of eight or nine bytes.
+        return readVarUInt(x, istr, MAX_LENGTH_OF_VAR_UINT);
+    }
+
+    size_t bytes = (__builtin_ctzll(non_continuation) >> 3) + 1;
+
+    /// Keep the bytes of the value (up to and including the terminal one), drop the
+    ///  continuation bits and pack the eight 7-bit groups together pairwise.
+    word &= non_continuation ^ (non_continuation - 1);
+    word &= 0x7F7F7F7F7F7F7F7FULL;
+    word = (word & 0x007F007F007F007FULL) | ((word & 0x7F007F007F007F00ULL) >> 1);
+    word = (word & 0x00003FFF00003FFFULL) | ((word & 0x3FFF00003FFF0000ULL) >> 2);
+    word = (word & 0x000000000FFFFFFFULL) | ((word & 0x0FFFFFFF00000000ULL) >> 4);
+
+    x = word;
+    return istr + bytes;
+}
+
+/** Read a varint from the buffer: through `readVarUIntWord` when the value certainly lies
+  *  within the working buffer, through the byte loop near its end. For loops that decode
+  *  a varint per value (string sizes in the native format).
+  */
+inline void readVarUIntFast(UInt64 & x, ReadBuffer & istr)
+{
+    if (likely(istr.buffer().end() - istr.position() >= static_cast<ssize_t>(MAX_LENGTH_OF_VAR_UINT)))
+        istr.position() = const_cast<char *>(readVarUIntWord(x, istr.position()));
+    else
+        readVarUInt(x, istr);
+}
+
 inline const char * readVarUInt(UInt64 & x, const char * istr, size_t size)
 {
     const char * end = istr + size;
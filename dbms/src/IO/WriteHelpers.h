@@ -156,79 +156,114 @@ inline void writeString(const StringRef & ref, WriteBuffer & buf)
  *  - it is assumed that string is in UTF-8, the invalid UTF-8 is not processed
  *  - all other non-ASCII characters remain as is
  */
+namespace detail
+{
+    /** The position of the first byte that may need escaping in JSON: an ASCII control character,
+      *  the quote, the backslash, the slash, or 0xE2 - the first byte of the U+2028/U+2029
+      *  line separators. Everything before it can be copied in bulk.
+      */
+    inline const char * nextJSONEscapePosition(const char * pos, const char * end)
+    {
+#if __SSE2__
+        for (; pos + 16 <= end; pos += 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+
+            /// c <= 0x1F, done with a saturating subtraction because the comparisons are signed.
+            __m128i is_control = _mm_cmpeq_epi8(_mm_subs_epu8(bytes, _mm_set1_epi8(0x1F)), _mm_setzero_si128());
+
+            __m128i needs_escaping = _mm_or_si128(
+                _mm_or_si128(is_control, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('"'))),
+                _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('/'))),
+                    _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\xE2'))));
+
+            if (UInt16 mask = _mm_movemask_epi8(needs_escaping))
+                return pos + __builtin_ctz(mask);
+        }
+#endif
+        for (; pos < end; ++pos)
+        {
+            UInt8 c = static_cast<UInt8>(*pos);
+            if (c <= 0x1F || c == '"' || c == '\\' || c == '/' || c == 0xE2)
+                break;
+        }
+        return pos;
+    }
+}
+
 inline void writeJSONString(const char * begin, const char * end, WriteBuffer & buf)
 {
     writeChar('"', buf);
-    for (const char * it = begin; it != end; ++it)
+
+    const char * pos = begin;
+    while (pos != end)
     {
-        switch (*it)
+        /// Most strings need no escaping at all - copy the longest clean run in bulk.
+        const char * next_pos = detail::nextJSONEscapePosition(pos, end);
+        buf.write(pos, next_pos - pos);
+        pos = next_pos;
+
+        if (pos == end)
+            break;
+
+        switch (UInt8 c = static_cast<UInt8>(*pos))
         {
             case '\b':
-                writeChar('\\', buf);
-                writeChar('b', buf);
+                writeCString("\\b", buf);
                 break;
             case '\f':
-                writeChar('\\', buf);
-                writeChar('f', buf);
+                writeCString("\\f", buf);
                 break;
             case '\n':
-                writeChar('\\', buf);
-                writeChar('n', buf);
+                writeCString("\\n", buf);
                 break;
             case '\r':
-                writeChar('\\', buf);
-                writeChar('r', buf);
+                writeCString("\\r", buf);
                 break;
             case '\t':
-                writeChar('\\', buf);
-                writeChar('t', buf);
+                writeCString("\\t", buf);
                 break;
             case '\\':
-                writeChar('\\', buf);
-                writeChar('\\', buf);
+                writeCString("\\\\", buf);
                 break;
             case '/':
-                writeChar('\\', buf);
-                writeChar('/', buf);
+                writeCString("\\/", buf);
                 break;
             case '"':
-                writeChar('\\', buf);
-                writeChar('"', buf);
+                writeCString("\\\"", buf);
                 break;
-            default:
-                UInt8 c = *it;
-                if (c <= 0x1F)
-                {
-                    /// Escaping of ASCII control characters.
-
-                    UInt8 higher_half = c >> 4;
-                    UInt8 lower_half = c & 0xF;
-
-                    writeCString("\\u00", buf);
-                    writeChar('0' + higher_half, buf);
-
-                    if (lower_half <= 9)
-                        writeChar('0' + lower_half, buf);
-                    else
-                        writeChar('A' + lower_half - 10, buf);
-                }
-                else if (end - it >= 3 && it[0] == '\xE2' && it[1] == '\x80' && (it[2] == '\xA8' || it[2] == '\xA9'))
+            case 0xE2:
+                if (end - pos >= 3 && pos[1] == '\x80' && (pos[2] == '\xA8' || pos[2] == '\xA9'))
                 {
                     /// This is for compatibility with JavaScript, because unescaped line separators are prohibited in string literals,
                     ///  and these code points are alternative line separators.
 
-                    if (it[2] == '\xA8')
+                    if (pos[2] == '\xA8')
                         writeCString("\\u2028", buf);
-                    if (it[2] == '\xA9')
+                    else
                         writeCString("\\u2029", buf);
 
                     /// Byte sequence is 3 bytes long. We have additional two bytes to skip.
-                    it += 2;
+                    pos += 2;
                 }
                 else
-                    writeChar(*it, buf);
+                    writeChar(*pos, buf);
+                break;
+            default:
+            {
+                /// Escaping of ASCII control characters (all that is left is c <= 0x1F).
+                static const char hex_digits[] = "0123456789ABCDEF";
+
+                writeCString("\\u00", buf);
+                writeChar(hex_digits[c >> 4], buf);
+                writeChar(hex_digits[c & 0xF], buf);
+            }
         }
+
+        ++pos;
     }
+
     writeChar('"', buf);
 }
 
@@ -1,5 +1,6 @@
 #include <IO/createReadBufferFromFileBase.h>
 #include <IO/ReadBufferFromFile.h>
+#include <IO/MMapReadBufferFromFile.h>
 #if !defined(__APPLE__) && !defined(__FreeBSD__)
 #include <IO/ReadBufferAIO.h>
 #endif
@@ -10,6 +11,7 @@ namespace ProfileEvents
 {
     extern const Event CreatedReadBufferOrdinary;
     extern const Event CreatedReadBufferAIO;
+    extern const Event CreatedReadBufferMMap;
 }
 
 namespace DB
@@ -22,10 +24,16 @@ namespace ErrorCodes
 #endif
 
 std::unique_ptr<ReadBufferFromFileBase> createReadBufferFromFileBase(const std::string & filename_, size_t estimated_size,
-        size_t aio_threshold, size_t buffer_size_, int flags_, char * existing_memory_, size_t alignment)
+        size_t aio_threshold, size_t mmap_threshold, size_t buffer_size_, int flags_, char * existing_memory_, size_t alignment)
 {
     if ((aio_threshold == 0) || (estimated_size < aio_threshold))
     {
+        if (mmap_threshold && estimated_size >= mmap_threshold && flags_ == -1)
+        {
+            ProfileEvents::increment(ProfileEvents::CreatedReadBufferMMap);
+            return std::make_unique<MMapReadBufferFromFile>(filename_);
+        }
+
         ProfileEvents::increment(ProfileEvents::CreatedReadBufferOrdinary);
         return std::make_unique<ReadBufferFromFile>(filename_, buffer_size_, flags_, existing_memory_, alignment);
     }
@@ -11,13 +11,17 @@ namespace DB
 /** Create an object to read data from a file.
   * estimated_size - the number of bytes to read
   * aio_threshold - the minimum number of bytes for asynchronous reads
+  * mmap_threshold - the minimum number of bytes for reading through a memory mapping
   *
   * If aio_threshold = 0 or estimated_size < aio_threshold, read operations are executed synchronously.
   * Otherwise, the read operations are performed asynchronously.
+  * When AIO does not apply and estimated_size >= mmap_threshold (> 0), the file is memory mapped instead:
+  *  data is then consumed directly out of the page cache, without being copied into a read buffer.
   */
 std::unique_ptr<ReadBufferFromFileBase> createReadBufferFromFileBase(const std::string & filename_,
         size_t estimated_size,
         size_t aio_threshold,
+        size_t mmap_threshold = 0,
         size_t buffer_size_ = DBMS_DEFAULT_BUFFER_SIZE,
         int flags_ = -1,
         char * existing_memory_ = nullptr,
@@ -302,4 +302,85 @@ static inline StringRef ALWAYS_INLINE serializeKeysToPoolContiguous(
 }
 
 
+/** The key for aggregation by a single String column (see AggregationMethodShortString).
+  * Strings of up to 15 bytes are stored inline: the bytes are placed into the two words,
+  *  padded with zeros, and the highest byte keeps the tag 0x80 | length.
+  * Longer strings are referenced like in StringRef: `low` is the pointer to the bytes
+  *  and `high` is the length. Lengths are way below 2^56, so the highest byte is zero
+  *  and cannot be confused with a tag.
+  * Two inline keys are thus compared as two UInt64s, without touching the heap at all.
+  * The layout assumes little endian, as does the rest of the codebase.
+  */
+struct ShortStringKey
+{
+    UInt64 low = 0;
+    UInt64 high = 0;
+
+    static constexpr size_t MAX_INLINE_SIZE = 15;
+
+    bool isInline() const { return high & (1ULL << 63); }
+    size_t size() const { return isInline() ? (high >> 56) & 0x7F : high; }
+    const char * data() const { return isInline() ? reinterpret_cast<const char *>(this) : reinterpret_cast<const char *>(low); }
+
+    bool operator== (const ShortStringKey & rhs) const
+    {
+        /// Equal strings have equal `high`: for inline keys it holds the tag and the tail bytes,
+        ///  for referenced keys it holds the length.
+        if (high != rhs.high)
+            return false;
+
+        if (isInline())
+            return low == rhs.low;
+
+        return low == rhs.low || 0 == memcmp(data(), rhs.data(), high);
+    }
+
+    bool operator!= (const ShortStringKey & rhs) const { return !(*this == rhs); }
+
+    /// Comparison and assignment with zero - for the empty-cell checks of the hash tables
+    ///  (the generic ZeroTraits; an all-zero key does not represent any string, as even
+    ///  the empty string carries a tag byte).
+    bool operator== (const UInt64 rhs) const { return low == rhs && !high; }
+    bool operator!= (const UInt64 rhs) const { return !(*this == rhs); }
+    ShortStringKey & operator= (const UInt64 rhs) { low = rhs; high = 0; return *this; }
+};
+
+static inline ShortStringKey ALWAYS_INLINE toShortStringKey(const char * data, size_t size)
+{
+    ShortStringKey key;
+
+    if (size <= ShortStringKey::MAX_INLINE_SIZE)
+    {
+        memcpy(&key, data, size);
+        key.high |= (0x80ULL | size) << 56;
+    }
+    else
+    {
+        key.low = reinterpret_cast<UInt64>(data);
+        key.high = size;
+    }
+
+    return key;
+}
+
+struct ShortStringKeyHash
+{
+    size_t operator()(const ShortStringKey & key) const
+    {
+        if (key.isInline())
+            return UInt128HashCRC32()(UInt128(key.low, key.high));
+
+        return StringRefHash()(StringRef(key.data(), key.size()));
+    }
+};
+
+/// With more than 32 bits of hash - for the merging phase of external aggregation.
+struct ShortStringKeyHash64
+{
+    size_t operator()(const ShortStringKey & key) const
+    {
+        return StringRefHash64()(StringRef(key.data(), key.size()));
+    }
+};
+
 }
@@ -21,6 +21,7 @@
 #include <Interpreters/Aggregator.h>
 #include <Common/ClickHouseRevision.h>
 #include <Common/MemoryTracker.h>
+#include <Common/PODArray.h>
 #include <Common/typeid_cast.h>
 #include <Interpreters/config_compile.h>
 
@@ -503,14 +504,19 @@ AggregatedDataVariants::Type Aggregator::chooseAggregationMethod(const ConstColu
     }
 
     /// If all keys fits in N bits, will use hash table with all keys packed (placed contiguously) to single N-bit key.
+    if (all_fixed && keys_bytes <= 2)
+        return AggregatedDataVariants::Type::keys16;
+    if (all_fixed && keys_bytes <= 8)
+        return AggregatedDataVariants::Type::keys64;
     if (all_fixed && keys_bytes <= 16)
         return AggregatedDataVariants::Type::keys128;
     if (all_fixed && keys_bytes <= 32)
         return AggregatedDataVariants::Type::keys256;
 
-    /// If single string key - will use hash table with references to it. Strings itself are stored separately in Arena.
+    /// If single string key - will use hash table where short strings are packed right into the 16-byte key
+    ///  and only longer ones are stored separately in Arena.
     if (params.keys_size == 1 && typeid_cast<const ColumnString *>(nested_key_columns[0]))
-        return AggregatedDataVariants::Type::key_string;
+        return AggregatedDataVariants::Type::key_short_string;
 
     if (params.keys_size == 1 && typeid_cast<const ColumnFixedString *>(nested_key_columns[0]))
         return AggregatedDataVariants::Type::key_fixed_string;
@@ -607,7 +613,28 @@ void NO_INLINE Aggregator::executeImplCase(
 {
     /// NOTE When editing this code, also pay attention to SpecializedAggregator.h.
 
-    /// For all rows.
+    /** For methods with cheap keys, probe the hash table software-pipelined: calculate the hashes
+      *  several rows ahead and prefetch the corresponding cells, so that on tables that do not fit
+      *  in cache, multiple cache misses are serviced in parallel instead of one per row.
+      */
+    static constexpr size_t prefetch_look_ahead = 16;
+    size_t hash_values[prefetch_look_ahead];
+
+    if (Method::prefetch_suitable)
+    {
+        for (size_t i = 0, size = std::min(rows, prefetch_look_ahead); i < size; ++i)
+        {
+            hash_values[i] = method.data.hash(state.getKey(key_columns, params.keys_size, i, key_sizes, keys, *aggregates_pool));
+            method.data.prefetch(hash_values[i]);
+        }
+    }
+
+    /** First pass: find (or create) the aggregation state for every row.
+      * The values are then added in one pass per aggregate function (see below),
+      *  so that each function runs a tight loop instead of one indirect call per row.
+      */
+    PODArray<AggregateDataPtr> places(rows);
+
     typename Method::iterator it;
     typename Method::Key prev_key;
     for (size_t i = 0; i < rows; ++i)
@@ -618,6 +645,20 @@ void NO_INLINE Aggregator::executeImplCase(
         /// Get the key to insert into the hash table.
         typename Method::Key key = state.getKey(key_columns, params.keys_size, i, key_sizes, keys, *aggregates_pool);
 
+        size_t hash_value = 0;
+        if (Method::prefetch_suitable)
+        {
+            hash_value = hash_values[i % prefetch_look_ahead];
+
+            if (i + prefetch_look_ahead < rows)
+            {
+                size_t hash_ahead = method.data.hash(
+                    state.getKey(key_columns, params.keys_size, i + prefetch_look_ahead, key_sizes, keys, *aggregates_pool));
+                method.data.prefetch(hash_ahead);
+                hash_values[i % prefetch_look_ahead] = hash_ahead;
+            }
+        }
+
         if (!no_more_keys)  /// Insert.
         {
             /// Optimization for consecutive identical keys.
@@ -625,11 +666,7 @@ void NO_INLINE Aggregator::executeImplCase(
             {
                 if (i != 0 && key == prev_key)
                 {
-                    /// Add values to the aggregate functions.
-                    AggregateDataPtr value = Method::getAggregateData(it->second);
-                    for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
-                        (*inst->func)(inst->that, value + inst->state_offset, inst->arguments, i, aggregates_pool);
-
+                    places[i] = Method::getAggregateData(it->second);
                     method.onExistingKey(key, keys, *aggregates_pool);
                     continue;
                 }
@@ -637,7 +674,10 @@ void NO_INLINE Aggregator::executeImplCase(
                     prev_key = key;
             }
 
-            method.data.emplace(key, it, inserted);
+            if (Method::prefetch_suitable)
+                method.data.emplace(key, it, inserted, hash_value);
+            else
+                method.data.emplace(key, it, inserted);
         }
         else
         {
@@ -651,6 +691,7 @@ void NO_INLINE Aggregator::executeImplCase(
         /// If the key does not fit, and the data does not need to be aggregated in a separate row, then there's nothing to do.
         if (no_more_keys && overflow && !overflow_row)
         {
+            places[i] = nullptr;
             method.onExistingKey(key, keys, *aggregates_pool);
             continue;
         }
@@ -672,12 +713,12 @@ void NO_INLINE Aggregator::executeImplCase(
         else
             method.onExistingKey(key, keys, *aggregates_pool);
 
-        AggregateDataPtr value = (!no_more_keys || !overflow) ? Method::getAggregateData(it->second) : overflow_row;
-
-        /// Add values to the aggregate functions.
-        for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
-            (*inst->func)(inst->that, value + inst->state_offset, inst->arguments, i, aggregates_pool);
+        places[i] = (!no_more_keys || !overflow) ? Method::getAggregateData(it->second) : overflow_row;
     }
+
+    /// Second pass: add the values to the aggregate functions, one batch per function.
+    for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
+        inst->that->addBatch(rows, places.data(), inst->state_offset, inst->arguments, aggregates_pool);
 }
 
 #ifndef __clang__
@@ -699,12 +740,9 @@ void NO_INLINE Aggregator::executeWithoutKeyImpl(
         agg_count->addDelta(res, rows);
     else
     {
-        for (size_t i = 0; i < rows; ++i)
-        {
-            /// Adding values
-            for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
-                (*inst->func)(inst->that, res + inst->state_offset, inst->arguments, i, arena);
-        }
+        /// Adding values: all rows go into the same state, one batch per aggregate function.
+        for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
+            inst->that->addBatchSinglePlace(rows, res + inst->state_offset, inst->arguments, arena);
     }
 }
 
@@ -2067,6 +2105,58 @@ void Aggregator::mergeStream(const BlockInputStreamPtr & stream, AggregatedDataV
       * - in the case of single-level aggregation, as well as for blocks with "overflowing" values.
       * If there is at least one block with a bucket number greater than zero, then there was a two-level aggregation.
       */
+    bool has_two_level_input = bucket_to_blocks.rbegin()->first > 0;
+
+    /** Blocks without a bucket number come from sources that aggregated with a single-level method.
+      * When the merge is worth parallelizing, scatter them into the same buckets that two-level
+      *  aggregation would produce, so that all the data takes the bucket-parallel path below
+      *  instead of being merged by a single thread at the end.
+      * Not done when max_rows_to_group_by is set: the bucket-parallel path does not support no_more_keys.
+      */
+    if (bucket_to_blocks.count(-1))
+    {
+        bool convertible_to_two_level = false;
+
+    #define M(NAME) \
+        if (method == AggregatedDataVariants::Type::NAME) \
+            convertible_to_two_level = true;
+
+        APPLY_FOR_VARIANTS_CONVERTIBLE_TO_TWO_LEVEL(M)
+    #undef M
+
+        if (convertible_to_two_level && max_threads > 1 && !params.max_rows_to_group_by
+            && (has_two_level_input || total_input_rows > 100000))    /// TODO Make a custom threshold.
+        {
+            LOG_TRACE(log, "Converting single-level blocks of partially aggregated data to two-level.");
+
+            BlocksList & blocks = bucket_to_blocks[-1];
+            BlocksList remaining_blocks;    /// Blocks with "overflowing" values are merged into the common state.
+
+            for (Block & block : blocks)
+            {
+                if (isCancelled())
+                    return;
+
+                if (block.info.is_overflows)
+                {
+                    remaining_blocks.emplace_back(std::move(block));
+                    continue;
+                }
+
+                for (Block & splitted_block : convertBlockToTwoLevel(block))
+                    if (splitted_block)
+                        bucket_to_blocks[splitted_block.info.bucket_num].emplace_back(std::move(splitted_block));
+            }
+
+            blocks.swap(remaining_blocks);
+            if (blocks.empty())
+                bucket_to_blocks.erase(-1);
+
+            if (bucket_to_blocks.empty())
+                return;
+        }
+    }
+
     auto max_bucket = bucket_to_blocks.rbegin()->first;
     size_t has_two_level = max_bucket > 0;
 
@@ -2229,7 +2319,9 @@ Block Aggregator::mergeBlocks(BlocksList & blocks, bool final)
 #define APPLY_FOR_VARIANTS_THAT_MAY_USE_BETTER_HASH_FUNCTION(M) \
         M(key64)             \
         M(key_string)         \
+        M(key_short_string) \
         M(key_fixed_string) \
+        M(keys64)             \
         M(keys128)             \
         M(keys256)             \
         M(concat)             \
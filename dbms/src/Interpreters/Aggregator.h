@@ -63,14 +63,25 @@ using AggregatedDataWithoutKey = AggregateDataPtr;
 using AggregatedDataWithUInt8Key = HashMap<UInt64, AggregateDataPtr, TrivialHash, HashTableFixedGrower<8>>;
 using AggregatedDataWithUInt16Key = HashMap<UInt64, AggregateDataPtr, TrivialHash, HashTableFixedGrower<16>>;
 
-using AggregatedDataWithUInt64Key = HashMap<UInt64, AggregateDataPtr, HashCRC32<UInt64>>;
-using AggregatedDataWithStringKey = HashMapWithSavedHash<StringRef, AggregateDataPtr>;
-using AggregatedDataWithKeys128 = HashMap<UInt128, AggregateDataPtr, UInt128HashCRC32>;
-using AggregatedDataWithKeys256 = HashMap<UInt256, AggregateDataPtr, UInt256HashCRC32>;
-using AggregatedDataHashed = HashMap<UInt128, std::pair<StringRef*, AggregateDataPtr>, UInt128TrivialHash>;
+/** GROUP BY with a handful of distinct keys is common (rollups by a few categories),
+  *  so the single-level hash tables start with a few dozen cells and grow together with
+  *  the observed cardinality: a low-cardinality aggregation works in one cache-resident
+  *  buffer, and the rehashes on the way to a large table are amortized by its final size.
+  * Escalation to the two-level table is driven by the group_by_two_level_threshold settings, as before.
+  * Keys of 1-2 bytes do not take this path - they use directly indexed tables (see key8, key16, keys16).
+  */
+using AggregationHashTableGrower = HashTableGrower<5>;
+
+using AggregatedDataWithUInt64Key = HashMap<UInt64, AggregateDataPtr, HashCRC32<UInt64>, AggregationHashTableGrower>;
+using AggregatedDataWithStringKey = HashMapWithSavedHash<StringRef, AggregateDataPtr, DefaultHash<StringRef>, AggregationHashTableGrower>;
+using AggregatedDataWithShortStringKey = HashMapWithSavedHash<ShortStringKey, AggregateDataPtr, ShortStringKeyHash, AggregationHashTableGrower>;
+using AggregatedDataWithKeys128 = HashMap<UInt128, AggregateDataPtr, UInt128HashCRC32, AggregationHashTableGrower>;
+using AggregatedDataWithKeys256 = HashMap<UInt256, AggregateDataPtr, UInt256HashCRC32, AggregationHashTableGrower>;
+using AggregatedDataHashed = HashMap<UInt128, std::pair<StringRef*, AggregateDataPtr>, UInt128TrivialHash, AggregationHashTableGrower>;
 
 using AggregatedDataWithUInt64KeyTwoLevel = TwoLevelHashMap<UInt64, AggregateDataPtr, HashCRC32<UInt64>>;
 using AggregatedDataWithStringKeyTwoLevel = TwoLevelHashMapWithSavedHash<StringRef, AggregateDataPtr>;
+using AggregatedDataWithShortStringKeyTwoLevel = TwoLevelHashMapWithSavedHash<ShortStringKey, AggregateDataPtr, ShortStringKeyHash>;
 using AggregatedDataWithKeys128TwoLevel = TwoLevelHashMap<UInt128, AggregateDataPtr, UInt128HashCRC32>;
 using AggregatedDataWithKeys256TwoLevel = TwoLevelHashMap<UInt256, AggregateDataPtr, UInt256HashCRC32>;
 using AggregatedDataHashedTwoLevel = TwoLevelHashMap<UInt128, std::pair<StringRef*, AggregateDataPtr>, UInt128TrivialHash>;
@@ -84,6 +95,7 @@ using AggregatedDataHashedTwoLevel = TwoLevelHashMap<UInt128, std::pair<StringRe
 
 using AggregatedDataWithUInt64KeyHash64 = HashMap<UInt64, AggregateDataPtr, DefaultHash<UInt64>>;
 using AggregatedDataWithStringKeyHash64 = HashMapWithSavedHash<StringRef, AggregateDataPtr, StringRefHash64>;
+using AggregatedDataWithShortStringKeyHash64 = HashMapWithSavedHash<ShortStringKey, AggregateDataPtr, ShortStringKeyHash64>;
 using AggregatedDataWithKeys128Hash64 = HashMap<UInt128, AggregateDataPtr, UInt128Hash>;
 using AggregatedDataWithKeys256Hash64 = HashMap<UInt256, AggregateDataPtr, UInt256Hash>;
 
@@ -149,6 +161,11 @@ struct AggregationMethodOneNumber
       */
     static const bool no_consecutive_keys_optimization = false;
 
+    /** The key is cheap to calculate and `getKey` has no side effects on the pool,
+      *  so it pays off to hash the keys a few rows ahead and prefetch the hash table cells.
+      */
+    static const bool prefetch_suitable = true;
+
     /** Insert the key from the hash table into columns.
       */
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
@@ -213,6 +230,7 @@ struct AggregationMethodString
     static void onExistingKey(const Key & key, StringRefs & keys, Arena & pool) {}
 
     static const bool no_consecutive_keys_optimization = false;
+    static const bool prefetch_suitable = true;
 
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
     {
@@ -221,6 +239,76 @@ struct AggregationMethodString
 };
 
 
+/** For the case where there is one string key and values are mostly short.
+  * Strings of up to 15 bytes are packed into the 16-byte key itself (see ShortStringKey),
+  *  so they are neither copied into the arena nor followed through a pointer on comparison.
+  * Longer strings degrade to the behavior of AggregationMethodString.
+  */
+template <typename TData>
+struct AggregationMethodShortString
+{
+    using Data = TData;
+    using Key = typename Data::key_type;
+    using Mapped = typename Data::mapped_type;
+    using iterator = typename Data::iterator;
+    using const_iterator = typename Data::const_iterator;
+
+    Data data;
+
+    AggregationMethodShortString() {}
+
+    template <typename Other>
+    AggregationMethodShortString(const Other & other) : data(other.data) {}
+
+    struct State
+    {
+        const ColumnString::Offsets_t * offsets;
+        const ColumnString::Chars_t * chars;
+
+        void init(ConstColumnPlainPtrs & key_columns)
+        {
+            const IColumn & column = *key_columns[0];
+            const ColumnString & column_string = static_cast<const ColumnString &>(column);
+            offsets = &column_string.getOffsets();
+            chars = &column_string.getChars();
+        }
+
+        Key getKey(
+            const ConstColumnPlainPtrs & key_columns,
+            size_t keys_size,
+            size_t i,
+            const Sizes & key_sizes,
+            StringRefs & keys,
+            Arena & pool) const
+        {
+            return toShortStringKey(
+                reinterpret_cast<const char *>(&(*chars)[i == 0 ? 0 : (*offsets)[i - 1]]),
+                (i == 0 ? (*offsets)[i] : ((*offsets)[i] - (*offsets)[i - 1])) - 1);
+        }
+    };
+
+    static AggregateDataPtr & getAggregateData(Mapped & value)                { return value; }
+    static const AggregateDataPtr & getAggregateData(const Mapped & value)    { return value; }
+
+    static void onNewKey(typename Data::value_type & value, size_t keys_size, size_t i, StringRefs & keys, Arena & pool)
+    {
+        /// Inline keys carry their bytes in the hash table cell itself; only long strings go to the pool.
+        if (!value.first.isInline())
+            value.first.low = reinterpret_cast<UInt64>(pool.insert(value.first.data(), value.first.size()));
+    }
+
+    static void onExistingKey(const Key & key, StringRefs & keys, Arena & pool) {}
+
+    static const bool no_consecutive_keys_optimization = false;
+    static const bool prefetch_suitable = true;
+
+    static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
+    {
+        key_columns[0]->insertData(value.first.data(), value.first.size());
+    }
+};
+
+
 /// For the case where there is one fixed-length string key.
 template <typename TData>
 struct AggregationMethodFixedString
@@ -274,6 +362,7 @@ struct AggregationMethodFixedString
     static void onExistingKey(const Key & key, StringRefs & keys, Arena & pool) {}
 
     static const bool no_consecutive_keys_optimization = false;
+    static const bool prefetch_suitable = true;
 
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
     {
@@ -435,6 +524,7 @@ struct AggregationMethodKeysFixed
     static void onExistingKey(const Key & key, StringRefs & keys, Arena & pool) {}
 
     static const bool no_consecutive_keys_optimization = false;
+    static const bool prefetch_suitable = true;
 
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
     {
@@ -537,6 +627,9 @@ struct AggregationMethodConcat
     /// If the key already was, then it is removed from the pool (overwritten), and the next key can not be compared with it.
     static const bool no_consecutive_keys_optimization = true;
 
+    /// `getKey` places the key into the pool, so it can not be called for rows ahead.
+    static const bool prefetch_suitable = false;
+
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
     {
         insertKeyIntoColumnsImpl(value, key_columns, keys_size, key_sizes);
@@ -622,6 +715,9 @@ struct AggregationMethodSerialized
     /// If the key already was, it is removed from the pool (overwritten), and the next key can not be compared with it.
     static const bool no_consecutive_keys_optimization = true;
 
+    /// `getKey` places the key into the pool, so it can not be called for rows ahead.
+    static const bool prefetch_suitable = false;
+
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
     {
         auto pos = value.first.data;
@@ -678,6 +774,9 @@ struct AggregationMethodHashed
 
     static const bool no_consecutive_keys_optimization = false;
 
+    /// The key itself is a 128-bit hash of the row, too expensive to calculate twice.
+    static const bool prefetch_suitable = false;
+
     static void insertKeyIntoColumns(const typename Data::value_type & value, ColumnPlainPtrs & key_columns, size_t keys_size, const Sizes & key_sizes)
     {
         for (size_t i = 0; i < keys_size; ++i)
@@ -726,7 +825,10 @@ struct AggregatedDataVariants : private boost::noncopyable
     std::unique_ptr<AggregationMethodOneNumber<UInt32, AggregatedDataWithUInt64Key>>        key32;
     std::unique_ptr<AggregationMethodOneNumber<UInt64, AggregatedDataWithUInt64Key>>        key64;
     std::unique_ptr<AggregationMethodString<AggregatedDataWithStringKey>>                    key_string;
+    std::unique_ptr<AggregationMethodShortString<AggregatedDataWithShortStringKey>>            key_short_string;
     std::unique_ptr<AggregationMethodFixedString<AggregatedDataWithStringKey>>                key_fixed_string;
+    std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithUInt16Key>>                keys16;
+    std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithUInt64Key>>                keys64;
     std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithKeys128>>                    keys128;
     std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithKeys256>>                    keys256;
     std::unique_ptr<AggregationMethodHashed<AggregatedDataHashed>>                            hashed;
@@ -736,7 +838,9 @@ struct AggregatedDataVariants : private boost::noncopyable
     std::unique_ptr<AggregationMethodOneNumber<UInt32, AggregatedDataWithUInt64KeyTwoLevel>>    key32_two_level;
     std::unique_ptr<AggregationMethodOneNumber<UInt64, AggregatedDataWithUInt64KeyTwoLevel>>    key64_two_level;
     std::unique_ptr<AggregationMethodString<AggregatedDataWithStringKeyTwoLevel>>                key_string_two_level;
+    std::unique_ptr<AggregationMethodShortString<AggregatedDataWithShortStringKeyTwoLevel>>        key_short_string_two_level;
     std::unique_ptr<AggregationMethodFixedString<AggregatedDataWithStringKeyTwoLevel>>            key_fixed_string_two_level;
+    std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithUInt64KeyTwoLevel>>            keys64_two_level;
     std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithKeys128TwoLevel>>                keys128_two_level;
     std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithKeys256TwoLevel>>                keys256_two_level;
     std::unique_ptr<AggregationMethodHashed<AggregatedDataHashedTwoLevel>>                        hashed_two_level;
@@ -745,7 +849,9 @@ struct AggregatedDataVariants : private boost::noncopyable
 
     std::unique_ptr<AggregationMethodOneNumber<UInt64, AggregatedDataWithUInt64KeyHash64>>    key64_hash64;
     std::unique_ptr<AggregationMethodString<AggregatedDataWithStringKeyHash64>>             key_string_hash64;
+    std::unique_ptr<AggregationMethodShortString<AggregatedDataWithShortStringKeyHash64>>    key_short_string_hash64;
     std::unique_ptr<AggregationMethodFixedString<AggregatedDataWithStringKeyHash64>>         key_fixed_string_hash64;
+    std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithUInt64KeyHash64>>           keys64_hash64;
     std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithKeys128Hash64>>             keys128_hash64;
     std::unique_ptr<AggregationMethodKeysFixed<AggregatedDataWithKeys256Hash64>>             keys256_hash64;
     std::unique_ptr<AggregationMethodConcat<AggregatedDataWithStringKeyHash64>>             concat_hash64;
@@ -764,7 +870,10 @@ struct AggregatedDataVariants : private boost::noncopyable
         M(key32,                false) \
         M(key64,                false) \
         M(key_string,            false) \
+        M(key_short_string,        false) \
         M(key_fixed_string,        false) \
+        M(keys16,                false) \
+        M(keys64,                false) \
         M(keys128,                false) \
         M(keys256,                false) \
         M(hashed,                false) \
@@ -773,7 +882,9 @@ struct AggregatedDataVariants : private boost::noncopyable
         M(key32_two_level,                true) \
         M(key64_two_level,                true) \
         M(key_string_two_level,            true) \
+        M(key_short_string_two_level,    true) \
         M(key_fixed_string_two_level,    true) \
+        M(keys64_two_level,                true) \
         M(keys128_two_level,            true) \
         M(keys256_two_level,            true) \
         M(hashed_two_level,                true) \
@@ -781,7 +892,9 @@ struct AggregatedDataVariants : private boost::noncopyable
         M(serialized_two_level,            true) \
         M(key64_hash64,                false) \
         M(key_string_hash64,        false) \
+        M(key_short_string_hash64,    false) \
         M(key_fixed_string_hash64,    false) \
+        M(keys64_hash64,            false) \
         M(keys128_hash64,            false) \
         M(keys256_hash64,            false) \
         M(concat_hash64,            false) \
@@ -901,7 +1014,9 @@ struct AggregatedDataVariants : private boost::noncopyable
         M(key32)            \
         M(key64)            \
         M(key_string)        \
+        M(key_short_string)    \
         M(key_fixed_string)    \
+        M(keys64)            \
         M(keys128)            \
         M(keys256)            \
         M(hashed)            \
@@ -913,8 +1028,11 @@ struct AggregatedDataVariants : private boost::noncopyable
     #define APPLY_FOR_VARIANTS_NOT_CONVERTIBLE_TO_TWO_LEVEL(M) \
         M(key8)                \
         M(key16)            \
+        M(keys16)            \
         M(key64_hash64)     \
+        M(keys64_hash64)     \
         M(key_string_hash64) \
+        M(key_short_string_hash64) \
         M(key_fixed_string_hash64) \
         M(keys128_hash64)     \
         M(keys256_hash64)     \
@@ -946,7 +1064,9 @@ struct AggregatedDataVariants : private boost::noncopyable
         M(key32_two_level)                \
         M(key64_two_level)                \
         M(key_string_two_level)            \
+        M(key_short_string_two_level)    \
         M(key_fixed_string_two_level)    \
+        M(keys64_two_level)                \
         M(keys128_two_level)            \
         M(keys256_two_level)            \
         M(hashed_two_level)                \
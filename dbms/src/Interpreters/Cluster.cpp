@@ -329,6 +329,9 @@ Cluster::Cluster(Poco::Util::AbstractConfiguration & config, const Settings & se
         throw Exception("There must be either 'node' or 'shard' elements in config", ErrorCodes::EXCESSIVE_ELEMENT_IN_CONFIG);
 
     initMisc();
+
+    if (settings.distributed_connections_warm_count)
+        startConnectionWarming(settings.distributed_connections_warm_count);
 }
 
 
@@ -369,6 +372,55 @@ Cluster::Cluster(const Settings & settings, const std::vector<std::vector<String
     }
 
     initMisc();
+
+    if (settings.distributed_connections_warm_count)
+        startConnectionWarming(settings.distributed_connections_warm_count);
+}
+
+
+Cluster::~Cluster()
+{
+    if (warming_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(warming_mutex);
+            warming_shutdown = true;
+        }
+        warming_cond.notify_one();
+        warming_thread.join();
+    }
+}
+
+
+void Cluster::startConnectionWarming(size_t connections_per_replica)
+{
+    warming_thread = std::thread([this, connections_per_replica]
+    {
+        /// Re-check (ping) the warm connections with this period.
+        static constexpr auto keep_warm_period = std::chrono::seconds(60);
+
+        while (true)
+        {
+            for (const auto & shard_info : shards_info)
+            {
+                if (!shard_info.pool)
+                    continue;
+
+                try
+                {
+                    shard_info.pool->warmUp(connections_per_replica);
+                }
+                catch (...)
+                {
+                    tryLogCurrentException("Cluster");
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(warming_mutex);
+            if (warming_cond.wait_for(lock, keep_warm_period, [this] { return warming_shutdown; }))
+                return;
+        }
+    });
 }
 
 
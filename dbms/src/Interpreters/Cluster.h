@@ -1,6 +1,8 @@
 #pragma once
 
 #include <map>
+#include <thread>
+#include <condition_variable>
 #include <Interpreters/Settings.h>
 #include <Client/ConnectionPool.h>
 #include <Client/ConnectionPoolWithFailover.h>
@@ -27,6 +29,8 @@ public:
     Cluster(const Cluster &) = delete;
     Cluster & operator=(const Cluster &) = delete;
 
+    ~Cluster();
+
     /// is used to set a limit on the size of the timeout
     static Poco::Timespan saturate(const Poco::Timespan & v, const Poco::Timespan & limit);
 
@@ -143,6 +147,18 @@ private:
     /// For getClusterWithSingleShard implementation.
     Cluster(const Cluster & from, size_t index);
 
+    /** Establishes `connections_per_replica` connections to every remote replica in a background
+      *  thread, and then keeps them warm with periodic pings (reconnecting the closed ones),
+      *  so that the first queries after the cluster is (re)built from the config don't pay
+      *  for DNS resolution and handshakes. See the distributed_connections_warm_count setting.
+      */
+    void startConnectionWarming(size_t connections_per_replica);
+
+    std::thread warming_thread;
+    std::mutex warming_mutex;
+    std::condition_variable warming_cond;
+    bool warming_shutdown = false;
+
     String hash_of_addresses;
     /// Description of the cluster shards.
     ShardsInfo shards_info;
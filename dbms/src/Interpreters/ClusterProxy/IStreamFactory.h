@@ -28,6 +28,14 @@ public:
             const String & query, const ASTPtr & query_ast, const Context & context,
             const ThrottlerPtr & throttler,
             BlockInputStreams & res) = 0;
+
+    /// Called after createForShard() was called for all shards of the cluster.
+    /// Allows the factory to create streams serving several shards at once
+    ///  (see distributed_connections_per_stream).
+    virtual void createForPendingShards(
+            const String & /*query*/, const ASTPtr & /*query_ast*/, const Context & /*context*/,
+            const ThrottlerPtr & /*throttler*/,
+            BlockInputStreams & /*res*/) {}
 };
 
 }
@@ -61,6 +61,16 @@ void SelectStreamFactory::createForShard(
 
     auto emplace_remote_stream = [&]()
     {
+        const Settings & settings = context.getSettingsRef();
+
+        /// With shard multiplexing, several shards are served by a single stream (and a single thread).
+        /// Parallel replicas within a shard are not compatible with this mode.
+        if (settings.distributed_connections_per_stream > 1 && settings.max_parallel_replicas <= 1)
+        {
+            pending_shard_pools.emplace_back(shard_info.pool);
+            return;
+        }
+
         auto stream = std::make_shared<RemoteBlockInputStream>(shard_info.pool, query, context, nullptr, throttler, external_tables, processed_stage);
         stream->setPoolMode(PoolMode::GET_MANY);
         stream->setMainTable(main_table);
@@ -179,5 +189,30 @@ void SelectStreamFactory::createForShard(
         emplace_remote_stream();
 }
 
+void SelectStreamFactory::createForPendingShards(
+        const String & query, const ASTPtr & /*query_ast*/,
+        const Context & context, const ThrottlerPtr & throttler,
+        BlockInputStreams & res)
+{
+    if (pending_shard_pools.empty())
+        return;
+
+    size_t shards_per_stream = context.getSettingsRef().distributed_connections_per_stream;
+
+    for (size_t offset = 0; offset < pending_shard_pools.size(); offset += shards_per_stream)
+    {
+        ConnectionPoolWithFailoverPtrs group(
+                pending_shard_pools.begin() + offset,
+                pending_shard_pools.begin() + std::min(offset + shards_per_stream, pending_shard_pools.size()));
+
+        auto stream = std::make_shared<RemoteBlockInputStream>(
+                std::move(group), query, context, nullptr, throttler, external_tables, processed_stage);
+        stream->setMainTable(main_table);
+        res.emplace_back(std::move(stream));
+    }
+
+    pending_shard_pools.clear();
+}
+
 }
 }
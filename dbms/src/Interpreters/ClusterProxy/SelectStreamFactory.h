@@ -3,6 +3,7 @@
 #include <Interpreters/ClusterProxy/IStreamFactory.h>
 #include <Core/QueryProcessingStage.h>
 #include <Storages/IStorage.h>
+#include <Client/ConnectionPoolWithFailover.h>
 
 namespace DB
 {
@@ -24,10 +25,18 @@ public:
             const Context & context, const ThrottlerPtr & throttler,
             BlockInputStreams & res) override;
 
+    virtual void createForPendingShards(
+            const String & query, const ASTPtr & query_ast,
+            const Context & context, const ThrottlerPtr & throttler,
+            BlockInputStreams & res) override;
+
 private:
     QueryProcessingStage::Enum processed_stage;
     QualifiedTableName main_table;
     const Tables & external_tables;
+
+    /// Pools of the remote shards that will be served by common streams (see distributed_connections_per_stream).
+    ConnectionPoolWithFailoverPtrs pending_shard_pools;
 };
 
 }
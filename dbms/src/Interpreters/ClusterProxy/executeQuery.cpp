@@ -62,6 +62,8 @@ BlockInputStreams executeQuery(
     for (const auto & shard_info : cluster->getShardsInfo())
         stream_factory.createForShard(shard_info, query, query_ast, new_context, throttler, res);
 
+    stream_factory.createForPendingShards(query, query_ast, new_context, throttler, res);
+
     return res;
 }
 
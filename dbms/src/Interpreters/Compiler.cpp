@@ -45,6 +45,22 @@ Compiler::Compiler(const std::string & path_, size_t threads)
     }
 
     LOG_INFO(log, "Having " << files.size() << " compiled files from previous start.");
+
+    /// Open them in the background, so that the first queries with these signatures don't pay for dlopen.
+    if (!files.empty())
+    {
+        pool.schedule([this]
+        {
+            try
+            {
+                preloadCachedLibraries();
+            }
+            catch (...)
+            {
+                tryLogCurrentException("Compiler");
+            }
+        });
+    }
 }
 
 Compiler::~Compiler()
@@ -77,6 +93,13 @@ static std::string hashedKeyToFileName(Compiler::HashedKey hashed_key)
 }
 
 
+static bool fileNameToHashedKey(const std::string & file_name, Compiler::HashedKey & res)
+{
+    ReadBufferFromString in(file_name);
+    return tryReadIntText(res.low, in) && checkChar('_', in) && tryReadIntText(res.high, in) && in.eof();
+}
+
+
 SharedLibraryPtr Compiler::getOrCount(
     const std::string & key,
     UInt32 min_count_to_compile,
@@ -153,7 +176,7 @@ SharedLibraryPtr Compiler::getOrCount(
             {
                 {
                     ext::unlock_guard<std::mutex> unlock(mutex);
-                    compile(hashed_key, file_name, additional_compiler_flags, get_code, on_ready);
+                    compile(hashed_key, file_name, key, additional_compiler_flags, get_code, on_ready);
                 }
 
                 return libraries[hashed_key];
@@ -164,7 +187,7 @@ SharedLibraryPtr Compiler::getOrCount(
                 {
                     try
                     {
-                        compile(hashed_key, file_name, additional_compiler_flags, get_code, on_ready);
+                        compile(hashed_key, file_name, key, additional_compiler_flags, get_code, on_ready);
                     }
                     catch (...)
                     {
@@ -181,6 +204,57 @@ SharedLibraryPtr Compiler::getOrCount(
 }
 
 
+void Compiler::preloadCachedLibraries()
+{
+    Files files_to_load;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        files_to_load = files;
+    }
+
+    size_t loaded = 0;
+
+    for (const auto & file_name : files_to_load)
+    {
+        HashedKey hashed_key;
+        if (!fileNameToHashedKey(file_name, hashed_key))
+            continue;   /// Some foreign file in the build directory.
+
+        std::string so_file_path = path + '/' + file_name + ".so";
+
+        SharedLibraryPtr lib;
+
+        try
+        {
+            lib = std::make_shared<SharedLibrary>(so_file_path);
+        }
+        catch (const Exception & e)
+        {
+            if (e.code() != ErrorCodes::CANNOT_DLOPEN)
+                throw;
+
+            /// As in `getOrCount`: remove the broken file, it will be recompiled on next attempt.
+            tryLogCurrentException(log);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            files.erase(file_name);
+            Poco::File(so_file_path).remove();
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            /// The library could have been opened by a concurrent query - keep the already open one.
+            libraries.emplace(hashed_key, lib);
+        }
+
+        ++loaded;
+    }
+
+    LOG_INFO(log, "Preloaded " << loaded << " compiled libraries.");
+}
+
+
 /// This will guarantee that code will compile only when version of headers match version of running server.
 static void addCodeToAssertHeadersMatch(WriteBuffer & out)
 {
@@ -195,6 +269,7 @@ static void addCodeToAssertHeadersMatch(WriteBuffer & out)
 void Compiler::compile(
     HashedKey hashed_key,
     std::string file_name,
+    const std::string & key,
     const std::string & additional_compiler_flags,
     CodeGenerator get_code,
     ReadyCallback on_ready)
@@ -256,6 +331,14 @@ void Compiler::compile(
     Poco::File(cpp_file_path).remove();
 
     Poco::File(so_tmp_file_path).renameTo(so_file_path);
+
+    /// Persist the plain-text signature next to the library: together they form an on-disk
+    ///  signature -> library index, which deploy tooling and a human can inspect.
+    {
+        WriteBufferFromFile out(prefix + ".key");
+        out << key;
+    }
+
     SharedLibraryPtr lib(new SharedLibrary(so_file_path));
 
     {
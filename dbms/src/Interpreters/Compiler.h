@@ -55,6 +55,13 @@ public:
         CodeGenerator get_code,
         ReadyCallback on_ready);
 
+    /** Open (dlopen) all compiled libraries left from previous runs, so that queries don't pay for it.
+      * Called in the background at startup; also available as SYSTEM PRELOAD COMPILED EXPRESSIONS,
+      *  to warm the cache after deploying precompiled libraries.
+      * Broken files are removed, as in `getOrCount` - they will be recompiled on next attempt.
+      */
+    void preloadCachedLibraries();
+
 private:
     using Counts = std::unordered_map<HashedKey, UInt32, UInt128Hash>;
     using Libraries = std::unordered_map<HashedKey, SharedLibraryPtr, UInt128Hash>;
@@ -80,6 +87,7 @@ private:
     void compile(
         HashedKey hashed_key,
         std::string file_name,
+        const std::string & key,
         const std::string & additional_compiler_flags,
         CodeGenerator get_code,
         ReadyCallback on_ready);
@@ -21,6 +21,7 @@
 #include <Storages/MergeTree/BackgroundProcessingPool.h>
 #include <Storages/MergeTree/ReshardingWorker.h>
 #include <Storages/MergeTree/MergeList.h>
+#include <Storages/MergeTree/MergeScheduler.h>
 #include <Storages/MergeTree/MergeTreeSettings.h>
 #include <Storages/CompressionMethodSelector.h>
 #include <Interpreters/Settings.h>
@@ -35,8 +36,12 @@
 #include <Interpreters/SystemLog.h>
 #include <Interpreters/QueryLog.h>
 #include <Interpreters/PartLog.h>
+#include <Interpreters/TraceLog.h>
+#include <Interpreters/TraceCollector.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/DNSCache.h>
+#include <Interpreters/QueryResultCache.h>
+#include <Interpreters/SetCache.h>
 #include <IO/ReadBufferFromFile.h>
 #include <IO/UncompressedCache.h>
 #include <Parsers/ASTCreateQuery.h>
@@ -79,6 +84,7 @@ namespace ErrorCodes
     extern const int TABLE_SIZE_EXCEEDS_MAX_DROP_SIZE_LIMIT;
     extern const int SESSION_NOT_FOUND;
     extern const int SESSION_IS_LOCKED;
+    extern const int UNKNOWN_PREPARED_STATEMENT;
 }
 
 
@@ -116,8 +122,11 @@ struct ContextShared
     Quotas quotas;                                          /// Known quotas for resource use.
     mutable UncompressedCachePtr uncompressed_cache;        /// The cache of decompressed blocks.
     mutable MarkCachePtr mark_cache;                        /// Cache of marks in compressed files.
+    mutable QueryResultCachePtr query_result_cache;         /// Cache of results of SELECT queries.
+    mutable SetCachePtr set_cache;                          /// Cache of sets built from IN (subquery).
     ProcessList process_list;                               /// Executing queries at the moment.
     MergeList merge_list;                                   /// The list of executable merge (for (Replicated)?MergeTree)
+    MergeScheduler merge_scheduler;                         /// Limits background merges while foreground queries are running.
     ViewDependencies view_dependencies;                     /// Current dependencies
     ConfigurationPtr users_config;                          /// Config with the users, profiles and quotas sections.
     InterserverIOHandler interserver_io_handler;            /// Handler for interserver communication.
@@ -276,6 +285,9 @@ const ProcessList & Context::getProcessList() const
 MergeList & Context::getMergeList()                                             { return shared->merge_list; }
 const MergeList & Context::getMergeList() const                                 { return shared->merge_list; }
 
+MergeScheduler & Context::getMergeScheduler()                                   { return shared->merge_scheduler; }
+const MergeScheduler & Context::getMergeScheduler() const                       { return shared->merge_scheduler; }
+
 
 const Databases Context::getDatabases() const
 {
@@ -884,6 +896,22 @@ void Context::setSettings(const Settings & settings_)
 }
 
 
+void Context::setPreparedStatement(const String & statement_id, const ASTPtr & ast)
+{
+    /// Re-registering an id simply replaces the template.
+    prepared_statements[statement_id] = ast;
+}
+
+
+ASTPtr Context::getPreparedStatement(const String & statement_id) const
+{
+    auto it = prepared_statements.find(statement_id);
+    if (it == prepared_statements.end())
+        throw Exception("Unknown prepared statement " + statement_id, ErrorCodes::UNKNOWN_PREPARED_STATEMENT);
+    return it->second;
+}
+
+
 void Context::setSetting(const String & name, const Field & value)
 {
     auto lock = getLock();
@@ -1105,6 +1133,16 @@ ProcessList::Element * Context::getProcessListElement() const
     return process_list_elem;
 }
 
+void Context::setExplainInfo(ExplainInfo * info)
+{
+    explain_info = info;
+}
+
+ExplainInfo * Context::getExplainInfo() const
+{
+    return explain_info;
+}
+
 
 void Context::setUncompressedCache(size_t max_size_in_bytes)
 {
@@ -1158,6 +1196,58 @@ void Context::dropMarkCache() const
 }
 
 
+void Context::setQueryResultCache(size_t max_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->query_result_cache)
+        throw Exception("Query result cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->query_result_cache = std::make_shared<QueryResultCache>(max_size_in_bytes);
+}
+
+
+QueryResultCachePtr Context::getQueryResultCache() const
+{
+    auto lock = getLock();
+    return shared->query_result_cache;
+}
+
+
+void Context::dropQueryResultCache() const
+{
+    auto lock = getLock();
+    if (shared->query_result_cache)
+        shared->query_result_cache->reset();
+}
+
+
+void Context::setSetCache(size_t max_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->set_cache)
+        throw Exception("Set cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->set_cache = std::make_shared<SetCache>(max_size_in_bytes);
+}
+
+
+SetCachePtr Context::getSetCache() const
+{
+    auto lock = getLock();
+    return shared->set_cache;
+}
+
+
+void Context::dropSetCache() const
+{
+    auto lock = getLock();
+    if (shared->set_cache)
+        shared->set_cache->reset();
+}
+
+
 void Context::dropCaches() const
 {
     auto lock = getLock();
@@ -1167,6 +1257,12 @@ void Context::dropCaches() const
 
     if (shared->mark_cache)
         shared->mark_cache->reset();
+
+    if (shared->query_result_cache)
+        shared->query_result_cache->reset();
+
+    if (shared->set_cache)
+        shared->set_cache->reset();
 }
 
 BackgroundProcessingPool & Context::getBackgroundPool()
@@ -1384,6 +1480,42 @@ PartLog * Context::getPartLog(const String & database, const String & table)
 }
 
 
+TraceLog * Context::getTraceLog()
+{
+    auto lock = getLock();
+
+    auto & config = getConfigRef();
+    if (!config.has("trace_log"))
+        return nullptr;
+
+    /// System logs are shutdown
+    if (!system_logs)
+        return nullptr;
+
+    if (!system_logs->trace_log)
+    {
+        if (shared->shutdown_called)
+            throw Exception("Logical error: trace log should be destroyed before tables shutdown", ErrorCodes::LOGICAL_ERROR);
+
+        if (!global_context)
+            throw Exception("Logical error: no global context for trace log", ErrorCodes::LOGICAL_ERROR);
+
+        String database = config.getString("trace_log.database", "system");
+        String table = config.getString("trace_log.table", "trace_log");
+        size_t flush_interval_milliseconds = config.getUInt64(
+                "trace_log.flush_interval_milliseconds", DEFAULT_QUERY_LOG_FLUSH_INTERVAL_MILLISECONDS);
+
+        system_logs->trace_log = std::make_unique<TraceLog>(*global_context, database, table,
+                "MergeTree(event_date, event_time, 1024)", flush_interval_milliseconds);
+
+        /// The collector feeds the samples from the signal handlers of QueryProfiler into the log.
+        system_logs->trace_collector = std::make_unique<TraceCollector>(*system_logs->trace_log);
+    }
+
+    return system_logs->trace_log.get();
+}
+
+
 CompressionMethod Context::chooseCompressionMethod(size_t part_size, double part_size_ratio) const
 {
     auto lock = getLock();
@@ -39,17 +39,22 @@ class InterserverIOHandler;
 class BackgroundProcessingPool;
 class ReshardingWorker;
 class MergeList;
+class MergeScheduler;
 class Cluster;
 class Compiler;
 class MarkCache;
 class UncompressedCache;
+class QueryResultCache;
+class SetCache;
 class ProcessList;
 struct ProcessListElement;
+struct ExplainInfo;
 class Macros;
 struct Progress;
 class Clusters;
 class QueryLog;
 class PartLog;
+class TraceLog;
 struct MergeTreeSettings;
 class IDatabase;
 class DDLGuard;
@@ -96,10 +101,12 @@ private:
     using ProgressCallback = std::function<void(const Progress & progress)>;
     ProgressCallback progress_callback;                 /// Callback for tracking progress of query execution.
     ProcessListElement * process_list_elem = nullptr;   /// For tracking total resource usage for query.
+    ExplainInfo * explain_info = nullptr;               /// For EXPLAIN queries: where storages record index selection statistics.
 
     String default_format;  /// Format, used when server formats data by itself and if query does not have FORMAT specification.
                             /// Thus, used in HTTP interface. If not specified - then some globally default format is used.
     Tables external_tables;                 /// Temporary tables.
+    std::unordered_map<String, ASTPtr> prepared_statements;     /// Parsed query templates with ?N placeholders, registered per connection.
     Context * session_context = nullptr;    /// Session context or nullptr. Could be equal to this.
     Context * global_context = nullptr;     /// Global context or nullptr. Could be equal to this.
     SystemLogsPtr system_logs;              /// Used to log queries and operations on parts
@@ -199,6 +206,10 @@ public:
     Settings getSettings() const;
     void setSettings(const Settings & settings_);
 
+    /// Prepared statements: query templates with ?N placeholders, parsed once and executed many times.
+    void setPreparedStatement(const String & statement_id, const ASTPtr & ast);
+    ASTPtr getPreparedStatement(const String & statement_id) const;     /// Throws if there is no such statement.
+
     Limits getLimits() const;
 
     /// Set a setting by name.
@@ -272,6 +283,11 @@ public:
     /// Can return nullptr if the query was not inserted into the ProcessList.
     ProcessListElement * getProcessListElement() const;
 
+    /// Set in InterpreterExplainQuery. Storages append index selection statistics there while the pipeline is being built.
+    void setExplainInfo(ExplainInfo * info);
+    /// Returns nullptr for ordinary (non-EXPLAIN) queries.
+    ExplainInfo * getExplainInfo() const;
+
     /// List all queries.
     ProcessList & getProcessList();
     const ProcessList & getProcessList() const;
@@ -279,6 +295,9 @@ public:
     MergeList & getMergeList();
     const MergeList & getMergeList() const;
 
+    MergeScheduler & getMergeScheduler();
+    const MergeScheduler & getMergeScheduler() const;
+
     void setZooKeeper(std::shared_ptr<zkutil::ZooKeeper> zookeeper);
     /// If the current session is expired at the time of the call, synchronously creates and returns a new session with the startNewSession() call.
     std::shared_ptr<zkutil::ZooKeeper> getZooKeeper() const;
@@ -295,6 +314,16 @@ public:
     std::shared_ptr<MarkCache> getMarkCache() const;
     void dropMarkCache() const;
 
+    /// Create a cache of results of SELECT queries of specified size. This can be done only once.
+    void setQueryResultCache(size_t max_size_in_bytes);
+    std::shared_ptr<QueryResultCache> getQueryResultCache() const;
+    void dropQueryResultCache() const;
+
+    /// Create a cache of sets built from IN (subquery) of specified size. This can be done only once.
+    void setSetCache(size_t max_size_in_bytes);
+    std::shared_ptr<SetCache> getSetCache() const;
+    void dropSetCache() const;
+
     /** Clear the caches of the uncompressed blocks and marks.
       * This is usually done when renaming tables, changing the type of columns, deleting a table.
       *  - since caches are linked to file names, and become incorrect.
@@ -322,6 +351,10 @@ public:
     /// Returns an object used to log opertaions with parts if it possible.
     /// Provide table name to make required cheks.
     PartLog * getPartLog(const String & database, const String & table);
+
+    /// Returns the log of stack trace samples of the query profiler, if it is configured
+    ///  (the trace_log section in the server config). Also starts the collector of the samples.
+    TraceLog * getTraceLog();
     const MergeTreeSettings & getMergeTreeSettings();
 
     /// Prevents DROP TABLE if its size is greater than max_size (50GB by default, max_size=0 turn off this check)
@@ -43,6 +43,10 @@ DictionaryPtr DictionaryFactory::create(const std::string & name, Poco::Util::Ab
 
     const bool require_nonempty = config.getBool(config_prefix + ".require_nonempty", false);
 
+    /// A local file with the data of the last successful load, to serve from at server start
+    ///  instead of rebuilding from the source. Supported by the fully loaded layouts.
+    const auto snapshot_path = config.getString(config_prefix + ".snapshot_path", "");
+
     const auto & layout_type = keys.front();
 
     if ("range_hashed" == layout_type)
@@ -104,11 +108,19 @@ DictionaryPtr DictionaryFactory::create(const std::string & name, Poco::Util::Ab
 
         if ("flat" == layout_type)
         {
-            return std::make_unique<FlatDictionary>(name, dict_struct, std::move(source_ptr), dict_lifetime, require_nonempty);
+            return std::make_unique<FlatDictionary>(name, dict_struct, std::move(source_ptr), dict_lifetime, require_nonempty,
+                snapshot_path);
         }
         else if ("hashed" == layout_type)
         {
-            return std::make_unique<HashedDictionary>(name, dict_struct, std::move(source_ptr), dict_lifetime, require_nonempty);
+            return std::make_unique<HashedDictionary>(name, dict_struct, std::move(source_ptr), dict_lifetime, require_nonempty,
+                false, snapshot_path);
+        }
+        else if ("sparse_hashed" == layout_type)
+        {
+            /// Same as 'hashed', but the tables are filled denser: less memory, slightly slower lookups.
+            return std::make_unique<HashedDictionary>(name, dict_struct, std::move(source_ptr), dict_lifetime, require_nonempty,
+                true, snapshot_path);
         }
         else if ("cache" == layout_type)
         {
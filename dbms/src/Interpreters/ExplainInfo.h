@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+/** Index selection statistics, collected while the pipeline of an EXPLAIN query is being built.
+  * A pointer to this structure is attached to the query context (see Context::setExplainInfo);
+  *  when it is set, MergeTreeDataSelectExecutor appends one entry per table it selects data from.
+  */
+struct ExplainInfo
+{
+    struct TableReadInfo
+    {
+        String database;
+        String table;
+
+        size_t parts_by_date = 0;   /// Parts left after filtering by the minmax (date) index.
+        size_t parts_by_key = 0;    /// Parts left after filtering by the primary key.
+        size_t ranges = 0;
+        size_t marks = 0;
+        size_t rows_approx = 0;     /// Upper bound: selected marks multiplied by the index granularity.
+
+        String key_condition;
+        String skip_index_condition;
+        String minmax_index_condition;
+        String prewhere_column;     /// Empty if there is no PREWHERE (it could have been moved there from WHERE by the optimizer).
+    };
+
+    std::vector<TableReadInfo> table_reads;
+};
+
+}
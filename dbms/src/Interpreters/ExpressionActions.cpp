@@ -1,18 +1,27 @@
 #include <Common/ProfileEvents.h>
 #include <Interpreters/ExpressionActions.h>
 #include <Interpreters/Join.h>
+#include <Interpreters/Compiler.h>
 #include <Columns/ColumnsNumber.h>
 #include <Columns/ColumnArray.h>
+#include <Columns/ColumnConst.h>
+#include <Columns/ColumnsCommon.h>
 #include <Common/typeid_cast.h>
+#include <Common/SharedLibrary.h>
 #include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypesNumber.h>
 #include <Functions/FunctionFactory.h>
 #include <Functions/IFunction.h>
+#include <IO/WriteHelpers.h>
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 
 namespace ProfileEvents
 {
     extern const Event FunctionExecute;
+    extern const Event CompiledFunctionChainExecute;
 }
 
 namespace DB
@@ -30,6 +39,149 @@ namespace ErrorCodes
 }
 
 
+/** A maximal run of consecutive APPLY_FUNCTION actions fused into one loop compiled at runtime.
+  * The loop reads the input columns once and keeps all intermediate results in registers,
+  *  materializing only the results that are visible outside of the run.
+  */
+struct CompiledFunctionChain
+{
+    using Loop = void (*)(size_t rows, const void ** inputs, void ** outputs);
+
+    /// The original actions. Interpreted while the library is not ready yet and when the runtime
+    ///  columns do not match the expected types (e.g. a column turned out to be constant).
+    std::vector<ExpressionAction> fallback_actions;
+
+    /// Results of the fallback actions that are not visible outside of the chain (erased after interpreting).
+    Names intermediate_names;
+
+    /// Non-constant numeric columns the compiled loop reads.
+    NamesAndTypesList input_columns;
+
+    /// Results the rest of the expression needs, in the order the compiled loop writes them.
+    NamesAndTypesList output_columns;
+
+    SharedLibraryPtr library;
+    Loop compiled_loop = nullptr;    /// Is set (possibly from another thread) when the compilation finishes.
+};
+
+
+namespace
+{
+
+/// Numeric types over which chains of functions could be fused into compiled loops.
+#define FOR_FUSIBLE_NUMERIC_TYPES(M) \
+    M(UInt8, uint8_t) \
+    M(UInt16, uint16_t) \
+    M(UInt32, uint32_t) \
+    M(UInt64, uint64_t) \
+    M(Int8, int8_t) \
+    M(Int16, int16_t) \
+    M(Int32, int32_t) \
+    M(Int64, int64_t) \
+    M(Float32, float) \
+    M(Float64, double)
+
+/// The C++ spelling of a numeric type for the generated code, or nullptr if the type is not fusible.
+const char * numericTypeToCpp(const IDataType & type)
+{
+#define M(TYPE, CPP) \
+    if (typeid_cast<const DataType##TYPE *>(&type)) \
+        return #CPP;
+    FOR_FUSIBLE_NUMERIC_TYPES(M)
+#undef M
+    return nullptr;
+}
+
+/// Pointer to the raw data of a full (non-constant) numeric column, or nullptr if it is of unexpected type.
+const void * getRawDataOfNumericColumn(const IColumn & column, const IDataType & type)
+{
+#define M(TYPE, CPP) \
+    if (typeid_cast<const DataType##TYPE *>(&type)) \
+    { \
+        const auto * concrete = typeid_cast<const Column##TYPE *>(&column); \
+        return concrete ? static_cast<const void *>(&concrete->getData()[0]) : nullptr; \
+    }
+    FOR_FUSIBLE_NUMERIC_TYPES(M)
+#undef M
+    return nullptr;
+}
+
+/// Create a numeric column for a result of the compiled loop and return the pointer to its raw data.
+ColumnPtr createNumericColumn(const IDataType & type, size_t rows, void *& data)
+{
+#define M(TYPE, CPP) \
+    if (typeid_cast<const DataType##TYPE *>(&type)) \
+    { \
+        auto concrete = std::make_shared<Column##TYPE>(rows); \
+        data = static_cast<void *>(&concrete->getData()[0]); \
+        return concrete; \
+    }
+    FOR_FUSIBLE_NUMERIC_TYPES(M)
+#undef M
+    return nullptr;
+}
+
+/** The per-row expression for a function from the fusible subset; empty string if the function is not supported.
+  * Must match the semantics of the corresponding IFunction implementations for numeric arguments.
+  */
+String generateFusedExpression(const String & function_name, const Strings & args, const String & result_cpp_type)
+{
+    auto cast = [&result_cpp_type] (const String & arg) { return "static_cast<" + result_cpp_type + ">(" + arg + ")"; };
+
+    if (args.size() == 2)
+    {
+        /// Arithmetic is performed in the result type, same as the *Impl templates in FunctionsArithmetic.h.
+        if (function_name == "plus")
+            return cast(args[0]) + " + " + cast(args[1]);
+        if (function_name == "minus")
+            return cast(args[0]) + " - " + cast(args[1]);
+        if (function_name == "multiply")
+            return cast(args[0]) + " * " + cast(args[1]);
+        if (function_name == "divide")
+            return cast(args[0]) + " / " + cast(args[1]);
+
+        /// Comparisons rely on the usual arithmetic conversions, same as the instantiations in FunctionsComparison.h.
+        if (function_name == "equals")
+            return "static_cast<uint8_t>(" + args[0] + " == " + args[1] + ")";
+        if (function_name == "notEquals")
+            return "static_cast<uint8_t>(" + args[0] + " != " + args[1] + ")";
+        if (function_name == "less")
+            return "static_cast<uint8_t>(" + args[0] + " < " + args[1] + ")";
+        if (function_name == "greater")
+            return "static_cast<uint8_t>(" + args[0] + " > " + args[1] + ")";
+        if (function_name == "lessOrEquals")
+            return "static_cast<uint8_t>(" + args[0] + " <= " + args[1] + ")";
+        if (function_name == "greaterOrEquals")
+            return "static_cast<uint8_t>(" + args[0] + " >= " + args[1] + ")";
+    }
+
+    if (args.size() == 1)
+    {
+        if (function_name == "negate")
+            return "-" + cast(args[0]);
+        if (function_name == "not")
+            return "static_cast<uint8_t>(" + args[0] + " == 0)";
+    }
+
+    if (args.size() >= 2 && (function_name == "and" || function_name == "or"))
+    {
+        const char * op = function_name == "and" ? " && " : " || ";
+        String res = "static_cast<uint8_t>(";
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            if (i)
+                res += op;
+            res += "(" + args[i] + " != 0)";
+        }
+        return res + ")";
+    }
+
+    return {};
+}
+
+}
+
+
 Names ExpressionAction::getNeededColumns() const
 {
     Names res = argument_names;
@@ -322,6 +474,12 @@ void ExpressionAction::execute(Block & block) const
     {
         case APPLY_FUNCTION:
         {
+            if (lazy_and_arguments)
+            {
+                executeShortCircuitAnd(block);
+                break;
+            }
+
             ColumnNumbers arguments(argument_names.size());
             for (size_t i = 0; i < argument_names.size(); ++i)
             {
@@ -347,6 +505,69 @@ void ExpressionAction::execute(Block & block) const
             break;
         }
 
+        case APPLY_FUNCTION_CHAIN:
+        {
+            const size_t rows = block.rows();
+            CompiledFunctionChain::Loop loop = function_chain->compiled_loop;
+
+            bool executed = false;
+            if (loop && rows)
+            {
+                /// Check that the runtime columns are what the loop was compiled for
+                ///  (a column could have turned out to be constant); otherwise interpret.
+                std::vector<const void *> inputs;
+                bool suitable = true;
+                for (const auto & input : function_chain->input_columns)
+                {
+                    if (!block.has(input.name))
+                    {
+                        suitable = false;
+                        break;
+                    }
+
+                    const void * data = getRawDataOfNumericColumn(*block.getByName(input.name).column, *input.type);
+                    if (!data)
+                    {
+                        suitable = false;
+                        break;
+                    }
+
+                    inputs.push_back(data);
+                }
+
+                if (suitable)
+                {
+                    std::vector<void *> outputs;
+                    ColumnsWithTypeAndName result_columns;
+                    for (const auto & output : function_chain->output_columns)
+                    {
+                        void * data = nullptr;
+                        ColumnPtr column = createNumericColumn(*output.type, rows, data);
+                        outputs.push_back(data);
+                        result_columns.emplace_back(column, output.type, output.name);
+                    }
+
+                    ProfileEvents::increment(ProfileEvents::CompiledFunctionChainExecute);
+                    loop(rows, &inputs[0], &outputs[0]);
+
+                    for (auto & column : result_columns)
+                        block.insert(std::move(column));
+
+                    executed = true;
+                }
+            }
+
+            if (!executed)
+            {
+                for (const auto & fallback : function_chain->fallback_actions)
+                    fallback.execute(block);
+                for (const auto & name : function_chain->intermediate_names)
+                    block.erase(name);
+            }
+
+            break;
+        }
+
         case ARRAY_JOIN:
         {
             if (array_joined_columns.empty())
@@ -455,6 +676,118 @@ void ExpressionAction::execute(Block & block) const
 }
 
 
+void ExpressionAction::executeShortCircuitAnd(Block & block) const
+{
+    size_t rows = block.rows();
+
+    /// All the arguments are known to have the plain UInt8 type (see ExpressionActions::optimizeShortCircuitAnd),
+    ///  but any of them can unexpectedly turn out to be constant at run time
+    ///  (a function could return a constant for non-constant arguments).
+    /// In unclear situations evaluate everything, as without the optimization.
+    auto execute_fully = [&]
+    {
+        for (const auto & argument : lazy_and_arguments->arguments)
+            for (const auto & lazy_action : argument.actions)
+                lazy_action.execute(block);
+
+        ColumnNumbers arguments(argument_names.size());
+        for (size_t i = 0; i < argument_names.size(); ++i)
+            arguments[i] = block.getPositionByName(argument_names[i]);
+
+        size_t num_columns_without_result = block.columns();
+        block.insert({ nullptr, result_type, result_name});
+
+        ProfileEvents::increment(ProfileEvents::FunctionExecute);
+        function->execute(block, arguments, num_columns_without_result);
+
+        for (const auto & argument : lazy_and_arguments->arguments)
+            for (const auto & lazy_action : argument.actions)
+                block.erase(lazy_action.result_name);
+    };
+
+    std::vector<char> is_lazy(argument_names.size(), false);
+    for (const auto & argument : lazy_and_arguments->arguments)
+        is_lazy[argument.argument_index] = true;
+
+    auto col_res = std::make_shared<ColumnUInt8>(rows, 1);
+    IColumn::Filter & filter = col_res->getData();
+
+    bool all_false = false;
+
+    /// Combine the masks of the eagerly computed arguments.
+    for (size_t i = 0; i < argument_names.size(); ++i)
+    {
+        if (is_lazy[i])
+            continue;
+
+        ColumnPtr column = block.getByName(argument_names[i]).column;
+
+        if (column->isConst())
+        {
+            if (!static_cast<const ColumnConst &>(*column).getValue<UInt8>())
+                all_false = true;
+            continue;
+        }
+
+        const ColumnUInt8 * column_vec = typeid_cast<const ColumnUInt8 *>(column.get());
+        if (!column_vec)
+            return execute_fully();
+
+        const auto & data = column_vec->getData();
+        for (size_t j = 0; j < rows; ++j)
+            filter[j] = filter[j] && data[j];
+    }
+
+    /// Evaluate each lazy argument over the surviving rows only and scatter its mask back.
+    for (const auto & argument : lazy_and_arguments->arguments)
+    {
+        if (all_false)
+            break;
+
+        size_t survivors = countBytesInFilter(filter);
+        if (!survivors)
+            break;
+
+        Block argument_block;
+        for (const auto & name : argument.required_columns)
+        {
+            const ColumnWithTypeAndName & source = block.getByName(name);
+            ColumnPtr filtered = source.column->isConst()
+                ? source.column->cut(0, survivors)
+                : source.column->filter(filter, survivors);
+            argument_block.insert({ filtered, source.type, source.name });
+        }
+
+        for (const auto & lazy_action : argument.actions)
+            lazy_action.execute(argument_block);
+
+        ColumnPtr argument_column = argument_block.getByName(argument_names[argument.argument_index]).column;
+
+        if (argument_column->isConst())
+        {
+            if (!static_cast<const ColumnConst &>(*argument_column).getValue<UInt8>())
+                all_false = true;
+            continue;
+        }
+
+        const ColumnUInt8 * column_vec = typeid_cast<const ColumnUInt8 *>(argument_column.get());
+        if (!column_vec)
+            return execute_fully();
+
+        const auto & data = column_vec->getData();
+        size_t pos = 0;
+        for (size_t j = 0; j < rows; ++j)
+            if (filter[j])
+                filter[j] = data[pos++] ? 1 : 0;
+    }
+
+    if (all_false)
+        std::fill(filter.begin(), filter.end(), 0);
+
+    block.insert({ col_res, result_type, result_name });
+}
+
+
 void ExpressionAction::executeOnTotals(Block & block) const
 {
     if (type != JOIN)
@@ -496,6 +829,18 @@ std::string ExpressionAction::toString() const
             ss << ")";
             break;
 
+        case APPLY_FUNCTION_CHAIN:
+        {
+            ss << "COMPILED CHAIN of " << function_chain->fallback_actions.size() << " functions -> ";
+            for (auto it = function_chain->output_columns.begin(); it != function_chain->output_columns.end(); ++it)
+            {
+                if (it != function_chain->output_columns.begin())
+                    ss << ", ";
+                ss << it->name;
+            }
+            break;
+        }
+
         case ARRAY_JOIN:
             ss << (array_join_is_left ? "LEFT " : "") << "ARRAY JOIN ";
             for (NameSet::const_iterator it = array_joined_columns.begin(); it != array_joined_columns.end(); ++it)
@@ -672,6 +1017,350 @@ void ExpressionActions::execute(Block & block) const
     }
 }
 
+bool ExpressionActions::executableOverRanges() const
+{
+    for (const auto & action : actions)
+    {
+        if (action.type == ExpressionAction::ARRAY_JOIN || action.type == ExpressionAction::JOIN)
+            return false;
+
+        /// This also covers the functions that look at the division of data into blocks
+        ///  (blockSize, rowNumberInBlock, runningDifference, ...).
+        if (action.function && !action.function->isDeterministicInScopeOfQuery())
+            return false;
+    }
+
+    return true;
+}
+
+void ExpressionActions::compileFunctions(Compiler & compiler, UInt32 min_count_to_compile)
+{
+    /// What is known about a column at the current point of the action sequence.
+    struct ColumnInfo
+    {
+        DataTypePtr type;
+        bool is_const = false;
+        Field value;    /// For constants.
+    };
+
+    std::unordered_map<String, ColumnInfo> columns_info;
+    for (const auto & input : input_columns)
+        columns_info[input.name] = { input.type, false, {} };
+
+    size_t i = 0;
+    while (i < actions.size())
+    {
+        const ExpressionAction & action = actions[i];
+
+        if (action.type == ExpressionAction::APPLY_FUNCTION)
+        {
+            /// Try to collect a maximal fusible run of actions, starting from the current one.
+
+            auto chain = std::make_shared<CompiledFunctionChain>();
+            std::unordered_map<String, size_t> run_results;      /// result name -> step number
+            std::unordered_map<String, size_t> input_indices;    /// input column name -> index in chain->input_columns
+            Strings step_exprs;
+            Strings step_cpp_types;
+            Names step_names;
+
+            size_t run_end = i;
+            while (run_end < actions.size())
+            {
+                const ExpressionAction & candidate = actions[run_end];
+                if (candidate.type != ExpressionAction::APPLY_FUNCTION || !candidate.prerequisite_names.empty()
+                    || !candidate.function || !candidate.result_type || candidate.lazy_and_arguments)
+                    break;
+
+                const char * result_cpp = numericTypeToCpp(*candidate.result_type);
+                if (!result_cpp)
+                    break;
+
+                bool arguments_ok = true;
+                bool has_non_constant_argument = false;
+                Strings arg_exprs;
+                std::vector<std::pair<String, DataTypePtr>> appended_inputs;
+
+                for (const auto & arg_name : candidate.argument_names)
+                {
+                    auto jt = run_results.find(arg_name);
+                    if (jt != run_results.end())
+                    {
+                        arg_exprs.push_back("v" + toString(jt->second));
+                        has_non_constant_argument = true;
+                        continue;
+                    }
+
+                    auto kt = columns_info.find(arg_name);
+                    if (kt == columns_info.end() || !kt->second.type)
+                    {
+                        arguments_ok = false;
+                        break;
+                    }
+
+                    const char * arg_cpp = numericTypeToCpp(*kt->second.type);
+                    if (!arg_cpp)
+                    {
+                        arguments_ok = false;
+                        break;
+                    }
+
+                    if (kt->second.is_const)
+                    {
+                        /// The literal is baked into the code; it participates in the key of the compiled library.
+                        const Field & value = kt->second.value;
+                        String literal;
+                        if (value.getType() == Field::Types::UInt64)
+                            literal = toString(value.get<UInt64>()) + "ULL";
+                        else if (value.getType() == Field::Types::Int64)
+                            literal = "(" + toString(value.get<Int64>()) + "LL)";
+                        else if (value.getType() == Field::Types::Float64)
+                        {
+                            Float64 x = value.get<Float64>();
+                            if (!std::isfinite(x))
+                            {
+                                arguments_ok = false;
+                                break;
+                            }
+                            literal = "(" + toString(x) + ")";
+                        }
+                        else
+                        {
+                            arguments_ok = false;
+                            break;
+                        }
+
+                        arg_exprs.push_back("static_cast<" + String(arg_cpp) + ">(" + literal + ")");
+                    }
+                    else
+                    {
+                        size_t index;
+                        auto lt = input_indices.find(arg_name);
+                        if (lt != input_indices.end())
+                            index = lt->second;
+                        else
+                        {
+                            index = input_indices.size() + appended_inputs.size();
+                            bool already_appended = false;
+                            for (size_t k = 0; k < appended_inputs.size(); ++k)
+                            {
+                                if (appended_inputs[k].first == arg_name)
+                                {
+                                    index = input_indices.size() + k;
+                                    already_appended = true;
+                                    break;
+                                }
+                            }
+                            if (!already_appended)
+                                appended_inputs.emplace_back(arg_name, kt->second.type);
+                        }
+
+                        arg_exprs.push_back("in" + toString(index) + "[i]");
+                        has_non_constant_argument = true;
+                    }
+                }
+
+                /// A function over constants only would lose its constness if computed by the loop.
+                if (!arguments_ok || !has_non_constant_argument)
+                    break;
+
+                String expr = generateFusedExpression(candidate.function->getName(), arg_exprs, result_cpp);
+                if (expr.empty())
+                    break;
+
+                for (const auto & appended : appended_inputs)
+                {
+                    const size_t new_index = input_indices.size();
+                    input_indices[appended.first] = new_index;
+                    chain->input_columns.emplace_back(appended.first, appended.second);
+                }
+
+                run_results[candidate.result_name] = step_exprs.size();
+                step_exprs.push_back(expr);
+                step_cpp_types.push_back(result_cpp);
+                step_names.push_back(candidate.result_name);
+                ++run_end;
+            }
+
+            const size_t num_steps = run_end - i;
+            if (num_steps < 2)
+            {
+                /// Not worth fusing. The result of the interpreted function is an ordinary column.
+                columns_info[action.result_name] = { action.result_type, false, {} };
+                ++i;
+                continue;
+            }
+
+            /** Find out which results are needed outside of the run. The rest are never materialized;
+              *  their later REMOVE_COLUMN actions (added by finalize) are deleted together with them.
+              */
+            std::vector<bool> is_external(num_steps, false);
+            std::vector<size_t> removes_to_delete;
+            for (size_t s = 0; s < num_steps; ++s)
+            {
+                const String & name = step_names[s];
+                bool resolved = false;
+                for (size_t j = run_end; j < actions.size() && !resolved; ++j)
+                {
+                    if (actions[j].type == ExpressionAction::REMOVE_COLUMN && actions[j].source_name == name)
+                    {
+                        removes_to_delete.push_back(j);
+                        resolved = true;
+                        break;
+                    }
+
+                    const Names needed = actions[j].getNeededColumns();
+                    if (std::find(needed.begin(), needed.end(), name) != needed.end())
+                    {
+                        is_external[s] = true;
+                        resolved = true;
+                    }
+                }
+                if (!resolved)
+                    is_external[s] = sample_block.has(name);
+            }
+
+            std::vector<size_t> output_steps;
+            for (size_t s = 0; s < num_steps; ++s)
+            {
+                if (is_external[s])
+                {
+                    chain->output_columns.emplace_back(step_names[s], actions[i + s].result_type);
+                    output_steps.push_back(s);
+                }
+                else
+                    chain->intermediate_names.push_back(step_names[s]);
+            }
+
+            /// Generate a single loop computing all the steps, with the intermediate results in locals.
+            std::stringstream code;
+            code <<
+                "#include <cstdint>\n"
+                "#include <cstddef>\n"
+                "\n"
+                "extern \"C\" void expressionLoop(size_t rows, const void ** inputs, void ** outputs)"
+                    " __attribute__((__visibility__(\"default\")));\n"
+                "extern \"C\" void expressionLoop(size_t rows, const void ** inputs, void ** outputs)\n"
+                "{\n";
+
+            size_t input_idx = 0;
+            for (const auto & input : chain->input_columns)
+            {
+                const char * cpp = numericTypeToCpp(*input.type);
+                code << "\tconst " << cpp << " * __restrict__ in" << input_idx
+                    << " = reinterpret_cast<const " << cpp << " *>(inputs[" << input_idx << "]);\n";
+                ++input_idx;
+            }
+
+            size_t output_idx = 0;
+            for (const auto & output : chain->output_columns)
+            {
+                const char * cpp = numericTypeToCpp(*output.type);
+                code << "\t" << cpp << " * __restrict__ out" << output_idx
+                    << " = reinterpret_cast<" << cpp << " *>(outputs[" << output_idx << "]);\n";
+                ++output_idx;
+            }
+
+            code << "\n"
+                "\tfor (size_t i = 0; i < rows; ++i)\n"
+                "\t{\n";
+
+            for (size_t s = 0; s < num_steps; ++s)
+                code << "\t\t" << step_cpp_types[s] << " v" << s << " = " << step_exprs[s] << ";\n";
+
+            for (size_t k = 0; k < output_steps.size(); ++k)
+                code << "\t\tout" << k << "[i] = v" << output_steps[k] << ";\n";
+
+            code << "\t}\n"
+                "}\n";
+
+            std::string code_str = code.str();
+            std::string key = "Fused expression: " + code_str;
+
+            chain->fallback_actions.assign(actions.begin() + i, actions.begin() + run_end);
+
+            auto on_ready = [chain] (SharedLibraryPtr & lib)
+            {
+                chain->library = lib;
+                chain->compiled_loop = lib->get<CompiledFunctionChain::Loop>("expressionLoop");
+            };
+
+            SharedLibraryPtr lib = compiler.getOrCount(key, min_count_to_compile, "",
+                [code_str] { return code_str; }, on_ready);
+
+            /// If the result is already ready.
+            if (lib)
+                on_ready(lib);
+
+            /// Replace the run with a single action, even if the library is not ready yet:
+            ///  the chain interprets its actions itself until the compiled loop appears.
+            std::sort(removes_to_delete.begin(), removes_to_delete.end());
+            for (auto it = removes_to_delete.rbegin(); it != removes_to_delete.rend(); ++it)
+                actions.erase(actions.begin() + *it);
+
+            actions.erase(actions.begin() + i + 1, actions.begin() + run_end);
+
+            ExpressionAction chain_action;
+            chain_action.type = ExpressionAction::APPLY_FUNCTION_CHAIN;
+            chain_action.function_chain = chain;
+            actions[i] = chain_action;
+
+            for (size_t s = 0; s < num_steps; ++s)
+            {
+                if (is_external[s])
+                    columns_info[step_names[s]] = { chain->fallback_actions[s].result_type, false, {} };
+                else
+                    columns_info.erase(step_names[s]);
+            }
+
+            ++i;
+            continue;
+        }
+
+        if (action.type == ExpressionAction::ADD_COLUMN)
+        {
+            if (action.added_column && action.added_column->isConst())
+                columns_info[action.result_name] = { action.result_type, true, (*action.added_column)[0] };
+            else
+                columns_info[action.result_name] = { action.result_type, false, {} };
+        }
+        else if (action.type == ExpressionAction::COPY_COLUMN)
+        {
+            auto it = columns_info.find(action.source_name);
+            if (it != columns_info.end())
+                columns_info[action.result_name] = it->second;
+            else
+                columns_info.erase(action.result_name);
+        }
+        else if (action.type == ExpressionAction::REMOVE_COLUMN)
+        {
+            columns_info.erase(action.source_name);
+        }
+        else if (action.type == ExpressionAction::PROJECT)
+        {
+            std::unordered_map<String, ColumnInfo> new_info;
+            for (const auto & elem : action.projection)
+            {
+                auto it = columns_info.find(elem.first);
+                if (it != columns_info.end())
+                    new_info[elem.second.empty() ? elem.first : elem.second] = it->second;
+            }
+            columns_info.swap(new_info);
+        }
+        else if (action.type == ExpressionAction::ARRAY_JOIN)
+        {
+            for (const auto & name : action.array_joined_columns)
+                columns_info.erase(name);
+        }
+        else if (action.type == ExpressionAction::JOIN)
+        {
+            for (const auto & col : action.columns_added_by_join)
+                columns_info[col.name] = { col.type, false, {} };
+        }
+
+        ++i;
+    }
+}
+
 void ExpressionActions::executeOnTotals(Block & block) const
 {
     /// If there is `totals` in the subquery for JOIN, but we do not, then take the block with the default values instead of `totals`.
@@ -728,6 +1417,10 @@ std::string ExpressionActions::getSmallestColumn(const NamesAndTypesList & colum
 
 void ExpressionActions::finalize(const Names & output_columns)
 {
+    /// Before computing liveness, deduplicate the actions: the liveness pass below then
+    ///  throws out the arguments of the eliminated computations as soon as they are dead.
+    eliminateCommonSubexpressions();
+
     NameSet final_columns;
     for (size_t i = 0; i < output_columns.size(); ++i)
     {
@@ -919,6 +1612,9 @@ void ExpressionActions::finalize(const Names & output_columns)
         std::cerr << action.toString() << "\n";
     std::cerr << "\n";*/
 
+    if (settings.short_circuit_and_evaluation)
+        optimizeShortCircuitAnd();
+
     optimize();
     checkLimits(sample_block);
 }
@@ -988,6 +1684,287 @@ void ExpressionActions::optimize()
     optimizeArrayJoin();
 }
 
+void ExpressionActions::eliminateCommonSubexpressions()
+{
+    /// Result name of the first action that computed each distinct expression.
+    /// The key is the function name with the argument column names: applied to the same
+    ///  argument columns, a deterministic function always gives the same result.
+    std::unordered_map<String, String> computed;
+
+    for (auto & action : actions)
+    {
+        /// ARRAY JOIN replaces the contents of the source columns, PROJECT renames them
+        ///  and REMOVE_COLUMN may allow a name to be reused for different data:
+        ///  the results remembered so far are no longer valid under their names.
+        if (action.type == ExpressionAction::ARRAY_JOIN
+            || action.type == ExpressionAction::PROJECT
+            || action.type == ExpressionAction::JOIN
+            || action.type == ExpressionAction::REMOVE_COLUMN)
+        {
+            computed.clear();
+            continue;
+        }
+
+        /// Functions like rand() must be computed separately each time.
+        if (action.type != ExpressionAction::APPLY_FUNCTION
+            || !action.function->isDeterministicInScopeOfQuery()
+            || !action.prerequisite_names.empty())
+            continue;
+
+        String expression_key = action.function->getName();
+        expression_key += '(';
+        for (const auto & name : action.argument_names)
+        {
+            expression_key += name;
+            expression_key += ',';
+        }
+        expression_key += ')';
+
+        auto it = computed.find(expression_key);
+        if (it == computed.end())
+            computed.emplace(expression_key, action.result_name);
+        else if (it->second != action.result_name)
+            action = ExpressionAction::copyColumn(it->second, action.result_name);
+    }
+}
+
+void ExpressionActions::optimizeShortCircuitAnd()
+{
+    /// The analysis below assumes that the actions only add and remove columns by name.
+    /// PROJECT, JOIN and ARRAY JOIN rename columns, change the number of rows or read columns
+    ///  not named in the action itself - do not restructure such sequences.
+    for (const auto & action : actions)
+        if (action.type != ExpressionAction::APPLY_FUNCTION
+            && action.type != ExpressionAction::ADD_COLUMN
+            && action.type != ExpressionAction::COPY_COLUMN
+            && action.type != ExpressionAction::REMOVE_COLUMN)
+            return;
+
+    auto is_uint8 = [](const DataTypePtr & type)
+    {
+        return type && typeid_cast<const DataTypeUInt8 *>(type.get());
+    };
+
+    bool restart = true;
+    while (restart)
+    {
+        restart = false;
+
+        /// Index of the APPLY_FUNCTION action producing each column.
+        std::unordered_map<String, size_t> producers;
+        /// Indices of the actions reading each column. Removals are tracked separately.
+        std::unordered_map<String, std::vector<size_t>> users;
+        std::unordered_map<String, std::vector<size_t>> removals;
+
+        for (size_t i = 0; i < actions.size(); ++i)
+        {
+            const ExpressionAction & current = actions[i];
+
+            if (current.type == ExpressionAction::REMOVE_COLUMN)
+            {
+                removals[current.source_name].push_back(i);
+                continue;
+            }
+
+            if (current.type == ExpressionAction::APPLY_FUNCTION)
+                producers[current.result_name] = i;
+
+            if (!current.source_name.empty())
+                users[current.source_name].push_back(i);
+            for (const auto & name : current.argument_names)
+                users[name].push_back(i);
+            for (const auto & name : current.prerequisite_names)
+                users[name].push_back(i);
+        }
+
+        auto type_of_column = [&](const String & name) -> DataTypePtr
+        {
+            for (const auto & current : actions)
+                if ((current.type == ExpressionAction::APPLY_FUNCTION || current.type == ExpressionAction::ADD_COLUMN)
+                    && current.result_name == name)
+                    return current.result_type;
+
+            for (const auto & input : input_columns)
+                if (input.name == name)
+                    return input.type;
+
+            return nullptr;
+        };
+
+        for (size_t i = 0; i < actions.size(); ++i)
+        {
+            ExpressionAction & action = actions[i];
+
+            if (action.type != ExpressionAction::APPLY_FUNCTION || action.lazy_and_arguments
+                || !action.function || action.function->getName() != "and"
+                || !action.prerequisite_names.empty() || action.argument_names.size() < 2
+                || !is_uint8(action.result_type))
+                continue;
+
+            /// The mask combination in executeShortCircuitAnd relies on all the arguments being plain UInt8.
+            bool arguments_ok = true;
+            for (const auto & name : action.argument_names)
+                if (!is_uint8(type_of_column(name)))
+                    arguments_ok = false;
+            if (!arguments_ok)
+                continue;
+
+            ShortCircuitAndArguments lazy;
+            std::set<size_t> claimed;       /// Actions moved into the group of some argument.
+            NameSet claimed_results;
+
+            for (size_t k = 1; k < action.argument_names.size(); ++k)
+            {
+                const String & argument_name = action.argument_names[k];
+
+                /// A repeated argument must stay eager for its first occurrence.
+                bool repeated = false;
+                for (size_t j = 0; j < k; ++j)
+                    if (action.argument_names[j] == argument_name)
+                        repeated = true;
+                if (repeated)
+                    continue;
+
+                auto produced = producers.find(argument_name);
+                if (produced == producers.end())
+                    continue;
+
+                /// The cone of actions the argument is computed by.
+                std::set<size_t> group;
+                {
+                    std::vector<size_t> worklist{produced->second};
+                    while (!worklist.empty())
+                    {
+                        size_t idx = worklist.back();
+                        worklist.pop_back();
+                        if (!group.insert(idx).second)
+                            continue;
+                        for (const auto & name : actions[idx].argument_names)
+                        {
+                            auto jt = producers.find(name);
+                            if (jt != producers.end())
+                                worklist.push_back(jt->second);
+                        }
+                    }
+                }
+
+                /// Throw out of the cone the actions that cannot be deferred; their results become
+                ///  external inputs of the group. Repeat until a fixed point, since removing an action
+                ///  makes everything it consumes externally used.
+                bool changed = true;
+                while (changed)
+                {
+                    changed = false;
+                    for (auto it = group.begin(); it != group.end();)
+                    {
+                        const ExpressionAction & member = actions[*it];
+                        const String & result = member.result_name;
+
+                        bool deferrable = member.function && member.function->isDeterministicInScopeOfQuery()
+                            && member.prerequisite_names.empty() && member.result_type
+                            && !member.lazy_and_arguments
+                            && !claimed.count(*it)
+                            /// A result without a removal is an output of the expression and must stay in the block.
+                            && !removals[result].empty();
+
+                        if (deferrable)
+                            for (size_t user : users[result])
+                            {
+                                if (group.count(user))
+                                    continue;
+                                if (user == i && result == argument_name)
+                                    continue;
+                                deferrable = false;
+                                break;
+                            }
+
+                        if (!deferrable)
+                        {
+                            it = group.erase(it);
+                            changed = true;
+                        }
+                        else
+                            ++it;
+                    }
+                }
+
+                if (!group.count(produced->second))
+                    continue;
+
+                /// External inputs of the group. They may not be the results of a previous argument's
+                ///  group - those are no longer present in the block at the point of the and().
+                NameSet group_results;
+                for (size_t idx : group)
+                    group_results.insert(actions[idx].result_name);
+
+                Names required_columns;
+                NameSet required_set;
+                bool valid = true;
+                for (size_t idx : group)
+                    for (const auto & name : actions[idx].argument_names)
+                    {
+                        if (group_results.count(name))
+                            continue;
+                        if (claimed_results.count(name))
+                            valid = false;
+                        if (required_set.insert(name).second)
+                            required_columns.push_back(name);
+                    }
+                if (!valid)
+                    continue;
+
+                ShortCircuitAndArguments::Argument lazy_argument;
+                lazy_argument.argument_index = k;
+                for (size_t idx : group)        /// std::set keeps the execution order.
+                    lazy_argument.actions.push_back(actions[idx]);
+                lazy_argument.required_columns = std::move(required_columns);
+                lazy.arguments.push_back(std::move(lazy_argument));
+
+                claimed.insert(group.begin(), group.end());
+                claimed_results.insert(group_results.begin(), group_results.end());
+            }
+
+            if (lazy.arguments.empty())
+                continue;
+
+            /// Remove from the main sequence the deferred actions and the removals of their results.
+            std::set<size_t> to_delete = claimed;
+            for (const auto & result : claimed_results)
+                for (size_t idx : removals[result])
+                    to_delete.insert(idx);
+
+            /// The external inputs are now read at the point of the and(): removals placed
+            ///  before it must be deferred until just after it.
+            std::set<size_t> to_defer;
+            for (const auto & lazy_argument : lazy.arguments)
+                for (const auto & name : lazy_argument.required_columns)
+                    for (size_t idx : removals[name])
+                        if (idx < i)
+                            to_defer.insert(idx);
+
+            action.lazy_and_arguments = std::make_shared<ShortCircuitAndArguments>(std::move(lazy));
+
+            Actions new_actions;
+            new_actions.reserve(actions.size());
+            for (size_t idx = 0; idx < actions.size(); ++idx)
+            {
+                if (to_delete.count(idx) || to_defer.count(idx))
+                    continue;
+                new_actions.push_back(actions[idx]);
+                if (idx == i)
+                    for (size_t deferred : to_defer)
+                        new_actions.push_back(actions[deferred]);
+            }
+            actions.swap(new_actions);
+
+            /// The indices in the maps are stale - rescan for the next and().
+            restart = true;
+            break;
+        }
+    }
+}
+
+
 void ExpressionActions::optimizeArrayJoin()
 {
     const size_t NONE = actions.size();
@@ -1087,6 +2064,15 @@ BlockInputStreamPtr ExpressionActions::createStreamWithNonJoinedDataIfFullOrRigh
     return {};
 }
 
+BlockInputStreamPtr ExpressionActions::createStreamWithExternallyJoinedDataIfExternalJoin() const
+{
+    for (const auto & action : actions)
+        if (action.join && action.join->externalJoinPossible())
+            return action.join->createStreamWithExternallyJoinedRows();
+
+    return {};
+}
+
 
 void ExpressionActionsChain::addStep()
 {
@@ -22,6 +22,14 @@ using NamesWithAliases = std::vector<NameWithAlias>;
 
 class Join;
 
+class Compiler;
+
+struct CompiledFunctionChain;
+using CompiledFunctionChainPtr = std::shared_ptr<CompiledFunctionChain>;
+
+struct ShortCircuitAndArguments;
+using ShortCircuitAndArgumentsPtr = std::shared_ptr<ShortCircuitAndArguments>;
+
 class IFunction;
 using FunctionPtr = std::shared_ptr<IFunction>;
 
@@ -45,6 +53,12 @@ public:
 
         APPLY_FUNCTION,
 
+        /** A fused chain of simple functions over numeric columns, executed as a single loop
+          *  compiled at runtime (see ExpressionActions::compileFunctions).
+          * Until the library is ready, the original actions are interpreted one by one.
+          */
+        APPLY_FUNCTION_CHAIN,
+
         /** Replaces the specified columns with arrays into columns with elements.
             * Duplicates the values in the remaining columns by the number of elements in the arrays.
             * Arrays must be parallel (have the same lengths).
@@ -81,6 +95,13 @@ public:
     std::shared_ptr<const Join> join;
     NamesAndTypesList columns_added_by_join;
 
+    /// For APPLY_FUNCTION_CHAIN.
+    CompiledFunctionChainPtr function_chain;
+
+    /// For APPLY_FUNCTION of and(): arguments whose expressions are evaluated only over the rows
+    ///  that survived the masks of the previous arguments (see ExpressionActions::optimizeShortCircuitAnd).
+    ShortCircuitAndArgumentsPtr lazy_and_arguments;
+
     /// For PROJECT.
     NamesWithAliases projection;
 
@@ -109,6 +130,32 @@ private:
     void prepare(Block & sample_block);
     void execute(Block & block) const;
     void executeOnTotals(Block & block) const;
+
+    /// For APPLY_FUNCTION of and() with lazy_and_arguments.
+    void executeShortCircuitAnd(Block & block) const;
+};
+
+
+/** Arguments of and() evaluated lazily: the actions of each argument are executed only over the rows
+  *  that passed the mask accumulated from the previous arguments - the block is filtered by the mask,
+  *  the argument expression is computed on the shrunken copy and the result is scattered back.
+  */
+struct ShortCircuitAndArguments
+{
+    struct Argument
+    {
+        /// Index in ExpressionAction::argument_names.
+        size_t argument_index;
+
+        /// Compute the argument column from `required_columns`. Moved here out of the main
+        ///  sequence of actions together with the removals of their results.
+        std::vector<ExpressionAction> actions;
+
+        /// Columns of the block the actions read. Their removals are moved after the and().
+        Names required_columns;
+    };
+
+    std::vector<Argument> arguments;
 };
 
 
@@ -181,9 +228,22 @@ public:
 
     const NamesAndTypesList & getRequiredColumnsWithTypes() const { return input_columns; }
 
+    /** Fuse chains of consecutive arithmetic/comparison/logical functions over numeric columns
+      *  into single loops compiled at runtime, without materialization of the intermediate columns.
+      * Must be called after finalize. Until the library is compiled (see min_count_to_compile),
+      *  the fused actions are interpreted as before.
+      */
+    void compileFunctions(Compiler & compiler, UInt32 min_count_to_compile);
+
     /// Execute the expression on the block. The block must contain all the columns returned by getRequiredColumns.
     void execute(Block & block) const;
 
+    /** Whether the result is the same if the expression is executed over row ranges of a block
+      *  independently and the results are concatenated: no JOIN, no ARRAY JOIN and no functions
+      *  whose result depends on the division of data into blocks (blockSize, runningDifference, ...).
+      */
+    bool executableOverRanges() const;
+
     /** Execute the expression on the block of total values.
       * Almost the same as `execute`. The difference is only when JOIN is executed.
       */
@@ -200,6 +260,10 @@ public:
 
     BlockInputStreamPtr createStreamWithNonJoinedDataIfFullOrRightJoin(size_t max_block_size) const;
 
+    /// For a JOIN that could spill to disk (see max_bytes_before_external_join) - a stream with rows
+    ///  joined from the on-disk buckets. Should also be read after all calls to execute.
+    BlockInputStreamPtr createStreamWithExternallyJoinedDataIfExternalJoin() const;
+
 private:
     NamesAndTypesList input_columns;
     Actions actions;
@@ -216,6 +280,11 @@ private:
     void optimize();
     /// Move all arrayJoin as close as possible to the end.
     void optimizeArrayJoin();
+    /// Make the evaluation of and() arguments lazy: the expression of every argument after the first
+    ///  is computed only over the rows that survived the previous ones (see ShortCircuitAndArguments).
+    void optimizeShortCircuitAnd();
+    /// Replace repeated computations of the same deterministic expression with a copy of the first result.
+    void eliminateCommonSubexpressions();
 };
 
 using ExpressionActionsPtr = std::shared_ptr<ExpressionActions>;
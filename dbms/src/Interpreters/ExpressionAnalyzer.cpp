@@ -31,6 +31,7 @@
 #include <Interpreters/LogicalExpressionsOptimizer.h>
 #include <Interpreters/ExternalDictionaries.h>
 #include <Interpreters/Set.h>
+#include <Interpreters/SetCache.h>
 #include <Interpreters/Join.h>
 
 #include <AggregateFunctions/AggregateFunctionFactory.h>
@@ -196,6 +197,12 @@ void ExpressionAnalyzer::init()
     /// Optimize if with constant condition after constants was substituted instead of sclalar subqueries.
     optimizeIfWithConstantCondition();
 
+    /// Compose chained higher-order array functions, so that intermediate arrays are not materialized.
+    optimizeHigherOrderArrayFunctions();
+
+    /// Let overlapping aggregate functions (avg together with sum or count) share aggregation states.
+    optimizeSharedAggregateStates();
+
     /// GROUP BY injective function elimination.
     optimizeGroupBy();
 
@@ -468,6 +475,278 @@ void ExpressionAnalyzer::optimizeIfWithConstantConditionImpl(ASTPtr & current_as
     }
 }
 
+namespace
+{
+
+/// Whether the AST is a lambda expression of exactly one argument, e.g. `x -> expr`.
+bool isOneArgumentLambda(const ASTFunction * node)
+{
+    if (!node || node->name != "lambda" || !node->arguments || node->arguments->children.size() != 2)
+        return false;
+
+    const ASTFunction * args_tuple = typeid_cast<const ASTFunction *>(node->arguments->children.at(0).get());
+    return args_tuple && args_tuple->name == "tuple"
+        && args_tuple->arguments && args_tuple->arguments->children.size() == 1
+        && typeid_cast<const ASTIdentifier *>(args_tuple->arguments->children.at(0).get());
+}
+
+const String & getLambdaArgumentName(const ASTFunction * node)
+{
+    return typeid_cast<const ASTIdentifier &>(
+        *typeid_cast<const ASTFunction &>(*node->arguments->children.at(0)).arguments->children.at(0)).name;
+}
+
+/// Whether the expression contains constructs with their own name scope, where substitution would be unsafe.
+bool hasLambdaOrSubquery(const ASTPtr & node)
+{
+    const ASTFunction * function = typeid_cast<const ASTFunction *>(node.get());
+    if ((function && function->name == "lambda") || typeid_cast<const ASTSubquery *>(node.get()))
+        return true;
+
+    for (const auto & child : node->children)
+        if (hasLambdaOrSubquery(child))
+            return true;
+
+    return false;
+}
+
+bool hasIdentifier(const ASTPtr & node, const String & name)
+{
+    const ASTIdentifier * identifier = typeid_cast<const ASTIdentifier *>(node.get());
+    if (identifier && identifier->kind == ASTIdentifier::Column && identifier->name == name)
+        return true;
+
+    for (const auto & child : node->children)
+        if (hasIdentifier(child, name))
+            return true;
+
+    return false;
+}
+
+/// Replace references to the lambda argument `name` with a copy of the `replacement` expression.
+void substituteLambdaArgument(ASTPtr & node, const String & name, const ASTPtr & replacement)
+{
+    const ASTIdentifier * identifier = typeid_cast<const ASTIdentifier *>(node.get());
+    if (identifier && identifier->kind == ASTIdentifier::Column && identifier->name == name)
+    {
+        node = replacement->clone();
+        return;
+    }
+
+    for (auto & child : node->children)
+        substituteLambdaArgument(child, name, replacement);
+}
+
+/** If the AST is a higher-order array function applied to the result of arrayMap, compose the lambdas,
+  *  so that the intermediate array is never materialized:
+  *     outer(f, arrayMap(g, xs)) -> outer(x -> f(g(x)), xs)
+  *  for the functions whose result depends on the mapped values only through the lambda, and
+  *     arrayFilter(f, arrayMap(g, xs)) -> arrayMap(g, arrayFilter(x -> f(g(x)), xs)),
+  *  where only the surviving elements are mapped.
+  * Returns whether the AST was replaced.
+  */
+bool tryFuseHigherOrderFunctions(ASTPtr & ast)
+{
+    ASTFunction * outer = typeid_cast<ASTFunction *>(ast.get());
+    if (!outer || !outer->arguments || outer->arguments->children.size() != 2)
+        return false;
+
+    const bool outer_is_filter = outer->name == "arrayFilter";
+    const bool outer_composes = outer->name == "arrayMap"
+        || outer->name == "arrayExists" || outer->name == "arrayAll"
+        || outer->name == "arrayCount" || outer->name == "arrayFirstIndex"
+        || outer->name == "arraySum";
+
+    if (!outer_composes && !outer_is_filter)
+        return false;
+
+    const ASTFunction * outer_lambda = typeid_cast<const ASTFunction *>(outer->arguments->children.at(0).get());
+    if (!isOneArgumentLambda(outer_lambda))
+        return false;
+
+    const ASTFunction * inner = typeid_cast<const ASTFunction *>(outer->arguments->children.at(1).get());
+    if (!inner || inner->name != "arrayMap" || !inner->arguments || inner->arguments->children.size() != 2)
+        return false;
+
+    /// The result of the inner arrayMap may be referenced elsewhere by its alias.
+    if (!inner->tryGetAlias().empty())
+        return false;
+
+    const ASTFunction * inner_lambda = typeid_cast<const ASTFunction *>(inner->arguments->children.at(0).get());
+    if (!isOneArgumentLambda(inner_lambda))
+        return false;
+
+    const String & outer_param = getLambdaArgumentName(outer_lambda);
+    const String & inner_param = getLambdaArgumentName(inner_lambda);
+    const ASTPtr & outer_body = outer_lambda->arguments->children.at(1);
+    const ASTPtr & inner_body = inner_lambda->arguments->children.at(1);
+
+    /// A lambda or a subquery inside the outer body introduces its own scope; do not risk substituting there.
+    if (hasLambdaOrSubquery(outer_body))
+        return false;
+
+    /// After composition the outer body is evaluated under the inner lambda argument;
+    ///  an unrelated column with the same name would be captured by it.
+    if (inner_param != outer_param && hasIdentifier(outer_body, inner_param))
+        return false;
+
+    ASTPtr composed_body = outer_body->clone();
+    substituteLambdaArgument(composed_body, outer_param, inner_body);
+
+    ASTPtr composed_lambda = makeASTFunction(
+        "lambda", inner_lambda->arguments->children.at(0)->clone(), composed_body);
+    ASTPtr array_arg = inner->arguments->children.at(1);
+
+    ASTPtr replacement;
+    if (outer_composes)
+        replacement = makeASTFunction(outer->name, composed_lambda, array_arg);
+    else
+        replacement = makeASTFunction("arrayMap",
+            inner->arguments->children.at(0)->clone(),
+            makeASTFunction("arrayFilter", composed_lambda, array_arg));
+
+    replacement->setAlias(ast->tryGetAlias());
+    ast = replacement;
+    return true;
+}
+
+}
+
+void ExpressionAnalyzer::optimizeHigherOrderArrayFunctions()
+{
+    optimizeHigherOrderArrayFunctionsImpl(ast);
+}
+
+void ExpressionAnalyzer::optimizeHigherOrderArrayFunctionsImpl(ASTPtr & current_ast)
+{
+    if (!current_ast)
+        return;
+
+    for (ASTPtr & child : current_ast->children)
+    {
+        /// Fuse the innermost chains first, so that longer chains collapse step by step.
+        optimizeHigherOrderArrayFunctionsImpl(child);
+
+        ASTPtr child_copy = child;
+        if (tryFuseHigherOrderFunctions(child))
+        {
+            /// The same bookkeeping as in optimizeIfWithConstantConditionImpl.
+            String alias = child->tryGetAlias();
+            if (!alias.empty())
+            {
+                auto alias_it = aliases.find(alias);
+                if (alias_it != aliases.end() && alias_it->second.get() == child_copy.get())
+                    alias_it->second = child;
+            }
+
+            /// The replacement could expose a new outer(arrayMap(...)) pair.
+            tryFuseHigherOrderFunctions(child);
+        }
+    }
+}
+
+namespace
+{
+
+/// Column names of all aggregate function calls in the query, except those inside subqueries.
+void collectAggregateColumnNames(const ASTPtr & node, NameSet & names)
+{
+    const ASTFunction * function = typeid_cast<const ASTFunction *>(node.get());
+    if (function && function->kind == ASTFunction::AGGREGATE_FUNCTION)
+    {
+        /// There are no aggregate functions inside aggregate functions.
+        names.insert(function->getColumnName());
+        return;
+    }
+
+    for (const auto & child : node->children)
+        if (!typeid_cast<const ASTSubquery *>(child.get())
+            && !typeid_cast<const ASTSelectQuery *>(child.get()))
+            collectAggregateColumnNames(child, names);
+}
+
+/// An aggregate function call over copies of the given arguments, e.g. the sum or count half of an avg call.
+ASTPtr makeAggregateFunctionCall(const String & name, const ASTs & arguments)
+{
+    auto function = std::make_shared<ASTFunction>();
+    function->name = name;
+    function->kind = ASTFunction::AGGREGATE_FUNCTION;
+    function->arguments = std::make_shared<ASTExpressionList>();
+    function->children.push_back(function->arguments);
+
+    for (const auto & argument : arguments)
+        function->arguments->children.push_back(argument->clone());
+
+    return function;
+}
+
+}
+
+void ExpressionAnalyzer::optimizeSharedAggregateStates()
+{
+    if (!select_query)
+        return;
+
+    NameSet aggregate_names;
+    collectAggregateColumnNames(ast, aggregate_names);
+
+    if (!aggregate_names.empty())
+        optimizeSharedAggregateStatesImpl(ast, aggregate_names);
+}
+
+void ExpressionAnalyzer::optimizeSharedAggregateStatesImpl(ASTPtr & current_ast, const NameSet & aggregate_names)
+{
+    if (!current_ast)
+        return;
+
+    for (ASTPtr & child : current_ast->children)
+    {
+        if (typeid_cast<const ASTSubquery *>(child.get())
+            || typeid_cast<const ASTSelectQuery *>(child.get()))
+            continue;
+
+        ASTFunction * function_node = typeid_cast<ASTFunction *>(child.get());
+        if (!function_node || function_node->kind != ASTFunction::AGGREGATE_FUNCTION)
+        {
+            optimizeSharedAggregateStatesImpl(child, aggregate_names);
+            continue;
+        }
+
+        bool is_if = function_node->name == "avgIf";
+        if ((function_node->name != "avg" && !is_if) || function_node->parameters)
+            continue;
+
+        const ASTs & arguments = function_node->arguments->children;
+        if (arguments.size() != (is_if ? 2u : 1u))
+            continue;
+
+        /// Both halves have exactly the semantics of avg, including skipping of NULLs:
+        ///  count(x) counts the rows where x is not NULL, and `/` always divides as Float64.
+        ASTPtr sum_ast = makeAggregateFunctionCall(is_if ? "sumIf" : "sum", arguments);
+        ASTPtr count_ast = makeAggregateFunctionCall(is_if ? "countIf" : "count", arguments);
+
+        /// Rewrite only if one of the halves is already computed by the query -
+        ///  otherwise nothing is shared and the rewrite just splits one state into two.
+        if (!aggregate_names.count(sum_ast->getColumnName()) && !aggregate_names.count(count_ast->getColumnName()))
+            continue;
+
+        /// The result column must keep the name of the avg call.
+        String alias = child->tryGetAlias();
+        if (alias.empty())
+            alias = child->getColumnName();
+
+        ASTPtr child_copy = child;
+        ASTPtr replacement = makeASTFunction("divide", sum_ast, count_ast);
+        replacement->setAlias(alias);
+        child = replacement;
+
+        /// The same bookkeeping as in optimizeIfWithConstantConditionImpl.
+        auto alias_it = aliases.find(alias);
+        if (alias_it != aliases.end() && alias_it->second.get() == child_copy.get())
+            alias_it->second = child;
+    }
+}
+
 void ExpressionAnalyzer::analyzeAggregation()
 {
     /** Find aggregation keys (aggregation_keys), information about aggregate functions (aggregate_descriptions),
@@ -1593,6 +1872,29 @@ void ExpressionAnalyzer::makeSet(const ASTFunction * node, const Block & sample_
             return;
         }
 
+        /** A server-wide cache of sets built from subqueries (see the use_set_cache setting).
+          * Not used for GLOBAL IN (when the source is already prepared): there the set is built
+          *  from a per-query temporary table, and set_id would collide between queries.
+          */
+        if (settings.use_set_cache && !subquery_for_set.source)
+        {
+            if (SetCachePtr set_cache = context.getSetCache())
+            {
+                UInt128 key = SetCache::hash(*arg, context.getCurrentDatabase());
+
+                if (SetPtr shared_set = set_cache->get(key))
+                {
+                    subquery_for_set.set = shared_set;
+                    prepared_sets[arg.get()] = shared_set;
+                    return;
+                }
+
+                /// After the set is built, it will be put into the cache (see CreatingSetsBlockInputStream).
+                subquery_for_set.set_cache = set_cache;
+                subquery_for_set.set_cache_key = key;
+            }
+        }
+
         SetPtr set = std::make_shared<Set>(settings.limits);
 
         /** The following happens for GLOBAL INs:
@@ -2424,7 +2726,8 @@ bool ExpressionAnalyzer::appendJoin(ExpressionActionsChain & chain, bool only_ty
         JoinPtr join = std::make_shared<Join>(
             join_key_names_left, join_key_names_right,
             settings.join_use_nulls, settings.limits,
-            join_params.kind, join_params.strictness);
+            join_params.kind, join_params.strictness,
+            context.getTemporaryPath(), settings.join_build_threads);
 
         Names required_joined_columns(join_key_names_right.begin(), join_key_names_right.end());
         for (const auto & name_type : columns_added_by_join)
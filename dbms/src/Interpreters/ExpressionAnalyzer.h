@@ -3,6 +3,7 @@
 #include <Interpreters/AggregateDescription.h>
 #include <Interpreters/Settings.h>
 #include <Core/Block.h>
+#include <Common/UInt128.h>
 
 
 namespace DB
@@ -23,6 +24,9 @@ class Set;
 using SetPtr = std::shared_ptr<Set>;
 using PreparedSets = std::unordered_map<IAST*, SetPtr>;
 
+class SetCache;
+using SetCachePtr = std::shared_ptr<SetCache>;
+
 class IBlockInputStream;
 using BlockInputStreamPtr = std::shared_ptr<IBlockInputStream>;
 
@@ -50,6 +54,10 @@ struct SubqueryForSet
     /// If set, put the result into the table.
     /// This is a temporary table for transferring to remote servers for distributed query processing.
     StoragePtr table;
+
+    /// If set, after the set is built, share it with other queries through this cache (see the use_set_cache setting).
+    SetCachePtr set_cache;
+    UInt128 set_cache_key{};
 };
 
 /// ID of subquery -> what to do with it.
@@ -247,6 +255,16 @@ private:
     void optimizeIfWithConstantConditionImpl(ASTPtr & current_ast, Aliases & aliases) const;
     bool tryExtractConstValueFromCondition(const ASTPtr & condition, bool & value) const;
 
+    /// Compose chained higher-order array functions (e.g. arrayExists over arrayMap),
+    ///  so that intermediate array columns are not materialized.
+    void optimizeHigherOrderArrayFunctions();
+    void optimizeHigherOrderArrayFunctionsImpl(ASTPtr & current_ast);
+
+    /// Rewrite avg(x) into sum(x) / count(x) when the query already computes one of the halves,
+    ///  so that overlapping aggregate functions share aggregation states.
+    void optimizeSharedAggregateStates();
+    void optimizeSharedAggregateStatesImpl(ASTPtr & current_ast, const NameSet & aggregate_names);
+
     void makeSet(const ASTFunction * node, const Block & sample_block);
 
     /// Adds a list of ALIAS columns from the table
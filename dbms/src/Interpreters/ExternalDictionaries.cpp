@@ -47,6 +47,8 @@ void ExternalDictionaries::reloadPeriodically()
 ExternalDictionaries::ExternalDictionaries(Context & context, const bool throw_on_error)
     : context(context), log(&Logger::get("ExternalDictionaries"))
 {
+    reload_memory_limit = context.getConfigRef().getUInt64("max_dictionary_reload_memory_usage", 0);
+
     {
         /** During synchronous loading of external dictionaries at moment of query execution,
             *  we should not use per query memory limit.
@@ -94,6 +96,24 @@ std::set<std::string> getDictionariesConfigPaths(const Poco::Util::AbstractConfi
 }
 }
 
+std::unique_ptr<IDictionaryBase> ExternalDictionaries::cloneWithMemoryBudget(const IDictionaryBase & dictionary)
+{
+    /** The new version is filled block by block on this thread while queries keep being served
+      *  by the old one. Account that memory to a dedicated budget rather than to the tracker of
+      *  whatever query happened to be executing: if the budget is exceeded, the reload is
+      *  aborted by an exception and the old version stays in use.
+      */
+    MemoryTracker memory_tracker{reload_memory_limit};
+    memory_tracker.setDescription("(while reloading dictionary)");
+
+    auto * prev_memory_tracker = current_memory_tracker;
+    current_memory_tracker = &memory_tracker;
+    SCOPE_EXIT({ current_memory_tracker = prev_memory_tracker; });
+
+    return dictionary.clone();
+}
+
+
 void ExternalDictionaries::reloadAndUpdate(bool throw_on_error)
 {
     reloadFromConfigFiles(throw_on_error);
@@ -113,7 +133,7 @@ void ExternalDictionaries::reloadAndUpdate(bool throw_on_error)
 
         try
         {
-            auto dict_ptr = failed_dictionary.second.dict->clone();
+            auto dict_ptr = cloneWithMemoryBudget(*failed_dictionary.second.dict);
             if (const auto exception_ptr = dict_ptr->getCreationException())
             {
                 /// recalculate next attempt time
@@ -198,7 +218,7 @@ void ExternalDictionaries::reloadAndUpdate(bool throw_on_error)
                 if (current->getSource()->isModified())
                 {
                     /// create new version of dictionary
-                    auto new_version = current->clone();
+                    auto new_version = cloneWithMemoryBudget(*current);
 
                     if (const auto exception_ptr = new_version->getCreationException())
                         std::rethrow_exception(exception_ptr);
@@ -338,8 +358,10 @@ void ExternalDictionaries::reloadFromConfigFile(const std::string & config_path,
                                 lifetime.min_sec,
                                 lifetime.max_sec
                             };
-                            update_times[name] = std::chrono::system_clock::now() +
-                                std::chrono::seconds{distribution(rnd_engine)};
+                            /// A dictionary served from a snapshot is refreshed from the source right away.
+                            update_times[name] = dict_ptr->isLoadedFromSnapshot()
+                                ? std::chrono::system_clock::now()
+                                : std::chrono::system_clock::now() + std::chrono::seconds{distribution(rnd_engine)};
                         }
                     }
 
@@ -79,6 +79,9 @@ private:
 
     Context & context;
 
+    /// Limit on memory consumed while building a new version of a dictionary, 0 - unlimited.
+    Int64 reload_memory_limit = 0;
+
     std::thread reloading_thread;
     Poco::Event destroy;
 
@@ -94,6 +97,9 @@ private:
     /// Check config files and update expired dictionaries
     void reloadAndUpdate(bool throw_on_error = false);
 
+    /// Builds a new version of a dictionary under the 'reload_memory_limit' budget.
+    std::unique_ptr<IDictionaryBase> cloneWithMemoryBudget(const IDictionaryBase & dictionary);
+
     void reloadPeriodically();
 
 public:
@@ -7,6 +7,8 @@
 #include <Parsers/ASTIdentifier.h>
 #include <Common/typeid_cast.h>
 
+#include <algorithm>
+
 
 namespace DB
 {
@@ -128,8 +130,9 @@ void InJoinSubqueriesPreprocessor::process(ASTSelectQuery * query) const
         return;
 
     const SettingDistributedProductMode distributed_product_mode = context.getSettingsRef().distributed_product_mode;
+    const bool optimize_colocated_join = context.getSettingsRef().optimize_colocated_join;
 
-    if (distributed_product_mode == DistributedProductMode::ALLOW)
+    if (distributed_product_mode == DistributedProductMode::ALLOW && !optimize_colocated_join)
         return;
 
     if (!query->tables)
@@ -156,6 +159,39 @@ void InJoinSubqueriesPreprocessor::process(ASTSelectQuery * query) const
 
     forEachNonGlobalSubquery(query, [&] (IAST * subquery, IAST * function, IAST * table_join)
     {
+        /** For a JOIN of colocated tables, switch to pairwise-local execution regardless of
+          *  distributed_product_mode. All distributed tables of the subquery must be colocated
+          *  with the main table - otherwise, e.g., converting the JOIN to GLOBAL because of one
+          *  of them would execute an already localized table on the initiator only.
+          */
+        bool colocated = false;
+        if (optimize_colocated_join && table_join)
+        {
+            Names join_key_columns;
+            if (const auto & using_list = static_cast<const ASTTableJoin &>(*table_join).using_expression_list)
+                for (const auto & key : using_list->children)
+                    join_key_columns.push_back(key->getColumnName());
+
+            if (!join_key_columns.empty())
+            {
+                colocated = true;
+                bool has_distributed_table = false;
+
+                forEachTable(subquery, [&] (ASTPtr & database_and_table)
+                {
+                    StoragePtr subquery_storage = tryGetTable(database_and_table, context);
+                    if (!subquery_storage || !hasAtLeastTwoShards(*subquery_storage))
+                        return;
+
+                    has_distributed_table = true;
+                    if (!isColocated(*storage, *subquery_storage, join_key_columns))
+                        colocated = false;
+                });
+
+                colocated = colocated && has_distributed_table;
+            }
+        }
+
          forEachTable(subquery, [&] (ASTPtr & database_and_table)
         {
             StoragePtr storage = tryGetTable(database_and_table, context);
@@ -163,7 +199,22 @@ void InJoinSubqueriesPreprocessor::process(ASTSelectQuery * query) const
             if (!storage || !hasAtLeastTwoShards(*storage))
                 return;
 
-            if (distributed_product_mode == DistributedProductMode::DENY)
+            if (colocated)
+            {
+                /// Matching rows of the two tables always live on the same shard - execute
+                ///  the join locally on each of them, as with distributed_product_mode = 'local'.
+
+                std::string database;
+                std::string table;
+                std::tie(database, table) = getRemoteDatabaseAndTableName(*storage);
+
+                replaceDatabaseAndTable(database_and_table, database, table);
+            }
+            else if (distributed_product_mode == DistributedProductMode::ALLOW)
+            {
+                /// Leave the subquery as is.
+            }
+            else if (distributed_product_mode == DistributedProductMode::DENY)
             {
                 throw Exception("Double-distributed IN/JOIN subqueries is denied (distributed_product_mode = 'deny')."
                     " You may rewrite query to use local tables in subqueries, or use GLOBAL keyword, or set distributed_product_mode to suitable value.",
@@ -226,4 +277,38 @@ InJoinSubqueriesPreprocessor::getRemoteDatabaseAndTableName(const IStorage & tab
 }
 
 
+bool InJoinSubqueriesPreprocessor::isColocated(const IStorage & left_table, const IStorage & right_table, const Names & join_key_columns) const
+{
+    const StorageDistributed * left = typeid_cast<const StorageDistributed *>(&left_table);
+    const StorageDistributed * right = typeid_cast<const StorageDistributed *>(&right_table);
+
+    if (!left || !right)
+        return false;
+
+    /// The same cluster - the same set and order of shards (and their weights).
+    if (left->getClusterName().empty() || left->getClusterName() != right->getClusterName())
+        return false;
+
+    /// The same sharding key expression on both sides.
+    if (!left->getShardingKeyExpr() || !right->getShardingKeyExpr())
+        return false;
+
+    if (left->getShardingKeyColumnName() != right->getShardingKeyColumnName())
+        return false;
+
+    /// The key must be computed only from the joined columns - then rows that can match
+    ///  are always sharded alike. This also rejects keys like rand(), which depend
+    ///  on no columns and colocate nothing.
+    const Names & key_source_columns = left->getShardingKeyExpr()->getRequiredColumns();
+    if (key_source_columns.empty())
+        return false;
+
+    for (const auto & name : key_source_columns)
+        if (join_key_columns.end() == std::find(join_key_columns.begin(), join_key_columns.end(), name))
+            return false;
+
+    return true;
+}
+
+
 }
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <Core/Types.h>
+#include <Core/Names.h>
 #include <Interpreters/SettingsCommon.h>
 
 
@@ -28,6 +29,12 @@ class Context;
   * - or replace database and table name in subquery to remote database and table name,
   *   as Distributed storage on local server knows it.
   *
+  * Before that, if 'optimize_colocated_join' is set and the subquery is under a JOIN,
+  *  check whether the two distributed tables are colocated: the same cluster, the same
+  *  sharding key expression, and the key computed only from the USING columns - then rows
+  *  that can match always live on the same shard, and the join is executed pairwise-locally
+  *  (as with distributed_product_mode = 'local') instead of being denied or broadcast.
+  *
   * Do not recursively preprocess subqueries, as it will be done by calling code.
   */
 
@@ -40,6 +47,7 @@ public:
     /// These methods could be overriden for the need of the unit test.
     virtual bool hasAtLeastTwoShards(const IStorage & table) const;
     virtual std::pair<std::string, std::string> getRemoteDatabaseAndTableName(const IStorage & table) const;
+    virtual bool isColocated(const IStorage & left_table, const IStorage & right_table, const Names & join_key_columns) const;
     virtual ~InJoinSubqueriesPreprocessor() {}
 
 private:
@@ -84,6 +84,10 @@ BlockIO InterpreterAlterQuery::execute()
             case PartitionCommand::CLEAR_COLUMN:
                 table->clearColumnInPartition(command.partition, command.column_name, context);
                 break;
+
+            case PartitionCommand::DELETE_WHERE:
+                table->deleteRowsWhere(command.predicate, context);
+                break;
         }
     }
 
@@ -186,6 +190,10 @@ void InterpreterAlterQuery::parseAlter(
         {
             out_partition_commands.emplace_back(PartitionCommand::dropPartition(params.partition, params.detach));
         }
+        else if (params.type == ASTAlterQuery::DELETE_WHERE)
+        {
+            out_partition_commands.emplace_back(PartitionCommand::deleteWhere(params.predicate));
+        }
         else if (params.type == ASTAlterQuery::ATTACH_PARTITION)
         {
             out_partition_commands.emplace_back(PartitionCommand::attachPartition(params.partition, params.part));
@@ -31,12 +31,16 @@ private:
             FREEZE_PARTITION,
             RESHARD_PARTITION,
             CLEAR_COLUMN,
+            DELETE_WHERE,
         };
 
         Type type;
 
         ASTPtr partition;
         Field column_name;
+
+        /// For DELETE WHERE - the condition selecting rows to delete.
+        ASTPtr predicate;
         bool detach = false; /// true for DETACH PARTITION.
 
         bool part = false;
@@ -70,6 +74,14 @@ private:
             return res;
         }
 
+        static PartitionCommand deleteWhere(const ASTPtr & predicate)
+        {
+            PartitionCommand res;
+            res.type = DELETE_WHERE;
+            res.predicate = predicate;
+            return res;
+        }
+
         static PartitionCommand attachPartition(const ASTPtr & partition, bool part)
         {
             PartitionCommand res;
@@ -0,0 +1,96 @@
+#include <sstream>
+
+#include <DataStreams/OneBlockInputStream.h>
+#include <DataStreams/BlockIO.h>
+#include <DataTypes/DataTypeString.h>
+#include <Columns/ColumnString.h>
+#include <Parsers/ASTExplainQuery.h>
+#include <Interpreters/Context.h>
+#include <Interpreters/ExplainInfo.h>
+#include <Interpreters/InterpreterSelectQuery.h>
+#include <Interpreters/InterpreterExplainQuery.h>
+#include <IO/WriteHelpers.h>
+#include <Common/typeid_cast.h>
+
+
+namespace DB
+{
+
+BlockIO InterpreterExplainQuery::execute()
+{
+    BlockIO res;
+    res.in = executeImpl();
+    res.in_sample = getSampleBlock();
+
+    return res;
+}
+
+
+Block InterpreterExplainQuery::getSampleBlock()
+{
+    Block block;
+
+    ColumnWithTypeAndName col;
+    col.name = "explain";
+    col.type = std::make_shared<DataTypeString>();
+    col.column = col.type->createColumn();
+    block.insert(col);
+
+    return block;
+}
+
+
+BlockInputStreamPtr InterpreterExplainQuery::executeImpl()
+{
+    const ASTExplainQuery & ast = typeid_cast<const ASTExplainQuery &>(*query_ptr);
+
+    /** Build the pipeline of the SELECT query, but do not run it.
+      * Index selection happens in storages while the pipeline is being built,
+      *  and the storages report it through the ExplainInfo attached to the context.
+      */
+    ExplainInfo explain_info;
+    Context explain_context = context;
+    explain_context.setExplainInfo(&explain_info);
+
+    /// The interpreter and the storage optimizers modify the query (e.g. move WHERE to PREWHERE) - work on a copy.
+    ASTPtr select = ast.query->clone();
+    InterpreterSelectQuery interpreter(select, explain_context, QueryProcessingStage::Complete);
+    BlockIO select_io = interpreter.execute();
+
+    ColumnWithTypeAndName col{std::make_shared<ColumnString>(), std::make_shared<DataTypeString>(), "explain"};
+
+    col.column->insert(String("Pipeline:"));
+    {
+        std::stringstream pipeline;
+        select_io.in->dumpTree(pipeline);
+
+        std::string line;
+        while (std::getline(pipeline, line))
+            col.column->insert(" " + line);
+    }
+
+    for (const auto & table : explain_info.table_reads)
+    {
+        col.column->insert("Read " + table.database + "." + table.table
+            + ": " + toString(table.parts_by_date) + " parts by date, "
+            + toString(table.parts_by_key) + " parts by primary key, "
+            + toString(table.marks) + " marks to read from " + toString(table.ranges) + " ranges, approx. "
+            + toString(table.rows_approx) + " rows");
+
+        col.column->insert(" Key condition: " + table.key_condition);
+
+        if (!table.skip_index_condition.empty())
+            col.column->insert(" Skip index condition: " + table.skip_index_condition);
+
+        if (!table.minmax_index_condition.empty())
+            col.column->insert(" MinMax index condition: " + table.minmax_index_condition);
+
+        col.column->insert(table.prewhere_column.empty()
+            ? String(" No PREWHERE")
+            : " PREWHERE: " + table.prewhere_column);
+    }
+
+    return std::make_shared<OneBlockInputStream>(Block{col});
+}
+
+}
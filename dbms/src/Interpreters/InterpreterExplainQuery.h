@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Interpreters/IInterpreter.h>
+
+
+namespace DB
+{
+
+class Context;
+class IAST;
+using ASTPtr = std::shared_ptr<IAST>;
+
+
+/** Build the pipeline of a SELECT query without executing it and report
+  *  how the indexes would be used: parts/marks/rows selected per table,
+  *  the primary key and minmax index conditions, the PREWHERE placement
+  *  and the chosen pipeline stages.
+  */
+class InterpreterExplainQuery : public IInterpreter
+{
+public:
+    InterpreterExplainQuery(const ASTPtr & query_ptr_, const Context & context_)
+        : query_ptr(query_ptr_), context(context_) {}
+
+    BlockIO execute() override;
+
+private:
+    ASTPtr query_ptr;
+    const Context & context;
+
+    Block getSampleBlock();
+    BlockInputStreamPtr executeImpl();
+};
+
+
+}
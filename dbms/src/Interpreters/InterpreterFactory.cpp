@@ -1,5 +1,6 @@
 #include <Parsers/ASTInsertQuery.h>
 #include <Parsers/ASTSelectQuery.h>
+#include <Parsers/ASTExplainQuery.h>
 #include <Parsers/ASTCreateQuery.h>
 #include <Parsers/ASTDropQuery.h>
 #include <Parsers/ASTRenameQuery.h>
@@ -14,6 +15,7 @@
 #include <Parsers/ASTKillQueryQuery.h>
 
 #include <Interpreters/InterpreterSelectQuery.h>
+#include <Interpreters/InterpreterExplainQuery.h>
 #include <Interpreters/InterpreterInsertQuery.h>
 #include <Interpreters/InterpreterCreateQuery.h>
 #include <Interpreters/InterpreterDropQuery.h>
@@ -59,6 +61,10 @@ std::unique_ptr<IInterpreter> InterpreterFactory::get(ASTPtr & query, Context &
     {
         return std::make_unique<InterpreterSelectQuery>(query, context, stage);
     }
+    else if (typeid_cast<ASTExplainQuery *>(query.get()))
+    {
+        return std::make_unique<InterpreterExplainQuery>(query, context);
+    }
     else if (typeid_cast<ASTInsertQuery *>(query.get()))
     {
         throwIfReadOnly(context);
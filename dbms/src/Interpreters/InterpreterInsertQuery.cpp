@@ -7,16 +7,20 @@
 #include <DataStreams/AddingDefaultBlockOutputStream.h>
 #include <DataStreams/PushingToViewsBlockOutputStream.h>
 #include <DataStreams/NullAndDoCopyBlockInputStream.h>
+#include <DataStreams/ParallelizingBlockOutputStream.h>
 #include <DataStreams/SquashingBlockOutputStream.h>
 #include <DataStreams/CountingBlockOutputStream.h>
 #include <DataStreams/NullableAdapterBlockInputStream.h>
 #include <DataStreams/CastTypeBlockInputStream.h>
 #include <DataStreams/copyData.h>
 
+#include <Parsers/ASTAsterisk.h>
 #include <Parsers/ASTInsertQuery.h>
 #include <Parsers/ASTSelectQuery.h>
 #include <Parsers/ASTIdentifier.h>
 
+#include <Storages/StorageMergeTree.h>
+
 #include <Interpreters/InterpreterSelectQuery.h>
 #include <Interpreters/InterpreterInsertQuery.h>
 
@@ -34,6 +38,25 @@ namespace ErrorCodes
     extern const int NO_SUCH_COLUMN_IN_TABLE;
 }
 
+namespace
+{
+
+/// Is this a plain `SELECT * FROM table` without any filtering or transformation of the rows?
+bool isTrivialSelectAll(const ASTSelectQuery & select)
+{
+    if (select.distinct || select.prewhere_expression || select.where_expression
+        || select.group_expression_list || select.having_expression || select.order_expression_list
+        || select.limit_by_expression_list || select.limit_length
+        || select.array_join_expression_list() || select.join()
+        || select.sample_size() || select.final() || select.next_union_all)
+        return false;
+
+    const auto & children = select.select_expression_list->children;
+    return children.size() == 1 && typeid_cast<const ASTAsterisk *>(children[0].get());
+}
+
+}
+
 
 InterpreterInsertQuery::InterpreterInsertQuery(const ASTPtr & query_ptr_, const Context & context_)
     : query_ptr(query_ptr_), context(context_)
@@ -88,23 +111,75 @@ BlockIO InterpreterInsertQuery::execute()
 
     auto table_lock = table->lockStructure(true, __PRETTY_FUNCTION__);
 
+    /// INSERT SELECT * from a MergeTree table into another one with exactly the same structure
+    /// degenerates into a file-level copy of the source parts, bypassing decompression,
+    /// type conversion, squashing and re-compression of every block.
+    if (query.select && !query.columns)
+    {
+        if (const ASTSelectQuery * select = typeid_cast<const ASTSelectQuery *>(query.select.get()))
+        {
+            if (isTrivialSelectAll(*select) && select->table() && typeid_cast<const ASTIdentifier *>(select->table().get()))
+            {
+                String source_database = select->database()
+                    ? typeid_cast<const ASTIdentifier &>(*select->database()).name : context.getCurrentDatabase();
+                String source_table_name = typeid_cast<const ASTIdentifier &>(*select->table()).name;
+
+                StoragePtr source_table = context.getTable(source_database, source_table_name);
+
+                auto * dst = typeid_cast<StorageMergeTree *>(table.get());
+                auto * src = typeid_cast<StorageMergeTree *>(source_table.get());
+
+                /// Materialized views must still be fed through the block pipeline.
+                if (dst && src && dst != src
+                    && context.getDependencies(query.database, query.table).empty()
+                    && dst->getData().hasSameStructureAs(src->getData()))
+                {
+                    auto source_table_lock = source_table->lockStructure(false, __PRETTY_FUNCTION__);
+                    dst->clonePartsFrom(*src);
+                    return {};
+                }
+            }
+        }
+    }
+
     NamesAndTypesListPtr required_columns = std::make_shared<NamesAndTypesList>(table->getColumnsList());
 
     /// We create a pipeline of several streams, into which we will write data.
-    BlockOutputStreamPtr out;
+    auto create_sink = [&]() -> BlockOutputStreamPtr
+    {
+        BlockOutputStreamPtr sink;
+
+        sink = std::make_shared<PushingToViewsBlockOutputStream>(query.database, query.table, context, query_ptr);
+
+        sink = std::make_shared<MaterializingBlockOutputStream>(sink);
+
+        sink = std::make_shared<AddingDefaultBlockOutputStream>(sink,
+            required_columns, table->column_defaults, context, static_cast<bool>(context.getSettingsRef().strict_insert_defaults));
 
-    out = std::make_shared<PushingToViewsBlockOutputStream>(query.database, query.table, context, query_ptr);
+        sink = std::make_shared<ProhibitColumnsBlockOutputStream>(sink, table->materialized_columns);
 
-    out = std::make_shared<MaterializingBlockOutputStream>(out);
+        sink = std::make_shared<SquashingBlockOutputStream>(sink,
+            context.getSettingsRef().min_insert_block_size_rows,
+            context.getSettingsRef().min_insert_block_size_bytes);
 
-    out = std::make_shared<AddingDefaultBlockOutputStream>(out,
-        required_columns, table->column_defaults, context, static_cast<bool>(context.getSettingsRef().strict_insert_defaults));
+        return sink;
+    };
 
-    out = std::make_shared<ProhibitColumnsBlockOutputStream>(out, table->materialized_columns);
+    BlockOutputStreamPtr out;
+
+    /// For INSERT SELECT the writing side (sorting, compression, forming of parts) can be
+    /// parallelized over several independent sinks, see the max_insert_threads setting.
+    size_t num_sinks = query.select ? static_cast<size_t>(context.getSettingsRef().max_insert_threads) : 0;
+    if (num_sinks > 1)
+    {
+        std::vector<BlockOutputStreamPtr> sinks(num_sinks);
+        for (auto & sink : sinks)
+            sink = create_sink();
 
-    out = std::make_shared<SquashingBlockOutputStream>(out,
-        context.getSettingsRef().min_insert_block_size_rows,
-        context.getSettingsRef().min_insert_block_size_bytes);
+        out = std::make_shared<ParallelizingBlockOutputStream>(std::move(sinks));
+    }
+    else
+        out = create_sink();
 
     auto out_wrapper = std::make_shared<CountingBlockOutputStream>(out);
     out_wrapper->setProcessListElement(context.getProcessListElement());
@@ -2,6 +2,7 @@
 
 #include <DataStreams/ExpressionBlockInputStream.h>
 #include <DataStreams/FilterBlockInputStream.h>
+#include <DataStreams/AdaptiveFilterBlockInputStream.h>
 #include <DataStreams/LimitBlockInputStream.h>
 #include <DataStreams/LimitByBlockInputStream.h>
 #include <DataStreams/PartialSortingBlockInputStream.h>
@@ -15,12 +16,16 @@
 #include <DataStreams/ParallelAggregatingBlockInputStream.h>
 #include <DataStreams/DistinctBlockInputStream.h>
 #include <DataStreams/DistinctSortedBlockInputStream.h>
+#include <DataStreams/DistinctOrderedLimitBlockInputStream.h>
 #include <DataStreams/NullBlockInputStream.h>
 #include <DataStreams/TotalsHavingBlockInputStream.h>
 #include <DataStreams/copyData.h>
 #include <DataStreams/CreatingSetsBlockInputStream.h>
 #include <DataStreams/MaterializingBlockInputStream.h>
 #include <DataStreams/ConcatBlockInputStream.h>
+#include <DataStreams/OneBlockInputStream.h>
+#include <DataStreams/AggregatingInOrderBlockInputStream.h>
+#include <DataStreams/ApproximateTopKBlockInputStream.h>
 
 #include <Parsers/ASTSelectQuery.h>
 #include <Parsers/ASTIdentifier.h>
@@ -32,6 +37,7 @@
 #include <Interpreters/InterpreterSelectQuery.h>
 #include <Interpreters/InterpreterSetQuery.h>
 #include <Interpreters/ExpressionAnalyzer.h>
+#include <Interpreters/ProcessList.h>
 #include <Storages/MergeTree/MergeTreeWhereOptimizer.h>
 
 #include <Storages/IStorage.h>
@@ -42,6 +48,7 @@
 #include <TableFunctions/TableFunctionFactory.h>
 
 #include <Core/Field.h>
+#include <Columns/ColumnsNumber.h>
 #include <Common/Collator.h>
 #include <Common/typeid_cast.h>
 
@@ -442,6 +449,10 @@ void InterpreterSelectQuery::executeSingleQuery()
 
     union_within_single_query = false;
 
+    /// Sometimes count()/min()/max() can be answered from the table metadata, with no reading pipeline at all.
+    if (executeTrivialCount())
+        return;
+
     /** Take out the data from Storage. from_stage - to what stage the request was completed in Storage. */
     QueryProcessingStage::Enum from_stage = executeFetchColumns();
 
@@ -495,6 +506,10 @@ void InterpreterSelectQuery::executeSingleQuery()
                 const ASTTableJoin & join = static_cast<const ASTTableJoin &>(*query.join()->table_join);
                 if (join.kind == ASTTableJoin::Kind::Full || join.kind == ASTTableJoin::Kind::Right)
                     stream_with_non_joined_data = before_join->createStreamWithNonJoinedDataIfFullOrRightJoin(settings.max_block_size);
+                else
+                    /// A LEFT or INNER JOIN could spill to disk (see max_bytes_before_external_join);
+                    ///  then the spilled rows are joined after the main streams, in the same delayed manner.
+                    stream_with_non_joined_data = before_join->createStreamWithExternallyJoinedDataIfExternalJoin();
             }
 
             if (query_analyzer->appendWhere(chain, !first_stage))
@@ -535,6 +550,15 @@ void InterpreterSelectQuery::executeSingleQuery()
             chain.clear();
         }
 
+        /// Fuse chains of simple functions in the expressions into loops compiled at runtime.
+        if (settings.compile_expressions)
+        {
+            for (const auto & expression : {before_join, before_where, before_aggregation, before_having,
+                    before_order_and_select, final_projection})
+                if (expression)
+                    expression->compileFunctions(context.getCompiler(), settings.min_count_to_compile);
+        }
+
         /** If there is no data.
          *  This check is specially postponed slightly lower than it could be (immediately after executeFetchColumns),
          *  for the query to be analyzed, and errors (for example, type mismatches) could be found in it.
@@ -565,6 +589,28 @@ void InterpreterSelectQuery::executeSingleQuery()
             to_stage > QueryProcessingStage::WithMergeableState &&
             !query.group_by_with_totals;
 
+        /// GROUP BY one key with a single count(), ordered by that count descending, with a LIMIT:
+        ///  may be answered approximately with a bounded sketch (opt-in, see executeAggregation).
+        approximate_topk =
+            settings.optimize_approximate_topk &&
+            first_stage && second_stage &&      /// the whole query is executed on this server
+            need_aggregate && aggregate_final && !aggregate_overflow_row && !aggregate_in_pk_order &&
+            !has_join && !has_having && !query.distinct && !query.limit_by_expression_list &&
+            query.limit_length &&
+            isTopKByCountPattern();
+
+        /// SELECT DISTINCT with ORDER BY and LIMIT: DISTINCT, the sort and the LIMIT may be fused
+        ///  into one bounded operator (opt-in, see executeDistinct and executeOrder).
+        /// The max_rows/max_bytes_in_distinct limits cannot be tracked by the fused operator,
+        ///  which never holds the whole distinct set - do not fuse when they are set.
+        distinct_ordered_limit =
+            settings.optimize_distinct_order_by_limit &&
+            first_stage && second_stage &&      /// the whole query is executed on this server
+            query.distinct && has_order_by && query.limit_length &&
+            !has_join && !query.limit_by_expression_list &&
+            !settings.limits.max_rows_in_distinct && !settings.limits.max_bytes_in_distinct &&
+            orderByFitsDistinctColumns(selected_columns);
+
         if (first_stage)
         {
             if (has_join)
@@ -704,6 +750,113 @@ static void getLimitLengthAndOffset(ASTSelectQuery & query, size_t & length, siz
     }
 }
 
+bool InterpreterSelectQuery::executeTrivialCount()
+{
+    const Settings & settings = context.getSettingsRef();
+
+    /** The query must consist only of count(), min(column) and max(column) over a table, with
+      *  nothing else except an optional WHERE; whether the WHERE and the min/max columns are
+      *  answerable from the metadata is up to the storage.
+      */
+    if (!settings.optimize_trivial_count_query
+        || to_stage != QueryProcessingStage::Complete
+        || !hasNoData()    /// Data could have been passed in directly, bypassing the table.
+        || !storage
+        || !query_analyzer->hasAggregation()
+        || query.distinct
+        || query.prewhere_expression
+        || query.group_expression_list
+        || query.having_expression
+        || query.order_expression_list
+        || query.limit_by_expression_list
+        || query.limit_length
+        || query.group_by_with_totals
+        || query.join()
+        || query.array_join_expression_list()
+        || query.sample_size()
+        || query.final())
+        return false;
+
+    Names key_names;
+    AggregateDescriptions aggregates;
+    query_analyzer->getAggregateInfo(key_names, aggregates);
+
+    if (!key_names.empty() || aggregates.empty())
+        return false;
+
+    for (const auto & aggregate : aggregates)
+    {
+        if (!aggregate.parameters.empty())
+            return false;
+
+        const String & function_name = aggregate.function->getName();
+        if (function_name == "count")
+        {
+            if (!aggregate.argument_names.empty())
+                return false;
+        }
+        else if (function_name == "min" || function_name == "max")
+        {
+            if (aggregate.argument_names.size() != 1)
+                return false;
+        }
+        else
+            return false;
+    }
+
+    /// The SELECT list must be those aggregates alone, otherwise expressions on top of them would be lost.
+    for (const auto & child : query.select_expression_list->children)
+    {
+        const String column_name = child->getColumnName();
+        if (aggregates.end() == std::find_if(aggregates.begin(), aggregates.end(),
+            [&] (const AggregateDescription & aggregate) { return aggregate.column_name == column_name; }))
+            return false;
+    }
+
+    SelectQueryInfo query_info;
+    query_info.query = query_ptr;
+    query_info.sets = query_analyzer->getPreparedSets();
+
+    Block block;
+    for (const auto & child : query.select_expression_list->children)
+    {
+        const String column_name = child->getColumnName();
+        const AggregateDescription & aggregate = *std::find_if(aggregates.begin(), aggregates.end(),
+            [&] (const AggregateDescription & candidate) { return candidate.column_name == column_name; });
+
+        DataTypePtr type = aggregate.function->getReturnType();
+        ColumnPtr column;
+
+        if (aggregate.function->getName() == "count")
+        {
+            auto num_rows = storage->totalRowsByMetadata(query_info, context);
+            if (!num_rows)
+                return false;
+
+            column = std::make_shared<ColumnUInt64>(1, *num_rows);
+        }
+        else
+        {
+            auto value = storage->extremeOfColumnByMetadata(
+                aggregate.function->getName() == "min", aggregate.argument_names[0], query_info, context);
+            if (!value)
+                return false;
+
+            column = type->createColumn();
+            /// Null means no matching rows - min/max return the default value then.
+            column->insert(value->isNull() ? type->getDefault() : *value);
+        }
+
+        block.insert(ColumnWithTypeAndName(column, type, child->getAliasOrColumnName()));
+    }
+
+    streams.emplace_back(std::make_shared<OneBlockInputStream>(block));
+
+    LOG_DEBUG(log, "Aggregates are answered from the table metadata");
+    return true;
+}
+
+
 QueryProcessingStage::Enum InterpreterSelectQuery::executeFetchColumns()
 {
     if (!hasNoData())
@@ -841,6 +994,17 @@ QueryProcessingStage::Enum InterpreterSelectQuery::executeFetchColumns()
         if (max_streams == 0)
             throw Exception("Logical error: zero number of streams requested", ErrorCodes::LOGICAL_ERROR);
 
+        /** Under concurrency, shrink the pipeline so that the total number of runnable threads
+          *  of all queries stays near the number of cores, instead of max_threads per query.
+          * The tokens are returned when the query finishes. Note that for data that is small,
+          *  the number of streams is reduced further by the storage (spreadMarkRangesAmongStreams).
+          */
+        if (settings.adaptive_max_threads && max_streams > 1 && !is_remote)
+        {
+            if (ProcessListElement * process_list_elem = context.getProcessListElement())
+                max_streams = context.getProcessList().acquireThreadTokens(*process_list_elem, max_streams);
+        }
+
         /// If necessary, we request more sources than the number of threads - to distribute the work evenly over the threads.
         if (max_streams > 1 && !is_remote)
             max_streams *= settings.max_streams_to_max_threads_ratio;
@@ -849,7 +1013,7 @@ QueryProcessingStage::Enum InterpreterSelectQuery::executeFetchColumns()
         query_info.query = query_ptr;
         query_info.sets = query_analyzer->getPreparedSets();
 
-        /// PREWHERE optimization
+        /// MergeTree-specific optimizations
         {
             auto optimize_prewhere = [&](auto & merge_tree)
             {
@@ -858,10 +1022,87 @@ QueryProcessingStage::Enum InterpreterSelectQuery::executeFetchColumns()
                     MergeTreeWhereOptimizer{query_info, context, merge_tree.getData(), required_columns, log};
             };
 
+            /// If the ORDER BY is a prefix of the primary key, ask the storage for streams that are
+            ///  already in the required order, so that the sort can be replaced with a cheap merge.
+            auto optimize_read_in_order = [&](auto & merge_tree)
+            {
+                if (!settings.optimize_read_in_order
+                    || !query.order_expression_list
+                    || query_analyzer->hasAggregation()
+                    || query.distinct
+                    || query.final()
+                    || query.join()
+                    || query.array_join_expression_list())
+                    return;
+
+                const SortDescription pk_descr = merge_tree.getData().getSortDescription();
+                const ASTs & order_by = query.order_expression_list->children;
+
+                if (order_by.size() > pk_descr.size())
+                    return;
+
+                /// All directions must coincide: ascending gives the natural order of the parts,
+                ///  descending makes the storage walk the mark ranges from the end ("latest N events").
+                const int direction = typeid_cast<const ASTOrderByElement &>(*order_by[0]).direction;
+
+                for (size_t i = 0; i < order_by.size(); ++i)
+                {
+                    const ASTOrderByElement & elem = typeid_cast<const ASTOrderByElement &>(*order_by[i]);
+                    if (elem.direction != direction || elem.collation
+                        || elem.children.front()->getColumnName() != pk_descr[i].column_name)
+                        return;
+                }
+
+                query_info.read_in_pk_order = read_in_pk_order = true;
+                query_info.read_in_pk_order_reverse = (direction == -1);
+            };
+
+            /// If the GROUP BY keys form a prefix of the primary key, the streams can likewise be read
+            ///  in the order of the key and aggregated group by group, keeping a single group in memory.
+            auto optimize_aggregation_in_order = [&](auto & merge_tree)
+            {
+                if (!settings.optimize_aggregation_in_order
+                    || !query_analyzer->hasAggregation()
+                    || to_stage != QueryProcessingStage::Complete
+                    || query.group_by_with_totals
+                    || query.final()
+                    || query.join()
+                    || query.array_join_expression_list())
+                    return;
+
+                Names key_names;
+                AggregateDescriptions aggregates;
+                query_analyzer->getAggregateInfo(key_names, aggregates);
+
+                const SortDescription pk_descr = merge_tree.getData().getSortDescription();
+
+                if (key_names.empty() || key_names.size() > pk_descr.size())
+                    return;
+
+                /// The keys must be exactly the first `key_names.size()` columns of the primary key, in any order.
+                for (size_t i = 0; i < key_names.size(); ++i)
+                    if (key_names.end() == std::find(key_names.begin(), key_names.end(), pk_descr[i].column_name))
+                        return;
+
+                for (size_t i = 0; i < key_names.size(); ++i)
+                    aggregate_in_pk_order_descr.emplace_back(pk_descr[i].column_name, 1, 1);
+
+                query_info.read_in_pk_order = true;
+                aggregate_in_pk_order = true;
+            };
+
             if (const StorageMergeTree * merge_tree = typeid_cast<const StorageMergeTree *>(storage.get()))
+            {
                 optimize_prewhere(*merge_tree);
+                optimize_read_in_order(*merge_tree);
+                optimize_aggregation_in_order(*merge_tree);
+            }
             else if (const StorageReplicatedMergeTree * merge_tree = typeid_cast<const StorageReplicatedMergeTree *>(storage.get()))
+            {
                 optimize_prewhere(*merge_tree);
+                optimize_read_in_order(*merge_tree);
+                optimize_aggregation_in_order(*merge_tree);
+            }
         }
 
         streams = storage->read(required_columns, query_info, context, from_stage, max_block_size, max_streams);
@@ -918,8 +1159,126 @@ QueryProcessingStage::Enum InterpreterSelectQuery::executeFetchColumns()
 }
 
 
+/// Whether the expression is an identifier of a real table column, a literal, or a tuple of literals
+///  (the right side of IN).
+static bool isColumnOrLiteral(const ASTPtr & ast, const NamesAndTypesList & columns)
+{
+    if (typeid_cast<const ASTLiteral *>(ast.get()))
+        return true;
+
+    if (const ASTIdentifier * identifier = typeid_cast<const ASTIdentifier *>(ast.get()))
+    {
+        if (identifier->kind != ASTIdentifier::Column)
+            return false;
+
+        for (const auto & column : columns)
+            if (column.name == identifier->name)
+                return true;
+
+        return false;
+    }
+
+    if (const ASTFunction * function = typeid_cast<const ASTFunction *>(ast.get()))
+    {
+        if (function->name != "tuple")
+            return false;
+
+        for (const auto & child : function->arguments->children)
+            if (!typeid_cast<const ASTLiteral *>(child.get()))
+                return false;
+
+        return true;
+    }
+
+    return false;
+}
+
+/// Whether the conjunct is deterministic and cheap enough to be evaluated separately
+///  (and, necessarily, twice - the main filter evaluates the whole expression anyway).
+static bool isCheapConjunct(const ASTPtr & ast, const NamesAndTypesList & columns)
+{
+    const ASTFunction * function = typeid_cast<const ASTFunction *>(ast.get());
+    if (!function)
+        return false;
+
+    if (function->name != "equals" && function->name != "notEquals"
+        && function->name != "less" && function->name != "greater"
+        && function->name != "lessOrEqual" && function->name != "greaterOrEqual"
+        && function->name != "in" && function->name != "notIn")
+        return false;
+
+    for (const auto & argument : function->arguments->children)
+        if (!isColumnOrLiteral(argument, columns))
+            return false;
+
+    return true;
+}
+
+static AdaptiveFilterBlockInputStream::Conjuncts getCheapWhereConjuncts(
+    const ASTSelectQuery & query, const Context & context, const StoragePtr & storage,
+    const NamesAndTypesList & columns)
+{
+    AdaptiveFilterBlockInputStream::Conjuncts res;
+
+    const ASTFunction * function = typeid_cast<const ASTFunction *>(query.where_expression.get());
+    if (!function || function->name != "and")
+        return res;
+
+    const ASTs & arguments = function->arguments->children;
+
+    size_t num_cheap = 0;
+    for (const auto & argument : arguments)
+        if (isCheapConjunct(argument, columns))
+            ++num_cheap;
+
+    /// Pre-filtering only makes sense when there is something expensive left to protect from extra rows.
+    if (!num_cheap || num_cheap == arguments.size())
+        return res;
+
+    for (const auto & argument : arguments)
+    {
+        if (!isCheapConjunct(argument, columns))
+            continue;
+
+        try
+        {
+            AdaptiveFilterBlockInputStream::Conjunct conjunct;
+            conjunct.result_name = argument->getColumnName();
+            conjunct.actions = ExpressionAnalyzer(argument->clone(), context, storage, columns).getActions(false);
+            res.emplace_back(std::move(conjunct));
+        }
+        catch (...)
+        {
+            /// The conjunct cannot be evaluated on the source columns alone
+            ///  (e.g. it refers to an alias of the SELECT list) - leave it to the main filter.
+        }
+    }
+
+    return res;
+}
+
+
 void InterpreterSelectQuery::executeWhere(ExpressionActionsPtr expression)
 {
+    const Settings & settings = context.getSettingsRef();
+
+    /** First filter the blocks by the cheap conjuncts of the WHERE, in an adaptively chosen order,
+      *  so that the rest of the expression sees fewer rows (see AdaptiveFilterBlockInputStream).
+      * With ARRAY JOIN or JOIN the conjuncts may refer to columns that do not exist
+      *  before these operations, so the optimization is not applied.
+      */
+    if (settings.optimize_conjunct_order && !query.join() && !query.array_join_expression_list())
+    {
+        AdaptiveFilterBlockInputStream::Conjuncts conjuncts
+            = getCheapWhereConjuncts(query, context, storage, table_column_names);
+
+        if (!conjuncts.empty())
+            transformStreams([&](auto & stream)
+            {
+                stream = std::make_shared<AdaptiveFilterBlockInputStream>(stream, conjuncts);
+            });
+    }
+
     transformStreams([&](auto & stream)
     {
         stream = std::make_shared<FilterBlockInputStream>(stream, expression, query.where_expression->getColumnName());
@@ -940,11 +1299,54 @@ void InterpreterSelectQuery::executeAggregation(ExpressionActionsPtr expression,
 
     const Settings & settings = context.getSettingsRef();
 
+    /** The streams are sorted by the GROUP BY keys (see executeFetchColumns): merge them and
+      *  aggregate group by group, without a hash table with all the groups.
+      * In this mode the aggregation is always finalized and there is no overflow row
+      *  (WITH TOTALS and a GROUP BY limit reached via `any` would need one - they are excluded there).
+      */
+    if (aggregate_in_pk_order)
+    {
+        if (hasMoreThanOneStream())
+        {
+            streams[0] = std::make_shared<MergingSortedBlockInputStream>(streams, aggregate_in_pk_order_descr, settings.max_block_size);
+            streams.resize(1);
+        }
+
+        streams[0] = std::make_shared<AggregatingInOrderBlockInputStream>(streams[0], key_names, aggregates);
+        return;
+    }
+
+    /** Approximate top-K by count: per-thread SpaceSaving sketches merged at the end, instead of
+      *  the full aggregate table. Memory is bounded regardless of the key cardinality, and only
+      *  a small multiple of the LIMIT of candidate groups is left for the following ORDER BY.
+      */
+    if (approximate_topk)
+    {
+        const ColumnWithTypeAndName & key = expression->getSampleBlock().getByName(key_names[0]);
+
+        if (ApproximateTopKBlockInputStream::isSupportedKeyType(key.type))
+        {
+            size_t limit_length = 0;
+            size_t limit_offset = 0;
+            getLimitLengthAndOffset(query, limit_length, limit_offset);
+
+            streams[0] = std::make_shared<ApproximateTopKBlockInputStream>(
+                streams, key.name, key.type, aggregates[0].column_name,
+                limit_length + limit_offset, max_streams);
+            streams.resize(1);
+            return;
+        }
+    }
+
     /** Two-level aggregation is useful in two cases:
       * 1. Parallel aggregation is done, and the results should be merged in parallel.
       * 2. An aggregation is done with store of temporary data on the disk, and they need to be merged in a memory efficient way.
       */
-    bool allow_to_use_two_level_group_by = streams.size() > 1 || settings.limits.max_bytes_before_external_group_by != 0;
+    bool allow_to_use_two_level_group_by = streams.size() > 1 || settings.limits.max_bytes_before_external_group_by != 0
+        /// 3. The mergeable state is sent to the initiator of a distributed query: it may have requested
+        ///  two-level blocks explicitly (group_by_two_level_threshold = 1, see StorageDistributed::read),
+        ///  to merge the states of the shards strictly bucket by bucket.
+        || (!final && to_stage == QueryProcessingStage::WithMergeableState);
 
     Aggregator::Params params(key_names, aggregates,
         overflow_row, settings.limits.max_rows_to_group_by, settings.limits.group_by_overflow_mode,
@@ -956,13 +1358,16 @@ void InterpreterSelectQuery::executeAggregation(ExpressionActionsPtr expression,
     /// If there are several sources, then we perform parallel aggregation
     if (streams.size() > 1)
     {
-        streams[0] = std::make_shared<ParallelAggregatingBlockInputStream>(
+        auto parallel_stream = std::make_shared<ParallelAggregatingBlockInputStream>(
             streams, stream_with_non_joined_data, params, final,
             max_streams,
             settings.aggregation_memory_efficient_merge_threads
                 ? static_cast<size_t>(settings.aggregation_memory_efficient_merge_threads)
                 : static_cast<size_t>(settings.max_threads));
 
+        parallel_stream->setNUMAAware(settings.numa_aware_parallel_processing);
+
+        streams[0] = parallel_stream;
         stream_with_non_joined_data = nullptr;
         streams.resize(1);
     }
@@ -1011,6 +1416,21 @@ void InterpreterSelectQuery::executeMergeAggregated(bool overflow_row, bool fina
 
     if (!settings.distributed_aggregation_memory_efficient)
     {
+        /** The sources deliver data from remote servers. We wrap them in AsynchronousBlockInputStream
+          *  with a deep queue, so that jitter of the network or of a single server is absorbed
+          *  by the prepared blocks instead of stalling the merge of aggregated data.
+          * In the memory-efficient mode this is not done: it deliberately keeps only one block
+          *  from each server in RAM.
+          */
+        if (settings.distributed_read_ahead_blocks > 1)
+        {
+            transformStreams([&](auto & stream)
+            {
+                stream = std::make_shared<AsynchronousBlockInputStream>(
+                    stream, settings.distributed_read_ahead_blocks, settings.distributed_read_ahead_max_bytes);
+            });
+        }
+
         /// We union several sources into one, parallelizing the work.
         executeUnion();
 
@@ -1102,6 +1522,45 @@ void InterpreterSelectQuery::executeOrder()
 
     const Settings & settings = context.getSettingsRef();
 
+    /// DISTINCT, the sort and the LIMIT were already fused in executeDistinct: every stream
+    ///  returns a bounded number of sorted distinct rows, they only have to be merged.
+    /// No limit on the merge - the streams may contain duplicates of each other's rows,
+    ///  which are removed only by the second DISTINCT pass after it.
+    if (distinct_ordered_limit)
+    {
+        if (hasMoreThanOneStream())
+        {
+            transformStreams([&](auto & stream)
+            {
+                stream = std::make_shared<AsynchronousBlockInputStream>(stream);
+            });
+
+            streams[0] = std::make_shared<MergingSortedBlockInputStream>(streams, order_descr, settings.max_block_size, 0);
+            streams.resize(1);
+        }
+        return;
+    }
+
+    /// The streams come from the storage in the required order (see executeFetchColumns):
+    ///  merging them is enough, no sort is needed.
+    if (read_in_pk_order)
+    {
+        if (hasMoreThanOneStream())
+        {
+            /** MergingSortedBlockInputStream reads the sources sequentially.
+              * To make the parts read in parallel, we wrap the sources in AsynchronousBlockInputStream.
+              */
+            transformStreams([&](auto & stream)
+            {
+                stream = std::make_shared<AsynchronousBlockInputStream>(stream);
+            });
+
+            streams[0] = std::make_shared<MergingSortedBlockInputStream>(streams, order_descr, settings.max_block_size, limit);
+            streams.resize(1);
+        }
+        return;
+    }
+
     transformStreams([&](auto & stream)
     {
         auto sorting_stream = std::make_shared<PartialSortingBlockInputStream>(stream, order_descr, limit);
@@ -1123,7 +1582,8 @@ void InterpreterSelectQuery::executeOrder()
     /// Merge the sorted blocks.
     streams[0] = std::make_shared<MergeSortingBlockInputStream>(
         streams[0], order_descr, settings.max_block_size, limit,
-        settings.limits.max_bytes_before_external_sort, context.getTemporaryPath());
+        settings.limits.max_bytes_before_external_sort, context.getTemporaryPath(),
+        settings.external_sort_merge_threads, settings.external_sort_max_merge_fan_in);
 }
 
 
@@ -1142,7 +1602,8 @@ void InterpreterSelectQuery::executeMergeSorted()
           */
         transformStreams([&](auto & stream)
         {
-            stream = std::make_shared<AsynchronousBlockInputStream>(stream);
+            stream = std::make_shared<AsynchronousBlockInputStream>(
+                stream, settings.distributed_read_ahead_blocks, settings.distributed_read_ahead_max_bytes);
         });
 
         /// Merge the sorted sources into one sorted source.
@@ -1171,6 +1632,22 @@ void InterpreterSelectQuery::executeDistinct(bool before_order, Names columns)
         size_t limit_offset = 0;
         getLimitLengthAndOffset(query, limit_length, limit_offset);
 
+        /// DISTINCT, the sort and the LIMIT at once: each stream keeps only its first
+        ///  limit_length + limit_offset distinct rows in the required order,
+        ///  and executeOrder then just merges the streams.
+        if (distinct_ordered_limit && before_order)
+        {
+            SortDescription order_descr = getSortDescription(query);
+
+            transformStreams([&](auto & stream)
+            {
+                stream = std::make_shared<DistinctOrderedLimitBlockInputStream>(
+                    stream, order_descr, columns, limit_length + limit_offset, read_in_pk_order);
+            });
+
+            return;
+        }
+
         size_t limit_for_distinct = 0;
 
         /// If after this stage of DISTINCT ORDER BY is not executed, then you can get no more than limit_length + limit_offset of different rows.
@@ -1182,7 +1659,7 @@ void InterpreterSelectQuery::executeDistinct(bool before_order, Names columns)
             if (stream->isGroupedOutput())
                 stream = std::make_shared<DistinctSortedBlockInputStream>(stream, settings.limits, limit_for_distinct, columns);
             else
-                stream = std::make_shared<DistinctBlockInputStream>(stream, settings.limits, limit_for_distinct, columns);
+                stream = std::make_shared<DistinctBlockInputStream>(stream, settings.limits, limit_for_distinct, columns, context.getTemporaryPath());
         });
 
         if (hasMoreThanOneStream())
@@ -1196,7 +1673,10 @@ void InterpreterSelectQuery::executeUnion()
     /// If there are still several streams, then we combine them into one
     if (hasMoreThanOneStream())
     {
-        streams[0] = std::make_shared<UnionBlockInputStream<>>(streams, stream_with_non_joined_data, max_streams);
+        auto union_stream = std::make_shared<UnionBlockInputStream<>>(streams, stream_with_non_joined_data, max_streams);
+        union_stream->setNUMAAware(context.getSettingsRef().numa_aware_parallel_processing);
+
+        streams[0] = union_stream;
         stream_with_non_joined_data = nullptr;
         streams.resize(1);
         union_within_single_query = false;
@@ -1342,6 +1822,49 @@ bool InterpreterSelectQuery::hasMoreThanOneStream() const
 }
 
 
+bool InterpreterSelectQuery::isTopKByCountPattern() const
+{
+    Names key_names;
+    AggregateDescriptions aggregates;
+    query_analyzer->getAggregateInfo(key_names, aggregates);
+
+    if (key_names.size() != 1 || aggregates.size() != 1)
+        return false;
+
+    const AggregateDescription & aggregate = aggregates[0];
+    if (aggregate.function->getName() != "count" || !aggregate.argument_names.empty() || !aggregate.parameters.empty())
+        return false;
+
+    /// The ORDER BY must be exactly that count, descending, without collation.
+    if (!query.order_expression_list || query.order_expression_list->children.size() != 1)
+        return false;
+
+    const ASTOrderByElement & order_by_elem = typeid_cast<const ASTOrderByElement &>(*query.order_expression_list->children.front());
+    if (order_by_elem.direction != -1 || order_by_elem.collation)
+        return false;
+
+    return order_by_elem.children.front()->getColumnName() == aggregate.column_name;
+}
+
+
+bool InterpreterSelectQuery::orderByFitsDistinctColumns(const Names & columns) const
+{
+    for (const auto & elem : query.order_expression_list->children)
+    {
+        const ASTOrderByElement & order_by_elem = typeid_cast<const ASTOrderByElement &>(*elem);
+        if (order_by_elem.collation)
+            return false;
+
+        /// Sorting by a column outside the DISTINCT set would have to pick one arbitrary value
+        ///  per distinct row - the fused operator cannot reproduce that.
+        if (columns.end() == std::find(columns.begin(), columns.end(), elem->children.front()->getColumnName()))
+            return false;
+    }
+
+    return true;
+}
+
+
 void InterpreterSelectQuery::ignoreWithTotals()
 {
     query.group_by_with_totals = false;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Core/QueryProcessingStage.h>
+#include <Core/SortDescription.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/IInterpreter.h>
 #include <Interpreters/ExpressionActions.h>
@@ -132,6 +133,11 @@ private:
     /// Fetch data from the table. Returns the stage to which the query was processed in Storage.
     QueryProcessingStage::Enum executeFetchColumns();
 
+    /// Try to answer a query of count()/min()/max() aggregates from the table metadata,
+    ///  see IStorage::totalRowsByMetadata and IStorage::extremeOfColumnByMetadata.
+    /// Returns whether it succeeded (then `streams` contains the ready result).
+    bool executeTrivialCount();
+
     void executeWhere(ExpressionActionsPtr expression);
     void executeAggregation(ExpressionActionsPtr expression, bool overflow_row, bool final);
     void executeMergeAggregated(bool overflow_row, bool final);
@@ -155,6 +161,14 @@ private:
 
     bool hasMoreThanOneStream() const;
 
+    /// Is the query of the form GROUP BY <one key> with a single count(), ORDER BY that count
+    ///  descending? (See approximate_topk.)
+    bool isTopKByCountPattern() const;
+
+    /// Is every ORDER BY element one of the DISTINCT columns, without COLLATE?
+    ///  (See distinct_ordered_limit.)
+    bool orderByFitsDistinctColumns(const Names & columns) const;
+
     void ignoreWithTotals();
 
     /** If there is a SETTINGS section in the SELECT query, then apply settings from it.
@@ -205,6 +219,23 @@ private:
     /// Do union of streams within a SELECT query?
     bool union_within_single_query = false;
 
+    /// The streams are read from the storage in the order of the primary key, which matches the ORDER BY
+    ///  of the query - then they just have to be merged, not sorted (see executeOrder).
+    bool read_in_pk_order = false;
+
+    /// The streams are read from the storage in the order of the primary key, whose prefix matches
+    ///  the GROUP BY keys - then they can be aggregated group by group (see executeAggregation).
+    bool aggregate_in_pk_order = false;
+    SortDescription aggregate_in_pk_order_descr;
+
+    /// The query is GROUP BY key ORDER BY count() DESC LIMIT n and may be answered approximately
+    ///  with a bounded SpaceSaving sketch (see executeAggregation and optimize_approximate_topk).
+    bool approximate_topk = false;
+
+    /// The query is SELECT DISTINCT ... ORDER BY ... LIMIT n: DISTINCT, the sort and the LIMIT
+    ///  are fused into one bounded operator (see executeDistinct and executeOrder).
+    bool distinct_ordered_limit = false;
+
     Poco::Logger * log;
 };
 
@@ -2,6 +2,7 @@
 #include <Interpreters/DNSCache.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/ExternalDictionaries.h>
+#include <Interpreters/Compiler.h>
 #include <Interpreters/EmbeddedDictionaries.h>
 #include <Parsers/ASTSystemQuery.h>
 #include <Common/typeid_cast.h>
@@ -95,6 +96,11 @@ BlockIO InterpreterSystemQuery::execute()
                 throw Exception(status.message, status.code);
             break;
         }
+        case Type::PRELOAD_COMPILED_EXPRESSIONS:
+            /// Open compiled libraries left from previous runs (e.g. laid out by a deploy),
+            ///  so that queries don't pay for dlopen.
+            context.getCompiler().preloadCachedLibraries();
+            break;
         case Type::STOP_LISTEN_QUERIES:
         case Type::START_LISTEN_QUERIES:
         case Type::RESTART_REPLICAS:
@@ -1,5 +1,9 @@
 #include <common/logger_useful.h>
 
+#include <Poco/TemporaryFile.h>
+
+#include <common/ThreadPool.h>
+
 #include <Columns/ColumnConst.h>
 #include <Columns/ColumnString.h>
 #include <Columns/ColumnFixedString.h>
@@ -8,10 +12,21 @@
 #include <DataTypes/DataTypeNullable.h>
 
 #include <Interpreters/Join.h>
+#include <Interpreters/Limits.h>
 #include <Interpreters/NullableUtils.h>
 
+#include <IO/WriteBufferFromFile.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/CompressedWriteBuffer.h>
+#include <IO/CompressedReadBuffer.h>
+
 #include <DataStreams/IProfilingBlockInputStream.h>
+#include <DataStreams/NativeBlockOutputStream.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <DataStreams/ConcatBlockInputStream.h>
 #include <Core/ColumnNumbers.h>
+#include <Common/ClickHouseRevision.h>
+#include <Common/SipHash.h>
 #include <Common/typeid_cast.h>
 
 
@@ -28,8 +43,39 @@ namespace ErrorCodes
 }
 
 
+/** Part of the rows of one of the tables of the external JOIN - in a temporary file, in Native format.
+  */
+struct Join::ExternalBucket
+{
+    Poco::TemporaryFile file;
+    WriteBufferFromFile file_buf;
+    CompressedWriteBuffer compressed_buf;
+    NativeBlockOutputStream out;
+    size_t rows = 0;
+
+    ExternalBucket(const String & tmp_path)
+        : file(tmp_path), file_buf(file.path()), compressed_buf(file_buf), out(compressed_buf, ClickHouseRevision::get())
+    {
+    }
+
+    void write(const Block & block)
+    {
+        out.write(block);
+        rows += block.rows();
+    }
+
+    void finishWriting()
+    {
+        out.flush();
+        compressed_buf.next();
+        file_buf.next();
+    }
+};
+
+
 Join::Join(const Names & key_names_left_, const Names & key_names_right_, bool use_nulls_,
-    const Limits & limits, ASTTableJoin::Kind kind_, ASTTableJoin::Strictness strictness_)
+    const Limits & limits, ASTTableJoin::Kind kind_, ASTTableJoin::Strictness strictness_,
+    const String & tmp_path_, size_t build_threads_)
     : kind(kind_), strictness(strictness_),
     key_names_left(key_names_left_),
     key_names_right(key_names_right_),
@@ -37,10 +83,23 @@ Join::Join(const Names & key_names_left_, const Names & key_names_right_, bool u
     log(&Logger::get("Join")),
     max_rows(limits.max_rows_in_join),
     max_bytes(limits.max_bytes_in_join),
-    overflow_mode(limits.join_overflow_mode)
+    overflow_mode(limits.join_overflow_mode),
+    max_bytes_before_external(limits.max_bytes_before_external_join),
+    tmp_path(tmp_path_),
+    build_threads(build_threads_)
 {
+    /// Spilling to disk is implemented only for LEFT and INNER JOINs: for them, after the switch,
+    ///  everything is decided within a pair of buckets with the same hash of the key.
+    external_join_possible = max_bytes_before_external && !tmp_path.empty()
+        && (kind == ASTTableJoin::Kind::Left || kind == ASTTableJoin::Kind::Inner);
+
+    /// Scattering into shards requires keys and does not combine with spilling to disk.
+    sharded = build_threads > 1 && !external_join_possible
+        && kind != ASTTableJoin::Kind::Cross && !key_names_right.empty();
 }
 
+Join::~Join() = default;
+
 
 Join::Type Join::chooseMethod(const ConstColumnPlainPtrs & key_columns, Sizes & key_sizes)
 {
@@ -201,6 +260,13 @@ size_t Join::getTotalRowCount() const
 {
     size_t res = 0;
 
+    if (sharded)
+    {
+        for (const auto & shard : shards)
+            res += shard->getTotalRowCount();
+        return res;
+    }
+
     if (type == Type::CROSS)
     {
         for (const auto & block : blocks)
@@ -221,6 +287,13 @@ size_t Join::getTotalByteCount() const
 {
     size_t res = 0;
 
+    if (sharded)
+    {
+        for (const auto & shard : shards)
+            res += shard->getTotalByteCount();
+        return res;
+    }
+
     if (type == Type::CROSS)
     {
         for (const auto & block : blocks)
@@ -232,7 +305,7 @@ size_t Join::getTotalByteCount() const
         res += getTotalByteCountImpl(maps_all, type);
         res += getTotalByteCountImpl(maps_any_full, type);
         res += getTotalByteCountImpl(maps_all_full, type);
-        res += pool.size();
+        res += pool->size();
     }
 
     return res;
@@ -249,6 +322,32 @@ bool Join::checkSizeLimits() const
 }
 
 
+bool Join::checkSizeLimitsAndOverflowMode() const
+{
+    if (!checkSizeLimits())
+    {
+        switch (overflow_mode)
+        {
+            case OverflowMode::THROW:
+                throw Exception("Join size limit exceeded."
+                    " Rows: " + toString(getTotalRowCount()) +
+                    ", limit: " + toString(max_rows) +
+                    ". Bytes: " + toString(getTotalByteCount()) +
+                    ", limit: " + toString(max_bytes) + ".",
+                    ErrorCodes::SET_SIZE_LIMIT_EXCEEDED);
+
+            case OverflowMode::BREAK:
+                return false;
+
+            default:
+                throw Exception("Logical error: unknown overflow mode", ErrorCodes::LOGICAL_ERROR);
+        }
+    }
+
+    return true;
+}
+
+
 static void convertColumnToNullable(ColumnWithTypeAndName & column)
 {
     if (column.type->isNullable() || column.type->isNull())
@@ -284,6 +383,9 @@ void Join::setSampleBlock(const Block & block)
     /// Choose data structure to use for JOIN.
     init(chooseMethod(key_columns, key_sizes));
 
+    /// Remember the whole sample to initialize the per-bucket JOINs if this JOIN spills to disk.
+    right_table_sample_block = block;
+
     sample_block_with_columns_to_add = block;
 
     /// Move from `sample_block_with_columns_to_add` key columns to `sample_block_with_keys`, keeping the order.
@@ -313,6 +415,17 @@ void Join::setSampleBlock(const Block & block)
     if (use_nulls && (kind == ASTTableJoin::Kind::Left || kind == ASTTableJoin::Kind::Full))
         for (size_t i = 0; i < num_columns_to_add; ++i)
             convertColumnToNullable(sample_block_with_columns_to_add.getByPosition(i));
+
+    if (sharded)
+    {
+        /// The shards are ordinary Joins; the size limits are checked for all of them together.
+        shards.reserve(build_threads);
+        for (size_t i = 0; i < build_threads; ++i)
+        {
+            shards.emplace_back(std::make_shared<Join>(key_names_left, key_names_right, use_nulls, Limits(), kind, strictness));
+            shards.back()->setSampleBlock(block);
+        }
+    }
 }
 
 
@@ -435,6 +548,12 @@ bool Join::insertFromBlock(const Block & block)
     if (empty())
         throw Exception("Logical error: Join was not initialized", ErrorCodes::LOGICAL_ERROR);
 
+    if (sharded)
+    {
+        insertFromBlockSharded(block);
+        return checkSizeLimitsAndOverflowMode();
+    }
+
     size_t keys_size = key_names_right.size();
     ConstColumnPlainPtrs key_columns(keys_size);
 
@@ -460,13 +579,22 @@ bool Join::insertFromBlock(const Block & block)
 
     size_t rows = block.rows();
 
+    if (external)
+    {
+        /// The hash table has been dropped; just scatter the block into the bucket files.
+        scatterBlockToBuckets(block, key_names_right, right_buckets);
+        return true;
+    }
+
     blocks.push_back(block);
     Block * stored_block = &blocks.back();
 
-    if (getFullness(kind))
+    if (getFullness(kind) || external_join_possible)
     {
         /** Transfer the key columns to the beginning of the block.
           * This is where NonJoinedBlockInputStream will wait for them.
+          * They are also kept if the JOIN could spill to disk: the stored blocks would have to be
+          *  scattered into the buckets by the key (see switchToExternal).
           */
         size_t key_num = 0;
         for (const auto & name : key_names_right)
@@ -498,7 +626,7 @@ bool Join::insertFromBlock(const Block & block)
     /// In case of LEFT and FULL joins, if use_nulls, convert joined columns to Nullable.
     if (use_nulls && (kind == ASTTableJoin::Kind::Left || kind == ASTTableJoin::Kind::Full))
     {
-        for (size_t i = getFullness(kind) ? keys_size : 0; i < size; ++i)
+        for (size_t i = (getFullness(kind) || external_join_possible) ? keys_size : 0; i < size; ++i)
         {
             convertColumnToNullable(stored_block->getByPosition(i));
         }
@@ -510,40 +638,204 @@ bool Join::insertFromBlock(const Block & block)
         if (!getFullness(kind))
         {
             if (strictness == ASTTableJoin::Strictness::Any)
-                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(type, maps_any, rows, key_columns, keys_size, key_sizes, stored_block, null_map, pool);
+                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(type, maps_any, rows, key_columns, keys_size, key_sizes, stored_block, null_map, *pool);
             else
-                insertFromBlockImpl<ASTTableJoin::Strictness::All>(type, maps_all, rows, key_columns, keys_size, key_sizes, stored_block, null_map, pool);
+                insertFromBlockImpl<ASTTableJoin::Strictness::All>(type, maps_all, rows, key_columns, keys_size, key_sizes, stored_block, null_map, *pool);
         }
         else
         {
             if (strictness == ASTTableJoin::Strictness::Any)
-                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(type, maps_any_full, rows, key_columns, keys_size, key_sizes, stored_block, null_map, pool);
+                insertFromBlockImpl<ASTTableJoin::Strictness::Any>(type, maps_any_full, rows, key_columns, keys_size, key_sizes, stored_block, null_map, *pool);
             else
-                insertFromBlockImpl<ASTTableJoin::Strictness::All>(type, maps_all_full, rows, key_columns, keys_size, key_sizes, stored_block, null_map, pool);
+                insertFromBlockImpl<ASTTableJoin::Strictness::All>(type, maps_all_full, rows, key_columns, keys_size, key_sizes, stored_block, null_map, *pool);
         }
     }
 
-    if (!checkSizeLimits())
+    blocks_bytes += stored_block->bytes();
+
+    if (external_join_possible && getTotalByteCount() + blocks_bytes > max_bytes_before_external)
     {
-        switch (overflow_mode)
+        switchToExternal();
+        return true;
+    }
+
+    return checkSizeLimitsAndOverflowMode();
+}
+
+
+/// Number of the part for each row - by a hash of the key, identical for the left and right tables.
+static IColumn::Selector createKeyHashSelector(const Block & block, const Names & key_names, size_t num_parts)
+{
+    size_t rows = block.rows();
+    size_t keys_size = key_names.size();
+    ConstColumnPlainPtrs key_columns(keys_size);
+
+    /// Rare case, when keys are constant. Materialize them to hash the values.
+    Columns materialized_columns;
+
+    for (size_t i = 0; i < keys_size; ++i)
+    {
+        key_columns[i] = block.getByName(key_names[i]).column.get();
+
+        if (auto converted = key_columns[i]->convertToFullColumnIfConst())
         {
-            case OverflowMode::THROW:
-                throw Exception("Join size limit exceeded."
-                    " Rows: " + toString(getTotalRowCount()) +
-                    ", limit: " + toString(max_rows) +
-                    ". Bytes: " + toString(getTotalByteCount()) +
-                    ", limit: " + toString(max_bytes) + ".",
-                    ErrorCodes::SET_SIZE_LIMIT_EXCEEDED);
+            materialized_columns.emplace_back(converted);
+            key_columns[i] = materialized_columns.back().get();
+        }
+    }
 
-            case OverflowMode::BREAK:
-                return false;
+    /** Hash the nested columns, without regard to Nullability, so that the rows of the left and right
+      *  tables with equal keys get the same part number.
+      * Rows with NULLs in the key never join to anything, so it does not matter where they get to.
+      */
+    ColumnPtr null_map_holder;
+    ConstNullMapPtr null_map{};
+    extractNestedColumnsAndNullMap(key_columns, null_map_holder, null_map);
 
-            default:
-                throw Exception("Logical error: unknown overflow mode", ErrorCodes::LOGICAL_ERROR);
+    IColumn::Selector selector(rows);
+    for (size_t i = 0; i < rows; ++i)
+    {
+        SipHash hash;
+        for (size_t j = 0; j < keys_size; ++j)
+            key_columns[j]->updateHashWithValue(i, hash);
+        selector[i] = hash.get64() % num_parts;
+    }
+
+    return selector;
+}
+
+
+static Blocks scatterBlockBySelector(const Block & block, const IColumn::Selector & selector, size_t num_parts)
+{
+    size_t num_columns = block.columns();
+    std::vector<Columns> scattered_columns(num_columns);
+    for (size_t i = 0; i < num_columns; ++i)
+    {
+        ColumnPtr col = block.getByPosition(i).column;
+        if (auto converted = col->convertToFullColumnIfConst())
+            col = converted;
+        scattered_columns[i] = col->scatter(num_parts, selector);
+    }
+
+    Blocks res(num_parts);
+    for (size_t part = 0; part < num_parts; ++part)
+    {
+        res[part] = block.cloneEmpty();
+        for (size_t i = 0; i < num_columns; ++i)
+            res[part].getByPosition(i).column = scattered_columns[i][part];
+    }
+
+    return res;
+}
+
+
+void Join::switchToExternal()
+{
+    LOG_DEBUG(log, "JOIN size exceeded max_bytes_before_external_join."
+        << " Scattering both tables into " << NUM_EXTERNAL_BUCKETS << " buckets in " << tmp_path);
+
+    right_buckets.reserve(NUM_EXTERNAL_BUCKETS);
+    left_buckets.reserve(NUM_EXTERNAL_BUCKETS);
+    for (size_t i = 0; i < NUM_EXTERNAL_BUCKETS; ++i)
+    {
+        right_buckets.emplace_back(std::make_unique<ExternalBucket>(tmp_path));
+        left_buckets.emplace_back(std::make_unique<ExternalBucket>(tmp_path));
+    }
+
+    /// The stored blocks have the key columns at the beginning - see insertFromBlock.
+    for (const auto & block : blocks)
+        scatterBlockToBuckets(block, key_names_right, right_buckets);
+
+    /// Drop the in-memory data: everything will be joined from the buckets.
+    external = true;
+    blocks.clear();
+    blocks_bytes = 0;
+    pool = std::make_unique<Arena>();
+    maps_any = MapsAny();
+    maps_all = MapsAll();
+    init(type);
+}
+
+
+void Join::scatterBlockToBuckets(const Block & block, const Names & key_names, ExternalBuckets & buckets) const
+{
+    if (!block.rows())
+        return;
+
+    Blocks bucket_blocks = scatterBlockBySelector(
+        block, createKeyHashSelector(block, key_names, NUM_EXTERNAL_BUCKETS), NUM_EXTERNAL_BUCKETS);
+
+    for (size_t bucket = 0; bucket < NUM_EXTERNAL_BUCKETS; ++bucket)
+        if (bucket_blocks[bucket].rows())
+            buckets[bucket]->write(bucket_blocks[bucket]);
+}
+
+
+void Join::insertFromBlockSharded(const Block & block)
+{
+    if (!build_pool)
+        build_pool = std::make_unique<ThreadPool>(build_threads);
+
+    size_t num_shards = shards.size();
+    Blocks shard_blocks = scatterBlockBySelector(
+        block, createKeyHashSelector(block, key_names_right, num_shards), num_shards);
+
+    /// The shards are disjoint, so they are built without contention; exceptions are rethrown by `wait`.
+    for (size_t i = 0; i < num_shards; ++i)
+        if (shard_blocks[i].rows())
+            build_pool->schedule([this, i, &shard_blocks] { shards[i]->insertFromBlock(shard_blocks[i]); });
+
+    build_pool->wait();
+}
+
+
+void Join::joinBlockSharded(Block & block) const
+{
+    size_t num_shards = shards.size();
+    Blocks shard_blocks = scatterBlockBySelector(
+        block, createKeyHashSelector(block, key_names_left, num_shards), num_shards);
+
+    /// Join each part against its shard and glue the results back together.
+    /// Note that the order of rows inside the block changes.
+    Block res;
+    for (size_t i = 0; i < num_shards; ++i)
+    {
+        Block & shard_block = shard_blocks[i];
+
+        if (!res)
+        {
+            /// Also join the first part unconditionally - to get the structure of the result.
+            shards[i]->joinBlock(shard_block);
+            res = shard_block;
+            continue;
         }
+
+        if (!shard_block.rows())
+            continue;
+
+        shards[i]->joinBlock(shard_block);
+
+        for (size_t j = 0; j < res.columns(); ++j)
+            res.getByPosition(j).column->insertRangeFrom(*shard_block.getByPosition(j).column, 0, shard_block.rows());
     }
 
-    return true;
+    block = res;
+}
+
+
+void Join::flushExternalBuckets() const
+{
+    std::lock_guard<std::mutex> lock(external_mutex);
+
+    if (external_buckets_flushed)
+        return;
+
+    for (auto & bucket : right_buckets)
+        bucket->finishWriting();
+    for (auto & bucket : left_buckets)
+        bucket->finishWriting();
+
+    external_buckets_flushed = true;
 }
 
 
@@ -763,9 +1055,10 @@ void Join::joinBlockImpl(Block & block, const Maps & maps) const
     /** For LEFT/INNER JOIN, the saved blocks do not contain keys.
       * For FULL/RIGHT JOIN, the saved blocks contain keys;
       *  but they will not be used at this stage of joining (and will be in `AdderNonJoined`), and they need to be skipped.
+      * The keys are also saved if the JOIN could spill to disk (see insertFromBlock).
       */
     size_t num_columns_to_skip = 0;
-    if (getFullness(kind))
+    if (getFullness(kind) || external_join_possible)
         num_columns_to_skip = keys_size;
 
 //    std::cerr << num_columns_to_skip << "\n" << block.dumpStructure() << "\n" << blocks.front().dumpStructure() << "\n";
@@ -886,6 +1179,25 @@ void Join::joinBlock(Block & block) const
 
     checkTypesOfKeys(block, sample_block_with_keys);
 
+    if (external)
+    {
+        /** The rows of the left table are scattered into the bucket files and will be joined later -
+          *  in the stream returned by createStreamWithExternallyJoinedRows.
+          * An empty block of the correct structure is passed on below.
+          */
+        {
+            std::lock_guard<std::mutex> lock_buckets(external_mutex);
+            scatterBlockToBuckets(block, key_names_left, left_buckets);
+        }
+        block = block.cloneEmpty();
+    }
+
+    if (sharded)
+    {
+        joinBlockSharded(block);
+        return;
+    }
+
     if (kind == ASTTableJoin::Kind::Left && strictness == ASTTableJoin::Strictness::Any)
         joinBlockImpl<ASTTableJoin::Kind::Left, ASTTableJoin::Strictness::Any>(block, maps_any);
     else if (kind == ASTTableJoin::Kind::Inner && strictness == ASTTableJoin::Strictness::Any)
@@ -1161,8 +1473,121 @@ private:
 
 BlockInputStreamPtr Join::createStreamWithNonJoinedRows(Block & left_sample_block, size_t max_block_size) const
 {
+    /// For a sharded JOIN, each shard tracked the used rows itself.
+    if (sharded)
+    {
+        BlockInputStreams streams;
+        for (const auto & shard : shards)
+            streams.emplace_back(shard->createStreamWithNonJoinedRows(left_sample_block, max_block_size));
+        return std::make_shared<ConcatBlockInputStream>(streams);
+    }
+
     return std::make_shared<NonJoinedBlockInputStream>(*this, left_sample_block, max_block_size);
 }
 
 
+/** Joins the bucket pairs of a JOIN that has spilled to disk, one pair at a time:
+  *  the right bucket is loaded into an ordinary in-memory Join, and the rows of the left bucket are passed through it.
+  * If the JOIN did not spill, gives out nothing.
+  * Use only after all calls to joinBlock was done (similar to NonJoinedBlockInputStream).
+  */
+class ExternallyJoinedBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    ExternallyJoinedBlockInputStream(const Join & parent_) : parent(parent_) {}
+
+    String getName() const override { return "ExternallyJoined"; }
+
+    String getID() const override
+    {
+        std::stringstream res;
+        res << "ExternallyJoined(" << &parent << ")";
+        return res.str();
+    }
+
+protected:
+    Block readImpl() override
+    {
+        if (!parent.external)
+            return Block();
+
+        if (!flushed)
+        {
+            parent.flushExternalBuckets();
+            flushed = true;
+        }
+
+        while (bucket_idx < Join::NUM_EXTERNAL_BUCKETS)
+        {
+            if (!left_input)
+            {
+                Join::ExternalBucket & left_bucket = *parent.left_buckets[bucket_idx];
+
+                /// Nothing to give out for this pair: even for LEFT JOIN, the result consists of the rows of the left table.
+                if (!left_bucket.rows)
+                {
+                    ++bucket_idx;
+                    continue;
+                }
+
+                /// An ordinary in-memory JOIN of one pair of buckets. The size limits of the whole JOIN apply to it.
+                bucket_join = std::make_shared<Join>(
+                    parent.key_names_left, parent.key_names_right, parent.use_nulls,
+                    Limits(), parent.kind, parent.strictness);
+                bucket_join->max_rows = parent.max_rows;
+                bucket_join->max_bytes = parent.max_bytes;
+                bucket_join->overflow_mode = parent.overflow_mode;
+                bucket_join->setSampleBlock(parent.right_table_sample_block);
+
+                BucketInput right_input(parent.right_buckets[bucket_idx]->file.path());
+                while (Block right_block = right_input.block_in.read())
+                    bucket_join->insertFromBlock(right_block);
+
+                left_input = std::make_unique<BucketInput>(left_bucket.file.path());
+            }
+
+            while (Block left_block = left_input->block_in.read())
+            {
+                bucket_join->joinBlock(left_block);
+
+                /// With INNER JOIN, everything could be filtered out.
+                if (left_block.rows())
+                    return left_block;
+            }
+
+            left_input.reset();
+            bucket_join.reset();
+            ++bucket_idx;
+        }
+
+        return Block();
+    }
+
+private:
+    /// To read the data back from the bucket file.
+    struct BucketInput
+    {
+        ReadBufferFromFile file_in;
+        CompressedReadBuffer compressed_in;
+        NativeBlockInputStream block_in;
+
+        BucketInput(const std::string & path)
+            : file_in(path), compressed_in(file_in), block_in(compressed_in, ClickHouseRevision::get()) {}
+    };
+
+    const Join & parent;
+
+    size_t bucket_idx = 0;
+    bool flushed = false;
+    std::shared_ptr<Join> bucket_join;
+    std::unique_ptr<BucketInput> left_input;
+};
+
+
+BlockInputStreamPtr Join::createStreamWithExternallyJoinedRows() const
+{
+    return std::make_shared<ExternallyJoinedBlockInputStream>(*this);
+}
+
+
 }
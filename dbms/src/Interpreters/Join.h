@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <shared_mutex>
 
 #include <Parsers/ASTTablesInSelectQuery.h>
@@ -17,6 +18,8 @@
 #include <DataStreams/IBlockInputStream.h>
 
 
+class ThreadPool;
+
 namespace DB
 {
 
@@ -223,7 +226,10 @@ class Join
 {
 public:
     Join(const Names & key_names_left_, const Names & key_names_right_, bool use_nulls_,
-         const Limits & limits, ASTTableJoin::Kind kind_, ASTTableJoin::Strictness strictness_);
+         const Limits & limits, ASTTableJoin::Kind kind_, ASTTableJoin::Strictness strictness_,
+         const String & tmp_path_ = "", size_t build_threads_ = 0);
+
+    ~Join();
 
     bool empty() { return type == Type::EMPTY; }
 
@@ -256,6 +262,17 @@ public:
       */
     BlockInputStreamPtr createStreamWithNonJoinedRows(Block & left_sample_block, size_t max_block_size) const;
 
+    /** Whether this JOIN may spill to disk ("grace hash" JOIN, see the max_bytes_before_external_join limit).
+      * Possible only for LEFT and INNER JOINs.
+      */
+    bool externalJoinPossible() const { return external_join_possible; }
+
+    /** For JOINs that have spilled to disk.
+      * A stream with rows joined from the on-disk buckets, one bucket pair at a time.
+      * Use only after all calls to joinBlock was done.
+      */
+    BlockInputStreamPtr createStreamWithExternallyJoinedRows() const;
+
     /// Number of keys in all built JOIN maps.
     size_t getTotalRowCount() const;
     /// Sum size in bytes of all buffers, used for JOIN maps and for all memory pools.
@@ -356,6 +373,7 @@ public:
 
 private:
     friend class NonJoinedBlockInputStream;
+    friend class ExternallyJoinedBlockInputStream;
 
     ASTTableJoin::Kind kind;
     ASTTableJoin::Strictness strictness;
@@ -378,7 +396,7 @@ private:
     MapsAllFull maps_all_full;    /// For ALL RIGHT|FULL JOIN
 
     /// Additional data - strings for string keys and continuation elements of single-linked lists of references to rows.
-    Arena pool;
+    std::unique_ptr<Arena> pool = std::make_unique<Arena>();
 
 private:
     Type type = Type::EMPTY;
@@ -391,6 +409,8 @@ private:
     Block sample_block_with_columns_to_add;
     /// Block with key columns in the same order they appear in the right-side table.
     Block sample_block_with_keys;
+    /// The whole sample of the right-side table, to initialize the per-bucket JOINs if this JOIN spills to disk.
+    Block right_table_sample_block;
 
     Poco::Logger * log;
 
@@ -399,6 +419,40 @@ private:
     size_t max_bytes;
     OverflowMode overflow_mode;
 
+    /** State for the external ("grace hash") JOIN, see the max_bytes_before_external_join limit.
+      * When the size of the in-memory data exceeds the threshold, both tables are scattered by a hash
+      *  of the key into buckets in temporary files, and the bucket pairs are joined one by one
+      *  after all calls to joinBlock (see ExternallyJoinedBlockInputStream).
+      * Mutable, because rows of the left table are spilled by the const method joinBlock.
+      */
+    struct ExternalBucket;
+    using ExternalBuckets = std::vector<std::unique_ptr<ExternalBucket>>;
+
+    static constexpr size_t NUM_EXTERNAL_BUCKETS = 64;
+
+    size_t max_bytes_before_external;
+    String tmp_path;
+    bool external_join_possible = false;
+
+    mutable bool external = false;
+    mutable ExternalBuckets right_buckets;
+    mutable ExternalBuckets left_buckets;
+    mutable bool external_buckets_flushed = false;
+    mutable std::mutex external_mutex;    /// joinBlock could be called from different threads.
+
+    /// Total size of the stored blocks of the right-side table, to compare against the threshold.
+    size_t blocks_bytes = 0;
+
+    /** State for the sharded JOIN, see the join_build_threads setting.
+      * The data of both tables is scattered by a hash of the key into independent shards - ordinary
+      *  in-memory Joins - and the shards are built by a pool of threads, each under its own lock.
+      * Note that scattering changes the order of rows inside the result blocks.
+      */
+    size_t build_threads;
+    bool sharded = false;
+    std::vector<std::shared_ptr<Join>> shards;
+    std::unique_ptr<ThreadPool> build_pool;
+
     Block totals;
 
     /** Protect state for concurrent use in insertFromBlock and joinBlock.
@@ -412,6 +466,9 @@ private:
 
     bool checkSizeLimits() const;
 
+    /// Check the size limits and act according to the overflow mode: false means "do not insert more data".
+    bool checkSizeLimitsAndOverflowMode() const;
+
     /// Throw an exception if blocks have different types of key columns.
     void checkTypesOfKeys(const Block & block_left, const Block & block_right) const;
 
@@ -419,6 +476,21 @@ private:
     void joinBlockImpl(Block & block, const Maps & maps) const;
 
     void joinBlockImplCross(Block & block) const;
+
+    /// Scatter the stored blocks into the bucket files and drop the in-memory data.
+    void switchToExternal();
+
+    /// Scatter the rows of the block into the bucket files by a hash of the key columns.
+    void scatterBlockToBuckets(const Block & block, const Names & key_names, ExternalBuckets & buckets) const;
+
+    /// Finish writing the bucket files, so that they could be read back.
+    void flushExternalBuckets() const;
+
+    /// Scatter the block into the shards and build them in parallel.
+    void insertFromBlockSharded(const Block & block);
+
+    /// Scatter the rows of the left block into the shards, join each part and glue the results back together.
+    void joinBlockSharded(Block & block) const;
 };
 
 using JoinPtr = std::shared_ptr<Join>;
@@ -77,6 +77,16 @@ struct Limits
     M(SettingUInt64, max_bytes_in_join, 0) \
     M(SettingOverflowMode<false>, join_overflow_mode, OverflowMode::THROW) \
     \
+    /** If the size of the JOIN map exceeds the threshold, scatter both tables by a hash of the key \
+      *  into buckets in temporary files and join the bucket pairs one by one ("grace hash" JOIN). \
+      * Zero means disabled. Works only for LEFT and INNER JOINs. */ \
+    M(SettingUInt64, max_bytes_before_external_join, 0) \
+    \
+    /** If the size of the DISTINCT value set exceeds the threshold, freeze it and scatter new keys \
+      *  by a hash into buckets in temporary files, deduplicated one by one at the end of the stream. \
+      * Zero means disabled. */ \
+    M(SettingUInt64, max_bytes_before_external_distinct, 0) \
+    \
     /** Limits for the maximum size of the transmitted external table obtained when the GLOBAL IN/JOIN section is executed. */ \
     M(SettingUInt64, max_rows_to_transfer, 0) \
     M(SettingUInt64, max_bytes_to_transfer, 0) \
@@ -99,7 +109,17 @@ struct Limits
     /** The maximum number of bytes to receive or transmit over the network, as part of the query. */ \
     M(SettingUInt64, max_network_bytes, 0) \
     /** The maximum speed of data exchange over the network for the user in bytes per second. 0 - not bounded. */ \
-    M(SettingUInt64, max_network_bandwidth_for_user, 0)
+    M(SettingUInt64, max_network_bandwidth_for_user, 0) \
+    \
+    /** The maximum speed of reading data from all the sources of the query, in uncompressed bytes per second. 0 - not bounded. */ \
+    M(SettingUInt64, max_read_bandwidth, 0) \
+    /** The maximum total read speed of concurrently running queries of one user, in uncompressed bytes per second. 0 - not bounded. */ \
+    M(SettingUInt64, max_read_bandwidth_for_user, 0) \
+    \
+    /** The maximum CPU consumption of the query, in percent of a single core (100 - one core). 0 - not bounded. */ \
+    M(SettingUInt64, max_cpu_usage_percent, 0) \
+    /** The maximum total CPU consumption of concurrently running queries of one user, in percent of a single core. 0 - not bounded. */ \
+    M(SettingUInt64, max_cpu_usage_percent_for_user, 0)
 
 #define DECLARE(TYPE, NAME, DEFAULT) \
     TYPE NAME {DEFAULT};
@@ -0,0 +1,108 @@
+#include <Interpreters/MetricsHistory.h>
+#include <Common/Exception.h>
+#include <Common/setThreadName.h>
+#include <chrono>
+
+
+namespace DB
+{
+
+MetricsHistory::~MetricsHistory()
+{
+    try
+    {
+        {
+            std::lock_guard<std::mutex> lock{wait_mutex};
+            quit = true;
+        }
+
+        wait_cond.notify_one();
+        thread.join();
+    }
+    catch (...)
+    {
+        DB::tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
+
+MetricsHistory::Snapshots MetricsHistory::getHistory() const
+{
+    std::lock_guard<std::mutex> lock{buffer_mutex};
+
+    if (buffer.size() < capacity)
+        return buffer;
+
+    /// The ring has wrapped: the oldest snapshot is at `next_pos`.
+    Snapshots res;
+    res.reserve(buffer.size());
+    res.insert(res.end(), buffer.begin() + next_pos, buffer.end());
+    res.insert(res.end(), buffer.begin(), buffer.begin() + next_pos);
+    return res;
+}
+
+
+void MetricsHistory::run()
+{
+    setThreadName("MetricsHistory");
+
+    if (!capacity)
+        return;
+
+    /// Don't report the counter totals accumulated since server startup as the first increment.
+    std::vector<ProfileEvents::Count> prev_counters(ProfileEvents::end());
+    for (size_t i = 0, end = ProfileEvents::end(); i < end; ++i)
+        prev_counters[i] = ProfileEvents::counters[i].load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock{wait_mutex};
+
+    while (true)
+    {
+        if (wait_cond.wait_for(lock, std::chrono::milliseconds(period_milliseconds), [this] { return quit; }))
+            break;
+
+        try
+        {
+            update(prev_counters);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(__PRETTY_FUNCTION__);
+        }
+    }
+}
+
+
+void MetricsHistory::update(std::vector<ProfileEvents::Count> & prev_counters)
+{
+    Snapshot snapshot;
+
+    auto now = std::chrono::system_clock::now();
+    snapshot.event_time = std::chrono::system_clock::to_time_t(now);
+    snapshot.milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+
+    snapshot.profile_event_increments.resize(ProfileEvents::end());
+    for (size_t i = 0, end = ProfileEvents::end(); i < end; ++i)
+    {
+        const auto counter = ProfileEvents::counters[i].load(std::memory_order_relaxed);
+        snapshot.profile_event_increments[i] = counter - prev_counters[i];
+        prev_counters[i] = counter;
+    }
+
+    snapshot.current_metrics.resize(CurrentMetrics::end());
+    for (size_t i = 0, end = CurrentMetrics::end(); i < end; ++i)
+        snapshot.current_metrics[i] = CurrentMetrics::values[i].load(std::memory_order_relaxed);
+
+    snapshot.asynchronous_metrics = async_metrics.getValues();
+
+    std::lock_guard<std::mutex> lock{buffer_mutex};
+
+    if (buffer.size() < capacity)
+        buffer.push_back(std::move(snapshot));
+    else
+        buffer[next_pos] = std::move(snapshot);
+
+    next_pos = (next_pos + 1) % capacity;
+}
+
+}
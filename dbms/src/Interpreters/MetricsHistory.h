@@ -0,0 +1,70 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+#include <Common/CurrentMetrics.h>
+#include <Common/ProfileEvents.h>
+#include <Interpreters/AsynchronousMetrics.h>
+
+
+namespace DB
+{
+
+/** Keeps an in-memory ring buffer with the recent history of ProfileEvents increments,
+  *  CurrentMetrics and AsynchronousMetrics values, collected by a background thread
+  *  with sub-second resolution.
+  * Exposed as the system.metric_history table, so that a latency incident can be
+  *  analyzed post-hoc without external monitoring infrastructure.
+  */
+class MetricsHistory
+{
+public:
+    /// capacity - how many snapshots to keep; period_milliseconds - how often to take them.
+    MetricsHistory(const AsynchronousMetrics & async_metrics_, size_t capacity_, UInt64 period_milliseconds_)
+        : async_metrics(async_metrics_), capacity(capacity_), period_milliseconds(period_milliseconds_),
+        thread([this] { run(); })
+    {
+    }
+
+    ~MetricsHistory();
+
+    struct Snapshot
+    {
+        time_t event_time;
+        UInt64 milliseconds;    /// Fractional part of the snapshot time.
+
+        /// Increments of the counters since the previous snapshot.
+        std::vector<ProfileEvents::Count> profile_event_increments;
+        std::vector<CurrentMetrics::Value> current_metrics;
+        AsynchronousMetrics::Container asynchronous_metrics;
+    };
+
+    using Snapshots = std::vector<Snapshot>;
+
+    /// Returns a copy of the buffered snapshots, oldest first.
+    Snapshots getHistory() const;
+
+private:
+    const AsynchronousMetrics & async_metrics;
+    const size_t capacity;
+    const UInt64 period_milliseconds;
+
+    bool quit {false};
+    std::mutex wait_mutex;
+    std::condition_variable wait_cond;
+
+    /// Ring buffer: grows up to `capacity` snapshots, then new ones overwrite the oldest.
+    Snapshots buffer;
+    size_t next_pos = 0;
+    mutable std::mutex buffer_mutex;
+
+    std::thread thread;
+
+    void run();
+    void update(std::vector<ProfileEvents::Count> & prev_counters);
+};
+
+}
@@ -2,11 +2,26 @@
 #include <Interpreters/Settings.h>
 #include <Parsers/ASTKillQueryQuery.h>
 #include <Common/Exception.h>
+#include <Common/CurrentMetrics.h>
+#include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
 #include <IO/WriteHelpers.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
 #include <Common/typeid_cast.h>
 
 
+namespace CurrentMetrics
+{
+    extern const Metric QueriesQueued;
+}
+
+namespace ProfileEvents
+{
+    extern const Event QueryAdmissionWaitMilliseconds;
+}
+
+
 namespace DB
 {
 
@@ -26,9 +41,55 @@ ProcessList::EntryPtr ProcessList::insert(
     {
         std::lock_guard<std::mutex> lock(mutex);
 
-        if (!is_kill_query && max_size && cur_size >= max_size
-            && (!settings.queue_max_wait_ms.totalMilliseconds() || !have_space.tryWait(mutex, settings.queue_max_wait_ms.totalMilliseconds())))
-            throw Exception("Too much simultaneous queries. Maximum: " + toString(max_size), ErrorCodes::TOO_MUCH_SIMULTANEOUS_QUERIES);
+        if (!is_kill_query && max_size && cur_size >= max_size)
+        {
+            UInt64 max_wait_ms = settings.queue_max_wait_ms.totalMilliseconds();
+
+            if (!max_wait_ms)
+                throw Exception("Too much simultaneous queries. Maximum: " + toString(max_size),
+                    ErrorCodes::TOO_MUCH_SIMULTANEOUS_QUERIES);
+
+            if (settings.max_queued_queries && admission_queue.size() >= settings.max_queued_queries)
+                throw Exception("Too much simultaneous queries. Maximum: " + toString(max_size)
+                    + ", and the queue is full (" + toString(admission_queue.size()) + " queries are waiting).",
+                    ErrorCodes::TOO_MUCH_SIMULTANEOUS_QUERIES);
+
+            /// Wait in the admission queue. Waiters with lower value of the `priority` setting
+            ///  are admitted first, FIFO within equal priorities.
+            std::pair<UInt64, UInt64> ticket(settings.priority, ++admission_ticket);
+            admission_queue.insert(ticket);
+
+            CurrentMetrics::Increment metric_increment{CurrentMetrics::QueriesQueued};
+            Stopwatch watch;
+
+            bool admitted = false;
+            while (true)
+            {
+                if (cur_size < max_size && *admission_queue.begin() == ticket)
+                {
+                    admitted = true;
+                    break;
+                }
+
+                UInt64 elapsed_ms = watch.elapsed() / 1000000;
+                if (elapsed_ms >= max_wait_ms)
+                    break;
+
+                have_space.tryWait(mutex, max_wait_ms - elapsed_ms);
+            }
+
+            admission_queue.erase(ticket);
+
+            /// Let the next waiter check whether it became the first in the queue.
+            have_space.broadcast();
+
+            ProfileEvents::increment(ProfileEvents::QueryAdmissionWaitMilliseconds, watch.elapsed() / 1000000);
+
+            if (!admitted)
+                throw Exception("Too much simultaneous queries. Maximum: " + toString(max_size)
+                    + ". Waited in the queue for " + toString(watch.elapsed() / 1000000) + " ms.",
+                    ErrorCodes::TOO_MUCH_SIMULTANEOUS_QUERIES);
+        }
 
         /** Why we use current user?
           * Because initial one is passed by client and credentials for it is not verified,
@@ -75,6 +136,7 @@ ProcessList::EntryPtr ProcessList::insert(
         res = std::make_shared<Entry>(*this, cont.emplace(cont.end(),
             query_, client_info,
             settings.limits.max_memory_usage, settings.memory_tracker_fault_probability,
+            settings.enable_hardware_perf_counters,
             priorities.insert(settings.priority)));
 
         if (!client_info.current_query_id.empty())
@@ -108,6 +170,36 @@ ProcessList::EntryPtr ProcessList::insert(
                     "Network bandwidth limit for a user exceeded.");
             }
 
+            if (settings.limits.max_read_bandwidth_for_user && !user_process_list.user_read_throttler)
+            {
+                user_process_list.user_read_throttler = std::make_shared<Throttler>(settings.limits.max_read_bandwidth_for_user, 0,
+                    "Read bandwidth limit for a user exceeded.");
+            }
+
+            /// The CPU throttler counts nanoseconds of CPU time; one percent of a core is 10^7 ns per second.
+            if (settings.limits.max_cpu_usage_percent_for_user && !user_process_list.user_cpu_throttler)
+            {
+                user_process_list.user_cpu_throttler = std::make_shared<Throttler>(
+                    settings.limits.max_cpu_usage_percent_for_user * 10000000ULL, 0,
+                    "CPU limit for a user exceeded.");
+            }
+
+            /// Per-query token buckets. The user throttler, if any, is the parent: a query sleeps
+            ///  both when it gets ahead of its own budget and when the user's queries as a whole do.
+
+            if (settings.limits.max_read_bandwidth || user_process_list.user_read_throttler)
+            {
+                res->get().read_throttler = std::make_shared<Throttler>(settings.limits.max_read_bandwidth, 0,
+                    "Read bandwidth limit exceeded.", user_process_list.user_read_throttler);
+            }
+
+            if (settings.limits.max_cpu_usage_percent || user_process_list.user_cpu_throttler)
+            {
+                res->get().cpu_throttler = std::make_shared<Throttler>(
+                    settings.limits.max_cpu_usage_percent * 10000000ULL, 0,
+                    "CPU limit exceeded.", user_process_list.user_cpu_throttler);
+            }
+
             res->get().user_process_list = &user_process_list;
         }
     }
@@ -116,6 +208,25 @@ ProcessList::EntryPtr ProcessList::insert(
 }
 
 
+size_t ProcessList::acquireThreadTokens(ProcessListElement & elem, size_t desired)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!thread_token_budget)
+        thread_token_budget = 2 * getNumberOfPhysicalCPUCores();
+
+    size_t available = thread_token_budget > allocated_thread_tokens
+        ? thread_token_budget - allocated_thread_tokens
+        : 0;
+
+    size_t granted = std::max<size_t>(1, std::min(desired, available));
+
+    allocated_thread_tokens += granted;
+    elem.thread_tokens += granted;
+    return granted;
+}
+
+
 ProcessListEntry::~ProcessListEntry()
 {
     /// Destroy all streams to avoid long lock of ProcessList
@@ -129,6 +240,9 @@ ProcessListEntry::~ProcessListEntry()
     String query_id = it->client_info.current_query_id;
     bool is_cancelled = it->is_cancelled;
 
+    /// Return the thread tokens to the pool (see acquireThreadTokens).
+    parent.allocated_thread_tokens -= it->thread_tokens;
+
     /// This removes the memory_tracker of one request.
     parent.cont.erase(it);
 
@@ -155,7 +269,10 @@ ProcessListEntry::~ProcessListEntry()
     }
 
     --parent.cur_size;
-    parent.have_space.signal();
+
+    /// Wake up all waiters: only the first one in the admission queue may take the freed slot,
+    ///  and it is not necessarily the one that `signal` would pick.
+    parent.have_space.broadcast();
 
     /// This removes memory_tracker for all requests. At this time, no other memory_trackers live.
     if (parent.cur_size == 0)
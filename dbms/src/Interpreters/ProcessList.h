@@ -1,6 +1,7 @@
 #pragma once
 
 #include <map>
+#include <set>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -10,6 +11,9 @@
 #include <Core/Defines.h>
 #include <Core/Progress.h>
 #include <Common/MemoryTracker.h>
+#include <Common/ProfileEvents.h>
+#include <Common/QueryProfiler.h>
+#include <Common/HardwareCounters.h>
 #include <Interpreters/QueryPriorities.h>
 #include <Interpreters/ClientInfo.h>
 #include <Common/CurrentMetrics.h>
@@ -50,6 +54,7 @@ struct ProcessInfo
     size_t written_rows;
     size_t written_bytes;
     Int64 memory_usage;
+    HardwareCounters::Values hardware_counters;
     ClientInfo client_info;
 };
 
@@ -69,10 +74,30 @@ struct ProcessListElement
 
     MemoryTracker memory_tracker;
 
+    /// Sampling profiler of the query threads, if enabled (see initQueryProfiler).
+    std::unique_ptr<QueryProfiler> profiler;
+
+    /// Profile events of everything done on behalf of the query; the threads fold their deltas
+    ///  here at the flush points (see IProfilingBlockInputStream::read). For the query log.
+    ProfileEvents::Counters profile_counters;
+
+    /// Hardware performance counters of the query threads, if enabled.
+    HardwareCounters hardware_counters;
+    std::unique_ptr<HardwareCountersThreadScope> hardware_counters_scope;
+
+    /// Limit the speed of reading data and the CPU consumption of the query by sleeping in
+    ///  IProfilingBlockInputStream::progress (see the max_read_bandwidth, max_cpu_usage_percent settings).
+    ThrottlerPtr read_throttler;
+    ThrottlerPtr cpu_throttler;
+
     QueryPriorities::Handle priority_handle;
 
     CurrentMetrics::Increment num_queries {CurrentMetrics::Query};
 
+    /// Number of thread tokens granted by ProcessList::acquireThreadTokens.
+    /// They are returned to the pool when the ProcessListEntry is destroyed.
+    size_t thread_tokens = 0;
+
     bool is_cancelled = false;
 
     /// Temporary tables could be registered here. Modify under mutex.
@@ -101,6 +126,7 @@ public:
         const ClientInfo & client_info_,
         size_t max_memory_usage,
         double memory_tracker_fault_probability,
+        bool enable_hardware_counters,
         QueryPriorities::Handle && priority_handle_)
         : query(query_), client_info(client_info_), memory_tracker(max_memory_usage),
         priority_handle(std::move(priority_handle_))
@@ -110,11 +136,27 @@ public:
 
         if (memory_tracker_fault_probability)
             memory_tracker.setFaultProbability(memory_tracker_fault_probability);
+
+        if (enable_hardware_counters)
+        {
+            hardware_counters_scope = std::make_unique<HardwareCountersThreadScope>(hardware_counters);
+            current_hardware_counters = &hardware_counters;
+        }
+        else
+            current_hardware_counters = nullptr;
     }
 
     ~ProcessListElement()
     {
         current_memory_tracker = nullptr;
+        current_hardware_counters = nullptr;
+    }
+
+    /// Start the sampling profiler of the query thread. Must be called from the query thread itself;
+    ///  also resets the thread-local profiler parameters of the previous query if period_ns is zero.
+    void initQueryProfiler(UInt64 period_ns)
+    {
+        profiler = std::make_unique<QueryProfiler>(client_info.current_query_id, period_ns);
     }
 
     bool updateProgressIn(const Progress & value)
@@ -147,6 +189,7 @@ public:
         res.written_rows      = progress_out.rows;
         res.written_bytes     = progress_out.bytes;
         res.memory_usage      = memory_tracker.get();
+        res.hardware_counters = hardware_counters.getValues();
 
         return res;
     }
@@ -177,6 +220,10 @@ struct ProcessListForUser
 
     /// Count network usage for all simultaneously running queries of single user.
     ThrottlerPtr user_throttler;
+
+    /// Limit the total read speed and CPU consumption of all simultaneously running queries of single user.
+    ThrottlerPtr user_read_throttler;
+    ThrottlerPtr user_cpu_throttler;
 };
 
 
@@ -227,6 +274,16 @@ private:
     size_t cur_size;        /// In C++03 or C++11 and old ABI, std::list::size is not O(1).
     size_t max_size;        /// 0 means no limit. Otherwise, when limit exceeded, an exception is thrown.
 
+    /// Queries waiting for admission when max_size is reached, ordered by the `priority` setting
+    ///  (lower value - admitted earlier) and arrival order.
+    std::set<std::pair<UInt64, UInt64>> admission_queue;
+    UInt64 admission_ticket = 0;
+
+    /// Token pool limiting the total number of runnable threads of all queries
+    ///  (see the adaptive_max_threads setting). 0 - initialized on first use from the number of cores.
+    size_t thread_token_budget = 0;
+    size_t allocated_thread_tokens = 0;
+
     /// Stores per-user info: queries, statistics and limits
     UserToQueries user_to_queries;
 
@@ -273,6 +330,12 @@ public:
         max_size = max_size_;
     }
 
+    /** Take up to `desired` thread tokens from the pool for the query, but at least one:
+      *  a query is never blocked here, the total may exceed the budget by the number of queries.
+      * Returns the number of tokens granted; they are released when the entry is destroyed.
+      */
+    size_t acquireThreadTokens(ProcessListElement & elem, size_t desired);
+
     /// Register temporary table. Then it is accessible by query_id and name.
     void addTemporaryTable(ProcessListElement & elem, const String & table_name, const StoragePtr & storage);
 
@@ -1,11 +1,13 @@
 #include <Columns/ColumnsNumber.h>
 #include <Columns/ColumnString.h>
 #include <Columns/ColumnFixedString.h>
+#include <Columns/ColumnArray.h>
 #include <DataTypes/DataTypesNumber.h>
 #include <DataTypes/DataTypeDateTime.h>
 #include <DataTypes/DataTypeDate.h>
 #include <DataTypes/DataTypeString.h>
 #include <DataTypes/DataTypeFixedString.h>
+#include <DataTypes/DataTypeArray.h>
 #include <Interpreters/QueryLog.h>
 #include <Common/ClickHouseRevision.h>
 #include <Poco/Net/IPAddress.h>
@@ -37,6 +39,17 @@ Block QueryLogElement::createBlock()
 
         {std::make_shared<ColumnUInt64>(),     std::make_shared<DataTypeUInt64>(),     "memory_usage"},
 
+        {std::make_shared<ColumnUInt64>(),     std::make_shared<DataTypeUInt64>(),     "cycles"},
+        {std::make_shared<ColumnUInt64>(),     std::make_shared<DataTypeUInt64>(),     "instructions"},
+        {std::make_shared<ColumnUInt64>(),     std::make_shared<DataTypeUInt64>(),     "cache_misses"},
+        {std::make_shared<ColumnUInt64>(),     std::make_shared<DataTypeUInt64>(),     "branch_misses"},
+        {std::make_shared<ColumnUInt64>(),     std::make_shared<DataTypeUInt64>(),     "page_faults"},
+
+        {std::make_shared<ColumnArray>(std::make_shared<ColumnString>()),
+            std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>()),     "ProfileEvents.Names"},
+        {std::make_shared<ColumnArray>(std::make_shared<ColumnUInt64>()),
+            std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>()),     "ProfileEvents.Values"},
+
         {std::make_shared<ColumnString>(),     std::make_shared<DataTypeString>(),     "query"},
         {std::make_shared<ColumnString>(),     std::make_shared<DataTypeString>(),     "exception"},
         {std::make_shared<ColumnString>(),     std::make_shared<DataTypeString>(),     "stack_trace"},
@@ -114,6 +127,28 @@ void QueryLogElement::appendToBlock(Block & block) const
 
     block.getByPosition(i++).column->insert(UInt64(memory_usage));
 
+    block.getByPosition(i++).column->insert(hardware_counters.values[HardwareCounters::CYCLES]);
+    block.getByPosition(i++).column->insert(hardware_counters.values[HardwareCounters::INSTRUCTIONS]);
+    block.getByPosition(i++).column->insert(hardware_counters.values[HardwareCounters::CACHE_MISSES]);
+    block.getByPosition(i++).column->insert(hardware_counters.values[HardwareCounters::BRANCH_MISSES]);
+    block.getByPosition(i++).column->insert(hardware_counters.values[HardwareCounters::PAGE_FAULTS]);
+
+    {
+        Array event_names;
+        Array event_values;
+        event_names.reserve(profile_events.size());
+        event_values.reserve(profile_events.size());
+
+        for (const auto & event : profile_events)
+        {
+            event_names.push_back(event.first);
+            event_values.push_back(event.second);
+        }
+
+        block.getByPosition(i++).column->insert(event_names);
+        block.getByPosition(i++).column->insert(event_values);
+    }
+
     block.getByPosition(i++).column->insertData(query.data(), query.size());
     block.getByPosition(i++).column->insertData(exception.data(), exception.size());
     block.getByPosition(i++).column->insertData(stack_trace.data(), stack_trace.size());
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Interpreters/SystemLog.h>
+#include <Common/HardwareCounters.h>
+#include <vector>
+#include <utility>
 
 
 namespace DB
@@ -46,6 +49,12 @@ struct QueryLogElement
 
     UInt64 memory_usage{};
 
+    /// Hardware events of the query threads (see the enable_hardware_perf_counters setting).
+    HardwareCounters::Values hardware_counters;
+
+    /// Profile events accumulated by the query - the nonzero ones, with their names.
+    std::vector<std::pair<String, UInt64>> profile_events;
+
     String query;
 
     String exception;
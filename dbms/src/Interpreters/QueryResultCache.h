@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Common/SipHash.h>
+#include <Common/ProfileEvents.h>
+#include <Core/Types.h>
+#include <Parsers/IAST.h>
+#include <Interpreters/AggregationCommon.h>
+#include <Interpreters/Settings.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event QueryResultCacheHits;
+    extern const Event QueryResultCacheMisses;
+}
+
+namespace DB
+{
+
+/// The result of a SELECT query, serialized in Native format and compressed.
+struct QueryResultCacheCell
+{
+    String data;
+};
+
+struct QueryResultCacheWeightFunction
+{
+    size_t operator()(const QueryResultCacheCell & x) const
+    {
+        return x.data.size();
+    }
+};
+
+
+/** Cache of results of SELECT queries, keyed by the hash of the query AST and the current database
+  *  (so differently formatted but identical queries share an entry). thread-safe.
+  * There is no per-table data version to track, so the whole cache is dropped whenever a query
+  *  that could modify data is executed on this server (see executeQuery.cpp).
+  * NOTE Data modified on other servers (e.g. through Distributed tables) is not noticed.
+  */
+class QueryResultCache : public LRUCache<UInt128, QueryResultCacheCell, UInt128TrivialHash, QueryResultCacheWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, QueryResultCacheCell, UInt128TrivialHash, QueryResultCacheWeightFunction>;
+
+public:
+    QueryResultCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes) {}
+
+    /// Calculate key from the query AST, the current database and the settings that change the result.
+    static UInt128 hash(const IAST & ast, const String & current_database, const Settings & settings)
+    {
+        UInt128 key;
+
+        IAST::Hash tree_hash = ast.getTreeHash();
+
+        SipHash hash;
+        hash.update(reinterpret_cast<const char *>(&tree_hash), sizeof(tree_hash));
+        hash.update(current_database.data(), current_database.size() + 1);
+
+        /// Sessions that differ in a setting affecting the result of the query must not share an entry.
+        /// Settings that only change how the query is executed are deliberately left out of the key.
+        static constexpr const char * settings_in_key[]
+        {
+            "join_use_nulls",
+            "distributed_product_mode",
+            "count_distinct_implementation",
+            "max_result_rows", "max_result_bytes", "result_overflow_mode",
+            "max_rows_to_read", "max_bytes_to_read", "read_overflow_mode",
+            "max_rows_to_group_by", "group_by_overflow_mode",
+            "max_rows_to_sort", "max_bytes_to_sort", "sort_overflow_mode",
+        };
+
+        for (const char * name : settings_in_key)
+        {
+            String value;
+            if (settings.tryGet(name, value))
+            {
+                hash.update(name, strlen(name));
+                hash.update(value.data(), value.size() + 1);
+            }
+        }
+
+        hash.get128(key.low, key.high);
+
+        return key;
+    }
+
+    MappedPtr get(const Key & key)
+    {
+        MappedPtr res = Base::get(key);
+
+        if (res)
+            ProfileEvents::increment(ProfileEvents::QueryResultCacheHits);
+        else
+            ProfileEvents::increment(ProfileEvents::QueryResultCacheMisses);
+
+        return res;
+    }
+};
+
+using QueryResultCachePtr = std::shared_ptr<QueryResultCache>;
+
+}
@@ -74,9 +74,36 @@ void NO_INLINE Set::insertFromBlockImplCase(
     state.init(key_columns);
     size_t keys_size = key_columns.size();
 
+    /// For methods with cheap keys, hash the keys a few rows ahead and prefetch the hash table
+    ///  cells, so that on sets that do not fit in cache, multiple cache misses are in flight at a time.
+    static constexpr size_t prefetch_look_ahead = 16;
+    size_t hash_values[prefetch_look_ahead];
+
+    if (Method::prefetch_suitable)
+    {
+        for (size_t i = 0, size = std::min(rows, prefetch_look_ahead); i < size; ++i)
+        {
+            hash_values[i] = method.data.hash(state.getKey(key_columns, keys_size, i, key_sizes));
+            method.data.prefetch(hash_values[i]);
+        }
+    }
+
     /// For all rows
     for (size_t i = 0; i < rows; ++i)
     {
+        size_t hash_value = 0;
+        if (Method::prefetch_suitable)
+        {
+            hash_value = hash_values[i % prefetch_look_ahead];
+
+            if (i + prefetch_look_ahead < rows)
+            {
+                size_t hash_ahead = method.data.hash(state.getKey(key_columns, keys_size, i + prefetch_look_ahead, key_sizes));
+                method.data.prefetch(hash_ahead);
+                hash_values[i % prefetch_look_ahead] = hash_ahead;
+            }
+        }
+
         if (has_null_map && (*null_map)[i])
             continue;
 
@@ -85,7 +112,10 @@ void NO_INLINE Set::insertFromBlockImplCase(
 
         typename Method::Data::iterator it;
         bool inserted;
-        method.data.emplace(key, it, inserted);
+        if (Method::prefetch_suitable)
+            method.data.emplace(key, it, inserted, hash_value);
+        else
+            method.data.emplace(key, it, inserted);
 
         if (inserted)
             method.onNewKey(*it, keys_size, i, variants.string_pool);
@@ -179,6 +209,8 @@ bool Set::insertFromBlock(const Block & block, bool create_ordered_set)
         for (size_t i = 0; i < rows; ++i)
             ordered_set_elements->push_back((*key_columns[0])[i]); /// ordered_set for index works only for single key, not for tuples
 
+    updateDenseBitmap();
+
     if (!checkSetSizeLimits())
     {
         switch (overflow_mode)
@@ -469,6 +501,64 @@ void NO_INLINE Set::executeArrayImpl(
 }
 
 
+void Set::updateDenseBitmap()
+{
+    switch (data.type)
+    {
+        case SetVariants::Type::key8:
+            dense_bitmap = SetDenseBitmap::tryBuild(data.key8->data);
+            break;
+        case SetVariants::Type::key16:
+            dense_bitmap = SetDenseBitmap::tryBuild(data.key16->data);
+            break;
+        case SetVariants::Type::key32:
+            dense_bitmap = SetDenseBitmap::tryBuild(data.key32->data);
+            break;
+        case SetVariants::Type::key64:
+            dense_bitmap = SetDenseBitmap::tryBuild(data.key64->data);
+            break;
+        default:
+            dense_bitmap.reset();
+    }
+}
+
+
+template <typename FieldType>
+void Set::executeDenseBitmap(
+    const ConstColumnPlainPtrs & key_columns,
+    ColumnUInt8::Container_t & vec_res,
+    bool negative,
+    size_t rows,
+    ConstNullMapPtr null_map) const
+{
+    if (null_map)
+        executeDenseBitmapCase<FieldType, true>(key_columns, vec_res, negative, rows, null_map);
+    else
+        executeDenseBitmapCase<FieldType, false>(key_columns, vec_res, negative, rows, null_map);
+}
+
+
+template <typename FieldType, bool has_null_map>
+void NO_INLINE Set::executeDenseBitmapCase(
+    const ConstColumnPlainPtrs & key_columns,
+    ColumnUInt8::Container_t & vec_res,
+    bool negative,
+    size_t rows,
+    ConstNullMapPtr null_map) const
+{
+    const FieldType * vec = &static_cast<const ColumnVector<FieldType> *>(key_columns[0])->getData()[0];
+    const SetDenseBitmap & bitmap = *dense_bitmap;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (has_null_map && (*null_map)[i])
+            vec_res[i] = negative;
+        else
+            vec_res[i] = negative ^ bitmap.contains(vec[i]);
+    }
+}
+
+
 void Set::executeOrdinary(
     const ConstColumnPlainPtrs & key_columns,
     ColumnUInt8::Container_t & vec_res,
@@ -477,6 +567,28 @@ void Set::executeOrdinary(
 {
     size_t rows = key_columns[0]->size();
 
+    /// Sets with one numeric key over a dense domain are probed through a flat bitmap, without hashing.
+    if (dense_bitmap)
+    {
+        switch (data.type)
+        {
+            case SetVariants::Type::key8:
+                executeDenseBitmap<UInt8>(key_columns, vec_res, negative, rows, null_map);
+                return;
+            case SetVariants::Type::key16:
+                executeDenseBitmap<UInt16>(key_columns, vec_res, negative, rows, null_map);
+                return;
+            case SetVariants::Type::key32:
+                executeDenseBitmap<UInt32>(key_columns, vec_res, negative, rows, null_map);
+                return;
+            case SetVariants::Type::key64:
+                executeDenseBitmap<UInt64>(key_columns, vec_res, negative, rows, null_map);
+                return;
+            default:
+                break;
+        }
+    }
+
     switch (data.type)
     {
         case SetVariants::Type::EMPTY:
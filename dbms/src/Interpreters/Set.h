@@ -61,6 +61,9 @@ private:
 
     SetVariants data;
 
+    /// A fast path for probing sets with one numeric key over a dense domain (see SetDenseBitmap).
+    std::unique_ptr<SetDenseBitmap> dense_bitmap;
+
     /** How IN works with Nullable types.
       *
       * For simplicity reasons, all NULL values and any tuples with at least one NULL element are ignored in the Set.
@@ -101,6 +104,25 @@ private:
     /// Check whether the permissible sizes of keys set reached
     bool checkSetSizeLimits() const;
 
+    /// Rebuild `dense_bitmap` from the inserted data, if it pays off for this set.
+    void updateDenseBitmap();
+
+    template <typename FieldType>
+    void executeDenseBitmap(
+        const ConstColumnPlainPtrs & key_columns,
+        ColumnUInt8::Container_t & vec_res,
+        bool negative,
+        size_t rows,
+        ConstNullMapPtr null_map) const;
+
+    template <typename FieldType, bool has_null_map>
+    void executeDenseBitmapCase(
+        const ConstColumnPlainPtrs & key_columns,
+        ColumnUInt8::Container_t & vec_res,
+        bool negative,
+        size_t rows,
+        ConstNullMapPtr null_map) const;
+
     /// Vector of ordered elements of `Set`.
     /// It is necessary for the index to work on the primary key in the IN statement.
     using OrderedSetElements = std::vector<Field>;
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Common/LRUCache.h>
+#include <Common/SipHash.h>
+#include <Common/ProfileEvents.h>
+#include <Common/UInt128.h>
+#include <Parsers/IAST.h>
+#include <Interpreters/Set.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event SetCacheHits;
+    extern const Event SetCacheMisses;
+}
+
+namespace DB
+{
+
+struct SetCacheWeightFunction
+{
+    size_t operator()(const Set & set) const
+    {
+        return set.getTotalByteCount();
+    }
+};
+
+
+/** Cache of sets built from IN (subquery), shared between queries. thread-safe.
+  * Keyed by the hash of the subquery AST and the current database,
+  *  so repeated queries reuse one set instead of rebuilding it each time.
+  * As with the query result cache, there is no per-table data version to track: the whole cache
+  *  is dropped whenever a query that could modify data is executed (see executeQuery.cpp).
+  * NOTE A cached set is built with the size limits of the query that built it first.
+  */
+class SetCache : public LRUCache<UInt128, Set, UInt128TrivialHash, SetCacheWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, Set, UInt128TrivialHash, SetCacheWeightFunction>;
+
+public:
+    SetCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes) {}
+
+    /// Calculate key from the subquery AST and the current database.
+    static UInt128 hash(const IAST & ast, const String & current_database)
+    {
+        UInt128 key;
+
+        IAST::Hash tree_hash = ast.getTreeHash();
+
+        SipHash hash;
+        hash.update(reinterpret_cast<const char *>(&tree_hash), sizeof(tree_hash));
+        hash.update(current_database.data(), current_database.size() + 1);
+        hash.get128(key.low, key.high);
+
+        return key;
+    }
+
+    MappedPtr get(const Key & key)
+    {
+        MappedPtr res = Base::get(key);
+
+        if (res)
+            ProfileEvents::increment(ProfileEvents::SetCacheHits);
+        else
+            ProfileEvents::increment(ProfileEvents::SetCacheMisses);
+
+        return res;
+    }
+};
+
+using SetCachePtr = std::shared_ptr<SetCache>;
+
+}
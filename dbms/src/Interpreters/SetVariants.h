@@ -54,6 +54,11 @@ struct SetMethodOneNumber
     /** Place additional data, if necessary, in case a new key was inserted into the hash table.
       */
     static void onNewKey(typename Data::value_type & value, size_t keys_size, size_t i, Arena & pool) {}
+
+    /** The key is cheap to calculate, so it pays off to hash the keys a few rows ahead
+      *  and prefetch the hash table cells (see Set::insertFromBlockImplCase).
+      */
+    static const bool prefetch_suitable = true;
 };
 
 /// For the case where there is one string key.
@@ -94,6 +99,8 @@ struct SetMethodString
     {
         value.data = pool.insert(value.data, value.size);
     }
+
+    static const bool prefetch_suitable = true;
 };
 
 /// For the case when there is one fixed-length string key.
@@ -132,6 +139,8 @@ struct SetMethodFixedString
     {
         value.data = pool.insert(value.data, value.size);
     }
+
+    static const bool prefetch_suitable = true;
 };
 
 namespace set_impl
@@ -269,6 +278,8 @@ struct SetMethodKeysFixed
     };
 
     static void onNewKey(typename Data::value_type & value, size_t keys_size, size_t i, Arena & pool) {}
+
+    static const bool prefetch_suitable = true;
 };
 
 /// For other cases. 128 bit hash from the key.
@@ -297,6 +308,76 @@ struct SetMethodHashed
     };
 
     static void onNewKey(typename Data::value_type & value, size_t keys_size, size_t i, Arena & pool) {}
+
+    /// The key itself is a 128-bit hash of the row, too expensive to calculate twice.
+    static const bool prefetch_suitable = false;
+};
+
+
+/** A flat bitmap over a dense numeric domain - a fast path for single-numeric-key sets
+  *  of the `site_id IN (thousands of contiguous IDs)` kind.
+  * Built from an already filled hash set, if the domain is dense enough;
+  *  probing is a branchless bit test instead of a hash table lookup per row.
+  */
+struct SetDenseBitmap
+{
+    UInt64 min_key = 0;
+    UInt64 range = 0;        /// max_key - min_key.
+    std::vector<UInt64> bits;
+
+    /// Don't spend more than this amount of bits
+    ///  and don't build a bitmap sparser than this amount of bits per element.
+    static constexpr UInt64 MAX_BITS = 8 * 1024 * 1024;
+    static constexpr UInt64 MAX_BITS_PER_ELEMENT = 64;
+
+    /// Returns nullptr if a bitmap does not pay off for this set.
+    template <typename Data>
+    static std::unique_ptr<SetDenseBitmap> tryBuild(const Data & data)
+    {
+        size_t count = data.size();
+
+        /// More elements than bits in the largest allowed bitmap - the domain cannot fit.
+        if (!count || count > MAX_BITS)
+            return nullptr;
+
+        UInt64 min_key = 0;
+        UInt64 max_key = 0;
+        bool first = true;
+
+        for (const auto & elem : data)
+        {
+            UInt64 key = elem;
+            min_key = first ? key : std::min(min_key, key);
+            max_key = first ? key : std::max(max_key, key);
+            first = false;
+        }
+
+        UInt64 range = max_key - min_key;
+        if (range >= MAX_BITS || range / MAX_BITS_PER_ELEMENT >= count)
+            return nullptr;
+
+        auto res = std::make_unique<SetDenseBitmap>();
+        res->min_key = min_key;
+        res->range = range;
+        res->bits.assign(range / 64 + 1, 0);
+
+        for (const auto & elem : data)
+        {
+            UInt64 offset = UInt64(elem) - min_key;
+            res->bits[offset >> 6] |= 1ULL << (offset & 63);
+        }
+
+        return res;
+    }
+
+    /// Branchless: out-of-range keys probe bit 0 of the bitmap and the result is masked out.
+    bool contains(UInt64 key) const
+    {
+        UInt64 offset = key - min_key;
+        UInt64 in_range = offset <= range;
+        offset &= ~(in_range - 1);
+        return in_range & ((bits[offset >> 6] >> (offset & 63)) & 1);
+    }
 };
 
 
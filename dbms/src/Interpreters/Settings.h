@@ -43,12 +43,24 @@ struct Settings
     M(SettingUInt64, min_insert_block_size_rows, DEFAULT_INSERT_BLOCK_SIZE) \
     /** Squash blocks passed to INSERT query to specified size in bytes, if blocks are not big enough. */ \
     M(SettingUInt64, min_insert_block_size_bytes, (DEFAULT_INSERT_BLOCK_SIZE * 256)) \
+    /** The maximum number of threads writing the data of an INSERT SELECT query. \
+      * Each thread squashes and writes independent parts. 0 or 1 - single-threaded insertion. */ \
+    M(SettingUInt64, max_insert_threads, 0) \
     /** The maximum number of threads to execute the request. By default, it is determined automatically. */ \
     M(SettingMaxThreads, max_threads, 0) \
+    /** Adapt the number of threads of the query to the load: under concurrency, shrink the pipeline \
+      *  so that the total number of runnable threads of all queries stays near the number of cores \
+      *  (each query still gets at least one thread). Uses max_threads as the upper bound. */ \
+    M(SettingBool, adaptive_max_threads, 0) \
     /** The maximum size of the buffer to read from the filesystem. */ \
     M(SettingUInt64, max_read_buffer_size, DBMS_DEFAULT_BUFFER_SIZE) \
     /** The maximum number of connections for distributed processing of one query (should be greater than max_threads). */ \
     M(SettingUInt64, max_distributed_connections, DEFAULT_MAX_DISTRIBUTED_CONNECTIONS) \
+    /** The maximum number of remote shards served by a single thread of a distributed query. \
+      * With a value of N, remote shards are grouped so that one stream multiplexes up to N shard connections \
+      *  instead of a stream (and a thread mostly blocked in recv) per shard. \
+      * Zero means the usual stream per shard. Not used together with parallel replicas within a shard. */ \
+    M(SettingUInt64, distributed_connections_per_stream, 0) \
     /** Which part of the query can be read into RAM for parsing (the remaining data for INSERT, if any, is read later) */ \
     M(SettingUInt64, max_query_size, DEFAULT_MAX_QUERY_SIZE) \
     /** The interval in microseconds to check if the request is cancelled, and to send progress info. */ \
@@ -60,10 +72,16 @@ struct Settings
     M(SettingSeconds, send_timeout, DBMS_DEFAULT_SEND_TIMEOUT_SEC) \
     /** The wait time in the request queue, if the number of concurrent requests exceeds the maximum. */ \
     M(SettingMilliseconds, queue_max_wait_ms, DEFAULT_QUERIES_QUEUE_WAIT_TIME_MS) \
+    /** Maximum number of queries waiting in the request queue. If exceeded, new queries are rejected immediately. 0 - unlimited. */ \
+    M(SettingUInt64, max_queued_queries, 0) \
     /** Block at the query wait cycle on the server for the specified number of seconds. */ \
     M(SettingUInt64, poll_interval, DBMS_DEFAULT_POLL_INTERVAL) \
     /** Maximum number of connections with one remote server in the pool. */ \
     M(SettingUInt64, distributed_connections_pool_size, DBMS_DEFAULT_DISTRIBUTED_CONNECTIONS_POOL_SIZE) \
+    /** Pre-establish and keep warm this many connections per remote replica of every cluster, \
+      * starting right after the cluster is built from the config, so that the first distributed \
+      * queries after a config reload don't pay for DNS resolution and handshakes. 0 - disabled. */ \
+    M(SettingUInt64, distributed_connections_warm_count, 0) \
     /** The maximum number of attempts to connect to replicas. */ \
     M(SettingUInt64, connections_with_failover_max_tries, DBMS_CONNECTION_POOL_WITH_FAILOVER_DEFAULT_MAX_TRIES) \
     /** Calculate minimums and maximums of the result columns. They can be output in JSON-formats. */ \
@@ -82,9 +100,78 @@ struct Settings
     /** Should StorageDistributed DirectoryMonitors try to batch individual inserts into bigger ones. */ \
     M(SettingBool, distributed_directory_monitor_batch_inserts, false) \
     \
+    /** If non-zero, Buffer tables work in striped mode: they have this many buffers instead of num_shards, \
+      * the buffer for an insert is selected by the thread number only, flushes write a snapshot taken \
+      *  by a quick swap instead of holding the insert lock for the whole write, and different buffers \
+      *  are flushed concurrently. Data being flushed is not visible to SELECT from the buffer. */ \
+    M(SettingUInt64, buffer_insert_stripes, 0) \
+    \
+    /** If set, tables with engines that have no data parts and no background activity \
+      *  (not the MergeTree family, Distributed, Buffer or MaterializedView) are not constructed at server startup: \
+      *  they attach in the background and on first access, so the server accepts queries sooner. */ \
+    M(SettingBool, lazy_load_auxiliary_tables, false) \
+    \
+    /** Verify checksums of compressed blocks read from MergeTree parts on a helper thread, \
+      *  overlapping verification with decompression. An error in a block is then reported \
+      *  on one of the next reads from the same stream. */ \
+    M(SettingBool, async_block_checksums, 0) \
+    \
+    /** If non-zero, a seek to a mark in a MergeTree part schedules reading of this many compressed \
+      *  blocks, starting at that mark, on background threads that decompress them into the cache \
+      *  of uncompressed blocks. The query thread then mostly finds its data already decompressed, \
+      *  so scan throughput approaches max(disk, CPU) instead of their sum in series. \
+      * Only applies when the cache of uncompressed blocks is used (see use_uncompressed_cache). */ \
+    M(SettingUInt64, merge_tree_prefetch_ahead_blocks, 0) \
+    \
+    /** When reading scattered mark ranges of a MergeTree part, a forward seek over a gap smaller \
+      *  than this many bytes is performed by reading and discarding the gap instead of a true seek. \
+      * This coalesces reads of nearby ranges into one sequential read, which keeps the kernel \
+      *  readahead window and saves head movements on spinning disks. */ \
+    M(SettingUInt64, merge_tree_min_bytes_for_seek, 0) \
+    \
+    /** Parse the row-based input formats that allow it (TabSeparated, CSV, TSKV, JSONEachRow) \
+      *  on up to max_threads threads: the input is split on row boundaries into segments \
+      *  that are parsed independently and returned in the original order. */ \
+    M(SettingBool, input_format_parallel_parsing, true) \
+    \
+    /** Format the row-based output formats that allow it (TabSeparated, CSV, TSKV, JSONEachRow) \
+      *  on up to max_threads threads: blocks are rendered to memory buffers independently \
+      *  and written to the target in the original order. */ \
+    M(SettingBool, output_format_parallel_formatting, true) \
+    \
     /** Allows disabling WHERE to PREWHERE optimization in SELECT queries from MergeTree */ \
     M(SettingBool, optimize_move_to_prewhere, true) \
     \
+    /** Evaluate cheap deterministic conjuncts of WHERE separately, before the rest of the expression, \
+      *  filtering the block by each one; the order is chosen adaptively from the per-row cost \
+      *  and selectivity observed at runtime. */ \
+    M(SettingBool, optimize_conjunct_order, true) \
+    \
+    /** Evaluate the arguments of AND lazily: compute the mask of the first argument \
+      *  and evaluate the expressions of the subsequent arguments only over the rows that survived it. */ \
+    M(SettingBool, short_circuit_and_evaluation, true) \
+    \
+    /** Allows answering a trivial SELECT count() directly from the table metadata, without reading the data */ \
+    M(SettingBool, optimize_trivial_count_query, true) \
+    \
+    /** If the ORDER BY of a SELECT query is a prefix of the MergeTree primary key, read in the order of the key and merge instead of sorting */ \
+    M(SettingBool, optimize_read_in_order, true) \
+    \
+    /** If the GROUP BY keys of a SELECT query form a prefix of the MergeTree primary key, read in the order of the key \
+      * and aggregate group by group, keeping one group in memory at a time instead of a hash table with all of them. \
+      * Saves memory, but is usually slower when there are many small groups. */ \
+    M(SettingBool, optimize_aggregation_in_order, false) \
+    \
+    /** Answer GROUP BY key ORDER BY count() DESC LIMIT n queries approximately, with a bounded \
+      * SpaceSaving sketch instead of the full aggregate table. Memory no longer depends on the \
+      * cardinality of the key, but both the returned keys and their counts may be inexact. */ \
+    M(SettingBool, optimize_approximate_topk, false) \
+    \
+    /** Execute SELECT DISTINCT ... ORDER BY ... LIMIT n queries with one bounded operator that keeps \
+      * only the first n distinct rows in the required order, instead of materializing all distinct \
+      * rows and sorting them. Memory is O(n) and the result is exact (up to ties in the ORDER BY key). */ \
+    M(SettingBool, optimize_distinct_order_by_limit, false) \
+    \
     /** Wait for actions to manipulate the partitions. 0 - do not wait, 1 - wait for execution only of itself, 2 - wait for everyone. */ \
     M(SettingUInt64, replication_alter_partitions_sync, 1) \
     /** Wait for actions to change the table structure within the specified number of seconds. 0 - wait unlimited time. */ \
@@ -99,6 +186,10 @@ struct Settings
     M(SettingBool, compile, false) \
     /** The number of structurally identical queries before they are compiled. */ \
     M(SettingUInt64, min_count_to_compile, 3) \
+    /** Whether to fuse chains of simple arithmetic, comparison and logical functions over numeric columns \
+      *  into loops compiled at runtime, without materialization of the intermediate columns. \
+      * Uses the same counter as 'compile' (see min_count_to_compile). */ \
+    M(SettingBool, compile_expressions, false) \
     /** From what number of keys, a two-level aggregation starts. 0 - the threshold is not set. */ \
     M(SettingUInt64, group_by_two_level_threshold, 100000) \
     /** From what size of the aggregation state in bytes, a two-level aggregation begins to be used. 0 - the threshold is not set. \
@@ -106,15 +197,39 @@ struct Settings
     M(SettingUInt64, group_by_two_level_threshold_bytes, 100000000) \
     /** Is the memory-saving mode of distributed aggregation enabled. */ \
     M(SettingBool, distributed_aggregation_memory_efficient, false) \
+    /** With the memory-saving mode, force the shards to convert to two-level aggregation right away, \
+      * so that all of them return bucket-ordered mergeable blocks and the initiator merges strictly \
+      * bucket by bucket, holding one bucket per shard in memory regardless of the total cardinality. \
+      * Otherwise each shard decides by the size of its local result, and the single-level blocks \
+      * of the smaller shards have to be accumulated on the initiator until the end of the merge. */ \
+    M(SettingBool, distributed_aggregation_force_two_level, true) \
     /** Number of threads to use for merge intermediate aggregation results in memory efficient mode. When bigger, then more memory is consumed. \
       * 0 means - same as 'max_threads'. */ \
     M(SettingUInt64, aggregation_memory_efficient_merge_threads, 0) \
     \
+    /** On multi-socket servers, pin the threads of parallel query processing to NUMA nodes in round-robin fashion. \
+      * With the first-touch policy of the kernel, this keeps per-thread aggregation states on the node \
+      *  of the thread that fills them, instead of paying remote-node latency on every cache miss. \
+      */ \
+    M(SettingBool, numa_aware_parallel_processing, 0) \
+    \
+    /** How many blocks each remote source may prepare ahead of the stage that consumes them \
+      *  (merging of aggregated or sorted data). With 1, a source that hit a slow patch of network \
+      *  stalls the consumer; a deeper queue rides out the jitter. */ \
+    M(SettingUInt64, distributed_read_ahead_blocks, 4) \
+    /** Limit in bytes on the blocks prepared ahead by one remote source. Zero means no limit. */ \
+    M(SettingUInt64, distributed_read_ahead_max_bytes, 67108864) \
+    \
     /** The maximum number of replicas of each shard used when executing the query */ \
     M(SettingUInt64, max_parallel_replicas, 1) \
     M(SettingUInt64, parallel_replicas_count, 0) \
     M(SettingUInt64, parallel_replica_offset, 0) \
     \
+    /** If a distributed query got no packet from the replica within this budget, speculatively \
+      *  open the same query on a backup replica and keep whichever responds first. \
+      * Zero means hedged requests are disabled. */ \
+    M(SettingMilliseconds, hedged_request_timeout_ms, 0) \
+    \
     /** Silently skip unavailable shards. */ \
     M(SettingBool, skip_unavailable_shards, false) \
     \
@@ -138,12 +253,21 @@ struct Settings
     /** Distribute read from MergeTree over threads evenly, ensuring stable average execution time of each thread within one read operation. */ \
     M(SettingBool, merge_tree_uniform_read_distribution, true) \
     \
+    /** The maximum number of threads to merge the data of a SELECT ... FINAL query. \
+      * If greater than 1, the key space is split into disjoint primary key ranges (using the primary indexes of the parts) \
+      *  and each range is merged independently. 1 - the classic merge in a single thread. */ \
+    M(SettingUInt64, max_final_threads, 1) \
+    \
     /** The minimum length of the expression `expr = x1 OR ... expr = xN` for optimization */ \
     M(SettingUInt64, optimize_min_equality_disjunction_chain_length, 3) \
     \
     /** The minimum number of bytes for input/output operations is bypassing the page cache. 0 - disabled. */ \
     M(SettingUInt64, min_bytes_to_use_direct_io, 0) \
     \
+    /** The minimum number of bytes for reading column data through a memory mapping of the file, \
+      * serving hot data directly out of the page cache. 0 - disabled. */ \
+    M(SettingUInt64, min_bytes_to_use_mmap_io, 0) \
+    \
     /** Throw an exception if there is an index, and it is not used. */ \
     M(SettingBool, force_index_by_date, 0) \
     M(SettingBool, force_primary_key, 0) \
@@ -163,6 +287,28 @@ struct Settings
     /** Allows you to select the method of data compression when writing */ \
     M(SettingCompressionMethod, network_compression_method, CompressionMethod::LZ4) \
     \
+    /** On INSERT, push a block to each dependent materialized view in its own thread instead of sequentially. */ \
+    M(SettingBool, parallel_view_processing, 0) \
+    \
+    /** Push to materialized views from a background thread, overlapping them with writes to the main table. \
+      * The INSERT still waits for the views (and reports their errors) at the end, \
+      *  but the latency of each block is no longer the sum of all view pipelines. \
+      */ \
+    M(SettingBool, async_view_processing, 0) \
+    \
+    /** ZSTD compression level when network_compression_method is ZSTD. \
+      * E.g. level 3 roughly halves cross-datacenter traffic compared to LZ4 at a moderate CPU cost. \
+      */ \
+    M(SettingInt64, network_zstd_compression_level, 1) \
+    \
+    /** Carry columns of blocks received from remote servers as opaque serialized buffers, \
+      *  deserializing them only when something actually reads the values. \
+      * Saves CPU for queries that merely relay blocks, such as INSERT into a Distributed table \
+      *  from a SELECT over remote(). Requires the remote servers to be recent enough \
+      *  to prefix columns with their sizes. \
+      */ \
+    M(SettingBool, network_lazy_columns, 0) \
+    \
     /** Priority of the query. 1 - the highest, higher value - lower priority; 0 - do not use priorities. */ \
     M(SettingUInt64, priority, 0) \
     \
@@ -174,8 +320,25 @@ struct Settings
       */ \
     M(SettingUInt64, log_queries_cut_to_length, 100000) \
     \
+    /** Period (in nanoseconds) of the sampling profiler of query threads. \
+      * The stack trace samples are written to the system.trace_log table \
+      *  (requires the trace_log section in the server config). 0 - disabled. \
+      */ \
+    M(SettingUInt64, query_profiler_period_ns, 0) \
+    \
+    /** Count hardware events (cycles, instructions, cache and branch misses, page faults) \
+      *  of the query threads with perf_event_open. The values are written to the query log \
+      *  and shown in system.processes. \
+      */ \
+    M(SettingBool, enable_hardware_perf_counters, 0) \
+    \
     /** How are distributed subqueries performed inside IN or JOIN sections? */ \
     M(SettingDistributedProductMode, distributed_product_mode, DistributedProductMode::DENY) \
+    /** A JOIN of two distributed tables on the same cluster with the same sharding key, computed \
+      * only from the USING columns, is executed pairwise-locally on the shards (matching rows are \
+      * always sharded alike), instead of being denied or broadcasting the inner table to every shard \
+      * according to distributed_product_mode. */ \
+    M(SettingBool, optimize_colocated_join, false) \
     \
     /** The scheme for executing GLOBAL subqueries. */ \
     M(SettingGlobalSubqueriesMethod, global_subqueries_method, GlobalSubqueriesMethod::PUSH) \
@@ -186,6 +349,11 @@ struct Settings
     /** For INSERT queries in the replicated table, wait writing for the specified number of replicas and linearize the addition of the data. 0 - disabled. */ \
     M(SettingUInt64, insert_quorum, 0) \
     M(SettingMilliseconds, insert_quorum_timeout, 600000) \
+    /** For INSERT queries into MergeTree tables, the client declares that the rows of every inserted \
+      * block already come in the order of the primary key. The per-block sortedness check and the \
+      * sorting are skipped entirely. If the declaration is violated, malformed parts are created \
+      * and query results on them are undefined - use only for trusted producers. */ \
+    M(SettingBool, insert_sorted_by_primary_key, false) \
     /** For SELECT queries from the replicated table, throw an exception if the replica does not have a chunk written with the quorum; \
       * do not read the parts that have not yet been written with the quorum. */ \
     M(SettingUInt64, select_sequential_consistency, 0) \
@@ -267,6 +435,36 @@ struct Settings
      * If false, use default value of corresponding columns data type. \
      */ \
     M(SettingBool, join_use_nulls, 0) \
+    \
+   /** Number of threads (and hash table shards) to build the JOIN map with. \
+     * 0 or 1 - build in one thread, as before. \
+     * Scattering into shards could change the order of rows inside the result blocks. \
+     */ \
+    M(SettingUInt64, join_build_threads, 0) \
+    \
+   /** Number of threads (and disjoint key ranges) to merge temporary files of an external sort with. \
+     * 0 or 1 - merge in one thread, as before. \
+     * The merged ranges are written to temporary files once more, so additional disk space is used. \
+     */ \
+    M(SettingUInt64, external_sort_merge_threads, 0) \
+    \
+   /** Maximum number of temporary files of an external sort to merge at once. \
+     * 0 or 1 - no limit, as before. \
+     * If there are more files, they are first combined by intermediate cascade merges, \
+     *  so that the final merge does not open too many files and read buffers at the same time. \
+     */ \
+    M(SettingUInt64, external_sort_max_merge_fan_in, 0) \
+    \
+   /** Use the server-side cache of results of SELECT queries (if the server has one, \
+     *  see query_result_cache_size in the server config). \
+     */ \
+    M(SettingBool, use_query_result_cache, 0) \
+   /** Don't cache results of SELECT queries larger than this (in uncompressed bytes). */ \
+    M(SettingUInt64, query_result_cache_max_entry_bytes, 16777216) \
+   /** Use the server-side cache of sets built from IN (subquery) (if the server has one, \
+     *  see set_cache_size in the server config). \
+     */ \
+    M(SettingBool, use_set_cache, 0) \
     /* */ \
     M(SettingUInt64, preferred_block_size_bytes, 1000000) \
    /** If set, distributed queries of Replicated tables will choose servers \
@@ -135,6 +135,19 @@ void NO_INLINE Aggregator::executeSpecializedCase(
     StringRefs & keys,
     AggregateDataPtr overflow_row) const
 {
+    /// Probe the hash table software-pipelined, same as in Aggregator::executeImplCase.
+    static constexpr size_t prefetch_look_ahead = 16;
+    size_t hash_values[prefetch_look_ahead];
+
+    if (Method::prefetch_suitable)
+    {
+        for (size_t i = 0, size = std::min(rows, prefetch_look_ahead); i < size; ++i)
+        {
+            hash_values[i] = method.data.hash(state.getKey(key_columns, params.keys_size, i, key_sizes, keys, *aggregates_pool));
+            method.data.prefetch(hash_values[i]);
+        }
+    }
+
     /// For all rows.
     typename Method::iterator it;
     typename Method::Key prev_key;
@@ -146,6 +159,20 @@ void NO_INLINE Aggregator::executeSpecializedCase(
         /// Get the key to insert into the hash table.
         typename Method::Key key = state.getKey(key_columns, params.keys_size, i, key_sizes, keys, *aggregates_pool);
 
+        size_t hash_value = 0;
+        if (Method::prefetch_suitable)
+        {
+            hash_value = hash_values[i % prefetch_look_ahead];
+
+            if (i + prefetch_look_ahead < rows)
+            {
+                size_t hash_ahead = method.data.hash(
+                    state.getKey(key_columns, params.keys_size, i + prefetch_look_ahead, key_sizes, keys, *aggregates_pool));
+                method.data.prefetch(hash_ahead);
+                hash_values[i % prefetch_look_ahead] = hash_ahead;
+            }
+        }
+
         if (!no_more_keys)    /// Insert.
         {
             /// Optimization for frequently repeating keys.
@@ -166,7 +193,10 @@ void NO_INLINE Aggregator::executeSpecializedCase(
                     prev_key = key;
             }
 
-            method.data.emplace(key, it, inserted);
+            if (Method::prefetch_suitable)
+                method.data.emplace(key, it, inserted, hash_value);
+            else
+                method.data.emplace(key, it, inserted);
         }
         else
         {
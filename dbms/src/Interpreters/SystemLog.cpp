@@ -1,6 +1,8 @@
 #include <Interpreters/SystemLog.h>
 #include <Interpreters/QueryLog.h>
 #include <Interpreters/PartLog.h>
+#include <Interpreters/TraceLog.h>
+#include <Interpreters/TraceCollector.h>
 
 
 namespace DB
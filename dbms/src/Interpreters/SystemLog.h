@@ -54,6 +54,8 @@ namespace DB
 class Context;
 class QueryLog;
 class PartLog;
+class TraceLog;
+class TraceCollector;
 
 
 /// System logs should be destroyed in destructor of last Context and before tables,
@@ -64,6 +66,10 @@ struct SystemLogs
 
     std::unique_ptr<QueryLog> query_log;    /// Used to log queries.
     std::unique_ptr<PartLog> part_log;      /// Used to log operations with parts
+    std::unique_ptr<TraceLog> trace_log;    /// Used to log stack trace samples of the query profiler.
+
+    /// Feeds trace_log; declared after it, so that it is destroyed (and stops writing) first.
+    std::unique_ptr<TraceCollector> trace_collector;
 };
 
 
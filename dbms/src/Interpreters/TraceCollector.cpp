@@ -0,0 +1,156 @@
+#include <cstring>
+#include <ctime>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <execinfo.h>
+#include <cxxabi.h>
+
+#include <Common/QueryProfiler.h>
+#include <Common/Exception.h>
+#include <Common/setThreadName.h>
+#include <Interpreters/TraceCollector.h>
+#include <Interpreters/TraceLog.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_PIPE;
+    extern const int CANNOT_FCNTL;
+}
+
+namespace
+{
+
+/// Returns symbolized and demangled representations of the frames, in the manner of StackTrace::toString.
+Strings symbolizeFrames(void * const * frames, size_t size)
+{
+    Strings res;
+    res.reserve(size);
+
+    char ** symbols = backtrace_symbols(frames, size);
+    if (!symbols)
+        return res;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        char * name_start = nullptr;
+        char * name_end = nullptr;
+        char * demangled_name = nullptr;
+        int status = 0;
+
+        if (nullptr != (name_start = strchr(symbols[i], '('))
+            && nullptr != (name_end = strchr(name_start, '+')))
+        {
+            ++name_start;
+            *name_end = '\0';
+            demangled_name = abi::__cxa_demangle(name_start, 0, 0, &status);
+            *name_end = '+';
+        }
+
+        if (nullptr != demangled_name && 0 == status)
+        {
+            String symbol(symbols[i], name_start - symbols[i]);
+            symbol += demangled_name;
+            symbol += name_end;
+            res.push_back(symbol);
+        }
+        else
+            res.push_back(symbols[i]);
+
+        free(demangled_name);
+    }
+
+    free(symbols);
+    return res;
+}
+
+}
+
+
+TraceCollector::TraceCollector(TraceLog & trace_log_)
+    : trace_log(trace_log_)
+{
+    if (pipe(trace_pipe))
+        throwFromErrno("Cannot create pipe for query profiler traces", ErrorCodes::CANNOT_PIPE);
+
+    /// The signal handlers must never block on a full pipe - excess samples are dropped instead.
+    if (fcntl(trace_pipe[1], F_SETFL, O_NONBLOCK))
+        throwFromErrno("Cannot set non-blocking mode for query profiler trace pipe", ErrorCodes::CANNOT_FCNTL);
+
+    thread = std::thread(&TraceCollector::run, this);
+
+    QueryProfiler::setTracePipeWriteFd(trace_pipe[1]);
+}
+
+
+TraceCollector::~TraceCollector()
+{
+    QueryProfiler::setTracePipeWriteFd(-1);
+
+    /// A record with this frames_size tells the collector thread to stop.
+    QueryProfilerTraceRecord stop_record;
+    memset(&stop_record, 0, sizeof(stop_record));
+    stop_record.frames_size = UInt32(-1);
+
+    ssize_t res = ::write(trace_pipe[1], &stop_record, sizeof(stop_record));
+    (void)res;
+
+    if (thread.joinable())
+        thread.join();
+
+    close(trace_pipe[1]);
+    close(trace_pipe[0]);
+}
+
+
+void TraceCollector::run()
+{
+    setThreadName("TraceCollector");
+
+    while (true)
+    {
+        QueryProfilerTraceRecord record;
+
+        /// Writes of the records are atomic, but reads may return less than the whole record.
+        size_t bytes_read = 0;
+        while (bytes_read < sizeof(record))
+        {
+            ssize_t res = ::read(trace_pipe[0], reinterpret_cast<char *>(&record) + bytes_read, sizeof(record) - bytes_read);
+
+            if (res < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return;
+            }
+
+            if (res == 0)
+                return;    /// The write end is closed.
+
+            bytes_read += res;
+        }
+
+        if (record.frames_size == UInt32(-1))
+            return;
+
+        TraceLogElement element;
+        element.event_time = time(nullptr);
+        element.query_id.assign(record.query_id, std::min<size_t>(record.query_id_size, QueryProfilerTraceRecord::max_query_id_size));
+        element.thread_number = record.thread_number;
+
+        size_t frames_size = std::min<size_t>(record.frames_size, QueryProfilerTraceRecord::max_frames);
+        element.trace.reserve(frames_size);
+        for (size_t i = 0; i < frames_size; ++i)
+            element.trace.push_back(reinterpret_cast<UInt64>(record.frames[i]));
+
+        element.symbols = symbolizeFrames(record.frames, frames_size);
+
+        trace_log.add(element);
+    }
+}
+
+}
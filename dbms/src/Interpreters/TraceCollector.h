@@ -0,0 +1,33 @@
+#pragma once
+
+#include <thread>
+#include <boost/noncopyable.hpp>
+
+
+namespace DB
+{
+
+class TraceLog;
+
+/** Reads stack trace samples that QueryProfiler writes into a pipe from its signal handlers,
+  *  symbolizes the frames and puts them into the system.trace_log table.
+  * Started together with the trace log (see Context::getTraceLog) and runs in a separate thread.
+  */
+class TraceCollector : private boost::noncopyable
+{
+public:
+    TraceCollector(TraceLog & trace_log_);
+    ~TraceCollector();
+
+private:
+    TraceLog & trace_log;
+
+    /// trace_pipe[0] - read end (collector), trace_pipe[1] - write end (signal handlers).
+    int trace_pipe[2] {-1, -1};
+
+    std::thread thread;
+
+    void run();
+};
+
+}
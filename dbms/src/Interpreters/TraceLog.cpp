@@ -0,0 +1,55 @@
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnArray.h>
+#include <Columns/ColumnString.h>
+#include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataTypes/DataTypeDateTime.h>
+#include <DataTypes/DataTypeDate.h>
+#include <DataTypes/DataTypeString.h>
+#include <Interpreters/TraceLog.h>
+
+
+namespace DB
+{
+
+Block TraceLogElement::createBlock()
+{
+    return
+    {
+        {std::make_shared<ColumnUInt16>(),  std::make_shared<DataTypeDate>(),       "event_date"},
+        {std::make_shared<ColumnUInt32>(),  std::make_shared<DataTypeDateTime>(),   "event_time"},
+
+        {std::make_shared<ColumnString>(),  std::make_shared<DataTypeString>(),     "query_id"},
+        {std::make_shared<ColumnUInt32>(),  std::make_shared<DataTypeUInt32>(),     "thread_number"},
+
+        {std::make_shared<ColumnArray>(std::make_shared<ColumnUInt64>()),
+            std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>()),    "trace"},
+        {std::make_shared<ColumnArray>(std::make_shared<ColumnString>()),
+            std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>()),    "symbols"},
+    };
+}
+
+void TraceLogElement::appendToBlock(Block & block) const
+{
+    size_t i = 0;
+
+    block.getByPosition(i++).column->insert(UInt64(DateLUT::instance().toDayNum(event_time)));
+    block.getByPosition(i++).column->insert(UInt64(event_time));
+
+    block.getByPosition(i++).column->insert(query_id);
+    block.getByPosition(i++).column->insert(UInt64(thread_number));
+
+    Array trace_array;
+    trace_array.reserve(trace.size());
+    for (const UInt64 frame : trace)
+        trace_array.push_back(frame);
+    block.getByPosition(i++).column->insert(trace_array);
+
+    Array symbols_array;
+    symbols_array.reserve(symbols.size());
+    for (const auto & symbol : symbols)
+        symbols_array.push_back(symbol);
+    block.getByPosition(i++).column->insert(symbols_array);
+}
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Interpreters/SystemLog.h>
+
+
+namespace DB
+{
+
+/** Stack trace samples collected by the query profiler (see QueryProfiler and TraceCollector).
+  * One row per sample; allows to build per-query flamegraphs without attaching perf to the server.
+  */
+struct TraceLogElement
+{
+    time_t event_time{};
+
+    String query_id;
+    UInt32 thread_number{};
+
+    /// Addresses of the stack frames, from the innermost frame to the outermost.
+    std::vector<UInt64> trace;
+    /// The same frames, symbolized and demangled.
+    Strings symbols;
+
+    static std::string name() { return "TraceLog"; }
+
+    static Block createBlock();
+    void appendToBlock(Block & block) const;
+};
+
+
+/// Instead of typedef - to allow forward declaration.
+class TraceLog : public SystemLog<TraceLogElement>
+{
+    using SystemLog<TraceLogElement>::SystemLog;
+};
+
+}
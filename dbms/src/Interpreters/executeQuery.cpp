@@ -4,15 +4,31 @@
 
 #include <IO/ConcatReadBuffer.h>
 #include <IO/WriteBufferFromFile.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <IO/CompressedReadBuffer.h>
+#include <IO/CompressedWriteBuffer.h>
 
 #include <DataStreams/BlockIO.h>
 #include <DataStreams/copyData.h>
 #include <DataStreams/IProfilingBlockInputStream.h>
 #include <DataStreams/InputStreamFromASTInsertQuery.h>
 #include <DataStreams/CountingBlockOutputStream.h>
+#include <DataStreams/BlocksListBlockInputStream.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <DataStreams/NativeBlockOutputStream.h>
 
+#include <Functions/FunctionFactory.h>
+
+#include <Parsers/ASTFunction.h>
 #include <Parsers/ASTInsertQuery.h>
+#include <Parsers/ASTSelectQuery.h>
+#include <Parsers/ASTSetQuery.h>
+#include <Parsers/ASTUseQuery.h>
+#include <Parsers/ASTCheckQuery.h>
+#include <Parsers/ASTShowTablesQuery.h>
 #include <Parsers/ASTShowProcesslistQuery.h>
+#include <Parsers/TablePropertiesQueriesASTs.h>
 #include <Parsers/ASTIdentifier.h>
 #include <Parsers/ASTLiteral.h>
 #include <Parsers/ParserQuery.h>
@@ -22,6 +38,7 @@
 #include <Interpreters/InterpreterFactory.h>
 #include <Interpreters/ProcessList.h>
 #include <Interpreters/QueryLog.h>
+#include <Interpreters/QueryResultCache.h>
 #include <Interpreters/executeQuery.h>
 
 
@@ -90,6 +107,148 @@ static void logException(Context & context, QueryLogElement & elem)
 }
 
 
+/// Could the query change the data in tables, so that the cached results of SELECTs become stale?
+/// (There is no per-table data version, so any such query invalidates the whole query result cache.)
+static bool mayChangeData(const IAST & ast)
+{
+    return !(typeid_cast<const ASTSelectQuery *>(&ast)
+        || typeid_cast<const ASTSetQuery *>(&ast)
+        || typeid_cast<const ASTUseQuery *>(&ast)
+        || typeid_cast<const ASTCheckQuery *>(&ast)
+        || typeid_cast<const ASTShowTablesQuery *>(&ast)
+        || typeid_cast<const ASTShowProcesslistQuery *>(&ast)
+        || typeid_cast<const ASTExistsQuery *>(&ast)
+        || typeid_cast<const ASTShowCreateQuery *>(&ast)
+        || typeid_cast<const ASTDescribeQuery *>(&ast));
+}
+
+
+/// Does the query contain a function that can give a different result when the query is executed
+///  again: now(), rand(), randConstant() etc.? Such a result must not be served from the cache.
+static bool hasNonDeterministicFunctions(const IAST & ast, const Context & context)
+{
+    if (const ASTFunction * function = typeid_cast<const ASTFunction *>(&ast))
+    {
+        /// Not every ASTFunction is an ordinary function: aggregate functions, table functions
+        ///  and lambdas are not in the factory; they are either deterministic themselves
+        ///  or are accounted for by the functions in their arguments.
+        if (FunctionPtr concrete = FunctionFactory::instance().tryGet(function->name, context))
+            if (!concrete->isDeterministic())
+                return true;
+    }
+
+    for (const auto & child : ast.children)
+        if (hasNonDeterministicFunctions(*child, context))
+            return true;
+
+    return false;
+}
+
+
+/// Does any SELECT of the UNION ALL chain have WITH TOTALS?
+static bool hasGroupByWithTotals(const ASTSelectQuery & select)
+{
+    for (const ASTSelectQuery * current = &select; current;
+        current = static_cast<const ASTSelectQuery *>(current->next_union_all.get()))
+        if (current->group_by_with_totals)
+            return true;
+
+    return false;
+}
+
+
+namespace
+{
+
+/// Passes the result blocks through and, if the result was read to the end, stores it in the query result cache.
+class StoreInQueryResultCacheBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    StoreInQueryResultCacheBlockInputStream(
+        const BlockInputStreamPtr & input, const QueryResultCachePtr & cache_, const QueryResultCache::Key & key_, size_t max_entry_bytes_)
+        : cache(cache_), key(key_), max_entry_bytes(max_entry_bytes_)
+    {
+        children.push_back(input);
+    }
+
+    String getName() const override { return "StoreInQueryResultCache"; }
+    String getID() const override { return "StoreInQueryResultCache(" + children.back()->getID() + ")"; }
+
+protected:
+    Block readImpl() override
+    {
+        Block res = children.back()->read();
+
+        if (!cache)
+            return res;
+
+        if (res)
+        {
+            sum_bytes += res.bytes();
+
+            /// The result is too large to cache.
+            if (sum_bytes > max_entry_bytes)
+            {
+                cache = nullptr;
+                blocks.clear();
+                return res;
+            }
+
+            blocks.push_back(res);
+        }
+        else if (!isCancelled())
+        {
+            /// The result was read in full - serialize, compress and store it.
+            auto cell = std::make_shared<QueryResultCacheCell>();
+
+            {
+                WriteBufferFromString buf(cell->data);
+                CompressedWriteBuffer compressed_buf(buf);
+                NativeBlockOutputStream out(compressed_buf);
+
+                out.writePrefix();
+                for (const auto & block : blocks)
+                    out.write(block);
+                out.writeSuffix();
+                compressed_buf.next();
+            }
+
+            cache->set(key, cell);
+            cache = nullptr;
+        }
+
+        return res;
+    }
+
+private:
+    QueryResultCachePtr cache;
+    QueryResultCache::Key key;
+    size_t max_entry_bytes;
+
+    BlocksList blocks;
+    size_t sum_bytes = 0;
+};
+
+}
+
+
+/// Deserialize a result stored by the stream above.
+static BlockInputStreamPtr streamFromQueryResultCacheCell(const QueryResultCacheCell & cell)
+{
+    ReadBufferFromString buf(cell.data);
+    CompressedReadBuffer compressed_buf(buf);
+    NativeBlockInputStream in(compressed_buf);
+
+    BlocksList blocks;
+    in.readPrefix();
+    while (Block block = in.read())
+        blocks.push_back(block);
+    in.readSuffix();
+
+    return std::make_shared<BlocksListBlockInputStream>(std::move(blocks));
+}
+
+
 static void onExceptionBeforeStart(const String & query, Context & context, time_t current_time)
 {
     /// Exception before the query execution.
@@ -125,7 +284,8 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
     const char * end,
     Context & context,
     bool internal,
-    QueryProcessingStage::Enum stage)
+    QueryProcessingStage::Enum stage,
+    ASTPtr ast = nullptr)
 {
     ProfileEvents::increment(ProfileEvents::Query);
     time_t current_time = time(nullptr);
@@ -133,7 +293,6 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
     const Settings & settings = context.getSettingsRef();
 
     ParserQuery parser(end);
-    ASTPtr ast;
     size_t query_size;
 
     /// Don't limit the size of internal queries.
@@ -143,17 +302,25 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
 
     try
     {
-        /// TODO Parser should fail early when max_query_size limit is reached.
-        ast = parseQuery(parser, begin, end, "");
+        if (ast)
+        {
+            /// The query was parsed in advance (a prepared statement); `begin .. end` is its formatted text for logs.
+            query_size = end - begin;
+        }
+        else
+        {
+            /// TODO Parser should fail early when max_query_size limit is reached.
+            ast = parseQuery(parser, begin, end, "");
 
-        /// Copy query into string. It will be written to log and presented in processlist. If an INSERT query, string will not include data to insertion.
-        if (!(begin <= ast->range.first && ast->range.second <= end))
-            throw Exception("Unexpected behavior: AST chars range is not inside source range", ErrorCodes::LOGICAL_ERROR);
-        query_size = ast->range.second - begin;
+            /// Copy query into string. It will be written to log and presented in processlist. If an INSERT query, string will not include data to insertion.
+            if (!(begin <= ast->range.first && ast->range.second <= end))
+                throw Exception("Unexpected behavior: AST chars range is not inside source range", ErrorCodes::LOGICAL_ERROR);
+            query_size = ast->range.second - begin;
 
-        if (max_query_size && query_size > max_query_size)
-            throw Exception("Query is too large (" + toString(query_size) + ")."
-                " max_query_size = " + toString(max_query_size), ErrorCodes::QUERY_IS_TOO_LARGE);
+            if (max_query_size && query_size > max_query_size)
+                throw Exception("Query is too large (" + toString(query_size) + ")."
+                    " max_query_size = " + toString(max_query_size), ErrorCodes::QUERY_IS_TOO_LARGE);
+        }
     }
     catch (...)
     {
@@ -195,11 +362,51 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                 settings);
 
             context.setProcessListElement(&process_list_entry->get());
+
+            /// Start the sampling profiler of query threads, if requested and if the trace log is configured.
+            UInt64 profiler_period_ns = settings.query_profiler_period_ns;
+            if (profiler_period_ns && !context.getTraceLog())
+                profiler_period_ns = 0;
+            (*process_list_entry)->initQueryProfiler(profiler_period_ns);
         }
 
         auto interpreter = InterpreterFactory::get(ast, context, stage);
         res = interpreter->execute();
 
+        if (mayChangeData(*ast))
+        {
+            /// There is no per-table data version, so any query that could modify data
+            ///  invalidates the server-side caches of query results and of sets built from subqueries.
+            context.dropQueryResultCache();
+            context.dropSetCache();
+        }
+
+        /// The server-side cache of results of SELECT queries (if enabled, see query_result_cache_size in the server config).
+        if (QueryResultCachePtr query_result_cache = context.getQueryResultCache())
+        {
+            if (const ASTSelectQuery * select = typeid_cast<const ASTSelectQuery *>(ast.get()))
+            {
+                /// Totals and extremes are delivered out of band through getTotals()/getExtremes(),
+                ///  but the cell stores only the main result blocks - a hit would silently lose them.
+                bool has_out_of_band_data = settings.extremes || hasGroupByWithTotals(*select);
+
+                /// NOTE The interpreter has been executed anyway: the pipeline is built lazily and checks access rights,
+                ///  and its sample block is used to format the result; only reading the data is replaced on a cache hit.
+                if (settings.use_query_result_cache && !internal && !has_out_of_band_data
+                    && res.in && stage == QueryProcessingStage::Complete
+                    && !hasNonDeterministicFunctions(*ast, context))
+                {
+                    QueryResultCache::Key key = QueryResultCache::hash(*ast, context.getCurrentDatabase(), settings);
+
+                    if (QueryResultCache::MappedPtr cell = query_result_cache->get(key))
+                        res.in = streamFromQueryResultCacheCell(*cell);
+                    else
+                        res.in = std::make_shared<StoreInQueryResultCacheBlockInputStream>(
+                            res.in, query_result_cache, key, settings.query_result_cache_max_entry_bytes);
+                }
+            }
+        }
+
         /// Delayed initialization of query streams (required for KILL QUERY purposes)
         if (process_list_entry)
             (*process_list_entry)->setQueryStreams(res);
@@ -267,6 +474,15 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                 auto memory_usage = process_list_elem->memory_tracker.getPeak();
                 elem.memory_usage = memory_usage > 0 ? memory_usage : 0;
 
+                elem.hardware_counters = process_list_elem->hardware_counters.getValues();
+
+                /// The last deltas of this thread may not have reached a flush point yet.
+                ProfileEvents::updateCounters(&process_list_elem->profile_counters);
+
+                for (ProfileEvents::Event event = 0; event < ProfileEvents::end(); ++event)
+                    if (auto value = process_list_elem->profile_counters.get(event))
+                        elem.profile_events.emplace_back(ProfileEvents::getDescription(event), value);
+
                 if (stream_in)
                 {
                     if (auto profiling_stream = dynamic_cast<const IProfilingBlockInputStream *>(stream_in))
@@ -277,6 +493,14 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                         elem.result_rows = info.rows;
                         elem.result_bytes = info.bytes;
                     }
+
+                    /// Which pipeline stages held the memory.
+                    {
+                        std::stringstream log_str;
+                        log_str << "Peak memory usage by pipeline stage:\n";
+                        stream_in->dumpPeakMemoryUsage(log_str);
+                        LOG_DEBUG(&Logger::get("executeQuery"), log_str.str());
+                    }
                 }
                 else if (stream_out) /// will be used only for ordinary INSERT queries
                 {
@@ -366,6 +590,19 @@ BlockIO executeQuery(
 }
 
 
+BlockIO executeQuery(
+    const ASTPtr & ast,
+    const String & query,
+    Context & context,
+    bool internal,
+    QueryProcessingStage::Enum stage)
+{
+    BlockIO streams;
+    std::tie(std::ignore, streams) = executeQueryImpl(query.data(), query.data() + query.size(), context, internal, stage, ast);
+    return streams;
+}
+
+
 void executeQuery(
     ReadBuffer & istr,
     WriteBuffer & ostr,
@@ -2,6 +2,7 @@
 
 #include <Core/QueryProcessingStage.h>
 #include <DataStreams/BlockIO.h>
+#include <Parsers/IAST.h>
 
 
 namespace DB
@@ -39,4 +40,15 @@ BlockIO executeQuery(
     QueryProcessingStage::Enum stage = QueryProcessingStage::Complete    /// To which stage the query must be executed.
     );
 
+
+/// Same, but for a query that was parsed in advance (e.g. a prepared statement).
+/// `query` is its text, used for the query log and the process list.
+BlockIO executeQuery(
+    const ASTPtr & ast,
+    const String & query,
+    Context & context,
+    bool internal = false,
+    QueryProcessingStage::Enum stage = QueryProcessingStage::Complete
+    );
+
 }
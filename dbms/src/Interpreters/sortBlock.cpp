@@ -1,6 +1,10 @@
 #include <Interpreters/sortBlock.h>
 
 #include <Columns/ColumnString.h>
+#include <Columns/ColumnVector.h>
+#include <Common/NaNUtils.h>
+#include <Common/PODArray.h>
+#include <Common/RadixSort.h>
 #include <Common/typeid_cast.h>
 
 
@@ -96,6 +100,142 @@ struct PartialSortingLessWithCollation
 };
 
 
+namespace
+{
+    /** A fast path for single-column sorts by a numeric column: LSD radix sort of (key, row number) pairs
+      *  instead of a comparison sort with virtual compareAt calls (see Common/RadixSort.h).
+      */
+
+    template <typename T>
+    struct RadixSortPermutationElement
+    {
+        T key;
+        UInt32 index;
+    };
+
+    /// How to transform the bits of the key so that unsigned comparison of the results matches the order of the keys.
+    template <typename T, bool is_float = std::is_floating_point<T>::value>
+    struct RadixSortKeyTraits;
+
+    template <typename T>
+    struct RadixSortKeyTraits<T, true>
+    {
+        using KeyBits = typename std::conditional<sizeof(T) == 8, uint64_t, uint32_t>::type;
+        using Transform = RadixSortFloatTransform<KeyBits>;
+    };
+
+    template <typename T>
+    struct RadixSortKeyTraits<T, false>
+    {
+        using KeyBits = typename std::make_unsigned<T>::type;
+        using Transform = typename std::conditional<std::is_signed<T>::value,
+            RadixSortSignedTransform<KeyBits>,
+            RadixSortIdentityTransform<KeyBits>>::type;
+    };
+
+    template <typename T>
+    struct RadixSortPermutationTraits
+    {
+        using Element = RadixSortPermutationElement<T>;
+        using Key = T;
+        using CountType = uint32_t;
+        using KeyBits = typename RadixSortKeyTraits<T>::KeyBits;
+
+        static constexpr size_t PART_SIZE_BITS = 8;
+
+        using Transform = typename RadixSortKeyTraits<T>::Transform;
+        using Allocator = RadixSortMallocAllocator;
+
+        static Key & extractKey(Element & elem) { return elem.key; }
+    };
+
+    template <typename T>
+    bool tryRadixSortPermutationTyped(const IColumn & column, bool reverse, int nan_direction_hint, IColumn::Permutation & perm)
+    {
+        const ColumnVector<T> * concrete = typeid_cast<const ColumnVector<T> *>(&column);
+        if (!concrete)
+            return false;
+
+        const typename ColumnVector<T>::Container_t & data = concrete->getData();
+        size_t size = data.size();
+
+        using Element = RadixSortPermutationElement<T>;
+        PODArray<Element> pairs;
+        pairs.reserve(size);
+
+        /// NaNs do not fit the bitwise key transform: it orders them by bit pattern, with negative NaNs
+        ///  before -inf and positive NaNs after +inf. Set them aside and place them all on the side
+        ///  requested by the hint, as CompareHelper<Float> does. Empty for non-float types.
+        PODArray<UInt32> nan_indexes;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (isNaN(data[i]))
+                nan_indexes.push_back(i);
+            else
+            {
+                Element elem;
+                elem.key = data[i];
+                elem.index = i;
+                pairs.push_back(elem);
+            }
+        }
+
+        if (!pairs.empty())
+            RadixSort<RadixSortPermutationTraits<T>>::execute(&pairs[0], pairs.size());
+
+        /** The sort is ascending and stable; for descending order, just read the result backwards.
+          * nan_direction_hint == 1 means NaNs are the largest values: the end in ascending order,
+          *  the beginning in descending order (reading backwards flips the NaN side too).
+          */
+        perm.resize(size);
+        size_t pos = 0;
+        bool nans_first = reverse == (nan_direction_hint > 0);
+
+        if (nans_first)
+            for (size_t i = 0; i < nan_indexes.size(); ++i)
+                perm[pos++] = nan_indexes[i];
+
+        if (reverse)
+            for (size_t i = pairs.size(); i > 0; --i)
+                perm[pos++] = pairs[i - 1].index;
+        else
+            for (size_t i = 0; i < pairs.size(); ++i)
+                perm[pos++] = pairs[i].index;
+
+        if (!nans_first)
+            for (size_t i = 0; i < nan_indexes.size(); ++i)
+                perm[pos++] = nan_indexes[i];
+
+        return true;
+    }
+
+    /** Get the sort permutation by radix sort, if it is applicable:
+      *  a numeric or date column (ColumnVector, so there are no NULLs) and the whole block is sorted.
+      * With a `limit`, std::partial_sort inside IColumn::getPermutation is expected to be better.
+      */
+    bool tryRadixSortPermutation(const IColumn & column, bool reverse, size_t limit, int nan_direction_hint, IColumn::Permutation & perm)
+    {
+        size_t size = column.size();
+
+        /// For small arrays, a comparison sort is not worse. Row numbers are stored in UInt32.
+        if (size < 256 || size > (1ULL << 32) || (limit && limit < size))
+            return false;
+
+        return tryRadixSortPermutationTyped<UInt8>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<UInt16>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<UInt32>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<UInt64>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<Int8>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<Int16>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<Int32>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<Int64>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<Float32>(column, reverse, nan_direction_hint, perm)
+            || tryRadixSortPermutationTyped<Float64>(column, reverse, nan_direction_hint, perm);
+    }
+}
+
+
 void sortBlock(Block & block, const SortDescription & description, size_t limit)
 {
     if (!block)
@@ -116,7 +256,7 @@ void sortBlock(Block & block, const SortDescription & description, size_t limit)
             const ColumnString & column_string = typeid_cast<const ColumnString &>(*column);
             column_string.getPermutationWithCollation(*description[0].collator, reverse, limit, perm);
         }
-        else
+        else if (!tryRadixSortPermutation(*column, reverse, limit, description[0].nulls_direction, perm))
             column->getPermutation(reverse, limit, description[0].nulls_direction, perm);
 
         size_t columns = block.columns();
@@ -18,6 +18,7 @@ void ASTAlterQuery::Parameters::clone(Parameters & p) const
     if (col_decl)           p.col_decl = col_decl->clone();
     if (column)             p.column = column->clone();
     if (partition)          p.partition = partition->clone();
+    if (predicate)          p.predicate = predicate->clone();
     if (weighted_zookeeper_paths) p.weighted_zookeeper_paths = weighted_zookeeper_paths->clone();
     if (sharding_key_expr)  p.sharding_key_expr = sharding_key_expr->clone();
     if (coordinator)        p.coordinator = coordinator->clone();
@@ -32,6 +33,8 @@ void ASTAlterQuery::addParameters(const Parameters & params)
         children.push_back(params.column);
     if (params.partition)
         children.push_back(params.partition);
+    if (params.predicate)
+        children.push_back(params.predicate);
     if (params.weighted_zookeeper_paths)
         children.push_back(params.weighted_zookeeper_paths);
     if (params.sharding_key_expr)
@@ -163,6 +166,11 @@ void ASTAlterQuery::formatQueryImpl(const FormatSettings & settings, FormatState
                     << " " << std::quoted(p.with_name, '\'');
             }
         }
+        else if (p.type == ASTAlterQuery::DELETE_WHERE)
+        {
+            settings.ostr << (settings.hilite ? hilite_keyword : "") << indent_str << "DELETE WHERE " << (settings.hilite ? hilite_none : "");
+            p.predicate->formatImpl(settings, state, frame);
+        }
         else if (p.type == ASTAlterQuery::RESHARD_PARTITION)
         {
             settings.ostr << (settings.hilite ? hilite_keyword : "") << indent_str << "RESHARD ";
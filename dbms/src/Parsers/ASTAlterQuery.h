@@ -14,6 +14,7 @@ namespace DB
  *      DROP COLUMN col_drop [FROM PARTITION partition],
  *      MODIFY COLUMN col_name type,
  *      DROP PARTITION partition,
+ *      DELETE WHERE expression,
  *      RESHARD [COPY] PARTITION partition
  *          TO '/path/to/zookeeper/table' [WEIGHT w], ...
  *              USING expression
@@ -36,6 +37,8 @@ public:
         FREEZE_PARTITION,
         RESHARD_PARTITION,
 
+        DELETE_WHERE,
+
         NO_TYPE,
     };
 
@@ -64,6 +67,10 @@ public:
           */
         ASTPtr partition;
 
+        /** For DELETE WHERE: the condition selecting rows to delete.
+          */
+        ASTPtr predicate;
+
         bool detach = false;        /// true for DETACH PARTITION
 
         bool part = false;          /// true for ATTACH PART
@@ -2,8 +2,10 @@
 
 #include <Parsers/ASTExpressionList.h>
 #include <Parsers/ASTFunction.h>
+#include <Parsers/ASTSetQuery.h>
 #include <Parsers/ASTQueryWithOutput.h>
 #include <Parsers/ASTQueryWithOnCluster.h>
+#include <Common/typeid_cast.h>
 
 
 namespace DB
@@ -24,6 +26,9 @@ public:
     String table;
     ASTPtr columns;
     ASTPtr storage;
+    ASTPtr ttl_expression;    /// Expiration time of rows; rows for which it is in the past are dropped during merges.
+    ASTPtr projection_query;    /// Aggregating SELECT maintained as a secondary representation of every part.
+    ASTPtr table_settings;    /// SETTINGS clause: per-table overrides of MergeTree settings (ASTSetQuery).
     ASTPtr inner_storage;    /// Internal engine for the CREATE MATERIALIZED VIEW query
     String as_database;
     String as_table;
@@ -42,6 +47,9 @@ public:
 
         if (columns)        { res->columns = columns->clone();              res->children.push_back(res->columns); }
         if (storage)        { res->storage = storage->clone();              res->children.push_back(res->storage); }
+        if (ttl_expression) { res->ttl_expression = ttl_expression->clone(); res->children.push_back(res->ttl_expression); }
+        if (projection_query) { res->projection_query = projection_query->clone(); res->children.push_back(res->projection_query); }
+        if (table_settings) { res->table_settings = table_settings->clone();     res->children.push_back(res->table_settings); }
         if (select)         { res->select = select->clone();                res->children.push_back(res->select); }
         if (inner_storage)  { res->inner_storage = inner_storage->clone();  res->children.push_back(res->inner_storage); }
 
@@ -124,6 +132,32 @@ protected:
             storage->formatImpl(settings, state, frame);
         }
 
+        if (ttl_expression)
+        {
+            settings.ostr << (settings.hilite ? hilite_keyword : "") << " TTL " << (settings.hilite ? hilite_none : "");
+            ttl_expression->formatImpl(settings, state, frame);
+        }
+
+        if (projection_query)
+        {
+            settings.ostr << (settings.hilite ? hilite_keyword : "") << " PROJECTION " << (settings.hilite ? hilite_none : "");
+            projection_query->formatImpl(settings, state, frame);
+        }
+
+        if (table_settings)
+        {
+            settings.ostr << (settings.hilite ? hilite_keyword : "") << " SETTINGS " << (settings.hilite ? hilite_none : "");
+
+            const ASTSetQuery::Changes & changes = typeid_cast<const ASTSetQuery &>(*table_settings).changes;
+            for (ASTSetQuery::Changes::const_iterator it = changes.begin(); it != changes.end(); ++it)
+            {
+                if (it != changes.begin())
+                    settings.ostr << ", ";
+
+                settings.ostr << it->name << " = " << applyVisitor(FieldVisitorToString(), it->value);
+            }
+        }
+
         if (inner_storage)
         {
             settings.ostr << (settings.hilite ? hilite_keyword : "") << " ENGINE" << (settings.hilite ? hilite_none : "") << " = ";
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Parsers/ASTQueryWithOutput.h>
+
+
+namespace DB
+{
+
+/** EXPLAIN SELECT ... query
+  */
+class ASTExplainQuery : public ASTQueryWithOutput
+{
+public:
+    /// The SELECT query to be explained.
+    ASTPtr query;
+
+    ASTExplainQuery() = default;
+    explicit ASTExplainQuery(const StringRange range_) : ASTQueryWithOutput(range_) {}
+
+    String getID() const override { return "ExplainQuery"; }
+
+    ASTPtr clone() const override
+    {
+        auto res = std::make_shared<ASTExplainQuery>(*this);
+        res->children.clear();
+
+        if (query)
+        {
+            res->query = query->clone();
+            res->children.push_back(res->query);
+        }
+
+        cloneOutputOptions(*res);
+        return res;
+    }
+
+protected:
+    void formatQueryImpl(const FormatSettings & settings, FormatState & state, FormatStateStacked frame) const override
+    {
+        settings.ostr << (settings.hilite ? hilite_keyword : "") << "EXPLAIN " << (settings.hilite ? hilite_none : "");
+        query->formatImpl(settings, state, frame);
+    }
+};
+
+}
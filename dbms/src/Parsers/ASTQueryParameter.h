@@ -0,0 +1,36 @@
+#pragma once
+
+#include <IO/WriteHelpers.h>
+#include <Parsers/ASTWithAlias.h>
+
+
+namespace DB
+{
+
+/** Positional parameter of a prepared statement: ?1, ?2, ...
+  * Must be replaced with a literal (see substituteQueryParameters) before the query is analyzed.
+  */
+class ASTQueryParameter : public ASTWithAlias
+{
+public:
+    /// 1-based position of the parameter.
+    size_t index = 0;
+
+    ASTQueryParameter() = default;
+    ASTQueryParameter(const StringRange range_, size_t index_) : ASTWithAlias(range_), index(index_) {}
+
+    /** Get the text that identifies this element. */
+    String getID() const override { return "QueryParameter_" + toString(index); }
+
+    ASTPtr clone() const override { return std::make_shared<ASTQueryParameter>(*this); }
+
+protected:
+    void formatImplWithoutAlias(const FormatSettings & settings, FormatState & state, FormatStateStacked frame) const override
+    {
+        settings.ostr << '?' << index;
+    }
+
+    String getColumnNameImpl() const override { return "?" + toString(index); }
+};
+
+}
@@ -47,6 +47,8 @@ const char * ASTSystemQuery::typeToString(Type type)
             return "STOP REPLICATION QUEUES";
         case Type::START_REPLICATION_QUEUES:
             return "START REPLICATION QUEUES";
+        case Type::PRELOAD_COMPILED_EXPRESSIONS:
+            return "PRELOAD COMPILED EXPRESSIONS";
         default:
             throw Exception("Unknown SYSTEM query command", ErrorCodes::BAD_TYPE_OF_FIELD);
     }
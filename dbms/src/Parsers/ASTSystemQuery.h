@@ -28,6 +28,7 @@ public:
         START_MERGES,
         STOP_REPLICATION_QUEUES,
         START_REPLICATION_QUEUES,
+        PRELOAD_COMPILED_EXPRESSIONS,
         END
     };
 
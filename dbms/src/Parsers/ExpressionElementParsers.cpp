@@ -9,6 +9,7 @@
 #include <Parsers/ASTFunction.h>
 #include <Parsers/ASTIdentifier.h>
 #include <Parsers/ASTLiteral.h>
+#include <Parsers/ASTQueryParameter.h>
 #include <Parsers/ASTAsterisk.h>
 #include <Parsers/ASTQualifiedAsterisk.h>
 #include <Parsers/ASTOrderByElement.h>
@@ -570,6 +571,43 @@ bool ParserArrayOfLiterals::parseImpl(Pos & pos, ASTPtr & node, Expected & expec
 }
 
 
+bool ParserQueryParameter::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
+{
+    Pos begin = pos;
+
+    if (pos->type != TokenType::QuestionMark)
+        return false;
+    ++pos;
+
+    if (pos->type != TokenType::Number)
+    {
+        expected.add(pos, "parameter number after '?'");
+        return false;
+    }
+
+    size_t index = 0;
+    for (const char * it = pos->begin; it != pos->end; ++it)
+    {
+        if (*it < '0' || *it > '9')
+        {
+            expected.add(pos, "positional parameter number");
+            return false;
+        }
+        index = index * 10 + (*it - '0');
+    }
+
+    if (!index)
+    {
+        expected.add(pos, "positional parameter number starting from 1");
+        return false;
+    }
+
+    ++pos;
+    node = std::make_shared<ASTQueryParameter>(StringRange(begin, pos), index);
+    return true;
+}
+
+
 bool ParserLiteral::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
 {
     ParserNull null_p;
@@ -696,6 +734,7 @@ bool ParserExpressionElement::parseImpl(Pos & pos, ASTPtr & node, Expected & exp
     ParserArray array_p;
     ParserArrayOfLiterals array_lite_p;
     ParserLiteral lit_p;
+    ParserQueryParameter param_p;
     ParserCastExpression fun_p;
     ParserCompoundIdentifier id_p;
     ParserAsterisk asterisk_p;
@@ -716,6 +755,9 @@ bool ParserExpressionElement::parseImpl(Pos & pos, ASTPtr & node, Expected & exp
     if (lit_p.parse(pos, node, expected))
         return true;
 
+    if (param_p.parse(pos, node, expected))
+        return true;
+
     if (fun_p.parse(pos, node, expected))
         return true;
 
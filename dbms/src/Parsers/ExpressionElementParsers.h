@@ -153,6 +153,16 @@ protected:
 };
 
 
+/** Positional parameter of a prepared statement: ?1, ?2, ...
+  */
+class ParserQueryParameter : public IParserBase
+{
+protected:
+    const char * getName() const { return "query parameter"; }
+    bool parseImpl(Pos & pos, ASTPtr & node, Expected & expected);
+};
+
+
 /** The literal is one of: NULL, UInt64, Int64, Float64, String.
   */
 class ParserLiteral : public IParserBase
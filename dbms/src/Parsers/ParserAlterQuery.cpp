@@ -29,6 +29,7 @@ bool ParserAlterQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
     ParserKeyword s_freeze_partition("FREEZE PARTITION");
     ParserKeyword s_reshard("RESHARD");
     ParserKeyword s_partition("PARTITION");
+    ParserKeyword s_delete_where("DELETE WHERE");
 
     ParserKeyword s_after("AFTER");
     ParserKeyword s_from("FROM");
@@ -213,6 +214,15 @@ bool ParserAlterQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
 
             params.type = ASTAlterQuery::MODIFY_PRIMARY_KEY;
         }
+        else if (s_delete_where.ignore(pos, expected))
+        {
+            ParserExpression parser_predicate;
+
+            if (!parser_predicate.parse(pos, params.predicate, expected))
+                return false;
+
+            params.type = ASTAlterQuery::DELETE_WHERE;
+        }
         else if (s_reshard.ignore(pos, expected))
         {
             ParserList weighted_zookeeper_paths_p(std::make_unique<ParserWeightedZooKeeperPath>(), std::make_unique<ParserToken>(TokenType::Comma), false);
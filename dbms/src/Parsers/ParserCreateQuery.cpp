@@ -5,6 +5,7 @@
 #include <Parsers/ExpressionListParsers.h>
 #include <Parsers/ParserCreateQuery.h>
 #include <Parsers/ParserSelectQuery.h>
+#include <Parsers/ParserSetQuery.h>
 
 
 namespace DB
@@ -140,17 +141,24 @@ bool ParserCreateQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
     ParserKeyword s_view("VIEW");
     ParserKeyword s_materialized("MATERIALIZED");
     ParserKeyword s_populate("POPULATE");
+    ParserKeyword s_ttl("TTL");
+    ParserKeyword s_projection("PROJECTION");
+    ParserKeyword s_settings("SETTINGS");
     ParserToken s_dot(TokenType::Dot);
     ParserToken s_lparen(TokenType::OpeningRoundBracket);
     ParserToken s_rparen(TokenType::ClosingRoundBracket);
     ParserEngine engine_p;
     ParserIdentifier name_p;
     ParserColumnDeclarationList columns_p;
+    ParserExpressionWithOptionalAlias ttl_p(false);
 
     ASTPtr database;
     ASTPtr table;
     ASTPtr columns;
     ASTPtr storage;
+    ASTPtr ttl_expression;
+    ASTPtr projection_query;
+    ASTPtr table_settings;
     ASTPtr inner_storage;
     ASTPtr as_database;
     ASTPtr as_table;
@@ -225,6 +233,29 @@ bool ParserCreateQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
             if (!engine_p.parse(pos, storage, expected))
                 return false;
 
+            /// Optional expiration time of rows, checked during merges.
+            if (s_ttl.ignore(pos, expected))
+            {
+                if (!ttl_p.parse(pos, ttl_expression, expected))
+                    return false;
+            }
+
+            /// Optional aggregating SELECT maintained per part.
+            if (s_projection.ignore(pos, expected))
+            {
+                ParserSelectQuery projection_p;
+                if (!projection_p.parse(pos, projection_query, expected))
+                    return false;
+            }
+
+            /// Optional per-table overrides of MergeTree settings.
+            if (s_settings.ignore(pos, expected))
+            {
+                ParserSetQuery settings_p(true);
+                if (!settings_p.parse(pos, table_settings, expected))
+                    return false;
+            }
+
             /// For engine VIEW, you also need to read AS SELECT
             if (storage && (typeid_cast<ASTFunction &>(*storage).name == "View"
                         || typeid_cast<ASTFunction &>(*storage).name == "MaterializedView"))
@@ -243,6 +274,19 @@ bool ParserCreateQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
         {
             engine_p.parse(pos, storage, expected);
 
+            if (s_ttl.ignore(pos, expected))
+            {
+                if (!ttl_p.parse(pos, ttl_expression, expected))
+                    return false;
+            }
+
+            if (s_settings.ignore(pos, expected))
+            {
+                ParserSetQuery settings_p(true);
+                if (!settings_p.parse(pos, table_settings, expected))
+                    return false;
+            }
+
             if (!s_as.ignore(pos, expected))
                 return false;
 
@@ -349,6 +393,9 @@ bool ParserCreateQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
 
     query->columns = columns;
     query->storage = storage;
+    query->ttl_expression = ttl_expression;
+    query->projection_query = projection_query;
+    query->table_settings = table_settings;
     if (as_database)
         query->as_database = typeid_cast<ASTIdentifier &>(*as_database).name;
     if (as_table)
@@ -359,6 +406,12 @@ bool ParserCreateQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
         query->children.push_back(columns);
     if (storage)
         query->children.push_back(storage);
+    if (ttl_expression)
+        query->children.push_back(ttl_expression);
+    if (projection_query)
+        query->children.push_back(projection_query);
+    if (table_settings)
+        query->children.push_back(table_settings);
     if (select)
         query->children.push_back(select);
     if (inner_storage)
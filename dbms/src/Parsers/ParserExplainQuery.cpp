@@ -0,0 +1,32 @@
+#include <Parsers/ParserExplainQuery.h>
+#include <Parsers/ParserSelectQuery.h>
+#include <Parsers/ASTExplainQuery.h>
+#include <Parsers/CommonParsers.h>
+
+
+namespace DB
+{
+
+bool ParserExplainQuery::parseImpl(Pos & pos, ASTPtr & node, Expected & expected)
+{
+    Pos begin = pos;
+
+    ParserKeyword s_explain("EXPLAIN");
+
+    if (!s_explain.ignore(pos, expected))
+        return false;
+
+    ParserSelectQuery select_p;
+    ASTPtr select;
+    if (!select_p.parse(pos, select, expected))
+        return false;
+
+    auto query = std::make_shared<ASTExplainQuery>(StringRange(begin, pos));
+    query->query = select;
+    query->children.push_back(select);
+
+    node = query;
+    return true;
+}
+
+}
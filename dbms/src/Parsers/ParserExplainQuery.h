@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Parsers/IParserBase.h>
+
+
+namespace DB
+{
+
+/** Query like this:
+  * EXPLAIN SELECT ...
+  */
+class ParserExplainQuery : public IParserBase
+{
+protected:
+    const char * getName() const override { return "EXPLAIN query"; }
+    bool parseImpl(Pos & pos, ASTPtr & node, Expected & expected) override;
+};
+
+}
@@ -1,6 +1,7 @@
 #include <Parsers/ParserQueryWithOutput.h>
 #include <Parsers/ParserShowTablesQuery.h>
 #include <Parsers/ParserSelectQuery.h>
+#include <Parsers/ParserExplainQuery.h>
 #include <Parsers/ParserTablePropertiesQuery.h>
 #include <Parsers/ParserShowProcesslistQuery.h>
 #include <Parsers/ParserCheckQuery.h>
@@ -18,6 +19,7 @@ bool ParserQueryWithOutput::parseImpl(Pos & pos, ASTPtr & node, Expected & expec
 {
     ParserShowTablesQuery show_tables_p;
     ParserSelectQuery select_p;
+    ParserExplainQuery explain_p;
     ParserTablePropertiesQuery table_p;
     ParserShowProcesslistQuery show_processlist_p;
     ParserCreateQuery create_p;
@@ -30,6 +32,7 @@ bool ParserQueryWithOutput::parseImpl(Pos & pos, ASTPtr & node, Expected & expec
     ASTPtr query;
 
     bool parsed = select_p.parse(pos, query, expected)
+        || explain_p.parse(pos, query, expected)
         || show_tables_p.parse(pos, query, expected)
         || table_p.parse(pos, query, expected)
         || show_processlist_p.parse(pos, query, expected)
@@ -0,0 +1,77 @@
+#include <Common/typeid_cast.h>
+#include <IO/WriteHelpers.h>
+#include <Parsers/ASTLiteral.h>
+#include <Parsers/ASTQueryParameter.h>
+#include <Parsers/ASTSelectQuery.h>
+#include <Parsers/substituteQueryParameters.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int BAD_ARGUMENTS;
+}
+
+
+static void substituteImpl(ASTPtr & ast, const std::vector<Field> & values)
+{
+    if (const ASTQueryParameter * parameter = typeid_cast<const ASTQueryParameter *>(ast.get()))
+    {
+        if (parameter->index < 1 || parameter->index > values.size())
+            throw Exception("Prepared statement refers to parameter ?" + toString(parameter->index)
+                + ", but " + toString(values.size()) + " parameter(s) were passed", ErrorCodes::BAD_ARGUMENTS);
+
+        auto literal = std::make_shared<ASTLiteral>(ast->range, values[parameter->index - 1]);
+        literal->alias = parameter->alias;
+        ast = literal;
+        return;
+    }
+
+    ASTSelectQuery * select = typeid_cast<ASTSelectQuery *>(ast.get());
+
+    for (auto & child : ast->children)
+    {
+        const IAST * old_child = child.get();
+        substituteImpl(child, values);
+
+        /** ASTSelectQuery duplicates its parts both as named members and in `children`;
+          *  a parameter that constitutes a whole part (e.g. LIMIT ?1) must be replaced in both places.
+          */
+        if (select && child.get() != old_child)
+        {
+            auto relink = [&](ASTPtr & part)
+            {
+                if (part.get() == old_child)
+                    part = child;
+            };
+
+            relink(select->with_expression_list);
+            relink(select->select_expression_list);
+            relink(select->tables);
+            relink(select->prewhere_expression);
+            relink(select->where_expression);
+            relink(select->group_expression_list);
+            relink(select->having_expression);
+            relink(select->order_expression_list);
+            relink(select->limit_by_value);
+            relink(select->limit_by_expression_list);
+            relink(select->limit_offset);
+            relink(select->limit_length);
+            relink(select->settings);
+        }
+    }
+
+    /// UNION ALL tail of a SELECT is a named member and may not be among the children.
+    if (select && select->next_union_all)
+        substituteImpl(select->next_union_all, values);
+}
+
+
+void substituteQueryParameters(ASTPtr & ast, const std::vector<Field> & values)
+{
+    substituteImpl(ast, values);
+}
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <vector>
+
+#include <Core/Field.h>
+#include <Parsers/IAST.h>
+
+
+namespace DB
+{
+
+/** Replaces the ?N placeholders (ASTQueryParameter) of a prepared statement
+  *  with literals holding the given values; ?1 refers to values[0] and so on.
+  * Throws if the query references a parameter beyond the end of `values`.
+  */
+void substituteQueryParameters(ASTPtr & ast, const std::vector<Field> & values);
+
+}
@@ -16,6 +16,7 @@
 #include <Common/Stopwatch.h>
 #include <common/ThreadPool.h>
 #include <AggregateFunctions/ReservoirSampler.h>
+#include <AggregateFunctions/AggregateFunctionQuantileTiming.h>
 #include <AggregateFunctions/registerAggregateFunctions.h>
 
 #include <boost/program_options.hpp>
@@ -38,6 +39,7 @@
 #include <Interpreters/Context.h>
 
 #include <Client/Connection.h>
+#include <Client/ConnectionPool.h>
 
 #include "InterruptListener.h"
 
@@ -61,15 +63,20 @@ class Benchmark
 {
 public:
     Benchmark(unsigned concurrency_, double delay_,
-            const String & host_, UInt16 port_, const String & default_database_,
+            const String & host_, UInt16 port_,
+            const String & second_host_, UInt16 second_port_,
+            const String & default_database_,
             const String & user_, const String & password_, const String & stage,
             bool randomize_, size_t max_iterations_, double max_time_,
+            unsigned ramp_max_concurrency_,
             const String & json_path_, const Settings & settings_)
         :
-        concurrency(concurrency_), delay(delay_), queue(concurrency),
-        connections(concurrency, host_, port_, default_database_, user_, password_),
+        concurrency(concurrency_), delay(delay_),
+        ramp_max_concurrency(ramp_max_concurrency_),
+        queue(std::max(concurrency_, ramp_max_concurrency_)),
         randomize(randomize_), max_iterations(max_iterations_), max_time(max_time_),
-        json_path(json_path_), settings(settings_), global_context(Context::createGlobal()), pool(concurrency)
+        json_path(json_path_), settings(settings_), global_context(Context::createGlobal()),
+        pool(std::max(concurrency_, ramp_max_concurrency_))
     {
         std::cerr << std::fixed << std::setprecision(3);
 
@@ -77,6 +84,21 @@ public:
         /// (example: when using stage = 'with_mergeable_state')
         registerAggregateFunctions();
 
+        size_t max_concurrency = std::max(concurrency, ramp_max_concurrency);
+
+        connections.emplace_back(std::make_unique<ConnectionPool>(
+            max_concurrency, host_, port_, default_database_, user_, password_));
+        server_descriptions.emplace_back(host_ + ":" + toString(port_));
+
+        if (!second_host_.empty())
+        {
+            connections.emplace_back(std::make_unique<ConnectionPool>(
+                max_concurrency, second_host_, second_port_, default_database_, user_, password_));
+            server_descriptions.emplace_back(second_host_ + ":" + toString(second_port_));
+        }
+
+        num_servers = connections.size();
+
         if (stage == "complete")
             query_processing_stage = QueryProcessingStage::Complete;
         else if (stage == "fetch_columns")
@@ -98,16 +120,25 @@ public:
 private:
     using Query = std::string;
 
+    /// One server in the ordinary mode, two in the comparison mode.
+    static constexpr size_t MAX_SERVERS = 2;
+
     unsigned concurrency;
     double delay;
 
+    /// If non-zero, concurrency is stepped 1, 2, 4, ... up to this value, one load stage per step.
+    unsigned ramp_max_concurrency;
+
     using Queries = std::vector<Query>;
     Queries queries;
 
     using Queue = ConcurrentBoundedQueue<Query>;
     Queue queue;
 
-    ConnectionPool connections;
+    std::vector<std::unique_ptr<ConnectionPool>> connections;
+    Strings server_descriptions;
+    size_t num_servers = 1;
+
     bool randomize;
     size_t max_iterations;
     double max_time;
@@ -119,6 +150,9 @@ private:
     /// Don't execute new queries after timelimit or SIGINT or exception
     std::atomic<bool> shutdown{false};
 
+    /// SIGINT was received; in ramp mode, do not proceed to the next stage.
+    std::atomic<bool> interrupted{false};
+
     struct Stats
     {
         Stopwatch watch;
@@ -128,9 +162,16 @@ private:
         size_t result_rows = 0;
         size_t result_bytes = 0;
 
+        /// For the t-test in the comparison mode.
+        double seconds_sum = 0;
+        double seconds_sum_sq = 0;
+
         using Sampler = ReservoirSampler<double>;
         Sampler sampler {1 << 16};
 
+        /// Histogram with exact sub-second buckets - same structure as the quantileTiming aggregate function.
+        std::unique_ptr<QuantileTiming> timing = std::make_unique<QuantileTiming>();
+
         void add(double seconds, size_t read_rows_inc, size_t read_bytes_inc, size_t result_rows_inc, size_t result_bytes_inc)
         {
             ++queries;
@@ -138,7 +179,10 @@ private:
             read_bytes += read_bytes_inc;
             result_rows += result_rows_inc;
             result_bytes += result_bytes_inc;
+            seconds_sum += seconds;
+            seconds_sum_sq += seconds * seconds;
             sampler.insert(seconds);
+            timing->insert(seconds * 1000);
         }
 
         void clear()
@@ -149,12 +193,24 @@ private:
             read_bytes = 0;
             result_rows = 0;
             result_bytes = 0;
+            seconds_sum = 0;
+            seconds_sum_sq = 0;
             sampler.clear();
+            timing = std::make_unique<QuantileTiming>();    /// QuantileTiming has no clear method.
         }
     };
 
-    Stats info_per_interval;
-    Stats info_total;
+    /// Count, sum and sum of squares of query times - all that the t-test needs.
+    /// Taken from Stats before the final report clears it.
+    struct LatencySummary
+    {
+        size_t count = 0;
+        double sum = 0;
+        double sum_sq = 0;
+    };
+
+    Stats infos_per_interval[MAX_SERVERS];
+    Stats infos_total[MAX_SERVERS];
     Stopwatch delay_watch;
 
     std::mutex mutex;
@@ -192,7 +248,8 @@ private:
     }
 
     /// Try push new query and check cancellation conditions
-    bool tryPushQueryInteractively(const String & query, InterruptListener & interrupt_listener)
+    bool tryPushQueryInteractively(const String & query,
+        Stopwatch & stage_watch, double time_limit, InterruptListener & interrupt_listener)
     {
         bool inserted = false;
 
@@ -206,7 +263,7 @@ private:
                 return false;
             }
 
-            if (max_time > 0 && info_total.watch.elapsedSeconds() >= max_time)
+            if (time_limit > 0 && stage_watch.elapsedSeconds() >= time_limit)
             {
                 std::cout << "Stopping launch of queries. Requested time limit is exhausted.\n";
                 return false;
@@ -215,13 +272,16 @@ private:
             if (interrupt_listener.check())
             {
                 std::cout << "Stopping launch of queries. SIGINT recieved.\n";
+                interrupted = true;
                 return false;
             }
 
-            if (delay > 0 && delay_watch.elapsedSeconds() > delay)
+            /// In ramp mode, per-interval stats serve as per-stage stats, so don't clear them here.
+            if (!ramp_max_concurrency && delay > 0 && delay_watch.elapsedSeconds() > delay)
             {
-                printNumberOfQueriesExecuted(info_total.queries);
-                report(info_per_interval);
+                printNumberOfQueriesExecuted(infos_total[0].queries);
+                for (size_t i = 0; i < num_servers; ++i)
+                    report(infos_per_interval[i], i);
                 delay_watch.restart();
             }
         };
@@ -234,35 +294,119 @@ private:
         pcg64 generator(randomSeed());
         std::uniform_int_distribution<size_t> distribution(0, queries.size() - 1);
 
-        for (size_t i = 0; i < concurrency; ++i)
-            pool.schedule(std::bind(&Benchmark::thread, this, connections.get()));
-
         InterruptListener interrupt_listener;
-        info_per_interval.watch.restart();
-        delay_watch.restart();
+
+        for (size_t i = 0; i < num_servers; ++i)
+            infos_total[i].watch.restart();
+
+        if (ramp_max_concurrency)
+        {
+            /// Each stage runs for `timelimit` seconds (10 if not specified) or `iterations` queries.
+            double stage_time = max_time > 0 ? max_time : 10;
+
+            double prev_qps = 0;
+            unsigned prev_concurrency = 0;
+            bool knee_reported = false;
+
+            for (unsigned stage_concurrency = 1;; stage_concurrency *= 2)
+            {
+                if (stage_concurrency > ramp_max_concurrency)
+                    stage_concurrency = ramp_max_concurrency;
+
+                for (size_t i = 0; i < num_servers; ++i)
+                    infos_per_interval[i].clear();
+
+                runStage(stage_concurrency, stage_time, generator, distribution, interrupt_listener);
+
+                const Stats & info = infos_per_interval[0];
+                double seconds = info.watch.elapsedSeconds();
+                double qps = seconds > 0 ? info.queries / seconds : 0;
+
+                std::cerr
+                    << "\n"
+                    << "Concurrency " << stage_concurrency << ": "
+                    << "QPS: " << qps << ", "
+                    << "median: " << info.timing->getFloat(0.5) << " ms, "
+                    << "99%: " << info.timing->getFloat(0.99) << " ms."
+                    << "\n";
+
+                /// The knee: throughput stopped growing although we keep adding concurrent queries,
+                ///  so extra concurrency only buys latency.
+                if (!knee_reported && prev_qps > 0 && qps < prev_qps * 1.05)
+                {
+                    std::cerr << "Throughput knee at concurrency " << prev_concurrency
+                        << " (" << prev_qps << " QPS): doubling concurrency gave less than 5% more throughput.\n";
+                    knee_reported = true;
+                }
+
+                prev_qps = qps;
+                prev_concurrency = stage_concurrency;
+
+                if (shutdown || interrupted || stage_concurrency == ramp_max_concurrency)
+                    break;
+            }
+        }
+        else
+        {
+            infos_per_interval[0].watch.restart();
+            delay_watch.restart();
+            runStage(concurrency, max_time, generator, distribution, interrupt_listener);
+        }
+
+        for (size_t i = 0; i < num_servers; ++i)
+            infos_total[i].watch.stop();
+
+        if (!json_path.empty())
+            reportJSON(infos_total[0], json_path);
+
+        LatencySummary summaries[MAX_SERVERS];
+        for (size_t i = 0; i < num_servers; ++i)
+            summaries[i] = {infos_total[i].queries, infos_total[i].seconds_sum, infos_total[i].seconds_sum_sq};
+
+        printNumberOfQueriesExecuted(infos_total[0].queries);
+        for (size_t i = 0; i < num_servers; ++i)
+            report(infos_total[i], i);
+
+        if (num_servers > 1)
+            reportComparison(summaries[0], summaries[1]);
+    }
+
+    /// Run one load stage: `stage_concurrency` worker threads, until the time limit,
+    ///  the iterations limit, SIGINT or an exception.
+    void runStage(unsigned stage_concurrency, double time_limit,
+        pcg64 & generator, std::uniform_int_distribution<size_t> & distribution,
+        InterruptListener & interrupt_listener)
+    {
+        for (size_t i = 0; i < stage_concurrency; ++i)
+        {
+            std::vector<ConnectionPool::Entry> entries;
+            for (size_t server = 0; server < num_servers; ++server)
+                entries.emplace_back(connections[server]->get());
+
+            pool.schedule(std::bind(&Benchmark::thread, this, entries));
+        }
+
+        Stopwatch stage_watch;
 
         /// Push queries into queue
         for (size_t i = 0; !max_iterations || i < max_iterations; ++i)
         {
             size_t query_index = randomize ? distribution(generator) : i % queries.size();
 
-            if (!tryPushQueryInteractively(queries[query_index], interrupt_listener))
+            if (!tryPushQueryInteractively(queries[query_index], stage_watch, time_limit, interrupt_listener))
                 break;
         }
 
         shutdown = true;
         pool.wait();
-        info_total.watch.stop();
+        shutdown = false;
 
-        if (!json_path.empty())
-            reportJSON(info_total, json_path);
-
-        printNumberOfQueriesExecuted(info_total.queries);
-        report(info_total);
+        /// Queries that were queued but not picked up by a worker.
+        queue.clear();
     }
 
 
-    void thread(ConnectionPool::Entry connection)
+    void thread(std::vector<ConnectionPool::Entry> entries)
     {
         Query query;
 
@@ -287,7 +431,7 @@ private:
                         return;
                 }
 
-                execute(connection, query);
+                execute(entries, query);
             }
         }
         catch (...)
@@ -299,30 +443,34 @@ private:
     }
 
 
-    void execute(ConnectionPool::Entry & connection, Query & query)
+    void execute(std::vector<ConnectionPool::Entry> & entries, Query & query)
     {
-        Stopwatch watch;
-        RemoteBlockInputStream stream(*connection, query, global_context, &settings, nullptr, Tables(), query_processing_stage);
+        /// In the comparison mode the same query goes to every server, in the same order.
+        for (size_t server = 0; server < num_servers; ++server)
+        {
+            Stopwatch watch;
+            RemoteBlockInputStream stream(*entries[server], query, global_context, &settings, nullptr, Tables(), query_processing_stage);
 
-        Progress progress;
-        stream.setProgressCallback([&progress](const Progress & value) { progress.incrementPiecewiseAtomically(value); });
+            Progress progress;
+            stream.setProgressCallback([&progress](const Progress & value) { progress.incrementPiecewiseAtomically(value); });
 
-        stream.readPrefix();
-        while (Block block = stream.read())
-            ;
-        stream.readSuffix();
+            stream.readPrefix();
+            while (Block block = stream.read())
+                ;
+            stream.readSuffix();
 
-        const BlockStreamProfileInfo & info = stream.getProfileInfo();
+            const BlockStreamProfileInfo & info = stream.getProfileInfo();
 
-        double seconds = watch.elapsedSeconds();
+            double seconds = watch.elapsedSeconds();
 
-        std::lock_guard<std::mutex> lock(mutex);
-        info_per_interval.add(seconds, progress.rows, progress.bytes, info.rows, info.bytes);
-        info_total.add(seconds, progress.rows, progress.bytes, info.rows, info.bytes);
+            std::lock_guard<std::mutex> lock(mutex);
+            infos_per_interval[server].add(seconds, progress.rows, progress.bytes, info.rows, info.bytes);
+            infos_total[server].add(seconds, progress.rows, progress.bytes, info.rows, info.bytes);
+        }
     }
 
 
-    void report(Stats & info)
+    void report(Stats & info, size_t server_num)
     {
         std::lock_guard<std::mutex> lock(mutex);
 
@@ -332,8 +480,11 @@ private:
 
         double seconds = info.watch.elapsedSeconds();
 
+        std::cerr << "\n";
+        if (num_servers > 1)
+            std::cerr << "Server " << server_descriptions[server_num] << ":\n";
+
         std::cerr
-            << "\n"
             << "QPS: " << (info.queries / seconds) << ", "
             << "RPS: " << (info.read_rows / seconds) << ", "
             << "MiB/s: " << (info.read_bytes / seconds / 1048576) << ", "
@@ -354,9 +505,41 @@ private:
         print_percentile(99.9);
         print_percentile(99.99);
 
+        std::cerr
+            << "histogram (exact, ms): "
+            << "50% = " << info.timing->getFloat(0.5) << ", "
+            << "90% = " << info.timing->getFloat(0.9) << ", "
+            << "99% = " << info.timing->getFloat(0.99) << ", "
+            << "99.9% = " << info.timing->getFloat(0.999) << ", "
+            << "max = " << info.timing->getFloat(1) << "."
+            << "\n";
+
         info.clear();
     }
 
+    /// Welch's t-test on query times of the two servers.
+    void reportComparison(const LatencySummary & a, const LatencySummary & b)
+    {
+        if (a.count < 2 || b.count < 2)
+            return;
+
+        double mean_a = a.sum / a.count;
+        double mean_b = b.sum / b.count;
+
+        double var_a = (a.sum_sq - a.sum * a.sum / a.count) / (a.count - 1);
+        double var_b = (b.sum_sq - b.sum * b.sum / b.count) / (b.count - 1);
+
+        double t = (mean_a - mean_b) / sqrt(var_a / a.count + var_b / b.count);
+
+        std::cerr
+            << "\n"
+            << "Comparison of mean query time:\n"
+            << server_descriptions[0] << ": " << mean_a << " sec.\n"
+            << server_descriptions[1] << ": " << mean_b << " sec. (" << (mean_b / mean_a * 100) << "% of first)\n"
+            << "t = " << t << ": the difference is " << (fabs(t) >= 1.96 ? "" : "not ")
+            << "significant at the 5% level.\n";
+    }
+
     void reportJSON(Stats & info, const std::string & filename)
     {
         WriteBufferFromFile json_out(filename);
@@ -431,9 +614,12 @@ int mainEntryClickHouseBenchmark(int argc, char ** argv)
             ("iterations,i",    value<size_t>()->default_value(0),                    "amount of queries to be executed")
             ("timelimit,t",        value<double>()->default_value(0.),                 "stop launch of queries after specified time limit")
             ("randomize,r",        value<bool>()->default_value(false),                "randomize order of execution")
+            ("ramp",            value<unsigned>()->default_value(0),                "step concurrency 1, 2, 4, ... up to specified value and report the throughput knee; each step runs for 'timelimit' seconds (10 if not set)")
             ("json",            value<std::string>()->default_value(""),            "write final report to specified file in JSON format")
             ("host,h",            value<std::string>()->default_value("localhost"),     "")
             ("port",             value<UInt16>()->default_value(9000),                 "")
+            ("host2",            value<std::string>()->default_value(""),             "second server for A/B comparison: every query is executed on both servers")
+            ("port2",             value<UInt16>()->default_value(9000),                 "")
             ("user",             value<std::string>()->default_value("default"),        "")
             ("password",        value<std::string>()->default_value(""),             "")
             ("database",        value<std::string>()->default_value("default"),     "")
@@ -474,6 +660,8 @@ int mainEntryClickHouseBenchmark(int argc, char ** argv)
             options["delay"].as<double>(),
             options["host"].as<std::string>(),
             options["port"].as<UInt16>(),
+            options["host2"].as<std::string>(),
+            options["port2"].as<UInt16>(),
             options["database"].as<std::string>(),
             options["user"].as<std::string>(),
             options["password"].as<std::string>(),
@@ -481,6 +669,7 @@ int mainEntryClickHouseBenchmark(int argc, char ** argv)
             options["randomize"].as<bool>(),
             options["iterations"].as<size_t>(),
             options["timelimit"].as<double>(),
+            options["ramp"].as<unsigned>(),
             options["json"].as<std::string>(),
             settings);
     }
@@ -45,7 +45,11 @@ void InterserverIOHTTPHandler::processQuery(Poco::Net::HTTPServerRequest & reque
 
     if (compress)
     {
-        CompressedWriteBuffer compressed_out(out);
+        CompressionMethod method = params.get("compress_method", "lz4") == "zstd"
+            ? CompressionMethod::ZSTD
+            : CompressionMethod::LZ4;
+
+        CompressedWriteBuffer compressed_out(out, method);
         endpoint->processQuery(params, body, compressed_out, response);
     }
     else
@@ -1,6 +1,8 @@
+#include <cmath>
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <regex>
 #include <thread>
 #include <unistd.h>
@@ -13,6 +15,7 @@
 
 #include <AggregateFunctions/ReservoirSampler.h>
 #include <Client/Connection.h>
+#include <Client/ConnectionPool.h>
 #include <Common/ConcurrentBoundedQueue.h>
 #include <Common/Stopwatch.h>
 #include <Common/getFQDNOrHostName.h>
@@ -1357,6 +1360,227 @@ public:
         return output;
     }
 };
+
+
+/** Replays a production workload recorded in system.query_log against a candidate server
+  *  and compares latency and the recorded counters (read_rows, read_bytes) per query.
+  *
+  * The input is a TSV dump of the query log, one query per line:
+  *
+  *     SELECT toUInt32(query_start_time), query_duration_ms, read_rows, read_bytes, query
+  *     FROM system.query_log WHERE type = 2 ORDER BY query_start_time FORMAT TabSeparated
+  *
+  * Queries are issued at their original inter-arrival times (optionally scaled),
+  *  so the original concurrency profile is preserved.
+  */
+class WorkloadReplay
+{
+public:
+    WorkloadReplay(const String & host_,
+        const UInt16 port_,
+        const String & default_database_,
+        const String & user_,
+        const String & password_,
+        const String & replay_file_,
+        const double speedup_,
+        const unsigned max_concurrency_)
+        : connections(max_concurrency_, host_, port_, default_database_, user_, password_)
+        , speedup(speedup_)
+        , pool(max_concurrency_)
+    {
+        readEntries(replay_file_);
+        run();
+        report();
+    }
+
+private:
+    /// One query from the query_log dump, with its recorded baseline and the replay result.
+    struct ReplayEntry
+    {
+        UInt32 start_time = 0;      /// original query_start_time
+        UInt64 duration_ms = 0;     /// original query_duration_ms
+        UInt64 read_rows = 0;
+        UInt64 read_bytes = 0;
+        String query;
+
+        bool executed = false;
+        double new_duration_ms = 0;
+        UInt64 new_read_rows = 0;
+        UInt64 new_read_bytes = 0;
+    };
+
+    ConnectionPool connections;
+    double speedup;
+    ThreadPool pool;
+
+    std::vector<ReplayEntry> entries;
+    Settings settings;
+    Context global_context = Context::createGlobal();
+
+    std::mutex mutex;
+    size_t errors = 0;
+
+    void readEntries(const String & replay_file)
+    {
+        ReadBufferFromFile in(replay_file);
+
+        while (!in.eof())
+        {
+            ReplayEntry entry;
+
+            readIntText(entry.start_time, in);
+            assertChar('\t', in);
+            readIntText(entry.duration_ms, in);
+            assertChar('\t', in);
+            readIntText(entry.read_rows, in);
+            assertChar('\t', in);
+            readIntText(entry.read_bytes, in);
+            assertChar('\t', in);
+            readEscapedString(entry.query, in);
+            assertChar('\n', in);
+
+            if (!entry.query.empty())
+                entries.push_back(std::move(entry));
+        }
+
+        if (entries.empty())
+            throw DB::Exception("No queries in replay file " + replay_file);
+
+        std::sort(entries.begin(), entries.end(),
+            [](const ReplayEntry & lhs, const ReplayEntry & rhs) { return lhs.start_time < rhs.start_time; });
+
+        std::cerr << "Loaded " << entries.size() << " queries spanning "
+            << (entries.back().start_time - entries.front().start_time) << " seconds.\n";
+    }
+
+    void run()
+    {
+        UInt32 base_time = entries.front().start_time;
+        Stopwatch watch;
+
+        for (auto & entry : entries)
+        {
+            /// Wait until the original offset of the query from the beginning of the workload.
+            UInt64 due_ns = static_cast<UInt64>((entry.start_time - base_time) * 1000000000ULL / speedup);
+
+            while (watch.elapsed() < due_ns)
+            {
+                UInt64 remaining_ns = due_ns - watch.elapsed();
+                std::this_thread::sleep_for(std::chrono::nanoseconds(std::min(remaining_ns, UInt64(100000000))));
+            }
+
+            pool.schedule([this, &entry] { execute(entry); });
+        }
+
+        pool.wait();
+    }
+
+    void execute(ReplayEntry & entry)
+    {
+        try
+        {
+            auto connection = connections.get();
+
+            Stopwatch watch;
+            RemoteBlockInputStream stream(*connection, entry.query, global_context, &settings);
+
+            Progress progress;
+            stream.setProgressCallback([&progress](const Progress & value) { progress.incrementPiecewiseAtomically(value); });
+
+            stream.readPrefix();
+            while (Block block = stream.read())
+                ;
+            stream.readSuffix();
+
+            entry.new_duration_ms = watch.elapsed() / 1000000.0;
+            entry.new_read_rows = progress.rows;
+            entry.new_read_bytes = progress.bytes;
+            entry.executed = true;
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++errors;
+            std::cerr << "Query failed during replay: " << entry.query << "\n"
+                << getCurrentExceptionMessage(false) << "\n";
+        }
+    }
+
+    void report() const
+    {
+        size_t executed = 0;
+        double baseline_sum_ms = 0;
+        double replay_sum_ms = 0;
+
+        /// Paired t-test on per-query latency differences.
+        double diff_sum = 0;
+        double diff_sum_sq = 0;
+
+        size_t rows_mismatches = 0;
+        std::vector<const ReplayEntry *> regressions;
+
+        for (const auto & entry : entries)
+        {
+            if (!entry.executed)
+                continue;
+
+            ++executed;
+            baseline_sum_ms += entry.duration_ms;
+            replay_sum_ms += entry.new_duration_ms;
+
+            double diff = entry.new_duration_ms - entry.duration_ms;
+            diff_sum += diff;
+            diff_sum_sq += diff * diff;
+
+            /// A changed read_rows/read_bytes at the same query usually means a different plan
+            ///  or a different amount of data skipped by indexes.
+            if (entry.new_read_rows != entry.read_rows || entry.new_read_bytes != entry.read_bytes)
+                ++rows_mismatches;
+
+            if (entry.new_duration_ms > entry.duration_ms * 1.5 + 50)
+                regressions.push_back(&entry);
+        }
+
+        std::cerr << "\nReplayed " << executed << " of " << entries.size() << " queries, " << errors << " failed.\n";
+
+        if (executed < 2)
+            return;
+
+        std::cerr << "Mean query time: baseline " << (baseline_sum_ms / executed) << " ms, "
+            << "replay " << (replay_sum_ms / executed) << " ms "
+            << "(" << (replay_sum_ms / baseline_sum_ms * 100) << "% of baseline).\n";
+
+        double mean_diff = diff_sum / executed;
+        double var_diff = (diff_sum_sq - diff_sum * diff_sum / executed) / (executed - 1);
+        double t = var_diff > 0 ? mean_diff / sqrt(var_diff / executed) : 0;
+
+        std::cerr << "Paired t-test on latency: t = " << t << ", the "
+            << (mean_diff > 0 ? "slowdown" : "speedup") << " is "
+            << (fabs(t) >= 1.96 ? "" : "not ") << "significant at the 5% level.\n";
+
+        std::cerr << rows_mismatches << " queries read a different amount of rows or bytes than recorded.\n";
+
+        if (!regressions.empty())
+        {
+            std::sort(regressions.begin(), regressions.end(),
+                [](const ReplayEntry * lhs, const ReplayEntry * rhs)
+                {
+                    return lhs->new_duration_ms - lhs->duration_ms > rhs->new_duration_ms - rhs->duration_ms;
+                });
+
+            std::cerr << "\n" << regressions.size() << " queries regressed (more than 1.5x and 50 ms slower). Worst:\n";
+
+            for (size_t i = 0; i < regressions.size() && i < 10; ++i)
+            {
+                const ReplayEntry & entry = *regressions[i];
+                String query = entry.query.substr(0, 120);
+
+                std::cerr << entry.duration_ms << " ms -> " << entry.new_duration_ms << " ms\t" << query << "\n";
+            }
+        }
+    }
+};
+
 }
 
 static void getFilesFromDir(const fs::path & dir, std::vector<String> & input_files, const bool recursive = false)
@@ -1392,7 +1616,11 @@ try
         "Run tests with specific name")("skip-names", value<Strings>()->multitoken(), "Do not run tests with name")(
         "names-regexp", value<Strings>()->multitoken(), "Run tests with names matching regexp")("skip-names-regexp",
         value<Strings>()->multitoken(),
-        "Do not run tests with names matching regexp")("recursive,r", "Recurse in directories to find all xml's");
+        "Do not run tests with names matching regexp")("recursive,r", "Recurse in directories to find all xml's")(
+        "replay", value<String>()->default_value(""),
+        "Replay a TSV dump of system.query_log (query_start_time, query_duration_ms, read_rows, read_bytes, query) instead of running xml tests")(
+        "replay-speedup", value<double>()->default_value(1), "Replay inter-arrival times scaled down by this factor")(
+        "replay-concurrency", value<unsigned>()->default_value(64), "Maximum number of simultaneously replayed queries");
 
     /// These options will not be displayed in --help
     boost::program_options::options_description hidden("Hidden options");
@@ -1417,6 +1645,20 @@ try
         return 0;
     }
 
+    if (!options["replay"].as<String>().empty())
+    {
+        DB::WorkloadReplay replay(options["host"].as<String>(),
+            options["port"].as<UInt16>(),
+            options["database"].as<String>(),
+            options["user"].as<String>(),
+            options["password"].as<String>(),
+            options["replay"].as<String>(),
+            options["replay-speedup"].as<double>(),
+            options["replay-concurrency"].as<unsigned>());
+
+        return 0;
+    }
+
     Strings input_files;
     bool recursive = options.count("recursive");
 
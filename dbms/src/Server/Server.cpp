@@ -13,6 +13,8 @@
 #include <common/ErrorHandlers.h>
 #include <common/getMemoryAmount.h>
 
+#include <Common/Allocator.h>
+#include <Common/ArenaChunkPool.h>
 #include <Common/ClickHouseRevision.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/Macros.h>
@@ -25,12 +27,16 @@
 #include <Common/getNumberOfPhysicalCPUCores.h>
 
 #include <IO/HTTPCommon.h>
+#include <IO/HTTPSessionPool.h>
 
 #include <Interpreters/AsynchronousMetrics.h>
+#include <Interpreters/MetricsHistory.h>
+#include <Storages/MergeTree/MergeScheduler.h>
 #include <Interpreters/DDLWorker.h>
 #include <Interpreters/ProcessList.h>
 #include <Interpreters/loadMetadata.h>
 
+#include <Storages/MarkCacheWarmer.h>
 #include <Storages/MergeTree/ReshardingWorker.h>
 #include <Storages/StorageReplicatedMergeTree.h>
 #include <Storages/System/attachSystemTables.h>
@@ -248,6 +254,12 @@ int Server::main(const std::vector<std::string> & args)
     if (config().has("max_table_size_to_drop"))
         global_context->setMaxTableSizeToDrop(config().getUInt64("max_table_size_to_drop"));
 
+    /// Whether to ask the kernel to back large allocations with transparent huge pages.
+    setAllocatorHugePagesEnabled(config().getBool("use_transparent_huge_pages", true));
+
+    /// Amount of memory to keep pooled for reuse between arenas of different queries. Zero means disabled.
+    ArenaChunkPool::instance().setMaxSize(config().getUInt64("arena_chunk_pool_size", 1024 * 1024 * 1024));
+
     /// Size of cache for uncompressed blocks. Zero means disabled.
     size_t uncompressed_cache_size = config().getUInt64("uncompressed_cache_size", 0);
     if (uncompressed_cache_size)
@@ -258,6 +270,29 @@ int Server::main(const std::vector<std::string> & args)
     if (mark_cache_size)
         global_context->setMarkCache(mark_cache_size);
 
+    /// Size of cache for results of SELECT queries. Zero means disabled.
+    /// Even if the cache exists, queries use it only with the use_query_result_cache setting.
+    size_t query_result_cache_size = config().getUInt64("query_result_cache_size", 0);
+    if (query_result_cache_size)
+        global_context->setQueryResultCache(query_result_cache_size);
+
+    /// Size of cache for sets built from IN (subquery). Zero means disabled.
+    /// Even if the cache exists, queries use it only with the use_set_cache setting.
+    size_t set_cache_size = config().getUInt64("set_cache_size", 0);
+    if (set_cache_size)
+        global_context->setSetCache(set_cache_size);
+
+    /// Keep-alive sessions for interserver HTTP communication (replication fetches, HTTP dictionaries).
+    HTTPSessionPool::instance().setLimits(
+        config().getUInt64("http_session_pool.max_sessions_per_endpoint", 16),
+        config().getUInt64("http_session_pool.idle_timeout_seconds", config().getUInt("keep_alive_timeout", 10)));
+
+    /// I/O budget for background merges while queries are running. Zero limits mean no restriction.
+    global_context->getMergeScheduler().setBudget(
+        config().getUInt64("merge_scheduler.busy_read_bandwidth", 0),
+        config().getUInt64("merge_scheduler.busy_max_concurrency", 0),
+        config().getUInt64("merge_scheduler.idle_linger_milliseconds", 5000));
+
     /// Load global settings from default profile.
     Settings & settings = global_context->getSettingsRef();
     String default_profile_name = config().getString("default_profile", "default");
@@ -274,6 +309,22 @@ int Server::main(const std::vector<std::string> & args)
 
     global_context->setCurrentDatabase(default_database);
 
+    /// Restore the mark cache contents from the previous run (and prefetch the corresponding
+    ///  data files into the page cache), then periodically dump the list of cached files back.
+    std::unique_ptr<MarkCacheWarmer> mark_cache_warmer;
+    if (mark_cache_size && config().has("mark_cache_persist_path"))
+    {
+        mark_cache_warmer = std::make_unique<MarkCacheWarmer>(
+            global_context->getMarkCache(),
+            config().getString("mark_cache_persist_path"),
+            config().getUInt64("mark_cache_persist_period", 600));
+        mark_cache_warmer->warm();
+    }
+
+    /// Creating the compiler opens (in the background) the compiled libraries left from the
+    ///  previous run, so that the first queries using them don't pay for dlopen.
+    global_context->getCompiler();
+
     SCOPE_EXIT({
         /** Ask to cancel background jobs all table engines,
           *  and also query_log.
@@ -549,7 +600,13 @@ int Server::main(const std::vector<std::string> & args)
 
         /// This object will periodically calculate some metrics.
         AsynchronousMetrics async_metrics(*global_context);
-        attachSystemTablesAsync(*global_context->getDatabase("system"), async_metrics);
+
+        /// Ring buffer with the recent history of all metrics, for post-hoc analysis of incidents.
+        MetricsHistory metrics_history(async_metrics,
+            config().getUInt("metric_history.size", 1800),
+            config().getUInt("metric_history.collect_interval_milliseconds", 1000));
+
+        attachSystemTablesAsync(*global_context->getDatabase("system"), async_metrics, metrics_history);
 
         std::vector<std::unique_ptr<MetricsTransmitter>> metrics_transmitters;
         for (const auto & graphite_key : DB::getMultipleKeysFromConfig(config(), "", "graphite"))
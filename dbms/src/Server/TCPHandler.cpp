@@ -1,8 +1,10 @@
 #include <iomanip>
+#include <thread>
 
 #include <Poco/Net/NetException.h>
 
 #include <Common/ClickHouseRevision.h>
+#include <Common/ConcurrentBoundedQueue.h>
 
 #include <Common/Stopwatch.h>
 
@@ -21,11 +23,18 @@
 #include <Interpreters/executeQuery.h>
 #include <Interpreters/Quota.h>
 #include <Interpreters/TablesStatus.h>
+#include <Parsers/ASTLiteral.h>
+#include <Parsers/ExpressionElementParsers.h>
+#include <Parsers/ParserQuery.h>
+#include <Parsers/formatAST.h>
+#include <Parsers/parseQuery.h>
+#include <Parsers/substituteQueryParameters.h>
 
 #include <Storages/StorageMemory.h>
 #include <Storages/StorageReplicatedMergeTree.h>
 
 #include <Common/ExternalTable.h>
+#include <Common/typeid_cast.h>
 
 #include "TCPHandler.h"
 
@@ -44,6 +53,8 @@ namespace ErrorCodes
     extern const int STD_EXCEPTION;
     extern const int SOCKET_TIMEOUT;
     extern const int UNEXPECTED_PACKET_FROM_CLIENT;
+    extern const int QUERY_IS_TOO_LARGE;
+    extern const int BAD_ARGUMENTS;
 }
 
 
@@ -152,7 +163,10 @@ void TCPHandler::runImpl()
             state.maybe_compressed_in.reset();  /// For more accurate accounting by MemoryTracker.
 
             /// Processing Query
-            state.io = executeQuery(state.query, query_context, false, state.stage);
+            if (state.parsed_query)
+                state.io = executeQuery(state.parsed_query, state.query, query_context, false, state.stage);
+            else
+                state.io = executeQuery(state.query, query_context, false, state.stage);
 
             if (state.io.out)
                 state.need_receive_data_for_insert = true;
@@ -307,35 +321,102 @@ void TCPHandler::processOrdinaryQuery()
         AsynchronousBlockInputStream async_in(state.io.in);
         async_in.readPrefix();
 
-        while (true)
+        /** Result blocks are compressed and written to the socket in a separate thread,
+          *  so that query execution and network transfer overlap instead of running in series.
+          * The queue is small: it only needs to absorb short stalls of one of the two sides.
+          */
+        ConcurrentBoundedQueue<Block> blocks_to_send(3);
+        std::mutex sender_exception_mutex;
+        std::exception_ptr sender_exception;
+
+        auto senderFailed = [&]
         {
-            Block block;
+            std::lock_guard<std::mutex> lock(sender_exception_mutex);
+            return sender_exception != nullptr;
+        };
 
-            while (true)
+        std::thread sender([&]
+        {
+            try
             {
-                if (isQueryCancelled())
+                while (true)
                 {
-                    /// A packet was received requesting to stop execution of the request.
-                    async_in.cancel();
-                    break;
+                    Block block;
+                    blocks_to_send.pop(block);
+                    if (!block)
+                        break;
+                    sendData(block);
                 }
-                else
+            }
+            catch (...)
+            {
                 {
-                    if (state.progress.rows && after_send_progress.elapsed() / 1000 >= query_context.getSettingsRef().interactive_delay)
-                    {
-                        /// Some time passed and there is a progress.
-                        after_send_progress.restart();
-                        sendProgress();
-                    }
+                    std::lock_guard<std::mutex> lock(sender_exception_mutex);
+                    sender_exception = std::current_exception();
+                }
+
+                /// Keep consuming until the terminating empty block,
+                ///  so that the pulling thread does not get stuck on a full queue.
+                Block block;
+                do
+                    blocks_to_send.pop(block);
+                while (block);
+            }
+        });
+
+        try
+        {
+            while (true)
+            {
+                Block block;
 
-                    if (async_in.poll(query_context.getSettingsRef().interactive_delay / 1000))
+                while (true)
+                {
+                    if (isQueryCancelled() || senderFailed())
                     {
-                        /// There is the following result block.
-                        block = async_in.read();
+                        /// A packet was received requesting to stop execution of the request.
+                        async_in.cancel();
                         break;
                     }
+                    else
+                    {
+                        if (state.progress.rows && after_send_progress.elapsed() / 1000 >= query_context.getSettingsRef().interactive_delay)
+                        {
+                            /// Some time passed and there is a progress.
+                            after_send_progress.restart();
+                            sendProgress();
+                        }
+
+                        if (async_in.poll(query_context.getSettingsRef().interactive_delay / 1000))
+                        {
+                            /// There is the following result block.
+                            block = async_in.read();
+                            break;
+                        }
+                    }
                 }
+
+                if (!block)
+                    break;
+
+                blocks_to_send.push(block);
             }
+        }
+        catch (...)
+        {
+            blocks_to_send.emplace();
+            sender.join();
+            throw;
+        }
+
+        blocks_to_send.emplace();
+        sender.join();
+
+        {
+            std::lock_guard<std::mutex> lock(sender_exception_mutex);
+            if (sender_exception)
+                std::rethrow_exception(sender_exception);
+        }
 
         /** If data has run out, we will send the profiling data and total values to
           * the last zero block to be able to use
@@ -344,19 +425,17 @@ void TCPHandler::processOrdinaryQuery()
           *  because we have not read all the data yet,
           *  and there could be ongoing calculations in other threads at the same time.
               */
-            if (!block && !isQueryCancelled())
-            {
-                sendTotals();
-                sendExtremes();
-                sendProfileInfo();
-                sendProgress();
-            }
-
-            sendData(block);
-            if (!block)
-                break;
+        if (!isQueryCancelled())
+        {
+            sendTotals();
+            sendExtremes();
+            sendProfileInfo();
+            sendProgress();
         }
 
+        Block terminating_block;
+        sendData(terminating_block);
+
         async_in.readSuffix();
     }
 
@@ -546,6 +625,18 @@ bool TCPHandler::receivePacket()
             out->next();
             return false;
 
+        case Protocol::Client::Prepare:
+            if (!state.empty())
+                throw NetException("Unexpected packet Prepare received from client", ErrorCodes::UNEXPECTED_PACKET_FROM_CLIENT);
+            receivePreparedStatement();
+            return false;
+
+        case Protocol::Client::ExecutePrepared:
+            if (!state.empty())
+                throw NetException("Unexpected packet ExecutePrepared received from client", ErrorCodes::UNEXPECTED_PACKET_FROM_CLIENT);
+            receiveExecutePrepared();
+            return true;
+
         default:
             throw Exception("Unknown packet from client", ErrorCodes::UNKNOWN_PACKET_FROM_CLIENT);
     }
@@ -553,6 +644,14 @@ bool TCPHandler::receivePacket()
 
 
 void TCPHandler::receiveQuery()
+{
+    receiveQueryHeader();
+
+    readStringBinary(state.query, *in);
+}
+
+
+void TCPHandler::receiveQueryHeader()
 {
     UInt64 stage = 0;
     UInt64 compression = 0;
@@ -598,8 +697,65 @@ void TCPHandler::receiveQuery()
 
     readVarUInt(compression, *in);
     state.compression = static_cast<Protocol::Compression>(compression);
+}
 
-    readStringBinary(state.query, *in);
+
+void TCPHandler::receivePreparedStatement()
+{
+    String statement_id;
+    String query;
+
+    readStringBinary(statement_id, *in);
+    readStringBinary(query, *in);
+
+    size_t max_query_size = connection_context.getSettingsRef().max_query_size;
+    if (max_query_size && query.size() > max_query_size)
+        throw Exception("Query is too large (" + toString(query.size()) + ")."
+            " max_query_size = " + toString(max_query_size), ErrorCodes::QUERY_IS_TOO_LARGE);
+
+    ParserQuery parser(query.data() + query.size());
+    ASTPtr ast = parseQuery(parser, query.data(), query.data() + query.size(), "prepared statement " + statement_id);
+
+    /// Register on the connection context: prepared statements outlive a single query.
+    connection_context.setPreparedStatement(statement_id, ast);
+
+    writeVarUInt(Protocol::Server::Prepared, *out);
+    out->next();
+}
+
+
+void TCPHandler::receiveExecutePrepared()
+{
+    receiveQueryHeader();
+
+    String statement_id;
+    readStringBinary(statement_id, *in);
+
+    UInt64 num_params = 0;
+    readVarUInt(num_params, *in);
+    if (num_params > 1000)
+        throw Exception("Too many parameters for prepared statement: " + toString(num_params), ErrorCodes::BAD_ARGUMENTS);
+
+    std::vector<Field> parameters;
+    parameters.reserve(num_params);
+
+    ParserLiteral parser;
+    for (size_t i = 0; i < num_params; ++i)
+    {
+        String text;
+        readStringBinary(text, *in);
+        ASTPtr literal = parseQuery(parser, text.data(), text.data() + text.size(), "parameter ?" + toString(i + 1));
+        parameters.emplace_back(typeid_cast<const ASTLiteral &>(*literal).value);
+    }
+
+    ASTPtr ast = query_context.getPreparedStatement(statement_id)->clone();
+    substituteQueryParameters(ast, parameters);
+    state.parsed_query = ast;
+
+    /// The text of the substituted query goes to the query log and the process list.
+    std::ostringstream query_text;
+    formatAST(*ast, query_text, 0, false, true);
+    state.query = query_text.str();
 }
 
 
@@ -663,7 +819,9 @@ void TCPHandler::initBlockOutput()
     {
         if (state.compression == Protocol::Compression::Enable)
             state.maybe_compressed_out = std::make_shared<CompressedWriteBuffer>(
-                *out, query_context.getSettingsRef().network_compression_method);
+                *out, query_context.getSettingsRef().network_compression_method,
+                DBMS_DEFAULT_BUFFER_SIZE, 1, false,
+                query_context.getSettingsRef().network_zstd_compression_level);
         else
             state.maybe_compressed_out = out;
 
@@ -710,6 +868,8 @@ bool TCPHandler::isQueryCancelled()
 
 void TCPHandler::sendData(Block & block)
 {
+    std::lock_guard<std::mutex> lock(send_mutex);
+
     initBlockOutput();
 
     writeVarUInt(Protocol::Server::Data, *out);
@@ -745,6 +905,8 @@ void TCPHandler::updateProgress(const Progress & value)
 
 void TCPHandler::sendProgress()
 {
+    std::lock_guard<std::mutex> lock(send_mutex);
+
     writeVarUInt(Protocol::Server::Progress, *out);
     Progress increment = state.progress.fetchAndResetPiecewiseAtomically();
     increment.write(*out, client_revision);
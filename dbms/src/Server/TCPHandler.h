@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include <Poco/Net/TCPServerConnection.h>
 
 #include <Common/CurrentMetrics.h>
@@ -10,6 +12,7 @@
 #include <DataStreams/BlockIO.h>
 #include <IO/ReadHelpers.h>
 #include <IO/WriteHelpers.h>
+#include <Parsers/IAST.h>
 
 #include "IServer.h"
 
@@ -43,6 +46,8 @@ struct QueryState
 
     /// Query text.
     String query;
+    /// For a prepared statement: its AST with parameters already substituted. `query` then holds the formatted text.
+    ASTPtr parsed_query;
     /// Streams of blocks, that are processing the query.
     BlockIO io;
 
@@ -110,6 +115,10 @@ private:
     /// At the moment, only one ongoing query in the connection is supported at a time.
     QueryState state;
 
+    /// Serializes writes to the connection socket: during result streaming, data blocks
+    ///  are sent by a separate thread concurrently with progress packets.
+    std::mutex send_mutex;
+
     CurrentMetrics::Increment metric_increment{CurrentMetrics::TCPConnection};
 
 
@@ -118,6 +127,9 @@ private:
     void receiveHello();
     bool receivePacket();
     void receiveQuery();
+    void receiveQueryHeader();
+    void receivePreparedStatement();
+    void receiveExecutePrepared();
     bool receiveData();
     void readData(const Settings & global_settings);
 
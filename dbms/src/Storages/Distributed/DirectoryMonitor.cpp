@@ -285,7 +285,7 @@ struct StorageDistributedDirectoryMonitor::Batch
             || (parent.min_batched_block_size_bytes && total_bytes >= parent.min_batched_block_size_bytes);
     }
 
-    void send(bool save, const std::map<UInt64, String> & file_index_to_path)
+    void send(bool save, Connection & connection, const std::map<UInt64, String> & file_index_to_path)
     {
         if (file_indices.empty())
             return;
@@ -302,33 +302,46 @@ struct StorageDistributedDirectoryMonitor::Batch
             writeText(out);
         }
 
-        auto connection = parent.pool->get();
-
         String insert_query;
         std::unique_ptr<RemoteBlockOutputStream> remote;
         bool first = true;
 
         for (UInt64 file_idx : file_indices)
         {
-            ReadBufferFromFile in{file_index_to_path.at(file_idx)};
+            const auto file_path = file_index_to_path.find(file_idx);
+
+            /// The file of the batch could have been sent and removed on a previous attempt
+            ///  after the batch file was written. Skipping it keeps the retry idempotent.
+            if (file_path == file_index_to_path.end())
+            {
+                LOG_ERROR(parent.log, "Failed to send batch: file with index " << file_idx << " is absent");
+                continue;
+            }
+
+            ReadBufferFromFile in{file_path->second};
             readStringBinary(insert_query, in); /// NOTE: all files must have the same insert_query
 
             if (first)
             {
                 first = false;
-                remote = std::make_unique<RemoteBlockOutputStream>(*connection, insert_query);
+                remote = std::make_unique<RemoteBlockOutputStream>(connection, insert_query);
                 remote->writePrefix();
             }
 
             remote->writePrepared(in);
         }
 
-        remote->writeSuffix();
+        if (remote)
+            remote->writeSuffix();
 
         LOG_TRACE(parent.log, "Sent a batch of " << file_indices.size() << " files.");
 
         for (UInt64 file_index : file_indices)
-            Poco::File{file_index_to_path.at(file_index)}.remove();
+        {
+            const auto file_path = file_index_to_path.find(file_index);
+            if (file_path != file_index_to_path.end())
+                Poco::File{file_path->second}.remove();
+        }
         file_indices.clear();
         total_rows = 0;
         total_bytes = 0;
@@ -357,6 +370,10 @@ void StorageDistributedDirectoryMonitor::processFilesWithBatching(const std::map
 {
     std::unordered_set<UInt64> file_indices_to_skip;
 
+    /// The connection is kept alive for all the batches of this iteration
+    ///  to avoid a handshake per batch.
+    auto connection = pool->get();
+
     if (Poco::File{current_batch_file_path}.exists())
     {
         /// Possibly, we failed to send a batch on the previous iteration. Try to send exactly the same batch.
@@ -364,7 +381,7 @@ void StorageDistributedDirectoryMonitor::processFilesWithBatching(const std::map
         ReadBufferFromFile in{current_batch_file_path};
         batch.readText(in);
         file_indices_to_skip.insert(batch.file_indices.begin(), batch.file_indices.end());
-        batch.send(/* save = */ false, files);
+        batch.send(/* save = */ false, *connection, files);
     }
 
     std::unordered_map<BatchHeader, Batch, BatchHeader::Hash> header_to_batch;
@@ -424,13 +441,13 @@ void StorageDistributedDirectoryMonitor::processFilesWithBatching(const std::map
         batch.total_bytes += total_bytes;
 
         if (batch.isEnoughSize())
-            batch.send(/* save = */ true, files);
+            batch.send(/* save = */ true, *connection, files);
     }
 
     for (auto & kv : header_to_batch)
     {
         Batch & batch = kv.second;
-        batch.send(/* save = */ true, files);
+        batch.send(/* save = */ true, *connection, files);
     }
 
     Poco::File{current_batch_file_path}.remove();
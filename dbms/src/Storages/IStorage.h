@@ -183,6 +183,28 @@ public:
         throw Exception("Method read is not supported by storage " + getName(), ErrorCodes::NOT_IMPLEMENTED);
     }
 
+    /** Returns the exact number of rows matching the query, if the storage can compute it from
+      *  its metadata, without reading the data. The query may restrict only the set of rows the
+      *  storage itself can account for exactly (e.g. a condition on the partitioning columns);
+      *  everything else must have been checked by the caller (see InterpreterSelectQuery).
+      */
+    virtual std::experimental::optional<UInt64> totalRowsByMetadata(const SelectQueryInfo & /* query_info */, const Context & /* context */) const
+    {
+        return {};
+    }
+
+    /** Returns the exact minimum (is_min) or maximum of the column over the rows matching the
+      *  query, under the same contract as `totalRowsByMetadata`. For an empty set of matching
+      *  rows, returns Null; the caller substitutes the default value of the type, as aggregation
+      *  without keys does.
+      */
+    virtual std::experimental::optional<Field> extremeOfColumnByMetadata(
+        bool /* is_min */, const String & /* column_name */,
+        const SelectQueryInfo & /* query_info */, const Context & /* context */) const
+    {
+        return {};
+    }
+
     /** Writes the data to a table.
       * Receives a description of the query, which can contain information about the data write method.
       * Returns an object by which you can write data sequentially.
@@ -226,6 +248,13 @@ public:
         throw Exception("Method dropColumnFromPartition is not supported by storage " + getName(), ErrorCodes::NOT_IMPLEMENTED);
     }
 
+    /** Execute ALTER TABLE ... DELETE WHERE: mark matching rows as deleted without rewriting the data.
+      */
+    virtual void deleteRowsWhere(const ASTPtr & predicate, const Context & context)
+    {
+        throw Exception("Method deleteRowsWhere is not supported by storage " + getName(), ErrorCodes::NOT_IMPLEMENTED);
+    }
+
     /** Run the query (DROP|DETACH) PARTITION.
       */
     virtual void dropPartition(const ASTPtr & query, const ASTPtr & partition, bool detach, const Context & context)
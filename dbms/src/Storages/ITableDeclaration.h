@@ -45,6 +45,11 @@ public:
     NameAndTypePair getMaterializedColumn(const String & column_name) const;
     bool hasMaterializedColumn(const String & column_name) const;
 
+    /** The expression for automatic expiration of rows (the TTL clause of CREATE TABLE), if set.
+      * Rows for which it evaluates to a time point in the past are dropped during merges.
+      */
+    virtual ASTPtr getTTLExpression() const { return nullptr; }
+
     /** Get a description of any column by its name.
       */
     virtual NameAndTypePair getColumn(const String & column_name) const;
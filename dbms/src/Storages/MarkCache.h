@@ -1,7 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
 
+#include <Core/Types.h>
 #include <Common/LRUCache.h>
 #include <Common/ProfileEvents.h>
 #include <Common/SipHash.h>
@@ -21,25 +25,29 @@ namespace DB
 /// Estimate of number of bytes in cache for marks.
 struct MarksWeightFunction
 {
-    size_t operator()(const MarksInCompressedFile & marks) const
+    size_t operator()(const CompactMarksInCompressedFile & marks) const
     {
-        /// NOTE Could add extra 100 bytes for overhead of std::vector, cache structures and allocator.
-        return marks.size() * sizeof(MarkInCompressedFile);
+        /// NOTE Could add extra 100 bytes for overhead of cache structures and allocator.
+        return marks.allocatedBytes();
     }
 };
 
 
 /** Cache of 'marks' for StorageMergeTree.
   * Marks is an index structure that addresses ranges in column file, corresponding to ranges of primary key.
+  * Kept frame-of-reference encoded (see CompactMarksInCompressedFile) to fit more marks in the same memory.
   */
-class MarkCache : public LRUCache<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>
+class MarkCache : public LRUCache<UInt128, CompactMarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>
 {
 private:
-    using Base = LRUCache<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>;
+    using Base = LRUCache<UInt128, CompactMarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>;
+
+    /// Sharded to reduce mutex contention under concurrent reads.
+    static constexpr size_t NUM_SHARDS = 16;
 
 public:
     MarkCache(size_t max_size_in_bytes, const Delay & expiration_delay)
-        : Base(max_size_in_bytes, expiration_delay) {}
+        : Base(max_size_in_bytes, expiration_delay, NUM_SHARDS) {}
 
     /// Calculate key from path to file and offset.
     static UInt128 hash(const String & path_to_file)
@@ -64,6 +72,45 @@ public:
 
         return result.first;
     }
+
+    /// Start remembering paths of marks files put into the cache, so the list of resident files
+    ///  can be dumped to disk and warmed back after restart. See MarkCacheWarmer.
+    void startRecordingFilePaths() { record_file_paths = true; }
+
+    /// Remember the path of the marks file for the key. Does nothing unless recording is enabled.
+    void recordFile(const Key & key, const String & path_to_file)
+    {
+        if (!record_file_paths)
+            return;
+
+        std::lock_guard<std::mutex> lock(file_paths_mutex);
+        file_paths[key] = path_to_file;
+    }
+
+    /// Paths of marks files that are currently resident in the cache. Evicted entries are pruned.
+    Strings getResidentFiles()
+    {
+        Strings res;
+
+        std::lock_guard<std::mutex> lock(file_paths_mutex);
+        for (auto it = file_paths.begin(); it != file_paths.end();)
+        {
+            if (contains(it->first))
+            {
+                res.push_back(it->second);
+                ++it;
+            }
+            else
+                it = file_paths.erase(it);
+        }
+
+        return res;
+    }
+
+private:
+    std::atomic<bool> record_file_paths {false};
+    std::mutex file_paths_mutex;
+    std::unordered_map<UInt128, String, UInt128TrivialHash> file_paths;
 };
 
 using MarkCachePtr = std::shared_ptr<MarkCache>;
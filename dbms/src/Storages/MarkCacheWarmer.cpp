@@ -0,0 +1,169 @@
+#include <Storages/MarkCacheWarmer.h>
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <Poco/File.h>
+#include <common/logger_useful.h>
+#include <Common/Exception.h>
+#include <Common/setThreadName.h>
+#include <DataStreams/MarkInCompressedFile.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/WriteBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+
+
+namespace DB
+{
+
+MarkCacheWarmer::MarkCacheWarmer(MarkCachePtr mark_cache_, const std::string & path_, time_t period_seconds_)
+    : mark_cache(std::move(mark_cache_)), path(path_), period_seconds(period_seconds_),
+    log(&Logger::get("MarkCacheWarmer"))
+{
+    mark_cache->startRecordingFilePaths();
+    dump_thread = std::thread([this] { run(); });
+}
+
+
+MarkCacheWarmer::~MarkCacheWarmer()
+{
+    try
+    {
+        quit_event.set();
+        dump_thread.join();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
+
+void MarkCacheWarmer::warm()
+{
+    if (!Poco::File(path).exists())
+        return;
+
+    size_t loaded = 0;
+    size_t skipped = 0;
+
+    ReadBufferFromFile in(path);
+    while (!in.eof())
+    {
+        String marks_path;
+        readString(marks_path, in);
+        assertChar('\n', in);
+
+        try
+        {
+            /// The part could have been merged or dropped since the dump was written.
+            if (!Poco::File(marks_path).exists())
+            {
+                ++skipped;
+                continue;
+            }
+
+            size_t file_size = Poco::File(marks_path).getSize();
+            if (!file_size || file_size % sizeof(MarkInCompressedFile) != 0)
+            {
+                ++skipped;
+                continue;
+            }
+
+            MarksInCompressedFile raw_marks(file_size / sizeof(MarkInCompressedFile));
+
+            ReadBufferFromFile buffer(marks_path, file_size, -1, reinterpret_cast<char *>(raw_marks.data()));
+            if (buffer.eof() || buffer.buffer().size() != file_size)
+            {
+                ++skipped;
+                continue;
+            }
+
+            auto marks = std::make_shared<CompactMarksInCompressedFile>(raw_marks);
+
+            auto key = MarkCache::hash(marks_path);
+            mark_cache->set(key, marks);
+            /// Touch the entry so that warmed marks go to the protected part of the cache
+            ///  and are not displaced by the entries warmed after them.
+            mark_cache->get(key);
+            mark_cache->recordFile(key, marks_path);
+            ++loaded;
+
+            /// Ask the OS to prefetch the corresponding data file into the page cache.
+            String data_path = marks_path;
+            data_path.resize(data_path.size() - strlen(".mrk"));
+            data_path += ".bin";
+
+            if (Poco::File(data_path).exists())
+            {
+                int fd = open(data_path.c_str(), O_RDONLY);
+                if (fd >= 0)
+                {
+                    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+                    close(fd);
+                }
+            }
+        }
+        catch (...)
+        {
+            ++skipped;
+            tryLogCurrentException(log, "Cannot warm marks from file " + marks_path);
+        }
+    }
+
+    LOG_INFO(log, "Warmed the mark cache: " << loaded << " marks files loaded, " << skipped << " skipped.");
+}
+
+
+void MarkCacheWarmer::dump()
+{
+    Strings files = mark_cache->getResidentFiles();
+    std::sort(files.begin(), files.end());
+
+    String tmp_path = path + ".tmp";
+
+    {
+        WriteBufferFromFile out(tmp_path);
+        for (const auto & file : files)
+        {
+            writeString(file, out);
+            writeChar('\n', out);
+        }
+        out.next();
+    }
+
+    Poco::File(tmp_path).renameTo(path);
+}
+
+
+void MarkCacheWarmer::run()
+{
+    setThreadName("MarkCacheDumper");
+
+    while (!quit_event.tryWait(period_seconds * 1000))
+    {
+        try
+        {
+            dump();
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Cannot dump the list of cached marks files");
+        }
+    }
+
+    /// Final dump, so a graceful restart preserves the freshest state.
+    try
+    {
+        dump();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, "Cannot dump the list of cached marks files");
+    }
+}
+
+}
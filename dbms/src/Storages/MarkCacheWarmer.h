@@ -0,0 +1,46 @@
+#pragma once
+
+#include <thread>
+
+#include <Poco/Event.h>
+
+#include <Storages/MarkCache.h>
+
+
+namespace Poco { class Logger; }
+
+
+namespace DB
+{
+
+/** Makes the contents of the MarkCache survive server restarts.
+  * Periodically dumps the list of marks files resident in the cache to a file on disk.
+  * On startup, before the server accepts queries, the marks files from the previous dump
+  *  are read back into the cache and the OS is advised (posix_fadvise WILLNEED)
+  *  to prefetch the corresponding data files into the page cache.
+  * The primary index needs no such treatment: it is loaded for all parts at startup anyway.
+  */
+class MarkCacheWarmer
+{
+public:
+    /// Starts a background thread that dumps the list of resident files every period_seconds.
+    MarkCacheWarmer(MarkCachePtr mark_cache_, const std::string & path_, time_t period_seconds_);
+    ~MarkCacheWarmer();
+
+    /// Load the marks files listed in the previous dump into the cache. Missing files are skipped.
+    void warm();
+
+private:
+    void run();
+    void dump();
+
+    MarkCachePtr mark_cache;
+    const std::string path;
+    const time_t period_seconds;
+
+    Poco::Event quit_event;
+    std::thread dump_thread;
+    Poco::Logger * log;
+};
+
+}
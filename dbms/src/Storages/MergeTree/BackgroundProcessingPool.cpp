@@ -2,6 +2,7 @@
 #include <Common/setThreadName.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/MemoryTracker.h>
+#include <Common/ProfileEvents.h>
 #include <Common/randomSeed.h>
 #include <IO/WriteHelpers.h>
 #include <common/logger_useful.h>
@@ -20,6 +21,8 @@ namespace CurrentMetrics
 namespace DB
 {
 
+thread_local UInt64 background_pool_task_wait_microseconds = 0;
+
 
 constexpr double BackgroundProcessingPool::sleep_seconds;
 constexpr double BackgroundProcessingPool::sleep_seconds_random_part;
@@ -173,6 +176,11 @@ void BackgroundProcessingPool::threadFunction()
                 continue;
 
             {
+                /// How long the task was ready but there was no free thread for it.
+                Poco::Timestamp execution_start_time;
+                background_pool_task_wait_microseconds = execution_start_time > min_time
+                    ? UInt64(execution_start_time - min_time) : 0;
+
                 CurrentMetrics::Increment metric_increment{CurrentMetrics::BackgroundPoolTask};
                 done_work = task->function();
             }
@@ -182,6 +190,9 @@ void BackgroundProcessingPool::threadFunction()
             tryLogCurrentException(__PRETTY_FUNCTION__);
         }
 
+        /// Make the profile events of the task visible in the global counters.
+        ProfileEvents::updateCounters();
+
         if (shutdown)
             break;
 
@@ -16,6 +16,14 @@
 namespace DB
 {
 
+/** For how long the task currently executed by this background pool thread was ready
+  *  (its scheduled execution time had come) but was waiting for a free thread.
+  * Zero in threads that do not belong to a background pool.
+  * Used by MergeListElement to report the queue wait time of merges.
+  */
+extern thread_local UInt64 background_pool_task_wait_microseconds;
+
+
 /** Using a fixed number of threads, perform an arbitrary number of tasks in an infinite loop.
   * In this case, one task can run simultaneously from different threads.
   * Designed for tasks that perform continuous background work (for example, merge).
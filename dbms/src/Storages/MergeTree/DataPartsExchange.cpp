@@ -3,11 +3,17 @@
 #include <Common/CurrentMetrics.h>
 #include <Common/NetException.h>
 #include <Common/typeid_cast.h>
+#include <Common/localBackup.h>
+#include <Common/randomSeed.h>
+#include <IO/ReadBufferFromFile.h>
 #include <IO/ReadWriteBufferFromHTTP.h>
+#include <IO/CompressedReadBuffer.h>
+#include <common/ThreadPool.h>
 #include <Poco/File.h>
 #include <ext/scope_guard.h>
 #include <Poco/Net/HTTPServerResponse.h>
 #include <Poco/Net/HTTPRequest.h>
+#include <sys/stat.h>
 
 
 namespace CurrentMetrics
@@ -53,8 +59,39 @@ void Service::processQuery(const Poco::Net::HTMLForm & params, ReadBuffer & body
     String part_name = params.get("part");
     String shard_str = params.get("shard");
 
+    /// With a parallel (striped) fetch, this connection sends only its disjoint subset of the part's files.
+    size_t total_stripes = std::stoul(params.get("total_stripes", "1"));
+    size_t stripe = std::stoul(params.get("stripe", "0"));
+
     bool send_sharded_part = !shard_str.empty();
 
+    /** Local-clone handshake: the fetcher has created a token file on its filesystem and asks
+      *  whether we see it. If we do, both sides share a filesystem, and we advertise the absolute
+      *  path of the part, so that the fetcher clones it with hardlinks instead of downloading it
+      *  (see Fetcher::tryCloneLocalPart). An empty answer means the usual fetch should be done.
+      */
+    String local_clone_token = params.get("local_clone_token", "");
+    if (!local_clone_token.empty())
+    {
+        String part_path;
+
+        if (Poco::File(local_clone_token).exists())
+        {
+            auto storage_lock = owned_storage->lockStructure(false, __PRETTY_FUNCTION__);
+
+            /// Check that the part exists (throws otherwise).
+            if (send_sharded_part)
+                findShardedPart(part_name, std::stoul(shard_str));
+            else
+                findPart(part_name);
+
+            part_path = data.getFullPath() + (send_sharded_part ? "reshard/" + shard_str + "/" : "") + part_name + "/";
+        }
+
+        writeStringBinary(part_path, out);
+        return;
+    }
+
     static std::atomic_uint total_sends {0};
 
     if ((data.settings.replicated_max_parallel_sends && total_sends >= data.settings.replicated_max_parallel_sends)
@@ -101,9 +138,18 @@ void Service::processQuery(const Poco::Net::HTMLForm & params, ReadBuffer & body
 
         MergeTreeData::DataPart::Checksums data_checksums;
 
-        writeBinary(checksums.files.size(), out);
+        /// The number of indices in [0, files) giving this remainder modulo total_stripes.
+        size_t files_to_send = stripe < checksums.files.size()
+            ? (checksums.files.size() - stripe + total_stripes - 1) / total_stripes
+            : 0;
+
+        writeBinary(files_to_send, out);
+        size_t file_index = 0;
         for (const auto & it : checksums.files)
         {
+            if (file_index++ % total_stripes != stripe)
+                continue;
+
             String file_name = it.first;
 
             String path;
@@ -135,7 +181,18 @@ void Service::processQuery(const Poco::Net::HTMLForm & params, ReadBuffer & body
                 data_checksums.addFile(file_name, hashing_out.count(), hashing_out.getHash());
         }
 
-        part->checksums.checkEqual(data_checksums, false);
+        if (total_stripes > 1)
+        {
+            /// Only a subset of the files was sent - check them one by one.
+            for (const auto & it : data_checksums.files)
+            {
+                auto jt = part->checksums.files.find(it.first);
+                if (jt != part->checksums.files.end())
+                    jt->second.checkEqual(it.second, false, it.first);
+            }
+        }
+        else
+            part->checksums.checkEqual(data_checksums, false);
     }
     catch (const NetException & e)
     {
@@ -197,6 +254,11 @@ MergeTreeData::MutableDataPartPtr Fetcher::fetchPartImpl(
     const String & shard_no,
     bool to_detached)
 {
+    size_t fetch_threads = std::max<size_t>(1, data.settings.replicated_fetch_threads);
+
+    const String & compression = data.settings.replicated_fetch_compression_method;
+    bool compress = !compression.empty() && compression != "none";
+
     Poco::URI uri;
     uri.setScheme("http");
     uri.setHost(host);
@@ -206,11 +268,12 @@ MergeTreeData::MutableDataPartPtr Fetcher::fetchPartImpl(
         {"endpoint", getEndpointId(replica_path)},
         {"part", part_name},
         {"shard", shard_no},
-        {"compress", "false"}
+        {"compress", compress ? "true" : "false"}
     }
     );
 
-    ReadWriteBufferFromHTTP in{uri, Poco::Net::HTTPRequest::HTTP_POST};
+    if (compress)
+        uri.addQueryParameter("compress_method", compression);
 
     static const String TMP_PREFIX = "tmp_fetch_";
     String relative_part_path = String(to_detached ? "detached/" : "") + TMP_PREFIX + part_name;
@@ -228,9 +291,136 @@ MergeTreeData::MutableDataPartPtr Fetcher::fetchPartImpl(
     new_data_part->relative_path = relative_part_path;
     new_data_part->is_temp = true;
 
+    MergeTreeData::DataPart::Checksums checksums;
+    bool cloned_locally = false;
+
+    try
+    {
+        if (data.settings.replicated_fetch_hardlink_local_parts)
+        {
+            try
+            {
+                cloned_locally = tryCloneLocalPart(uri, absolute_part_path);
+            }
+            catch (...)
+            {
+                tryLogCurrentException(log, "Failed to clone part " + part_name + " locally, will fetch it over HTTP");
+                part_file.remove(true);
+                part_file.createDirectory();
+            }
+        }
+
+        if (cloned_locally)
+        {
+            /// Nothing was transferred; the checksums of the clone were verified in tryCloneLocalPart.
+        }
+        else if (fetch_threads == 1)
+        {
+            fetchFiles(uri, absolute_part_path, replica_path, compress, checksums);
+        }
+        else
+        {
+            /// Each connection downloads a disjoint subset (stripe) of the part's files.
+            std::vector<MergeTreeData::DataPart::Checksums> stripe_checksums(fetch_threads);
+
+            ThreadPool pool(fetch_threads);
+            for (size_t i = 0; i < fetch_threads; ++i)
+            {
+                Poco::URI stripe_uri = uri;
+                stripe_uri.addQueryParameter("stripe", toString(i));
+                stripe_uri.addQueryParameter("total_stripes", toString(fetch_threads));
+
+                pool.schedule([this, stripe_uri, &absolute_part_path, &replica_path, compress, &stripe_checksums, i]
+                {
+                    fetchFiles(stripe_uri, absolute_part_path, replica_path, compress, stripe_checksums[i]);
+                });
+            }
+            pool.wait();
+
+            for (auto & stripe : stripe_checksums)
+                for (auto & file : stripe.files)
+                    checksums.files.emplace(file.first, std::move(file.second));
+        }
+    }
+    catch (const Exception & e)
+    {
+        if (e.code() == ErrorCodes::ABORTED)
+            part_file.remove(true);
+        throw;
+    }
+
+    new_data_part->modification_time = time(nullptr);
+    new_data_part->loadColumnsChecksumsIndexes(true, false);
+    if (!cloned_locally)
+        new_data_part->checksums.checkEqual(checksums, false);
+
+    return new_data_part;
+}
+
+bool Fetcher::tryCloneLocalPart(const Poco::URI & uri, const String & absolute_part_path)
+{
+    /// Create a token file and ask the sender whether it sees it on its filesystem.
+    String token_path = data.getFullPath() + "tmp_fetch_token_" + toString(randomSeed());
+    Poco::File token_file(token_path);
+    token_file.createFile();
+    SCOPE_EXIT({ try { token_file.remove(); } catch (...) { tryLogCurrentException(log); } });
+
+    Poco::URI probe_uri = uri;
+    probe_uri.addQueryParameter("local_clone_token", token_path);
+
+    ReadWriteBufferFromHTTP probe_in{probe_uri, Poco::Net::HTTPRequest::HTTP_POST};
+
+    String source_part_path;
+    readStringBinary(source_part_path, probe_in);
+    assertEOF(probe_in);
+
+    /// The sender is on another host, or the part is gone.
+    if (source_part_path.empty())
+        return false;
+
+    /// Hardlinks work only within one mounted filesystem.
+    struct stat source_stat;
+    struct stat destination_stat;
+    if (0 != ::stat(source_part_path.c_str(), &source_stat)
+        || 0 != ::stat(data.getFullPath().c_str(), &destination_stat)
+        || source_stat.st_dev != destination_stat.st_dev)
+        return false;
+
+    LOG_TRACE(log, "Cloning local part " << source_part_path << " to " << absolute_part_path << " with hardlinks");
+
+    /// As with FREEZE PARTITION, this marks the source files read-only; part files are immutable anyway.
+    localBackup(Poco::Path(source_part_path), Poco::Path(absolute_part_path));
+
+    /** Nothing was transferred, so there are no transfer checksums to compare with.
+      * Instead check that the set of cloned files and their sizes match the checksums.txt of the
+      *  source part (e.g. the part could have been removed while we were cloning it).
+      * The hashes are the same by construction - the files share inodes with the source.
+      */
+    MergeTreeData::DataPart::Checksums source_checksums;
+    ReadBufferFromFile checksums_in(absolute_part_path + "checksums.txt");
+    if (source_checksums.read(checksums_in))
+        source_checksums.checkSizes(absolute_part_path);
+
+    return true;
+}
+
+void Fetcher::fetchFiles(
+    const Poco::URI & uri,
+    const String & absolute_part_path,
+    const String & replica_path,
+    bool decompress,
+    MergeTreeData::DataPart::Checksums & checksums)
+{
+    ReadWriteBufferFromHTTP http_in{uri, Poco::Net::HTTPRequest::HTTP_POST};
+
+    std::unique_ptr<CompressedReadBuffer> decompressing_in;
+    if (decompress)
+        decompressing_in = std::make_unique<CompressedReadBuffer>(http_in);
+
+    ReadBuffer & in = decompress ? static_cast<ReadBuffer &>(*decompressing_in) : http_in;
+
     size_t files;
     readBinary(files, in);
-    MergeTreeData::DataPart::Checksums checksums;
     for (size_t i = 0; i < files; ++i)
     {
         String file_name;
@@ -247,7 +437,6 @@ MergeTreeData::MutableDataPartPtr Fetcher::fetchPartImpl(
         {
             /// NOTE The is_cancelled flag also makes sense to check every time you read over the network, performing a poll with a not very large timeout.
             /// And now we check it only between read chunks (in the `copyData` function).
-            part_file.remove(true);
             throw Exception("Fetching of part was cancelled", ErrorCodes::ABORTED);
         }
 
@@ -263,12 +452,6 @@ MergeTreeData::MutableDataPartPtr Fetcher::fetchPartImpl(
     }
 
     assertEOF(in);
-
-    new_data_part->modification_time = time(nullptr);
-    new_data_part->loadColumnsChecksumsIndexes(true, false);
-    new_data_part->checksums.checkEqual(checksums, false);
-
-    return new_data_part;
 }
 
 }
@@ -4,6 +4,7 @@
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <IO/HashingWriteBuffer.h>
 #include <IO/copyData.h>
+#include <Poco/URI.h>
 
 
 namespace DB
@@ -72,6 +73,20 @@ private:
         const String & shard_no,
         bool to_detached);
 
+    /** If the part resides on the same mounted filesystem (checked with a token file handshake),
+      *  clones it into absolute_part_path with hardlinks and verifies the file sizes against the
+      *  checksums.txt of the source part. Returns false if the fast path is not applicable.
+      */
+    bool tryCloneLocalPart(const Poco::URI & uri, const String & absolute_part_path);
+
+    /// Receives the files of one transfer stream (one connection) and verifies their checksums.
+    void fetchFiles(
+        const Poco::URI & uri,
+        const String & absolute_part_path,
+        const String & replica_path,
+        bool decompress,
+        MergeTreeData::DataPart::Checksums & checksums);
+
 private:
     MergeTreeData & data;
     /// You need to stop the data transfer.
@@ -1,4 +1,5 @@
 #include <Storages/MergeTree/MergeList.h>
+#include <Storages/MergeTree/BackgroundProcessingPool.h>
 #include <Common/CurrentMetrics.h>
 #include <Poco/Ext/ThreadNumber.h>
 
@@ -19,6 +20,9 @@ MergeListElement::MergeListElement(const std::string & database, const std::stri
     for (const auto & source_part : source_parts)
         source_part_names.emplace_back(source_part->name);
 
+    /// Zero if the merge is executed outside of the background pool (e.g. by the OPTIMIZE query).
+    queue_wait_microseconds = background_pool_task_wait_microseconds;
+
     /// Each merge is executed into separate background processing pool thread
     background_pool_task_memory_tracker = current_memory_tracker;
     if (background_pool_task_memory_tracker)
@@ -41,12 +45,22 @@ MergeInfo MergeListElement::getInfo() const
     res.total_size_marks = total_size_marks;
     res.bytes_read_uncompressed = bytes_read_uncompressed.load(std::memory_order_relaxed);
     res.bytes_written_uncompressed = bytes_written_uncompressed.load(std::memory_order_relaxed);
+    res.bytes_written_compressed = bytes_written_compressed.load(std::memory_order_relaxed);
     res.rows_read = rows_read.load(std::memory_order_relaxed);
     res.rows_written = rows_written.load(std::memory_order_relaxed);
     res.columns_written = columns_written.load(std::memory_order_relaxed);
     res.memory_usage = memory_tracker.get();
     res.thread_number = thread_number;
 
+    res.rows_per_second = res.elapsed ? res.rows_read / res.elapsed : 0;
+    res.read_bytes_per_second = res.elapsed ? res.bytes_read_uncompressed / res.elapsed : 0;
+    res.write_bytes_per_second = res.elapsed ? res.bytes_written_uncompressed / res.elapsed : 0;
+
+    res.read_time_seconds = read_time_ns.load(std::memory_order_relaxed) / 1e9;
+    res.sort_time_seconds = sort_time_ns.load(std::memory_order_relaxed) / 1e9;
+    res.write_time_seconds = write_time_ns.load(std::memory_order_relaxed) / 1e9;
+    res.queue_wait_time_seconds = queue_wait_microseconds / 1e6;
+
     for (const auto & source_part_name : source_part_names)
         res.source_part_names.emplace_back(source_part_name);
 
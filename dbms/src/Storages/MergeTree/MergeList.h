@@ -36,11 +36,23 @@ struct MergeInfo
     UInt64 total_size_marks;
     UInt64 bytes_read_uncompressed;
     UInt64 bytes_written_uncompressed;
+    UInt64 bytes_written_compressed;
     UInt64 rows_read;
     UInt64 rows_written;
     UInt64 columns_written;
     UInt64 memory_usage;
     UInt64 thread_number;
+
+    /// Live throughput since the merge started.
+    Float64 rows_per_second;
+    Float64 read_bytes_per_second;
+    Float64 write_bytes_per_second;
+
+    /// Time split of the merge between its phases (see MergeTreeDataMerger) and the wait for a pool thread.
+    Float64 read_time_seconds;
+    Float64 sort_time_seconds;
+    Float64 write_time_seconds;
+    Float64 queue_wait_time_seconds;
 };
 
 
@@ -57,6 +69,16 @@ struct MergeListElement : boost::noncopyable
     UInt64 total_size_marks{};
     std::atomic<UInt64> bytes_read_uncompressed{};
     std::atomic<UInt64> bytes_written_uncompressed{};
+    std::atomic<UInt64> bytes_written_compressed{};
+
+    /// Cumulative time the merge has spent reading the source parts, merge-sorting the rows
+    ///  and writing the result, in nanoseconds. Updated by MergeTreeDataMerger.
+    std::atomic<UInt64> read_time_ns{};
+    std::atomic<UInt64> sort_time_ns{};
+    std::atomic<UInt64> write_time_ns{};
+
+    /// For how long the background pool task that executes this merge was ready and waiting for a free thread.
+    UInt64 queue_wait_microseconds{};
 
     /// In case of Vertical algorithm they are actual only for primary key columns
     std::atomic<UInt64> rows_read{};
@@ -0,0 +1,95 @@
+#include <time.h>   /// nanosleep
+
+#include <Storages/MergeTree/MergeScheduler.h>
+#include <Common/CurrentMetrics.h>
+
+
+namespace CurrentMetrics
+{
+    extern const Metric Query;
+    extern const Metric Merge;
+}
+
+namespace DB
+{
+
+static UInt64 currentMonotonicNanoseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return UInt64(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+
+void MergeScheduler::setBudget(size_t busy_read_bandwidth_, size_t busy_max_concurrency_, UInt64 idle_linger_milliseconds_)
+{
+    busy_read_bandwidth = busy_read_bandwidth_;
+    busy_max_concurrency = busy_max_concurrency_;
+    idle_linger_milliseconds = idle_linger_milliseconds_;
+}
+
+
+bool MergeScheduler::isBusy() const
+{
+    UInt64 now_ns = currentMonotonicNanoseconds();
+
+    if (CurrentMetrics::values[CurrentMetrics::Query].load(std::memory_order_relaxed) > 0)
+    {
+        last_busy_time_ns.store(now_ns, std::memory_order_relaxed);
+        return true;
+    }
+
+    return now_ns - last_busy_time_ns.load(std::memory_order_relaxed) < idle_linger_milliseconds * 1000000ULL;
+}
+
+
+bool MergeScheduler::canStartMerge() const
+{
+    if (!busy_max_concurrency || !isBusy())
+        return true;
+
+    return CurrentMetrics::values[CurrentMetrics::Merge].load(std::memory_order_relaxed)
+        < static_cast<CurrentMetrics::Value>(busy_max_concurrency);
+}
+
+
+void MergeScheduler::throttleRead(size_t bytes)
+{
+    if (!busy_read_bandwidth)
+        return;
+
+    UInt64 sleep_ns = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (!isBusy())
+        {
+            /// The budget applies only while the server is busy. Restart the accounting window,
+            ///  so that bytes read during the idle period are not charged to it.
+            count = 0;
+            return;
+        }
+
+        if (0 == count)
+            watch.restart();
+
+        count += bytes;
+
+        /// Same as in Throttler: how much time to wait for the average speed to drop to the budget.
+        UInt64 desired_ns = count * 1000000000 / busy_read_bandwidth;
+        UInt64 elapsed_ns = watch.elapsed();
+        if (desired_ns > elapsed_ns)
+            sleep_ns = desired_ns - elapsed_ns;
+    }
+
+    if (sleep_ns)
+    {
+        timespec sleep_ts;
+        sleep_ts.tv_sec = sleep_ns / 1000000000;
+        sleep_ts.tv_nsec = sleep_ns % 1000000000;
+        nanosleep(&sleep_ts, nullptr);    /// NOTE Returns early in case of a signal. This is considered normal.
+    }
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <Common/Stopwatch.h>
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+/** Adapts the amount of background merge I/O to the foreground query load.
+  *
+  * The server is considered busy while queries are executing and for a linger period afterwards
+  *  (so that the budget does not flap between consecutive queries).
+  * While busy, no new merges are started above `busy_max_concurrency` and the total
+  *  uncompressed read speed of all running merges is limited to `busy_read_bandwidth`.
+  * While idle, merges run unrestricted and soak the spare disk bandwidth.
+  *
+  * All limits are disabled by default; see the `merge_scheduler` section of the server config.
+  */
+class MergeScheduler
+{
+public:
+    void setBudget(size_t busy_read_bandwidth_, size_t busy_max_concurrency_, UInt64 idle_linger_milliseconds_);
+
+    /// Whether one more merge may be started now. Consulted by the background merge task
+    ///  before selecting parts; merges initiated by the OPTIMIZE query are not subject to it.
+    bool canStartMerge() const;
+
+    /// Account `bytes` uncompressed bytes read by a merge; sleeps if the busy budget is exceeded.
+    void throttleRead(size_t bytes);
+
+private:
+    bool isBusy() const;
+
+    size_t busy_read_bandwidth = 0;        /// Bytes per second. 0 - reads of merges are not throttled.
+    size_t busy_max_concurrency = 0;    /// 0 - the number of concurrent merges is not limited.
+    UInt64 idle_linger_milliseconds = 5000;
+
+    mutable std::atomic<UInt64> last_busy_time_ns {0};
+
+    /// Bytes read by merges since the server became busy.
+    size_t count = 0;
+    Stopwatch watch {CLOCK_MONOTONIC_COARSE};
+    std::mutex mutex;
+};
+
+}
@@ -25,10 +25,12 @@ MergeTreeBaseBlockInputStream::MergeTreeBaseBlockInputStream(
     size_t preferred_block_size_bytes,
     size_t preferred_max_column_in_block_size_bytes,
     size_t min_bytes_to_use_direct_io,
+    size_t min_bytes_to_use_mmap_io,
     size_t max_read_buffer_size,
     bool use_uncompressed_cache,
     bool save_marks_in_cache,
-    const Names & virt_column_names)
+    const Names & virt_column_names,
+    bool apply_deleted_rows_mask)
 :
     storage(storage),
     prewhere_actions(prewhere_actions),
@@ -37,10 +39,12 @@ MergeTreeBaseBlockInputStream::MergeTreeBaseBlockInputStream(
     preferred_block_size_bytes(preferred_block_size_bytes),
     preferred_max_column_in_block_size_bytes(preferred_max_column_in_block_size_bytes),
     min_bytes_to_use_direct_io(min_bytes_to_use_direct_io),
+    min_bytes_to_use_mmap_io(min_bytes_to_use_mmap_io),
     max_read_buffer_size(max_read_buffer_size),
     use_uncompressed_cache(use_uncompressed_cache),
     save_marks_in_cache(save_marks_in_cache),
     virt_column_names(virt_column_names),
+    apply_deleted_rows_mask(apply_deleted_rows_mask),
     max_block_size_marks(max_block_size_rows / storage.index_granularity)
 {
 }
@@ -78,7 +82,7 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
     const auto max_block_size_rows = this->max_block_size_rows;
     const auto preferred_block_size_bytes = this->preferred_block_size_bytes;
     const auto preferred_max_column_in_block_size_bytes = this->preferred_max_column_in_block_size_bytes;
-    const auto index_granularity = storage.index_granularity;
+    const auto index_granularity = task->data_part->index_granularity;
     const double min_filtration_ratio = 0.00001;
 
     auto estimateNumRows = [preferred_block_size_bytes, max_block_size_rows,
@@ -160,6 +164,8 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
             /// Last range may be partl read. The same number of rows we need to read after prewhere
             size_t rows_was_read_in_last_range = 0;
             std::experimental::optional<MergeTreeRangeReader> pre_range_reader;
+            /// Which rows of the part make up `res` - needed to apply the deletion mask.
+            ReadRowsSegments read_segments;
 
             auto processNextRange = [& ranges_to_read, & rows_was_read_in_last_range, & pre_range_reader](
                 MergeTreeReadTask & task, MergeTreeReader & pre_reader)
@@ -197,7 +203,10 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
                     processNextRange(*task, *pre_reader);
 
                 size_t rows_to_read = std::min(pre_range_reader->unreadRows(), space_left);
+                size_t read_start_row = pre_range_reader->currentRow();
                 size_t read_rows = pre_range_reader->read(res, rows_to_read);
+                if (read_rows)
+                    read_segments.emplace_back(read_start_row, read_rows);
                 rows_was_read_in_last_range += read_rows;
                 if (pre_range_reader->isReadingFinished())
                     pre_range_reader = std::experimental::nullopt;
@@ -218,6 +227,36 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
             /// Compute the expression in PREWHERE.
             prewhere_actions->execute(res);
 
+            /// Combine the deletion mask into the PREWHERE filter: deleted rows are then skipped
+            ///  the same way as rows with false PREWHERE condition.
+            if (apply_deleted_rows_mask && task->data_part->deleted_rows_mask.initialized)
+            {
+                if (ColumnPtr deleted_filter = makeDeletedRowsFilter(read_segments))
+                {
+                    auto & prewhere_col = res.getByName(prewhere_column);
+
+                    ColumnPtr prewhere_value = prewhere_col.column;
+                    if (prewhere_value->isNullable())
+                        prewhere_value = static_cast<const ColumnNullable &>(*prewhere_value).getNestedColumn();
+
+                    if (prewhere_value->isConst())
+                    {
+                        /// A constant false filter removes everything anyway; constant true is replaced by the mask.
+                        if (static_cast<const ColumnConst &>(*prewhere_value).getValue<UInt8>())
+                            prewhere_col.column = deleted_filter;
+                    }
+                    else if (const auto prewhere_vec = typeid_cast<const ColumnUInt8 *>(prewhere_value.get()))
+                    {
+                        const auto & prewhere_data = prewhere_vec->getData();
+                        auto & filter_data = static_cast<ColumnUInt8 &>(*deleted_filter).getData();
+                        for (size_t i = 0; i < filter_data.size(); ++i)
+                            filter_data[i] = filter_data[i] && prewhere_data[i];
+                        prewhere_col.column = deleted_filter;
+                    }
+                    /// Filters of other types are rejected below.
+                }
+            }
+
             ColumnPtr column = res.getByName(prewhere_column).column;
             if (task->remove_prewhere_column)
                 res.erase(prewhere_column);
@@ -440,6 +479,7 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
     else
     {
         size_t space_left = std::max(static_cast<decltype(max_block_size_rows)>(1), max_block_size_rows);
+        ReadRowsSegments read_segments;
         while (!task->isFinished() && space_left && !isCancelled())
         {
             if (!task->current_range_reader)
@@ -455,7 +495,10 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
                 break;
             rows_to_read = std::min(rows_to_read, std::max(static_cast<decltype(recommended_rows)>(1), recommended_rows));
 
+            size_t read_start_row = task->current_range_reader->currentRow();
             size_t rows_was_read = task->current_range_reader->read(res, rows_to_read);
+            if (rows_was_read)
+                read_segments.emplace_back(read_start_row, rows_was_read);
             if (task->current_range_reader->isReadingFinished())
                 task->current_range_reader = std::experimental::nullopt;
 
@@ -467,7 +510,21 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
             space_left -= rows_was_read;
         }
 
-        /// In the case of isCancelled.
+        /// Filter out the rows deleted by ALTER ... DELETE WHERE.
+        if (res && apply_deleted_rows_mask && task->data_part->deleted_rows_mask.initialized)
+        {
+            if (ColumnPtr deleted_filter = makeDeletedRowsFilter(read_segments))
+            {
+                const auto & filter = static_cast<const ColumnUInt8 &>(*deleted_filter).getData();
+                for (const auto i : ext::range(0, res.columns()))
+                    filterColumn(res.safeGetByPosition(i).column, filter);
+
+                if (!res.rows())
+                    res.clear();
+            }
+        }
+
+        /// In the case of isCancelled or when all read rows were deleted.
         if (!res)
             return res;
 
@@ -479,6 +536,33 @@ Block MergeTreeBaseBlockInputStream::readFromPart()
 }
 
 
+ColumnPtr MergeTreeBaseBlockInputStream::makeDeletedRowsFilter(const ReadRowsSegments & read_segments) const
+{
+    const auto & mask = task->data_part->deleted_rows_mask;
+
+    size_t total_rows = 0;
+    for (const auto & segment : read_segments)
+        total_rows += segment.second;
+
+    auto filter_column = std::make_shared<ColumnUInt8>(total_rows);
+    auto & filter = filter_column->getData();
+
+    bool has_deleted = false;
+    size_t pos = 0;
+    for (const auto & segment : read_segments)
+    {
+        for (size_t row = segment.first; row < segment.first + segment.second; ++row, ++pos)
+        {
+            bool deleted = row < mask.rows && mask.isDeleted(row);
+            filter[pos] = !deleted;
+            has_deleted |= deleted;
+        }
+    }
+
+    return has_deleted ? ColumnPtr(filter_column) : nullptr;
+}
+
+
 void MergeTreeBaseBlockInputStream::injectVirtualColumns(Block & block)
 {
     const auto rows = block.rows();
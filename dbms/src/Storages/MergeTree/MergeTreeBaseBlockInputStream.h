@@ -23,10 +23,12 @@ public:
         size_t preferred_block_size_bytes,
         size_t preferred_max_column_in_block_size_bytes,
         size_t min_bytes_to_use_direct_io,
+        size_t min_bytes_to_use_mmap_io,
         size_t max_read_buffer_size,
         bool use_uncompressed_cache,
         bool save_marks_in_cache = true,
-        const Names & virt_column_names = {});
+        const Names & virt_column_names = {},
+        bool apply_deleted_rows_mask = true);
 
     ~MergeTreeBaseBlockInputStream() override;
 
@@ -44,6 +46,13 @@ protected:
 
     void injectVirtualColumns(Block & block);
 
+    /// Segments of rows composing one block: (first row of the segment in the part, number of rows).
+    using ReadRowsSegments = std::vector<std::pair<size_t, size_t>>;
+
+    /// Builds a filter over the read rows from the deletion mask of the current part
+    ///  (see MergeTreeDataPart::DeletedRowsMask). Returns nullptr if no read row is masked.
+    ColumnPtr makeDeletedRowsFilter(const ReadRowsSegments & read_segments) const;
+
 protected:
 
     MergeTreeData & storage;
@@ -56,6 +65,7 @@ protected:
     size_t preferred_max_column_in_block_size_bytes;
 
     size_t min_bytes_to_use_direct_io;
+    size_t min_bytes_to_use_mmap_io;
     size_t max_read_buffer_size;
 
     bool use_uncompressed_cache;
@@ -63,6 +73,9 @@ protected:
 
     Names virt_column_names;
 
+    /// false only when the mask itself is being built (ALTER ... DELETE WHERE reads rows unfiltered).
+    bool apply_deleted_rows_mask;
+
     std::unique_ptr<MergeTreeReadTask> task;
 
     std::shared_ptr<UncompressedCache> owned_uncompressed_cache;
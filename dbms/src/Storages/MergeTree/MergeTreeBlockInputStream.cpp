@@ -28,15 +28,18 @@ MergeTreeBlockInputStream::MergeTreeBlockInputStream(
     String prewhere_column_,
     bool check_columns,
     size_t min_bytes_to_use_direct_io_,
+    size_t min_bytes_to_use_mmap_io_,
     size_t max_read_buffer_size_,
     bool save_marks_in_cache_,
     const Names & virt_column_names,
     size_t part_index_in_query_,
-    bool quiet)
+    bool quiet,
+    bool apply_deleted_rows_mask_)
     :
     MergeTreeBaseBlockInputStream{storage_, prewhere_actions_, prewhere_column_, max_block_size_rows_,
         preferred_block_size_bytes_, preferred_max_column_in_block_size_bytes_, min_bytes_to_use_direct_io_,
-        max_read_buffer_size_, use_uncompressed_cache_, save_marks_in_cache_, virt_column_names},
+        min_bytes_to_use_mmap_io_, max_read_buffer_size_, use_uncompressed_cache_, save_marks_in_cache_, virt_column_names,
+        apply_deleted_rows_mask_},
     ordered_names{column_names},
     data_part{owned_data_part_},
     part_columns_lock(data_part->columns_lock),
@@ -49,15 +52,15 @@ MergeTreeBlockInputStream::MergeTreeBlockInputStream(
     size_t total_rows = 0;
     for (const auto & range : all_mark_ranges)
         total_rows += range.end - range.begin;
-    total_rows *= storage.index_granularity;
+    total_rows *= data_part->index_granularity;
 
     if (!quiet)
         LOG_TRACE(log, "Reading " << all_mark_ranges.size() << " ranges from part " << data_part->name
         << ", approx. " << total_rows
         << (all_mark_ranges.size() > 1
-        ? ", up to " + toString((all_mark_ranges.back().end - all_mark_ranges.front().begin) * storage.index_granularity)
+        ? ", up to " + toString((all_mark_ranges.back().end - all_mark_ranges.front().begin) * data_part->index_granularity)
         : "")
-        << " rows starting from " << all_mark_ranges.front().begin * storage.index_granularity);
+        << " rows starting from " << all_mark_ranges.front().begin * data_part->index_granularity);
 
     setTotalRowsApprox(total_rows);
 }
@@ -166,13 +169,13 @@ try
         reader = std::make_unique<MergeTreeReader>(
             path, data_part, columns, owned_uncompressed_cache.get(),
             owned_mark_cache.get(), save_marks_in_cache, storage,
-            all_mark_ranges, min_bytes_to_use_direct_io, max_read_buffer_size);
+            all_mark_ranges, min_bytes_to_use_direct_io, min_bytes_to_use_mmap_io, max_read_buffer_size);
 
         if (prewhere_actions)
             pre_reader = std::make_unique<MergeTreeReader>(
                 path, data_part, pre_columns, owned_uncompressed_cache.get(),
                 owned_mark_cache.get(), save_marks_in_cache, storage,
-                all_mark_ranges, min_bytes_to_use_direct_io, max_read_buffer_size);
+                all_mark_ranges, min_bytes_to_use_direct_io, min_bytes_to_use_mmap_io, max_read_buffer_size);
     }
 
     return true;
@@ -28,11 +28,13 @@ public:
         String prewhere_column,
         bool check_columns,
         size_t min_bytes_to_use_direct_io,
+        size_t min_bytes_to_use_mmap_io,
         size_t max_read_buffer_size,
         bool save_marks_in_cache,
         const Names & virt_column_names = {},
         size_t part_index_in_query = 0,
-        bool quiet = false);
+        bool quiet = false,
+        bool apply_deleted_rows_mask = true);
 
     ~MergeTreeBlockInputStream() override;
 
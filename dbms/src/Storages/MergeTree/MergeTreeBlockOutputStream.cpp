@@ -1,4 +1,5 @@
 #include <Storages/MergeTree/MergeTreeBlockOutputStream.h>
+#include <Storages/MergeTree/PartCommitter.h>
 #include <Storages/StorageMergeTree.h>
 #include <Interpreters/PartLog.h>
 
@@ -15,9 +16,14 @@ void MergeTreeBlockOutputStream::write(const Block & block)
     {
         Stopwatch watch;
 
-        MergeTreeData::MutableDataPartPtr part = storage.writer.writeTempPart(current_block);
+        MergeTreeData::MutableDataPartPtr part = storage.writer.writeTempPart(current_block, presorted);
         storage.data.renameTempPartAndAdd(part, &storage.increment);
 
+        /// Group commit: the part is made durable together with the parts of concurrent
+        ///  inserts, sharing one sync per filesystem per batch.
+        if (storage.data.settings.fsync_after_insert)
+            PartCommitter::instance().commit(part->getFullPath());
+
         if (auto part_log = storage.context.getPartLog(part->storage.getDatabaseName(), part->storage.getTableName()))
             part_log->addNewPart(*part, watch.elapsed());
 
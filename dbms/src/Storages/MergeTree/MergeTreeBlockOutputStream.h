@@ -13,13 +13,16 @@ class StorageMergeTree;
 class MergeTreeBlockOutputStream : public IBlockOutputStream
 {
 public:
-    MergeTreeBlockOutputStream(StorageMergeTree & storage_)
-        : storage(storage_) {}
+    MergeTreeBlockOutputStream(StorageMergeTree & storage_, bool presorted_ = false)
+        : storage(storage_), presorted(presorted_) {}
 
     void write(const Block & block) override;
 
 private:
     StorageMergeTree & storage;
+
+    /// The blocks are declared to be in the order of the primary key (insert_sorted_by_primary_key).
+    bool presorted = false;
 };
 
 }
@@ -1,5 +1,6 @@
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <Interpreters/ExpressionAnalyzer.h>
+#include <Interpreters/InterpreterSelectQuery.h>
 #include <Storages/MergeTree/MergeTreeBlockInputStream.h>
 #include <Storages/MergeTree/MergedBlockOutputStream.h>
 #include <Storages/MergeTree/MergeTreePartChecker.h>
@@ -9,12 +10,16 @@
 #include <Parsers/ASTLiteral.h>
 #include <Parsers/ASTFunction.h>
 #include <Parsers/ASTPartition.h>
+#include <Parsers/ASTSelectQuery.h>
 #include <Parsers/ExpressionListParsers.h>
 #include <Parsers/parseQuery.h>
+#include <Parsers/queryToString.h>
 #include <DataStreams/ExpressionBlockInputStream.h>
+#include <DataStreams/NativeBlockOutputStream.h>
 #include <DataStreams/ValuesRowInputStream.h>
 #include <DataStreams/copyData.h>
 #include <IO/WriteBufferFromFile.h>
+#include <IO/CompressedWriteBuffer.h>
 #include <IO/WriteBufferFromString.h>
 #include <IO/CompressedReadBuffer.h>
 #include <IO/ReadBufferFromMemory.h>
@@ -38,12 +43,20 @@
 #include <Common/Stopwatch.h>
 #include <Common/typeid_cast.h>
 #include <Common/localBackup.h>
+#include <Common/Throttler.h>
+
+#include <common/ThreadPool.h>
 
 #include <Poco/DirectoryIterator.h>
 
+#include <boost/algorithm/string/trim.hpp>
+
 #include <algorithm>
 #include <iomanip>
 #include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
 #include <typeinfo>
 #include <typeindex>
 #include <experimental/optional>
@@ -68,6 +81,7 @@ namespace DB
 namespace ErrorCodes
 {
     extern const int MEMORY_LIMIT_EXCEEDED;
+    extern const int NOT_IMPLEMENTED;
     extern const int SYNTAX_ERROR;
     extern const int CORRUPTED_DATA;
     extern const int INVALID_PARTITION_VALUE;
@@ -86,6 +100,8 @@ MergeTreeData::MergeTreeData(
     const String & date_column_name,
     const ASTPtr & partition_expr_ast_,
     const ASTPtr & sampling_expression_,
+    const ASTPtr & ttl_expression_,
+    const ASTPtr & projection_query_,
     size_t index_granularity_,
     const MergingParams & merging_params_,
     const MergeTreeSettings & settings_,
@@ -96,6 +112,8 @@ MergeTreeData::MergeTreeData(
     PartsCleanCallback parts_clean_callback_)
     : ITableDeclaration{materialized_columns_, alias_columns_, column_defaults_}, context(context_),
     sampling_expression(sampling_expression_),
+    ttl_expression(ttl_expression_),
+    projection_query(projection_query_),
     index_granularity(index_granularity_),
     merging_params(merging_params_),
     settings(settings_),
@@ -146,6 +164,11 @@ MergeTreeData::MergeTreeData(
         min_format_version = MERGE_TREE_DATA_MIN_FORMAT_VERSION_WITH_CUSTOM_PARTITIONING;
     }
 
+    initSkipIndex();
+    initPartMinMaxStatistics();
+    initProjection();
+    initDeltaCompression();
+
     /// Creating directories, if not exist.
     Poco::File(full_path).createDirectories();
     Poco::File(full_path + "detached").createDirectory();
@@ -289,6 +312,205 @@ void MergeTreeData::initPartitionKey()
 }
 
 
+void MergeTreeData::initSkipIndex()
+{
+    if (settings.skip_index_columns.empty())
+        return;
+
+    /// Parse the comma-separated list of columns from the setting.
+    const String & list = settings.skip_index_columns;
+    NamesAndTypesList columns_with_types;
+    size_t pos = 0;
+    while (pos < list.size())
+    {
+        size_t comma = list.find(',', pos);
+        if (comma == String::npos)
+            comma = list.size();
+
+        String name = list.substr(pos, comma - pos);
+        pos = comma + 1;
+
+        boost::algorithm::trim(name);
+        if (name.empty())
+            continue;
+
+        if (!hasColumn(name))
+            throw Exception(
+                "Column " + name + " listed in skip_index_columns setting doesn't exist in table",
+                ErrorCodes::ILLEGAL_COLUMN);
+
+        NameAndTypePair column = getColumn(name);
+
+        if (column.type->isNullable())
+            throw Exception("Skip index cannot contain nullable columns", ErrorCodes::ILLEGAL_COLUMN);
+
+        columns_with_types.push_back(column);
+    }
+
+    if (columns_with_types.empty())
+        return;
+
+    skip_idx_expr = std::make_shared<ExpressionActions>(columns_with_types, context.getSettingsRef());
+    for (const NameAndTypePair & column : columns_with_types)
+    {
+        skip_idx_columns.emplace_back(column.name);
+        skip_idx_column_types.emplace_back(column.type);
+        skip_idx_sort_descr.emplace_back(column.name, 1, 1);
+    }
+}
+
+
+void MergeTreeData::initPartMinMaxStatistics()
+{
+    if (settings.part_minmax_expressions.empty())
+        return;
+
+    const String & list = settings.part_minmax_expressions;
+    ParserNotEmptyExpressionList parser(/* allow_alias_without_as_keyword = */ false);
+    ASTPtr expression_list = parseQuery(parser, list.data(), list.data() + list.size(), "part minmax expressions");
+
+    part_minmax_expr = ExpressionAnalyzer(expression_list, context, nullptr, getColumnsList()).getActions(false);
+
+    for (const ASTPtr & ast : expression_list->children)
+    {
+        String col_name = ast->getColumnName();
+        const ColumnWithTypeAndName & element = part_minmax_expr->getSampleBlock().getByName(col_name);
+
+        if (element.column && element.column->isConst())
+            throw Exception("Part minmax statistics cannot contain constants", ErrorCodes::ILLEGAL_COLUMN);
+        if (element.type->isNullable())
+            throw Exception("Part minmax statistics cannot contain nullable columns", ErrorCodes::ILLEGAL_COLUMN);
+
+        part_minmax_columns.emplace_back(col_name);
+        part_minmax_column_types.emplace_back(element.type);
+        part_minmax_sort_descr.emplace_back(col_name, 1, 1);
+    }
+}
+
+
+void MergeTreeData::initProjection()
+{
+    if (!projection_query)
+        return;
+
+    const auto & select = typeid_cast<const ASTSelectQuery &>(*projection_query);
+
+    if (select.table())
+        throw Exception("Projection query must not contain FROM: it is always computed over the rows of its part",
+            ErrorCodes::BAD_ARGUMENTS);
+    if (!select.group_expression_list)
+        throw Exception("Projection query must be an aggregating SELECT with GROUP BY", ErrorCodes::BAD_ARGUMENTS);
+    if (select.prewhere_expression || select.where_expression || select.having_expression
+        || select.order_expression_list || select.limit_by_expression_list || select.limit_length || select.distinct)
+        throw Exception("Projection query can consist only of a SELECT list and GROUP BY", ErrorCodes::BAD_ARGUMENTS);
+
+    projection_source_columns = ExpressionAnalyzer(projection_query->clone(), context, nullptr, getColumnsList())
+        .getRequiredColumns();
+}
+
+
+void MergeTreeData::buildProjection(const String & part_path, const BlockInputStreamPtr & source) const
+{
+    /// Execute the projection query over the part's rows up to the intermediate aggregation state,
+    ///  as for distributed query processing. The states are merged at query time,
+    ///  so aggregates over several parts (e.g. uniq) stay exact.
+    InterpreterSelectQuery interpreter(
+        projection_query->clone(), context, Names{}, getColumnsList(),
+        QueryProcessingStage::WithMergeableState, 0, source);
+
+    WriteBufferFromFile file_out(part_path + MergeTreeDataPart::PROJECTION_FILE_NAME);
+    CompressedWriteBuffer compressed_out(file_out);
+    NativeBlockOutputStream block_out(compressed_out);
+
+    BlockInputStreamPtr in = interpreter.execute().in;
+    copyData(*in, block_out);
+
+    compressed_out.next();
+    file_out.next();
+}
+
+
+void MergeTreeData::initDeltaCompression()
+{
+    auto parse = [this](const String & list, CompressionMethod method, const char * setting_name)
+    {
+        /// Parse the comma-separated list of columns from the setting.
+        size_t pos = 0;
+        while (pos < list.size())
+        {
+            size_t comma = list.find(',', pos);
+            if (comma == String::npos)
+                comma = list.size();
+
+            String name = list.substr(pos, comma - pos);
+            pos = comma + 1;
+
+            boost::algorithm::trim(name);
+            if (name.empty())
+                continue;
+
+            if (!hasColumn(name))
+                throw Exception(
+                    "Column " + name + " listed in " + setting_name + " setting doesn't exist in table",
+                    ErrorCodes::ILLEGAL_COLUMN);
+
+            NameAndTypePair column = getColumn(name);
+
+            if (!column.type->isNumeric() || column.type->isNullable())
+                throw Exception(
+                    "Column " + name + " listed in " + setting_name + " setting must be of a fixed-width numeric type",
+                    ErrorCodes::ILLEGAL_COLUMN);
+
+            delta_compressed_columns[name] = DeltaCompression{method, column.type->getSizeOfField()};
+        }
+    };
+
+    parse(settings.delta_compression_columns, CompressionMethod::Delta, "delta_compression_columns");
+    parse(settings.double_delta_compression_columns, CompressionMethod::DoubleDelta, "double_delta_compression_columns");
+
+    /// Parse the list of columns compressed with a per-part ZSTD dictionary the same way.
+    const String & list = settings.zstd_dictionary_columns;
+    size_t pos = 0;
+    while (pos < list.size())
+    {
+        size_t comma = list.find(',', pos);
+        if (comma == String::npos)
+            comma = list.size();
+
+        String name = list.substr(pos, comma - pos);
+        pos = comma + 1;
+
+        boost::algorithm::trim(name);
+        if (name.empty())
+            continue;
+
+        if (!hasColumn(name))
+            throw Exception(
+                "Column " + name + " listed in zstd_dictionary_columns setting doesn't exist in table",
+                ErrorCodes::ILLEGAL_COLUMN);
+
+        zstd_dictionary_columns.insert(name);
+    }
+}
+
+
+size_t MergeTreeData::chooseIndexGranularity(size_t sum_bytes, size_t sum_rows) const
+{
+    if (!settings.index_granularity_bytes || !sum_rows)
+        return index_granularity;
+
+    size_t avg_row_bytes = std::max<size_t>(1, sum_bytes / sum_rows);
+    size_t res = settings.index_granularity_bytes / avg_row_bytes;
+
+    if (res < 1)
+        res = 1;
+    if (res > index_granularity)
+        res = index_granularity;
+
+    return res;
+}
+
+
 void MergeTreeData::MergingParams::check(const NamesAndTypesList & columns) const
 {
     /// Check that if the sign column is needed, it exists and is of type Int8.
@@ -410,93 +632,108 @@ void MergeTreeData::loadDataParts(bool skip_sanity_checks)
     DataPartsVector broken_parts_to_detach;
     size_t suspicious_broken_parts = 0;
 
+    /// Parts are loaded and validated in parallel: with tens of thousands of parts sequential
+    ///  loading dominates the server startup time. The primary index is not read here at all -
+    ///  it is loaded lazily on first query (see MergeTreeDataPart::getIndex).
+    ThreadPool pool(std::max<size_t>(1, std::min(part_file_names.size(), settings.max_part_loading_threads)));
+    std::mutex loading_mutex; /// Protects the containers above from concurrent loading threads.
+
     for (const String & file_name : part_file_names)
     {
-        MergeTreePartInfo part_info;
-        if (!MergeTreePartInfo::tryParsePartName(file_name, &part_info, format_version))
-            continue;
-
-        MutableDataPartPtr part = std::make_shared<DataPart>(*this, file_name, part_info);
-        part->relative_path = file_name;
-        bool broken = false;
-
-        try
-        {
-            part->loadColumnsChecksumsIndexes(require_part_metadata, true);
-        }
-        catch (const Exception & e)
-        {
-            /// Don't count the part as broken if there is not enough memory to load it.
-            /// In fact, there can be many similar situations.
-            /// But it is OK, because there is a safety guard against deleting too many parts.
-            if (e.code() == ErrorCodes::MEMORY_LIMIT_EXCEEDED)
-                throw;
-
-            broken = true;
-            tryLogCurrentException(__PRETTY_FUNCTION__);
-        }
-        catch (...)
+        pool.schedule([&, file_name]
         {
-            broken = true;
-            tryLogCurrentException(__PRETTY_FUNCTION__);
-        }
+            MergeTreePartInfo part_info;
+            if (!MergeTreePartInfo::tryParsePartName(file_name, &part_info, format_version))
+                return;
 
-        /// Ignore and possibly delete broken parts that can appear as a result of hard server restart.
-        if (broken)
-        {
-            if (part->info.level == 0)
+            MutableDataPartPtr part = std::make_shared<DataPart>(*this, file_name, part_info);
+            part->relative_path = file_name;
+            bool broken = false;
+
+            try
             {
-                /// It is impossible to restore level 0 parts.
-                LOG_ERROR(log, "Considering to remove broken part " << full_path + file_name << " because it's impossible to repair.");
-                broken_parts_to_remove.push_back(part);
+                part->loadColumnsChecksumsIndexes(require_part_metadata, true);
             }
-            else
+            catch (const Exception & e)
             {
-                /// Count the number of parts covered by the broken part. If it is at least two, assume that
-                /// the broken part was created as a result of merging them and we won't lose data if we
-                /// delete it.
-                int contained_parts = 0;
-
-                LOG_ERROR(log, "Part " << full_path + file_name << " is broken. Looking for parts to replace it.");
+                /// Don't count the part as broken if there is not enough memory to load it.
+                /// In fact, there can be many similar situations.
+                /// But it is OK, because there is a safety guard against deleting too many parts.
+                if (e.code() == ErrorCodes::MEMORY_LIMIT_EXCEEDED)
+                    throw;
+
+                broken = true;
+                tryLogCurrentException(__PRETTY_FUNCTION__);
+            }
+            catch (...)
+            {
+                broken = true;
+                tryLogCurrentException(__PRETTY_FUNCTION__);
+            }
 
-                for (const String & contained_name : part_file_names)
+            /// Ignore and possibly delete broken parts that can appear as a result of hard server restart.
+            if (broken)
+            {
+                if (part->info.level == 0)
                 {
-                    if (contained_name == file_name)
-                        continue;
+                    /// It is impossible to restore level 0 parts.
+                    LOG_ERROR(log, "Considering to remove broken part " << full_path + file_name << " because it's impossible to repair.");
+                    std::lock_guard<std::mutex> lock(loading_mutex);
+                    broken_parts_to_remove.push_back(part);
+                }
+                else
+                {
+                    /// Count the number of parts covered by the broken part. If it is at least two, assume that
+                    /// the broken part was created as a result of merging them and we won't lose data if we
+                    /// delete it.
+                    int contained_parts = 0;
 
-                    MergeTreePartInfo contained_part_info;
-                    if (!MergeTreePartInfo::tryParsePartName(contained_name, &contained_part_info, format_version))
-                        continue;
+                    LOG_ERROR(log, "Part " << full_path + file_name << " is broken. Looking for parts to replace it.");
 
-                    if (part->info.contains(contained_part_info))
+                    for (const String & contained_name : part_file_names)
                     {
-                        LOG_ERROR(log, "Found part " << full_path + contained_name);
-                        ++contained_parts;
+                        if (contained_name == file_name)
+                            continue;
+
+                        MergeTreePartInfo contained_part_info;
+                        if (!MergeTreePartInfo::tryParsePartName(contained_name, &contained_part_info, format_version))
+                            continue;
+
+                        if (part->info.contains(contained_part_info))
+                        {
+                            LOG_ERROR(log, "Found part " << full_path + contained_name);
+                            ++contained_parts;
+                        }
                     }
-                }
 
-                if (contained_parts >= 2)
-                {
-                    LOG_ERROR(log, "Considering to remove broken part " << full_path + file_name << " because it covers at least 2 other parts");
-                    broken_parts_to_remove.push_back(part);
-                }
-                else
-                {
-                    LOG_ERROR(log, "Detaching broken part " << full_path + file_name
-                        << " because it covers less than 2 parts. You need to resolve this manually");
-                    broken_parts_to_detach.push_back(part);
-                    ++suspicious_broken_parts;
+                    if (contained_parts >= 2)
+                    {
+                        LOG_ERROR(log, "Considering to remove broken part " << full_path + file_name << " because it covers at least 2 other parts");
+                        std::lock_guard<std::mutex> lock(loading_mutex);
+                        broken_parts_to_remove.push_back(part);
+                    }
+                    else
+                    {
+                        LOG_ERROR(log, "Detaching broken part " << full_path + file_name
+                            << " because it covers less than 2 parts. You need to resolve this manually");
+                        std::lock_guard<std::mutex> lock(loading_mutex);
+                        broken_parts_to_detach.push_back(part);
+                        ++suspicious_broken_parts;
+                    }
                 }
-            }
 
-            continue;
-        }
+                return;
+            }
 
-        part->modification_time = Poco::File(full_path + file_name).getLastModified().epochTime();
+            part->modification_time = Poco::File(full_path + file_name).getLastModified().epochTime();
 
-        data_parts.insert(part);
+            std::lock_guard<std::mutex> lock(loading_mutex);
+            data_parts.insert(part);
+        });
     }
 
+    pool.wait();
+
     if (suspicious_broken_parts > settings.max_suspicious_broken_parts && !skip_sanity_checks)
         throw Exception("Suspiciously many (" + toString(suspicious_broken_parts) + ") broken parts to remove.",
             ErrorCodes::TOO_MANY_UNEXPECTED_DATA_PARTS);
@@ -655,8 +892,115 @@ void MergeTreeData::clearOldParts()
     for (const DataPartPtr & part : parts_to_remove)
     {
         LOG_DEBUG(log, "Removing part " << part->name);
-        part->remove();
+
+        if (settings.background_part_removal_files_per_second)
+        {
+            /// Only the O(1) rename is done here; the unlink storm that would stall concurrent
+            ///  fsyncs is spread over time by the reaper thread.
+            String path = part->renameForRemoval();
+            if (!path.empty())
+                enqueuePartRemoval(path);
+        }
+        else
+            part->remove();
+    }
+}
+
+
+MergeTreeData::~MergeTreeData()
+{
+    {
+        std::lock_guard<std::mutex> lock(part_removal_mutex);
+        part_removal_shutdown = true;
+    }
+    part_removal_cond.notify_all();
+
+    if (part_removal_thread.joinable())
+        part_removal_thread.join();
+}
+
+
+void MergeTreeData::enqueuePartRemoval(const String & path)
+{
+    std::lock_guard<std::mutex> lock(part_removal_mutex);
+
+    part_removal_queue.push_back(path);
+
+    if (!part_removal_thread.joinable())
+        part_removal_thread = std::thread([this] { partRemovalThread(); });
+
+    part_removal_cond.notify_one();
+}
+
+
+void MergeTreeData::partRemovalThread()
+{
+    while (true)
+    {
+        String path;
+
+        {
+            std::unique_lock<std::mutex> lock(part_removal_mutex);
+            part_removal_cond.wait(lock, [this] { return part_removal_shutdown || !part_removal_queue.empty(); });
+
+            if (part_removal_shutdown)
+                return;
+
+            path = part_removal_queue.front();
+            part_removal_queue.pop_front();
+        }
+
+        try
+        {
+            removePartFilesThrottled(path);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Cannot remove " + path);
+        }
+    }
+}
+
+
+void MergeTreeData::removePartFilesThrottled(const String & path)
+{
+    Throttler throttler(settings.background_part_removal_files_per_second, 0, "");
+
+    std::vector<std::string> files;
+    Poco::File(path).list(files);
+
+    int dir_fd = ::open(path.c_str(), O_DIRECTORY);
+    size_t unlinked_in_batch = 0;
+
+    for (const auto & file_name : files)
+    {
+        if (part_removal_shutdown)
+            break;
+
+        String file_path = path + "/" + file_name;
+
+        if (0 != ::unlink(file_path.c_str()))
+            Poco::File(file_path).remove(true);    /// A nested directory, or a better error message.
+
+        /// The metadata of the unlinks is flushed in batches, so that the journal commits caused
+        ///  by concurrent fsyncs do not have to write it out one file at a time.
+        if (++unlinked_in_batch >= settings.background_part_removal_fsync_batch && dir_fd >= 0)
+        {
+            ::fsync(dir_fd);
+            unlinked_in_batch = 0;
+        }
+
+        throttler.add(1);
+    }
+
+    if (dir_fd >= 0)
+    {
+        ::fsync(dir_fd);
+        ::close(dir_fd);
     }
+
+    /// Whatever is left (normally just the empty directory).
+    Poco::File(path).remove(true);
 }
 
 void MergeTreeData::setPath(const String & new_full_path, bool move_data)
@@ -1004,6 +1348,14 @@ MergeTreeData::AlterDataPartTransactionPtr MergeTreeData::alterDataPart(
     bool force_update_metadata;
     createConvertExpression(part, part->columns, new_columns, expression, transaction->rename_map, force_update_metadata);
 
+    /// ALTER rewrites individual column files, which do not exist in compact parts.
+    /// Such parts are transient (merges rewrite them in the wide format), so this is not implemented.
+    if (part->isCompactFormat() && !transaction->rename_map.empty())
+        throw Exception(
+            "ALTER of part " + part->name + " is not supported: the part is stored in the compact format."
+            " Run OPTIMIZE TABLE to rewrite it in the wide format first.",
+            ErrorCodes::NOT_IMPLEMENTED);
+
     size_t num_files_to_modify = transaction->rename_map.size();
     size_t num_files_to_remove = 0;
 
@@ -1084,7 +1436,8 @@ MergeTreeData::AlterDataPartTransactionPtr MergeTreeData::alterDataPart(
                 if (position_of_existing_column < prev_position_of_existing_column)
                     throw Exception("Permuting of columns of primary key is not supported", ErrorCodes::BAD_ARGUMENTS);
 
-                new_index[i] = part->index.at(position_of_existing_column);
+                new_index[i] = part->getIndex().materializeColumn(
+                    position_of_existing_column, primary_key_sample.safeGetByPosition(position_of_existing_column).type);
                 prev_position_of_existing_column = position_of_existing_column;
             }
             else
@@ -1124,7 +1477,7 @@ MergeTreeData::AlterDataPartTransactionPtr MergeTreeData::alterDataPart(
         MarkRanges ranges{MarkRange(0, part->size)};
         BlockInputStreamPtr part_in = std::make_shared<MergeTreeBlockInputStream>(
             *this, part, DEFAULT_MERGE_BLOCK_SIZE, 0, 0, expression->getRequiredColumns(), ranges,
-            false, nullptr, "", false, 0, DBMS_DEFAULT_BUFFER_SIZE, false);
+            false, nullptr, "", false, 0, 0, DBMS_DEFAULT_BUFFER_SIZE, false);
 
         auto compression_method = this->context.chooseCompressionMethod(
             part->size_in_bytes,
@@ -1138,7 +1491,8 @@ MergeTreeData::AlterDataPartTransactionPtr MergeTreeData::alterDataPart(
           *  temporary column name ('converting_column_name') created in 'createConvertExpression' method
           *  will have old name of shared offsets for arrays.
           */
-        MergedColumnOnlyOutputStream out(*this, full_path + part->name + '/', true, compression_method, true /* skip_offsets */);
+        MergedColumnOnlyOutputStream out(
+            *this, full_path + part->name + '/', true, compression_method, true /* skip_offsets */, part->index_granularity);
 
         in.readPrefix();
         out.writePrefix();
@@ -1289,14 +1643,32 @@ void MergeTreeData::renameTempPartAndAdd(MutableDataPartPtr & part, SimpleIncrem
 
 MergeTreeData::DataPartsVector MergeTreeData::renameTempPartAndReplace(
     MutableDataPartPtr & part, SimpleIncrement * increment, Transaction * out_transaction)
+{
+    std::lock_guard<std::mutex> lock(data_parts_mutex);
+    return renameTempPartAndReplaceImpl(part, increment, out_transaction, lock);
+}
+
+void MergeTreeData::renameTempPartsAndAdd(std::vector<MutableDataPartPtr> & parts, SimpleIncrement * increment)
+{
+    std::lock_guard<std::mutex> lock(data_parts_mutex);
+    for (auto & part : parts)
+    {
+        DataPartsVector removed = renameTempPartAndReplaceImpl(part, increment, nullptr, lock);
+        if (!removed.empty())
+            throw Exception("Added part " + part->name + " covers " + toString(removed.size())
+                + " existing part(s) (including " + removed[0]->name + ")", ErrorCodes::LOGICAL_ERROR);
+    }
+}
+
+MergeTreeData::DataPartsVector MergeTreeData::renameTempPartAndReplaceImpl(
+    MutableDataPartPtr & part, SimpleIncrement * increment, Transaction * out_transaction,
+    std::lock_guard<std::mutex> & lock)
 {
     if (out_transaction && out_transaction->data)
         throw Exception("Using the same MergeTreeData::Transaction for overlapping transactions is invalid", ErrorCodes::LOGICAL_ERROR);
 
     DataPartsVector replaced;
     {
-        std::lock_guard<std::mutex> lock(data_parts_mutex);
-
         if (DataPartPtr existing_part_in_partition = getAnyPartInPartition(part->info.partition_id, lock))
         {
             if (part->partition.value != existing_part_in_partition->partition.value)
@@ -1401,6 +1773,48 @@ MergeTreeData::DataPartsVector MergeTreeData::renameTempPartAndReplace(
     return replaced;
 }
 
+bool MergeTreeData::hasSameStructureAs(const MergeTreeData & other) const
+{
+    auto ast_to_str = [](const ASTPtr & ast) { return ast ? queryToString(ast) : String{}; };
+
+    /// NOTE Graphite parameters are not compared, so Graphite tables are never considered equal.
+    return format_version == other.format_version
+        && index_granularity == other.index_granularity
+        && merging_params.mode == other.merging_params.mode
+        && merging_params.mode != MergingParams::Graphite
+        && merging_params.sign_column == other.merging_params.sign_column
+        && merging_params.columns_to_sum == other.merging_params.columns_to_sum
+        && merging_params.version_column == other.merging_params.version_column
+        && ast_to_str(primary_expr_ast) == ast_to_str(other.primary_expr_ast)
+        && ast_to_str(partition_expr_ast) == ast_to_str(other.partition_expr_ast)
+        && ast_to_str(sampling_expression) == ast_to_str(other.sampling_expression)
+        && *columns == *other.columns
+        && materialized_columns == other.materialized_columns
+        && alias_columns == other.alias_columns
+        && column_defaults == other.column_defaults;
+}
+
+MergeTreeData::MutableDataPartPtr MergeTreeData::cloneAndLoadDataPart(const DataPartPtr & src_part)
+{
+    static const String TMP_PREFIX = "tmp_clone_";
+    String relative_dst_path = TMP_PREFIX + src_part->name;
+    String absolute_dst_path = full_path + relative_dst_path;
+
+    if (Poco::File(absolute_dst_path).exists())
+        throw Exception("Directory " + absolute_dst_path + " already exists.", ErrorCodes::DIRECTORY_ALREADY_EXISTS);
+
+    LOG_DEBUG(log, "Cloning part " << src_part->getFullPath() << " to " << absolute_dst_path);
+    Poco::File(src_part->getFullPath()).copyTo(absolute_dst_path);
+
+    MutableDataPartPtr dst_part = std::make_shared<DataPart>(*this, src_part->name);
+    dst_part->relative_path = relative_dst_path;
+    dst_part->is_temp = true;
+    dst_part->modification_time = time(nullptr);
+    dst_part->loadColumnsChecksumsIndexes(require_part_metadata, true);
+
+    return dst_part;
+}
+
 void MergeTreeData::replaceParts(const DataPartsVector & remove, const DataPartsVector & add, bool clear_without_timeout)
 {
     std::lock_guard<std::mutex> lock(data_parts_mutex);
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <deque>
+#include <thread>
+#include <condition_variable>
 #include <Core/SortDescription.h>
 #include <Common/SimpleIncrement.h>
 #include <Interpreters/Context.h>
@@ -8,6 +11,7 @@
 #include <Storages/MergeTree/MergeTreePartInfo.h>
 #include <Storages/MergeTree/MergeTreeSettings.h>
 #include <IO/ReadBufferFromString.h>
+#include <IO/CompressedStream.h>
 #include <IO/WriteBufferFromFile.h>
 #include <IO/ReadBufferFromFile.h>
 #include <DataTypes/DataTypeString.h>
@@ -249,6 +253,8 @@ public:
                     const String & date_column_name,
                     const ASTPtr & partition_expr_ast_,
                     const ASTPtr & sampling_expression_, /// nullptr, if sampling is not supported.
+                    const ASTPtr & ttl_expression_, /// nullptr, if rows do not expire.
+                    const ASTPtr & projection_query_, /// nullptr, if the table has no projection.
                     size_t index_granularity_,
                     const MergingParams & merging_params_,
                     const MergeTreeSettings & settings_,
@@ -259,12 +265,16 @@ public:
                     PartsCleanCallback parts_clean_callback_ = nullptr
                  );
 
+    ~MergeTreeData();
+
     /// Load the set of data parts from disk. Call once - immediately after the object is created.
     void loadDataParts(bool skip_sanity_checks);
 
     bool supportsSampling() const { return !!sampling_expression; }
     bool supportsPrewhere() const { return true; }
 
+    ASTPtr getTTLExpression() const override { return ttl_expression; }
+
     bool supportsFinal() const
     {
         return merging_params.mode == MergingParams::Collapsing
@@ -338,6 +348,20 @@ public:
     DataPartsVector renameTempPartAndReplace(
         MutableDataPartPtr & part, SimpleIncrement * increment = nullptr, Transaction * out_transaction = nullptr);
 
+    /// The same as renameTempPartAndAdd for several parts, taking the lock on the set of
+    /// parts only once. Used by ATTACH PART/PARTITION when restoring many parts at once.
+    void renameTempPartsAndAdd(std::vector<MutableDataPartPtr> & parts, SimpleIncrement * increment = nullptr);
+
+    /// Returns true if the other table has exactly the same on-disk data layout: same columns,
+    /// sort, partition and sampling expressions, merging mode and index granularity.
+    /// Parts of such a table can be adopted at the file level (see cloneAndLoadDataPart).
+    bool hasSameStructureAs(const MergeTreeData & other) const;
+
+    /// Copies the files of a part belonging to another table with the same structure (see above)
+    /// into a tmp_clone_ directory inside this table's path and loads it as a temporary part.
+    /// The caller is expected to pass the result to renameTempPartAndAdd.
+    MutableDataPartPtr cloneAndLoadDataPart(const DataPartPtr & src_part);
+
     /// Removes from the working set parts in remove and adds parts in add. Parts in add must already be in
     /// all_data_parts.
     /// If clear_without_timeout is true, the parts will be deleted at once, or during the next call to
@@ -366,6 +390,12 @@ public:
     /// Set non-negative parameter value to override MergeTreeSettings temporary_directories_lifetime
     void clearOldTemporaryDirectories(ssize_t custom_directories_lifetime_seconds = -1);
 
+    /// Hand a renamed-out part directory (see MergeTreeDataPart::renameForRemoval) to the reaper
+    ///  thread, which unlinks its files at the pace of background_part_removal_files_per_second.
+    /// Directories left in the queue at shutdown are removed on the next start together with the
+    ///  other "tmp" directories.
+    void enqueuePartRemoval(const String & path);
+
     /// After the call to dropAllData() no method can be called.
     /// Deletes the data directory and flushes the uncompressed blocks cache and the marks cache.
     void dropAllData();
@@ -408,7 +438,7 @@ public:
     }
 
     ExpressionActionsPtr getPrimaryExpression() const { return primary_expr; }
-    SortDescription getSortDescription() const { return sort_descr; }
+    const SortDescription & getSortDescription() const { return sort_descr; }
 
     /// Check that the part is not broken and calculate the checksums for it if they are not present.
     MutableDataPartPtr loadPartAndFixMetadata(const String & relative_path);
@@ -467,6 +497,23 @@ public:
         calculateColumnSizesImpl();
     }
 
+    /** Cumulative number of uncompressed bytes read from each column of this table since server startup.
+      * Collected by MergeTreeReader; exposed in the system.parts_columns table,
+      *  so that compression tuning can be targeted at the columns that are actually read.
+      */
+    void addColumnReadBytes(const std::string & name, size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock{column_read_bytes_mutex};
+        column_read_bytes[name] += bytes;
+    }
+
+    using ColumnReadBytes = std::unordered_map<std::string, size_t>;
+    ColumnReadBytes getColumnReadBytes() const
+    {
+        std::lock_guard<std::mutex> lock{column_read_bytes_mutex};
+        return column_read_bytes;
+    }
+
     /// For ATTACH/DETACH/DROP/RESHARD PARTITION.
     String getPartitionIDFromQuery(const ASTPtr & partition, const Context & context);
 
@@ -474,8 +521,25 @@ public:
 
     Context & context;
     const ASTPtr sampling_expression;
+    /// Rows for which this expression evaluates to a time point in the past are dropped during merges.
+    const ASTPtr ttl_expression;
+    /// Aggregating SELECT (without FROM) maintained as a secondary representation of every part.
+    /// Its result with mergeable aggregation states is stored in the part (see MergeTreeDataPart::PROJECTION_FILE_NAME)
+    ///  and matching aggregate queries are answered from it without touching the raw data.
+    const ASTPtr projection_query;
+    /// Source columns the projection query reads.
+    Names projection_source_columns;
     const size_t index_granularity;
 
+    /// Runs the projection query over `source` and writes the resulting blocks
+    ///  with mergeable aggregation states to `part_path`.
+    void buildProjection(const String & part_path, const BlockInputStreamPtr & source) const;
+
+    /// Returns the number of rows per mark for a new part holding approximately `sum_rows` rows
+    ///  taking `sum_bytes` uncompressed bytes. With the index_granularity_bytes setting the value
+    ///  is chosen so that a granule stays under the byte bound; otherwise it is index_granularity.
+    size_t chooseIndexGranularity(size_t sum_bytes, size_t sum_rows) const;
+
     /// Merging params - what additional actions to perform during merge.
     const MergingParams merging_params;
 
@@ -496,6 +560,33 @@ public:
     Int64 minmax_idx_date_column_pos = -1; /// In a common case minmax index includes a date column.
     SortDescription minmax_idx_sort_descr; /// For use with PKCondition.
 
+    /// Data skipping index over columns from the `skip_index_columns` setting (see MergeTreeDataPart::SkipIndex).
+    ExpressionActionsPtr skip_idx_expr;
+    Names skip_idx_columns;
+    DataTypes skip_idx_column_types;
+    SortDescription skip_idx_sort_descr; /// For use with PKCondition.
+
+    /// Per-part min/max statistics over the expressions from the `part_minmax_expressions` setting.
+    /// Allows pruning whole parts before any mark is read, like the minmax index of the partition key,
+    ///  but for arbitrary expressions (e.g. an event_time DateTime column).
+    ExpressionActionsPtr part_minmax_expr;
+    Names part_minmax_columns;
+    DataTypes part_minmax_column_types;
+    SortDescription part_minmax_sort_descr; /// For use with PKCondition.
+
+    /// Per-column compression pre-transform (see the delta_compression_columns and
+    /// double_delta_compression_columns settings). Column name -> method and element width.
+    struct DeltaCompression
+    {
+        CompressionMethod method;
+        size_t width;
+    };
+    std::map<String, DeltaCompression> delta_compressed_columns;
+
+    /// Columns whose data files are compressed with a per-part ZSTD dictionary
+    /// (see the zstd_dictionary_columns setting).
+    NameSet zstd_dictionary_columns;
+
     /// Limiting parallel sends per one table, used in DataPartsExchange
     std::atomic_uint current_table_sends {0};
 
@@ -540,11 +631,26 @@ private:
     DataParts all_data_parts;
     mutable std::mutex all_data_parts_mutex;
 
+    /// See addColumnReadBytes.
+    mutable std::mutex column_read_bytes_mutex;
+    ColumnReadBytes column_read_bytes;
+
     /// Used to serialize calls to grabOldParts.
     std::mutex grab_old_parts_mutex;
     /// The same for clearOldTemporaryDirectories.
     std::mutex clear_old_temporary_directories_mutex;
 
+    /// Rate-limited background removal of part files (see enqueuePartRemoval).
+    /// The thread is started lazily when the first directory is enqueued.
+    std::thread part_removal_thread;
+    std::mutex part_removal_mutex;
+    std::condition_variable part_removal_cond;
+    std::deque<String> part_removal_queue;
+    std::atomic<bool> part_removal_shutdown {false};
+
+    void partRemovalThread();
+    void removePartFilesThrottled(const String & path);
+
     /// For each shard of the set of sharded parts.
     PerShardDataParts per_shard_data_parts;
 
@@ -557,6 +663,14 @@ private:
 
     void initPartitionKey();
 
+    void initSkipIndex();
+
+    void initPartMinMaxStatistics();
+
+    void initProjection();
+
+    void initDeltaCompression();
+
     /// Expression for column type conversion.
     /// If no conversions are needed, out_expression=nullptr.
     /// out_rename_map maps column files for the out_expression onto new table files.
@@ -575,6 +689,11 @@ private:
 
     /// If there is no part in the partition with ID `partition_id`, returns empty ptr.
     DataPartPtr getAnyPartInPartition(const String & partition_id, std::lock_guard<std::mutex> & data_parts_lock);
+
+    /// The body of renameTempPartAndReplace; the caller must be holding data_parts_mutex.
+    DataPartsVector renameTempPartAndReplaceImpl(
+        MutableDataPartPtr & part, SimpleIncrement * increment, Transaction * out_transaction,
+        std::lock_guard<std::mutex> & data_parts_lock);
 };
 
 }
@@ -7,6 +7,7 @@
 #include <Storages/MergeTree/SimpleMergeSelector.h>
 #include <Storages/MergeTree/AllMergeSelector.h>
 #include <Storages/MergeTree/MergeList.h>
+#include <Storages/MergeTree/MergeScheduler.h>
 #include <DataStreams/DistinctSortedBlockInputStream.h>
 #include <DataStreams/ExpressionBlockInputStream.h>
 #include <DataStreams/MergingSortedBlockInputStream.h>
@@ -18,10 +19,15 @@
 #include <DataStreams/MaterializingBlockInputStream.h>
 #include <DataStreams/ConcatBlockInputStream.h>
 #include <DataStreams/ColumnGathererStream.h>
+#include <DataStreams/FilterBlockInputStream.h>
+#include <Interpreters/ExpressionAnalyzer.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTLiteral.h>
 #include <IO/CompressedWriteBuffer.h>
 #include <IO/CompressedReadBufferFromFile.h>
 #include <DataTypes/DataTypeNested.h>
 #include <DataTypes/DataTypeArray.h>
+#include <Common/StringUtils.h>
 #include <Storages/MergeTree/BackgroundProcessingPool.h>
 #include <Common/SimpleIncrement.h>
 #include <Common/interpolate.h>
@@ -226,12 +232,55 @@ bool MergeTreeDataMerger::selectPartsToMerge(
 }
 
 
+namespace
+{
+
+/// Primary key of the part's first row: the first entry of the primary index.
+Row firstPrimaryKey(const MergeTreeData::DataPartPtr & part)
+{
+    const MergeTreeDataPart::Index & index = part->getIndex();
+
+    Row key(index.size());
+    for (size_t i = 0; i < index.size(); ++i)
+        index.get(i, 0, key[i]);
+    return key;
+}
+
+/// Primary key of the part's last row. The index holds only the key of the first row
+///  of each granule, so the last granule has to be read. Returns an empty row
+///  if the key could not be determined (e.g. all rows of the last granule are masked as deleted).
+Row lastPrimaryKey(MergeTreeData & data, const MergeTreeData::DataPartPtr & part)
+{
+    MergeTreeBlockInputStream stream(
+        data, part, data.index_granularity, 0, 0, data.getPrimaryExpression()->getRequiredColumns(),
+        MarkRanges(1, MarkRange(part->size - 1, part->size)), false, nullptr, "", true,
+        0, 0, DBMS_DEFAULT_BUFFER_SIZE, false, Names{}, 0, true);
+
+    Block last_block;
+    while (Block block = stream.read())
+        last_block = std::move(block);
+
+    if (!last_block)
+        return {};
+
+    data.getPrimaryExpression()->execute(last_block);
+
+    SortDescription sort_descr = data.getSortDescription();
+    Row key(sort_descr.size());
+    for (size_t i = 0; i < sort_descr.size(); ++i)
+        last_block.getByName(sort_descr[i].column_name).column->get(last_block.rows() - 1, key[i]);
+    return key;
+}
+
+}
+
 bool MergeTreeDataMerger::selectAllPartsToMergeWithinPartition(
     FuturePart & future_part,
     size_t available_disk_space,
     const AllowedMergingPredicate & can_merge,
     const String & partition_id,
-    bool final)
+    bool final,
+    bool deduplicate)
 {
     MergeTreeData::DataPartsVector parts = selectAllPartsFromPartition(partition_id);
 
@@ -241,6 +290,62 @@ bool MergeTreeDataMerger::selectAllPartsToMergeWithinPartition(
     if (!final && parts.size() == 1)
         return false;
 
+    /// When merging for FINAL, leave out parts that the merge cannot affect: a part whose
+    ///  primary key range does not intersect the range of any other part has nothing
+    ///  to collapse or sum against. Merged parts must stay contiguous in block number order,
+    ///  so only such parts at the edges of the partition can be dropped from the selection.
+    /// DEDUPLICATE may still eliminate rows inside a single part, so it disables this.
+    if (final && !deduplicate && parts.size() > 1
+        && data.merging_params.mode != MergeTreeData::MergingParams::Unsorted)
+    {
+        std::vector<Row> min_keys(parts.size());
+        std::vector<Row> max_keys(parts.size());
+        for (size_t i = 0; i < parts.size(); ++i)
+        {
+            min_keys[i] = firstPrimaryKey(parts[i]);
+            max_keys[i] = lastPrimaryKey(data, parts[i]);
+        }
+
+        auto may_be_affected_by_merge = [&](size_t i)
+        {
+            /// Rows of a part that never went through a merge may collapse among themselves.
+            if (data.merging_params.mode != MergeTreeData::MergingParams::Ordinary && parts[i]->info.level == 0)
+                return true;
+
+            if (max_keys[i].empty())
+                return true;
+
+            for (size_t j = 0; j < parts.size(); ++j)
+                if (j != i && (max_keys[j].empty()
+                    || !(max_keys[i] < min_keys[j] || max_keys[j] < min_keys[i])))
+                    return true;
+
+            return false;
+        };
+
+        size_t first = 0;
+        while (first < parts.size() && !may_be_affected_by_merge(first))
+            ++first;
+
+        if (first == parts.size())
+        {
+            LOG_DEBUG(log, "Not merging partition " << partition_id
+                << " for FINAL: no two parts have intersecting primary key ranges");
+            return false;
+        }
+
+        size_t last = parts.size();
+        while (last > first + 1 && !may_be_affected_by_merge(last - 1))
+            --last;
+
+        if (first > 0 || last < parts.size())
+        {
+            LOG_DEBUG(log, "Leaving " << (first + (parts.size() - last)) << " of " << parts.size()
+                << " parts out of the FINAL merge: their primary key ranges intersect no other part");
+            parts = MergeTreeData::DataPartsVector(parts.begin() + first, parts.begin() + last);
+        }
+    }
+
     MergeTreeData::DataPartsVector::const_iterator it = parts.begin();
     MergeTreeData::DataPartsVector::const_iterator prev_it = it;
 
@@ -319,7 +424,33 @@ static void extractMergingAndGatheringColumns(const NamesAndTypesList & all_colu
     if (merging_params.mode == MergeTreeData::MergingParams::Replacing)
         key_columns.emplace(merging_params.version_column);
 
-    /// TODO: also force "summing" and "aggregating" columns to make Horizontal merge only for such columns
+    /// Force the columns that a Summing merge may modify, so that only untouched columns are gathered.
+    /// The set is a superset of what SummingSortedBlockInputStream will actually sum: forcing too much
+    ///  is always correct, it only means less work for the gathering step.
+    if (merging_params.mode == MergeTreeData::MergingParams::Summing)
+    {
+        for (const auto & column : all_columns)
+        {
+            if (typeid_cast<const DataTypeArray *>(column.type.get()))
+            {
+                /// Arrays of nested tables with the `Map` suffix may be summed as maps (see SummingSortedBlockInputStream).
+                const auto map_name = DataTypeNested::extractNestedTableName(column.name);
+                if (map_name != column.name && endsWith(map_name, "Map"))
+                    key_columns.emplace(column.name);
+            }
+            else if (column.type->isNumeric()
+                && column.type->getName() != "Date"
+                && column.type->getName() != "DateTime"
+                && (merging_params.columns_to_sum.empty()
+                    || merging_params.columns_to_sum.end() != std::find(
+                        merging_params.columns_to_sum.begin(), merging_params.columns_to_sum.end(), column.name)))
+            {
+                key_columns.emplace(column.name);
+            }
+        }
+    }
+
+    /// TODO: also force "aggregating" columns to make Horizontal merge only for such columns
 
     for (auto & column : all_columns)
     {
@@ -401,12 +532,13 @@ public:
 class MergeProgressCallback
 {
 public:
-    MergeProgressCallback(MergeList::Entry & merge_entry_, UInt64 & watch_prev_elapsed_)
-    : merge_entry(merge_entry_), watch_prev_elapsed(watch_prev_elapsed_) {}
+    MergeProgressCallback(MergeList::Entry & merge_entry_, UInt64 & watch_prev_elapsed_, MergeScheduler * merge_scheduler_ = nullptr)
+    : merge_entry(merge_entry_), watch_prev_elapsed(watch_prev_elapsed_), merge_scheduler(merge_scheduler_) {}
 
     MergeProgressCallback(MergeList::Entry & merge_entry_, size_t num_total_rows, const ColumnSizeEstimator & column_sizes,
-        UInt64 & watch_prev_elapsed_, MergeTreeDataMerger::MergeAlgorithm merge_alg_ = MergeAlgorithm::Vertical)
-    : merge_entry(merge_entry_), watch_prev_elapsed(watch_prev_elapsed_), merge_alg(merge_alg_)
+        UInt64 & watch_prev_elapsed_, MergeTreeDataMerger::MergeAlgorithm merge_alg_ = MergeAlgorithm::Vertical,
+        MergeScheduler * merge_scheduler_ = nullptr)
+    : merge_entry(merge_entry_), watch_prev_elapsed(watch_prev_elapsed_), merge_alg(merge_alg_), merge_scheduler(merge_scheduler_)
     {
         average_elem_progress = (merge_alg == MergeAlgorithm::Horizontal)
             ? 1.0 / num_total_rows
@@ -419,6 +551,7 @@ public:
     UInt64 & watch_prev_elapsed;
     Float64 average_elem_progress;
     const MergeAlgorithm merge_alg{MergeAlgorithm::Vertical};
+    MergeScheduler * merge_scheduler = nullptr;
 
     void updateWatch()
     {
@@ -436,6 +569,9 @@ public:
         merge_entry->bytes_read_uncompressed += value.bytes;
         merge_entry->rows_read += value.rows;
         merge_entry->progress = average_elem_progress * merge_entry->rows_read;
+
+        if (merge_scheduler)
+            merge_scheduler->throttleRead(value.bytes);
     };
 };
 
@@ -447,8 +583,9 @@ class MergeProgressCallbackVerticalStep : public MergeProgressCallback
 public:
 
     MergeProgressCallbackVerticalStep(MergeList::Entry & merge_entry_, size_t num_total_rows_exact,
-        const ColumnSizeEstimator & column_sizes, const String & column_name, UInt64 & watch_prev_elapsed_)
-    : MergeProgressCallback(merge_entry_, watch_prev_elapsed_), initial_progress(merge_entry->progress)
+        const ColumnSizeEstimator & column_sizes, const String & column_name, UInt64 & watch_prev_elapsed_,
+        MergeScheduler * merge_scheduler_ = nullptr)
+    : MergeProgressCallback(merge_entry_, watch_prev_elapsed_, merge_scheduler_), initial_progress(merge_entry->progress)
     {
         average_elem_progress = column_sizes.columnProgress(column_name, 1, num_total_rows_exact);
         updateWatch();
@@ -466,6 +603,9 @@ public:
         rows_read_internal += value.rows;
         Float64 local_progress = average_elem_progress * rows_read_internal;
         merge_entry->progress = initial_progress + local_progress;
+
+        if (merge_scheduler)
+            merge_scheduler->throttleRead(value.bytes);
     };
 };
 
@@ -500,6 +640,21 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
         merge_entry->total_size_marks += part->size;
     }
 
+    /// A single large merge can evict the entire hot working set from the page cache.
+    /// Route its reads and writes through O_DIRECT, leaving the cache to readers.
+    if (data.settings.min_merge_bytes_to_use_direct_io != 0)
+    {
+        size_t total_size = 0;
+        for (const MergeTreeData::DataPartPtr & part : parts)
+            total_size += part->size_in_bytes;
+
+        if (total_size >= data.settings.min_merge_bytes_to_use_direct_io)
+        {
+            LOG_DEBUG(log, "Will merge parts reading and writing files with O_DIRECT");
+            aio_threshold = 1;
+        }
+    }
+
     MergeTreeData::DataPart::ColumnToSize merged_column_to_size;
     for (const MergeTreeData::DataPartPtr & part : parts)
         part->accumulateColumnSizes(merged_column_to_size);
@@ -519,7 +674,17 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
     new_data_part->relative_path = TMP_PREFIX + future_part.name;
     new_data_part->is_temp = true;
 
-    size_t sum_input_rows_upper_bound = merge_entry->total_size_marks * data.index_granularity;
+    size_t sum_input_rows_upper_bound = 0;
+    size_t sum_input_bytes_uncompressed = 0;
+    for (const MergeTreeData::DataPartPtr & part : parts)
+    {
+        sum_input_rows_upper_bound += part->size * part->index_granularity;
+        for (const NameAndTypePair & column : part->columns)
+            sum_input_bytes_uncompressed += part->getColumnUncompressedSize(column.name);
+    }
+
+    /// Granularity of the merged part (matters with the index_granularity_bytes setting).
+    size_t merged_index_granularity = data.chooseIndexGranularity(sum_input_bytes_uncompressed, sum_input_rows_upper_bound);
 
     MergeAlgorithm merge_alg = chooseMergeAlgorithm(data, parts, sum_input_rows_upper_bound, gathering_columns, deduplicate);
 
@@ -556,10 +721,11 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
     {
         auto input = std::make_unique<MergeTreeBlockInputStream>(
             data, part, DEFAULT_MERGE_BLOCK_SIZE, 0, 0, merging_column_names, MarkRanges(1, MarkRange(0, part->size)),
-            false, nullptr, "", true, aio_threshold, DBMS_DEFAULT_BUFFER_SIZE, false);
+            false, nullptr, "", true, aio_threshold, 0, DBMS_DEFAULT_BUFFER_SIZE, false);
 
         input->setProgressCallback(MergeProgressCallback(
-                merge_entry, sum_input_rows_upper_bound, column_sizes, watch_prev_elapsed, merge_alg));
+                merge_entry, sum_input_rows_upper_bound, column_sizes, watch_prev_elapsed, merge_alg,
+                &data.context.getMergeScheduler()));
 
         if (data.merging_params.mode != MergeTreeData::MergingParams::Unsorted)
             src_streams.emplace_back(std::make_shared<MaterializingBlockInputStream>(
@@ -587,7 +753,7 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
 
         case MergeTreeData::MergingParams::Summing:
             merged_stream = std::make_unique<SummingSortedBlockInputStream>(
-                src_streams, sort_desc, data.merging_params.columns_to_sum, DEFAULT_MERGE_BLOCK_SIZE);
+                src_streams, sort_desc, data.merging_params.columns_to_sum, DEFAULT_MERGE_BLOCK_SIZE, rows_sources_write_buf.get());
             break;
 
         case MergeTreeData::MergingParams::Aggregating:
@@ -617,12 +783,26 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
     if (deduplicate && merged_stream->isGroupedOutput())
         merged_stream = std::make_shared<DistinctSortedBlockInputStream>(merged_stream, Limits(), 0 /*limit_hint*/, Names());
 
+    /// Drop expired rows: keep only those for which the TTL expression is still in the future.
+    if (data.ttl_expression)
+    {
+        ASTPtr condition = makeASTFunction("greater",
+            data.ttl_expression->clone(),
+            std::make_shared<ASTLiteral>(StringRange(), Field(static_cast<UInt64>(time_of_merge))));
+
+        ExpressionActionsPtr condition_actions =
+            ExpressionAnalyzer(condition, data.context, nullptr, all_columns).getActions(false);
+
+        merged_stream = std::make_shared<FilterBlockInputStream>(merged_stream, condition_actions, condition->getColumnName());
+    }
+
     auto compression_method = data.context.chooseCompressionMethod(
             merge_entry->total_size_bytes_compressed,
             static_cast<double> (merge_entry->total_size_bytes_compressed) / data.getTotalActiveSizeInBytes());
 
     MergedBlockOutputStream to{
-        data, new_part_tmp_path, merging_columns, compression_method, merged_column_to_size, aio_threshold};
+        data, new_part_tmp_path, merging_columns, compression_method, merged_column_to_size, aio_threshold,
+        merged_index_granularity};
 
     merged_stream->readPrefix();
     to.writePrefix();
@@ -631,13 +811,38 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
     const size_t initial_reservation = disk_reservation ? disk_reservation->getSize() : 0;
 
     Block block;
-    while (!isCancelled() && (block = merged_stream->read()))
+    Stopwatch watch_step;
+    UInt64 merged_pull_time_ns = 0;
+
+    while (!isCancelled())
     {
+        watch_step.restart();
+        block = merged_stream->read();
+        merged_pull_time_ns += watch_step.elapsed();
+
+        if (!block)
+            break;
+
         rows_written += block.rows();
+
+        watch_step.restart();
         to.write(block);
+        merge_entry->write_time_ns += watch_step.elapsed();
+
+        /** Attribute the time of pulling from the merging stream to reading the source parts
+          *  (the time spent inside the source streams, including the primary key expression)
+          *  and to the merge-sort itself (the rest).
+          */
+        UInt64 read_time_ns = 0;
+        for (const auto & stream : src_streams)
+            if (const auto * profiling = dynamic_cast<const IProfilingBlockInputStream *>(stream.get()))
+                read_time_ns += profiling->getProfileInfo().total_stopwatch.elapsed();
+        merge_entry->read_time_ns = read_time_ns;
+        merge_entry->sort_time_ns = merged_pull_time_ns > read_time_ns ? merged_pull_time_ns - read_time_ns : 0;
 
         merge_entry->rows_written = merged_stream->getProfileInfo().rows;
         merge_entry->bytes_written_uncompressed = merged_stream->getProfileInfo().bytes;
+        merge_entry->bytes_written_compressed = to.getBytesWrittenCompressed();
 
         /// Reservation updates is not performed yet, during the merge it may lead to higher free space requirements
         if (disk_reservation)
@@ -690,26 +895,41 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
             {
                 auto column_part_stream = std::make_shared<MergeTreeBlockInputStream>(
                     data, parts[part_num], DEFAULT_MERGE_BLOCK_SIZE, 0, 0, column_name_, MarkRanges{MarkRange(0, parts[part_num]->size)},
-                    false, nullptr, "", true, aio_threshold, DBMS_DEFAULT_BUFFER_SIZE, false, Names{}, 0, true);
+                    false, nullptr, "", true, aio_threshold, 0, DBMS_DEFAULT_BUFFER_SIZE, false, Names{}, 0, true);
 
                 column_part_stream->setProgressCallback(MergeProgressCallbackVerticalStep(
-                        merge_entry, sum_input_rows_exact, column_sizes, column_name, watch_prev_elapsed));
+                        merge_entry, sum_input_rows_exact, column_sizes, column_name, watch_prev_elapsed,
+                        &data.context.getMergeScheduler()));
 
                 column_part_streams[part_num] = std::move(column_part_stream);
             }
 
             rows_sources_read_buf.seek(0, 0);
             ColumnGathererStream column_gathered_stream(column_name, column_part_streams, rows_sources_read_buf);
-            MergedColumnOnlyOutputStream column_to(data, new_part_tmp_path, false, compression_method, offset_written);
+            auto it_column_size = merged_column_to_size.find(column_name);
+            MergedColumnOnlyOutputStream column_to(
+                data, new_part_tmp_path, false, compression_method, offset_written, merged_index_granularity,
+                aio_threshold, it_column_size != merged_column_to_size.end() ? it_column_size->second : 0);
             size_t column_elems_written = 0;
 
             column_to.writePrefix();
-            while ((block = column_gathered_stream.read()))
+            while (true)
             {
+                watch_step.restart();
+                block = column_gathered_stream.read();
+                merge_entry->read_time_ns += watch_step.elapsed();
+
+                if (!block)
+                    break;
+
                 column_elems_written += block.rows();
+
+                watch_step.restart();
                 column_to.write(block);
+                merge_entry->write_time_ns += watch_step.elapsed();
             }
             column_gathered_stream.readSuffix();
+            merge_entry->bytes_written_compressed += column_to.getBytesWrittenCompressed();
             checksums_gathered_columns.add(column_to.writeSuffixAndGetChecksums());
 
             if (rows_written != column_elems_written)
@@ -735,6 +955,19 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
     for (const auto & part : parts)
         new_data_part->minmax_idx.merge(part->minmax_idx);
 
+    /// Statistics of the merged part are correct only if every source part has them
+    ///  (old parts created before the part_minmax_expressions setting was enabled have none,
+    ///  and merging would silently produce too narrow bounds).
+    if (data.part_minmax_expr)
+    {
+        bool all_parts_have_stats = std::all_of(parts.begin(), parts.end(),
+            [](const MergeTreeData::DataPartPtr & part) { return part->part_minmax_stats.initialized; });
+
+        if (all_parts_have_stats)
+            for (const auto & part : parts)
+                new_data_part->part_minmax_stats.merge(part->part_minmax_stats);
+    }
+
     /// Print overall profiling info. NOTE: it may duplicates previous messages
     {
         double elapsed_seconds = merge_entry->watch.elapsedSeconds();
@@ -756,6 +989,19 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPart
     if (0 == to.marksCount())
         throw Exception("Empty part after merge", ErrorCodes::LOGICAL_ERROR);
 
+    if (data.projection_query)
+    {
+        /// The projection is recomputed from the merged rows rather than assembled from the
+        ///  source parts' states: a merge can drop or collapse rows (TTL, deleted rows masks,
+        ///  Collapsing/Replacing modes), and recomputation picks all of that up.
+        auto merged_part_stream = std::make_shared<MergeTreeBlockInputStream>(
+            data, new_data_part, DEFAULT_MERGE_BLOCK_SIZE, 0, 0, data.projection_source_columns,
+            MarkRanges(1, MarkRange(0, new_data_part->size)), false, nullptr, "", true,
+            aio_threshold, 0, DBMS_DEFAULT_BUFFER_SIZE, false);
+        data.buildProjection(new_data_part->getFullPath(), merged_part_stream);
+        new_data_part->projection_exists = true;
+    }
+
     return new_data_part;
 }
 
@@ -766,12 +1012,16 @@ MergeTreeDataMerger::MergeAlgorithm MergeTreeDataMerger::chooseMergeAlgorithm(
 {
     if (deduplicate)
         return MergeAlgorithm::Horizontal;
+    /// TTL filtering drops rows after the row sources have been recorded, which would desynchronize gathered columns.
+    if (data.ttl_expression)
+        return MergeAlgorithm::Horizontal;
     if (data.context.getMergeTreeSettings().enable_vertical_merge_algorithm == 0)
         return MergeAlgorithm::Horizontal;
 
     bool is_supported_storage =
         data.merging_params.mode == MergeTreeData::MergingParams::Ordinary ||
         data.merging_params.mode == MergeTreeData::MergingParams::Collapsing ||
+        data.merging_params.mode == MergeTreeData::MergingParams::Summing ||
         data.merging_params.mode == MergeTreeData::MergingParams::Replacing;
 
     bool enough_ordinary_cols = gathering_columns.size() >= data.context.getMergeTreeSettings().vertical_merge_algorithm_min_columns_to_activate;
@@ -882,7 +1132,14 @@ MergeTreeData::PerShardDataParts MergeTreeDataMerger::reshardPartition(
 
     size_t sum_rows_approx = 0;
 
-    const auto rows_total = merge_entry->total_size_marks * data.index_granularity;
+    size_t rows_total = 0;
+    size_t sum_input_bytes_uncompressed = 0;
+    for (const MergeTreeData::DataPartPtr & part : parts)
+    {
+        rows_total += part->size * part->index_granularity;
+        for (const NameAndTypePair & column : part->columns)
+            sum_input_bytes_uncompressed += part->getColumnUncompressedSize(column.name);
+    }
 
     for (size_t i = 0; i < parts.size(); ++i)
     {
@@ -890,7 +1147,7 @@ MergeTreeData::PerShardDataParts MergeTreeDataMerger::reshardPartition(
 
         auto input = std::make_unique<MergeTreeBlockInputStream>(
             data, parts[i], DEFAULT_MERGE_BLOCK_SIZE, 0, 0, column_names,
-            ranges, false, nullptr, "", true, aio_threshold, DBMS_DEFAULT_BUFFER_SIZE, false);
+            ranges, false, nullptr, "", true, aio_threshold, 0, DBMS_DEFAULT_BUFFER_SIZE, false);
 
         input->setProgressCallback([&merge_entry, rows_total] (const Progress & value)
             {
@@ -905,7 +1162,7 @@ MergeTreeData::PerShardDataParts MergeTreeDataMerger::reshardPartition(
         else
             src_streams.emplace_back(std::move(input));
 
-        sum_rows_approx += parts[i]->size * data.index_granularity;
+        sum_rows_approx += parts[i]->size * parts[i]->index_granularity;
     }
 
     /// Sharding of merged blocks.
@@ -947,7 +1204,8 @@ MergeTreeData::PerShardDataParts MergeTreeDataMerger::reshardPartition(
 
         MergedBlockOutputStreamPtr output_stream;
         output_stream = std::make_unique<MergedBlockOutputStream>(
-            data, new_part_tmp_path, column_names_and_types, compression_method, merged_column_to_size, aio_threshold);
+            data, new_part_tmp_path, column_names_and_types, compression_method, merged_column_to_size, aio_threshold,
+            data.chooseIndexGranularity(sum_input_bytes_uncompressed, rows_total));
 
         per_shard_data_parts.emplace(shard_no, std::move(data_part));
         per_shard_output.emplace(shard_no, std::move(output_stream));
@@ -68,13 +68,19 @@ public:
 
     /** Select all the parts in the specified partition for merge, if possible.
       * final - choose to merge even a single part - that is, allow to merge one part "with itself".
+      *
+      * With final (and not deduplicate), parts whose primary key ranges do not intersect
+      *  the range of any other part have nothing to collapse against and are left out of the merge
+      *  where the block number order allows it, so that OPTIMIZE FINAL does not rewrite
+      *  data that a merge could not change anyway.
       */
     bool selectAllPartsToMergeWithinPartition(
         FuturePart & future_part,
         size_t available_disk_space,
         const AllowedMergingPredicate & can_merge,
         const String & partition_id,
-        bool final);
+        bool final,
+        bool deduplicate);
 
     /** Merge the parts.
       * If `reservation != nullptr`, now and then reduces the size of the reserved space
@@ -6,6 +6,7 @@
 #include <IO/ReadBufferFromString.h>
 #include <IO/WriteBufferFromString.h>
 #include <IO/ReadBufferFromFile.h>
+#include <IO/WriteBufferFromFile.h>
 #include <IO/HashingWriteBuffer.h>
 #include <Core/Defines.h>
 #include <Common/SipHash.h>
@@ -294,26 +295,38 @@ static ReadBufferFromFile openForReading(const String & path)
 
 void MergeTreeDataPart::MinMaxIndex::load(const MergeTreeData & storage, const String & part_path)
 {
-    size_t minmax_idx_size = storage.minmax_idx_column_types.size();
-    min_values.resize(minmax_idx_size);
-    max_values.resize(minmax_idx_size);
-    for (size_t i = 0; i < minmax_idx_size; ++i)
+    load(storage.minmax_idx_columns, storage.minmax_idx_column_types, "minmax_", part_path);
+}
+
+void MergeTreeDataPart::MinMaxIndex::store(const MergeTreeData & storage, const String & part_path, Checksums & checksums) const
+{
+    store(storage.minmax_idx_columns, storage.minmax_idx_column_types, "minmax_", part_path, checksums);
+}
+
+void MergeTreeDataPart::MinMaxIndex::load(
+    const Names & column_names, const DataTypes & types, const String & file_prefix, const String & part_path)
+{
+    min_values.resize(column_names.size());
+    max_values.resize(column_names.size());
+    for (size_t i = 0; i < column_names.size(); ++i)
     {
-        String file_name = part_path + "minmax_" + escapeForFileName(storage.minmax_idx_columns[i]) + ".idx";
+        String file_name = part_path + file_prefix + escapeForFileName(column_names[i]) + ".idx";
         ReadBufferFromFile file = openForReading(file_name);
-        const DataTypePtr & type = storage.minmax_idx_column_types[i];
+        const DataTypePtr & type = types[i];
         type->deserializeBinary(min_values[i], file);
         type->deserializeBinary(max_values[i], file);
     }
     initialized = true;
 }
 
-void MergeTreeDataPart::MinMaxIndex::store(const MergeTreeData & storage, const String & part_path, Checksums & checksums) const
+void MergeTreeDataPart::MinMaxIndex::store(
+    const Names & column_names, const DataTypes & types, const String & file_prefix,
+    const String & part_path, Checksums & checksums) const
 {
-    for (size_t i = 0; i < storage.minmax_idx_columns.size(); ++i)
+    for (size_t i = 0; i < column_names.size(); ++i)
     {
-        String file_name = "minmax_" + escapeForFileName(storage.minmax_idx_columns[i]) + ".idx";
-        const DataTypePtr & type = storage.minmax_idx_column_types[i];
+        String file_name = file_prefix + escapeForFileName(column_names[i]) + ".idx";
+        const DataTypePtr & type = types[i];
 
         WriteBufferFromFile out(part_path + file_name);
         HashingWriteBuffer out_hashing(out);
@@ -376,6 +389,226 @@ void MergeTreeDataPart::MinMaxIndex::merge(const MinMaxIndex & other)
 }
 
 
+void MergeTreeDataPart::SkipIndex::load(const MergeTreeData & storage, const String & part_path)
+{
+    size_t skip_idx_size = storage.skip_idx_column_types.size();
+    min_values.assign(skip_idx_size, {});
+    max_values.assign(skip_idx_size, {});
+
+    for (size_t i = 0; i < skip_idx_size; ++i)
+    {
+        String file_name = part_path + "skip_minmax_" + escapeForFileName(storage.skip_idx_columns[i]) + ".idx";
+
+        /// The part could have been written before the index was configured - then it is simply absent.
+        if (!Poco::File(file_name).exists())
+        {
+            min_values.clear();
+            max_values.clear();
+            return;
+        }
+
+        ReadBufferFromFile file = openForReading(file_name);
+        const DataTypePtr & type = storage.skip_idx_column_types[i];
+
+        size_t blocks_count = 0;
+        readVarUInt(blocks_count, file);
+        min_values[i].resize(blocks_count);
+        max_values[i].resize(blocks_count);
+        for (size_t block = 0; block < blocks_count; ++block)
+        {
+            type->deserializeBinary(min_values[i][block], file);
+            type->deserializeBinary(max_values[i][block], file);
+        }
+    }
+
+    initialized = true;
+}
+
+void MergeTreeDataPart::SkipIndex::store(const MergeTreeData & storage, const String & part_path, Checksums & checksums) const
+{
+    for (size_t i = 0; i < storage.skip_idx_columns.size(); ++i)
+    {
+        String file_name = "skip_minmax_" + escapeForFileName(storage.skip_idx_columns[i]) + ".idx";
+        const DataTypePtr & type = storage.skip_idx_column_types[i];
+
+        WriteBufferFromFile out(part_path + file_name);
+        HashingWriteBuffer out_hashing(out);
+        writeVarUInt(min_values[i].size(), out_hashing);
+        for (size_t block = 0; block < min_values[i].size(); ++block)
+        {
+            type->serializeBinary(min_values[i][block], out_hashing);
+            type->serializeBinary(max_values[i][block], out_hashing);
+        }
+        checksums.files[file_name].file_size = out_hashing.count();
+        checksums.files[file_name].file_hash = out_hashing.getHash();
+    }
+}
+
+void MergeTreeDataPart::SkipIndex::update(const MergeTreeData & storage, size_t column_pos, const IColumn & column, size_t index_granularity)
+{
+    if (min_values.empty())
+    {
+        size_t skip_idx_size = storage.skip_idx_columns.size();
+        min_values.resize(skip_idx_size);
+        max_values.resize(skip_idx_size);
+        rows_in_last_block.assign(skip_idx_size, 0);
+        total_rows.assign(skip_idx_size, 0);
+    }
+
+    const size_t block_rows = storage.settings.skip_index_granularity * index_granularity;
+
+    std::vector<Field> & mins = min_values[column_pos];
+    std::vector<Field> & maxs = max_values[column_pos];
+    size_t & accumulated = rows_in_last_block[column_pos];
+
+    size_t rows = column.size();
+    size_t pos = 0;
+    while (pos < rows)
+    {
+        size_t length = std::min(rows - pos, block_rows - accumulated);
+
+        Field min_value;
+        Field max_value;
+        if (pos == 0 && length == rows)
+            column.getExtremes(min_value, max_value);
+        else
+            column.cut(pos, length)->getExtremes(min_value, max_value);
+
+        if (accumulated == 0)
+        {
+            mins.push_back(min_value);
+            maxs.push_back(max_value);
+        }
+        else
+        {
+            mins.back() = std::min(mins.back(), min_value);
+            maxs.back() = std::max(maxs.back(), max_value);
+        }
+
+        accumulated += length;
+        if (accumulated == block_rows)
+            accumulated = 0;
+
+        total_rows[column_pos] += length;
+        pos += length;
+    }
+
+    initialized = true;
+}
+
+bool MergeTreeDataPart::SkipIndex::isComplete(const MergeTreeData & storage) const
+{
+    if (!initialized || total_rows.size() != storage.skip_idx_columns.size())
+        return false;
+
+    for (size_t i = 1; i < total_rows.size(); ++i)
+        if (total_rows[i] != total_rows[0])
+            return false;
+
+    return total_rows[0] != 0;
+}
+
+
+void MergeTreeDataPart::DeletedRowsMask::load(const String & part_path)
+{
+    ReadBufferFromFile in = openForReading(part_path + "deleted_rows.bin");
+
+    assertString("deleted rows format version: 1\n", in);
+    readVarUInt(rows, in);
+    readVarUInt(deleted_rows, in);
+
+    bitmap.resize((rows + 7) / 8);
+    in.readStrict(reinterpret_cast<char *>(bitmap.data()), bitmap.size());
+    assertEOF(in);
+
+    initialized = true;
+}
+
+void MergeTreeDataPart::DeletedRowsMask::store(const String & part_path) const
+{
+    String tmp_path = part_path + "tmp_deleted_rows.bin";
+
+    {
+        WriteBufferFromFile out(tmp_path, 4096);
+        writeString("deleted rows format version: 1\n", out);
+        writeVarUInt(rows, out);
+        writeVarUInt(deleted_rows, out);
+        out.write(reinterpret_cast<const char *>(bitmap.data()), bitmap.size());
+        out.next();
+        out.sync();
+    }
+
+    Poco::File(tmp_path).renameTo(part_path + "deleted_rows.bin");
+}
+
+
+void MergeTreeDataPart::CompactOffsets::load(const String & part_path)
+{
+    String path = part_path + "offsets.txt";
+    ReadBufferFromFile in = openForReading(path);
+
+    assertString("compact part format version: 1\n", in);
+    readText(rows, in);
+    assertString(" rows\n", in);
+
+    size_t count;
+    readText(count, in);
+    assertString(" files:\n", in);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        String name;
+        Region region;
+
+        readString(name, in);
+        assertString("\n\t", in);
+        readText(region.offset, in);
+        assertChar(' ', in);
+        readText(region.size, in);
+        assertChar('\n', in);
+
+        files[name] = region;
+    }
+
+    assertEOF(in);
+    initialized = true;
+}
+
+void MergeTreeDataPart::CompactOffsets::store(const String & part_path, Checksums & checksums) const
+{
+    WriteBufferFromFile out(part_path + "offsets.txt", 4096);
+    HashingWriteBuffer out_hashing(out);
+
+    writeString("compact part format version: 1\n", out_hashing);
+    writeText(rows, out_hashing);
+    writeString(" rows\n", out_hashing);
+    writeText(files.size(), out_hashing);
+    writeString(" files:\n", out_hashing);
+
+    for (const auto & it : files)
+    {
+        writeString(it.first, out_hashing);
+        writeString("\n\t", out_hashing);
+        writeText(it.second.offset, out_hashing);
+        writeChar(' ', out_hashing);
+        writeText(it.second.size, out_hashing);
+        writeChar('\n', out_hashing);
+    }
+
+    out_hashing.next();
+    checksums.files["offsets.txt"].file_size = out_hashing.count();
+    checksums.files["offsets.txt"].file_hash = out_hashing.getHash();
+}
+
+const MergeTreeDataPart::CompactOffsets::Region & MergeTreeDataPart::CompactOffsets::getRegion(const String & file_name) const
+{
+    auto it = files.find(file_name);
+    if (it == files.end())
+        throw Exception("No file " + file_name + " in the offset table of compact part", ErrorCodes::NO_FILE_IN_DATA_PART);
+    return it->second;
+}
+
+
 MergeTreeDataPart::MergeTreeDataPart(MergeTreeData & storage_, const String & name_)
     : storage(storage_), name(name_), info(MergeTreePartInfo::fromPartName(name_, storage.format_version))
 {
@@ -428,7 +661,11 @@ String MergeTreeDataPart::getColumnNameWithMinumumCompressedSize() const
 
 size_t MergeTreeDataPart::getExactSizeRows() const
 {
-    size_t rows_approx = storage.index_granularity * size;
+    /// Compact parts store the exact number of rows in the offset table.
+    if (isCompactFormat())
+        return compact_offsets.rows;
+
+    size_t rows_approx = index_granularity * size;
 
     for (const NameAndTypePair & column : columns)
     {
@@ -450,7 +687,7 @@ size_t MergeTreeDataPart::getExactSizeRows() const
                 ErrorCodes::LOGICAL_ERROR);
         }
 
-        if (!(rows_approx - storage.index_granularity < rows && rows <= rows_approx))
+        if (!(rows_approx - index_granularity < rows && rows <= rows_approx))
         {
             throw Exception("Unexpected size of column " + column.name + ": " + toString(rows) + " rows",
                             ErrorCodes::LOGICAL_ERROR);
@@ -541,7 +778,7 @@ size_t MergeTreeDataPart::calcTotalSize(const String & from)
     return res;
 }
 
-void MergeTreeDataPart::remove() const
+String MergeTreeDataPart::renameForRemoval() const
 {
     if (relative_path.empty())
         throw Exception("Part relative_path cannot be empty. This is bug.", ErrorCodes::LOGICAL_ERROR);
@@ -577,10 +814,17 @@ void MergeTreeDataPart::remove() const
         LOG_WARNING(storage.log, "Directory " << from << " (part to remove) doesn't exist or one of nested files has gone."
             " Most likely this is due to manual removing. This should be discouraged. Ignoring.");
 
-        return;
+        return {};
     }
 
-    to_dir.remove(true);
+    return to;
+}
+
+void MergeTreeDataPart::remove() const
+{
+    String to = renameForRemoval();
+    if (!to.empty())
+        Poco::File(to).remove(true);
 }
 
 
@@ -646,14 +890,63 @@ void MergeTreeDataPart::loadColumnsChecksumsIndexes(bool require_columns_checksu
 {
     loadColumns(require_columns_checksums);
     loadChecksums(require_columns_checksums);
-    loadIndex();
+    loadIndexGranularity();
+    loadCompactOffsets();
+    calculateSizes();
     loadPartitionAndMinMaxIndex();
+    loadSkipIndex();
+    loadPartMinMaxStatistics();
+    loadDeletedRowsMask();
+    projection_exists = storage.projection_query && Poco::File(getFullPath() + PROJECTION_FILE_NAME).exists();
     if (check_consistency)
         checkConsistency(require_columns_checksums);
 }
 
 
-void MergeTreeDataPart::loadIndex()
+void MergeTreeDataPart::loadIndexGranularity()
+{
+    index_granularity = storage.index_granularity;
+
+    /// The file exists only for parts written with a granularity that differs from the table default
+    ///  (see the index_granularity_bytes setting).
+    String path = getFullPath() + "index_granularity.txt";
+    if (!Poco::File(path).exists())
+        return;
+
+    ReadBufferFromFile file = openForReading(path);
+    readIntText(index_granularity, file);
+    assertEOF(file);
+
+    if (!index_granularity)
+        throw Exception("Zero index granularity in file " + path, ErrorCodes::CORRUPTED_DATA);
+}
+
+void MergeTreeDataPart::loadCompactOffsets()
+{
+    if (Poco::File(getFullPath() + "offsets.txt").exists())
+        compact_offsets.load(getFullPath());
+}
+
+void MergeTreeDataPart::loadPartMinMaxStatistics()
+{
+    if (storage.part_minmax_columns.empty())
+        return;
+
+    /// Parts written before the setting was enabled simply have no statistics.
+    String first_file = getFullPath() + "stat_minmax_" + escapeForFileName(storage.part_minmax_columns.front()) + ".idx";
+    if (!Poco::File(first_file).exists())
+        return;
+
+    part_minmax_stats.load(storage.part_minmax_columns, storage.part_minmax_column_types, "stat_minmax_", getFullPath());
+}
+
+void MergeTreeDataPart::loadDeletedRowsMask()
+{
+    if (Poco::File(getFullPath() + "deleted_rows.bin").exists())
+        deleted_rows_mask.load(getFullPath());
+}
+
+void MergeTreeDataPart::calculateSizes()
 {
     /// Size - in number of marks.
     if (!size)
@@ -661,21 +954,42 @@ void MergeTreeDataPart::loadIndex()
         if (columns.empty())
             throw Exception("No columns in part " + name, ErrorCodes::NO_FILE_IN_DATA_PART);
 
-        size = Poco::File(getFullPath() + escapeForFileName(columns.front().name) + ".mrk")
-            .getSize() / MERGE_TREE_MARK_SIZE;
+        if (isCompactFormat())
+            size = compact_offsets.getRegion(escapeForFileName(columns.front().name) + ".mrk").size
+                / MERGE_TREE_MARK_SIZE;
+        else
+            size = Poco::File(getFullPath() + escapeForFileName(columns.front().name) + ".mrk")
+                .getSize() / MERGE_TREE_MARK_SIZE;
+    }
+
+    size_in_bytes = calcTotalSize(getFullPath());
+}
+
+const MergeTreeDataPart::Index & MergeTreeDataPart::getIndex() const
+{
+    std::lock_guard<std::mutex> lock(index_mutex);
+
+    if (!index_loaded)
+    {
+        loadIndex();
+        index_loaded = true;
     }
 
+    return index;
+}
+
+void MergeTreeDataPart::loadIndex() const
+{
     size_t key_size = storage.sort_descr.size();
 
     if (key_size)
     {
-        index.clear();
-        index.resize(key_size);
+        Columns loaded_index(key_size);
 
         for (size_t i = 0; i < key_size; ++i)
         {
-            index[i] = storage.primary_key_data_types[i]->createColumn();
-            index[i]->reserve(size);
+            loaded_index[i] = storage.primary_key_data_types[i]->createColumn();
+            loaded_index[i]->reserve(size);
         }
 
         String index_path = getFullPath() + "primary.idx";
@@ -683,19 +997,20 @@ void MergeTreeDataPart::loadIndex()
 
         for (size_t i = 0; i < size; ++i)
             for (size_t j = 0; j < key_size; ++j)
-                storage.primary_key_data_types[j]->deserializeBinary(*index[j].get(), index_file);
+                storage.primary_key_data_types[j]->deserializeBinary(*loaded_index[j].get(), index_file);
 
         for (size_t i = 0; i < key_size; ++i)
-            if (index[i]->size() != size)
+            if (loaded_index[i]->size() != size)
                 throw Exception("Cannot read all data from index file " + index_path
-                    + "(expected size: " + toString(size) + ", read: " + toString(index[i]->size()) + ")",
+                    + "(expected size: " + toString(size) + ", read: " + toString(loaded_index[i]->size()) + ")",
                     ErrorCodes::CANNOT_READ_ALL_DATA);
 
         if (!index_file.eof())
             throw Exception("Index file " + index_path + " is unexpectedly long", ErrorCodes::EXPECTED_END_OF_FILE);
-    }
 
-    size_in_bytes = calcTotalSize(getFullPath());
+        /// Re-encode the key columns compactly; the plain ones are discarded.
+        index.assign(loaded_index);
+    }
 }
 
 void MergeTreeDataPart::loadPartitionAndMinMaxIndex()
@@ -725,6 +1040,14 @@ void MergeTreeDataPart::loadPartitionAndMinMaxIndex()
             ErrorCodes::CORRUPTED_DATA);
 }
 
+void MergeTreeDataPart::loadSkipIndex()
+{
+    if (storage.skip_idx_columns.empty())
+        return;
+
+    skip_idx.load(storage, getFullPath());
+}
+
 void MergeTreeDataPart::loadChecksums(bool require)
 {
     String path = getFullPath() + "checksums.txt";
@@ -744,8 +1067,16 @@ void MergeTreeDataPart::accumulateColumnSizes(ColumnToSize & column_to_size) con
 {
     std::shared_lock<std::shared_mutex> part_lock(columns_lock);
     for (const NameAndTypePair & column : *storage.columns)
-        if (Poco::File(getFullPath() + escapeForFileName(column.name) + ".bin").exists())
+    {
+        if (isCompactFormat())
+        {
+            String file_name = escapeForFileName(column.name) + ".bin";
+            if (compact_offsets.has(file_name))
+                column_to_size[column.name] += compact_offsets.getRegion(file_name).size;
+        }
+        else if (Poco::File(getFullPath() + escapeForFileName(column.name) + ".bin").exists())
             column_to_size[column.name] += Poco::File(getFullPath() + escapeForFileName(column.name) + ".bin").getSize();
+    }
 }
 
 void MergeTreeDataPart::loadColumns(bool require)
@@ -788,12 +1119,28 @@ void MergeTreeDataPart::checkConsistency(bool require_part_metadata)
 
         if (require_part_metadata)
         {
-            for (const NameAndTypePair & it : columns)
+            if (isCompactFormat())
+            {
+                if (!checksums.files.count("data.bin") || !checksums.files.count("offsets.txt"))
+                    throw Exception("No data.bin or offsets.txt file checksum in compact part", ErrorCodes::NO_FILE_IN_DATA_PART);
+
+                for (const NameAndTypePair & it : columns)
+                {
+                    String name = escapeForFileName(it.name);
+                    if (!compact_offsets.has(name + ".mrk") || !compact_offsets.has(name + ".bin"))
+                        throw Exception("No .mrk or .bin file for column " + name + " in the offset table of compact part",
+                            ErrorCodes::NO_FILE_IN_DATA_PART);
+                }
+            }
+            else
             {
-                String name = escapeForFileName(it.name);
-                if (!checksums.files.count(name + ".mrk") ||
-                    !checksums.files.count(name + ".bin"))
-                    throw Exception("No .mrk or .bin file checksum for column " + name, ErrorCodes::NO_FILE_IN_DATA_PART);
+                for (const NameAndTypePair & it : columns)
+                {
+                    String name = escapeForFileName(it.name);
+                    if (!checksums.files.count(name + ".mrk") ||
+                        !checksums.files.count(name + ".bin"))
+                        throw Exception("No .mrk or .bin file checksum for column " + name, ErrorCodes::NO_FILE_IN_DATA_PART);
+                }
             }
         }
 
@@ -825,6 +1172,9 @@ void MergeTreeDataPart::checkConsistency(bool require_part_metadata)
         if (!storage.sort_descr.empty())
             check_file_not_empty(path + "primary.idx");
 
+        if (isCompactFormat())
+            check_file_not_empty(path + "data.bin");
+
         if (storage.format_version >= MERGE_TREE_DATA_MIN_FORMAT_VERSION_WITH_CUSTOM_PARTITIONING)
         {
             if (storage.partition_expr)
@@ -863,34 +1213,40 @@ void MergeTreeDataPart::checkConsistency(bool require_part_metadata)
             }
         };
 
-        check_marks(columns, ".mrk");
-        check_marks(columns, ".null.mrk");
+        if (!isCompactFormat())
+        {
+            check_marks(columns, ".mrk");
+            check_marks(columns, ".null.mrk");
+        }
     }
 }
 
 bool MergeTreeDataPart::hasColumnFiles(const String & column) const
 {
-    String prefix = getFullPath();
     String escaped_column = escapeForFileName(column);
+
+    if (isCompactFormat())
+        return compact_offsets.has(escaped_column + ".bin") && compact_offsets.has(escaped_column + ".mrk");
+
+    String prefix = getFullPath();
     return Poco::File(prefix + escaped_column + ".bin").exists() &&
         Poco::File(prefix + escaped_column + ".mrk").exists();
 }
 
 
+/// Note: reports the memory currently used, which is zero until the index is loaded on first use.
 size_t MergeTreeDataPart::getIndexSizeInBytes() const
 {
-    size_t res = 0;
-    for (const ColumnPtr & column : index)
-        res += column->byteSize();
-    return res;
+    std::lock_guard<std::mutex> lock(index_mutex);
+
+    return index.byteSize();
 }
 
 size_t MergeTreeDataPart::getIndexSizeInAllocatedBytes() const
 {
-    size_t res = 0;
-    for (const ColumnPtr & column : index)
-        res += column->allocatedBytes();
-    return res;
+    std::lock_guard<std::mutex> lock(index_mutex);
+
+    return index.byteSize();
 }
 
 }
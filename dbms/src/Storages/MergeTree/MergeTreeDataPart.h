@@ -5,7 +5,9 @@
 #include <Core/NamesAndTypes.h>
 #include <Storages/MergeTree/MergeTreePartInfo.h>
 #include <Storages/MergeTree/MergeTreePartition.h>
+#include <Storages/MergeTree/MergeTreePrimaryIndex.h>
 #include <Columns/IColumn.h>
+#include <mutex>
 #include <shared_mutex>
 
 
@@ -133,10 +135,15 @@ struct MergeTreeDataPart
     mutable String relative_path;
 
     size_t size = 0;                        /// in number of marks.
+    size_t index_granularity = 0;           /// Rows per mark in this part. May be less than the table default
+                                            ///  if the part was written with the index_granularity_bytes setting
+                                            ///  (see index_granularity.txt). Set on load or by the part writer.
     std::atomic<size_t> size_in_bytes {0};  /// size in bytes, 0 - if not counted;
                                             ///  is used from several threads without locks (it is changed with ALTER).
     time_t modification_time = 0;
     mutable time_t remove_time = std::numeric_limits<time_t>::max(); /// When the part is removed from the working set.
+    mutable std::atomic<time_t> last_read_time {0};    /// When the part was last selected for reading by a query.
+                                                       ///  0 - never since server startup. Used by MergeTreePartScrubber.
 
     /// If true, the destructor will delete the directory with the part.
     bool is_temp = false;
@@ -145,10 +152,19 @@ struct MergeTreeDataPart
     size_t shard_no = 0;
 
     /// Primary key (correspond to primary.idx file).
-    /// Always loaded in RAM. Contains each index_granularity-th value of primary key tuple.
+    /// Contains each index_granularity-th value of primary key tuple.
+    /// Loaded lazily on first access through getIndex(): reading the index of every part at server
+    ///  startup would dominate the load time of tables with many parts.
     /// Note that marks (also correspond to primary key) is not always in RAM, but cached. See MarkCache.h.
-    using Index = Columns;
-    Index index;
+    /// Kept in a compact encoding (see MergeTreePrimaryIndex.h) to save memory on servers with many parts.
+    using Index = MergeTreePrimaryIndex;
+    mutable Index index;            /// Use getIndex() to read it; written directly only by part writers.
+    mutable bool index_loaded = false;
+    mutable std::mutex index_mutex;
+
+    /// Returns the primary key index, reading it from the primary.idx file on first access.
+    /// The index of a part never changes, so the reference remains valid as long as the part is alive.
+    const Index & getIndex() const;
 
     MergeTreePartition partition;
 
@@ -176,12 +192,118 @@ struct MergeTreeDataPart
         void load(const MergeTreeData & storage, const String & part_path);
         void store(const MergeTreeData & storage, const String & part_path, Checksums & checksums) const;
 
+        /// Generic variants, used for the statistics over the `part_minmax_expressions` setting
+        ///  (the variants above are bound to the minmax index of the partition key).
+        void load(const Names & column_names, const DataTypes & types, const String & file_prefix, const String & part_path);
+        void store(const Names & column_names, const DataTypes & types, const String & file_prefix,
+                   const String & part_path, Checksums & checksums) const;
+
         void update(const Block & block, const Names & column_names);
         void merge(const MinMaxIndex & other);
     };
 
     MinMaxIndex minmax_idx;
 
+    /// Min/max values of the expressions from the `part_minmax_expressions` setting,
+    ///  used to prune whole parts in MergeTreeDataSelectExecutor.
+    /// Parts written before the setting was enabled have no statistics (initialized == false).
+    MinMaxIndex part_minmax_stats;
+
+    /// Data skipping index over columns from the `skip_index_columns` setting.
+    /// For each block of `skip_index_granularity` index granules stores min and max values of every
+    /// indexed column, so that conditions on non-primary-key columns can exclude mark ranges
+    /// without decompressing the data.
+    struct SkipIndex
+    {
+        /// Per indexed column (in the order of storage.skip_idx_columns) - one Field per granule block.
+        std::vector<std::vector<Field>> min_values;
+        std::vector<std::vector<Field>> max_values;
+        bool initialized = false;
+
+        void load(const MergeTreeData & storage, const String & part_path);
+        void store(const MergeTreeData & storage, const String & part_path, Checksums & checksums) const;
+
+        /// Incremental building while writing a part.
+        /// `column_pos` is a position in storage.skip_idx_columns; `column` holds the rows just written.
+        /// `index_granularity` is the granularity the part is written with.
+        void update(const MergeTreeData & storage, size_t column_pos, const IColumn & column, size_t index_granularity);
+
+        /// Whether all indexed columns have seen the same number of rows (some write paths,
+        /// e.g. writing only a subset of columns, cannot build a complete index).
+        bool isComplete(const MergeTreeData & storage) const;
+
+        size_t granuleBlocksCount() const { return min_values.empty() ? 0 : min_values[0].size(); }
+
+    private:
+        /// Number of rows accumulated in the last (possibly incomplete) granule block, per column.
+        std::vector<size_t> rows_in_last_block;
+        /// Total number of rows seen, per column.
+        std::vector<size_t> total_rows;
+    };
+
+    SkipIndex skip_idx;
+
+    /// In a part of the compact format all files of the classic wide format (the .bin and .mrk
+    /// of every column) are concatenated into a single data file ("data.bin"), and this table maps
+    /// each of them to its region inside it (stored in "offsets.txt").
+    /// Small parts are written in this format to avoid creating a pair of files per column
+    ///  (see the min_bytes_for_wide_part setting). Merges always produce wide parts.
+    struct CompactOffsets
+    {
+        struct Region
+        {
+            size_t offset = 0;
+            size_t size = 0;
+        };
+
+        /// File name of the wide format (e.g. "ColumnName.bin") -> region inside the data file.
+        std::map<String, Region> files;
+        size_t rows = 0;
+        bool initialized = false;
+
+        void load(const String & part_path);
+        void store(const String & part_path, Checksums & checksums) const;
+
+        void addRegion(const String & file_name, size_t offset, size_t size) { files[file_name] = Region{offset, size}; }
+        const Region & getRegion(const String & file_name) const;
+        bool has(const String & file_name) const { return files.count(file_name); }
+    };
+
+    CompactOffsets compact_offsets;
+
+    /// Whether all columns of the part live in a single data file (see CompactOffsets).
+    bool isCompactFormat() const { return compact_offsets.initialized; }
+
+    /// Rows deleted by a lightweight DELETE (ALTER TABLE ... DELETE WHERE).
+    /// The bitmap is stored in "deleted_rows.bin" next to checksums.txt; while the part is read,
+    ///  masked rows are filtered out (see MergeTreeBaseBlockInputStream), so a merge that reads
+    ///  the part drops them physically. Deleting rows thus only writes the bitmap.
+    struct DeletedRowsMask
+    {
+        std::vector<UInt8> bitmap;    /// One bit per row; 1 - the row is deleted.
+        size_t rows = 0;
+        size_t deleted_rows = 0;
+        bool initialized = false;
+
+        bool isDeleted(size_t row) const { return bitmap[row / 8] & (1 << (row % 8)); }
+        void setDeleted(size_t row) { bitmap[row / 8] |= (1 << (row % 8)); }
+
+        void load(const String & part_path);
+
+        /// Writes a temporary file and renames it, so that a crash cannot leave a partial bitmap.
+        void store(const String & part_path) const;
+    };
+
+    /// Protected by columns_lock, as any other file of the part.
+    /// Mutable: the mask is replaced through a const pointer when rows of a committed part are deleted.
+    mutable DeletedRowsMask deleted_rows_mask;
+
+    /// The result of the table's projection query over this part, stored with mergeable aggregation states.
+    static constexpr auto PROJECTION_FILE_NAME = "projection.bin";
+
+    /// Whether this part has projection data (parts written before the projection was added have none).
+    bool projection_exists = false;
+
     Checksums checksums;
 
     /// Columns description.
@@ -211,6 +333,12 @@ struct MergeTreeDataPart
 
     void remove() const;
 
+    /// The first (O(1)) half of remove(): renames the part directory to tmp_delete_<name> and
+    ///  returns the new absolute path (empty if the directory has already gone).
+    /// The files are then unlinked by the caller - either at once or by the background reaper
+    ///  (see MergeTreeData::enqueuePartRemoval).
+    String renameForRemoval() const;
+
     /// Makes checks and move part to new directory
     /// Changes only relative_dir_name, you need to update other metadata (name, is_temp) explicitly
     void renameTo(const String & new_relative_path, bool remove_new_dir_if_exists = true) const;
@@ -239,11 +367,30 @@ private:
     /// If checksums.txt exists, reads files' checksums (and sizes) from it
     void loadChecksums(bool require);
 
-    /// Loads index file. Also calculates this->size if size=0
-    void loadIndex();
+    /// Reads the part's own index granularity from index_granularity.txt, if present;
+    ///  otherwise the table default is used.
+    void loadIndexGranularity();
+
+    /// Loads the offset table of a compact part, if the part is stored in the compact format.
+    void loadCompactOffsets();
+
+    /// Calculates this->size (in marks) if size=0, and this->size_in_bytes.
+    void calculateSizes();
+
+    /// Reads the primary index from the primary.idx file (see getIndex()).
+    void loadIndex() const;
 
     void loadPartitionAndMinMaxIndex();
 
+    /// Loads the skip index, if the table has one and the part was written with it.
+    void loadSkipIndex();
+
+    /// Loads the bitmap of deleted rows, if some rows of the part were deleted.
+    void loadDeletedRowsMask();
+
+    /// Loads the per-part minmax statistics, if the table has them and the part was written with them.
+    void loadPartMinMaxStatistics();
+
     void checkConsistency(bool require_part_metadata);
 };
 
@@ -31,7 +31,10 @@
 #include <Parsers/ASTSampleRatio.h>
 #include <DataStreams/ExpressionBlockInputStream.h>
 #include <DataStreams/FilterBlockInputStream.h>
+#include <DataStreams/ConcatBlockInputStream.h>
+#include <DataStreams/ReverseBlockInputStream.h>
 #include <DataStreams/CollapsingFinalBlockInputStream.h>
+#include <DataStreams/KeyRangeFilterBlockInputStream.h>
 #include <DataStreams/AddingConstColumnBlockInputStream.h>
 #include <DataStreams/CreatingSetsBlockInputStream.h>
 #include <DataStreams/NullBlockInputStream.h>
@@ -42,6 +45,7 @@
 #include <DataTypes/DataTypeDate.h>
 #include <DataTypes/DataTypeEnum.h>
 #include <Common/VirtualColumnUtils.h>
+#include <Interpreters/ExplainInfo.h>
 
 
 namespace ProfileEvents
@@ -87,7 +91,7 @@ static Block getBlockWithPartColumn(const MergeTreeData::DataPartsVector & parts
 size_t MergeTreeDataSelectExecutor::getApproximateTotalRowsToRead(
     const MergeTreeData::DataPartsVector & parts, const PKCondition & key_condition, const Settings & settings) const
 {
-    size_t full_marks_count = 0;
+    size_t rows_count = 0;
 
     /// We will find out how many rows we would have read without sampling.
     LOG_DEBUG(log, "Preliminary index scan with condition: " << key_condition.toString());
@@ -95,7 +99,7 @@ size_t MergeTreeDataSelectExecutor::getApproximateTotalRowsToRead(
     for (size_t i = 0; i < parts.size(); ++i)
     {
         const MergeTreeData::DataPartPtr & part = parts[i];
-        MarkRanges ranges = markRangesFromPKRange(part->index, key_condition, settings);
+        MarkRanges ranges = markRangesFromPKRange(part->getIndex(), key_condition, settings);
 
         /** In order to get a lower bound on the number of rows that match the condition on PK,
           *  consider only guaranteed full marks.
@@ -103,10 +107,10 @@ size_t MergeTreeDataSelectExecutor::getApproximateTotalRowsToRead(
           */
         for (size_t j = 0; j < ranges.size(); ++j)
             if (ranges[j].end - ranges[j].begin > 2)
-                full_marks_count += ranges[j].end - ranges[j].begin - 2;
+                rows_count += (ranges[j].end - ranges[j].begin - 2) * part->index_granularity;
     }
 
-    return full_marks_count * data.index_granularity;
+    return rows_count;
 }
 
 
@@ -215,6 +219,18 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
         throw Exception(exception_message.str(), ErrorCodes::INDEX_NOT_USED);
     }
 
+    std::experimental::optional<PKCondition> skip_idx_condition;
+    if (data.skip_idx_expr)
+    {
+        skip_idx_condition.emplace(
+            query_info, context, available_real_and_virtual_columns,
+            data.skip_idx_sort_descr, data.skip_idx_expr);
+
+        /// Don't pay for scanning the index if the query doesn't constrain its columns.
+        if (skip_idx_condition->alwaysUnknownOrTrue())
+            skip_idx_condition = std::experimental::nullopt;
+    }
+
     std::experimental::optional<PKCondition> minmax_idx_condition;
     if (data.minmax_idx_expr)
     {
@@ -240,6 +256,17 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
         }
     }
 
+    std::experimental::optional<PKCondition> part_minmax_condition;
+    if (data.part_minmax_expr)
+    {
+        part_minmax_condition.emplace(
+            query_info, context, available_real_and_virtual_columns,
+            data.part_minmax_sort_descr, data.part_minmax_expr);
+
+        if (part_minmax_condition->alwaysUnknownOrTrue())
+            part_minmax_condition = std::experimental::nullopt;
+    }
+
     /// Select the parts in which there can be data that satisfy `minmax_idx_condition` and that match the condition on `_part`,
     ///  as well as `max_block_number_to_read`.
     {
@@ -257,6 +284,15 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
                     data.minmax_idx_column_types))
                 continue;
 
+            /// Parts written before the part_minmax_expressions setting was enabled
+            ///  have no statistics and are never pruned by them.
+            if (part_minmax_condition && part->part_minmax_stats.initialized
+                && !part_minmax_condition->mayBeTrueInRange(
+                    data.part_minmax_columns.size(),
+                    &part->part_minmax_stats.min_values[0], &part->part_minmax_stats.max_values[0],
+                    data.part_minmax_column_types))
+                continue;
+
             if (max_block_number_to_read && part->info.max_block > max_block_number_to_read)
                 continue;
 
@@ -269,6 +305,14 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
     std::shared_ptr<ASTFunction> filter_function;
     ExpressionActionsPtr filter_expression;
 
+    /// When the sampling key is a component of the primary key, whole granules are checked against
+    ///  the sampling interval by the index; the filter (and reading of the columns it needs)
+    ///  is left only for the granules that straddle the interval boundaries (see below).
+    bool sample_granule_pruning = false;
+    size_t sampling_key_position = 0;
+    Names column_names_to_read_with_sampling;
+    ExpressionActionsPtr remove_sampling_columns_actions;
+
     RelativeSize relative_sample_size = 0;
     RelativeSize relative_sample_offset = 0;
 
@@ -356,6 +400,13 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
     bool use_sampling = relative_sample_size > 0 || settings.parallel_replicas_count > 1;
     bool no_data = false;   /// There is nothing left after sampling.
 
+    /// The half-interval of `[lower, upper)` sampling key values; also used later,
+    ///  to check whole granules against the interval.
+    bool has_lower_limit = false;
+    bool has_upper_limit = false;
+    UInt64 lower = 0;
+    UInt64 upper = 0;
+
     if (use_sampling)
     {
         if (!data.sampling_expression)
@@ -392,14 +443,11 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
             no_data = true;
 
         /// Calculate the half-interval of `[lower, upper)` column values.
-        bool has_lower_limit = false;
-        bool has_upper_limit = false;
-
         RelativeSize lower_limit_rational = relative_sample_offset * size_of_universum;
         RelativeSize upper_limit_rational = (relative_sample_offset + relative_sample_size) * size_of_universum;
 
-        UInt64 lower = boost::rational_cast<ASTSampleRatio::BigNum>(lower_limit_rational);
-        UInt64 upper = boost::rational_cast<ASTSampleRatio::BigNum>(upper_limit_rational);
+        lower = boost::rational_cast<ASTSampleRatio::BigNum>(lower_limit_rational);
+        upper = boost::rational_cast<ASTSampleRatio::BigNum>(upper_limit_rational);
 
         if (lower > 0)
             has_lower_limit = true;
@@ -478,11 +526,53 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
 
             filter_expression = ExpressionAnalyzer(filter_function, context, nullptr, available_real_columns).getActions(false);
 
-            /// Add columns needed for `sampling_expression`.
+            /// Columns needed for `sampling_expression`.
             std::vector<String> add_columns = filter_expression->getRequiredColumns();
-            column_names_to_read.insert(column_names_to_read.end(), add_columns.begin(), add_columns.end());
-            std::sort(column_names_to_read.begin(), column_names_to_read.end());
-            column_names_to_read.erase(std::unique(column_names_to_read.begin(), column_names_to_read.end()), column_names_to_read.end());
+
+            /** If the sampling key is a component of the primary key, whole granules can be
+              *  checked against `[lower, upper)` by the index; the ones entirely inside it
+              *  need neither the filter nor reading of these columns.
+              * With FINAL or reading in the order of the key, the ranges of a part must not be
+              *  split between two groups of streams - do not prune in those cases.
+              */
+            const String sampling_column_name = data.sampling_expression->getColumnName();
+            for (size_t i = 0, size = sort_descr.size(); i < size; ++i)
+            {
+                if (sort_descr[i].column_name == sampling_column_name)
+                {
+                    sampling_key_position = i;
+                    sample_granule_pruning = !select.final() && !query_info.read_in_pk_order;
+                    break;
+                }
+            }
+
+            if (sample_granule_pruning)
+            {
+                /// Read the sampling columns only for the granules straddling the interval boundaries.
+                column_names_to_read_with_sampling = column_names_to_read;
+                for (const auto & name : add_columns)
+                    if (column_names_to_read_with_sampling.end()
+                        == std::find(column_names_to_read_with_sampling.begin(), column_names_to_read_with_sampling.end(), name))
+                        column_names_to_read_with_sampling.push_back(name);
+
+                /// After the filter, remove everything read or computed only for sampling,
+                ///  so that the blocks match those of the granules read without it.
+                NamesAndTypesList sampling_only_columns;
+                for (const auto & column : filter_expression->getSampleBlock().getColumnsList())
+                    if (column_names_to_read.end() == std::find(column_names_to_read.begin(), column_names_to_read.end(), column.name))
+                        sampling_only_columns.push_back(column);
+
+                remove_sampling_columns_actions = std::make_shared<ExpressionActions>(sampling_only_columns, settings);
+                for (const auto & column : sampling_only_columns)
+                    remove_sampling_columns_actions->add(ExpressionAction::removeColumn(column.name));
+            }
+            else
+            {
+                /// Add columns needed for `sampling_expression`.
+                column_names_to_read.insert(column_names_to_read.end(), add_columns.begin(), add_columns.end());
+                std::sort(column_names_to_read.begin(), column_names_to_read.end());
+                column_names_to_read.erase(std::unique(column_names_to_read.begin(), column_names_to_read.end()), column_names_to_read.end());
+            }
         }
     }
 
@@ -493,8 +583,12 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
     }
 
     LOG_DEBUG(log, "Key condition: " << key_condition.toString());
+    if (skip_idx_condition)
+        LOG_DEBUG(log, "Skip index condition: " << skip_idx_condition->toString());
     if (minmax_idx_condition)
         LOG_DEBUG(log, "MinMax index condition: " << minmax_idx_condition->toString());
+    if (part_minmax_condition)
+        LOG_DEBUG(log, "Part minmax statistics condition: " << part_minmax_condition->toString());
 
     /// PREWHERE
     ExpressionActionsPtr prewhere_actions;
@@ -516,6 +610,9 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
 
     RangesInDataParts parts_with_ranges;
 
+    /// Granules entirely inside the sampling interval - they are read without the filter.
+    RangesInDataParts interior_parts_with_ranges;
+
     /// Let's find what range to read from each part.
     size_t sum_marks = 0;
     size_t sum_ranges = 0;
@@ -524,10 +621,86 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
         RangesInDataPart ranges(part, (*inout_part_index)++);
 
         if (data.merging_params.mode != MergeTreeData::MergingParams::Unsorted)
-            ranges.ranges = markRangesFromPKRange(part->index, key_condition, settings);
+            ranges.ranges = markRangesFromPKRange(part->getIndex(), key_condition, settings);
         else
             ranges.ranges = MarkRanges{MarkRange{0, part->size}};
 
+        if (skip_idx_condition && !ranges.ranges.empty())
+            ranges.ranges = filterMarkRangesUsingSkipIndex(part, *skip_idx_condition, ranges.ranges, settings);
+
+        if (!ranges.ranges.empty())
+            part->last_read_time = time(nullptr);
+
+        if (sample_granule_pruning && !ranges.ranges.empty())
+        {
+            const MergeTreeData::DataPart::Index & index = part->getIndex();
+            size_t marks_count = index.marksCount();
+
+            /** Is the granule `[mark, mark + 1)` entirely inside `[lower, upper)`?
+              * The index bounds the values of the sampling key over a granule only if all
+              *  the preceding key components are constant over it - then the key is sorted
+              *  by the sampling component within the granule.
+              */
+            auto granule_fully_sampled = [&](size_t mark)
+            {
+                if (mark + 1 >= marks_count)
+                    return false;   /// The right bound of the last granule is not in the index.
+
+                Field left;
+                Field right;
+
+                for (size_t i = 0; i < sampling_key_position; ++i)
+                {
+                    index.get(i, mark, left);
+                    index.get(i, mark + 1, right);
+                    if (left != right)
+                        return false;
+                }
+
+                index.get(sampling_key_position, mark, left);
+                index.get(sampling_key_position, mark + 1, right);
+
+                return (!has_lower_limit || left.get<UInt64>() >= lower)
+                    && (!has_upper_limit || right.get<UInt64>() < upper);
+            };
+
+            MarkRanges straddling_ranges;
+            MarkRanges interior_ranges;
+
+            for (const auto & range : ranges.ranges)
+            {
+                size_t subrange_begin = range.begin;
+                bool subrange_interior = granule_fully_sampled(range.begin);
+
+                for (size_t mark = range.begin + 1; mark < range.end; ++mark)
+                {
+                    bool interior = granule_fully_sampled(mark);
+                    if (interior != subrange_interior)
+                    {
+                        (subrange_interior ? interior_ranges : straddling_ranges).push_back(MarkRange(subrange_begin, mark));
+                        subrange_begin = mark;
+                        subrange_interior = interior;
+                    }
+                }
+
+                (subrange_interior ? interior_ranges : straddling_ranges).push_back(MarkRange(subrange_begin, range.end));
+            }
+
+            ranges.ranges = std::move(straddling_ranges);
+
+            if (!interior_ranges.empty())
+            {
+                RangesInDataPart interior(part, ranges.part_index_in_query);
+                interior.ranges = std::move(interior_ranges);
+
+                sum_ranges += interior.ranges.size();
+                for (const auto & range : interior.ranges)
+                    sum_marks += range.end - range.begin;
+
+                interior_parts_with_ranges.push_back(std::move(interior));
+            }
+        }
+
         if (!ranges.ranges.empty())
         {
             parts_with_ranges.push_back(ranges);
@@ -541,10 +714,35 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
     LOG_DEBUG(log, "Selected " << parts.size() << " parts by date, " << parts_with_ranges.size() << " parts by key, "
         << sum_marks << " marks to read from " << sum_ranges << " ranges");
 
-    if (parts_with_ranges.empty())
+    /// For EXPLAIN: report how the indexes were used, in addition to the log.
+    if (ExplainInfo * explain_info = context.getExplainInfo())
+    {
+        ExplainInfo::TableReadInfo info;
+        info.database = data.getDatabaseName();
+        info.table = data.getTableName();
+        info.parts_by_date = parts.size();
+        info.parts_by_key = parts_with_ranges.size();
+        info.ranges = sum_ranges;
+        info.marks = sum_marks;
+        for (const auto & part_ranges : parts_with_ranges)
+            for (const auto & range : part_ranges.ranges)
+                info.rows_approx += (range.end - range.begin) * part_ranges.data_part->index_granularity;
+        for (const auto & part_ranges : interior_parts_with_ranges)
+            for (const auto & range : part_ranges.ranges)
+                info.rows_approx += (range.end - range.begin) * part_ranges.data_part->index_granularity;
+        info.key_condition = key_condition.toString();
+        if (skip_idx_condition)
+            info.skip_index_condition = skip_idx_condition->toString();
+        if (minmax_idx_condition)
+            info.minmax_index_condition = minmax_idx_condition->toString();
+        info.prewhere_column = prewhere_column;
+        explain_info->table_reads.push_back(std::move(info));
+    }
+
+    if (parts_with_ranges.empty() && interior_parts_with_ranges.empty())
         return {};
 
-    ProfileEvents::increment(ProfileEvents::SelectedParts, parts_with_ranges.size());
+    ProfileEvents::increment(ProfileEvents::SelectedParts, parts_with_ranges.size() + interior_parts_with_ranges.size());
     ProfileEvents::increment(ProfileEvents::SelectedRanges, sum_ranges);
     ProfileEvents::increment(ProfileEvents::SelectedMarks, sum_marks);
 
@@ -566,6 +764,7 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
 
         res = spreadMarkRangesAmongStreamsFinal(
             parts_with_ranges,
+            num_streams,
             column_names_to_read,
             max_block_size,
             settings.use_uncompressed_cache,
@@ -575,9 +774,9 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
             settings,
             context);
     }
-    else
+    else if (query_info.read_in_pk_order)
     {
-        res = spreadMarkRangesAmongStreams(
+        res = spreadMarkRangesAmongStreamsInPKOrder(
             parts_with_ranges,
             num_streams,
             column_names_to_read,
@@ -586,12 +785,50 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
             prewhere_actions,
             prewhere_column,
             virt_column_names,
-            settings);
+            settings,
+            query_info.read_in_pk_order_reverse);
+    }
+    else
+    {
+        if (!parts_with_ranges.empty())
+            res = spreadMarkRangesAmongStreams(
+                parts_with_ranges,
+                num_streams,
+                sample_granule_pruning ? column_names_to_read_with_sampling : column_names_to_read,
+                max_block_size,
+                settings.use_uncompressed_cache,
+                prewhere_actions,
+                prewhere_column,
+                virt_column_names,
+                settings);
     }
 
     if (use_sampling)
+    {
         for (auto & stream : res)
+        {
             stream = std::make_shared<FilterBlockInputStream>(stream, filter_expression, filter_function->getColumnName());
+            if (remove_sampling_columns_actions)
+                stream = std::make_shared<ExpressionBlockInputStream>(stream, remove_sampling_columns_actions);
+        }
+    }
+
+    /// Granules entirely inside the sampling interval - no filter is needed for them.
+    if (!interior_parts_with_ranges.empty())
+    {
+        BlockInputStreams interior_streams = spreadMarkRangesAmongStreams(
+            interior_parts_with_ranges,
+            num_streams,
+            column_names_to_read,
+            max_block_size,
+            settings.use_uncompressed_cache,
+            prewhere_actions,
+            prewhere_column,
+            virt_column_names,
+            settings);
+
+        res.insert(res.end(), interior_streams.begin(), interior_streams.end());
+    }
 
     /// By the way, if a distributed query or query to a Merge table is made, then the `_sample_factor` column can have different values.
     if (sample_factor_column_queried)
@@ -603,6 +840,140 @@ BlockInputStreams MergeTreeDataSelectExecutor::read(
 }
 
 
+namespace
+{
+    /// Whether all column identifiers of the expression belong to `columns`.
+    bool isExpressionOverColumns(const ASTPtr & node, const Names & columns)
+    {
+        if (const ASTIdentifier * identifier = typeid_cast<const ASTIdentifier *>(node.get()))
+        {
+            if (identifier->kind == ASTIdentifier::Column
+                && columns.end() == std::find(columns.begin(), columns.end(), identifier->name))
+                return false;
+        }
+
+        for (const auto & child : node->children)
+            if (!isExpressionOverColumns(child, columns))
+                return false;
+
+        return true;
+    }
+}
+
+
+std::experimental::optional<MergeTreeData::DataPartsVector> MergeTreeDataSelectExecutor::partsFullyMatchingQuery(
+    const SelectQueryInfo & query_info,
+    const Context & context) const
+{
+    const ASTSelectQuery & select = typeid_cast<const ASTSelectQuery &>(*query_info.query);
+
+    MergeTreeData::DataPartsVector parts = data.getDataPartsVector();
+
+    /// Rows hidden by lightweight DELETEs are not reflected in the part metadata.
+    for (const auto & part : parts)
+        if (part->deleted_rows_mask.initialized)
+            return {};
+
+    if (!select.where_expression)
+        return parts;
+
+    /** A condition on the partitioning columns alone can be decided for a part as a whole.
+      * The minmax index tells whether the condition holds for no row of the part (the part is
+      *  dropped, as in read()) or, applied to the negated condition, whether it holds for every
+      *  row (the part is kept). If some part is covered only partially, give up:
+      *  the rows have to be read.
+      */
+    if (!data.minmax_idx_expr || !isExpressionOverColumns(select.where_expression, data.minmax_idx_columns))
+        return {};
+
+    PKCondition condition(
+        query_info, context, data.getColumnsList(), data.minmax_idx_sort_descr, data.minmax_idx_expr);
+
+    SelectQueryInfo negated_query_info;
+    negated_query_info.query = query_info.query->clone();
+    negated_query_info.sets = query_info.sets;
+
+    ASTSelectQuery & negated_select = typeid_cast<ASTSelectQuery &>(*negated_query_info.query);
+    ASTPtr negated_where = makeASTFunction("not", negated_select.where_expression);
+    std::replace(negated_select.children.begin(), negated_select.children.end(),
+        negated_select.where_expression, negated_where);
+    negated_select.where_expression = negated_where;
+
+    PKCondition negated_condition(
+        negated_query_info, context, data.getColumnsList(), data.minmax_idx_sort_descr, data.minmax_idx_expr);
+
+    MergeTreeData::DataPartsVector res;
+    for (const auto & part : parts)
+    {
+        /// No row of the part can match - skip it.
+        if (!condition.mayBeTrueInRange(
+                data.minmax_idx_columns.size(),
+                &part->minmax_idx.min_values[0], &part->minmax_idx.max_values[0],
+                data.minmax_idx_column_types))
+            continue;
+
+        /// Some row of the part may not match - the part cannot be accounted from the metadata.
+        if (negated_condition.mayBeTrueInRange(
+                data.minmax_idx_columns.size(),
+                &part->minmax_idx.min_values[0], &part->minmax_idx.max_values[0],
+                data.minmax_idx_column_types))
+            return {};
+
+        res.push_back(part);
+    }
+
+    return res;
+}
+
+
+std::experimental::optional<UInt64> MergeTreeDataSelectExecutor::countRowsByMetadata(
+    const SelectQueryInfo & query_info,
+    const Context & context) const
+{
+    auto parts = partsFullyMatchingQuery(query_info, context);
+    if (!parts)
+        return {};
+
+    UInt64 rows = 0;
+    for (const auto & part : *parts)
+        rows += part->getExactSizeRows();
+
+    return rows;
+}
+
+
+std::experimental::optional<Field> MergeTreeDataSelectExecutor::extremeOfColumnByMetadata(
+    bool is_min,
+    const String & column_name,
+    const SelectQueryInfo & query_info,
+    const Context & context) const
+{
+    if (!data.minmax_idx_expr)
+        return {};
+
+    const auto it = std::find(data.minmax_idx_columns.begin(), data.minmax_idx_columns.end(), column_name);
+    if (it == data.minmax_idx_columns.end())
+        return {};
+    size_t pos = it - data.minmax_idx_columns.begin();
+
+    auto parts = partsFullyMatchingQuery(query_info, context);
+    if (!parts)
+        return {};
+
+    Field res;
+    for (const auto & part : *parts)
+    {
+        const Field & value = is_min ? part->minmax_idx.min_values[pos] : part->minmax_idx.max_values[pos];
+        if (res.isNull() || (is_min ? value < res : res < value))
+            res = value;
+    }
+
+    /// For an empty set of matching parts, Null is returned; the caller substitutes the default
+    ///  value of the type, as aggregation without keys does.
+    return res;
+}
+
+
 BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreams(
     RangesInDataParts parts,
     size_t num_streams,
@@ -730,7 +1101,7 @@ BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreams(
                     data, part.data_part, max_block_size, settings.preferred_block_size_bytes,
                     settings.preferred_max_column_in_block_size_bytes, column_names, ranges_to_get_from_part,
                     use_uncompressed_cache, prewhere_actions, prewhere_column, true, settings.min_bytes_to_use_direct_io,
-                    settings.max_read_buffer_size, true, virt_columns, part.part_index_in_query);
+                    settings.min_bytes_to_use_mmap_io, settings.max_read_buffer_size, true, virt_columns, part.part_index_in_query);
 
                 res.push_back(source_stream);
             }
@@ -743,8 +1114,120 @@ BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreams(
     return res;
 }
 
+BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsInPKOrder(
+    RangesInDataParts parts,
+    size_t num_streams,
+    const Names & column_names,
+    size_t max_block_size,
+    bool use_uncompressed_cache,
+    ExpressionActionsPtr prewhere_actions,
+    const String & prewhere_column,
+    const Names & virt_columns,
+    const Settings & settings,
+    bool reverse) const
+{
+    const size_t min_marks_for_concurrent_read =
+        (settings.merge_tree_min_rows_for_concurrent_read + data.index_granularity - 1) / data.index_granularity;
+    const size_t max_marks_to_use_cache =
+        (settings.merge_tree_max_rows_to_use_cache + data.index_granularity - 1) / data.index_granularity;
+
+    size_t sum_marks = 0;
+    for (const auto & part : parts)
+        for (const auto & range : part.ranges)
+            sum_marks += range.end - range.begin;
+
+    if (sum_marks > max_marks_to_use_cache)
+        use_uncompressed_cache = false;
+
+    /** Within a part the rows are already in the order of the primary key, and any contiguous
+      *  piece of a part is sorted by itself. So one part may be cut into several streams:
+      *  this way a single large part (e.g. right after OPTIMIZE) is read by all threads
+      *  instead of dominating one stream. All streams are merged by the interpreter
+      *  (see InterpreterSelectQuery::executeOrder), which does not require them to be disjoint.
+      */
+    const size_t marks_per_stream = std::max(min_marks_for_concurrent_read, num_streams ? (sum_marks - 1) / num_streams + 1 : sum_marks);
+
+    BlockInputStreams res;
+    for (const auto & part : parts)
+    {
+        MarkRanges ranges_for_stream;
+        size_t marks_in_stream = 0;
+
+        auto make_stream = [&](const MarkRanges & stream_ranges)
+        {
+            return std::make_shared<MergeTreeBlockInputStream>(
+                data, part.data_part, max_block_size, settings.preferred_block_size_bytes,
+                settings.preferred_max_column_in_block_size_bytes, column_names, stream_ranges, use_uncompressed_cache,
+                prewhere_actions, prewhere_column, true, settings.min_bytes_to_use_direct_io,
+                settings.min_bytes_to_use_mmap_io, settings.max_read_buffer_size, true,
+                virt_columns, part.part_index_in_query);
+        };
+
+        auto flush_stream = [&]
+        {
+            if (ranges_for_stream.empty())
+                return;
+
+            if (!reverse)
+            {
+                res.push_back(make_stream(ranges_for_stream));
+            }
+            else
+            {
+                /** Descending order: walk the ranges of the stream from the end, cutting them into
+                  *  pieces of a few granules. Each piece is read forward and reversed in memory
+                  *  (both the order of the blocks and the rows within them), so the stream emits
+                  *  rows in descending order of the key, and a LIMIT query reads only the last
+                  *  few pieces. The pieces are bounded, so the reversal memory is bounded too.
+                  */
+                const size_t chunk_marks = std::max<size_t>(1, (max_block_size + data.index_granularity - 1) / data.index_granularity);
+
+                BlockInputStreams chunks;
+                for (size_t i = ranges_for_stream.size(); i > 0; --i)
+                {
+                    const MarkRange & range = ranges_for_stream[i - 1];
+                    for (size_t end = range.end; end > range.begin;)
+                    {
+                        size_t begin = end > range.begin + chunk_marks ? end - chunk_marks : range.begin;
+                        chunks.push_back(std::make_shared<ReverseBlockInputStream>(
+                            make_stream(MarkRanges{MarkRange{begin, end}})));
+                        end = begin;
+                    }
+                }
+
+                res.push_back(chunks.size() == 1 ? chunks.front() : std::make_shared<ConcatBlockInputStream>(chunks));
+            }
+
+            ranges_for_stream.clear();
+            marks_in_stream = 0;
+        };
+
+        for (const auto & range : part.ranges)
+        {
+            for (size_t begin = range.begin; begin < range.end;)
+            {
+                size_t end = std::min(range.end, begin + (marks_per_stream - marks_in_stream));
+
+                ranges_for_stream.emplace_back(begin, end);
+                marks_in_stream += end - begin;
+                begin = end;
+
+                if (marks_in_stream >= marks_per_stream)
+                    flush_stream();
+            }
+        }
+
+        /// The remainder of the part.
+        flush_stream();
+    }
+
+    return res;
+}
+
+
 BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsFinal(
     RangesInDataParts parts,
+    size_t num_streams,
     const Names & column_names,
     size_t max_block_size,
     bool use_uncompressed_cache,
@@ -765,65 +1248,56 @@ BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsFinal
     if (sum_marks > max_marks_to_use_cache)
         use_uncompressed_cache = false;
 
-    BlockInputStreams to_merge;
-
     /// NOTE `merge_tree_uniform_read_distribution` is not used for FINAL
 
-    for (size_t part_index = 0; part_index < parts.size(); ++part_index)
+    auto make_source_stream = [&](const RangesInDataPart & part) -> BlockInputStreamPtr
     {
-        RangesInDataPart & part = parts[part_index];
-
         BlockInputStreamPtr source_stream = std::make_shared<MergeTreeBlockInputStream>(
             data, part.data_part, max_block_size, settings.preferred_block_size_bytes,
             settings.preferred_max_column_in_block_size_bytes, column_names, part.ranges, use_uncompressed_cache,
-            prewhere_actions, prewhere_column, true, settings.min_bytes_to_use_direct_io, settings.max_read_buffer_size, true,
+            prewhere_actions, prewhere_column, true, settings.min_bytes_to_use_direct_io,
+            settings.min_bytes_to_use_mmap_io, settings.max_read_buffer_size, true,
             virt_columns, part.part_index_in_query);
 
-        to_merge.emplace_back(std::make_shared<ExpressionBlockInputStream>(source_stream, data.getPrimaryExpression()));
-    }
+        return std::make_shared<ExpressionBlockInputStream>(source_stream, data.getPrimaryExpression());
+    };
 
-    BlockInputStreams res;
-    if (to_merge.size() == 1)
+    /// Merges the sources into one sorted and collapsed (summed, ...) stream.
+    auto merge_streams = [&](BlockInputStreams & to_merge) -> BlockInputStreamPtr
     {
-        if (!data.merging_params.sign_column.empty())
+        if (to_merge.size() == 1)
         {
-            ExpressionActionsPtr sign_filter_expression;
-            String sign_filter_column;
+            if (!data.merging_params.sign_column.empty())
+            {
+                ExpressionActionsPtr sign_filter_expression;
+                String sign_filter_column;
+
+                createPositiveSignCondition(sign_filter_expression, sign_filter_column, context);
 
-            createPositiveSignCondition(sign_filter_expression, sign_filter_column, context);
+                return std::make_shared<FilterBlockInputStream>(to_merge[0], sign_filter_expression, sign_filter_column);
+            }
 
-            res.emplace_back(std::make_shared<FilterBlockInputStream>(to_merge[0], sign_filter_expression, sign_filter_column));
+            return to_merge[0];
         }
-        else
-            res = to_merge;
-    }
-    else if (to_merge.size() > 1)
-    {
-        BlockInputStreamPtr merged;
 
         switch (data.merging_params.mode)
         {
             case MergeTreeData::MergingParams::Ordinary:
-                merged = std::make_shared<MergingSortedBlockInputStream>(to_merge, data.getSortDescription(), max_block_size);
-                break;
+                return std::make_shared<MergingSortedBlockInputStream>(to_merge, data.getSortDescription(), max_block_size);
 
             case MergeTreeData::MergingParams::Collapsing:
-                merged = std::make_shared<CollapsingFinalBlockInputStream>(to_merge, data.getSortDescription(), data.merging_params.sign_column);
-                break;
+                return std::make_shared<CollapsingFinalBlockInputStream>(to_merge, data.getSortDescription(), data.merging_params.sign_column);
 
             case MergeTreeData::MergingParams::Summing:
-                merged = std::make_shared<SummingSortedBlockInputStream>(to_merge,
+                return std::make_shared<SummingSortedBlockInputStream>(to_merge,
                     data.getSortDescription(), data.merging_params.columns_to_sum, max_block_size);
-                break;
 
             case MergeTreeData::MergingParams::Aggregating:
-                merged = std::make_shared<AggregatingSortedBlockInputStream>(to_merge, data.getSortDescription(), max_block_size);
-                break;
+                return std::make_shared<AggregatingSortedBlockInputStream>(to_merge, data.getSortDescription(), max_block_size);
 
             case MergeTreeData::MergingParams::Replacing:    /// TODO Make ReplacingFinalBlockInputStream
-                merged = std::make_shared<ReplacingSortedBlockInputStream>(to_merge,
+                return std::make_shared<ReplacingSortedBlockInputStream>(to_merge,
                     data.getSortDescription(), data.merging_params.version_column, max_block_size);
-                break;
 
             case MergeTreeData::MergingParams::Unsorted:
                 throw Exception("UnsortedMergeTree doesn't support FINAL", ErrorCodes::LOGICAL_ERROR);
@@ -832,9 +1306,141 @@ BlockInputStreams MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsFinal
                 throw Exception("GraphiteMergeTree doesn't support FINAL", ErrorCodes::LOGICAL_ERROR);
         }
 
-        res.emplace_back(merged);
+        __builtin_unreachable();
+    };
+
+    /// The primary key value at the given mark of the part's index.
+    using KeyTuple = std::vector<Field>;
+
+    auto index_key = [](const MergeTreeData::DataPart::Index & index, size_t mark)
+    {
+        KeyTuple key(index.size());
+        for (size_t i = 0; i < index.size(); ++i)
+            index.get(i, mark, key[i]);
+        return key;
+    };
+
+    /// The first mark whose key is not less than `key` (keys in the index are sorted).
+    auto first_mark_not_less = [&](const MergeTreeData::DataPart::Index & index, size_t marks_count, const KeyTuple & key)
+    {
+        size_t low = 0;
+        size_t high = marks_count;
+        while (low < high)
+        {
+            size_t middle = (low + high) / 2;
+            if (index_key(index, middle) < key)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    };
+
+    /** Partitioned FINAL: if several threads are allowed, choose keys that split the key space
+      *  into disjoint half-intervals and merge each of them independently.
+      * Rows with equal keys always fall into the same half-interval (the reading streams are
+      *  filtered by it), so the result is the same as with a single merge.
+      */
+    std::vector<KeyTuple> borders;
+
+    num_streams = std::min(num_streams, static_cast<size_t>(settings.max_final_threads));
+
+    if (num_streams > 1 && parts.size() > 1)
+    {
+        /// Candidate split keys are the index values at granule boundaries of the selected ranges.
+        std::vector<KeyTuple> candidates;
+
+        for (const RangesInDataPart & part : parts)
+        {
+            const MergeTreeData::DataPart::Index & index = part.data_part->getIndex();
+            if (index.empty())
+            {
+                candidates.clear();
+                break;
+            }
+
+            size_t marks_in_ranges = 0;
+            for (const MarkRange & range : part.ranges)
+                marks_in_ranges += range.end - range.begin;
+
+            /// A moderate oversampling gives borders close to the real quantiles of the key distribution.
+            size_t step = std::max<size_t>(1, marks_in_ranges / (num_streams * 4));
+            for (const MarkRange & range : part.ranges)
+                for (size_t mark = range.begin; mark < range.end; mark += step)
+                    candidates.push_back(index_key(index, mark));
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        for (size_t i = 1; i < num_streams && candidates.size() > 1; ++i)
+        {
+            const KeyTuple & candidate = candidates[candidates.size() * i / num_streams];
+
+            /// A border equal to the minimum key would create an empty first half-interval.
+            if (candidate > candidates.front() && (borders.empty() || borders.back() < candidate))
+                borders.push_back(candidate);
+        }
+    }
+
+    BlockInputStreams res;
+
+    if (!borders.empty())
+    {
+        for (size_t interval = 0; interval <= borders.size(); ++interval)
+        {
+            const KeyTuple * lower = interval > 0 ? &borders[interval - 1] : nullptr;
+            const KeyTuple * upper = interval < borders.size() ? &borders[interval] : nullptr;
+
+            BlockInputStreams to_merge;
+
+            for (const RangesInDataPart & part : parts)
+            {
+                const MergeTreeData::DataPart::Index & index = part.data_part->getIndex();
+                size_t marks_count = part.data_part->size;
+
+                /// Granules that may contain keys from [lower, upper).
+                size_t begin_mark = 0;
+                if (lower)
+                {
+                    begin_mark = first_mark_not_less(index, marks_count, *lower);
+                    if (begin_mark > 0)
+                        --begin_mark;   /// The previous granule may also contain keys >= lower.
+                }
+                size_t end_mark = upper ? first_mark_not_less(index, marks_count, *upper) : marks_count;
+
+                RangesInDataPart interval_part(part.data_part, part.part_index_in_query);
+                for (const MarkRange & range : part.ranges)
+                {
+                    size_t begin = std::max(range.begin, begin_mark);
+                    size_t end = std::min(range.end, end_mark);
+                    if (begin < end)
+                        interval_part.ranges.emplace_back(begin, end);
+                }
+
+                if (interval_part.ranges.empty())
+                    continue;
+
+                to_merge.emplace_back(std::make_shared<KeyRangeFilterBlockInputStream>(
+                    make_source_stream(interval_part), data.getSortDescription(),
+                    lower ? *lower : KeyTuple{}, upper ? *upper : KeyTuple{}));
+            }
+
+            if (!to_merge.empty())
+                res.emplace_back(merge_streams(to_merge));
+        }
+
+        LOG_DEBUG(log, "Reading FINAL in " << res.size() << " disjoint key ranges");
+        return res;
     }
 
+    BlockInputStreams to_merge;
+    for (const RangesInDataPart & part : parts)
+        to_merge.emplace_back(make_source_stream(part));
+
+    if (!to_merge.empty())
+        res.emplace_back(merge_streams(to_merge));
+
     return res;
 }
 
@@ -874,7 +1480,7 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
     MarkRanges res;
 
     size_t used_key_size = key_condition.getMaxKeyColumn() + 1;
-    size_t marks_count = index.at(0)->size();
+    size_t marks_count = index.marksCount();
 
     /// If index is not used.
     if (key_condition.alwaysUnknownOrTrue())
@@ -904,7 +1510,7 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
             {
                 for (size_t i = 0; i < used_key_size; ++i)
                 {
-                    index[i]->get(range.begin, index_left[i]);
+                    index.get(i, range.begin, index_left[i]);
                 }
 
                 may_be_true = key_condition.mayBeTrueAfter(
@@ -914,8 +1520,8 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
             {
                 for (size_t i = 0; i < used_key_size; ++i)
                 {
-                    index[i]->get(range.begin, index_left[i]);
-                    index[i]->get(range.end, index_right[i]);
+                    index.get(i, range.begin, index_left[i]);
+                    index.get(i, range.end, index_right[i]);
                 }
 
                 may_be_true = key_condition.mayBeTrueInRange(
@@ -950,4 +1556,71 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
     return res;
 }
 
+
+MarkRanges MergeTreeDataSelectExecutor::filterMarkRangesUsingSkipIndex(
+    const MergeTreeData::DataPartPtr & part,
+    const PKCondition & skip_idx_condition,
+    const MarkRanges & ranges,
+    const Settings & settings) const
+{
+    const MergeTreeDataPart::SkipIndex & idx = part->skip_idx;
+
+    /// The part could have been written before the index was configured.
+    if (!idx.initialized)
+        return ranges;
+
+    size_t min_marks_for_seek = (settings.merge_tree_min_rows_for_seek + data.index_granularity - 1) / data.index_granularity;
+
+    const size_t granules_per_block = data.settings.skip_index_granularity;
+    const size_t key_size = data.skip_idx_columns.size();
+    const size_t blocks_count = idx.granuleBlocksCount();
+
+    MarkRanges res;
+    size_t granules_dropped = 0;
+
+    /// NOTE Creating temporary Field objects to pass to PKCondition.
+    Row index_left(key_size);
+    Row index_right(key_size);
+
+    for (const MarkRange & range : ranges)
+    {
+        for (size_t mark = range.begin; mark < range.end;)
+        {
+            size_t block = mark / granules_per_block;
+            size_t block_end_mark = std::min((block + 1) * granules_per_block, range.end);
+
+            bool may_be_true = true;
+            if (block < blocks_count)
+            {
+                for (size_t i = 0; i < key_size; ++i)
+                {
+                    index_left[i] = idx.min_values[i][block];
+                    index_right[i] = idx.max_values[i][block];
+                }
+
+                may_be_true = skip_idx_condition.mayBeTrueInRange(
+                    key_size, &index_left[0], &index_right[0], data.skip_idx_column_types);
+            }
+
+            if (may_be_true)
+            {
+                /// Either glue the block to the last range, or start a new range - same as for the primary key.
+                if (res.empty() || mark - res.back().end > min_marks_for_seek)
+                    res.push_back(MarkRange(mark, block_end_mark));
+                else
+                    res.back().end = block_end_mark;
+            }
+            else
+                granules_dropped += block_end_mark - mark;
+
+            mark = block_end_mark;
+        }
+    }
+
+    if (granules_dropped)
+        LOG_DEBUG(log, "Skip index has dropped " << granules_dropped << " granules for part " << part->name);
+
+    return res;
+}
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <experimental/optional>
+
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <Storages/MergeTree/RangesInDataPart.h>
 
@@ -30,9 +32,35 @@ public:
         size_t * inout_part_index,    /// If not nullptr, from this counter values are taken for the virtual column _part_index.
         Int64 max_block_number_to_read) const;
 
+    /** Returns the exact number of rows matching the query, if it can be computed from the part
+      *  metadata alone: the query must either have no WHERE at all, or a WHERE on the partitioning
+      *  columns that holds or fails for every part as a whole (judged by the minmax index).
+      */
+    std::experimental::optional<UInt64> countRowsByMetadata(
+        const SelectQueryInfo & query_info,
+        const Context & context) const;
+
+    /** Returns the exact minimum (is_min) or maximum of a column, under the same conditions as
+      *  `countRowsByMetadata`; additionally, the column must be one of the minmax index columns.
+      * For an empty set of matching rows, returns Null.
+      */
+    std::experimental::optional<Field> extremeOfColumnByMetadata(
+        bool is_min,
+        const String & column_name,
+        const SelectQueryInfo & query_info,
+        const Context & context) const;
+
 private:
     MergeTreeData & data;
 
+    /** The parts every row of which matches the WHERE of the query (the remaining parts are
+      *  guaranteed to contain no matching rows), or nothing if this cannot be established
+      *  from the minmax index - see `countRowsByMetadata`.
+      */
+    std::experimental::optional<MergeTreeData::DataPartsVector> partsFullyMatchingQuery(
+        const SelectQueryInfo & query_info,
+        const Context & context) const;
+
     Logger * log;
 
     BlockInputStreams spreadMarkRangesAmongStreams(
@@ -46,8 +74,21 @@ private:
         const Names & virt_columns,
         const Settings & settings) const;
 
+    BlockInputStreams spreadMarkRangesAmongStreamsInPKOrder(
+        RangesInDataParts parts,
+        size_t num_streams,
+        const Names & column_names,
+        size_t max_block_size,
+        bool use_uncompressed_cache,
+        ExpressionActionsPtr prewhere_actions,
+        const String & prewhere_column,
+        const Names & virt_columns,
+        const Settings & settings,
+        bool reverse) const;
+
     BlockInputStreams spreadMarkRangesAmongStreamsFinal(
         RangesInDataParts parts,
+        size_t num_streams,
         const Names & column_names,
         size_t max_block_size,
         bool use_uncompressed_cache,
@@ -73,6 +114,14 @@ private:
         const MergeTreeData::DataPart::Index & index,
         const PKCondition & key_condition,
         const Settings & settings) const;
+
+    /// Removes from `ranges` the mark subranges for which the part's skip index
+    /// guarantees that the condition cannot be true.
+    MarkRanges filterMarkRangesUsingSkipIndex(
+        const MergeTreeData::DataPartPtr & part,
+        const PKCondition & skip_idx_condition,
+        const MarkRanges & ranges,
+        const Settings & settings) const;
 };
 
 }
@@ -1,5 +1,6 @@
 #include <Storages/MergeTree/MergeTreeDataWriter.h>
 #include <Storages/MergeTree/MergedBlockOutputStream.h>
+#include <DataStreams/OneBlockInputStream.h>
 #include <Common/escapeForFileName.h>
 #include <Common/HashTable/HashMap.h>
 #include <Interpreters/AggregationCommon.h>
@@ -120,7 +121,7 @@ BlocksWithPartition MergeTreeDataWriter::splitBlockIntoParts(const Block & block
     return result;
 }
 
-MergeTreeData::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(BlockWithPartition & block_with_partition)
+MergeTreeData::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(BlockWithPartition & block_with_partition, bool presorted)
 {
     Block & block = block_with_partition.block;
 
@@ -157,6 +158,14 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(BlockWithPa
     MergeTreeData::MutableDataPartPtr new_data_part = std::make_shared<MergeTreeData::DataPart>(data, part_name, new_part_info);
     new_data_part->partition = std::move(partition);
     new_data_part->minmax_idx = std::move(minmax_idx);
+
+    /// Min/max of the configured statistics expressions (see the part_minmax_expressions setting).
+    if (data.part_minmax_expr)
+    {
+        Block block_copy = block;
+        data.part_minmax_expr->execute(block_copy);
+        new_data_part->part_minmax_stats.update(block_copy, data.part_minmax_columns);
+    }
     new_data_part->relative_path = TMP_PREFIX + part_name;
     new_data_part->is_temp = true;
 
@@ -176,7 +185,7 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(BlockWithPa
     if (data.merging_params.mode != MergeTreeData::MergingParams::Unsorted)
         data.getPrimaryExpression()->execute(block);
 
-    SortDescription sort_descr = data.getSortDescription();
+    const SortDescription & sort_descr = data.getSortDescription();
 
     ProfileEvents::increment(ProfileEvents::MergeTreeDataWriterBlocks);
 
@@ -185,13 +194,15 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(BlockWithPa
     IColumn::Permutation perm;
     if (data.merging_params.mode != MergeTreeData::MergingParams::Unsorted)
     {
-        if (!isAlreadySorted(block, sort_descr))
+        /// If the INSERT declared its blocks sorted by the primary key, trust it and skip
+        ///  even the per-row verification.
+        if (presorted || isAlreadySorted(block, sort_descr))
+            ProfileEvents::increment(ProfileEvents::MergeTreeDataWriterBlocksAlreadySorted);
+        else
         {
             stableGetPermutation(block, sort_descr, perm);
             perm_ptr = &perm;
         }
-        else
-            ProfileEvents::increment(ProfileEvents::MergeTreeDataWriterBlocksAlreadySorted);
     }
 
     /// This effectively chooses minimal compression method:
@@ -199,12 +210,25 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataWriter::writeTempPart(BlockWithPa
     auto compression_method = data.context.chooseCompressionMethod(0, 0);
 
     NamesAndTypesList columns = data.getColumnsList().filter(block.getColumnsList().getNames());
-    MergedBlockOutputStream out(data, new_data_part->getFullPath(), columns, compression_method);
+
+    /// Small blocks are written as compact parts: a single data file instead of a pair of files
+    ///  per column. Merges will convert them to the classic wide format as they grow.
+    bool write_compact_part = data.settings.min_bytes_for_wide_part
+        && block.bytes() < data.settings.min_bytes_for_wide_part;
+
+    MergedBlockOutputStream out(data, new_data_part->getFullPath(), columns, compression_method,
+        data.chooseIndexGranularity(block.bytes(), block.rows()), write_compact_part);
 
     out.writePrefix();
     out.writeWithPermutation(block, perm_ptr);
     out.writeSuffixAndFinalizePart(new_data_part);
 
+    if (data.projection_query)
+    {
+        data.buildProjection(new_data_part->getFullPath(), std::make_shared<OneBlockInputStream>(block));
+        new_data_part->projection_exists = true;
+    }
+
     ProfileEvents::increment(ProfileEvents::MergeTreeDataWriterRows, block.rows());
     ProfileEvents::increment(ProfileEvents::MergeTreeDataWriterUncompressedBytes, block.bytes());
     ProfileEvents::increment(ProfileEvents::MergeTreeDataWriterCompressedBytes, new_data_part->size_in_bytes);
@@ -45,8 +45,10 @@ public:
 
     /** All rows must correspond to same partition.
       * Returns part with unique name starting with 'tmp_', yet not added to MergeTreeData.
+      * If `presorted`, the rows are trusted to be in the order of the primary key
+      *  and neither checked nor sorted (see the insert_sorted_by_primary_key setting).
       */
-    MergeTreeData::MutableDataPartPtr writeTempPart(BlockWithPartition & block);
+    MergeTreeData::MutableDataPartPtr writeTempPart(BlockWithPartition & block, bool presorted = false);
 
 private:
     MergeTreeData & data;
@@ -58,6 +58,17 @@ public:
         /// Stream is created for the type - internals of the array. Case when the array's content is an array is not supported.
         if (typeid_cast<const DataTypeArray *>(type.get()))
             throw Exception("Multidimensional arrays are not supported", ErrorCodes::NOT_IMPLEMENTED);
+
+        /// The column may have been written with a per-part ZSTD dictionary.
+        if (Poco::File(path + name + ".dict").exists())
+        {
+            String dictionary;
+            {
+                ReadBufferFromFile dict_buf(path + name + ".dict");
+                readStringUntilEOF(dictionary, dict_buf);
+            }
+            uncompressing_buf.setCompressionDictionary(dictionary);
+        }
     }
 
     bool marksEOF()
@@ -290,11 +301,12 @@ size_t checkColumn(
 
 void MergeTreePartChecker::checkDataPart(
     String path,
-    const Settings & settings,
+    const Settings & settings_,
     const DataTypes & primary_key_data_types,
     MergeTreeData::DataPart::Checksums * out_checksums,
     std::atomic<bool> * is_cancelled)
 {
+    Settings settings = settings_;
     CurrentMetrics::Increment metric_increment{CurrentMetrics::ReplicatedChecks};
 
     if (!path.empty() && path.back() != '/')
@@ -321,6 +333,24 @@ void MergeTreePartChecker::checkDataPart(
     /// Real checksum based on contents of data. Their discrepancy with checksums_txt will talk about broken data.
     MergeTreeData::DataPart::Checksums checksums_data;
 
+    if (Poco::File(path + "index_granularity.txt").exists())
+    {
+        /// The part was written with its own granularity (see the index_granularity_bytes setting).
+        ReadBufferFromFile file_buf(path + "index_granularity.txt");
+        HashingReadBuffer hashing_buf(file_buf);
+        readIntText(settings.index_granularity, hashing_buf);
+        assertEOF(hashing_buf);
+
+        checksums_data.files["index_granularity.txt"]
+            = MergeTreeData::DataPart::Checksums::Checksum(hashing_buf.count(), hashing_buf.getHash());
+    }
+
+    /// Compact parts store all columns in a single data file; it is verified below by its raw hash,
+    ///  and the number of rows is taken from the offset table.
+    MergeTreeDataPart::CompactOffsets compact_offsets;
+    if (Poco::File(path + "offsets.txt").exists())
+        compact_offsets.load(path);
+
     size_t marks_in_primary_key = 0;
     {
         ReadBufferFromFile file_buf(path + "primary.idx");
@@ -377,7 +407,11 @@ void MergeTreePartChecker::checkDataPart(
                             ErrorCodes::SIZES_OF_COLUMNS_DOESNT_MATCH};
     };
 
-    for (const NameAndTypePair & column : columns)
+    if (compact_offsets.initialized)
+    {
+        rows = compact_offsets.rows;
+    }
+    else for (const NameAndTypePair & column : columns)
     {
         if (settings.verbose)
         {
@@ -455,6 +489,23 @@ void MergeTreePartChecker::checkDataPart(
                 ErrorCodes::CORRUPTED_DATA);
     }
 
+    /// Files that are not parsed above (partition.dat, minmax and skip indexes, the data file
+    ///  and the offset table of compact parts) are verified by their raw hash.
+    for (const auto & it : checksums_txt.files)
+    {
+        const String & file_name = it.first;
+        if (checksums_data.files.count(file_name))
+            continue;
+
+        if (is_cancelled && *is_cancelled)
+            return;
+
+        ReadBufferFromFile file_buf(path + file_name);
+        HashingReadBuffer hashing_buf(file_buf);
+        hashing_buf.tryIgnore(std::numeric_limits<size_t>::max());
+        checksums_data.files[file_name] = MergeTreeData::DataPart::Checksums::Checksum(hashing_buf.count(), hashing_buf.getHash());
+    }
+
     if (settings.require_checksums || !checksums_txt.files.empty())
         checksums_txt.checkEqual(checksums_data, true);
 
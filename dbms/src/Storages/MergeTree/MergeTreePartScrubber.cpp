@@ -0,0 +1,181 @@
+#include <Storages/MergeTree/MergeTreePartScrubber.h>
+#include <Storages/MergeTree/MergeTreePartChecker.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/WriteBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <Poco/File.h>
+
+
+namespace DB
+{
+
+static constexpr auto SCRUB_STATE_FILE_NAME = "scrub_state.txt";
+
+
+MergeTreePartScrubber::MergeTreePartScrubber(MergeTreeData & data_, CorruptionCallback on_corruption_)
+    : data(data_), on_corruption(std::move(on_corruption_)),
+    log(&Logger::get(data.getLogName() + " (PartScrubber)"))
+{
+}
+
+
+bool MergeTreePartScrubber::run()
+{
+    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return false;
+
+    time_t now = time(nullptr);
+    if (now < next_scrub_time)
+        return false;
+
+    if (!state_loaded)
+    {
+        loadState();
+        state_loaded = true;
+    }
+
+    MergeTreeData::DataPartPtr part = selectPartToScrub(now);
+    if (!part)
+        return false;
+
+    try
+    {
+        std::shared_lock<std::shared_mutex> part_lock(part->columns_lock);
+
+        MergeTreePartChecker::Settings settings;
+        settings.setIndexGranularity(data.index_granularity);
+        settings.setRequireChecksums(true);
+        settings.setRequireColumnFiles(true);
+
+        MergeTreePartChecker::checkDataPart(
+            data.getFullPath() + part->name, settings, data.primary_key_data_types, nullptr, &is_cancelled);
+
+        if (is_cancelled)
+            return false;
+
+        LOG_TRACE(log, "Part " << part->name << " passed scrubbing.");
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, "Part " + part->name + " failed scrubbing");
+
+        last_checked[part->name] = now;
+        saveState();
+
+        if (on_corruption)
+            on_corruption(part);
+
+        return true;
+    }
+
+    last_checked[part->name] = now;
+    saveState();
+
+    /// Trickle: delay the next check so that the average read rate stays at the configured level.
+    if (size_t rate = data.settings.background_scrub_bytes_per_second)
+        next_scrub_time = time(nullptr) + part->size_in_bytes / rate;
+
+    return true;
+}
+
+
+MergeTreeData::DataPartPtr MergeTreePartScrubber::selectPartToScrub(time_t now)
+{
+    time_t recheck_period = data.settings.background_scrub_recheck_period_hours * 3600;
+
+    MergeTreeData::DataParts parts = data.getDataParts();
+
+    /// Forget the parts that no longer exist (e.g. were merged).
+    std::set<String> part_names;
+    for (const auto & part : parts)
+        part_names.insert(part->name);
+    for (auto it = last_checked.begin(); it != last_checked.end();)
+    {
+        if (!part_names.count(it->first))
+            it = last_checked.erase(it);
+        else
+            ++it;
+    }
+
+    MergeTreeData::DataPartPtr best;
+    time_t best_checked = 0;
+    bool best_never_read = false;
+
+    for (const auto & part : parts)
+    {
+        auto it = last_checked.find(part->name);
+        time_t checked = it != last_checked.end() ? it->second : 0;
+
+        if (checked + recheck_period > now)
+            continue;
+
+        bool never_read = part->last_read_time == 0;
+
+        if (!best
+            || (never_read && !best_never_read)
+            || (never_read == best_never_read && checked < best_checked))
+        {
+            best = part;
+            best_checked = checked;
+            best_never_read = never_read;
+        }
+    }
+
+    return best;
+}
+
+
+void MergeTreePartScrubber::loadState()
+{
+    String path = data.getFullPath() + SCRUB_STATE_FILE_NAME;
+
+    if (!Poco::File(path).exists())
+        return;
+
+    try
+    {
+        ReadBufferFromFile in(path);
+        while (!in.eof())
+        {
+            String name;
+            Int64 checked;
+
+            readEscapedString(name, in);
+            assertChar('\t', in);
+            readIntText(checked, in);
+            assertChar('\n', in);
+
+            last_checked[name] = checked;
+        }
+    }
+    catch (...)
+    {
+        /// A damaged state file only makes the parts be rechecked earlier.
+        tryLogCurrentException(log, "Cannot read " + path);
+        last_checked.clear();
+    }
+}
+
+
+void MergeTreePartScrubber::saveState()
+{
+    String path = data.getFullPath() + SCRUB_STATE_FILE_NAME;
+    String tmp_path = path + ".tmp";
+
+    {
+        WriteBufferFromFile out(tmp_path, 4096);
+        for (const auto & it : last_checked)
+        {
+            writeEscapedString(it.first, out);
+            writeChar('\t', out);
+            writeIntText(static_cast<Int64>(it.second), out);
+            writeChar('\n', out);
+        }
+    }
+
+    Poco::File(tmp_path).renameTo(path);
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <Storages/MergeTree/MergeTreeData.h>
+
+
+namespace DB
+{
+
+/** Continuously verifies the data of the parts against their checksums.txt in the background
+  *  (scrubbing), so that silent disk corruption is found before a merge propagates it.
+  * Executed as a task of BackgroundProcessingPool; reads no more than the configured number of
+  *  bytes per second on average (see the background_scrub_bytes_per_second setting) by delaying
+  *  the next check after verifying a part.
+  * Parts never read by queries are checked first: queries verify the checksums of the compressed
+  *  blocks they read anyway, so cold parts are the most likely to hide corruption.
+  * The time of the last successful check of each part is kept in the `scrub_state.txt` file
+  *  in the table directory, so scrubbing continues where it stopped after a restart.
+  */
+class MergeTreePartScrubber
+{
+public:
+    /// Called for a part that failed verification (e.g. to queue a re-fetch from a replica).
+    /// The failure itself is logged unconditionally.
+    using CorruptionCallback = std::function<void(const MergeTreeData::DataPartPtr &)>;
+
+    MergeTreePartScrubber(MergeTreeData & data_, CorruptionCallback on_corruption_ = {});
+
+    /// Verifies at most one part. Returns true if some part was checked.
+    bool run();
+
+    void cancel() { is_cancelled = true; }
+
+private:
+    MergeTreeData & data;
+    CorruptionCallback on_corruption;
+    Logger * log;
+
+    std::atomic<bool> is_cancelled {false};
+
+    /// The pool can call the task from several threads; an extra caller leaves at once.
+    std::mutex mutex;
+
+    time_t next_scrub_time = 0;
+
+    bool state_loaded = false;
+    /// Part name -> time of the last check (successful or not - broken parts are not rechecked in a loop).
+    std::map<String, time_t> last_checked;
+
+    MergeTreeData::DataPartPtr selectPartToScrub(time_t now);
+
+    void loadState();
+    void saveState();
+};
+
+}
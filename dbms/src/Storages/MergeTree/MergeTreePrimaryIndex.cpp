@@ -0,0 +1,217 @@
+#include <Storages/MergeTree/MergeTreePrimaryIndex.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <Common/PODArray.h>
+#include <Common/typeid_cast.h>
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
+
+
+namespace DB
+{
+
+namespace
+{
+
+/// A column of an unsupported type, or one that the compact encodings do not shrink. Kept as is.
+class PlainIndexColumn : public MergeTreePrimaryIndex::IIndexColumn
+{
+public:
+    explicit PlainIndexColumn(const ColumnPtr & column_) : column(column_) {}
+
+    size_t size() const override { return column->size(); }
+    void get(size_t mark, Field & res) const override { column->get(mark, res); }
+    size_t byteSize() const override { return column->byteSize(); }
+
+private:
+    ColumnPtr column;
+};
+
+
+/// An integer column as a minimum plus per-mark deltas of a narrower byte width.
+template <typename T, typename DeltaT>
+class IntegerIndexColumn : public MergeTreePrimaryIndex::IIndexColumn
+{
+public:
+    /// Deltas are computed in the unsigned type of the same width, so that they never overflow.
+    using UnsignedT = typename std::make_unsigned<T>::type;
+
+    IntegerIndexColumn(const typename ColumnVector<T>::Container_t & data, T min_value_)
+        : min_value(min_value_)
+    {
+        deltas.reserve(data.size());
+        for (size_t i = 0; i < data.size(); ++i)
+            deltas.push_back(static_cast<DeltaT>(static_cast<UnsignedT>(data[i]) - static_cast<UnsignedT>(min_value)));
+    }
+
+    size_t size() const override { return deltas.size(); }
+
+    void get(size_t mark, Field & res) const override
+    {
+        T value = static_cast<T>(static_cast<UnsignedT>(min_value) + deltas[mark]);
+        res = typename NearestFieldType<T>::Type(value);
+    }
+
+    size_t byteSize() const override { return deltas.size() * sizeof(DeltaT) + sizeof(min_value); }
+
+private:
+    T min_value;
+    PODArray<DeltaT> deltas;
+};
+
+
+/// A String column, prefix-compressed with restarts: every restart_interval-th value is stored
+///  in full, the values in between keep the length of the prefix shared with the preceding full
+///  value and the remaining suffix. Any value is reconstructed from at most two pieces.
+class StringIndexColumn : public MergeTreePrimaryIndex::IIndexColumn
+{
+public:
+    static constexpr size_t restart_interval = 16;
+
+    explicit StringIndexColumn(const ColumnString & column)
+    {
+        size_t rows = column.size();
+        prefix_lengths.reserve(rows);
+        offsets.reserve(rows);
+
+        StringRef restart;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            StringRef value = column.getDataAt(i);
+
+            size_t prefix_length = 0;
+            if (i % restart_interval == 0)
+                restart = value;
+            else
+            {
+                size_t max_prefix = std::min(value.size, restart.size);
+                while (prefix_length < max_prefix && value.data[prefix_length] == restart.data[prefix_length])
+                    ++prefix_length;
+            }
+
+            prefix_lengths.push_back(prefix_length);
+            data.insert(value.data + prefix_length, value.data + value.size);
+            offsets.push_back(data.size());
+        }
+    }
+
+    size_t size() const override { return offsets.size(); }
+
+    void get(size_t mark, Field & res) const override
+    {
+        size_t suffix_begin = mark ? offsets[mark - 1] : 0;
+        size_t suffix_length = offsets[mark] - suffix_begin;
+        size_t prefix_length = prefix_lengths[mark];
+
+        String value;
+        value.reserve(prefix_length + suffix_length);
+
+        if (prefix_length)
+        {
+            /// The restart value is stored in full, so its bytes lie contiguously in `data`.
+            size_t restart = mark / restart_interval * restart_interval;
+            value.append(&data[restart ? offsets[restart - 1] : 0], prefix_length);
+        }
+
+        value.append(&data[suffix_begin], suffix_length);
+        res = std::move(value);
+    }
+
+    size_t byteSize() const override
+    {
+        return data.allocated_bytes() + offsets.allocated_bytes() + prefix_lengths.allocated_bytes();
+    }
+
+private:
+    PODArray<char> data;            /// Concatenated suffixes.
+    PODArray<UInt64> offsets;       /// End of each suffix in `data`.
+    PODArray<UInt32> prefix_lengths;
+};
+
+
+template <typename T>
+MergeTreePrimaryIndex::IndexColumnPtr tryCompactIntegerColumn(const IColumn & column)
+{
+    const ColumnVector<T> * concrete = typeid_cast<const ColumnVector<T> *>(&column);
+    if (!concrete || concrete->getData().empty())
+        return nullptr;
+
+    using UnsignedT = typename std::make_unsigned<T>::type;
+
+    const auto & data = concrete->getData();
+    auto minmax = std::minmax_element(data.begin(), data.end());
+    T min_value = *minmax.first;
+    UInt64 range = static_cast<UnsignedT>(*minmax.second) - static_cast<UnsignedT>(min_value);
+
+    if (range <= 0xFF && sizeof(T) > 1)
+        return std::make_unique<IntegerIndexColumn<T, UInt8>>(data, min_value);
+    if (range <= 0xFFFF && sizeof(T) > 2)
+        return std::make_unique<IntegerIndexColumn<T, UInt16>>(data, min_value);
+    if (range <= 0xFFFFFFFF && sizeof(T) > 4)
+        return std::make_unique<IntegerIndexColumn<T, UInt32>>(data, min_value);
+
+    return nullptr;
+}
+
+
+MergeTreePrimaryIndex::IndexColumnPtr compactColumn(const ColumnPtr & column)
+{
+    MergeTreePrimaryIndex::IndexColumnPtr compact;
+
+    if (const ColumnString * column_string = typeid_cast<const ColumnString *>(column.get()))
+        compact = std::make_unique<StringIndexColumn>(*column_string);
+    else if (auto res = tryCompactIntegerColumn<UInt16>(*column))
+        compact = std::move(res);
+    else if (auto res = tryCompactIntegerColumn<UInt32>(*column))
+        compact = std::move(res);
+    else if (auto res = tryCompactIntegerColumn<UInt64>(*column))
+        compact = std::move(res);
+    else if (auto res = tryCompactIntegerColumn<Int16>(*column))
+        compact = std::move(res);
+    else if (auto res = tryCompactIntegerColumn<Int32>(*column))
+        compact = std::move(res);
+    else if (auto res = tryCompactIntegerColumn<Int64>(*column))
+        compact = std::move(res);
+
+    /// Uncompressible data (e.g. Strings without common prefixes) could make the encoding larger.
+    if (compact && compact->byteSize() < column->byteSize())
+        return compact;
+
+    return std::make_unique<PlainIndexColumn>(column);
+}
+
+}
+
+
+void MergeTreePrimaryIndex::assign(const Columns & columns)
+{
+    std::vector<IndexColumnPtr> new_columns;
+    new_columns.reserve(columns.size());
+
+    for (const auto & column : columns)
+        new_columns.push_back(compactColumn(column));
+
+    index_columns.swap(new_columns);
+}
+
+
+ColumnPtr MergeTreePrimaryIndex::materializeColumn(size_t column, const DataTypePtr & type) const
+{
+    ColumnPtr res = type->createColumn();
+
+    size_t rows = index_columns.at(column)->size();
+    res->reserve(rows);
+
+    Field value;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        index_columns[column]->get(i, value);
+        res->insert(value);
+    }
+
+    return res;
+}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <Core/Field.h>
+#include <Columns/IColumn.h>
+#include <DataTypes/IDataType.h>
+
+
+namespace DB
+{
+
+/** The primary index of one part: the value of every key column at the first row of each granule.
+  *
+  * An index is kept in memory for every active part of every table, so its representation matters:
+  *  on a server with tens of thousands of parts, plain key columns take gigabytes, mostly for
+  *  String keys with long shared prefixes. Therefore the key columns are re-encoded on load:
+  *  - integer columns are stored as a minimum plus per-mark deltas of the narrowest sufficient
+  *    byte width (frame of reference);
+  *  - String columns are prefix-compressed: every restart_interval-th value is stored in full,
+  *    the values in between keep only the length of the prefix shared with the preceding full
+  *    value and the remaining suffix;
+  *  - columns of other types, and columns the encodings do not shrink, are kept as is.
+  * Values are addressed by mark number, so binary search over the index works unchanged,
+  *  at the cost of reconstructing a value per comparison.
+  */
+class MergeTreePrimaryIndex
+{
+public:
+    /// A single key column in one of the representations described above.
+    struct IIndexColumn
+    {
+        virtual ~IIndexColumn() {}
+
+        virtual size_t size() const = 0;
+
+        /// The value at the given mark, in the same form the original column would return it.
+        virtual void get(size_t mark, Field & res) const = 0;
+
+        virtual size_t byteSize() const = 0;
+    };
+
+    using IndexColumnPtr = std::unique_ptr<IIndexColumn>;
+
+    bool empty() const { return index_columns.empty(); }
+
+    void clear() { index_columns.clear(); }
+
+    /// The number of key columns (as for the plain Columns this class replaces).
+    size_t size() const { return index_columns.size(); }
+
+    /// The number of marks of the part.
+    size_t marksCount() const { return index_columns.empty() ? 0 : index_columns.front()->size(); }
+
+    /// The value of the key column at the given mark.
+    void get(size_t column, size_t mark, Field & res) const { index_columns[column]->get(mark, res); }
+
+    /// Memory occupied by the encoded columns.
+    size_t byteSize() const
+    {
+        size_t res = 0;
+        for (const auto & column : index_columns)
+            res += column->byteSize();
+        return res;
+    }
+
+    /// Replace the contents with a compact re-encoding of the given key columns.
+    void assign(const Columns & columns);
+
+    /// Reconstruct a full key column. For rare operations like ALTER of the primary key.
+    ColumnPtr materializeColumn(size_t column, const DataTypePtr & type) const;
+
+private:
+    std::vector<IndexColumnPtr> index_columns;
+};
+
+}
@@ -18,6 +18,9 @@ public:
 
     size_t readRowsInCurrentGranule() const { return read_rows_after_current_mark; }
 
+    /// Position of the next row to read, counted from the beginning of the part.
+    size_t currentRow() const { return current_mark * index_granularity + read_rows_after_current_mark; }
+
     /// Seek to next mark before next reading.
     size_t skipToNextMark();
     /// Seturn state will be afrer reading rows_to_read, no reading happens.
@@ -42,7 +42,16 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
     if (!tasks_remaining_for_this_thread && do_not_steal_tasks)
         return nullptr;
 
-    const auto thread_idx = tasks_remaining_for_this_thread ? thread : *std::begin(remaining_thread_tasks);
+    auto thread_idx = thread;
+    if (!tasks_remaining_for_this_thread)
+    {
+        /// Steal from the thread with the most remaining work: with a skewed distribution of mark ranges
+        ///  all idle threads then share the largest workload instead of draining the small ones first.
+        thread_idx = *std::begin(remaining_thread_tasks);
+        for (const auto idx : remaining_thread_tasks)
+            if (threads_tasks[idx].sum_marks > threads_tasks[thread_idx].sum_marks)
+                thread_idx = idx;
+    }
     auto & thread_tasks = threads_tasks[thread_idx];
 
     auto & thread_task = thread_tasks.parts_and_ranges.back();
@@ -72,6 +81,7 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
         ranges_to_get_from_part = thread_task.ranges;
 
         marks_in_part -= marks_to_get_from_range;
+        thread_tasks.sum_marks -= marks_to_get_from_range;
 
         thread_tasks.parts_and_ranges.pop_back();
         thread_tasks.sum_marks_in_parts.pop_back();
@@ -98,6 +108,7 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
             }
 
             marks_in_part -= marks_to_get_from_range;
+            thread_tasks.sum_marks -= marks_to_get_from_range;
             need_marks -= marks_to_get_from_range;
         }
 
@@ -329,6 +340,7 @@ void MergeTreeReadPool::fillPerThreadInfo(
 
             threads_tasks[i].parts_and_ranges.push_back({ part_idx, ranges_to_get_from_part });
             threads_tasks[i].sum_marks_in_parts.push_back(marks_in_ranges);
+            threads_tasks[i].sum_marks += marks_in_ranges;
             if (marks_in_ranges != 0)
                 remaining_thread_tasks.insert(i);
         }
@@ -17,6 +17,8 @@ using MergeTreeReadTaskPtr = std::unique_ptr<MergeTreeReadTask>;
  *    in "sequential" manner, requesting work in small batches. As soon as some thread has exhausted
  *    it's workload, it either is signaled that no more work is available (`do_not_steal_tasks == false`) or
  *    continues taking small batches from other threads' workloads (`do_not_steal_tasks == true`).
+ *    Batches are stolen from the thread with the most remaining work, so when the workloads are skewed
+ *    (e.g. one hot partition), the tail of the query is shared by all threads instead of one.
  */
 class MergeTreeReadPool : private boost::noncopyable
 {
@@ -119,6 +121,7 @@ private:
 
         std::vector<PartIndexAndRange> parts_and_ranges;
         std::vector<size_t> sum_marks_in_parts;
+        size_t sum_marks = 0;    /// Total marks left in this workload. Used to choose the victim for stealing.
     };
 
     std::vector<ThreadTask> threads_tasks;
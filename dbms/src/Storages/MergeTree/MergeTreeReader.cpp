@@ -6,6 +6,8 @@
 #include <Common/MemoryTracker.h>
 #include <IO/CachedCompressedReadBuffer.h>
 #include <IO/CompressedReadBufferFromFile.h>
+#include <IO/UncompressedCachePrefetcher.h>
+#include <IO/ReadHelpers.h>
 #include <Columns/ColumnArray.h>
 #include <Interpreters/evaluateMissingDefaults.h>
 #include <Storages/MergeTree/MergeTreeReader.h>
@@ -45,12 +47,12 @@ MergeTreeReader::MergeTreeReader(const String & path,
     const MergeTreeData::DataPartPtr & data_part, const NamesAndTypesList & columns,
     UncompressedCache * uncompressed_cache, MarkCache * mark_cache, bool save_marks_in_cache,
     MergeTreeData & storage, const MarkRanges & all_mark_ranges,
-    size_t aio_threshold, size_t max_read_buffer_size, const ValueSizeMap & avg_value_size_hints,
+    size_t aio_threshold, size_t mmap_threshold, size_t max_read_buffer_size, const ValueSizeMap & avg_value_size_hints,
     const ReadBufferFromFileBase::ProfileCallback & profile_callback,
     clockid_t clock_type)
     : avg_value_size_hints(avg_value_size_hints), path(path), data_part(data_part), columns(columns)
     , uncompressed_cache(uncompressed_cache), mark_cache(mark_cache), save_marks_in_cache(save_marks_in_cache), storage(storage)
-    , all_mark_ranges(all_mark_ranges), aio_threshold(aio_threshold), max_read_buffer_size(max_read_buffer_size)
+    , all_mark_ranges(all_mark_ranges), aio_threshold(aio_threshold), mmap_threshold(mmap_threshold), max_read_buffer_size(max_read_buffer_size)
 {
     try
     {
@@ -59,6 +61,23 @@ MergeTreeReader::MergeTreeReader(const String & path,
 
         for (const NameAndTypePair & column : columns)
             addStream(column.name, *column.type, all_mark_ranges, profile_callback, clock_type);
+
+        const Settings & settings = storage.context.getSettingsRef();
+
+        if (settings.async_block_checksums)
+            for (auto & stream : streams)
+                if (!stream.second->isEmpty())
+                    stream.second->setAsyncChecksumming();
+
+        if (uncompressed_cache && settings.merge_tree_prefetch_ahead_blocks)
+            for (auto & stream : streams)
+                if (!stream.second->isEmpty())
+                    stream.second->setPrefetchAhead(settings.merge_tree_prefetch_ahead_blocks);
+
+        if (settings.merge_tree_min_bytes_for_seek)
+            for (auto & stream : streams)
+                if (!stream.second->isEmpty())
+                    stream.second->setMaxGapToReadThrough(settings.merge_tree_min_bytes_for_seek);
     }
     catch (...)
     {
@@ -76,7 +95,7 @@ const MergeTreeReader::ValueSizeMap & MergeTreeReader::getAvgValueSizeHints() co
 
 MergeTreeRangeReader MergeTreeReader::readRange(size_t from_mark, size_t to_mark)
 {
-    return MergeTreeRangeReader(*this, from_mark, to_mark, storage.index_granularity);
+    return MergeTreeRangeReader(*this, from_mark, to_mark, data_part->index_granularity);
 }
 
 
@@ -145,8 +164,12 @@ size_t MergeTreeReader::readRows(size_t from_mark, bool continue_reading, size_t
             try
             {
                 size_t column_size_before_reading = column.column->size();
+                size_t column_bytes_before_reading = column.column->byteSize();
                 readData(column.name, *column.type, *column.column, from_mark, continue_reading, max_rows_to_read, 0, read_offsets);
                 read_rows = std::max(read_rows, column.column->size() - column_size_before_reading);
+
+                /// Account the uncompressed bytes delivered from the column, for system.parts_columns.
+                storage.addColumnReadBytes(column.name, column.column->byteSize() - column_bytes_before_reading);
             }
             catch (Exception & e)
             {
@@ -198,12 +221,31 @@ MergeTreeReader::Stream::Stream(
     const String & path_prefix_, const String & extension_, size_t marks_count_,
     const MarkRanges & all_mark_ranges,
     MarkCache * mark_cache_, bool save_marks_in_cache_,
-    UncompressedCache * uncompressed_cache,
-    size_t aio_threshold, size_t max_read_buffer_size,
-    const ReadBufferFromFileBase::ProfileCallback & profile_callback, clockid_t clock_type)
-    : path_prefix(path_prefix_), extension(extension_), marks_count(marks_count_)
-    , mark_cache(mark_cache_), save_marks_in_cache(save_marks_in_cache_)
+    UncompressedCache * uncompressed_cache_,
+    size_t aio_threshold, size_t mmap_threshold, size_t max_read_buffer_size,
+    const ReadBufferFromFileBase::ProfileCallback & profile_callback, clockid_t clock_type,
+    const MergeTreeDataPart::CompactOffsets * compact_offsets_, const String & part_path)
+    : path_prefix(path_prefix_), extension(extension_), compact_offsets(compact_offsets_), marks_count(marks_count_)
+    , mark_cache(mark_cache_), save_marks_in_cache(save_marks_in_cache_), uncompressed_cache(uncompressed_cache_)
 {
+    if (compact_offsets)
+    {
+        /// path_prefix is always the part path plus the escaped column name.
+        String file_name = path_prefix.substr(part_path.size());
+        data_path = part_path + "data.bin";
+
+        const auto & data_region = compact_offsets->getRegion(file_name + extension);
+        data_offset = data_region.offset;
+        data_size = data_region.size;
+
+        const auto & marks_region = compact_offsets->getRegion(
+            file_name + (isNullStream(extension) ? ".null.mrk" : ".mrk"));
+        marks_region_offset = marks_region.offset;
+        marks_region_size = marks_region.size;
+    }
+    else
+        data_path = path_prefix + extension;
+
     /// Compute the size of the buffer.
     size_t max_mark_range = 0;
 
@@ -242,7 +284,7 @@ MergeTreeReader::Stream::Stream(
 
     /// Estimate size of the data to be read.
     size_t estimated_size = 0;
-    if (aio_threshold > 0)
+    if (aio_threshold > 0 || mmap_threshold > 0)
     {
         for (const auto & mark_range : all_mark_ranges)
         {
@@ -252,7 +294,7 @@ MergeTreeReader::Stream::Stream(
 
             size_t offset_end = (mark_range.end < marks_count)
                 ? getMark(mark_range.end).offset_in_compressed_file
-                : Poco::File(path_prefix + extension).getSize();
+                : (compact_offsets ? data_size : Poco::File(data_path).getSize());
 
             if (offset_end > offset_begin)
                 estimated_size += offset_end - offset_begin;
@@ -263,7 +305,7 @@ MergeTreeReader::Stream::Stream(
     if (uncompressed_cache)
     {
         auto buffer = std::make_unique<CachedCompressedReadBuffer>(
-            path_prefix + extension, uncompressed_cache, estimated_size, aio_threshold, buffer_size);
+            data_path, uncompressed_cache, estimated_size, aio_threshold, mmap_threshold, buffer_size);
 
         if (profile_callback)
             buffer->setProfileCallback(profile_callback, clock_type);
@@ -274,7 +316,7 @@ MergeTreeReader::Stream::Stream(
     else
     {
         auto buffer = std::make_unique<CompressedReadBufferFromFile>(
-            path_prefix + extension, estimated_size, aio_threshold, buffer_size);
+            data_path, estimated_size, aio_threshold, mmap_threshold, buffer_size);
 
         if (profile_callback)
             buffer->setProfileCallback(profile_callback, clock_type);
@@ -282,6 +324,50 @@ MergeTreeReader::Stream::Stream(
         non_cached_buffer = std::move(buffer);
         data_buffer = non_cached_buffer.get();
     }
+
+    /// The column may have been written with a per-part ZSTD dictionary (see the zstd_dictionary_columns
+    ///  setting); it is needed to decompress the blocks marked with CompressionMethodByte::ZSTD_DICT.
+    if (!compact_offsets && !isNullStream(extension))
+    {
+        String dictionary_path = path_prefix + ".dict";
+        if (Poco::File(dictionary_path).exists())
+        {
+            String dictionary;
+            {
+                ReadBufferFromFile in(dictionary_path);
+                readStringUntilEOF(dictionary, in);
+            }
+
+            if (cached_buffer)
+                cached_buffer->setCompressionDictionary(dictionary);
+            if (non_cached_buffer)
+                non_cached_buffer->setCompressionDictionary(dictionary);
+
+            has_dictionary = true;
+        }
+    }
+}
+
+void MergeTreeReader::Stream::setAsyncChecksumming()
+{
+    if (cached_buffer)
+        cached_buffer->setAsyncChecksumming();
+    if (non_cached_buffer)
+        non_cached_buffer->setAsyncChecksumming();
+}
+
+void MergeTreeReader::Stream::setPrefetchAhead(size_t blocks)
+{
+    if (cached_buffer && !has_dictionary)
+        prefetch_ahead = blocks;
+}
+
+void MergeTreeReader::Stream::setMaxGapToReadThrough(size_t max_gap)
+{
+    if (cached_buffer)
+        cached_buffer->setMaxGapToReadThrough(max_gap);
+    if (non_cached_buffer)
+        non_cached_buffer->setMaxGapToReadThrough(max_gap);
 }
 
 std::unique_ptr<MergeTreeReader::Stream> MergeTreeReader::Stream::createEmptyPtr()
@@ -291,7 +377,7 @@ std::unique_ptr<MergeTreeReader::Stream> MergeTreeReader::Stream::createEmptyPtr
     return res;
 }
 
-const MarkInCompressedFile & MergeTreeReader::Stream::getMark(size_t index)
+MarkInCompressedFile MergeTreeReader::Stream::getMark(size_t index)
 {
     if (!marks)
         loadMarks();
@@ -300,6 +386,8 @@ const MarkInCompressedFile & MergeTreeReader::Stream::getMark(size_t index)
 
 void MergeTreeReader::Stream::loadMarks()
 {
+    /// For compact parts this is a virtual path used only as a key in the mark cache;
+    ///  the marks themselves are read from their region of the single data file.
     std::string path;
 
     if (isNullStream(extension))
@@ -312,22 +400,32 @@ void MergeTreeReader::Stream::loadMarks()
         /// Memory for marks must not be accounted as memory usage for query, because they are stored in shared cache.
         TemporarilyDisableMemoryTracker temporarily_disable_memory_tracker;
 
-        size_t file_size = Poco::File(path).getSize();
+        size_t file_size = compact_offsets ? marks_region_size : Poco::File(path).getSize();
         size_t expected_file_size = sizeof(MarkInCompressedFile) * marks_count;
         if (expected_file_size != file_size)
             throw Exception(
                     "bad size of marks file `" + path + "':" + std::to_string(file_size) + ", must be: "  + std::to_string(expected_file_size),
                     ErrorCodes::CORRUPTED_DATA);
 
-        auto res = std::make_shared<MarksInCompressedFile>(marks_count);
+        MarksInCompressedFile raw_marks(marks_count);
 
-        /// Read directly to marks.
-        ReadBufferFromFile buffer(path, file_size, -1, reinterpret_cast<char *>(res->data()));
+        if (compact_offsets)
+        {
+            ReadBufferFromFile buffer(data_path, std::min<size_t>(file_size, DBMS_DEFAULT_BUFFER_SIZE));
+            buffer.seek(marks_region_offset);
+            buffer.readStrict(reinterpret_cast<char *>(raw_marks.data()), file_size);
+        }
+        else
+        {
+            /// Read directly to marks.
+            ReadBufferFromFile buffer(path, file_size, -1, reinterpret_cast<char *>(raw_marks.data()));
 
-        if (buffer.eof() || buffer.buffer().size() != file_size)
-            throw Exception("Cannot read all marks from file " + path, ErrorCodes::CANNOT_READ_ALL_DATA);
+            if (buffer.eof() || buffer.buffer().size() != file_size)
+                throw Exception("Cannot read all marks from file " + path, ErrorCodes::CANNOT_READ_ALL_DATA);
+        }
 
-        return res;
+        /// Re-encode compactly, so that more marks fit in the cache.
+        return std::make_shared<CompactMarksInCompressedFile>(raw_marks);
     };
 
     if (mark_cache)
@@ -335,6 +433,10 @@ void MergeTreeReader::Stream::loadMarks()
         auto key = mark_cache->hash(path);
         if (save_marks_in_cache)
         {
+            /// Virtual paths of compact parts do not exist on disk and cannot be warmed after restart.
+            if (!compact_offsets)
+                mark_cache->recordFile(key, path);
+
             marks = mark_cache->getOrSet(key, load);
         }
         else
@@ -356,12 +458,19 @@ void MergeTreeReader::Stream::seekToMark(size_t index)
 {
     MarkInCompressedFile mark = getMark(index);
 
+    /// Start decompressing the blocks we are about to read into the cache on background threads.
+    if (prefetch_ahead)
+        UncompressedCachePrefetcher::instance().submit(
+            data_path, data_offset + mark.offset_in_compressed_file, uncompressed_cache, prefetch_ahead);
+
     try
     {
+        /// Mark offsets are relative to the beginning of the stream's data
+        ///  (which is not the beginning of the file for compact parts).
         if (cached_buffer)
-            cached_buffer->seek(mark.offset_in_compressed_file, mark.offset_in_decompressed_block);
+            cached_buffer->seek(data_offset + mark.offset_in_compressed_file, mark.offset_in_decompressed_block);
         if (non_cached_buffer)
-            non_cached_buffer->seek(mark.offset_in_compressed_file, mark.offset_in_decompressed_block);
+            non_cached_buffer->seek(data_offset + mark.offset_in_compressed_file, mark.offset_in_decompressed_block);
     }
     catch (Exception & e)
     {
@@ -383,8 +492,13 @@ void MergeTreeReader::addStream(const String & name, const IDataType & type, con
 {
     String escaped_column_name = escapeForFileName(name);
 
+    const MergeTreeDataPart::CompactOffsets * compact_offsets
+        = data_part->isCompactFormat() ? &data_part->compact_offsets : nullptr;
+
     const DataTypeArray * type_arr = typeid_cast<const DataTypeArray *>(&type);
-    bool data_file_exists = Poco::File(path + escaped_column_name + DATA_FILE_EXTENSION).exists();
+    bool data_file_exists = compact_offsets
+        ? compact_offsets->has(escaped_column_name + DATA_FILE_EXTENSION)
+        : Poco::File(path + escaped_column_name + DATA_FILE_EXTENSION).exists();
     bool is_column_of_nested_type = type_arr && level == 0 && DataTypeNested::extractNestedTableName(name) != name;
 
     /** If data file is missing then we will not try to open it.
@@ -405,7 +519,8 @@ void MergeTreeReader::addStream(const String & name, const IDataType & type, con
         streams.emplace(filename, std::make_unique<Stream>(
             path + escaped_column_name, NULL_MAP_EXTENSION, data_part->size,
             all_mark_ranges, mark_cache, save_marks_in_cache,
-            uncompressed_cache, aio_threshold, max_read_buffer_size, profile_callback, clock_type));
+            uncompressed_cache, aio_threshold, mmap_threshold, max_read_buffer_size, profile_callback, clock_type,
+            compact_offsets, path));
 
         /// Then create the stream that handles the data of the given column.
         addStream(name, nested_type, all_mark_ranges, profile_callback, clock_type, level);
@@ -417,17 +532,20 @@ void MergeTreeReader::addStream(const String & name, const IDataType & type, con
             + ARRAY_SIZES_COLUMN_NAME_SUFFIX + toString(level);
         String escaped_size_name = escapeForFileName(DataTypeNested::extractNestedTableName(name))
             + ARRAY_SIZES_COLUMN_NAME_SUFFIX + toString(level);
-        String size_path = path + escaped_size_name + DATA_FILE_EXTENSION;
+        bool sizes_file_exists = compact_offsets
+            ? compact_offsets->has(escaped_size_name + DATA_FILE_EXTENSION)
+            : Poco::File(path + escaped_size_name + DATA_FILE_EXTENSION).exists();
 
         /// We have neither offsets nor data -> skipping, default values will be filled after
-        if (!data_file_exists && !Poco::File(size_path).exists())
+        if (!data_file_exists && !sizes_file_exists)
             return;
 
         if (!streams.count(size_name))
             streams.emplace(size_name, std::make_unique<Stream>(
                 path + escaped_size_name, DATA_FILE_EXTENSION, data_part->size,
                 all_mark_ranges, mark_cache, save_marks_in_cache,
-                uncompressed_cache, aio_threshold, max_read_buffer_size, profile_callback, clock_type));
+                uncompressed_cache, aio_threshold, mmap_threshold, max_read_buffer_size, profile_callback, clock_type,
+                compact_offsets, path));
 
         if (data_file_exists)
             addStream(name, *type_arr->getNestedType(), all_mark_ranges, profile_callback, clock_type, level + 1);
@@ -438,7 +556,8 @@ void MergeTreeReader::addStream(const String & name, const IDataType & type, con
         streams.emplace(name, std::make_unique<Stream>(
             path + escaped_column_name, DATA_FILE_EXTENSION, data_part->size,
             all_mark_ranges, mark_cache, save_marks_in_cache,
-            uncompressed_cache, aio_threshold, max_read_buffer_size, profile_callback, clock_type));
+            uncompressed_cache, aio_threshold, mmap_threshold, max_read_buffer_size, profile_callback, clock_type,
+            compact_offsets, path));
 }
 
 
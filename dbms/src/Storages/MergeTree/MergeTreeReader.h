@@ -29,7 +29,7 @@ public:
         MarkCache * mark_cache,
         bool save_marks_in_cache,
         MergeTreeData & storage, const MarkRanges & all_mark_ranges,
-        size_t aio_threshold, size_t max_read_buffer_size,
+        size_t aio_threshold, size_t mmap_threshold, size_t max_read_buffer_size,
         const ValueSizeMap & avg_value_size_hints = ValueSizeMap{},
         const ReadBufferFromFileBase::ProfileCallback & profile_callback = ReadBufferFromFileBase::ProfileCallback{},
         clockid_t clock_type = CLOCK_MONOTONIC_COARSE);
@@ -54,18 +54,31 @@ private:
     class Stream
     {
     public:
+        /// For a stream of a compact part pass the part's offset table and the path to the part
+        ///  directory; the stream then reads its region of the single data file.
         Stream(
             const String & path_prefix_, const String & extension_, size_t marks_count_,
             const MarkRanges & all_mark_ranges,
             MarkCache * mark_cache, bool save_marks_in_cache,
-            UncompressedCache * uncompressed_cache,
-            size_t aio_threshold, size_t max_read_buffer_size,
-            const ReadBufferFromFileBase::ProfileCallback & profile_callback, clockid_t clock_type);
+            UncompressedCache * uncompressed_cache_,
+            size_t aio_threshold, size_t mmap_threshold, size_t max_read_buffer_size,
+            const ReadBufferFromFileBase::ProfileCallback & profile_callback, clockid_t clock_type,
+            const MergeTreeDataPart::CompactOffsets * compact_offsets_ = nullptr, const String & part_path = {});
 
         static std::unique_ptr<Stream> createEmptyPtr();
 
         void seekToMark(size_t index);
 
+        /// See the async_block_checksums setting.
+        void setAsyncChecksumming();
+
+        /// See the merge_tree_prefetch_ahead_blocks setting. Has effect only for streams
+        ///  reading through the uncompressed cache.
+        void setPrefetchAhead(size_t blocks);
+
+        /// See the merge_tree_min_bytes_for_seek setting.
+        void setMaxGapToReadThrough(size_t max_gap);
+
         bool isEmpty() const { return is_empty; }
 
         ReadBuffer * data_buffer;
@@ -74,13 +87,21 @@ private:
         Stream() = default;
 
         /// NOTE: lazily loads marks from the marks cache.
-        const MarkInCompressedFile & getMark(size_t index);
+        MarkInCompressedFile getMark(size_t index);
 
         void loadMarks();
 
         std::string path_prefix;
         std::string extension;
 
+        /// Non-null if the stream belongs to a part of the compact format.
+        const MergeTreeDataPart::CompactOffsets * compact_offsets = nullptr;
+        std::string data_path;          /// The file the data is actually read from.
+        size_t data_offset = 0;         /// Offset of the stream's data inside data_path (non-zero only for compact parts).
+        size_t data_size = 0;           /// Size of the stream's data (used for compact parts only).
+        size_t marks_region_offset = 0; /// Region of the stream's marks inside data_path (compact parts only).
+        size_t marks_region_size = 0;
+
         size_t marks_count;
 
         MarkCache * mark_cache;
@@ -90,6 +111,13 @@ private:
         std::unique_ptr<CachedCompressedReadBuffer> cached_buffer;
         std::unique_ptr<CompressedReadBufferFromFile> non_cached_buffer;
 
+        /// For prefetching the blocks following a seek into the uncompressed cache.
+        UncompressedCache * uncompressed_cache = nullptr;
+        size_t prefetch_ahead = 0;
+
+        /// The prefetcher cannot decompress dictionary-compressed blocks, so such streams are not prefetched.
+        bool has_dictionary = false;
+
         bool is_empty = false;
     };
 
@@ -113,6 +141,7 @@ private:
     MergeTreeData & storage;
     MarkRanges all_mark_ranges;
     size_t aio_threshold;
+    size_t mmap_threshold;
     size_t max_read_buffer_size;
 
     void addStream(const String & name, const IDataType & type, const MarkRanges & all_mark_ranges,
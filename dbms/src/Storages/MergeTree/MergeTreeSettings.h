@@ -3,6 +3,8 @@
 #include <Poco/Util/AbstractConfiguration.h>
 #include <Core/Defines.h>
 #include <Core/Types.h>
+#include <Core/Field.h>
+#include <Core/FieldVisitors.h>
 #include <Common/Exception.h>
 
 
@@ -12,10 +14,11 @@ namespace DB
 namespace ErrorCodes
 {
     extern const int INVALID_CONFIG_PARAMETER;
+    extern const int UNKNOWN_SETTING;
 }
 
 /** Advanced settings of MergeTree.
-  * Could be loaded from config.
+  * Could be loaded from config, and overridden per table with the SETTINGS clause of CREATE TABLE.
   */
 struct MergeTreeSettings
 {
@@ -50,6 +53,12 @@ struct MergeTreeSettings
     /// Max delay of inserting data into MergeTree table in seconds, if there are a lot of unmerged parts.
     size_t max_delay_to_insert = 1;
 
+    /** Make every INSERT durable before acknowledging it: after the new parts are added, wait
+      *  until their filesystem is synced. The syncs of concurrent inserts are batched by a shared
+      *  committer thread - one syncfs per filesystem per batch (see PartCommitter.h) - so the
+      *  fsync count does not grow with the insert rate. */
+    bool fsync_after_insert = false;
+
     /** Replication settings. */
 
     /// How many last blocks of hashes should be kept in ZooKeeper (old blocks will be deleted).
@@ -59,6 +68,10 @@ struct MergeTreeSettings
     /// You can set very big replicated_deduplication_window to avoid duplicating INSERTs during that period of time.
     size_t replicated_deduplication_window_seconds = 7 * 24 * 60 * 60; /// one week
 
+    /// How many IDs of recently committed insert blocks to remember in memory on each replica.
+    /// Duplicates found in this cache are rejected without any ZooKeeper requests. 0 - disabled.
+    size_t replicated_dedup_cache_size = 1024;
+
     /// Keep about this number of last records in ZooKeeper log, even if they are obsolete.
     /// It doesn't affect work of tables: used only to diagnose ZooKeeper log before cleaning.
     size_t replicated_logs_to_keep = 100;
@@ -73,6 +86,22 @@ struct MergeTreeSettings
     /// Max broken parts, if more - deny automatic deletion.
     size_t max_suspicious_broken_parts = 10;
 
+    /// How many threads are used to load and validate data parts at server startup.
+    size_t max_part_loading_threads = 8;
+
+    /// Approximate read rate of the background part scrubber, in bytes per second. 0 - scrubbing is disabled.
+    /// The scrubber verifies the data of the parts against their checksums (see MergeTreePartScrubber).
+    size_t background_scrub_bytes_per_second = 0;
+    /// Do not verify the same part more often than once in this period.
+    size_t background_scrub_recheck_period_hours = 168;
+
+    /// If nonzero, the files of removed parts are unlinked by a background thread at this pace
+    ///  instead of synchronously, so that the unlink storm of a retention drop does not stall
+    ///  concurrent fsyncs. The part directory is renamed out instantly in any case.
+    size_t background_part_removal_files_per_second = 0;
+    /// How many unlinks to do between fsyncs of the part directory during background removal.
+    size_t background_part_removal_fsync_batch = 128;
+
     /// Not apply ALTER if number of files for modification(deletion, addition) more than this.
     size_t max_files_to_modify_in_alter_columns = 75;
     /// Not apply ALTER, if number of files for deletion more than this.
@@ -84,6 +113,14 @@ struct MergeTreeSettings
     /// Limit parallel fetches
     size_t replicated_max_parallel_fetches = 0;
     size_t replicated_max_parallel_fetches_for_table = 0;
+    /// The number of connections used to download one part from a replica.
+    /// Each connection fetches a disjoint subset of the part's files.
+    size_t replicated_fetch_threads = 1;
+    /// Compression of the part transfer stream: none, lz4 or zstd.
+    String replicated_fetch_compression_method = "none";
+    /// If the part to fetch resides on the same mounted filesystem (e.g. another replica on this host),
+    /// clone it with hardlinks instead of downloading it over HTTP.
+    bool replicated_fetch_hardlink_local_parts = true;
     /// Limit parallel sends
     size_t replicated_max_parallel_sends = 0;
     size_t replicated_max_parallel_sends_for_table = 0;
@@ -120,6 +157,57 @@ struct MergeTreeSettings
     /// Minimal amount of non-PK columns to activate Vertical merge algorithm
     size_t vertical_merge_algorithm_min_columns_to_activate = 11;
 
+    /** Data skipping indexes settings. */
+
+    /// Comma-separated list of columns for which per-granule-block minmax indexes are built at part creation time.
+    /// Conditions on these columns can then exclude mark ranges without reading data, like the primary key does.
+    String skip_index_columns;
+
+    /// How many index granules are covered by one skip index entry.
+    size_t skip_index_granularity = 4;
+
+    /// Comma-separated list of expressions for which per-part min/max values are stored.
+    /// Conditions on these expressions can exclude whole parts before any mark is read,
+    ///  like the minmax index of the partition key, but for arbitrary expressions.
+    String part_minmax_expressions;
+
+    /** If non-zero, the index granularity of every new part is chosen so that a granule takes
+      *  approximately this many uncompressed bytes (but never more than index_granularity rows).
+      * Useful for tables with very large rows, where a fixed row count produces huge granules. */
+    size_t index_granularity_bytes = 0;
+
+    /** Comma-separated lists of fixed-width numeric columns whose data files are written with a delta
+      *  (or double delta) pre-transform before LZ4. Monotonically increasing sequences like timestamps
+      *  and counters compress several times better this way. Applied when parts are written, so after
+      *  changing the setting old parts keep their encoding until they are merged. */
+    String delta_compression_columns;
+    String double_delta_compression_columns;
+
+    /** Comma-separated list of columns whose data files are compressed with a ZSTD dictionary,
+      *  trained on the first block written into each part and stored in the part (<column>.dict file).
+      * Small compressed blocks of short strings no longer re-learn the same byte statistics
+      *  block after block, which considerably improves the compression ratio.
+      * Not applied to parts in the compact format. */
+    String zstd_dictionary_columns;
+
+    /** Checksum compressed blocks of new parts with hardware CRC32C (SSE 4.2) instead of CityHash128.
+      * Several times cheaper to verify on read. The algorithm is recorded per block
+      *  (see CHECKSUM_CRC32C_FLAG in CompressedStream.h), so old parts are read as before
+      *  and parts with mixed checksums are fine. */
+    bool use_crc32c_checksums = false;
+
+    /** If the summary compressed size of the parts to merge is greater than this threshold,
+      *  the merge reads and writes files with O_DIRECT, leaving the page cache to readers.
+      * Otherwise a single large merge can evict the entire hot working set from the cache.
+      * Zero disables the behaviour. */
+    size_t min_merge_bytes_to_use_direct_io = 10ULL * 1024 * 1024 * 1024;
+
+    /** If non-zero, blocks smaller than this many uncompressed bytes are written as "compact" parts:
+      *  all columns go into a single data file instead of a pair of files per column.
+      * This saves inodes and file descriptors for tables with many columns and frequent small inserts.
+      * Merges always produce parts in the classic wide format. */
+    size_t min_bytes_for_wide_part = 0;
+
 
     void loadFromConfig(const String & config_elem, Poco::Util::AbstractConfiguration & config)
     {
@@ -144,17 +232,27 @@ struct MergeTreeSettings
         SET(parts_to_delay_insert, getUInt64);
         SET(parts_to_throw_insert, getUInt64);
         SET(max_delay_to_insert, getUInt64);
+        SET(fsync_after_insert, getBool);
         SET(replicated_deduplication_window, getUInt64);
         SET(replicated_deduplication_window_seconds, getUInt64);
+        SET(replicated_dedup_cache_size, getUInt64);
         SET(replicated_logs_to_keep, getUInt64);
         SET(prefer_fetch_merged_part_time_threshold, getUInt64);
         SET(prefer_fetch_merged_part_size_threshold, getUInt64);
         SET(max_suspicious_broken_parts, getUInt64);
+        SET(max_part_loading_threads, getUInt64);
         SET(max_files_to_modify_in_alter_columns, getUInt64);
         SET(max_files_to_remove_in_alter_columns, getUInt64);
         SET(replicated_max_ratio_of_wrong_parts, getDouble);
         SET(replicated_max_parallel_fetches, getUInt64);
         SET(replicated_max_parallel_fetches_for_table, getUInt64);
+        SET(replicated_fetch_threads, getUInt64);
+        SET(replicated_fetch_compression_method, getString);
+        SET(replicated_fetch_hardlink_local_parts, getBool);
+        SET(background_scrub_bytes_per_second, getUInt64);
+        SET(background_scrub_recheck_period_hours, getUInt64);
+        SET(background_part_removal_files_per_second, getUInt64);
+        SET(background_part_removal_fsync_batch, getUInt64);
         SET(replicated_max_parallel_sends, getUInt64);
         SET(replicated_max_parallel_sends_for_table, getUInt64);
         SET(replicated_can_become_leader, getBool);
@@ -167,9 +265,103 @@ struct MergeTreeSettings
         SET(enable_vertical_merge_algorithm, getUInt64);
         SET(vertical_merge_algorithm_min_rows_to_activate, getUInt64);
         SET(vertical_merge_algorithm_min_columns_to_activate, getUInt64);
+        SET(skip_index_columns, getString);
+        SET(skip_index_granularity, getUInt64);
+        SET(part_minmax_expressions, getString);
+        SET(index_granularity_bytes, getUInt64);
+        SET(delta_compression_columns, getString);
+        SET(double_delta_compression_columns, getString);
+        SET(zstd_dictionary_columns, getString);
+        SET(use_crc32c_checksums, getBool);
+        SET(min_merge_bytes_to_use_direct_io, getUInt64);
+        SET(min_bytes_for_wide_part, getUInt64);
 
     #undef SET
     }
+
+    /// Override one setting with a value from the SETTINGS clause of a CREATE TABLE query.
+    void set(const String & name, const Field & value)
+    {
+    #define SET_NUMBER(NAME) \
+        if (name == #NAME) \
+        { \
+            NAME = applyVisitor(FieldVisitorConvertToNumber<UInt64>(), value); \
+            return; \
+        }
+
+    #define SET_DOUBLE(NAME) \
+        if (name == #NAME) \
+        { \
+            NAME = applyVisitor(FieldVisitorConvertToNumber<Float64>(), value); \
+            return; \
+        }
+
+    #define SET_STRING(NAME) \
+        if (name == #NAME) \
+        { \
+            NAME = safeGet<const String &>(value); \
+            return; \
+        }
+
+        SET_NUMBER(max_bytes_to_merge_at_max_space_in_pool);
+        SET_NUMBER(max_bytes_to_merge_at_min_space_in_pool);
+        SET_NUMBER(max_replicated_merges_in_queue);
+        SET_NUMBER(number_of_free_entries_in_pool_to_lower_max_size_of_merge);
+        SET_NUMBER(old_parts_lifetime);
+        SET_NUMBER(temporary_directories_lifetime);
+        SET_NUMBER(parts_to_delay_insert);
+        SET_NUMBER(parts_to_throw_insert);
+        SET_NUMBER(max_delay_to_insert);
+        SET_NUMBER(fsync_after_insert);
+        SET_NUMBER(replicated_deduplication_window);
+        SET_NUMBER(replicated_deduplication_window_seconds);
+        SET_NUMBER(replicated_dedup_cache_size);
+        SET_NUMBER(replicated_logs_to_keep);
+        SET_NUMBER(prefer_fetch_merged_part_time_threshold);
+        SET_NUMBER(prefer_fetch_merged_part_size_threshold);
+        SET_NUMBER(max_suspicious_broken_parts);
+        SET_NUMBER(max_part_loading_threads);
+        SET_NUMBER(background_scrub_bytes_per_second);
+        SET_NUMBER(background_scrub_recheck_period_hours);
+        SET_NUMBER(background_part_removal_files_per_second);
+        SET_NUMBER(background_part_removal_fsync_batch);
+        SET_NUMBER(max_files_to_modify_in_alter_columns);
+        SET_NUMBER(max_files_to_remove_in_alter_columns);
+        SET_DOUBLE(replicated_max_ratio_of_wrong_parts);
+        SET_NUMBER(replicated_max_parallel_fetches);
+        SET_NUMBER(replicated_max_parallel_fetches_for_table);
+        SET_NUMBER(replicated_fetch_threads);
+        SET_STRING(replicated_fetch_compression_method);
+        SET_NUMBER(replicated_fetch_hardlink_local_parts);
+        SET_NUMBER(replicated_max_parallel_sends);
+        SET_NUMBER(replicated_max_parallel_sends_for_table);
+        SET_NUMBER(replicated_can_become_leader);
+        SET_NUMBER(zookeeper_session_expiration_check_period);
+        SET_NUMBER(check_delay_period);
+        SET_NUMBER(cleanup_delay_period);
+        SET_NUMBER(min_relative_delay_to_yield_leadership);
+        SET_NUMBER(min_relative_delay_to_close);
+        SET_NUMBER(min_absolute_delay_to_close);
+        SET_NUMBER(enable_vertical_merge_algorithm);
+        SET_NUMBER(vertical_merge_algorithm_min_rows_to_activate);
+        SET_NUMBER(vertical_merge_algorithm_min_columns_to_activate);
+        SET_STRING(skip_index_columns);
+        SET_NUMBER(skip_index_granularity);
+        SET_STRING(part_minmax_expressions);
+        SET_NUMBER(index_granularity_bytes);
+        SET_STRING(delta_compression_columns);
+        SET_STRING(double_delta_compression_columns);
+        SET_STRING(zstd_dictionary_columns);
+        SET_NUMBER(use_crc32c_checksums);
+        SET_NUMBER(min_merge_bytes_to_use_direct_io);
+        SET_NUMBER(min_bytes_for_wide_part);
+
+    #undef SET_NUMBER
+    #undef SET_DOUBLE
+    #undef SET_STRING
+
+        throw Exception("Unknown MergeTree setting " + name, ErrorCodes::UNKNOWN_SETTING);
+    }
 };
 
 }
@@ -24,7 +24,7 @@ MergeTreeThreadBlockInputStream::MergeTreeThreadBlockInputStream(
     :
     MergeTreeBaseBlockInputStream{storage, prewhere_actions, prewhere_column, max_block_size_rows,
         preferred_block_size_bytes, preferred_max_column_in_block_size_bytes, settings.min_bytes_to_use_direct_io,
-        settings.max_read_buffer_size, use_uncompressed_cache, true, virt_column_names},
+        settings.min_bytes_to_use_mmap_io, settings.max_read_buffer_size, use_uncompressed_cache, true, virt_column_names},
     thread{thread},
     pool{pool}
 {
@@ -78,12 +78,12 @@ bool MergeTreeThreadBlockInputStream::getNewTask()
 
         reader = std::make_unique<MergeTreeReader>(
             path, task->data_part, task->columns, owned_uncompressed_cache.get(), owned_mark_cache.get(), save_marks_in_cache,
-            storage, task->mark_ranges, min_bytes_to_use_direct_io, max_read_buffer_size, MergeTreeReader::ValueSizeMap{}, profile_callback);
+            storage, task->mark_ranges, min_bytes_to_use_direct_io, min_bytes_to_use_mmap_io, max_read_buffer_size, MergeTreeReader::ValueSizeMap{}, profile_callback);
 
         if (prewhere_actions)
             pre_reader = std::make_unique<MergeTreeReader>(
                 path, task->data_part, task->pre_columns, owned_uncompressed_cache.get(), owned_mark_cache.get(), save_marks_in_cache,
-                storage, task->mark_ranges, min_bytes_to_use_direct_io,
+                storage, task->mark_ranges, min_bytes_to_use_direct_io, min_bytes_to_use_mmap_io,
                 max_read_buffer_size, MergeTreeReader::ValueSizeMap{}, profile_callback);
     }
     else
@@ -91,13 +91,13 @@ bool MergeTreeThreadBlockInputStream::getNewTask()
         /// retain avg_value_size_hints
         reader = std::make_unique<MergeTreeReader>(
             path, task->data_part, task->columns, owned_uncompressed_cache.get(), owned_mark_cache.get(), save_marks_in_cache,
-            storage, task->mark_ranges, min_bytes_to_use_direct_io, max_read_buffer_size,
+            storage, task->mark_ranges, min_bytes_to_use_direct_io, min_bytes_to_use_mmap_io, max_read_buffer_size,
             reader->getAvgValueSizeHints(), profile_callback);
 
         if (prewhere_actions)
             pre_reader = std::make_unique<MergeTreeReader>(
                 path, task->data_part, task->pre_columns, owned_uncompressed_cache.get(), owned_mark_cache.get(), save_marks_in_cache,
-                storage, task->mark_ranges, min_bytes_to_use_direct_io,
+                storage, task->mark_ranges, min_bytes_to_use_direct_io, min_bytes_to_use_mmap_io,
                 max_read_buffer_size, pre_reader->getAvgValueSizeHints(), profile_callback);
     }
 
@@ -50,6 +50,7 @@ MergeTreeWhereOptimizer::MergeTreeWhereOptimizer(
     calculateColumnSizes(data, column_names);
     auto & select = typeid_cast<ASTSelectQuery &>(*query_info.query);
     determineArrayJoinedNames(select);
+    determineReusedExpressionNames(select);
     optimize(select);
 }
 
@@ -84,8 +85,11 @@ void MergeTreeWhereOptimizer::optimizeConjunction(ASTSelectQuery & select, ASTFu
     /// used as max possible size and indicator that appropriate condition has not been found
     const auto no_such_condition = std::numeric_limits<size_t>::max();
 
+    /// All "good" conditions are moved to PREWHERE: each of them is cheap to compute and selective,
+    ///  and together they minimize the set of rows for which the remaining columns are read.
+    std::vector<size_t> good_conditions;
+
     /// { first: condition index, second: summary column size }
-    std::pair<size_t, size_t> lightest_good_condition{no_such_condition, no_such_condition};
     std::pair<size_t, size_t> lightest_viable_condition{no_such_condition, no_such_condition};
 
     auto & conditions = fun->arguments->children;
@@ -132,40 +136,66 @@ void MergeTreeWhereOptimizer::optimizeConjunction(ASTSelectQuery & select, ASTFu
             /// calculate size of columns involved in condition
             const auto cond_columns_size = getIdentifiersColumnSize(identifiers);
 
-            /// place condition either in good or viable conditions set
-            auto & good_or_viable_condition = isConditionGood(condition) ? lightest_good_condition : lightest_viable_condition;
-            if (good_or_viable_condition.second > cond_columns_size)
+            if (isConditionGood(condition))
+                good_conditions.push_back(idx);
+            else if (lightest_viable_condition.second > cond_columns_size)
             {
-                good_or_viable_condition.first = idx;
-                good_or_viable_condition.second = cond_columns_size;
+                lightest_viable_condition.first = idx;
+                lightest_viable_condition.second = cond_columns_size;
             }
         }
     }
 
-    const auto move_condition_to_prewhere = [&] (const size_t idx) {
-        select.prewhere_expression = conditions[idx];
+    const auto move_conditions_to_prewhere = [&] (std::vector<size_t> idxs) {
+        /// compose PREWHERE expression from the selected conditions
+        if (idxs.size() == 1)
+            select.prewhere_expression = conditions[idxs.front()];
+        else
+        {
+            auto conjunction = std::make_shared<ASTFunction>();
+            auto arguments = std::make_shared<ASTExpressionList>();
+
+            conjunction->name = and_function_name;
+            conjunction->arguments = arguments;
+            conjunction->children.push_back(arguments);
+
+            for (const auto idx : idxs)
+                arguments->children.push_back(conditions[idx]);
+
+            select.prewhere_expression = conjunction;
+        }
+
         select.children.push_back(select.prewhere_expression);
         LOG_DEBUG(log, "MergeTreeWhereOptimizer: condition `" << select.prewhere_expression << "` moved to PREWHERE");
 
-        /** Replace conjunction with the only remaining argument if only two conditions were present,
-            *  remove selected condition from conjunction otherwise. */
-        if (conditions.size() == 2)
+        /// remove the moved conditions from the conjunction, starting from the last index
+        ///  so that swap-removal does not invalidate the remaining ones
+        std::sort(idxs.rbegin(), idxs.rend());
+        for (const auto idx : idxs)
+            remove_condition_at_index(idx);
+
+        if (conditions.empty())
+        {
+            /// the whole WHERE was moved to PREWHERE
+            const auto it = std::find(std::begin(select.children), std::end(select.children), select.where_expression);
+            select.children.erase(it);
+            select.where_expression = nullptr;
+        }
+        else if (conditions.size() == 1)
         {
             /// find old where_expression in children of select
             const auto it = std::find(std::begin(select.children), std::end(select.children), select.where_expression);
             /// replace where_expression with the remaining argument
-            select.where_expression = std::move(conditions[idx == 0 ? 1 : 0]);
+            select.where_expression = std::move(conditions.front());
             /// overwrite child entry with the new where_expression
             *it = select.where_expression;
         }
-        else
-            remove_condition_at_index(idx);
     };
 
-    /// if there is a "good" condition - move it to PREWHERE
-    if (lightest_good_condition.first != no_such_condition)
+    /// if there are "good" conditions - move all of them to PREWHERE
+    if (!good_conditions.empty())
     {
-        move_condition_to_prewhere(lightest_good_condition.first);
+        move_conditions_to_prewhere(std::move(good_conditions));
     }
     else if (lightest_viable_condition.first != no_such_condition)
     {
@@ -181,7 +211,7 @@ void MergeTreeWhereOptimizer::optimizeConjunction(ASTSelectQuery & select, ASTFu
                 return;
         }
 
-        move_condition_to_prewhere(lightest_viable_condition.first);
+        move_conditions_to_prewhere({lightest_viable_condition.first});
     }
 }
 
@@ -378,6 +408,12 @@ bool MergeTreeWhereOptimizer::cannotBeMoved(const IAST * ptr) const
         /// indexHint is a special function that it does not make sense to transfer to PREWHERE
         if ("indexHint" == function_ptr->name)
             return true;
+
+        /// The subexpression is used elsewhere in the query (e.g. in the select list or in GROUP BY):
+        ///  moved to PREWHERE it would be computed twice per row, because the results of PREWHERE
+        ///  are dropped after filtering. Left in WHERE it is computed once and shared.
+        if (reused_expression_names.count(function_ptr->getColumnName()))
+            return true;
     }
     else if (const auto identifier_ptr = typeid_cast<const ASTIdentifier *>(ptr))
     {
@@ -396,6 +432,34 @@ bool MergeTreeWhereOptimizer::cannotBeMoved(const IAST * ptr) const
 }
 
 
+void MergeTreeWhereOptimizer::determineReusedExpressionNames(ASTSelectQuery & select)
+{
+    if (select.select_expression_list)
+        collectFunctionNamesNoSubqueries(select.select_expression_list.get(), reused_expression_names);
+    if (select.group_expression_list)
+        collectFunctionNamesNoSubqueries(select.group_expression_list.get(), reused_expression_names);
+    if (select.having_expression)
+        collectFunctionNamesNoSubqueries(select.having_expression.get(), reused_expression_names);
+    if (select.order_expression_list)
+        collectFunctionNamesNoSubqueries(select.order_expression_list.get(), reused_expression_names);
+    if (select.limit_by_expression_list)
+        collectFunctionNamesNoSubqueries(select.limit_by_expression_list.get(), reused_expression_names);
+}
+
+
+void MergeTreeWhereOptimizer::collectFunctionNamesNoSubqueries(const IAST * ast, NameSet & set)
+{
+    if (typeid_cast<const ASTSubquery *>(ast))
+        return;
+
+    if (typeid_cast<const ASTFunction *>(ast))
+        set.insert(ast->getColumnName());
+
+    for (const auto & child : ast->children)
+        collectFunctionNamesNoSubqueries(child.get(), set);
+}
+
+
 void MergeTreeWhereOptimizer::determineArrayJoinedNames(ASTSelectQuery & select)
 {
     auto array_join_expression_list = select.array_join_expression_list();
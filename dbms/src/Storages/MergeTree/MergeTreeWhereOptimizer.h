@@ -24,8 +24,9 @@ using IdentifierNameSet = std::set<std::string>;
  *  sizes of columns used in particular expression and identifying "good" conditions of
  *  form "column_name = constant", where "constant" is outside some `threshold` specified in advance.
  *
- *  If there are "good" conditions present in WHERE, the one with minimal summary column size is
- *  transferred to PREWHERE.
+ *  If there are "good" conditions present in WHERE, all of them are transferred to PREWHERE
+ *  (joined with AND): each of them is cheap to compute, and filtering by all of them at once
+ *  minimizes the set of rows for which the remaining columns have to be read.
  *  Otherwise any condition with minimal summary column size can be transferred to PREWHERE, if only
  *  its relative size (summary column size divided by query column size) is less than `max_columns_relative_size`.
  */
@@ -67,11 +68,21 @@ private:
       *    We assume all AS aliases have been expanded prior to using this class
       *
       * Also, disallow moving expressions with GLOBAL [NOT] IN.
+      *
+      * Also, disallow moving conditions with subexpressions that appear elsewhere in the query:
+      *  the results of PREWHERE are dropped after filtering, so such a subexpression would be
+      *  computed twice per row, while in WHERE it is computed once and shared with the rest
+      *  of the expression chain.
       */
     bool cannotBeMoved(const IAST * ptr) const;
 
     void determineArrayJoinedNames(ASTSelectQuery & select);
 
+    /// Collects the names of function subexpressions used outside of WHERE, see cannotBeMoved.
+    void determineReusedExpressionNames(ASTSelectQuery & select);
+
+    static void collectFunctionNamesNoSubqueries(const IAST * ast, NameSet & set);
+
     using string_set_t = std::unordered_set<std::string>;
 
     const string_set_t primary_key_columns;
@@ -82,6 +93,7 @@ private:
     std::unordered_map<std::string, size_t> column_sizes{};
     size_t total_column_size{};
     NameSet array_joined_names;
+    NameSet reused_expression_names;
 };
 
 
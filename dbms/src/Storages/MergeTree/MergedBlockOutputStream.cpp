@@ -1,6 +1,7 @@
 #include <Storages/MergeTree/MergedBlockOutputStream.h>
 #include <IO/createWriteBufferFromFileBase.h>
 #include <Common/escapeForFileName.h>
+#include <dictBuilder/zdict.h>
 #include <DataTypes/DataTypeNested.h>
 #include <DataTypes/DataTypeArray.h>
 #include <DataTypes/DataTypeNullable.h>
@@ -32,16 +33,29 @@ IMergedBlockOutputStream::IMergedBlockOutputStream(
     size_t min_compress_block_size_,
     size_t max_compress_block_size_,
     CompressionMethod compression_method_,
-    size_t aio_threshold_)
+    size_t aio_threshold_,
+    size_t index_granularity_,
+    bool compact_)
     : storage(storage_),
     min_compress_block_size(min_compress_block_size_),
     max_compress_block_size(max_compress_block_size_),
     aio_threshold(aio_threshold_),
+    index_granularity(index_granularity_ ? index_granularity_ : storage_.index_granularity),
+    compact(compact_),
     compression_method(compression_method_)
 {
 }
 
 
+size_t IMergedBlockOutputStream::getBytesWrittenCompressed() const
+{
+    size_t res = 0;
+    for (const auto & name_stream : column_streams)
+        res += name_stream.second->plain_hashing.count();
+    return res;
+}
+
+
 void IMergedBlockOutputStream::addStream(
     const String & path,
     const String & name,
@@ -57,6 +71,26 @@ void IMergedBlockOutputStream::addStream(
     else
         escaped_column_name = escapeForFileName(name);
 
+    auto make_stream = [&](const String & escaped_name, const std::string & data_extension, const std::string & marks_extension,
+        CompressionMethod method, size_t delta_width)
+    {
+        bool crc32c_checksum = storage.settings.use_crc32c_checksums;
+
+        if (compact)
+            return std::make_unique<ColumnStream>(escaped_name, data_extension, marks_extension, method, delta_width, crc32c_checksum);
+
+        return std::make_unique<ColumnStream>(
+            escaped_name,
+            path + escaped_name, data_extension,
+            path + escaped_name, marks_extension,
+            max_compress_block_size,
+            method,
+            estimated_size,
+            aio_threshold,
+            delta_width,
+            crc32c_checksum);
+    };
+
     if (type.isNullable())
     {
         /// First create the stream that handles the null map of the given column.
@@ -64,14 +98,8 @@ void IMergedBlockOutputStream::addStream(
         const IDataType & nested_type = *nullable_type.getNestedType();
 
         std::string null_map_name = name + NULL_MAP_EXTENSION;
-        column_streams[null_map_name] = std::make_unique<ColumnStream>(
-            escaped_column_name,
-            path + escaped_column_name, NULL_MAP_EXTENSION,
-            path + escaped_column_name, NULL_MARKS_FILE_EXTENSION,
-            max_compress_block_size,
-            compression_method,
-            estimated_size,
-            aio_threshold);
+        column_streams[null_map_name] = make_stream(escaped_column_name, NULL_MAP_EXTENSION, NULL_MARKS_FILE_EXTENSION,
+            compression_method, 1);
 
         /// Then create the stream that handles the data of the given column.
         addStream(path, name, nested_type, estimated_size, level, filename, false);
@@ -86,28 +114,32 @@ void IMergedBlockOutputStream::addStream(
             String escaped_size_name = escapeForFileName(DataTypeNested::extractNestedTableName(name))
                 + ARRAY_SIZES_COLUMN_NAME_SUFFIX + toString(level);
 
-            column_streams[size_name] = std::make_unique<ColumnStream>(
-                escaped_size_name,
-                path + escaped_size_name, DATA_FILE_EXTENSION,
-                path + escaped_size_name, MARKS_FILE_EXTENSION,
-                max_compress_block_size,
-                compression_method,
-                estimated_size,
-                aio_threshold);
+            column_streams[size_name] = make_stream(escaped_size_name, DATA_FILE_EXTENSION, MARKS_FILE_EXTENSION,
+                compression_method, 1);
         }
 
         addStream(path, name, *type_arr->getNestedType(), estimated_size, level + 1, "", false);
     }
     else
     {
-        column_streams[name] = std::make_unique<ColumnStream>(
-            escaped_column_name,
-            path + escaped_column_name, DATA_FILE_EXTENSION,
-            path + escaped_column_name, MARKS_FILE_EXTENSION,
-            max_compress_block_size,
-            compression_method,
-            estimated_size,
-            aio_threshold);
+        /// The column may be declared with a delta pre-transform (see MergeTreeData::initDeltaCompression()).
+        CompressionMethod method = compression_method;
+        size_t delta_width = 1;
+
+        auto it = storage.delta_compressed_columns.find(name);
+        if (it != storage.delta_compressed_columns.end())
+        {
+            method = it->second.method;
+            delta_width = it->second.width;
+        }
+
+        auto & stream = column_streams[name] = make_stream(escaped_column_name, DATA_FILE_EXTENSION, MARKS_FILE_EXTENSION, method, delta_width);
+
+        /// Dictionary compression applies to whole-part writes only: ALTER conversions
+        ///  (filename is set) rename the files afterwards and would orphan the dictionary.
+        /// Compact parts pack all files into one, where there is no place for a dictionary.
+        if (!compact && filename.empty() && storage.zstd_dictionary_columns.count(name))
+            stream->wants_dictionary = true;
     }
 }
 
@@ -163,7 +195,7 @@ void IMergedBlockOutputStream::writeDataImpl(
                 limit = index_offset;
             else
             {
-                limit = storage.index_granularity;
+                limit = index_granularity;
 
                 /// There could already be enough data to compress into the new block.
                 if (stream.compressed.offset() >= min_compress_block_size)
@@ -206,7 +238,7 @@ void IMergedBlockOutputStream::writeDataImpl(
                     limit = index_offset;
                 else
                 {
-                    limit = storage.index_granularity;
+                    limit = index_granularity;
 
                     /// There could already be enough data to compress into the new block.
                     if (stream.compressed.offset() >= min_compress_block_size)
@@ -236,6 +268,9 @@ void IMergedBlockOutputStream::writeDataImpl(
     {
         ColumnStream & stream = *column_streams[name];
 
+        if (stream.wants_dictionary && !stream.dictionary_trained)
+            trainDictionary(stream, type, column);
+
         size_t prev_mark = 0;
         while (prev_mark < size)
         {
@@ -246,7 +281,7 @@ void IMergedBlockOutputStream::writeDataImpl(
                 limit = index_offset;
             else
             {
-                limit = storage.index_granularity;
+                limit = index_granularity;
 
                 /// There could already be enough data to compress into the new block.
                 if (stream.compressed.offset() >= min_compress_block_size)
@@ -267,6 +302,45 @@ void IMergedBlockOutputStream::writeDataImpl(
 }
 
 
+void IMergedBlockOutputStream::trainDictionary(ColumnStream & stream, const IDataType & type, const IColumn & column)
+{
+    /// Train only once per part, even if the first block gives no usable dictionary.
+    stream.dictionary_trained = true;
+
+    /// The dictionary itself and the training scratch space belong to no query.
+    TemporarilyDisableMemoryTracker temporarily_disable_memory_tracker;
+
+    WriteBufferFromOwnString sample_buf;
+    type.serializeBinaryBulk(column, sample_buf, 0, 0);
+    const std::string & sample = sample_buf.str();
+
+    /// ZDICT takes a set of samples; cut the serialized column into chunks of the typical
+    ///  "short value" scale. With too little data the trainer cannot learn anything useful.
+    static constexpr size_t sample_size = 1024;
+    static constexpr size_t max_dictionary_size = 64 * 1024;
+
+    if (sample.size() < 64 * sample_size)
+        return;
+
+    std::vector<size_t> sample_sizes(sample.size() / sample_size, sample_size);
+
+    stream.dictionary.resize(max_dictionary_size);
+    size_t res = ZDICT_trainFromBuffer(
+        &stream.dictionary[0], max_dictionary_size,
+        sample.data(), sample_sizes.data(), sample_sizes.size());
+
+    if (ZDICT_isError(res))
+    {
+        /// Not an error of the insert: e.g. the data is too uniform. Keep the generic method.
+        stream.dictionary.clear();
+        return;
+    }
+
+    stream.dictionary.resize(res);
+    stream.compressed_buf.setCompressionDictionary(stream.dictionary);
+}
+
+
 /// Implementation of IMergedBlockOutputStream::ColumnStream.
 
 IMergedBlockOutputStream::ColumnStream::ColumnStream(
@@ -278,27 +352,55 @@ IMergedBlockOutputStream::ColumnStream::ColumnStream(
     size_t max_compress_block_size,
     CompressionMethod compression_method,
     size_t estimated_size,
-    size_t aio_threshold) :
+    size_t aio_threshold,
+    size_t delta_width,
+    bool crc32c_checksum) :
     escaped_column_name(escaped_column_name_),
     data_file_extension{data_file_extension_},
     marks_file_extension{marks_file_extension_},
     plain_file(createWriteBufferFromFileBase(data_path + data_file_extension, estimated_size, aio_threshold, max_compress_block_size)),
-    plain_hashing(*plain_file), compressed_buf(plain_hashing, compression_method), compressed(compressed_buf),
-    marks_file(marks_path + marks_file_extension, 4096, O_TRUNC | O_CREAT | O_WRONLY), marks(marks_file)
+    /// An ordinary file blocks the merge thread in write(); double-buffer it, so that writing
+    ///  overlaps with the compression of the next buffer. An AIO file overlaps writes by itself.
+    async_plain(aio_threshold == 0 || estimated_size < aio_threshold
+        ? std::make_unique<AsynchronousWriteBuffer>(*plain_file) : nullptr),
+    plain_hashing(async_plain ? static_cast<WriteBuffer &>(*async_plain) : static_cast<WriteBuffer &>(*plain_file)),
+    compressed_buf(plain_hashing, compression_method, DBMS_DEFAULT_BUFFER_SIZE, delta_width, crc32c_checksum), compressed(compressed_buf),
+    marks_file(std::make_unique<WriteBufferFromFile>(marks_path + marks_file_extension, 4096, O_TRUNC | O_CREAT | O_WRONLY)),
+    marks(*marks_file)
+{
+}
+
+IMergedBlockOutputStream::ColumnStream::ColumnStream(
+    const String & escaped_column_name_,
+    const std::string & data_file_extension_,
+    const std::string & marks_file_extension_,
+    CompressionMethod compression_method,
+    size_t delta_width,
+    bool crc32c_checksum) :
+    escaped_column_name(escaped_column_name_),
+    data_file_extension{data_file_extension_},
+    marks_file_extension{marks_file_extension_},
+    plain_string(std::make_unique<WriteBufferFromOwnString>()),
+    plain_hashing(*plain_string), compressed_buf(plain_hashing, compression_method, DBMS_DEFAULT_BUFFER_SIZE, delta_width, crc32c_checksum), compressed(compressed_buf),
+    marks_string(std::make_unique<WriteBufferFromOwnString>()), marks(*marks_string)
 {
 }
 
 void IMergedBlockOutputStream::ColumnStream::finalize()
 {
     compressed.next();
-    plain_file->next();
+    plain_hashing.next();
+    if (async_plain)
+        async_plain->finish();
     marks.next();
 }
 
 void IMergedBlockOutputStream::ColumnStream::sync()
 {
-    plain_file->sync();
-    marks_file.sync();
+    if (plain_file)
+        plain_file->sync();
+    if (marks_file)
+        marks_file->sync();
 }
 
 void IMergedBlockOutputStream::ColumnStream::addToChecksums(MergeTreeData::DataPart::Checksums & checksums)
@@ -315,6 +417,23 @@ void IMergedBlockOutputStream::ColumnStream::addToChecksums(MergeTreeData::DataP
     checksums.files[name + marks_file_extension].file_hash = marks.getHash();
 }
 
+void IMergedBlockOutputStream::ColumnStream::writeDictionary(
+    const String & part_path, MergeTreeData::DataPart::Checksums & checksums)
+{
+    if (dictionary.empty())
+        return;
+
+    String file_name = escaped_column_name + ".dict";
+
+    WriteBufferFromFile out(part_path + file_name, 4096, O_TRUNC | O_CREAT | O_WRONLY);
+    HashingWriteBuffer out_hashing(out);
+    out_hashing.write(dictionary.data(), dictionary.size());
+    out_hashing.next();
+
+    checksums.files[file_name].file_size = out_hashing.count();
+    checksums.files[file_name].file_hash = out_hashing.getHash();
+}
+
 
 /// Implementation of MergedBlockOutputStream.
 
@@ -322,11 +441,13 @@ MergedBlockOutputStream::MergedBlockOutputStream(
     MergeTreeData & storage_,
     String part_path_,
     const NamesAndTypesList & columns_list_,
-    CompressionMethod compression_method)
+    CompressionMethod compression_method,
+    size_t index_granularity_,
+    bool compact_)
     : IMergedBlockOutputStream(
         storage_, storage_.context.getSettings().min_compress_block_size,
         storage_.context.getSettings().max_compress_block_size, compression_method,
-        storage_.context.getSettings().min_bytes_to_use_direct_io),
+        storage_.context.getSettings().min_bytes_to_use_direct_io, index_granularity_, compact_),
     columns_list(columns_list_), part_path(part_path_)
 {
     init();
@@ -340,11 +461,12 @@ MergedBlockOutputStream::MergedBlockOutputStream(
     const NamesAndTypesList & columns_list_,
     CompressionMethod compression_method,
     const MergeTreeData::DataPart::ColumnToSize & merged_column_to_size_,
-    size_t aio_threshold_)
+    size_t aio_threshold_,
+    size_t index_granularity_)
     : IMergedBlockOutputStream(
         storage_, storage_.context.getSettings().min_compress_block_size,
         storage_.context.getSettings().max_compress_block_size, compression_method,
-        aio_threshold_),
+        aio_threshold_, index_granularity_),
     columns_list(columns_list_), part_path(part_path_)
 {
     init();
@@ -407,10 +529,44 @@ void MergedBlockOutputStream::writeSuffixAndFinalizePart(
         index_stream = nullptr;
     }
 
-    for (ColumnStreams::iterator it = column_streams.begin(); it != column_streams.end(); ++it)
+    MergeTreeDataPart::CompactOffsets compact_offsets;
+
+    if (!compact)
     {
-        it->second->finalize();
-        it->second->addToChecksums(checksums);
+        for (ColumnStreams::iterator it = column_streams.begin(); it != column_streams.end(); ++it)
+        {
+            it->second->finalize();
+            it->second->addToChecksums(checksums);
+            it->second->writeDictionary(part_path, checksums);
+        }
+    }
+    else if (marks_count != 0)
+    {
+        /// Concatenate the in-memory data and marks of all columns into the single data file.
+        /// Readers find the contents of every virtual file through the offset table.
+        WriteBufferFromFile data_file(part_path + "data.bin", DBMS_DEFAULT_BUFFER_SIZE, O_TRUNC | O_CREAT | O_WRONLY);
+        HashingWriteBuffer data_hashing(data_file);
+
+        for (ColumnStreams::iterator it = column_streams.begin(); it != column_streams.end(); ++it)
+        {
+            ColumnStream & stream = *it->second;
+            stream.finalize();
+
+            {
+                const std::string & data = stream.plain_string->str();
+                compact_offsets.addRegion(stream.escaped_column_name + stream.data_file_extension, data_hashing.count(), data.size());
+                data_hashing.write(data.data(), data.size());
+            }
+            {
+                const std::string & marks_data = stream.marks_string->str();
+                compact_offsets.addRegion(stream.escaped_column_name + stream.marks_file_extension, data_hashing.count(), marks_data.size());
+                data_hashing.write(marks_data.data(), marks_data.size());
+            }
+        }
+
+        data_hashing.next();
+        checksums.files["data.bin"].file_size = data_hashing.count();
+        checksums.files["data.bin"].file_hash = data_hashing.getHash();
     }
 
     column_streams.clear();
@@ -425,6 +581,39 @@ void MergedBlockOutputStream::writeSuffixAndFinalizePart(
     new_part->partition.store(storage, part_path, checksums);
     new_part->minmax_idx.store(storage, part_path, checksums);
 
+    if (storage.part_minmax_expr && new_part->part_minmax_stats.initialized)
+        new_part->part_minmax_stats.store(storage.part_minmax_columns, storage.part_minmax_column_types,
+            "stat_minmax_", part_path, checksums);
+
+    /// The index can be incomplete if not all its columns have passed through this stream
+    ///  (e.g. the Vertical merge algorithm writes non-primary-key columns separately).
+    /// Such parts simply don't get a skip index, as if they were written before it was configured.
+    if (storage.skip_idx_expr && skip_idx.isComplete(storage))
+    {
+        skip_idx.store(storage, part_path, checksums);
+        new_part->skip_idx = skip_idx;
+    }
+
+    if (index_granularity != storage.index_granularity)
+    {
+        /// The part has its own granularity - record it so that readers use the right mark spacing
+        ///  (see MergeTreeDataPart::loadIndexGranularity).
+        WriteBufferFromFile out(part_path + "index_granularity.txt", 4096);
+        HashingWriteBuffer out_hashing(out);
+        writeIntText(index_granularity, out_hashing);
+        out_hashing.next();
+        checksums.files["index_granularity.txt"].file_size = out_hashing.count();
+        checksums.files["index_granularity.txt"].file_hash = out_hashing.getHash();
+    }
+
+    if (compact)
+    {
+        compact_offsets.rows = rows_count;
+        compact_offsets.initialized = true;
+        compact_offsets.store(part_path, checksums);
+        new_part->compact_offsets = compact_offsets;
+    }
+
     {
         /// Write a file with a description of columns.
         WriteBufferFromFile out(part_path + "columns.txt", 4096);
@@ -438,9 +627,12 @@ void MergedBlockOutputStream::writeSuffixAndFinalizePart(
     }
 
     new_part->size = marks_count;
+    new_part->index_granularity = index_granularity;
     new_part->modification_time = time(nullptr);
     new_part->columns = *total_column_list;
-    new_part->index.swap(index_columns);
+    new_part->index.assign(index_columns);
+    new_part->index_loaded = true;
+    index_columns.clear();
     new_part->checksums = checksums;
     new_part->size_in_bytes = MergeTreeData::DataPart::calcTotalSize(new_part->getFullPath());
 }
@@ -467,6 +659,7 @@ void MergedBlockOutputStream::writeImpl(const Block & block, const IColumn::Perm
 {
     block.checkNumberOfRows();
     size_t rows = block.rows();
+    rows_count += rows;
 
     /// The set of written offset columns so that you do not write mutual to nested structures columns several times
     OffsetColumns offset_columns;
@@ -509,23 +702,30 @@ void MergedBlockOutputStream::writeImpl(const Block & block, const IColumn::Perm
     {
         const ColumnWithTypeAndName & column = block.getByName(it.name);
 
+        /// The column in the order in which it is written to disk.
+        ColumnPtr written_column = column.column;
+
         if (permutation)
         {
             auto primary_column_it = primary_columns_name_to_position.find(it.name);
             if (primary_columns_name_to_position.end() != primary_column_it)
             {
-                writeData(column.name, *column.type, *primary_columns[primary_column_it->second].column, offset_columns, 0, false);
+                written_column = primary_columns[primary_column_it->second].column;
             }
             else
             {
                 /// We rearrange the columns that are not included in the primary key here; Then the result is released - to save RAM.
-                ColumnPtr permutted_column = column.column->permute(*permutation, 0);
-                writeData(column.name, *column.type, *permutted_column, offset_columns, 0, false);
+                written_column = column.column->permute(*permutation, 0);
             }
         }
-        else
+
+        writeData(column.name, *column.type, *written_column, offset_columns, 0, false);
+
+        if (storage.skip_idx_expr)
         {
-            writeData(column.name, *column.type, *column.column, offset_columns, 0, false);
+            const auto skip_column_it = std::find(storage.skip_idx_columns.begin(), storage.skip_idx_columns.end(), it.name);
+            if (skip_column_it != storage.skip_idx_columns.end())
+                skip_idx.update(storage, skip_column_it - storage.skip_idx_columns.begin(), *written_column, index_granularity);
         }
     }
 
@@ -539,7 +739,7 @@ void MergedBlockOutputStream::writeImpl(const Block & block, const IColumn::Perm
         TemporarilyDisableMemoryTracker temporarily_disable_memory_tracker;
 
         /// Write index. The index contains Primary Key value for each `index_granularity` row.
-        for (size_t i = index_offset; i < rows; i += storage.index_granularity)
+        for (size_t i = index_offset; i < rows; i += index_granularity)
         {
             if (storage.merging_params.mode != MergeTreeData::MergingParams::Unsorted)
             {
@@ -555,20 +755,21 @@ void MergedBlockOutputStream::writeImpl(const Block & block, const IColumn::Perm
         }
     }
 
-    size_t written_for_last_mark = (storage.index_granularity - index_offset + rows) % storage.index_granularity;
-    index_offset = (storage.index_granularity - written_for_last_mark) % storage.index_granularity;
+    size_t written_for_last_mark = (index_granularity - index_offset + rows) % index_granularity;
+    index_offset = (index_granularity - written_for_last_mark) % index_granularity;
 }
 
 
 /// Implementation of MergedColumnOnlyOutputStream.
 
 MergedColumnOnlyOutputStream::MergedColumnOnlyOutputStream(
-    MergeTreeData & storage_, String part_path_, bool sync_, CompressionMethod compression_method, bool skip_offsets_)
+    MergeTreeData & storage_, String part_path_, bool sync_, CompressionMethod compression_method, bool skip_offsets_,
+    size_t index_granularity_, size_t aio_threshold_, size_t estimated_size_)
     : IMergedBlockOutputStream(
         storage_, storage_.context.getSettings().min_compress_block_size,
         storage_.context.getSettings().max_compress_block_size, compression_method,
-        storage_.context.getSettings().min_bytes_to_use_direct_io),
-    part_path(part_path_), sync(sync_), skip_offsets(skip_offsets_)
+        aio_threshold_ ? aio_threshold_ : storage_.context.getSettings().min_bytes_to_use_direct_io.value, index_granularity_),
+    part_path(part_path_), sync(sync_), skip_offsets(skip_offsets_), estimated_size(estimated_size_)
 {
 }
 
@@ -580,7 +781,7 @@ void MergedColumnOnlyOutputStream::write(const Block & block)
         for (size_t i = 0; i < block.columns(); ++i)
         {
             addStream(part_path, block.safeGetByPosition(i).name,
-                *block.safeGetByPosition(i).type, 0, 0, block.safeGetByPosition(i).name, skip_offsets);
+                *block.safeGetByPosition(i).type, estimated_size, 0, block.safeGetByPosition(i).name, skip_offsets);
         }
         initialized = true;
     }
@@ -594,8 +795,8 @@ void MergedColumnOnlyOutputStream::write(const Block & block)
         writeData(column.name, *column.type, *column.column, offset_columns, 0, skip_offsets);
     }
 
-    size_t written_for_last_mark = (storage.index_granularity - index_offset + rows) % storage.index_granularity;
-    index_offset = (storage.index_granularity - written_for_last_mark) % storage.index_granularity;
+    size_t written_for_last_mark = (index_granularity - index_offset + rows) % index_granularity;
+    index_offset = (index_granularity - written_for_last_mark) % index_granularity;
 }
 
 void MergedColumnOnlyOutputStream::writeSuffix()
@@ -614,6 +815,7 @@ MergeTreeData::DataPart::Checksums MergedColumnOnlyOutputStream::writeSuffixAndG
             column_stream.second->sync();
 
         column_stream.second->addToChecksums(checksums);
+        column_stream.second->writeDictionary(part_path, checksums);
     }
 
     column_streams.clear();
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <IO/WriteBufferFromFile.h>
+#include <IO/WriteBufferFromString.h>
+#include <IO/AsynchronousWriteBuffer.h>
 #include <IO/CompressedWriteBuffer.h>
 #include <IO/HashingWriteBuffer.h>
 #include <Storages/MergeTree/MergeTreeData.h>
@@ -21,13 +23,19 @@ public:
         size_t min_compress_block_size_,
         size_t max_compress_block_size_,
         CompressionMethod compression_method_,
-        size_t aio_threshold_);
+        size_t aio_threshold_,
+        size_t index_granularity_,
+        bool compact_ = false);
+
+    /// Compressed bytes written to the column data files so far. Marks and index are not counted.
+    size_t getBytesWrittenCompressed() const;
 
 protected:
     using OffsetColumns = std::set<std::string>;
 
     struct ColumnStream
     {
+        /// Writes data and marks to a pair of files (the classic wide part format).
         ColumnStream(
             const String & escaped_column_name_,
             const String & data_path,
@@ -37,27 +45,53 @@ protected:
             size_t max_compress_block_size,
             CompressionMethod compression_method,
             size_t estimated_size,
-            size_t aio_threshold);
+            size_t aio_threshold,
+            size_t delta_width = 1,
+            bool crc32c_checksum = false);
+
+        /// Accumulates data and marks in memory, to be concatenated into the single data file
+        ///  of a compact part (see MergedBlockOutputStream::writeSuffixAndFinalizePart).
+        ColumnStream(
+            const String & escaped_column_name_,
+            const std::string & data_file_extension_,
+            const std::string & marks_file_extension_,
+            CompressionMethod compression_method,
+            size_t delta_width = 1,
+            bool crc32c_checksum = false);
 
         String escaped_column_name;
         std::string data_file_extension;
         std::string marks_file_extension;
 
-        /// compressed -> compressed_buf -> plain_hashing -> plain_file
+        /// compressed -> compressed_buf -> plain_hashing -> [async_plain ->] plain_file (or plain_string for compact parts)
         std::unique_ptr<WriteBufferFromFileBase> plain_file;
+        /// Interposed over an ordinary file so that the write() calls overlap with the compression
+        ///  of the next buffer (double buffering). An AIO file overlaps writes by itself.
+        std::unique_ptr<AsynchronousWriteBuffer> async_plain;
+        std::unique_ptr<WriteBufferFromOwnString> plain_string;
         HashingWriteBuffer plain_hashing;
         CompressedWriteBuffer compressed_buf;
         HashingWriteBuffer compressed;
 
-        /// marks -> marks_file
-        WriteBufferFromFile marks_file;
+        /// marks -> marks_file (or marks_string for compact parts)
+        std::unique_ptr<WriteBufferFromFile> marks_file;
+        std::unique_ptr<WriteBufferFromOwnString> marks_string;
         HashingWriteBuffer marks;
 
+        /// See the zstd_dictionary_columns setting. The dictionary is trained on the first
+        ///  block of data written into the stream; until then the blocks keep the generic method.
+        bool wants_dictionary = false;
+        bool dictionary_trained = false;
+        String dictionary;
+
         void finalize();
 
         void sync();
 
         void addToChecksums(MergeTreeData::DataPart::Checksums & checksums);
+
+        /// Store the trained dictionary in the part, so readers can decompress the data.
+        void writeDictionary(const String & part_path, MergeTreeData::DataPart::Checksums & checksums);
     };
 
     using ColumnStreams = std::map<String, std::unique_ptr<ColumnStream>>;
@@ -81,12 +115,23 @@ protected:
 
     size_t aio_threshold;
 
+    /// Rows per mark of the part being written. May differ from storage.index_granularity
+    ///  (see MergeTreeData::chooseIndexGranularity).
+    size_t index_granularity;
+
+    /// If true, all columns are written into a single data file (see the min_bytes_for_wide_part setting).
+    bool compact = false;
+
     CompressionMethod compression_method;
 
 private:
     /// Internal version of writeData.
     void writeDataImpl(const String & name, const IDataType & type, const IColumn & column,
         OffsetColumns & offset_columns, size_t level, bool write_array_data, bool skip_offsets);
+
+    /// Train a ZSTD dictionary on the given column data and switch the stream to it.
+    /// On failure (e.g. too little data) the stream keeps the generic method.
+    void trainDictionary(ColumnStream & stream, const IDataType & type, const IColumn & column);
 };
 
 
@@ -96,11 +141,16 @@ private:
 class MergedBlockOutputStream : public IMergedBlockOutputStream
 {
 public:
+    /// index_granularity_ = 0 means the table default (see MergeTreeData::chooseIndexGranularity).
+    /// If compact_ is true, the part is written in the compact format: a single data file
+    ///  with an offset table instead of a pair of files per column.
     MergedBlockOutputStream(
         MergeTreeData & storage_,
         String part_path_,
         const NamesAndTypesList & columns_list_,
-        CompressionMethod compression_method);
+        CompressionMethod compression_method,
+        size_t index_granularity_ = 0,
+        bool compact_ = false);
 
     MergedBlockOutputStream(
         MergeTreeData & storage_,
@@ -108,7 +158,8 @@ public:
         const NamesAndTypesList & columns_list_,
         CompressionMethod compression_method,
         const MergeTreeData::DataPart::ColumnToSize & merged_column_to_size_,
-        size_t aio_threshold_);
+        size_t aio_threshold_,
+        size_t index_granularity_ = 0);
 
     std::string getPartPath() const;
 
@@ -143,10 +194,14 @@ private:
     String part_path;
 
     size_t marks_count = 0;
+    size_t rows_count = 0;
 
     std::unique_ptr<WriteBufferFromFile> index_file_stream;
     std::unique_ptr<HashingWriteBuffer> index_stream;
-    MergeTreeData::DataPart::Index index_columns;
+    Columns index_columns;
+
+    /// Built incrementally from the written data, if the table has skip_index_columns.
+    MergeTreeDataPart::SkipIndex skip_idx;
 };
 
 
@@ -154,8 +209,12 @@ private:
 class MergedColumnOnlyOutputStream : public IMergedBlockOutputStream
 {
 public:
+    /// When writing columns into an existing part, index_granularity_ must be the part's own granularity.
+    /// If aio_threshold_ is zero, the min_bytes_to_use_direct_io setting is used instead;
+    ///  estimated_size_ is the expected size of each written column, to decide whether to use O_DIRECT.
     MergedColumnOnlyOutputStream(
-        MergeTreeData & storage_, String part_path_, bool sync_, CompressionMethod compression_method, bool skip_offsets_);
+        MergeTreeData & storage_, String part_path_, bool sync_, CompressionMethod compression_method, bool skip_offsets_,
+        size_t index_granularity_ = 0, size_t aio_threshold_ = 0, size_t estimated_size_ = 0);
 
     void write(const Block & block) override;
     void writeSuffix() override;
@@ -167,6 +226,7 @@ private:
     bool initialized = false;
     bool sync;
     bool skip_offsets;
+    size_t estimated_size;
 };
 
 }
@@ -0,0 +1,127 @@
+#include <Storages/MergeTree/PartCommitter.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <set>
+
+#include <Common/Exception.h>
+#include <Common/setThreadName.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_OPEN_FILE;
+    extern const int CANNOT_FSYNC;
+}
+
+
+PartCommitter & PartCommitter::instance()
+{
+    static PartCommitter res;
+    return res;
+}
+
+
+PartCommitter::PartCommitter()
+{
+    committer = std::thread([this] { committerThread(); });
+}
+
+
+PartCommitter::~PartCommitter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+    }
+    has_work.notify_all();
+    committer.join();
+}
+
+
+void PartCommitter::commit(const String & path)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (!next_batch)
+        next_batch = std::make_shared<Batch>();
+
+    BatchPtr batch = next_batch;
+    batch->paths.push_back(path);
+    has_work.notify_one();
+
+    batch_done.wait(lock, [&] { return batch->done; });
+
+    if (batch->exception)
+        std::rethrow_exception(batch->exception);
+}
+
+
+void PartCommitter::committerThread()
+{
+    setThreadName("PartCommitter");
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        has_work.wait(lock, [this] { return next_batch || shutdown; });
+
+        /// On shutdown the pending batch, if any, is still synced: its waiters are blocked.
+        if (!next_batch)
+            return;
+
+        BatchPtr batch = std::move(next_batch);
+
+        lock.unlock();
+        try
+        {
+            syncBatch(batch->paths);
+        }
+        catch (...)
+        {
+            batch->exception = std::current_exception();
+        }
+        lock.lock();
+
+        batch->done = true;
+        batch_done.notify_all();
+    }
+}
+
+
+void PartCommitter::syncBatch(const std::vector<String> & paths)
+{
+    /// syncfs makes everything written to the filesystem durable,
+    ///  so it is enough to sync each involved filesystem once per batch.
+    std::set<dev_t> synced;
+
+    for (const auto & path : paths)
+    {
+        int fd = open(path.c_str(), O_RDONLY | O_DIRECTORY);
+        if (fd < 0)
+            throwFromErrno("Cannot open " + path, ErrorCodes::CANNOT_OPEN_FILE);
+
+        struct stat st;
+        if (0 == fstat(fd, &st) && synced.count(st.st_dev))
+        {
+            close(fd);
+            continue;
+        }
+
+        if (0 != syncfs(fd))
+        {
+            close(fd);
+            throwFromErrno("Cannot sync filesystem of " + path, ErrorCodes::CANNOT_FSYNC);
+        }
+
+        synced.insert(st.st_dev);
+        close(fd);
+    }
+}
+
+}
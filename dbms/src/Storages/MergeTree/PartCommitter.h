@@ -0,0 +1,62 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Core/Types.h>
+
+
+namespace DB
+{
+
+/** Group commit of freshly written parts (see the fsync_after_insert setting).
+  *
+  * If every insert did its own fsync of every file of its part, the number of fsyncs, not
+  *  the write bandwidth, would become the ceiling of the insert rate. Instead, an insert
+  *  that wants durability enqueues the directory of its committed part and blocks; a single
+  *  committer thread takes everything queued at once, issues one syncfs per filesystem
+  *  involved, and wakes all the waiters of the batch. Concurrent inserts thus share the
+  *  syncs, and each insert waits for the duration of at most two batches.
+  */
+class PartCommitter
+{
+public:
+    static PartCommitter & instance();
+
+    /** Block until everything written to the filesystem of `path` before the call is durable.
+      */
+    void commit(const String & path);
+
+    ~PartCommitter();
+
+private:
+    struct Batch
+    {
+        std::vector<String> paths;
+        bool done = false;
+        std::exception_ptr exception;
+    };
+
+    using BatchPtr = std::shared_ptr<Batch>;
+
+    PartCommitter();
+
+    void committerThread();
+    static void syncBatch(const std::vector<String> & paths);
+
+    std::mutex mutex;
+    std::condition_variable has_work;     /// A path was queued or shutdown was requested.
+    std::condition_variable batch_done;
+
+    /// The batch the next request joins. Taken whole by the committer, so the requests
+    ///  arriving while a sync is in flight form the next batch.
+    BatchPtr next_batch;
+    bool shutdown = false;
+
+    std::thread committer;
+};
+
+}
@@ -2,6 +2,7 @@
 #include <Storages/MergeTree/AbandonableLockInZooKeeper.h>
 #include <Storages/MergeTree/ReplicatedMergeTreeQuorumEntry.h>
 #include <Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.h>
+#include <Storages/MergeTree/PartCommitter.h>
 #include <Interpreters/PartLog.h>
 #include <DataStreams/IBlockOutputStream.h>
 #include <Common/SipHash.h>
@@ -24,8 +25,8 @@ namespace ErrorCodes
 
 
 ReplicatedMergeTreeBlockOutputStream::ReplicatedMergeTreeBlockOutputStream(
-    StorageReplicatedMergeTree & storage_, size_t quorum_, size_t quorum_timeout_ms_)
-    : storage(storage_), quorum(quorum_), quorum_timeout_ms(quorum_timeout_ms_),
+    StorageReplicatedMergeTree & storage_, size_t quorum_, size_t quorum_timeout_ms_, bool presorted_)
+    : storage(storage_), quorum(quorum_), quorum_timeout_ms(quorum_timeout_ms_), presorted(presorted_),
     log(&Logger::get(storage.data.getLogName() + " (Replicated OutputStream)"))
 {
     /// The quorum value `1` has the same meaning as if it is disabled.
@@ -113,7 +114,7 @@ void ReplicatedMergeTreeBlockOutputStream::write(const Block & block)
 
         /// Write part to the filesystem under temporary name. Calculate a checksum.
 
-        MergeTreeData::MutableDataPartPtr part = storage.writer.writeTempPart(current_block);
+        MergeTreeData::MutableDataPartPtr part = storage.writer.writeTempPart(current_block, presorted);
 
         SipHash hash;
         part->checksums.summaryDataChecksum(hash);
@@ -129,6 +130,15 @@ void ReplicatedMergeTreeBlockOutputStream::write(const Block & block)
         /// We take the hash from the data as ID. That is, do not insert the same data twice.
         String block_id = toString(hash_value.words[0]) + "_" + toString(hash_value.words[1]);
 
+        /// First consult the local cache of recently committed blocks: a duplicate from a
+        ///  client retry is rejected without a single ZooKeeper request. Duplicates that
+        ///  miss the cache are still caught by the /blocks node in the commit transaction.
+        if (storage.isRecentInsertBlock(block_id))
+        {
+            LOG_INFO(log, "Block with ID " << block_id << " was recently committed by this replica; ignoring it.");
+            continue;
+        }
+
         LOG_DEBUG(log, "Wrote block with ID '" << block_id << "', " << block.rows() << " rows");
 
         commitPart(zookeeper, part, block_id);
@@ -279,6 +289,11 @@ void ReplicatedMergeTreeBlockOutputStream::commitPart(zkutil::ZooKeeperPtr & zoo
     MergeTreeData::Transaction transaction; /// If you can not add a part to ZK, we'll remove it back from the working set.
     storage.data.renameTempPartAndAdd(part, nullptr, &transaction);
 
+    /// Group commit: the part must be durable before it is announced in ZooKeeper.
+    ///  The syncs of concurrent inserts are shared, one per filesystem per batch.
+    if (storage.data.settings.fsync_after_insert)
+        PartCommitter::instance().commit(part->getFullPath());
+
     try
     {
         auto code = zookeeper->tryMulti(ops);   /// 1 RTT
@@ -286,6 +301,9 @@ void ReplicatedMergeTreeBlockOutputStream::commitPart(zkutil::ZooKeeperPtr & zoo
         {
             transaction.commit();
             storage.merge_selecting_event.set();
+
+            if (!block_id.empty())
+                storage.rememberInsertBlock(block_id);
         }
         else if (code == ZNODEEXISTS)
         {
@@ -295,6 +313,7 @@ void ReplicatedMergeTreeBlockOutputStream::commitPart(zkutil::ZooKeeperPtr & zoo
                 LOG_INFO(log, "Block with ID " << block_id << " already exists; ignoring it (removing part " << part->name << ")");
 
                 transaction.rollback();
+                storage.rememberInsertBlock(block_id);
             }
             else if (zookeeper->exists(quorum_info.status_path))
             {
@@ -23,7 +23,7 @@ class ReplicatedMergeTreeBlockOutputStream : public IBlockOutputStream
 {
 public:
     ReplicatedMergeTreeBlockOutputStream(StorageReplicatedMergeTree & storage_,
-        size_t quorum_, size_t quorum_timeout_ms_);
+        size_t quorum_, size_t quorum_timeout_ms_, bool presorted_ = false);
 
     void write(const Block & block) override;
 
@@ -49,6 +49,9 @@ private:
     size_t quorum;
     size_t quorum_timeout_ms;
 
+    /// The blocks are declared to be in the order of the primary key (insert_sorted_by_primary_key).
+    bool presorted = false;
+
     using Logger = Poco::Logger;
     Logger * log;
 };
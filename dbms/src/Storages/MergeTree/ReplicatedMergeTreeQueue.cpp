@@ -162,12 +162,6 @@ void ReplicatedMergeTreeQueue::updateTimesInZooKeeper(
 
 void ReplicatedMergeTreeQueue::remove(zkutil::ZooKeeperPtr zookeeper, LogEntryPtr & entry)
 {
-    auto code = zookeeper->tryRemove(replica_path + "/queue/" + entry->znode_name);
-
-    if (code != ZOK)
-        LOG_ERROR(log, "Couldn't remove " << replica_path << "/queue/" << entry->znode_name << ": "
-            << zkutil::ZooKeeper::error2string(code) << ". This shouldn't happen often.");
-
     bool min_unprocessed_insert_time_changed = false;
     bool max_processed_insert_time_changed = false;
 
@@ -191,7 +185,25 @@ void ReplicatedMergeTreeQueue::remove(zkutil::ZooKeeperPtr zookeeper, LogEntryPt
         updateTimesOnRemoval(entry, min_unprocessed_insert_time_changed, max_processed_insert_time_changed);
     }
 
-    updateTimesInZooKeeper(zookeeper, min_unprocessed_insert_time_changed, max_processed_insert_time_changed);
+    /// Remove the entry and update the insert times in a single round trip.
+    /// During catch-up after an outage, thousands of entries are removed this way,
+    ///  so the number of round trips matters.
+    zkutil::Ops ops;
+    ops.emplace_back(std::make_unique<zkutil::Op::Remove>(replica_path + "/queue/" + entry->znode_name, -1));
+
+    if (min_unprocessed_insert_time_changed)
+        ops.emplace_back(std::make_unique<zkutil::Op::SetData>(
+            replica_path + "/min_unprocessed_insert_time", toString(min_unprocessed_insert_time), -1));
+
+    if (max_processed_insert_time_changed)
+        ops.emplace_back(std::make_unique<zkutil::Op::SetData>(
+            replica_path + "/max_processed_insert_time", toString(max_processed_insert_time), -1));
+
+    auto code = zookeeper->tryMulti(ops);
+
+    if (code != ZOK)
+        LOG_ERROR(log, "Couldn't remove " << replica_path << "/queue/" << entry->znode_name << ": "
+            << zkutil::ZooKeeper::error2string(code) << ". This shouldn't happen often.");
 }
 
 
@@ -222,8 +234,18 @@ bool ReplicatedMergeTreeQueue::remove(zkutil::ZooKeeperPtr zookeeper, const Stri
     if (!found)
         return false;
 
-    zookeeper->tryRemove(replica_path + "/queue/" + found->znode_name);
-    updateTimesInZooKeeper(zookeeper, min_unprocessed_insert_time_changed, max_processed_insert_time_changed);
+    zkutil::Ops ops;
+    ops.emplace_back(std::make_unique<zkutil::Op::Remove>(replica_path + "/queue/" + found->znode_name, -1));
+
+    if (min_unprocessed_insert_time_changed)
+        ops.emplace_back(std::make_unique<zkutil::Op::SetData>(
+            replica_path + "/min_unprocessed_insert_time", toString(min_unprocessed_insert_time), -1));
+
+    if (max_processed_insert_time_changed)
+        ops.emplace_back(std::make_unique<zkutil::Op::SetData>(
+            replica_path + "/max_processed_insert_time", toString(max_processed_insert_time), -1));
+
+    zookeeper->tryMulti(ops);
 
     return true;
 }
@@ -416,6 +438,10 @@ void ReplicatedMergeTreeQueue::removeGetsAndMergesInRange(zkutil::ZooKeeperPtr z
     bool min_unprocessed_insert_time_changed = false;
     bool max_processed_insert_time_changed = false;
 
+    /// The removals are pipelined: with a long queue (e.g. when dropping a partition
+    ///  right after an outage), issuing them one at a time is round-trip-bound.
+    std::vector<std::pair<String, zkutil::ZooKeeper::RemoveFuture>> remove_futures;
+
     /// Remove operations with parts, contained in the range to be deleted, from the queue.
     std::unique_lock<std::mutex> lock(mutex);
     for (Queue::iterator it = queue.begin(); it != queue.end();)
@@ -425,10 +451,7 @@ void ReplicatedMergeTreeQueue::removeGetsAndMergesInRange(zkutil::ZooKeeperPtr z
         {
             if ((*it)->currently_executing)
                 to_wait.push_back(*it);
-            auto code = zookeeper->tryRemove(replica_path + "/queue/" + (*it)->znode_name);
-            if (code != ZOK)
-                LOG_INFO(log, "Couldn't remove " << replica_path + "/queue/" + (*it)->znode_name << ": "
-                    << zkutil::ZooKeeper::error2string(code));
+            remove_futures.emplace_back((*it)->znode_name, zookeeper->asyncRemove(replica_path + "/queue/" + (*it)->znode_name));
 
             updateTimesOnRemoval(*it, min_unprocessed_insert_time_changed, max_processed_insert_time_changed);
             queue.erase(it++);
@@ -438,6 +461,19 @@ void ReplicatedMergeTreeQueue::removeGetsAndMergesInRange(zkutil::ZooKeeperPtr z
             ++it;
     }
 
+    for (auto & future : remove_futures)
+    {
+        try
+        {
+            future.second.get();
+        }
+        catch (const zkutil::KeeperException & e)
+        {
+            LOG_INFO(log, "Couldn't remove " << replica_path + "/queue/" + future.first << ": "
+                << zkutil::ZooKeeper::error2string(e.code));
+        }
+    }
+
     updateTimesInZooKeeper(zookeeper, min_unprocessed_insert_time_changed, max_processed_insert_time_changed);
 
     LOG_DEBUG(log, "Removed " << removed_entries << " entries from queue. "
@@ -28,6 +28,15 @@ struct SelectQueryInfo
     /// Prepared sets are used for indices by storage engine.
     /// Example: x IN (1, 2, 3)
     PreparedSets sets;
+
+    /// If true, the storage should return streams each of which is ordered by the primary key
+    ///  (one stream per data part for MergeTree). Set when the ORDER BY of the query is a prefix
+    ///  of the primary key, so that the sort can be replaced with a merge of the streams.
+    bool read_in_pk_order = false;
+
+    /// With read_in_pk_order: the order is descending (ORDER BY pk DESC). The storage then walks
+    ///  the mark ranges from the end and reverses the rows of each read piece.
+    bool read_in_pk_order_reverse = false;
 };
 
 }
@@ -11,6 +11,7 @@
 #include <Common/CurrentMetrics.h>
 #include <Common/MemoryTracker.h>
 #include <common/logger_useful.h>
+#include <common/ThreadPool.h>
 #include <Poco/Ext/ThreadNumber.h>
 
 #include <ext/range.h>
@@ -52,7 +53,11 @@ StorageBuffer::StorageBuffer(const std::string & name_, NamesAndTypesListPtr col
     const String & destination_database_, const String & destination_table_)
     : IStorage{materialized_columns_, alias_columns_, column_defaults_},
     name(name_), columns(columns_), context(context_),
-    num_shards(num_shards_), buffers(num_shards_),
+    num_shards(context_.getSettingsRef().buffer_insert_stripes
+        ? static_cast<size_t>(context_.getSettingsRef().buffer_insert_stripes)
+        : num_shards_),
+    buffers(num_shards),
+    striped_mode(context_.getSettingsRef().buffer_insert_stripes != 0),
     min_thresholds(min_thresholds_), max_thresholds(max_thresholds_),
     destination_database(destination_database_), destination_table(destination_table_),
     no_destination(destination_database.empty() && destination_table.empty()),
@@ -260,6 +265,15 @@ public:
         /// We distribute the load on the shards by the stream number.
         const auto start_shard_num = Poco::ThreadNumber::get() % storage.num_shards;
 
+        if (storage.striped_mode)
+        {
+            /// With many stripes, each thread goes straight to its own stripe: the lock is held
+            ///  only to append the block, so there is no point scanning for a less busy one.
+            insertIntoBuffer(block, storage.buffers[start_shard_num],
+                std::unique_lock<std::mutex>(storage.buffers[start_shard_num].mutex));
+            return;
+        }
+
         /// We loop through the buffers, trying to lock mutex. No more than one lap.
         auto shard_num = start_shard_num;
 
@@ -426,6 +440,20 @@ bool StorageBuffer::checkThresholdsImpl(size_t rows, size_t bytes, time_t time_p
 
 void StorageBuffer::flushAllBuffers(const bool check_thresholds)
 {
+    if (striped_mode && num_shards > 1)
+    {
+        /// Different stripes are flushed concurrently.
+        static constexpr size_t MAX_FLUSH_THREADS = 8;
+
+        ThreadPool pool(std::min(num_shards, MAX_FLUSH_THREADS));
+
+        for (auto & buf : buffers)
+            pool.schedule([this, &buf, check_thresholds] { flushBuffer(buf, check_thresholds); });
+
+        pool.wait();
+        return;
+    }
+
     for (auto & buf : buffers)
         flushBuffer(buf, check_thresholds);
 }
@@ -440,7 +468,22 @@ void StorageBuffer::flushBuffer(Buffer & buffer, bool check_thresholds)
     size_t bytes = 0;
     time_t time_passed = 0;
 
-    std::lock_guard<std::mutex> lock(buffer.mutex);
+    /// In striped mode, flushes of one stripe are serialized by a separate lock,
+    ///  and the insert lock is held only to take a snapshot of the data by swap.
+    std::unique_lock<std::mutex> flush_lock(buffer.flush_mutex, std::defer_lock);
+    if (striped_mode)
+    {
+        if (check_thresholds)
+        {
+            /// The stripe is already being flushed - the data inserted since then will wait for the next flush.
+            if (!flush_lock.try_lock())
+                return;
+        }
+        else
+            flush_lock.lock();
+    }
+
+    std::unique_lock<std::mutex> lock(buffer.mutex);
 
     block_to_write = buffer.data.cloneEmpty();
 
@@ -473,12 +516,20 @@ void StorageBuffer::flushBuffer(Buffer & buffer, bool check_thresholds)
     if (no_destination)
         return;
 
-    /** For simplicity, buffer is locked during write.
+    /** In the usual mode, for simplicity, buffer is locked during write.
         * We could unlock buffer temporary, but it would lead to too much difficulties:
         * - data, that is written, will not be visible for SELECTs;
         * - new data could be appended to buffer, and in case of exception, we must merge it with old data, that has not been written;
         * - this could lead to infinite memory growth.
+        *
+        * In striped mode the insert lock is released: new data goes to the emptied stripe while the snapshot
+        *  is written (memory growth is bounded by the flush lock - only one flush of a stripe at a time),
+        *  and in case of exception the snapshot is merged back with that new data.
+        * The snapshot is not visible for SELECTs for the duration of the write.
         */
+    if (striped_mode)
+        lock.unlock();
+
     try
     {
         writeBlockToDestination(block_to_write, context.tryGetTable(destination_database, destination_table));
@@ -487,12 +538,22 @@ void StorageBuffer::flushBuffer(Buffer & buffer, bool check_thresholds)
     {
         ProfileEvents::increment(ProfileEvents::StorageBufferErrorOnFlush);
 
-        /// Return the block to its place in the buffer.
+        if (striped_mode)
+            lock.lock();
 
-        CurrentMetrics::add(CurrentMetrics::StorageBufferRows, block_to_write.rows());
-        CurrentMetrics::add(CurrentMetrics::StorageBufferBytes, block_to_write.bytes());
+        /// Return the block to its place in the buffer, merging it with the data inserted during the write attempt.
 
-        buffer.data.swap(block_to_write);
+        if (buffer.data.rows())
+        {
+            appendBlock(block_to_write, buffer.data);
+        }
+        else
+        {
+            CurrentMetrics::add(CurrentMetrics::StorageBufferRows, block_to_write.rows());
+            CurrentMetrics::add(CurrentMetrics::StorageBufferBytes, block_to_write.bytes());
+
+            buffer.data.swap(block_to_write);
+        }
 
         if (!buffer.first_write_time)
             buffer.first_write_time = current_time;
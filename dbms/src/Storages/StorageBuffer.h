@@ -35,6 +35,12 @@ class Context;
   *
   * When you destroy a Buffer table, all remaining data is flushed to the subordinate table.
   * The data in the buffer is not replicated, not logged to disk, not indexed. With a rough restart of the server, the data is lost.
+  *
+  * If the buffer_insert_stripes setting is non-zero, the table works in striped mode: there are that many buffers,
+  *  the buffer is selected by the thread number only, and a flush writes a snapshot taken by a quick swap under the lock,
+  *  so inserts are not blocked for the duration of the write to the subordinate table.
+  * In exchange, the data being flushed is not visible to SELECT from the buffer until it appears in the subordinate table.
+  * Different buffers are flushed concurrently in this mode.
   */
 class StorageBuffer : public ext::shared_ptr_helper<StorageBuffer>, public IStorage
 {
@@ -93,12 +99,17 @@ private:
         time_t first_write_time = 0;
         Block data;
         std::mutex mutex;
+        /// Serializes flushes of one buffer in striped mode, when the insert lock is not held for the whole flush.
+        std::mutex flush_mutex;
     };
 
     /// There are `num_shards` of independent buffers.
     const size_t num_shards;
     std::vector<Buffer> buffers;
 
+    /// See the buffer_insert_stripes setting.
+    const bool striped_mode;
+
     const Thresholds min_thresholds;
     const Thresholds max_thresholds;
 
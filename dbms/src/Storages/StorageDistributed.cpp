@@ -216,8 +216,27 @@ BlockInputStreams StorageDistributed::read(
     ClusterProxy::SelectStreamFactory select_stream_factory(
         processed_stage,  QualifiedTableName{remote_database, remote_table}, external_tables);
 
+    Settings new_settings = settings;
+
+    /** When the mergeable states are merged in the memory-saving mode, the initiator goes strictly
+      *  bucket by bucket - but only across the shards that returned two-level (bucketed) blocks.
+      * Left to themselves, the shards choose single vs two-level independently of each other,
+      *  by the size of their local result, so the single-level blocks of the smaller shards
+      *  are accumulated on the initiator until the end of the merge.
+      * Force the conversion to two-level up front on all shards, so that every stream is bucket-ordered
+      *  and the initiator holds one bucket per shard regardless of the total cardinality.
+      */
+    if (processed_stage == QueryProcessingStage::WithMergeableState
+        && settings.distributed_aggregation_memory_efficient
+        && settings.distributed_aggregation_force_two_level
+        && (settings.group_by_two_level_threshold || settings.group_by_two_level_threshold_bytes)    /// not explicitly disabled
+        && typeid_cast<const ASTSelectQuery &>(*query_info.query).group_expression_list)
+    {
+        new_settings.group_by_two_level_threshold = 1;
+    }
+
     return ClusterProxy::executeQuery(
-            select_stream_factory, cluster, modified_query_ast, context, settings);
+            select_stream_factory, cluster, modified_query_ast, context, new_settings);
 }
 
 
@@ -9,6 +9,7 @@
 #include <Parsers/ASTFunction.h>
 #include <Parsers/ASTIdentifier.h>
 #include <Parsers/ASTLiteral.h>
+#include <Parsers/ASTSetQuery.h>
 
 #include <Interpreters/Context.h>
 #include <Interpreters/evaluateConstantExpression.h>
@@ -152,7 +153,8 @@ static void appendGraphitePattern(const Context & context,
     {
         if (key == "regexp")
         {
-            pattern.regexp = std::make_shared<OptimizedRegularExpression>(config.getString(config_element + ".regexp"));
+            pattern.regexp_str = config.getString(config_element + ".regexp");
+            pattern.regexp = std::make_shared<OptimizedRegularExpression>(pattern.regexp_str);
         }
         else if (key == "function")
         {
@@ -428,7 +430,8 @@ StoragePtr StorageFactory::get(
         return StorageJoin::create(
             data_path, table_name,
             key_names, kind, strictness,
-            columns, materialized_columns, alias_columns, column_defaults);
+            columns, materialized_columns, alias_columns, column_defaults,
+            context.getSettingsRef().join_build_threads);
     }
     else if (name == "Memory")
     {
@@ -923,6 +926,25 @@ For further info please read the documentation: https://clickhouse.yandex/
         else
             throw Exception(String("Index granularity must be a positive integer") + verbose_help, ErrorCodes::BAD_ARGUMENTS);
 
+        ASTPtr ttl_expression = typeid_cast<ASTCreateQuery &>(*query).ttl_expression;
+
+        /// Merges on different replicas are performed at different times, and rows expired on one replica
+        ///  but not on another would make the resulting parts differ.
+        if (replicated && ttl_expression)
+            throw Exception("TTL is not supported for replicated tables", ErrorCodes::BAD_ARGUMENTS);
+
+        ASTPtr projection_query = typeid_cast<ASTCreateQuery &>(*query).projection_query;
+
+        /// Projection data is not included in the part checksums and is not replicated.
+        if (replicated && projection_query)
+            throw Exception("PROJECTION is not supported for replicated tables", ErrorCodes::BAD_ARGUMENTS);
+
+        /// Per-table overrides of MergeTree settings from the SETTINGS clause.
+        MergeTreeSettings merge_tree_settings = context.getMergeTreeSettings();
+        if (ASTPtr table_settings = typeid_cast<ASTCreateQuery &>(*query).table_settings)
+            for (const auto & change : typeid_cast<const ASTSetQuery &>(*table_settings).changes)
+                merge_tree_settings.set(change.name, change.value);
+
         if (replicated)
             return StorageReplicatedMergeTree::create(
                 zookeeper_path, replica_name, attach, data_path, database_name, table_name,
@@ -930,15 +952,15 @@ For further info please read the documentation: https://clickhouse.yandex/
                 context, primary_expr_list, date_column_name, partition_expr_ast,
                 sampling_expression, index_granularity, merging_params,
                 has_force_restore_data_flag,
-                context.getMergeTreeSettings());
+                merge_tree_settings);
         else
             return StorageMergeTree::create(
                 data_path, database_name, table_name,
                 columns, materialized_columns, alias_columns, column_defaults, attach,
                 context, primary_expr_list, date_column_name, partition_expr_ast,
-                sampling_expression, index_granularity, merging_params,
+                sampling_expression, ttl_expression, projection_query, index_granularity, merging_params,
                 has_force_restore_data_flag,
-                context.getMergeTreeSettings());
+                merge_tree_settings);
     }
     else
         throw Exception("Unknown storage " + name, ErrorCodes::UNKNOWN_STORAGE);
@@ -0,0 +1,191 @@
+#include <sstream>
+#include <pcg_random.hpp>
+
+#include <Common/Exception.h>
+#include <Common/HashTable/Hash.h>
+#include <Common/randomSeed.h>
+#include <Common/typeid_cast.h>
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnFixedString.h>
+#include <DataStreams/IProfilingBlockInputStream.h>
+#include <Storages/StorageGenerateRandom.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int NOT_IMPLEMENTED;
+}
+
+namespace
+{
+
+/// One pseudo-random value. With `max_distinct` the value is drawn from a set of that size,
+///  then hashed, so the values are spread over the whole range but their cardinality is limited.
+UInt64 nextValue(pcg64 & generator, UInt64 max_distinct)
+{
+    if (max_distinct)
+        return intHash64(generator() % max_distinct);
+    return generator();
+}
+
+template <typename T>
+bool tryFillNumericColumn(IColumn & column, size_t rows, pcg64 & generator, UInt64 max_distinct)
+{
+    auto * typed = typeid_cast<ColumnVector<T> *>(&column);
+    if (!typed)
+        return false;
+
+    auto & data = typed->getData();
+    data.resize(rows);
+
+    for (size_t i = 0; i < rows; ++i)
+        data[i] = static_cast<T>(nextValue(generator, max_distinct));
+
+    return true;
+}
+
+void fillColumnWithRandomData(IColumn & column, const IDataType & type,
+    size_t rows, pcg64 & generator, UInt64 max_string_length, UInt64 max_distinct)
+{
+    if (tryFillNumericColumn<UInt8>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<UInt16>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<UInt32>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<UInt64>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<Int8>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<Int16>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<Int32>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<Int64>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<Float32>(column, rows, generator, max_distinct)
+        || tryFillNumericColumn<Float64>(column, rows, generator, max_distinct))
+        return;
+
+    if (auto * column_string = typeid_cast<ColumnString *>(&column))
+    {
+        String value;
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            /// The string is a function of the drawn value, so max_distinct is respected.
+            pcg32 value_generator(nextValue(generator, max_distinct));
+
+            value.resize(value_generator() % (max_string_length + 1));
+            for (auto & c : value)
+                c = 'a' + value_generator() % 26;
+
+            column_string->insertData(value.data(), value.size());
+        }
+
+        return;
+    }
+
+    if (auto * column_fixed_string = typeid_cast<ColumnFixedString *>(&column))
+    {
+        size_t n = column_fixed_string->getN();
+        auto & chars = column_fixed_string->getChars();
+        chars.resize(rows * n);
+
+        for (size_t i = 0; i < rows; ++i)
+        {
+            pcg32 value_generator(nextValue(generator, max_distinct));
+
+            for (size_t j = 0; j < n; ++j)
+                chars[i * n + j] = 'a' + value_generator() % 26;
+        }
+
+        return;
+    }
+
+    throw Exception("Table function generateRandom does not support type " + type.getName(),
+        ErrorCodes::NOT_IMPLEMENTED);
+}
+
+
+class GenerateRandomBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    GenerateRandomBlockInputStream(const NamesAndTypesList & columns_, size_t block_size_,
+            UInt64 seed, UInt64 max_string_length_, UInt64 max_distinct_)
+        : columns(columns_), block_size(block_size_), generator(seed),
+        max_string_length(max_string_length_), max_distinct(max_distinct_) {}
+
+    String getName() const override { return "GenerateRandom"; }
+
+    String getID() const override
+    {
+        std::stringstream res;
+        res << "GenerateRandom(" << this << ")";
+        return res.str();
+    }
+
+protected:
+    Block readImpl() override
+    {
+        Block res;
+
+        for (const auto & name_type : columns)
+        {
+            ColumnWithTypeAndName column_with_type_and_name;
+            column_with_type_and_name.name = name_type.name;
+            column_with_type_and_name.type = name_type.type;
+            column_with_type_and_name.column = name_type.type->createColumn();
+
+            fillColumnWithRandomData(*column_with_type_and_name.column, *name_type.type,
+                block_size, generator, max_string_length, max_distinct);
+
+            res.insert(std::move(column_with_type_and_name));
+        }
+
+        return res;
+    }
+
+private:
+    NamesAndTypesList columns;
+    size_t block_size;
+    pcg64 generator;
+    UInt64 max_string_length;
+    UInt64 max_distinct;
+};
+
+}
+
+
+StorageGenerateRandom::StorageGenerateRandom(const std::string & name_, const NamesAndTypesList & columns_,
+        UInt64 max_string_length_, UInt64 max_distinct_, UInt64 random_seed_)
+    : name(name_), columns(columns_),
+    max_string_length(max_string_length_), max_distinct(max_distinct_), random_seed(random_seed_)
+{
+}
+
+
+BlockInputStreams StorageGenerateRandom::read(
+    const Names & column_names,
+    const SelectQueryInfo & query_info,
+    const Context & context,
+    QueryProcessingStage::Enum & processed_stage,
+    size_t max_block_size,
+    unsigned num_streams)
+{
+    check(column_names);
+    processed_stage = QueryProcessingStage::FetchColumns;
+
+    NamesAndTypesList columns_to_read = columns.filter(column_names);
+
+    BlockInputStreams res(num_streams);
+    for (size_t i = 0; i < num_streams; ++i)
+    {
+        /// Each stream generates its own, non-overlapping sequence; with a fixed seed the result
+        ///  of every stream is reproducible.
+        UInt64 seed = random_seed ? random_seed + i : randomSeed();
+
+        res[i] = std::make_shared<GenerateRandomBlockInputStream>(
+            columns_to_read, max_block_size, seed, max_string_length, max_distinct);
+    }
+
+    return res;
+}
+
+}
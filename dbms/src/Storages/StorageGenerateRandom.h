@@ -0,0 +1,48 @@
+#pragma once
+
+#include <ext/shared_ptr_helper.h>
+#include <Storages/IStorage.h>
+
+
+namespace DB
+{
+
+class Context;
+
+
+/** Generates random data of the given structure, for load testing and benchmarks.
+  * The stream is unlimited (cut it with LIMIT) and is produced in `num_streams` parallel threads.
+  *
+  * max_string_length - maximum length of generated String values;
+  * max_distinct - approximate number of distinct values per column (0 - unlimited);
+  * random_seed - makes generated data reproducible; each stream derives its own seed from it (0 - randomize).
+  */
+class StorageGenerateRandom : public ext::shared_ptr_helper<StorageGenerateRandom>, public IStorage
+{
+friend class ext::shared_ptr_helper<StorageGenerateRandom>;
+public:
+    std::string getName() const override { return "GenerateRandom"; }
+    std::string getTableName() const override { return name; }
+
+    const NamesAndTypesList & getColumnsListImpl() const override { return columns; }
+
+    BlockInputStreams read(
+        const Names & column_names,
+        const SelectQueryInfo & query_info,
+        const Context & context,
+        QueryProcessingStage::Enum & processed_stage,
+        size_t max_block_size,
+        unsigned num_streams) override;
+
+private:
+    const std::string name;
+    NamesAndTypesList columns;
+    UInt64 max_string_length;
+    UInt64 max_distinct;
+    UInt64 random_seed;
+
+    StorageGenerateRandom(const std::string & name_, const NamesAndTypesList & columns_,
+        UInt64 max_string_length_, UInt64 max_distinct_, UInt64 random_seed_);
+};
+
+}
@@ -21,7 +21,8 @@ StorageJoin::StorageJoin(
     NamesAndTypesListPtr columns_,
     const NamesAndTypesList & materialized_columns_,
     const NamesAndTypesList & alias_columns_,
-    const ColumnDefaults & column_defaults_)
+    const ColumnDefaults & column_defaults_,
+    size_t build_threads_)
     : StorageSetOrJoinBase{path_, name_, columns_, materialized_columns_, alias_columns_, column_defaults_},
     key_names(key_names_), kind(kind_), strictness(strictness_)
 {
@@ -42,7 +43,9 @@ StorageJoin::StorageJoin(
 
     /// NOTE StorageJoin doesn't use join_use_nulls setting.
 
-    join = std::make_shared<Join>(key_names, key_names, false /* use_nulls */, Limits(), kind, strictness);
+    /// With build_threads the Join is sharded and restore() builds the shards in parallel.
+    join = std::make_shared<Join>(key_names, key_names, false /* use_nulls */, Limits(), kind, strictness,
+        "" /* tmp_path: spilling to disk is not used for a persisted table */, build_threads_);
     join->setSampleBlock(getSampleBlock());
     restore();
 }
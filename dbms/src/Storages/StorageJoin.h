@@ -33,11 +33,12 @@ public:
         NamesAndTypesListPtr columns_,
         const NamesAndTypesList & materialized_columns_,
         const NamesAndTypesList & alias_columns_,
-        const ColumnDefaults & column_defaults_)
+        const ColumnDefaults & column_defaults_,
+        size_t build_threads_ = 0)
     {
         return ext::shared_ptr_helper<StorageJoin>::make_shared(
             path_, name_, key_names_, kind_, strictness_,
-            columns_, materialized_columns_, alias_columns_, column_defaults_
+            columns_, materialized_columns_, alias_columns_, column_defaults_, build_threads_
         );
     }
 
@@ -64,7 +65,8 @@ private:
         NamesAndTypesListPtr columns_,
         const NamesAndTypesList & materialized_columns_,
         const NamesAndTypesList & alias_columns_,
-        const ColumnDefaults & column_defaults_);
+        const ColumnDefaults & column_defaults_,
+        size_t build_threads_);
 
     void insertBlock(const Block & block) override;
     size_t getSize() const override;
@@ -125,6 +125,9 @@ private:
     using FileStreams = std::map<std::string, std::unique_ptr<Stream>>;
     FileStreams streams;
 
+    /// Used to reduce the number of reallocations when creating columns of variable size.
+    std::map<std::string, double> avg_value_size_hints;
+
     void addStream(const String & name, const IDataType & type, size_t level = 0);
     void readData(const String & name, const IDataType & type, IColumn & column, size_t max_rows_to_read, size_t level = 0, bool read_offsets = true);
 };
@@ -388,7 +391,11 @@ void LogBlockInputStream::readData(const String & name, const IDataType & type,
                 level + 1);
     }
     else
-        type.deserializeBinaryBulk(column, streams[name]->compressed, max_rows_to_read, 0);    /// TODO Use avg_value_size_hint.
+    {
+        double & avg_value_size_hint = avg_value_size_hints[name];
+        type.deserializeBinaryBulk(column, streams[name]->compressed, max_rows_to_read, avg_value_size_hint);
+        IDataType::updateAvgValueSizeHint(column, avg_value_size_hint);
+    }
 }
 
 
@@ -13,8 +13,10 @@ namespace DB
 class MemoryBlockInputStream : public IProfilingBlockInputStream
 {
 public:
-    MemoryBlockInputStream(const Names & column_names_, BlocksList::iterator begin_, BlocksList::iterator end_)
-        : column_names(column_names_), begin(begin_), end(end_), it(begin) {}
+    MemoryBlockInputStream(const Names & column_names_,
+        BlocksList::const_iterator begin_, BlocksList::const_iterator end_,
+        StorageMemory::DataPtr data_)
+        : column_names(column_names_), begin(begin_), end(end_), it(begin), data(std::move(data_)) {}
 
     String getName() const override { return "Memory"; }
 
@@ -52,9 +54,11 @@ protected:
     }
 private:
     Names column_names;
-    BlocksList::iterator begin;
-    BlocksList::iterator end;
-    BlocksList::iterator it;
+    BlocksList::const_iterator begin;
+    BlocksList::const_iterator end;
+    BlocksList::const_iterator it;
+    /// Keeps the snapshot of the data alive even if the table is truncated or dropped meanwhile.
+    StorageMemory::DataPtr data;
 };
 
 
@@ -66,8 +70,18 @@ public:
     void write(const Block & block) override
     {
         storage.check(block, true);
+
+        /// Appending does not invalidate the iterators of the readers, and the new block stays
+        ///  invisible to them until the state with the increased size is published.
         std::lock_guard<std::mutex> lock(storage.mutex);
-        storage.data.push_back(block);
+
+        auto current = std::atomic_load(&storage.data);
+        current->blocks->push_back(block);
+
+        auto published = std::make_shared<StorageMemory::Data>();
+        published->blocks = current->blocks;
+        published->size = current->size + 1;
+        std::atomic_store(&storage.data, StorageMemory::DataPtr(published));
     }
 private:
     StorageMemory & storage;
@@ -105,9 +119,11 @@ BlockInputStreams StorageMemory::read(
     check(column_names);
     processed_stage = QueryProcessingStage::FetchColumns;
 
-    std::lock_guard<std::mutex> lock(mutex);
+    /// A consistent snapshot of the published blocks; concurrent writers are not blocked
+    ///  and their appends are not seen.
+    DataPtr snapshot = std::atomic_load(&data);
 
-    size_t size = data.size();
+    size_t size = snapshot->size;
 
     if (num_streams > size)
         num_streams = size;
@@ -116,13 +132,13 @@ BlockInputStreams StorageMemory::read(
 
     for (size_t stream = 0; stream < num_streams; ++stream)
     {
-        BlocksList::iterator begin = data.begin();
-        BlocksList::iterator end = data.begin();
+        BlocksList::const_iterator begin = snapshot->blocks->begin();
+        BlocksList::const_iterator end = snapshot->blocks->begin();
 
         std::advance(begin, stream * size / num_streams);
         std::advance(end, (stream + 1) * size / num_streams);
 
-        res.push_back(std::make_shared<MemoryBlockInputStream>(column_names, begin, end));
+        res.push_back(std::make_shared<MemoryBlockInputStream>(column_names, begin, end, snapshot));
     }
 
     return res;
@@ -138,8 +154,9 @@ BlockOutputStreamPtr StorageMemory::write(
 
 void StorageMemory::drop()
 {
+    /// The readers holding the old snapshot keep it alive until they finish.
     std::lock_guard<std::mutex> lock(mutex);
-    data.clear();
+    std::atomic_store(&data, DataPtr(std::make_shared<Data>()));
 }
 
 }
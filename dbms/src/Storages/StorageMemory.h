@@ -32,7 +32,7 @@ public:
 
     const NamesAndTypesList & getColumnsListImpl() const override { return *columns; }
 
-    size_t getSize() const { return data.size(); }
+    size_t getSize() const { return std::atomic_load(&data)->size; }
 
     BlockInputStreams read(
         const Names & column_names,
@@ -51,9 +51,25 @@ private:
     String name;
     NamesAndTypesListPtr columns;
 
-    /// The data itself. `list` - so that when inserted to the end, the existing iterators are not invalidated.
-    BlocksList data;
-
+    /** The state visible to the readers: the list of blocks and how many of them are published.
+      * Blocks are only ever appended to the list, so the existing iterators are not invalidated,
+      *  and a reader uses the first `size` elements - the tail a writer may be appending to
+      *  stays invisible until the writer publishes a new state.
+      */
+    struct Data
+    {
+        /// `list` - so that when inserted to the end, the existing iterators are not invalidated.
+        std::shared_ptr<BlocksList> blocks = std::make_shared<BlocksList>();
+        size_t size = 0;
+    };
+
+    using DataPtr = std::shared_ptr<const Data>;
+
+    /// Accessed with std::atomic_load / std::atomic_store: readers take a consistent snapshot
+    ///  without locking, and writers never block them.
+    DataPtr data = std::make_shared<Data>();
+
+    /// Serializes the writers (and drop) with each other only.
     std::mutex mutex;
 
     StorageMemory(
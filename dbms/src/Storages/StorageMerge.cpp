@@ -18,6 +18,8 @@
 #include <Parsers/ASTIdentifier.h>
 #include <Parsers/ASTExpressionList.h>
 
+#include <algorithm>
+
 
 namespace DB
 {
@@ -132,6 +134,19 @@ namespace
 
         relinkSetsImpl(query, node_hash_to_set, new_sets);
     }
+
+    /// Which columns the expression references: the `_table` virtual column, ordinary columns.
+    void analyzeTableColumnUsage(const ASTPtr & node, bool & has_table, bool & has_other)
+    {
+        if (const ASTIdentifier * identifier = typeid_cast<const ASTIdentifier *>(node.get()))
+        {
+            if (identifier->kind == ASTIdentifier::Kind::Column)
+                (identifier->name == "_table" ? has_table : has_other) = true;
+        }
+
+        for (const auto & child : node->children)
+            analyzeTableColumnUsage(child, has_table, has_other);
+    }
 }
 
 
@@ -310,6 +325,103 @@ BlockInputStreams StorageMerge::read(
     return res;
 }
 
+bool StorageMerge::selectTablesForMetadataQuery(
+    const SelectQueryInfo & query_info,
+    const Context & context,
+    StorageListWithLocks & out_tables,
+    SelectQueryInfo & out_query_info) const
+{
+    const ASTSelectQuery & select = typeid_cast<const ASTSelectQuery &>(*query_info.query);
+
+    bool where_on_table_only = false;
+    if (select.where_expression)
+    {
+        bool has_table = false;
+        bool has_other = false;
+        analyzeTableColumnUsage(select.where_expression, has_table, has_other);
+
+        /// A condition mixing `_table` with ordinary columns cannot be split between
+        ///  the table selection here and the per-table metadata.
+        if (has_table && has_other)
+            return false;
+
+        where_on_table_only = has_table;
+    }
+
+    out_tables = getSelectedTables();
+
+    if (where_on_table_only)
+    {
+        /// The condition is constant within each table - it selects tables as a whole, as in read().
+        Block virtual_columns_block = getBlockWithVirtualColumns(out_tables);
+        VirtualColumnUtils::filterBlockWithQuery(query_info.query, virtual_columns_block, context);
+        auto values = VirtualColumnUtils::extractSingleValueFromBlock<String>(virtual_columns_block, "_table");
+        out_tables.remove_if([&] (const auto & elem) { return values.find(elem.first->getTableName()) == values.end(); });
+
+        /// The selected tables satisfy the WHERE entirely - do not forward it.
+        out_query_info.query = query_info.query->clone();
+        ASTSelectQuery & modified_select = typeid_cast<ASTSelectQuery &>(*out_query_info.query);
+        modified_select.children.erase(
+            std::remove(modified_select.children.begin(), modified_select.children.end(), modified_select.where_expression),
+            modified_select.children.end());
+        modified_select.where_expression = nullptr;
+        relinkSets(out_query_info.query, query_info.sets, out_query_info.sets);
+    }
+    else
+        out_query_info = query_info;
+
+    return true;
+}
+
+
+std::experimental::optional<UInt64> StorageMerge::totalRowsByMetadata(const SelectQueryInfo & query_info, const Context & context) const
+{
+    StorageListWithLocks selected_tables;
+    SelectQueryInfo modified_query_info;
+    if (!selectTablesForMetadataQuery(query_info, context, selected_tables, modified_query_info))
+        return {};
+
+    UInt64 rows = 0;
+    for (const auto & elem : selected_tables)
+    {
+        auto table_rows = elem.first->totalRowsByMetadata(modified_query_info, context);
+        if (!table_rows)
+            return {};
+
+        rows += *table_rows;
+    }
+
+    return rows;
+}
+
+
+std::experimental::optional<Field> StorageMerge::extremeOfColumnByMetadata(
+    bool is_min, const String & column_name, const SelectQueryInfo & query_info, const Context & context) const
+{
+    StorageListWithLocks selected_tables;
+    SelectQueryInfo modified_query_info;
+    if (!selectTablesForMetadataQuery(query_info, context, selected_tables, modified_query_info))
+        return {};
+
+    Field res;
+    for (const auto & elem : selected_tables)
+    {
+        auto value = elem.first->extremeOfColumnByMetadata(is_min, column_name, modified_query_info, context);
+        if (!value)
+            return {};
+
+        /// Null means the table has no matching rows.
+        if (value->isNull())
+            continue;
+
+        if (res.isNull() || (is_min ? *value < res : res < *value))
+            res = *value;
+    }
+
+    return res;
+}
+
+
 /// Construct a block consisting only of possible values of virtual columns
 Block StorageMerge::getBlockWithVirtualColumns(const StorageListWithLocks & selected_tables) const
 {
@@ -40,6 +40,15 @@ public:
         size_t max_block_size,
         unsigned num_streams) override;
 
+    /** Metadata aggregates are combined over the underlying tables: every table must be able
+      *  to answer from its own metadata. Conditions on the `_table` virtual column select the
+      *  tables and are not forwarded to them.
+      */
+    std::experimental::optional<UInt64> totalRowsByMetadata(const SelectQueryInfo & query_info, const Context & context) const override;
+
+    std::experimental::optional<Field> extremeOfColumnByMetadata(
+        bool is_min, const String & column_name, const SelectQueryInfo & query_info, const Context & context) const override;
+
     void drop() override {}
     void rename(const String & new_path_to_db, const String & new_database_name, const String & new_table_name) override { name = new_table_name; }
 
@@ -76,6 +85,17 @@ private:
     StorageListWithLocks getSelectedTables() const;
 
     Block getBlockWithVirtualColumns(const StorageListWithLocks & selected_tables) const;
+
+    /** For totalRowsByMetadata and extremeOfColumnByMetadata: the tables selected by the
+      *  conditions on `_table` and the query to forward to each of them (with these conditions
+      *  removed). Returns false if the split cannot be decided - the WHERE mixes `_table`
+      *  with ordinary columns.
+      */
+    bool selectTablesForMetadataQuery(
+        const SelectQueryInfo & query_info,
+        const Context & context,
+        StorageListWithLocks & out_tables,
+        SelectQueryInfo & out_query_info) const;
 };
 
 }
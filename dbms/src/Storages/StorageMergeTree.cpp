@@ -1,17 +1,28 @@
 #include <experimental/optional>
 #include <Core/FieldVisitors.h>
 #include <Storages/StorageMergeTree.h>
+#include <Storages/MergeTree/MergeTreeBlockInputStream.h>
 #include <Storages/MergeTree/MergeTreeBlockOutputStream.h>
 #include <Storages/MergeTree/DiskSpaceMonitor.h>
 #include <Storages/MergeTree/MergeList.h>
+#include <Storages/MergeTree/MergeScheduler.h>
 #include <Databases/IDatabase.h>
 #include <Common/escapeForFileName.h>
 #include <Common/typeid_cast.h>
+#include <Common/GlobalWorkPool.h>
+#include <common/ThreadPool.h>
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnConst.h>
+#include <Columns/ColumnNullable.h>
+#include <Interpreters/ExpressionAnalyzer.h>
 #include <Interpreters/InterpreterAlterQuery.h>
 #include <Interpreters/PartLog.h>
 #include <Parsers/ASTFunction.h>
 #include <Parsers/ASTLiteral.h>
 #include <Parsers/ASTSelectQuery.h>
+#include <Parsers/queryToString.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <IO/CompressedReadBufferFromFile.h>
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <Storages/MergeTree/ActiveDataPartSet.h>
 
@@ -27,6 +38,7 @@ namespace ErrorCodes
     extern const int ABORTED;
     extern const int BAD_ARGUMENTS;
     extern const int INCORRECT_DATA;
+    extern const int ILLEGAL_TYPE_OF_COLUMN_FOR_FILTER;
 }
 
 
@@ -44,6 +56,8 @@ StorageMergeTree::StorageMergeTree(
     const String & date_column_name,
     const ASTPtr & partition_expr_ast_,
     const ASTPtr & sampling_expression_, /// nullptr, if sampling is not supported.
+    const ASTPtr & ttl_expression_, /// nullptr, if rows do not expire.
+    const ASTPtr & projection_query_, /// nullptr, if the table has no projection.
     size_t index_granularity_,
     const MergeTreeData::MergingParams & merging_params_,
     bool has_force_restore_data_flag,
@@ -55,9 +69,9 @@ StorageMergeTree::StorageMergeTree(
          full_path, columns_,
          materialized_columns_, alias_columns_, column_defaults_,
          context_, primary_expr_ast_, date_column_name, partition_expr_ast_,
-         sampling_expression_, index_granularity_, merging_params_,
+         sampling_expression_, ttl_expression_, projection_query_, index_granularity_, merging_params_,
          settings_, database_name_ + "." + table_name, false, attach),
-    reader(data), writer(data), merger(data, context.getBackgroundPool()),
+    reader(data), writer(data), merger(data, context.getBackgroundPool()), scrubber(data),
     log(&Logger::get(database_name_ + "." + table_name + " (StorageMergeTree)"))
 {
     data.loadDataParts(has_force_restore_data_flag);
@@ -83,6 +97,9 @@ StorageMergeTree::StorageMergeTree(
 void StorageMergeTree::startup()
 {
     merge_task_handle = background_pool.addTask([this] { return mergeTask(); });
+
+    if (data.settings.background_scrub_bytes_per_second)
+        scrub_task_handle = background_pool.addTask([this] { return scrubber.run(); });
 }
 
 
@@ -92,8 +109,11 @@ void StorageMergeTree::shutdown()
         return;
     shutdown_called = true;
     merger.cancelForever();
+    scrubber.cancel();
     if (merge_task_handle)
         background_pool.removeTask(merge_task_handle);
+    if (scrub_task_handle)
+        background_pool.removeTask(scrub_task_handle);
 }
 
 
@@ -110,12 +130,106 @@ BlockInputStreams StorageMergeTree::read(
     const size_t max_block_size,
     const unsigned num_streams)
 {
+    if (data.projection_query)
+    {
+        BlockInputStreams projection_streams = readFromProjection(query_info, processed_stage);
+        if (!projection_streams.empty())
+            return projection_streams;
+    }
+
     return reader.read(column_names, query_info, context, processed_stage, max_block_size, num_streams, nullptr, 0);
 }
 
+
+namespace
+{
+
+/// Reads the stored projection result of one part: blocks with mergeable aggregation states.
+class MergeTreeProjectionBlockInputStream : public IProfilingBlockInputStream
+{
+public:
+    MergeTreeProjectionBlockInputStream(const MergeTreeData::DataPartPtr & part_)
+        : part(part_)
+        , part_columns_lock(part->columns_lock)
+        , file_in(part->getFullPath() + MergeTreeDataPart::PROJECTION_FILE_NAME, 0, 0)
+        , block_in(file_in)
+    {
+    }
+
+    String getName() const override { return "MergeTreeProjection"; }
+
+    String getID() const override { return "MergeTreeProjection(" + part->name + ")"; }
+
+protected:
+    Block readImpl() override { return block_in.read(); }
+
+private:
+    /// Holds the part so that it is not deleted from disk while being read.
+    MergeTreeData::DataPartPtr part;
+    std::shared_lock<std::shared_mutex> part_columns_lock;
+    CompressedReadBufferFromFile file_in;
+    NativeBlockInputStream block_in;
+};
+
+}
+
+
+BlockInputStreams StorageMergeTree::readFromProjection(
+    const SelectQueryInfo & query_info,
+    QueryProcessingStage::Enum & processed_stage)
+{
+    const auto & select = typeid_cast<const ASTSelectQuery &>(*query_info.query);
+    const auto & projection = typeid_cast<const ASTSelectQuery &>(*data.projection_query);
+
+    /// The query must aggregate the whole table exactly like the projection: the same SELECT list
+    ///  and the same GROUP BY. HAVING, ORDER BY and LIMIT are applied by the interpreter
+    ///  above the WithMergeableState stage and need no check here.
+    if (select.prewhere_expression || select.where_expression || select.sample_size()
+        || select.array_join_expression_list() || select.final() || select.distinct)
+        return {};
+
+    if (!select.group_expression_list
+        || queryToString(select.group_expression_list) != queryToString(projection.group_expression_list)
+        || queryToString(select.select_expression_list) != queryToString(projection.select_expression_list))
+        return {};
+
+    MergeTreeData::DataPartsVector parts = data.getDataPartsVector();
+    if (parts.empty())
+        return {};
+
+    BlockInputStreams res;
+    res.reserve(parts.size());
+    for (const auto & part : parts)
+    {
+        /// Parts written before the projection was added have no projection data,
+        ///  and after a DELETE the stored states no longer reflect the surviving rows
+        ///  (the next merge of the part recomputes them).
+        if (!part->projection_exists || part->deleted_rows_mask.initialized)
+            return {};
+
+        res.emplace_back(std::make_shared<MergeTreeProjectionBlockInputStream>(part));
+    }
+
+    LOG_DEBUG(log, "Reading mergeable aggregation states from the projections of " << res.size() << " parts");
+
+    processed_stage = QueryProcessingStage::WithMergeableState;
+    return res;
+}
+
+std::experimental::optional<UInt64> StorageMergeTree::totalRowsByMetadata(const SelectQueryInfo & query_info, const Context & context) const
+{
+    return reader.countRowsByMetadata(query_info, context);
+}
+
+std::experimental::optional<Field> StorageMergeTree::extremeOfColumnByMetadata(
+    bool is_min, const String & column_name, const SelectQueryInfo & query_info, const Context & context) const
+{
+    return reader.extremeOfColumnByMetadata(is_min, column_name, query_info, context);
+}
+
 BlockOutputStreamPtr StorageMergeTree::write(const ASTPtr & query, const Settings & settings)
 {
-    return std::make_shared<MergeTreeBlockOutputStream>(*this);
+    return std::make_shared<MergeTreeBlockOutputStream>(*this, settings.insert_sorted_by_primary_key);
 }
 
 bool StorageMergeTree::checkTableCanBeDropped() const
@@ -189,11 +303,47 @@ void StorageMergeTree::alter(
     if (primary_key_is_modified && supportsSampling())
         throw Exception("MODIFY PRIMARY KEY only supported for tables without sampling key", ErrorCodes::BAD_ARGUMENTS);
 
-    MergeTreeData::DataParts parts = data.getAllDataParts();
-    for (const MergeTreeData::DataPartPtr & part : parts)
+    MergeTreeData::DataParts parts_set = data.getAllDataParts();
+    MergeTreeData::DataPartsVector parts(parts_set.begin(), parts_set.end());
+
+    size_t num_jobs = std::min(parts.size(), std::max(static_cast<size_t>(1), static_cast<size_t>(context.getSettingsRef().max_threads)));
+
+    if (num_jobs <= 1)
     {
-        if (auto transaction = data.alterDataPart(part, columns_for_parts, new_primary_key_ast, false))
-            transactions.push_back(std::move(transaction));
+        for (const MergeTreeData::DataPartPtr & part : parts)
+        {
+            if (auto transaction = data.alterDataPart(part, columns_for_parts, new_primary_key_ast, false))
+                transactions.push_back(std::move(transaction));
+        }
+    }
+    else
+    {
+        /// The parts are rewritten independently of each other - do it concurrently.
+        std::atomic<size_t> next_part {0};
+        std::mutex transactions_mutex;
+
+        auto job_group = GlobalWorkPool::instance().createGroup();
+
+        for (size_t i = 0; i < num_jobs; ++i)
+        {
+            GlobalWorkPool::instance().schedule(job_group,
+                [&, memory_tracker = current_memory_tracker]
+            {
+                current_memory_tracker = memory_tracker;
+
+                size_t index;
+                while ((index = next_part++) < parts.size())
+                {
+                    if (auto transaction = data.alterDataPart(parts[index], columns_for_parts, new_primary_key_ast, false))
+                    {
+                        std::lock_guard<std::mutex> lock(transactions_mutex);
+                        transactions.push_back(std::move(transaction));
+                    }
+                }
+            });
+        }
+
+        GlobalWorkPool::instance().wait(job_group);
     }
 
     auto table_hard_lock = lockStructureForAlter(__PRETTY_FUNCTION__);
@@ -295,6 +445,10 @@ bool StorageMergeTree::merge(
         data.clearOldTemporaryDirectories();
     }
 
+    /// Merges initiated by the OPTIMIZE query are not subject to the I/O budget.
+    if (!aggressive && partition_id.empty() && !context.getMergeScheduler().canStartMerge())
+        return false;
+
     auto structure_lock = lockStructure(true, __PRETTY_FUNCTION__);
 
     size_t disk_space = DiskSpaceMonitor::getUnreservedFreeSpace(full_path);
@@ -322,7 +476,7 @@ bool StorageMergeTree::merge(
         }
         else
         {
-            selected = merger.selectAllPartsToMergeWithinPartition(future_part, disk_space, can_merge, partition_id, final);
+            selected = merger.selectAllPartsToMergeWithinPartition(future_part, disk_space, can_merge, partition_id, final, deduplicate);
         }
 
         if (!selected)
@@ -448,13 +602,152 @@ void StorageMergeTree::clearColumnInPartition(const ASTPtr & partition, const Fi
 }
 
 
+void StorageMergeTree::deleteRowsWhere(const ASTPtr & predicate, const Context & context)
+{
+    /// Asks to complete merges and does not allow them to start.
+    /// Otherwise a merge could finish after the mask of one of its source parts is written
+    ///  and replace the part with one where the rows are still alive.
+    auto merge_blocker = merger.cancel();
+
+    /// Only masks of the parts change; the table structure stays the same.
+    auto lock_read_structure = lockStructure(false, __PRETTY_FUNCTION__);
+
+    ExpressionActionsPtr actions = ExpressionAnalyzer(predicate, context, nullptr, data.getColumnsList()).getActions(false);
+    Names required_columns = actions->getRequiredColumns();
+    String predicate_column_name = predicate->getColumnName();
+
+    /// For a constant predicate, still read at least one column to know the number of rows.
+    if (required_columns.empty())
+        required_columns.push_back(data.getColumnsList().front().name);
+
+    MergeTreeData::DataParts parts = data.getDataParts();
+
+    size_t affected_parts = 0;
+    size_t deleted_rows = 0;
+
+    for (const auto & part : parts)
+    {
+        MergeTreeDataPart::DeletedRowsMask new_mask = part->deleted_rows_mask;
+        size_t previously_deleted = new_mask.deleted_rows;
+
+        {
+            /// Rows are read unmasked: positions in the blocks must correspond to positions in the part.
+            MergeTreeBlockInputStream part_stream(
+                data, part, DEFAULT_MERGE_BLOCK_SIZE, 0, 0, required_columns,
+                MarkRanges(1, MarkRange(0, part->size)), false, nullptr, "", true,
+                context.getSettingsRef().min_bytes_to_use_direct_io, 0, DBMS_DEFAULT_BUFFER_SIZE,
+                false, Names{}, 0, true, /* apply_deleted_rows_mask = */ false);
+
+            size_t current_row = 0;
+            Block block;
+            while ((block = part_stream.read()))
+            {
+                actions->execute(block);
+
+                size_t rows = block.rows();
+                new_mask.bitmap.resize((current_row + rows + 7) / 8, 0);
+
+                ColumnPtr column = block.getByName(predicate_column_name).column;
+                if (column->isNullable())
+                    column = static_cast<const ColumnNullable &>(*column).getNestedColumn();
+
+                if (column->isConst())
+                {
+                    if (static_cast<const ColumnConst &>(*column).getValue<UInt8>())
+                        for (size_t i = 0; i < rows; ++i)
+                            new_mask.setDeleted(current_row + i);
+                }
+                else if (const auto column_vec = typeid_cast<const ColumnUInt8 *>(column.get()))
+                {
+                    const auto & predicate_data = column_vec->getData();
+                    for (size_t i = 0; i < rows; ++i)
+                        if (predicate_data[i])
+                            new_mask.setDeleted(current_row + i);
+                }
+                else
+                    throw Exception("Illegal type " + column->getName() + " of DELETE WHERE condition. Must be UInt8.",
+                        ErrorCodes::ILLEGAL_TYPE_OF_COLUMN_FOR_FILTER);
+
+                current_row += rows;
+            }
+
+            new_mask.rows = current_row;
+        }
+
+        new_mask.deleted_rows = 0;
+        for (const auto byte : new_mask.bitmap)
+            new_mask.deleted_rows += __builtin_popcount(byte);
+
+        if (new_mask.deleted_rows == previously_deleted)
+            continue;
+
+        new_mask.initialized = true;
+
+        ++affected_parts;
+        deleted_rows += new_mask.deleted_rows - previously_deleted;
+        LOG_DEBUG(log, "Marked " << (new_mask.deleted_rows - previously_deleted) << " rows as deleted in part " << part->name);
+
+        /// Readers of the part must not see a half-replaced mask.
+        {
+            std::unique_lock<std::shared_mutex> part_lock(part->columns_lock);
+            new_mask.store(part->getFullPath());
+            part->deleted_rows_mask = std::move(new_mask);
+        }
+    }
+
+    LOG_INFO(log, "Marked " << deleted_rows << " rows as deleted in " << affected_parts << " parts."
+        " They will be physically removed by subsequent merges.");
+}
+
+
 bool StorageMergeTree::optimize(
     const ASTPtr & query, const ASTPtr & partition, bool final, bool deduplicate, const Context & context)
 {
-    String partition_id;
+    size_t aio_threshold = context.getSettingsRef().min_bytes_to_use_direct_io;
+
     if (partition)
-        partition_id = data.getPartitionIDFromQuery(partition, context);
-    return merge(context.getSettingsRef().min_bytes_to_use_direct_io, true, partition_id, final, deduplicate);
+        return merge(aio_threshold, true, data.getPartitionIDFromQuery(partition, context), final, deduplicate);
+
+    /// Without a partition - merge every partition of the table. Partitions are independent,
+    ///  so they are merged concurrently, as many at a time as the `max_threads` setting allows.
+    /// Each merge registers itself in the merge list as usual.
+    std::set<String> partition_ids;
+    for (const auto & part : data.getDataParts())
+        partition_ids.insert(part->info.partition_id);
+
+    if (partition_ids.empty())
+        return false;
+
+    if (partition_ids.size() == 1)
+        return merge(aio_threshold, true, *partition_ids.begin(), final, deduplicate);
+
+    std::vector<String> partitions(partition_ids.begin(), partition_ids.end());
+
+    size_t num_jobs = std::min(partitions.size(), std::max(static_cast<size_t>(1), static_cast<size_t>(context.getSettingsRef().max_threads)));
+
+    std::atomic<size_t> next_partition {0};
+    std::atomic<bool> merged_something {false};
+
+    auto job_group = GlobalWorkPool::instance().createGroup();
+
+    for (size_t i = 0; i < num_jobs; ++i)
+    {
+        GlobalWorkPool::instance().schedule(job_group,
+            [this, &partitions, &next_partition, &merged_something, aio_threshold, final, deduplicate,
+                memory_tracker = current_memory_tracker]
+        {
+            current_memory_tracker = memory_tracker;
+
+            size_t index;
+            while ((index = next_partition++) < partitions.size())
+                if (merge(aio_threshold, true, partitions[index], final, deduplicate))
+                    merged_something = true;
+        });
+    }
+
+    GlobalWorkPool::instance().wait(job_group);
+
+    return merged_something;
 }
 
 
@@ -526,19 +819,29 @@ void StorageMergeTree::attachPartition(const ASTPtr & partition, bool part, cons
         parts = active_parts.getParts();
     }
 
-    for (const auto & source_part_name : parts)
-    {
-        String source_path = source_dir + source_part_name;
+    /// Restoring a backup can attach thousands of parts: check them with several threads
+    ///  and register them in one batch, instead of doing both serially per part.
+    /// The primary index is not read here - it is loaded lazily on first query
+    ///  (see MergeTreeDataPart::getIndex).
+    std::vector<MergeTreeData::MutableDataPartPtr> loaded_parts(parts.size());
 
-        LOG_DEBUG(log, "Checking data");
-        MergeTreeData::MutableDataPartPtr part = data.loadPartAndFixMetadata(source_path);
+    ThreadPool pool(std::max<size_t>(1, std::min(parts.size(), data.settings.max_part_loading_threads)));
 
-        LOG_INFO(log, "Attaching part " << source_part_name << " from " << source_path);
-        data.renameTempPartAndAdd(part, &increment);
-
-        LOG_INFO(log, "Finished attaching part");
+    for (size_t i = 0; i < parts.size(); ++i)
+    {
+        pool.schedule([&, i]
+        {
+            LOG_DEBUG(log, "Checking data of part " << parts[i]);
+            loaded_parts[i] = data.loadPartAndFixMetadata(source_dir + parts[i]);
+        });
     }
 
+    pool.wait();
+
+    LOG_INFO(log, "Attaching " << parts.size() << " parts from " << source_dir);
+    data.renameTempPartsAndAdd(loaded_parts, &increment);
+    LOG_INFO(log, "Finished attaching " << parts.size() << " parts");
+
     /// New parts with other data may appear in place of deleted parts.
     context.dropCaches();
 }
@@ -549,4 +852,18 @@ void StorageMergeTree::freezePartition(const ASTPtr & partition, const String &
     data.freezePartition(partition, with_name, context);
 }
 
+
+void StorageMergeTree::clonePartsFrom(StorageMergeTree & source)
+{
+    MergeTreeData::DataPartsVector source_parts = source.data.getDataPartsVector();
+
+    LOG_INFO(log, "Cloning " << source_parts.size() << " parts from table " << source.getTableName());
+
+    for (const auto & source_part : source_parts)
+    {
+        MergeTreeData::MutableDataPartPtr part = data.cloneAndLoadDataPart(source_part);
+        data.renameTempPartAndAdd(part, &increment);
+    }
+}
+
 }
@@ -6,6 +6,7 @@
 #include <Storages/MergeTree/MergeTreeDataSelectExecutor.h>
 #include <Storages/MergeTree/MergeTreeDataWriter.h>
 #include <Storages/MergeTree/MergeTreeDataMerger.h>
+#include <Storages/MergeTree/MergeTreePartScrubber.h>
 #include <Storages/MergeTree/DiskSpaceMonitor.h>
 #include <Storages/MergeTree/BackgroundProcessingPool.h>
 #include <Common/SimpleIncrement.h>
@@ -37,6 +38,8 @@ public:
     bool supportsPrewhere() const override { return data.supportsPrewhere(); }
     bool supportsParallelReplicas() const override { return true; }
 
+    ASTPtr getTTLExpression() const override { return data.ttl_expression; }
+
     const NamesAndTypesList & getColumnsListImpl() const override { return data.getColumnsListNonMaterialized(); }
 
     NameAndTypePair getColumn(const String & column_name) const override
@@ -57,6 +60,11 @@ public:
         size_t max_block_size,
         unsigned num_streams) override;
 
+    std::experimental::optional<UInt64> totalRowsByMetadata(const SelectQueryInfo & query_info, const Context & context) const override;
+
+    std::experimental::optional<Field> extremeOfColumnByMetadata(
+        bool is_min, const String & column_name, const SelectQueryInfo & query_info, const Context & context) const override;
+
     BlockOutputStreamPtr write(const ASTPtr & query, const Settings & settings) override;
 
     /** Perform the next step in combining the parts.
@@ -65,9 +73,15 @@ public:
 
     void dropPartition(const ASTPtr & query, const ASTPtr & partition, bool detach, const Context & context) override;
     void clearColumnInPartition(const ASTPtr & partition, const Field & column_name, const Context & context) override;
+    void deleteRowsWhere(const ASTPtr & predicate, const Context & context) override;
     void attachPartition(const ASTPtr & partition, bool part, const Context & context) override;
     void freezePartition(const ASTPtr & partition, const String & with_name, const Context & context) override;
 
+    /// Fast path for INSERT SELECT between tables with identical structure (see InterpreterInsertQuery):
+    /// adopts all active parts of the source table by copying them at the file level,
+    /// bypassing the block pipeline entirely.
+    void clonePartsFrom(StorageMergeTree & source);
+
     void drop() override;
 
     void rename(const String & new_path_to_db, const String & new_database_name, const String & new_table_name) override;
@@ -94,6 +108,7 @@ private:
     MergeTreeDataSelectExecutor reader;
     MergeTreeDataWriter writer;
     MergeTreeDataMerger merger;
+    MergeTreePartScrubber scrubber;
 
     /// For block numbers.
     SimpleIncrement increment{0};
@@ -109,6 +124,7 @@ private:
     std::atomic<bool> shutdown_called {false};
 
     BackgroundProcessingPool::TaskHandle merge_task_handle;
+    BackgroundProcessingPool::TaskHandle scrub_task_handle;
 
     friend struct CurrentlyMergingPartsTagger;
 
@@ -135,6 +151,8 @@ private:
         const String & date_column_name,
         const ASTPtr & partition_expr_ast_,
         const ASTPtr & sampling_expression_, /// nullptr, if sampling is not supported.
+        const ASTPtr & ttl_expression_, /// nullptr, if rows do not expire.
+        const ASTPtr & projection_query_, /// nullptr, if the table has no projection.
         size_t index_granularity_,
         const MergeTreeData::MergingParams & merging_params_,
         bool has_force_restore_data_flag,
@@ -147,6 +165,14 @@ private:
     bool merge(size_t aio_threshold, bool aggressive, const String & partition_id, bool final, bool deduplicate);
 
     bool mergeTask();
+
+    /** If the query is an aggregation matching the table's projection and every part has projection data,
+      *  returns streams of mergeable aggregation states read from the projections
+      *  and sets processed_stage accordingly. Otherwise returns an empty list.
+      */
+    BlockInputStreams readFromProjection(
+        const SelectQueryInfo & query_info,
+        QueryProcessingStage::Enum & processed_stage);
 };
 
 }
@@ -8,6 +8,7 @@
 #include <Storages/MergeTree/ReplicatedMergeTreeBlockOutputStream.h>
 #include <Storages/MergeTree/ReplicatedMergeTreeQuorumEntry.h>
 #include <Storages/MergeTree/MergeList.h>
+#include <Storages/MergeTree/MergeScheduler.h>
 #include <Storages/MergeTree/ReplicatedMergeTreeAddress.h>
 #include <Storages/MergeTree/ReshardingWorker.h>
 
@@ -199,11 +200,13 @@ StorageReplicatedMergeTree::StorageReplicatedMergeTree(
         full_path, columns_,
         materialized_columns_, alias_columns_, column_defaults_,
         context_, primary_expr_ast_, date_column_name, partition_expr_ast_,
-        sampling_expression_, index_granularity_, merging_params_,
+        sampling_expression_, nullptr /* ttl_expression */, nullptr /* projection_query */, index_granularity_, merging_params_,
         settings_, database_name_ + "." + table_name, true, attach,
         [this] (const std::string & name) { enqueuePartForCheck(name); },
         [this] () { clearOldPartsAndRemoveFromZK(); }),
-    reader(data), writer(data), merger(data, context.getBackgroundPool()), queue(data.format_version),
+    reader(data), writer(data), merger(data, context.getBackgroundPool()),
+    scrubber(data, [this] (const MergeTreeData::DataPartPtr & part) { enqueuePartForCheck(part->name); }),
+    queue(data.format_version),
     fetcher(data), sharded_partition_uploader_client(*this),
     shutdown_event(false), part_check_thread(*this),
     log(&Logger::get(database_name + "." + table_name + " (StorageReplicatedMergeTree)"))
@@ -1838,6 +1841,10 @@ void StorageReplicatedMergeTree::mergeSelectingThread()
                     << ") is greater than max_replicated_merges_in_queue ("
                     << data.settings.max_replicated_merges_in_queue << "), so won't select new parts to merge.");
             }
+            else if (!context.getMergeScheduler().canStartMerge())
+            {
+                /// The I/O budget is spent on foreground queries; don't queue new merges for now.
+            }
             else
             {
                 MergeTreeDataMerger::FuturePart future_merged_part;
@@ -2266,6 +2273,9 @@ void StorageReplicatedMergeTree::startup()
 
     /// In this thread replica will be activated.
     restarting_thread = std::make_unique<ReplicatedMergeTreeRestartingThread>(*this);
+
+    if (data.settings.background_scrub_bytes_per_second)
+        scrub_task_handle = context.getBackgroundPool().addTask([this] { return scrubber.run(); });
 }
 
 
@@ -2277,6 +2287,13 @@ void StorageReplicatedMergeTree::shutdown()
       */
     fetcher.cancel();
 
+    scrubber.cancel();
+    if (scrub_task_handle)
+    {
+        context.getBackgroundPool().removeTask(scrub_task_handle);
+        scrub_task_handle = nullptr;
+    }
+
     if (restarting_thread)
     {
         restarting_thread->stop();
@@ -2387,6 +2404,28 @@ BlockInputStreams StorageReplicatedMergeTree::read(
 }
 
 
+std::experimental::optional<UInt64> StorageReplicatedMergeTree::totalRowsByMetadata(const SelectQueryInfo & query_info, const Context & context) const
+{
+    /// Under sequential consistency the set of parts to read is restricted (see read()),
+    ///  so the metadata of all local parts cannot be trusted.
+    if (context.getSettingsRef().select_sequential_consistency)
+        return {};
+
+    return reader.countRowsByMetadata(query_info, context);
+}
+
+
+std::experimental::optional<Field> StorageReplicatedMergeTree::extremeOfColumnByMetadata(
+    bool is_min, const String & column_name, const SelectQueryInfo & query_info, const Context & context) const
+{
+    /// See totalRowsByMetadata.
+    if (context.getSettingsRef().select_sequential_consistency)
+        return {};
+
+    return reader.extremeOfColumnByMetadata(is_min, column_name, query_info, context);
+}
+
+
 void StorageReplicatedMergeTree::assertNotReadonly() const
 {
     if (is_readonly)
@@ -2399,7 +2438,8 @@ BlockOutputStreamPtr StorageReplicatedMergeTree::write(const ASTPtr & query, con
     assertNotReadonly();
 
     return std::make_shared<ReplicatedMergeTreeBlockOutputStream>(*this,
-        settings.insert_quorum, settings.insert_quorum_timeout.totalMilliseconds());
+        settings.insert_quorum, settings.insert_quorum_timeout.totalMilliseconds(),
+        settings.insert_sorted_by_primary_key);
 }
 
 
@@ -2438,7 +2478,7 @@ bool StorageReplicatedMergeTree::optimize(const ASTPtr & query, const ASTPtr & p
         else
         {
             String partition_id = data.getPartitionIDFromQuery(partition, context);
-            selected = merger.selectAllPartsToMergeWithinPartition(future_merged_part, disk_space, can_merge, partition_id, final);
+            selected = merger.selectAllPartsToMergeWithinPartition(future_merged_part, disk_space, can_merge, partition_id, final, deduplicate);
         }
 
         if (!selected)
@@ -3841,6 +3881,33 @@ bool StorageReplicatedMergeTree::checkSpaceForResharding(const ReplicaToSpaceInf
 }
 
 
+bool StorageReplicatedMergeTree::isRecentInsertBlock(const String & block_id)
+{
+    std::lock_guard<std::mutex> lock(recent_insert_blocks_mutex);
+    return recent_insert_blocks.count(block_id);
+}
+
+
+void StorageReplicatedMergeTree::rememberInsertBlock(const String & block_id)
+{
+    size_t cache_size = data.settings.replicated_dedup_cache_size;
+    if (!cache_size)
+        return;
+
+    std::lock_guard<std::mutex> lock(recent_insert_blocks_mutex);
+
+    if (!recent_insert_blocks.insert(block_id).second)
+        return;
+    recent_insert_blocks_queue.push_back(block_id);
+
+    while (recent_insert_blocks_queue.size() > cache_size)
+    {
+        recent_insert_blocks.erase(recent_insert_blocks_queue.front());
+        recent_insert_blocks_queue.pop_front();
+    }
+}
+
+
 void StorageReplicatedMergeTree::clearOldPartsAndRemoveFromZK(Logger * log_)
 {
     /// Critical section is not required (since grabOldParts() returns unique part set on each call)
@@ -2,10 +2,12 @@
 
 #include <ext/shared_ptr_helper.h>
 #include <atomic>
+#include <deque>
 #include <pcg_random.hpp>
 #include <Storages/IStorage.h>
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <Storages/MergeTree/MergeTreeDataMerger.h>
+#include <Storages/MergeTree/MergeTreePartScrubber.h>
 #include <Storages/MergeTree/MergeTreeDataWriter.h>
 #include <Storages/MergeTree/MergeTreeDataSelectExecutor.h>
 #include <Storages/MergeTree/ReplicatedMergeTreeLogEntry.h>
@@ -132,6 +134,11 @@ public:
         size_t max_block_size,
         unsigned num_streams) override;
 
+    std::experimental::optional<UInt64> totalRowsByMetadata(const SelectQueryInfo & query_info, const Context & context) const override;
+
+    std::experimental::optional<Field> extremeOfColumnByMetadata(
+        bool is_min, const String & column_name, const SelectQueryInfo & query_info, const Context & context) const override;
+
     BlockOutputStreamPtr write(const ASTPtr & query, const Settings & settings) override;
 
     bool optimize(const ASTPtr & query, const ASTPtr & partition, bool final, bool deduplicate, const Context & context) override;
@@ -208,6 +215,15 @@ private:
     /// Delete old chunks from disk and from ZooKeeper.
     void clearOldPartsAndRemoveFromZK(Logger * log_ = nullptr);
 
+    /// Returns true if a block with this ID was committed by this replica recently
+    /// (see the replicated_dedup_cache_size setting). Such duplicates are rejected
+    /// without any ZooKeeper requests; others are still caught by the /blocks node
+    /// created within the commit transaction.
+    bool isRecentInsertBlock(const String & block_id);
+
+    /// Remember the ID of a committed (or detected as duplicate) insert block.
+    void rememberInsertBlock(const String & block_id);
+
     friend class ReplicatedMergeTreeBlockOutputStream;
     friend class ReplicatedMergeTreeRestartingThread;
     friend class ReplicatedMergeTreePartCheckThread;
@@ -268,6 +284,7 @@ private:
     MergeTreeDataSelectExecutor reader;
     MergeTreeDataWriter writer;
     MergeTreeDataMerger merger;
+    MergeTreePartScrubber scrubber;
 
     /** The queue of what needs to be done on this replica to catch up with everyone. It is taken from ZooKeeper (/replicas/me/queue/).
      * In ZK entries in chronological order. Here it is not necessary.
@@ -300,6 +317,7 @@ private:
 
     /// A task that performs actions from the queue.
     BackgroundProcessingPool::TaskHandle queue_task_handle;
+    BackgroundProcessingPool::TaskHandle scrub_task_handle;
 
     /// A thread that selects parts to merge.
     std::thread merge_selecting_thread;
@@ -318,6 +336,11 @@ private:
     /// A thread that checks the data of the parts, as well as the queue of the parts to be checked.
     ReplicatedMergeTreePartCheckThread part_check_thread;
 
+    /// IDs of recently committed insert blocks, in commit order (see isRecentInsertBlock).
+    std::mutex recent_insert_blocks_mutex;
+    std::deque<String> recent_insert_blocks_queue;
+    NameSet recent_insert_blocks;
+
     /// An event that awakens `alter` method from waiting for the completion of the ALTER query.
     zkutil::EventPtr alter_query_event = std::make_shared<Poco::Event>();
 
@@ -7,6 +7,8 @@
 #include <DataStreams/NativeBlockInputStream.h>
 #include <Common/escapeForFileName.h>
 #include <Common/StringUtils.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
+#include <common/ThreadPool.h>
 #include <Interpreters/Set.h>
 #include <Poco/DirectoryIterator.h>
 
@@ -117,6 +119,8 @@ void StorageSetOrJoinBase::restore()
     static const auto file_suffix = ".bin";
     static const auto file_suffix_size = strlen(".bin");
 
+    Strings backup_files;
+
     Poco::DirectoryIterator dir_end;
     for (Poco::DirectoryIterator dir_it(path); dir_end != dir_it; ++dir_it)
     {
@@ -131,9 +135,33 @@ void StorageSetOrJoinBase::restore()
             if (file_num > increment)
                 increment = file_num;
 
-            restoreFromFile(dir_it->path());
+            backup_files.push_back(dir_it->path());
         }
     }
+
+    if (backup_files.empty())
+        return;
+
+    /** Restore the backup files in parallel: reading, decompression and deserialization of different
+      *  files become concurrent, while the insertion itself is protected by the lock inside the Set
+      *  or Join. A sharded Join also builds its shards in parallel (see the join_build_threads setting),
+      *  so for it the insertion is concurrent too.
+      */
+    size_t num_threads = std::min(backup_files.size(), static_cast<size_t>(getNumberOfPhysicalCPUCores()));
+
+    if (num_threads <= 1)
+    {
+        for (const auto & file : backup_files)
+            restoreFromFile(file);
+        return;
+    }
+
+    ThreadPool pool(num_threads);
+
+    for (const auto & file : backup_files)
+        pool.schedule([this, file] { restoreFromFile(file); });
+
+    pool.wait();
 }
 
 
@@ -23,8 +23,15 @@
 
 #include <Columns/ColumnArray.h>
 
+#include <DataTypes/DataTypeFactory.h>
+
+#include <Parsers/ASTExpressionList.h>
+#include <Parsers/ASTIdentifier.h>
+
 #include <Interpreters/Context.h>
+#include <Interpreters/ExpressionAnalyzer.h>
 
+#include <Storages/MergeTree/PKCondition.h>
 #include <Storages/StorageStripeLog.h>
 
 
@@ -40,6 +47,91 @@ namespace ErrorCodes
 }
 
 
+/** Sidecar file "minmax.idx" with per-block min/max values of the columns ("crude" index).
+  * One entry is appended for every block of "index.mrk"; if the counts diverge
+  *  (e.g. the file appeared in the middle of the table's life), pruning is skipped.
+  */
+struct MinMaxOfOneColumn
+{
+    String name;
+    String type;
+    bool has_minmax = false;    /// Statistics are collected only for non-nullable numeric columns.
+    Field min;
+    Field max;
+};
+
+using MinMaxOfBlock = std::vector<MinMaxOfOneColumn>;
+
+
+static void writeBlockMinMax(const Block & block, WriteBuffer & out)
+{
+    size_t num_columns = block.columns();
+    writeVarUInt(num_columns, out);
+
+    for (size_t i = 0; i < num_columns; ++i)
+    {
+        const ColumnWithTypeAndName & column = block.safeGetByPosition(i);
+
+        writeStringBinary(column.name, out);
+        writeStringBinary(column.type->getName(), out);
+
+        Field min_value;
+        Field max_value;
+        bool has_minmax = column.type->isNumeric() && !column.type->isNullable() && !column.column->empty();
+
+        if (has_minmax)
+        {
+            column.column->getExtremes(min_value, max_value);
+            has_minmax = !min_value.isNull() && !max_value.isNull();
+        }
+
+        writeBinary(UInt8(has_minmax), out);
+
+        if (has_minmax)
+        {
+            column.type->serializeBinary(min_value, out);
+            column.type->serializeBinary(max_value, out);
+        }
+    }
+}
+
+
+static std::vector<MinMaxOfBlock> readBlocksMinMax(ReadBuffer & in)
+{
+    std::vector<MinMaxOfBlock> res;
+
+    while (!in.eof())
+    {
+        size_t num_columns = 0;
+        readVarUInt(num_columns, in);
+
+        MinMaxOfBlock block_minmax(num_columns);
+        for (size_t i = 0; i < num_columns; ++i)
+        {
+            MinMaxOfOneColumn & column = block_minmax[i];
+
+            readStringBinary(column.name, in);
+            readStringBinary(column.type, in);
+
+            UInt8 has_minmax = 0;
+            readBinary(has_minmax, in);
+            column.has_minmax = has_minmax;
+
+            if (column.has_minmax)
+            {
+                DataTypePtr type = DataTypeFactory::instance().get(column.type);
+                type->deserializeBinary(column.min, in);
+                type->deserializeBinary(column.max, in);
+            }
+        }
+
+        res.push_back(std::move(block_minmax));
+    }
+
+    return res;
+}
+
+
 class StripeLogBlockInputStream final : public IProfilingBlockInputStream
 {
 public:
@@ -71,7 +163,7 @@ protected:
             started = true;
 
             data_in.emplace(
-                storage.full_path() + "data.bin", 0, 0,
+                storage.full_path() + "data.bin", 0, 0, 0,
                 std::min(static_cast<Poco::File::FileSize>(max_read_buffer_size), Poco::File(storage.full_path() + "data.bin").getSize()));
 
             block_in.emplace(*data_in, 0, true, index_begin, index_end);
@@ -120,6 +212,8 @@ public:
         data_out(data_out_compressed, CompressionMethod::LZ4, storage.max_compress_block_size),
         index_out_compressed(storage.full_path() + "index.mrk", INDEX_BUFFER_SIZE, O_WRONLY | O_APPEND | O_CREAT),
         index_out(index_out_compressed),
+        minmax_out_compressed(storage.full_path() + "minmax.idx", INDEX_BUFFER_SIZE, O_WRONLY | O_APPEND | O_CREAT),
+        minmax_out(minmax_out_compressed),
         block_out(data_out, 0, &index_out, Poco::File(storage.full_path() + "data.bin").getSize())
     {
     }
@@ -139,6 +233,7 @@ public:
     void write(const Block & block) override
     {
         block_out.write(block);
+        writeBlockMinMax(block, minmax_out);
     }
 
     void writeSuffix() override
@@ -151,8 +246,11 @@ public:
         data_out_compressed.next();
         index_out.next();
         index_out_compressed.next();
+        minmax_out.next();
+        minmax_out_compressed.next();
 
-        FileChecker::Files files{ data_out_compressed.getFileName(), index_out_compressed.getFileName() };
+        FileChecker::Files files{ data_out_compressed.getFileName(), index_out_compressed.getFileName(),
+            minmax_out_compressed.getFileName() };
         storage.file_checker.update(files.begin(), files.end());
 
         done = true;
@@ -166,6 +264,8 @@ private:
     CompressedWriteBuffer data_out;
     WriteBufferFromFile index_out_compressed;
     CompressedWriteBuffer index_out;
+    WriteBufferFromFile minmax_out_compressed;
+    CompressedWriteBuffer minmax_out;
     NativeBlockOutputStream block_out;
 
     bool done = false;
@@ -213,6 +313,86 @@ void StorageStripeLog::rename(const String & new_path_to_db, const String & new_
 }
 
 
+std::shared_ptr<const IndexForNativeFormat> StorageStripeLog::pruneBlocksByMinMax(
+    const std::shared_ptr<const IndexForNativeFormat> & index,
+    const SelectQueryInfo & query_info,
+    const Context & context)
+{
+    std::vector<MinMaxOfBlock> blocks_minmax;
+
+    try
+    {
+        CompressedReadBufferFromFile minmax_in(full_path() + "minmax.idx", 0, 0, 0, INDEX_BUFFER_SIZE);
+        blocks_minmax = readBlocksMinMax(minmax_in);
+    }
+    catch (...)
+    {
+        /// A damaged sidecar must not fail the read - the data itself is intact.
+        tryLogCurrentException(log, "Cannot read the min/max index of table " + name + ", no blocks will be skipped");
+        return index;
+    }
+
+    /// The sidecar may have appeared in the middle of the table's life - then it does not
+    ///  describe the older blocks and cannot be matched against the index.
+    if (blocks_minmax.size() != index->blocks.size())
+        return index;
+
+    /// The condition is built over the columns the first block has statistics for.
+    Names minmax_names;
+    DataTypes minmax_types;
+    for (const auto & column : blocks_minmax.front())
+        if (column.has_minmax)
+        {
+            minmax_names.push_back(column.name);
+            minmax_types.push_back(DataTypeFactory::instance().get(column.type));
+        }
+
+    if (minmax_names.empty())
+        return index;
+
+    ASTPtr expression_list = std::make_shared<ASTExpressionList>();
+    SortDescription sort_descr;
+    for (const auto & column_name : minmax_names)
+    {
+        expression_list->children.push_back(std::make_shared<ASTIdentifier>(StringRange(), column_name));
+        sort_descr.emplace_back(column_name, 1, 1);
+    }
+
+    ExpressionActionsPtr expr = ExpressionAnalyzer(expression_list, context, nullptr, getColumnsList()).getActions(false);
+    PKCondition condition(query_info, context, getColumnsList(), sort_descr, expr);
+
+    if (condition.alwaysUnknownOrTrue())
+        return index;
+
+    auto pruned = std::make_shared<IndexForNativeFormat>();
+
+    for (size_t i = 0; i < index->blocks.size(); ++i)
+    {
+        std::vector<Field> min_values;
+        std::vector<Field> max_values;
+
+        for (const auto & column_name : minmax_names)
+            for (const auto & column : blocks_minmax[i])
+                if (column.has_minmax && column.name == column_name)
+                {
+                    min_values.push_back(column.min);
+                    max_values.push_back(column.max);
+                    break;
+                }
+
+        /// A block without the statistics for some of the columns is never skipped.
+        if (min_values.size() != minmax_names.size()
+            || condition.mayBeTrueInRange(minmax_names.size(), &min_values[0], &max_values[0], minmax_types))
+            pruned->blocks.push_back(index->blocks[i]);
+    }
+
+    LOG_DEBUG(log, "MinMax index has pruned " << (index->blocks.size() - pruned->blocks.size())
+        << " of " << index->blocks.size() << " blocks");
+
+    return pruned;
+}
+
+
 BlockInputStreams StorageStripeLog::read(
     const Names & column_names,
     const SelectQueryInfo & query_info,
@@ -231,9 +411,13 @@ BlockInputStreams StorageStripeLog::read(
     if (!Poco::File(full_path() + "index.mrk").exists())
         return { std::make_shared<NullBlockInputStream>() };
 
-    CompressedReadBufferFromFile index_in(full_path() + "index.mrk", 0, 0, INDEX_BUFFER_SIZE);
+    CompressedReadBufferFromFile index_in(full_path() + "index.mrk", 0, 0, 0, INDEX_BUFFER_SIZE);
     std::shared_ptr<const IndexForNativeFormat> index{std::make_shared<IndexForNativeFormat>(index_in, column_names_set)};
 
+    /// Skip the blocks the query condition rules out by the per-block min/max values, if they are available.
+    if (!index->blocks.empty() && Poco::File(full_path() + "minmax.idx").exists())
+        index = pruneBlocksByMinMax(index, query_info, context);
+
     BlockInputStreams res;
 
     size_t size = index->blocks.size();
@@ -16,6 +16,9 @@
 namespace DB
 {
 
+struct IndexForNativeFormat;
+
+
 /** Implements a table engine that is suitable for small chunks of the log.
   * In doing so, stores all the columns in a single Native file, with a nearby index.
   */
@@ -75,6 +78,13 @@ private:
         const ColumnDefaults & column_defaults_,
         bool attach,
         size_t max_compress_block_size_ = DEFAULT_MAX_COMPRESS_BLOCK_SIZE);
+
+    /// Return a copy of the index without the blocks the query condition rules out
+    ///  by the per-block min/max values from the "minmax.idx" sidecar file.
+    std::shared_ptr<const IndexForNativeFormat> pruneBlocksByMinMax(
+        const std::shared_ptr<const IndexForNativeFormat> & index,
+        const SelectQueryInfo & query_info,
+        const Context & context);
 };
 
 }
@@ -88,6 +88,9 @@ private:
     using FileStreams = std::map<std::string, std::unique_ptr<Stream>>;
     FileStreams streams;
 
+    /// Used to reduce the number of reallocations when creating columns of variable size.
+    std::map<std::string, double> avg_value_size_hints;
+
     void addStream(const String & name, const IDataType & type, size_t level = 0);
     void readData(const String & name, const IDataType & type, IColumn & column, size_t limit, size_t level = 0, bool read_offsets = true);
 };
@@ -333,7 +336,11 @@ void TinyLogBlockInputStream::readData(const String & name, const IDataType & ty
         }
     }
     else
-        type.deserializeBinaryBulk(column, streams[name]->compressed, limit, 0);    /// TODO Use avg_value_size_hint.
+    {
+        double & avg_value_size_hint = avg_value_size_hints[name];
+        type.deserializeBinaryBulk(column, streams[name]->compressed, limit, avg_value_size_hint);
+        IDataType::updateAvgValueSizeHint(column, avg_value_size_hint);
+    }
 }
 
 
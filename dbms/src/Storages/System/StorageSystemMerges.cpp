@@ -26,10 +26,18 @@ StorageSystemMerges::StorageSystemMerges(const std::string & name)
         { "bytes_read_uncompressed",        std::make_shared<DataTypeUInt64>() },
         { "rows_read",                        std::make_shared<DataTypeUInt64>() },
         { "bytes_written_uncompressed",     std::make_shared<DataTypeUInt64>() },
+        { "bytes_written_compressed",        std::make_shared<DataTypeUInt64>() },
         { "rows_written",                    std::make_shared<DataTypeUInt64>() },
         { "columns_written",                std::make_shared<DataTypeUInt64>() },
         { "memory_usage",                    std::make_shared<DataTypeUInt64>() },
         { "thread_number",                    std::make_shared<DataTypeUInt64>() },
+        { "rows_per_second",                std::make_shared<DataTypeFloat64>() },
+        { "read_bytes_per_second",            std::make_shared<DataTypeFloat64>() },
+        { "write_bytes_per_second",         std::make_shared<DataTypeFloat64>() },
+        { "read_time_seconds",                std::make_shared<DataTypeFloat64>() },
+        { "sort_time_seconds",                std::make_shared<DataTypeFloat64>() },
+        { "write_time_seconds",             std::make_shared<DataTypeFloat64>() },
+        { "queue_wait_time_seconds",        std::make_shared<DataTypeFloat64>() },
     }
 {
 }
@@ -63,10 +71,18 @@ BlockInputStreams StorageSystemMerges::read(
         block.getByPosition(i++).column->insert(merge.bytes_read_uncompressed);
         block.getByPosition(i++).column->insert(merge.rows_read);
         block.getByPosition(i++).column->insert(merge.bytes_written_uncompressed);
+        block.getByPosition(i++).column->insert(merge.bytes_written_compressed);
         block.getByPosition(i++).column->insert(merge.rows_written);
         block.getByPosition(i++).column->insert(merge.columns_written);
         block.getByPosition(i++).column->insert(merge.memory_usage);
         block.getByPosition(i++).column->insert(merge.thread_number);
+        block.getByPosition(i++).column->insert(merge.rows_per_second);
+        block.getByPosition(i++).column->insert(merge.read_bytes_per_second);
+        block.getByPosition(i++).column->insert(merge.write_bytes_per_second);
+        block.getByPosition(i++).column->insert(merge.read_time_seconds);
+        block.getByPosition(i++).column->insert(merge.sort_time_seconds);
+        block.getByPosition(i++).column->insert(merge.write_time_seconds);
+        block.getByPosition(i++).column->insert(merge.queue_wait_time_seconds);
     }
 
     return BlockInputStreams{1, std::make_shared<OneBlockInputStream>(block)};
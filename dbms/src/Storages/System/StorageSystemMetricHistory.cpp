@@ -0,0 +1,95 @@
+#include <Storages/System/StorageSystemMetricHistory.h>
+
+#include <Interpreters/MetricsHistory.h>
+#include <Columns/ColumnsNumber.h>
+#include <Columns/ColumnString.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <DataTypes/DataTypeDateTime.h>
+#include <DataStreams/OneBlockInputStream.h>
+
+
+namespace DB
+{
+
+
+StorageSystemMetricHistory::StorageSystemMetricHistory(const std::string & name_, const MetricsHistory & metrics_history_)
+    : name(name_),
+    columns
+    {
+        {"event_time", std::make_shared<DataTypeDateTime>()},
+        {"milliseconds", std::make_shared<DataTypeUInt64>()},
+        {"metric", std::make_shared<DataTypeString>()},
+        {"value", std::make_shared<DataTypeFloat64>()},
+    },
+    metrics_history(metrics_history_)
+{
+}
+
+
+BlockInputStreams StorageSystemMetricHistory::read(
+    const Names & column_names,
+    const SelectQueryInfo & query_info,
+    const Context & context,
+    QueryProcessingStage::Enum & processed_stage,
+    const size_t max_block_size,
+    const unsigned num_streams)
+{
+    check(column_names);
+    processed_stage = QueryProcessingStage::FetchColumns;
+
+    Block block;
+
+    ColumnWithTypeAndName col_event_time;
+    col_event_time.name = "event_time";
+    col_event_time.type = std::make_shared<DataTypeDateTime>();
+    col_event_time.column = std::make_shared<ColumnUInt32>();
+    block.insert(col_event_time);
+
+    ColumnWithTypeAndName col_milliseconds;
+    col_milliseconds.name = "milliseconds";
+    col_milliseconds.type = std::make_shared<DataTypeUInt64>();
+    col_milliseconds.column = std::make_shared<ColumnUInt64>();
+    block.insert(col_milliseconds);
+
+    ColumnWithTypeAndName col_metric;
+    col_metric.name = "metric";
+    col_metric.type = std::make_shared<DataTypeString>();
+    col_metric.column = std::make_shared<ColumnString>();
+    block.insert(col_metric);
+
+    ColumnWithTypeAndName col_value;
+    col_value.name = "value";
+    col_value.type = std::make_shared<DataTypeFloat64>();
+    col_value.column = std::make_shared<ColumnFloat64>();
+    block.insert(col_value);
+
+    MetricsHistory::Snapshots snapshots = metrics_history.getHistory();
+
+    auto add_row = [&](const MetricsHistory::Snapshot & snapshot, const std::string & metric, Float64 value)
+    {
+        col_event_time.column->insert(UInt64(snapshot.event_time));
+        col_milliseconds.column->insert(snapshot.milliseconds);
+        col_metric.column->insert(metric);
+        col_value.column->insert(value);
+    };
+
+    for (const auto & snapshot : snapshots)
+    {
+        for (size_t i = 0, end = snapshot.profile_event_increments.size(); i < end; ++i)
+            add_row(snapshot, std::string("ProfileEvents.") + ProfileEvents::getDescription(static_cast<ProfileEvents::Event>(i)),
+                snapshot.profile_event_increments[i]);
+
+        for (size_t i = 0, end = snapshot.current_metrics.size(); i < end; ++i)
+            add_row(snapshot, std::string("CurrentMetrics.") + CurrentMetrics::getDescription(static_cast<CurrentMetrics::Metric>(i)),
+                snapshot.current_metrics[i]);
+
+        for (const auto & name_value : snapshot.asynchronous_metrics)
+            add_row(snapshot, "AsynchronousMetrics." + name_value.first, name_value.second);
+    }
+
+    return BlockInputStreams(1, std::make_shared<OneBlockInputStream>(block));
+}
+
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <ext/shared_ptr_helper.h>
+#include <Storages/IStorage.h>
+
+
+namespace DB
+{
+
+class MetricsHistory;
+class Context;
+
+
+/** Implements system table metric_history: the ring buffer of recent ProfileEvents increments,
+  *  CurrentMetrics and AsynchronousMetrics snapshots (see MetricsHistory).
+  */
+class StorageSystemMetricHistory : public ext::shared_ptr_helper<StorageSystemMetricHistory>, public IStorage
+{
+friend class ext::shared_ptr_helper<StorageSystemMetricHistory>;
+
+public:
+    std::string getName() const override { return "SystemMetricHistory"; }
+    std::string getTableName() const override { return name; }
+
+    const NamesAndTypesList & getColumnsListImpl() const override { return columns; }
+
+    BlockInputStreams read(
+        const Names & column_names,
+        const SelectQueryInfo & query_info,
+        const Context & context,
+        QueryProcessingStage::Enum & processed_stage,
+        size_t max_block_size,
+        unsigned num_streams) override;
+
+private:
+    const std::string name;
+    NamesAndTypesList columns;
+    const MetricsHistory & metrics_history;
+
+    StorageSystemMetricHistory(const std::string & name_, const MetricsHistory & metrics_history_);
+};
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ext/shared_ptr_helper.h>
+#include <Storages/IStorage.h>
+
+
+namespace DB
+{
+
+class Context;
+
+
+/** Implements system table 'parts_columns' which allows to get information
+  *  about the columns inside data parts for tables of MergeTree family:
+  *  per-column compressed/uncompressed/marks sizes from the part checksums
+  *  and the cumulative number of bytes read from each column.
+  */
+class StorageSystemPartsColumns : public ext::shared_ptr_helper<StorageSystemPartsColumns>, public IStorage
+{
+friend class ext::shared_ptr_helper<StorageSystemPartsColumns>;
+public:
+    std::string getName() const override { return "SystemPartsColumns"; }
+    std::string getTableName() const override { return name; }
+
+    const NamesAndTypesList & getColumnsListImpl() const override { return columns; }
+
+    BlockInputStreams read(
+        const Names & column_names,
+        const SelectQueryInfo & query_info,
+        const Context & context,
+        QueryProcessingStage::Enum & processed_stage,
+        size_t max_block_size,
+        unsigned num_streams) override;
+
+private:
+    const std::string name;
+    NamesAndTypesList columns;
+
+    StorageSystemPartsColumns(const std::string & name_);
+};
+
+}
@@ -47,6 +47,13 @@ StorageSystemProcesses::StorageSystemProcesses(const std::string & name_)
         { "written_rows",        std::make_shared<DataTypeUInt64>()    },
         { "written_bytes",        std::make_shared<DataTypeUInt64>()    },
         { "memory_usage",        std::make_shared<DataTypeInt64>()    },
+
+        { "cycles",                std::make_shared<DataTypeUInt64>()    },
+        { "instructions",        std::make_shared<DataTypeUInt64>()    },
+        { "cache_misses",        std::make_shared<DataTypeUInt64>()    },
+        { "branch_misses",        std::make_shared<DataTypeUInt64>()    },
+        { "page_faults",        std::make_shared<DataTypeUInt64>()    },
+
         { "query",                 std::make_shared<DataTypeString>()    }
     }
 {
@@ -97,6 +104,11 @@ BlockInputStreams StorageSystemProcesses::read(
         block.getByPosition(i++).column->insert(UInt64(process.written_rows));
         block.getByPosition(i++).column->insert(UInt64(process.written_bytes));
         block.getByPosition(i++).column->insert(process.memory_usage);
+        block.getByPosition(i++).column->insert(process.hardware_counters.values[HardwareCounters::CYCLES]);
+        block.getByPosition(i++).column->insert(process.hardware_counters.values[HardwareCounters::INSTRUCTIONS]);
+        block.getByPosition(i++).column->insert(process.hardware_counters.values[HardwareCounters::CACHE_MISSES]);
+        block.getByPosition(i++).column->insert(process.hardware_counters.values[HardwareCounters::BRANCH_MISSES]);
+        block.getByPosition(i++).column->insert(process.hardware_counters.values[HardwareCounters::PAGE_FAULTS]);
         block.getByPosition(i++).column->insert(process.query);
     }
 
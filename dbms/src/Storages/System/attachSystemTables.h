@@ -8,10 +8,11 @@ namespace DB
 
 class Context;
 class AsynchronousMetrics;
+class MetricsHistory;
 class IDatabase;
 
 void attachSystemTablesServer(IDatabase & system_database, bool has_zookeeper);
 void attachSystemTablesLocal(IDatabase & system_database);
-void attachSystemTablesAsync(IDatabase & system_database, AsynchronousMetrics & async_metrics);
+void attachSystemTablesAsync(IDatabase & system_database, AsynchronousMetrics & async_metrics, MetricsHistory & metrics_history);
 
 }
@@ -0,0 +1,77 @@
+#include <TableFunctions/ITableFunction.h>
+#include <TableFunctions/TableFunctionGenerateRandom.h>
+#include <TableFunctions/TableFunctionFactory.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTLiteral.h>
+#include <Parsers/ASTNameTypePair.h>
+#include <Parsers/ParserCreateQuery.h>
+#include <Parsers/parseQuery.h>
+#include <Common/Exception.h>
+#include <Common/typeid_cast.h>
+#include <DataTypes/DataTypeFactory.h>
+#include <Storages/StorageGenerateRandom.h>
+#include <Interpreters/evaluateConstantExpression.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int NUMBER_OF_ARGUMENTS_DOESNT_MATCH;
+}
+
+
+StoragePtr TableFunctionGenerateRandom::execute(const ASTPtr & ast_function, const Context & context) const
+{
+    ASTs & args_func = typeid_cast<ASTFunction &>(*ast_function).children;
+
+    const char * err = "Table function 'generateRandom' requires from 1 to 4 arguments: "
+        "structure, [max_string_length, [max_distinct, [random_seed]]].";
+
+    if (args_func.size() != 1)
+        throw Exception(err, ErrorCodes::NUMBER_OF_ARGUMENTS_DOESNT_MATCH);
+
+    ASTs & args = typeid_cast<ASTExpressionList &>(*args_func.at(0)).children;
+
+    if (args.empty() || args.size() > 4)
+        throw Exception(err, ErrorCodes::NUMBER_OF_ARGUMENTS_DOESNT_MATCH);
+
+    for (auto & arg : args)
+        arg = evaluateConstantExpressionOrIdentifierAsLiteral(arg, context);
+
+    String structure = static_cast<const ASTLiteral &>(*args[0]).value.safeGet<String>();
+
+    UInt64 max_string_length = 10;
+    UInt64 max_distinct = 0;
+    UInt64 random_seed = 0;
+
+    if (args.size() >= 2)
+        max_string_length = static_cast<const ASTLiteral &>(*args[1]).value.safeGet<UInt64>();
+    if (args.size() >= 3)
+        max_distinct = static_cast<const ASTLiteral &>(*args[2]).value.safeGet<UInt64>();
+    if (args.size() >= 4)
+        random_seed = static_cast<const ASTLiteral &>(*args[3]).value.safeGet<UInt64>();
+
+    ParserNameTypePairList columns_parser;
+    ASTPtr columns_ast = parseQuery(columns_parser, structure.data(), structure.data() + structure.size(), "columns structure");
+
+    NamesAndTypesList columns;
+    for (const auto & child : columns_ast->children)
+    {
+        const auto & name_type = typeid_cast<const ASTNameTypePair &>(*child);
+        columns.emplace_back(name_type.name, DataTypeFactory::instance().get(name_type.type));
+    }
+
+    auto res = StorageGenerateRandom::create(getName(), columns, max_string_length, max_distinct, random_seed);
+    res->startup();
+    return res;
+}
+
+
+void registerTableFunctionGenerateRandom(TableFunctionFactory & factory)
+{
+    TableFunctionFactory::instance().registerFunction<TableFunctionGenerateRandom>();
+}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <TableFunctions/ITableFunction.h>
+
+
+namespace DB
+{
+
+/* generateRandom('name1 Type1, name2 Type2, ...'[, max_string_length[, max_distinct[, random_seed]]])
+ * - an unlimited source of random data of the given structure, generated in parallel streams.
+ * Used to benchmark insertion and query processing at production-like data shape
+ *  without copying production data. Cut the stream with LIMIT.
+ */
+class TableFunctionGenerateRandom : public ITableFunction
+{
+public:
+    static constexpr auto name = "generateRandom";
+    std::string getName() const override { return name; }
+    StoragePtr execute(const ASTPtr & ast_function, const Context & context) const override;
+};
+
+}
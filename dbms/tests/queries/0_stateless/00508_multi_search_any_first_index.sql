@@ -0,0 +1,14 @@
+SELECT multiSearchAny('hello world', ['expletive', 'world']);
+SELECT multiSearchAny('hello world', ['expletive', 'planet']);
+SELECT multiSearchAny('hello world', ['lo', 'xx']);
+SELECT multiSearchAny('hello world', ['']);
+SELECT multiSearchAny('', ['world']);
+SELECT multiSearchAnyCaseInsensitive('HELLO World', ['hello']);
+SELECT multiSearchAnyCaseInsensitive('HELLO World', ['warld']);
+SELECT multiSearchFirstIndex('hello world', ['world', 'hello']);
+SELECT multiSearchFirstIndex('hello world', ['planet', 'world']);
+SELECT multiSearchFirstIndex('hello world', ['planet', 'mars']);
+SELECT multiSearchFirstIndexCaseInsensitive('Hello World', ['WORLD', 'HELLO']);
+SELECT multiSearchFirstIndex(materialize('abc abcdef'), ['abcdef', 'abc']);
+SELECT multiSearchFirstIndex('xxefghabcdef', ['abcdef', 'efgh']);
+SELECT multiSearchAny(s, ['hello', 'house']) FROM (SELECT arrayJoin(['hello there', 'nothing', 'big house']) AS s);
@@ -0,0 +1,6 @@
+SELECT multiMatchAny('https://clickhouse.example.com/path', ['\\.example\\.com', 'nomatch']);
+SELECT multiMatchAny('hello world', ['^world', '^hello']);
+SELECT multiMatchAny('hello world', ['^world$', 'planet']);
+SELECT multiMatchAny('abc', ['a.c']);
+SELECT multiMatchAny('', ['x?']);
+SELECT multiMatchAny(s, ['^https', '\\.ru$']) FROM (SELECT arrayJoin(['https://example.com', 'http://yandex.ru', 'ftp://host']) AS s);
@@ -0,0 +1,13 @@
+SELECT isValidUTF8('hello');
+SELECT isValidUTF8('привет');
+SELECT isValidUTF8('');
+SELECT isValidUTF8(unhex('C3A9'));
+SELECT isValidUTF8(unhex('C3'));
+SELECT isValidUTF8(unhex('80'));
+SELECT isValidUTF8(unhex('C080'));
+SELECT isValidUTF8(unhex('E08080'));
+SELECT isValidUTF8(unhex('EDA080'));
+SELECT isValidUTF8(unhex('F0908080'));
+SELECT isValidUTF8(unhex('F4908080'));
+SELECT isValidUTF8(concat('aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa', unhex('FF')));
+SELECT isValidUTF8(toFixedString('abc', 3));
@@ -0,0 +1,11 @@
+SELECT arrayMap(x -> x * 2, arrayMap(x -> x + 1, [1, 2, 3]));
+SELECT arrayExists(x -> x > 5, arrayMap(x -> x * 3, [1, 2, 3]));
+SELECT arrayExists(y -> y = 4, arrayMap(x -> x * 2, [1, 2, 3]));
+SELECT arrayAll(x -> x % 2 = 0, arrayMap(x -> x * 2, [1, 2, 3]));
+SELECT arrayCount(x -> x >= 4, arrayMap(x -> x + 2, [1, 2, 3, 4]));
+SELECT arrayFirstIndex(x -> x = 6, arrayMap(x -> x * 2, [1, 2, 3, 4]));
+SELECT arraySum(x -> x * x, arrayMap(x -> x + 1, [1, 2, 3]));
+SELECT arrayFilter(x -> x > 2, arrayMap(x -> x + 1, [1, 2, 3]));
+SELECT arrayFirst(x -> x > 2, arrayMap(x -> x + 1, [1, 2, 3]));
+SELECT arrayMap(x -> x + 1, arrayMap(x -> x * 2, arrayMap(x -> x - 1, [1, 2, 3])));
+SELECT arrayMap(x -> x * 2, arrayMap(x -> x + 1, [number, number + 1])) FROM system.numbers LIMIT 3;
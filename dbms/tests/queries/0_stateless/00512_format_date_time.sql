@@ -0,0 +1,11 @@
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%F %T');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%Y-%m-%d %H:%M:%S');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%C %y %e %j');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%I %p');
+SELECT formatDateTime(toDateTime('2018-01-02 00:10:00'), '%I %p');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%R');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%u %w');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%D');
+SELECT formatDateTime(toDateTime('2018-01-02 22:33:44'), '%% of %Y');
+SELECT formatDateTime(toDate('2018-01-02'), '%F %T');
+SELECT formatDateTime(materialize(toDateTime('2018-01-02 22:33:44')), '%F') FROM system.numbers LIMIT 3;
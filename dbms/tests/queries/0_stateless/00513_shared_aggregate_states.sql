@@ -0,0 +1,7 @@
+SELECT sum(x), avg(x), count(x) FROM (SELECT number AS x FROM system.numbers LIMIT 10);
+SELECT avg(x) FROM (SELECT number AS x FROM system.numbers LIMIT 10);
+SELECT k, sum(x), avg(x) FROM (SELECT number % 2 AS k, number AS x FROM system.numbers LIMIT 10) GROUP BY k ORDER BY k;
+SELECT sumIf(x, x % 2 = 1), avgIf(x, x % 2 = 1) FROM (SELECT number AS x FROM system.numbers LIMIT 10);
+SELECT count(x), avg(x) FROM (SELECT nullIf(number, 9) AS x FROM system.numbers LIMIT 10);
+SELECT sum(x) FROM (SELECT number AS x FROM system.numbers LIMIT 10) HAVING avg(x) > 4;
+SELECT sum(x), avg(x) AS a FROM (SELECT number AS x FROM system.numbers LIMIT 10) ORDER BY a;
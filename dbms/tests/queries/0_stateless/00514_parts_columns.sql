@@ -0,0 +1,16 @@
+DROP TABLE IF EXISTS test.parts_columns;
+CREATE TABLE test.parts_columns (d Date, x UInt64, s String) ENGINE = MergeTree(d, x, 8192);
+INSERT INTO test.parts_columns VALUES ('2017-01-01', 1, 'hello');
+
+SELECT column, column_data_compressed_bytes > 0, column_data_uncompressed_bytes > 0, column_marks_bytes > 0
+    FROM system.parts_columns
+    WHERE database = 'test' AND table = 'parts_columns' AND active
+    ORDER BY column;
+
+SELECT x FROM test.parts_columns;
+
+SELECT column_read_bytes > 0
+    FROM system.parts_columns
+    WHERE database = 'test' AND table = 'parts_columns' AND active AND column = 'x';
+
+DROP TABLE test.parts_columns;
@@ -0,0 +1,23 @@
+DROP TABLE IF EXISTS test.delete_where;
+CREATE TABLE test.delete_where (d Date, k UInt64, s String) ENGINE = MergeTree(d, k, 8192);
+
+INSERT INTO test.delete_where SELECT toDate('2017-09-01'), number, toString(number) FROM system.numbers LIMIT 100;
+INSERT INTO test.delete_where SELECT toDate('2017-09-02'), number, toString(number) FROM system.numbers LIMIT 100;
+
+ALTER TABLE test.delete_where DELETE WHERE k % 10 = 3;
+
+SELECT count() FROM test.delete_where;
+SELECT count() FROM test.delete_where WHERE k % 10 = 3;
+SELECT sum(k) FROM test.delete_where WHERE d = '2017-09-01';
+
+/** Deleted rows must not reappear after the parts are merged. */
+OPTIMIZE TABLE test.delete_where;
+SELECT count() FROM test.delete_where;
+SELECT count() FROM test.delete_where WHERE k % 10 = 3;
+
+/** A second DELETE on top of an existing mask. */
+ALTER TABLE test.delete_where DELETE WHERE k < 5;
+SELECT count() FROM test.delete_where;
+SELECT min(k) FROM test.delete_where;
+
+DROP TABLE test.delete_where;
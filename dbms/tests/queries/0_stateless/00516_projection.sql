@@ -0,0 +1,17 @@
+DROP TABLE IF EXISTS test.projection;
+CREATE TABLE test.projection (d Date, site UInt32, hits UInt64) ENGINE = MergeTree(d, (d, site), 8192) PROJECTION SELECT d, site, sum(hits) GROUP BY d, site;
+
+INSERT INTO test.projection SELECT toDate('2017-09-01'), number % 3, number FROM system.numbers LIMIT 100;
+INSERT INTO test.projection SELECT toDate('2017-09-02'), number % 3, number FROM system.numbers LIMIT 100;
+
+-- Matches the projection: answered from the stored aggregation states.
+SELECT d, site, sum(hits) FROM test.projection GROUP BY d, site ORDER BY d, site;
+
+-- Does not match the projection: answered from the raw data.
+SELECT site, sum(hits) FROM test.projection GROUP BY site ORDER BY site;
+
+-- The merged part gets a recomputed projection.
+OPTIMIZE TABLE test.projection;
+SELECT d, site, sum(hits) FROM test.projection GROUP BY d, site ORDER BY d, site;
+
+DROP TABLE test.projection;
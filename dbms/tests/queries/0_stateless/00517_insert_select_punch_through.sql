@@ -0,0 +1,21 @@
+DROP TABLE IF EXISTS test.punch_src;
+DROP TABLE IF EXISTS test.punch_dst;
+
+CREATE TABLE test.punch_src (d Date, k UInt64, s String) ENGINE = MergeTree(d, k, 8192);
+CREATE TABLE test.punch_dst (d Date, k UInt64, s String) ENGINE = MergeTree(d, k, 8192);
+
+INSERT INTO test.punch_src SELECT toDate('2017-01-01'), number, toString(number) FROM system.numbers LIMIT 1000;
+INSERT INTO test.punch_src SELECT toDate('2017-02-01'), number, toString(number) FROM system.numbers LIMIT 1000;
+
+-- Same structure on both sides: the parts are cloned at the file level.
+INSERT INTO test.punch_dst SELECT * FROM test.punch_src;
+
+SELECT count(), sum(k) FROM test.punch_dst;
+SELECT count() FROM test.punch_dst WHERE d = toDate('2017-02-01');
+
+-- A filtered INSERT SELECT keeps using the ordinary block pipeline.
+INSERT INTO test.punch_dst SELECT * FROM test.punch_src WHERE k < 10;
+SELECT count() FROM test.punch_dst;
+
+DROP TABLE test.punch_src;
+DROP TABLE test.punch_dst;
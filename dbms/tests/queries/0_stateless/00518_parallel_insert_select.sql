@@ -0,0 +1,10 @@
+DROP TABLE IF EXISTS test.parallel_insert;
+CREATE TABLE test.parallel_insert (d Date, k UInt64) ENGINE = MergeTree(d, k, 8192);
+
+SET max_insert_threads = 4;
+
+INSERT INTO test.parallel_insert SELECT toDate('2017-01-01'), number FROM system.numbers LIMIT 100000;
+
+SELECT count(), sum(k), uniqExact(k) FROM test.parallel_insert;
+
+DROP TABLE test.parallel_insert;
@@ -0,0 +1,3 @@
+SELECT count() FROM (SELECT * FROM generateRandom('a UInt64, b String, c Float64', 5, 10, 42) LIMIT 1000);
+SELECT uniqExact(a) <= 10, uniqExact(b) <= 10, max(length(b)) <= 5 FROM (SELECT * FROM generateRandom('a UInt64, b String, c Float64', 5, 10, 42) LIMIT 1000);
+SELECT count(), max(length(s)) FROM (SELECT fs AS s FROM generateRandom('fs FixedString(8)', 10, 0, 1) LIMIT 100);
@@ -0,0 +1,14 @@
+DROP TABLE IF EXISTS test.conjunct_order;
+CREATE TABLE test.conjunct_order (d Date DEFAULT '2000-01-01', k UInt64, s String) ENGINE = MergeTree(d, k, 8192);
+
+INSERT INTO test.conjunct_order (k, s) SELECT number, concat('value_', toString(number % 100)) FROM system.numbers LIMIT 100000;
+
+SET optimize_conjunct_order = 1;
+SELECT count() FROM test.conjunct_order WHERE k % 100 < 50 AND s LIKE 'value_4%' AND k < 90000;
+SELECT sum(k) FROM test.conjunct_order WHERE k > 1000 AND s LIKE '%_42' AND k != 2000;
+
+SET optimize_conjunct_order = 0;
+SELECT count() FROM test.conjunct_order WHERE k % 100 < 50 AND s LIKE 'value_4%' AND k < 90000;
+SELECT sum(k) FROM test.conjunct_order WHERE k > 1000 AND s LIKE '%_42' AND k != 2000;
+
+DROP TABLE test.conjunct_order;
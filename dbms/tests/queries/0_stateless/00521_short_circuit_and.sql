@@ -0,0 +1,9 @@
+SET short_circuit_and_evaluation = 1;
+SELECT sum(number % 7 = 0 AND toString(number) LIKE '%3%') FROM (SELECT number FROM system.numbers LIMIT 10000);
+SELECT count() FROM (SELECT number FROM system.numbers LIMIT 10000) WHERE number % 3 = 1 AND number % 5 = 2 AND toString(number) LIKE '1%';
+SELECT sum(number = 1 AND rand() >= 0 AND number = 1) FROM (SELECT number FROM system.numbers LIMIT 10);
+
+SET short_circuit_and_evaluation = 0;
+SELECT sum(number % 7 = 0 AND toString(number) LIKE '%3%') FROM (SELECT number FROM system.numbers LIMIT 10000);
+SELECT count() FROM (SELECT number FROM system.numbers LIMIT 10000) WHERE number % 3 = 1 AND number % 5 = 2 AND toString(number) LIKE '1%';
+SELECT sum(number = 1 AND rand() >= 0 AND number = 1) FROM (SELECT number FROM system.numbers LIMIT 10);
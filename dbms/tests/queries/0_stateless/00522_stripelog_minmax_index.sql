@@ -0,0 +1,14 @@
+DROP TABLE IF EXISTS test.stripelog_minmax;
+CREATE TABLE test.stripelog_minmax (d UInt32, s String) ENGINE = StripeLog;
+
+INSERT INTO test.stripelog_minmax SELECT toUInt32(number), toString(number) FROM system.numbers LIMIT 100;
+INSERT INTO test.stripelog_minmax SELECT toUInt32(1000 + number), toString(number) FROM system.numbers LIMIT 100;
+INSERT INTO test.stripelog_minmax SELECT toUInt32(2000 + number), toString(number) FROM system.numbers LIMIT 100;
+
+SELECT count() FROM test.stripelog_minmax;
+SELECT count() FROM test.stripelog_minmax WHERE d >= 1000 AND d < 1100;
+SELECT sum(d) FROM test.stripelog_minmax WHERE d < 50;
+SELECT count() FROM test.stripelog_minmax WHERE d = 2050;
+SELECT count() FROM test.stripelog_minmax WHERE d > 5000;
+
+DROP TABLE test.stripelog_minmax;
@@ -0,0 +1,4 @@
+SELECT uniq(number % 100, number % 7) FROM system.numbers LIMIT 10000;
+SELECT uniq((number % 100, number % 7)) FROM system.numbers LIMIT 10000;
+SELECT uniq(number % 100, toString(number % 7)) FROM system.numbers LIMIT 10000;
+SELECT uniqUpTo(5)(number % 3, number % 2) FROM system.numbers LIMIT 100;
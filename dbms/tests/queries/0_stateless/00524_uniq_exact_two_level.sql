@@ -0,0 +1,4 @@
+SELECT uniqExact(number) FROM (SELECT number FROM system.numbers LIMIT 100000);
+SELECT uniqExact(toString(number)) FROM (SELECT number FROM system.numbers LIMIT 50000);
+SELECT uniqExactMerge(state) FROM (SELECT uniqExactState(number) AS state FROM (SELECT number FROM system.numbers LIMIT 100000) GROUP BY number % 3);
+SELECT uniqExact(number % 100) FROM (SELECT number FROM system.numbers LIMIT 10000);
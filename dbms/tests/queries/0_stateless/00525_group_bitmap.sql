@@ -0,0 +1,5 @@
+SELECT groupBitmap(toUInt32(number)) FROM (SELECT number FROM system.numbers LIMIT 100000);
+SELECT groupBitmap(toUInt8(number % 5)) FROM (SELECT number FROM system.numbers LIMIT 100);
+SELECT bitmapCardinality(groupBitmapState(toUInt16(number % 300))) FROM (SELECT number FROM system.numbers LIMIT 1000);
+SELECT bitmapCardinality(bitmapAnd(a, b)), bitmapCardinality(bitmapOr(a, b)), bitmapCardinality(bitmapAndnot(a, b)) FROM (SELECT groupBitmapIfState(toUInt32(number), number % 2 = 0) AS a, groupBitmapIfState(toUInt32(number), number % 3 = 0) AS b FROM (SELECT number FROM system.numbers LIMIT 1000));
+SELECT groupBitmapMerge(s) FROM (SELECT groupBitmapState(toUInt32(number)) AS s FROM (SELECT number FROM system.numbers LIMIT 100000) GROUP BY number % 3);
@@ -0,0 +1,4 @@
+SELECT uniq(number) FROM (SELECT number FROM system.numbers LIMIT 10);
+SELECT (SELECT uniq(number) FROM (SELECT number FROM system.numbers LIMIT 200)) = (SELECT uniqMerge(s) FROM (SELECT uniqState(number) AS s FROM (SELECT number FROM system.numbers LIMIT 200) GROUP BY number % 7));
+SELECT (SELECT uniq(number) FROM (SELECT number FROM system.numbers LIMIT 100000)) = (SELECT uniqMerge(s) FROM (SELECT uniqState(number) AS s FROM (SELECT number FROM system.numbers LIMIT 100000) GROUP BY number % 7));
+SELECT (SELECT uniqHLL12(number) FROM (SELECT number FROM system.numbers LIMIT 300)) = (SELECT uniqHLL12Merge(s) FROM (SELECT uniqHLL12State(number) AS s FROM (SELECT number FROM system.numbers LIMIT 300) GROUP BY number % 7));
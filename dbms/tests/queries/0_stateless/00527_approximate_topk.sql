@@ -0,0 +1,2 @@
+SELECT toUInt8(floor(sqrt(number))) AS k, count() AS c FROM (SELECT number FROM system.numbers LIMIT 100) GROUP BY k ORDER BY c DESC LIMIT 4 SETTINGS optimize_approximate_topk = 1;
+SELECT toString(toUInt8(floor(sqrt(number)))) AS k, count() AS c FROM (SELECT number FROM system.numbers LIMIT 100) GROUP BY k ORDER BY c DESC LIMIT 4 SETTINGS optimize_approximate_topk = 1;
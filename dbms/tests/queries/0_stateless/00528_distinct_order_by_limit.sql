@@ -0,0 +1,3 @@
+SELECT DISTINCT intDiv(number, 7) % 13 AS k FROM (SELECT number FROM system.numbers LIMIT 1000) ORDER BY k DESC LIMIT 5 SETTINGS optimize_distinct_order_by_limit = 1;
+SELECT DISTINCT intDiv(number, 7) % 13 AS k FROM (SELECT number FROM system.numbers LIMIT 1000) ORDER BY k LIMIT 3 OFFSET 2 SETTINGS optimize_distinct_order_by_limit = 1;
+SELECT DISTINCT number % 5 AS a, number % 3 AS b FROM (SELECT number FROM system.numbers LIMIT 100) ORDER BY a DESC, b ASC LIMIT 4 SETTINGS optimize_distinct_order_by_limit = 1;
@@ -0,0 +1,20 @@
+DROP TABLE IF EXISTS test.metadata_agg_1;
+DROP TABLE IF EXISTS test.metadata_agg_2;
+DROP TABLE IF EXISTS test.metadata_agg_merge;
+
+CREATE TABLE test.metadata_agg_1 (d Date, x UInt64) ENGINE = MergeTree(d, x, 8192);
+CREATE TABLE test.metadata_agg_2 (d Date, x UInt64) ENGINE = MergeTree(d, x, 8192);
+CREATE TABLE test.metadata_agg_merge (d Date, x UInt64) ENGINE = Merge(test, '^metadata_agg_\\d$');
+
+INSERT INTO test.metadata_agg_1 SELECT toDate('2017-01-01') + number, number FROM system.numbers LIMIT 10;
+INSERT INTO test.metadata_agg_2 SELECT toDate('2017-02-01') + number, number + 100 FROM system.numbers LIMIT 10;
+
+SELECT count(), min(d), max(d) FROM test.metadata_agg_merge;
+SELECT count(), max(d) FROM test.metadata_agg_merge WHERE _table = 'metadata_agg_1';
+SELECT count() FROM test.metadata_agg_merge WHERE d >= toDate('2017-02-01');
+SELECT min(d) FROM test.metadata_agg_merge WHERE _table = 'metadata_agg_none';
+SELECT count(), min(d), max(d) FROM test.metadata_agg_1;
+
+DROP TABLE test.metadata_agg_merge;
+DROP TABLE test.metadata_agg_2;
+DROP TABLE test.metadata_agg_1;
@@ -0,0 +1,15 @@
+DROP TABLE IF EXISTS test.pk_order_desc;
+CREATE TABLE test.pk_order_desc (d Date, x UInt64, v UInt64) ENGINE = MergeTree(d, x, 8);
+
+INSERT INTO test.pk_order_desc SELECT toDate('2017-01-01'), number, number * 2 FROM system.numbers LIMIT 100;
+INSERT INTO test.pk_order_desc SELECT toDate('2017-01-01'), number + 100, number FROM system.numbers LIMIT 100;
+
+SET optimize_read_in_order = 1;
+SELECT x, v FROM test.pk_order_desc ORDER BY x DESC LIMIT 5;
+SELECT x FROM test.pk_order_desc WHERE x < 42 ORDER BY x DESC LIMIT 3;
+SELECT count() FROM (SELECT x FROM test.pk_order_desc ORDER BY x DESC);
+
+SET optimize_read_in_order = 0;
+SELECT x, v FROM test.pk_order_desc ORDER BY x DESC LIMIT 5;
+
+DROP TABLE test.pk_order_desc;
@@ -0,0 +1,3 @@
+SELECT 'plain' AS s, 'a"b\\c/d' AS `w"n`, '\t' AS t FORMAT JSONEachRow;
+SELECT unhex('1F') AS c1, unhex('E280A8') AS c2, unhex('E280A9') AS c3 FORMAT JSONEachRow;
+SELECT concat('aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa', '"tail') AS long, 12345678901234 AS n FORMAT JSONEachRow;
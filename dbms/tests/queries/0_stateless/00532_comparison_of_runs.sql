@@ -0,0 +1,7 @@
+-- Columns with long runs of equal values take the run-wise path in comparison and arithmetic kernels.
+SELECT sum(intDiv(number, 1000) = 3) FROM (SELECT number FROM system.numbers LIMIT 100000);
+SELECT sum(intDiv(number, 1000) < 50) FROM (SELECT number FROM system.numbers LIMIT 100000);
+SELECT sum(intDiv(number, 1000) + 7) FROM (SELECT number FROM system.numbers LIMIT 100000);
+-- Data without runs takes the element-wise path.
+SELECT sum(number % 2 = 0) FROM (SELECT number FROM system.numbers LIMIT 100000);
+SELECT sum((number % 7) * 3) FROM (SELECT number FROM system.numbers LIMIT 100000);
@@ -0,0 +1,6 @@
+SET max_block_size = 3;
+SET output_format_parallel_formatting = 1;
+
+SELECT number FROM (SELECT number FROM system.numbers LIMIT 10) FORMAT TSV;
+SELECT number, toString(number) FROM (SELECT number FROM system.numbers LIMIT 10) FORMAT CSV;
+SELECT number FROM (SELECT number FROM system.numbers LIMIT 10) FORMAT JSONEachRow;
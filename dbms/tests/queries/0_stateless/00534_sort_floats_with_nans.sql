@@ -0,0 +1,4 @@
+SELECT if(isNaN(x), -1, toInt64(x)) FROM (SELECT if(number % 100 = 50, 0 / 0, toFloat64(number)) AS x FROM system.numbers LIMIT 300 ORDER BY x) LIMIT 5;
+SELECT if(isNaN(x), -1, toInt64(x)) FROM (SELECT if(number % 100 = 50, 0 / 0, toFloat64(number)) AS x FROM system.numbers LIMIT 300 ORDER BY x NULLS FIRST) LIMIT 5;
+SELECT if(isNaN(x), -1, toInt64(x)) FROM (SELECT if(number % 100 = 50, 0 / 0, toFloat64(number)) AS x FROM system.numbers LIMIT 300 ORDER BY x DESC) LIMIT 5;
+SELECT if(isNaN(x), -1, toInt64(x)) FROM (SELECT if(number % 100 = 50, 0 / 0, toFloat64(number)) AS x FROM system.numbers LIMIT 300 ORDER BY x DESC NULLS FIRST) LIMIT 5;
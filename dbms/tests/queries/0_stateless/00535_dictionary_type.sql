@@ -0,0 +1,47 @@
+DROP TABLE IF EXISTS test.dict_type;
+CREATE TABLE test.dict_type (d Date DEFAULT '2017-01-01', k UInt64, s Dictionary(String)) ENGINE = MergeTree(d, k, 8192);
+
+INSERT INTO test.dict_type (k, s) SELECT number, concat('value_', toString(number % 10)) FROM system.numbers LIMIT 1000;
+
+SELECT '*** round trip through the on-disk format ***';
+SELECT count(), uniqExact(s) FROM test.dict_type;
+SELECT s, count() FROM test.dict_type GROUP BY s ORDER BY s LIMIT 3;
+SELECT DISTINCT s FROM test.dict_type ORDER BY s DESC LIMIT 2;
+
+SELECT '*** comparisons ***';
+SELECT count() FROM test.dict_type WHERE s = 'value_3';
+SELECT count() FROM test.dict_type WHERE s != 'value_3';
+SELECT count() FROM test.dict_type WHERE s = concat('value_', toString(k % 10));
+
+SELECT '*** functions that decode through the generic fallback ***';
+SELECT sum(length(s)) FROM test.dict_type;
+SELECT count() FROM test.dict_type WHERE s LIKE 'value\_%';
+SELECT concat(s, '!'), upper(s) FROM test.dict_type WHERE k = 7;
+SELECT max(s) FROM test.dict_type;
+
+SELECT '*** conversions to and from the nested type ***';
+SELECT CAST(s AS String), toTypeName(CAST(s AS String)) FROM test.dict_type WHERE k = 5;
+SELECT CAST('abc' AS Dictionary(String)), toTypeName(CAST('abc' AS Dictionary(String)));
+SELECT CAST(s AS FixedString(7)) FROM test.dict_type WHERE k = 6;
+
+SELECT '*** INSERT SELECT from a plain String column ***';
+DROP TABLE IF EXISTS test.dict_type_copy;
+CREATE TABLE test.dict_type_copy (d Date DEFAULT '2017-01-01', k UInt64, s Dictionary(String)) ENGINE = MergeTree(d, k, 8192);
+INSERT INTO test.dict_type_copy (k, s) SELECT k, CAST(s AS String) FROM test.dict_type;
+SELECT count(), uniqExact(s) FROM test.dict_type_copy;
+
+SELECT '*** merge ***';
+INSERT INTO test.dict_type_copy (k, s) SELECT number, toString(number % 3) FROM system.numbers LIMIT 10;
+OPTIMIZE TABLE test.dict_type_copy;
+SELECT count(), uniqExact(s) FROM test.dict_type_copy;
+
+SELECT '*** numeric nested type ***';
+DROP TABLE IF EXISTS test.dict_type_num;
+CREATE TABLE test.dict_type_num (d Date DEFAULT '2017-01-01', k UInt64, x Dictionary(UInt16)) ENGINE = MergeTree(d, k, 8192);
+INSERT INTO test.dict_type_num (k, x) SELECT number, toUInt16(number % 7) FROM system.numbers LIMIT 1000;
+SELECT sum(x), uniqExact(x), sum(x + 1) FROM test.dict_type_num;
+SELECT count() FROM test.dict_type_num WHERE x < 3;
+
+DROP TABLE test.dict_type;
+DROP TABLE test.dict_type_copy;
+DROP TABLE test.dict_type_num;
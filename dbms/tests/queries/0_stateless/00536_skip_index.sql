@@ -0,0 +1,39 @@
+DROP TABLE IF EXISTS test.skip_index;
+
+CREATE TABLE test.skip_index (d Date DEFAULT '2017-01-01', k UInt64, u UInt64) ENGINE = MergeTree(d, k, 8) SETTINGS skip_index_columns = 'u', skip_index_granularity = 2;
+
+/* One skip index entry covers 2 granules of 8 rows, and u is constant within every entry. */
+INSERT INTO test.skip_index (k, u) SELECT number, intDiv(number, 16) FROM system.numbers LIMIT 160;
+
+SELECT '*** read the whole table ***';
+SELECT count(), sum(u) FROM test.skip_index;
+
+SELECT '*** the index prunes granule blocks ***';
+SET max_rows_to_read = 16;
+SELECT count(), min(k), max(k) FROM test.skip_index WHERE u = 3;
+SET max_rows_to_read = 32;
+SELECT count(), sum(k) FROM test.skip_index WHERE u >= 8 AND u < 10;
+SET max_rows_to_read = 1;
+SELECT count() FROM test.skip_index WHERE u = 100;
+SET max_rows_to_read = 0;
+
+SELECT '*** a second part with a partial final granule ***';
+INSERT INTO test.skip_index (k, u) SELECT 1000 + number, 777 FROM system.numbers LIMIT 5;
+SELECT count() FROM system.parts WHERE database = 'test' AND table = 'skip_index' AND active;
+SET max_rows_to_read = 5;
+SELECT count(), min(k), max(k) FROM test.skip_index WHERE u = 777;
+SET max_rows_to_read = 0;
+
+SELECT '*** the merged part rebuilds the index ***';
+OPTIMIZE TABLE test.skip_index;
+SELECT count() FROM system.parts WHERE database = 'test' AND table = 'skip_index' AND active;
+SELECT count(), sum(u) FROM test.skip_index;
+SET max_rows_to_read = 16;
+SELECT count(), min(k), max(k) FROM test.skip_index WHERE u = 3;
+SET max_rows_to_read = 32;
+SELECT count(), sum(k) FROM test.skip_index WHERE u >= 8 AND u < 10;
+SET max_rows_to_read = 5;
+SELECT count(), sum(k) FROM test.skip_index WHERE u = 777;
+SET max_rows_to_read = 0;
+
+DROP TABLE test.skip_index;
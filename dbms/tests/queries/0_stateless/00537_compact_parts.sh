@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+
+clickhouse-client -n --query="
+    DROP TABLE IF EXISTS test.compact_parts;
+    CREATE TABLE test.compact_parts (d Date DEFAULT '2017-01-01', k UInt64, s String) ENGINE = MergeTree(d, k, 8192) SETTINGS min_bytes_for_wide_part = 1048576;"
+
+clickhouse-client --query="SELECT '*** small inserts are written as compact parts ***'"
+clickhouse-client --query="INSERT INTO test.compact_parts (k, s) SELECT number, toString(number) FROM system.numbers LIMIT 100"
+clickhouse-client --query="INSERT INTO test.compact_parts (k, s) SELECT 100 + number, toString(100 + number) FROM system.numbers LIMIT 100"
+clickhouse-client --query="SELECT count() FROM system.parts WHERE database = 'test' AND table = 'compact_parts' AND active"
+clickhouse-client --query="SELECT count(), sum(k) FROM test.compact_parts"
+clickhouse-client --query="SELECT k, s FROM test.compact_parts WHERE k IN (0, 99, 100, 199) ORDER BY k"
+
+clickhouse-client --query="SELECT '*** detach and attach the table ***'"
+clickhouse-client -n --query="DETACH TABLE test.compact_parts; ATTACH TABLE test.compact_parts;"
+clickhouse-client --query="SELECT count(), sum(k) FROM test.compact_parts"
+
+clickhouse-client --query="SELECT '*** detach and attach the partition ***'"
+clickhouse-client --query="ALTER TABLE test.compact_parts DETACH PARTITION 201701"
+clickhouse-client --query="SELECT count() FROM test.compact_parts"
+clickhouse-client --query="ALTER TABLE test.compact_parts ATTACH PARTITION 201701"
+clickhouse-client --query="SELECT count(), sum(k) FROM test.compact_parts"
+
+clickhouse-client --query="SELECT '*** alter of a compact part is rejected ***'"
+clickhouse-client --query="ALTER TABLE test.compact_parts DROP COLUMN s" 2>&1 | grep -q 'stored in the compact format' && echo 'Rejected' || echo 'Fail'
+clickhouse-client --query="SELECT count(), sum(k) FROM test.compact_parts"
+
+clickhouse-client --query="SELECT '*** the merge rewrites parts in the wide format ***'"
+clickhouse-client --query="OPTIMIZE TABLE test.compact_parts"
+clickhouse-client --query="SELECT count() FROM system.parts WHERE database = 'test' AND table = 'compact_parts' AND active"
+clickhouse-client --query="SELECT count(), sum(k) FROM test.compact_parts"
+clickhouse-client --query="ALTER TABLE test.compact_parts DROP COLUMN s"
+clickhouse-client --query="DESC TABLE test.compact_parts"
+clickhouse-client --query="SELECT count(), sum(k) FROM test.compact_parts"
+
+clickhouse-client --query="DROP TABLE test.compact_parts"
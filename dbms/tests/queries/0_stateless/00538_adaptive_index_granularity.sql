@@ -0,0 +1,29 @@
+DROP TABLE IF EXISTS test.adaptive_granularity;
+
+CREATE TABLE test.adaptive_granularity (d Date DEFAULT '2017-01-01', k UInt64, s String) ENGINE = MergeTree(d, k, 8192) SETTINGS index_granularity_bytes = 2048;
+
+/* Narrow rows (about 20 bytes) get about a hundred rows per granule, fat rows (over 500 bytes) just a few. */
+INSERT INTO test.adaptive_granularity (k, s) SELECT number, 'x' FROM system.numbers LIMIT 10000;
+INSERT INTO test.adaptive_granularity (k, s) SELECT 10000 + number, arrayStringConcat(arrayMap(i -> 'y', range(500))) FROM system.numbers LIMIT 1000;
+
+SELECT '*** each part is written with its own granularity ***';
+SELECT rows, rows > marks * 50 FROM system.parts WHERE database = 'test' AND table = 'adaptive_granularity' AND active ORDER BY rows;
+SELECT count(), sum(k) FROM test.adaptive_granularity;
+
+SELECT '*** the primary key prunes with per-part granule sizes ***';
+SET max_rows_to_read = 306;
+SELECT k, length(s) FROM test.adaptive_granularity WHERE k = 5000;
+SET max_rows_to_read = 12;
+SELECT k, length(s) FROM test.adaptive_granularity WHERE k = 10500;
+SET max_rows_to_read = 0;
+
+SELECT '*** a merge mixing parts of different granularities ***';
+OPTIMIZE TABLE test.adaptive_granularity;
+SELECT count() FROM system.parts WHERE database = 'test' AND table = 'adaptive_granularity' AND active;
+SELECT count(), sum(k) FROM test.adaptive_granularity;
+SET max_rows_to_read = 256;
+SELECT k, length(s) FROM test.adaptive_granularity WHERE k = 5000;
+SELECT k, length(s) FROM test.adaptive_granularity WHERE k = 10500;
+SET max_rows_to_read = 0;
+
+DROP TABLE test.adaptive_granularity;
@@ -0,0 +1,21 @@
+DROP TABLE IF EXISTS test.ttl;
+
+CREATE TABLE test.ttl (d Date, k UInt64, t DateTime) ENGINE = MergeTree(d, k, 8192) TTL t + 60;
+
+INSERT INTO test.ttl SELECT toDate('2017-01-01'), number, now() - 1000 FROM system.numbers LIMIT 50;
+INSERT INTO test.ttl SELECT toDate('2017-01-01'), 100 + number, now() + 1000 FROM system.numbers LIMIT 50;
+
+/** Expiration is checked only when parts are merged. */
+SELECT '*** rows do not expire before a merge ***';
+SELECT count(), sum(k) FROM test.ttl;
+
+SELECT '*** the merge drops expired rows and keeps the rest ***';
+OPTIMIZE TABLE test.ttl FINAL;
+SELECT count(), min(k), max(k) FROM test.ttl;
+SELECT count() FROM test.ttl WHERE k < 50;
+
+SELECT '*** rows with the expression in the future survive repeated merges ***';
+OPTIMIZE TABLE test.ttl FINAL;
+SELECT count(), min(k), max(k) FROM test.ttl;
+
+DROP TABLE test.ttl;
@@ -143,3 +143,31 @@ inline const char * find_first_symbols(const char * begin, const char * end)
 #endif
         return detail::find_first_symbols_sse2<symbols...>(begin, end);
 }
+
+
+/** The same, but one of the symbols to search for is known only at runtime
+  *  (for example, a configurable CSV delimiter).
+  */
+template <char... symbols>
+inline const char * find_first_symbols_or(const char * begin, const char * end, char runtime_symbol)
+{
+#if __SSE2__
+    const __m128i runtime_set = _mm_set1_epi8(runtime_symbol);
+
+    for (; begin + 15 < end; begin += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+
+        __m128i eq = _mm_or_si128(detail::mm_is_in<symbols...>(bytes), _mm_cmpeq_epi8(bytes, runtime_set));
+
+        uint16_t bit_mask = _mm_movemask_epi8(eq);
+        if (bit_mask)
+            return begin + __builtin_ctz(bit_mask);
+    }
+#endif
+
+    for (; begin < end; ++begin)
+        if (*begin == runtime_symbol || detail::is_in<symbols...>(*begin))
+            return begin;
+    return end;
+}